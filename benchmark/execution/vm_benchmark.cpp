@@ -0,0 +1,92 @@
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "common/macros.h"
+#include "execution/util/cpu_info.h"
+#include "execution/vm/module.h"
+#include "execution/vm/module_compiler.h"
+
+namespace terrier {
+
+/**
+ * Microbenchmarks for the bytecode interpreter. Each benchmark compiles one of the non-SQL sample TPL programs once
+ * and then repeatedly invokes its main() function in interpreted mode, so only the VM's dispatch loop is measured.
+ */
+class VMBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State &state) final { execution::CpuInfo::Instance(); }
+
+  /**
+   * Run the main() function of the given sample TPL file once per benchmark iteration.
+   * @tparam Ret The return type of the sample's main() function
+   * @param state The benchmark state
+   * @param file The name of the file in the sample_tpl directory
+   * @param expected The expected result of main()
+   */
+  template <typename Ret>
+  void RunSample(benchmark::State *state, const std::string &file, const Ret expected) {
+    std::ifstream input(std::string(TPL_SAMPLE_DIR) + "/" + file);
+    TERRIER_ASSERT(input.good(), "Unable to open sample TPL file");
+    std::stringstream source;
+    source << input.rdbuf();
+
+    execution::vm::test::ModuleCompiler compiler;
+    auto module = compiler.CompileToModule(source.str());
+    TERRIER_ASSERT(module != nullptr, "Sample TPL file failed to compile");
+
+    std::function<Ret()> main;
+    const bool found = module->GetFunction("main", execution::vm::ExecutionMode::Interpret, &main);
+    TERRIER_ASSERT(found, "Sample TPL file has no main() function");
+    (void)found;
+
+    // NOLINTNEXTLINE
+    for (auto _ : *state) {
+      const Ret result = main();
+      TERRIER_ASSERT(result == expected, "Unexpected result from sample TPL file");
+      benchmark::DoNotOptimize(result);
+    }
+    state->SetItemsProcessed(state->iterations());
+  }
+};
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(VMBenchmark, Fibonacci)(benchmark::State &state) { RunSample<int64_t>(&state, "fib.tpl", 6765); }
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(VMBenchmark, Loop)(benchmark::State &state) { RunSample<int32_t>(&state, "loop2.tpl", 1666683333); }
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(VMBenchmark, NestedLoop)(benchmark::State &state) {
+  RunSample<int32_t>(&state, "loop4.tpl", 166167000);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(VMBenchmark, StructField)(benchmark::State &state) {
+  RunSample<int64_t>(&state, "struct-debug.tpl", 100000);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(VMBenchmark, ArrayIterate)(benchmark::State &state) {
+  RunSample<int64_t>(&state, "array-iterate.tpl", 110);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(VMBenchmark, Mixed)(benchmark::State &state) { RunSample<int32_t>(&state, "test.tpl", 356405); }
+
+// ----------------------------------------------------------------------------
+// BENCHMARK REGISTRATION
+// ----------------------------------------------------------------------------
+// clang-format off
+BENCHMARK_REGISTER_F(VMBenchmark, Fibonacci)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(VMBenchmark, Loop)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(VMBenchmark, NestedLoop)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(VMBenchmark, StructField)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(VMBenchmark, ArrayIterate)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(VMBenchmark, Mixed)->Unit(benchmark::kMicrosecond);
+// clang-format on
+
+}  // namespace terrier
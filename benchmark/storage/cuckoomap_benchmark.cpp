@@ -1,10 +1,13 @@
 #include <memory>
+#include <unordered_set>
+#include <variant>  // NOLINT (Matt): lint thinks this C++17 header is a C header because it only knows C++11
 #include <vector>
 
 #include "benchmark/benchmark.h"
 #include "benchmark_util/benchmark_config.h"
 #include "common/scoped_timer.h"
 #include "libcuckoo/cuckoohash_map.hh"
+#include "storage/index/inline_multi_value.h"
 #include "test_util/multithread_test_util.h"
 #include "xxHash/xxh3.h"
 
@@ -39,6 +42,101 @@ class CuckooMapBenchmark : public benchmark::Fixture {
 
   using CuckooMap = cuckoohash_map<int64_t, int64_t, KeyHash>;
 
+  // Number of values per key in the multi-value benchmarks, a moderate fan-out as in a non-unique secondary index
+  const uint32_t fan_out_ = 4;
+
+  // The layout HashIndex used to store the values of a key: a single value, or a node-based set once there are more
+  using VariantValue = std::variant<int64_t, std::unordered_set<int64_t, KeyHash>>;
+
+  struct VariantValueOps {
+    static void Insert(VariantValue *const value, const int64_t v) {
+      if (std::holds_alternative<int64_t>(*value)) {
+        const auto existing = std::get<int64_t>(*value);
+        *value = std::unordered_set<int64_t, KeyHash>({existing, v}, 2);
+      } else {
+        std::get<std::unordered_set<int64_t, KeyHash>>(*value).emplace(v);
+      }
+    }
+
+    static bool Erase(VariantValue *const value, const int64_t v) {
+      if (std::holds_alternative<int64_t>(*value)) return true;
+      auto &set = std::get<std::unordered_set<int64_t, KeyHash>>(*value);
+      if (set.size() == 2) {
+        for (const auto i : set) {
+          if (i != v) {
+            *value = i;
+            break;
+          }
+        }
+        return false;
+      }
+      set.erase(v);
+      return false;
+    }
+  };
+
+  // The layout HashIndex uses now
+  using InlineValue = storage::index::InlineMultiValue<int64_t, 3>;
+
+  struct InlineValueOps {
+    static void Insert(InlineValue *const value, const int64_t v) { value->Insert(v); }
+
+    static bool Erase(InlineValue *const value, const int64_t v) {
+      if (value->Size() == 1) return true;
+      value->Erase(v);
+      return false;
+    }
+  };
+
+  /**
+   * Every thread inserts fan_out_ values for each key in its share of the key space, then erases them all again. The
+   * map starts out empty, so every key goes through single-value, spilled and erased states.
+   */
+  template <typename ValueType, typename Ops>
+  void RunMultiValueWorkload(benchmark::State *const state) {
+    common::WorkerPool thread_pool(BenchmarkConfig::num_threads, {});
+    thread_pool.Startup();
+    const uint32_t num_distinct_keys = num_keys_ / fan_out_;
+
+    // NOLINTNEXTLINE
+    for (auto _ : *state) {
+      auto *const index = new cuckoohash_map<int64_t, ValueType, KeyHash>(256);
+
+      auto workload = [&](uint32_t id) {
+        uint32_t start_key = num_distinct_keys / BenchmarkConfig::num_threads * id;
+        uint32_t end_key = start_key + num_distinct_keys / BenchmarkConfig::num_threads;
+
+        for (uint32_t copy = 0; copy < fan_out_; copy++) {
+          for (uint32_t i = start_key; i < end_key; i++) {
+            const int64_t v = static_cast<int64_t>(copy) * num_distinct_keys + i;
+            index->uprase_fn(
+                key_permutation_[i],
+                [v](ValueType &value) {
+                  Ops::Insert(&value, v);
+                  return false;
+                },
+                v);
+          }
+        }
+        for (uint32_t copy = 0; copy < fan_out_; copy++) {
+          for (uint32_t i = start_key; i < end_key; i++) {
+            const int64_t v = static_cast<int64_t>(copy) * num_distinct_keys + i;
+            index->erase_fn(key_permutation_[i], [v](ValueType &value) { return Ops::Erase(&value, v); });
+          }
+        }
+      };
+
+      uint64_t elapsed_ms;
+      {
+        common::ScopedTimer<std::chrono::milliseconds> timer(&elapsed_ms);
+        MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool, BenchmarkConfig::num_threads, workload);
+      }
+      delete index;
+      state->SetIterationTime(static_cast<double>(elapsed_ms) / 1000.0);
+    }
+    state->SetItemsProcessed(state->iterations() * num_keys_ * 2);
+  }
+
   std::default_random_engine generator_;
   std::vector<int64_t> key_permutation_;
 };
@@ -249,6 +347,16 @@ BENCHMARK_DEFINE_F(CuckooMapBenchmark, SequentialInsertSequentialRead)(benchmark
   state.SetItemsProcessed(state.iterations() * num_keys_);
 }
 
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(CuckooMapBenchmark, MultiValueInsertEraseVariant)(benchmark::State &state) {
+  RunMultiValueWorkload<VariantValue, VariantValueOps>(&state);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(CuckooMapBenchmark, MultiValueInsertEraseInline)(benchmark::State &state) {
+  RunMultiValueWorkload<InlineValue, InlineValueOps>(&state);
+}
+
 // ----------------------------------------------------------------------------
 // BENCHMARK REGISTRATION
 // ----------------------------------------------------------------------------
@@ -277,6 +385,14 @@ BENCHMARK_REGISTER_F(CuckooMapBenchmark, SequentialInsertSequentialRead)
     ->Unit(benchmark::kMillisecond)
     ->UseManualTime()
     ->MinTime(3);
+BENCHMARK_REGISTER_F(CuckooMapBenchmark, MultiValueInsertEraseVariant)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->MinTime(3);
+BENCHMARK_REGISTER_F(CuckooMapBenchmark, MultiValueInsertEraseInline)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->MinTime(3);
 // clang-format on
 
 }  // namespace terrier
@@ -48,6 +48,15 @@ class DataTableBenchmark : public benchmark::Fixture {
     reads_.clear();
   }
 
+  // Bytes of attribute data a scan of all columns copies per tuple, excluding the version pointer
+  uint64_t ScannedTupleSize() const {
+    uint64_t size = 0;
+    for (const storage::col_id_t col : StorageTestUtil::ProjectionListAllColumns(layout_)) {
+      size += layout_.AttrSize(col);
+    }
+    return size;
+  }
+
   // Tuple layout
   const uint8_t column_size_ = 8;
   const storage::BlockLayout layout_{{column_size_, column_size_, column_size_}};
@@ -250,6 +259,64 @@ BENCHMARK_DEFINE_F(DataTableBenchmark, Scan)(benchmark::State &state) {
     delete[] p;
   }
   state.SetItemsProcessed(state.iterations() * num_reads_ * BenchmarkConfig::num_threads);
+  state.SetBytesProcessed(state.iterations() * num_reads_ * BenchmarkConfig::num_threads * ScannedTupleSize());
+}
+
+// Read the num_reads_ of tuples in the sequential order from a DataTable concurrently, after their version chains were
+// truncated as the GC would, so that the scans copy whole column segments
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(DataTableBenchmark, ScanWithoutVersions)(benchmark::State &state) {
+  storage::DataTable read_table(common::ManagedPointer<storage::BlockStore>(&block_store_), layout_,
+                                storage::layout_version_t(0));
+
+  // populate read_table_ by inserting tuples
+  // We can use dummy timestamps here since we're not invoking concurrency control
+  transaction::TransactionContext txn(transaction::timestamp_t(0), transaction::timestamp_t(0),
+                                      common::ManagedPointer(&buffer_pool_), DISABLED);
+  storage::TupleAccessStrategy accessor(layout_);
+  for (uint32_t i = 0; i < num_reads_; ++i) {
+    const storage::TupleSlot slot = read_table.Insert(common::ManagedPointer(&txn), *redo_);
+    auto *const version_ptr = accessor.AccessWithoutNullCheck(slot, storage::VERSION_POINTER_COLUMN_ID);
+    *reinterpret_cast<storage::UndoRecord **>(version_ptr) = nullptr;
+  }
+
+  std::vector<storage::col_id_t> all_cols = StorageTestUtil::ProjectionListAllColumns(layout_);
+  storage::ProjectedColumnsInitializer initializer(layout_, all_cols, common::Constants::K_DEFAULT_VECTOR_SIZE);
+
+  std::vector<storage::ProjectedColumns *> all_columns;
+  std::vector<byte *> buf;
+  for (uint32_t j = 0; j < BenchmarkConfig::num_threads; j++) {
+    auto *buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedColumnsSize());
+    storage::ProjectedColumns *columns = initializer.Initialize(buffer);
+    all_columns.push_back(columns);
+    buf.push_back(buffer);
+  }
+
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    auto workload = [&](uint32_t id) {
+      auto it = read_table.begin();
+      while (it != read_table.end()) {
+        read_table.Scan(common::ManagedPointer(&txn), &it, all_columns[id]);
+      }
+    };
+    common::WorkerPool thread_pool(BenchmarkConfig::num_threads, {});
+    thread_pool.Startup();
+    uint64_t elapsed_ms;
+    {
+      common::ScopedTimer<std::chrono::milliseconds> timer(&elapsed_ms);
+      for (uint32_t j = 0; j < BenchmarkConfig::num_threads; j++) {
+        thread_pool.SubmitTask([j, &workload] { workload(j); });
+      }
+      thread_pool.WaitUntilAllFinished();
+    }
+    state.SetIterationTime(static_cast<double>(elapsed_ms) / 1000.0);
+  }
+  for (auto p : buf) {
+    delete[] p;
+  }
+  state.SetItemsProcessed(state.iterations() * num_reads_ * BenchmarkConfig::num_threads);
+  state.SetBytesProcessed(state.iterations() * num_reads_ * BenchmarkConfig::num_threads * ScannedTupleSize());
 }
 
 // ----------------------------------------------------------------------------
@@ -272,6 +339,10 @@ BENCHMARK_REGISTER_F(DataTableBenchmark, Scan)
     ->Unit(benchmark::kMillisecond)
     ->UseRealTime()
     ->UseManualTime();
+BENCHMARK_REGISTER_F(DataTableBenchmark, ScanWithoutVersions)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->UseManualTime();
 // clang-format on
 
 }  // namespace terrier
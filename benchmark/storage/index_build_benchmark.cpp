@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "common/scoped_timer.h"
+#include "parser/expression/column_value_expression.h"
+#include "storage/index/index.h"
+#include "storage/index/index_builder.h"
+#include "storage/projected_row.h"
+#include "storage/sql_table.h"
+#include "test_util/catalog_test_util.h"
+#include "test_util/storage_test_util.h"
+#include "transaction/transaction_manager.h"
+#include "type/type_id.h"
+
+namespace terrier {
+
+// This benchmark measures how many rows per second CREATE INDEX can index on a table that is already populated. The
+// table holds its keys in random order, so the build has to sort them before they can be loaded into the BwTree.
+
+class IndexBuildBenchmark : public benchmark::Fixture {
+ private:
+  // Test infrastructure
+  storage::BlockStore block_store_{100000, 1000};
+  storage::RecordBufferSegmentPool buffer_pool_{10000000, 1000000};
+
+  // Table
+  catalog::Schema table_schema_;
+  catalog::IndexSchema index_schema_;
+
+ public:
+  const uint32_t table_size_ = 10000000;
+
+  storage::SqlTable *sql_table_;
+
+  transaction::TimestampManager *timestamp_manager_;
+  transaction::DeferredActionManager *deferred_action_manager_;
+  transaction::TransactionManager *txn_manager_;
+
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    auto col = catalog::Schema::Column(
+        "attribute", type::TypeId::INTEGER, false,
+        parser::ConstantValueExpression(type::TransientValueFactory::GetNull(type::TypeId::INTEGER)));
+    StorageTestUtil::ForceOid(&(col), catalog::col_oid_t(1));
+    table_schema_ = catalog::Schema({col});
+    sql_table_ = new storage::SqlTable(common::ManagedPointer(&block_store_), table_schema_);
+
+    std::vector<catalog::IndexSchema::Column> keycols;
+    keycols.emplace_back("", type::TypeId::INTEGER, false,
+                         parser::ColumnValueExpression(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID,
+                                                       catalog::col_oid_t(1)));
+    StorageTestUtil::ForceOid(&(keycols[0]), catalog::indexkeycol_oid_t(1));
+    index_schema_ = catalog::IndexSchema(keycols, storage::index::IndexType::BWTREE, false, false, false, true);
+
+    timestamp_manager_ = new transaction::TimestampManager;
+    deferred_action_manager_ = new transaction::DeferredActionManager(common::ManagedPointer(timestamp_manager_));
+    txn_manager_ = new transaction::TransactionManager(common::ManagedPointer(timestamp_manager_),
+                                                       common::ManagedPointer(deferred_action_manager_),
+                                                       common::ManagedPointer(&buffer_pool_), true, DISABLED);
+
+    // Populate the table with a random permutation of [0, table_size)
+    std::vector<int32_t> keys(table_size_);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::default_random_engine{});
+
+    const auto tuple_initializer = sql_table_->InitializerForProjectedRow({catalog::col_oid_t(1)});
+    auto *const insert_txn = txn_manager_->BeginTransaction();
+    for (const auto key : keys) {
+      auto *const insert_redo =
+          insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer);
+      *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = key;
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+    }
+    txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  }
+
+  void TearDown(const benchmark::State &state) override {
+    delete sql_table_;
+    delete txn_manager_;
+    delete deferred_action_manager_;
+    delete timestamp_manager_;
+  }
+
+  // Builds a fresh index over the table and returns the time spent populating it
+  template <typename BuildFn>
+  uint64_t BuildIndex(const BuildFn &build_fn) {
+    auto *const index = storage::index::IndexBuilder().SetKeySchema(index_schema_).Build();
+    auto *const build_txn = txn_manager_->BeginTransaction();
+    uint64_t elapsed_ms;
+    {
+      common::ScopedTimer<std::chrono::milliseconds> timer(&elapsed_ms);
+      build_fn(index, build_txn);
+    }
+    txn_manager_->Commit(build_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    delete index;
+    return elapsed_ms;
+  }
+};
+
+// Parallel scan, parallel sort and bottom-up BwTree construction
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBuildBenchmark, BwTreeBulkLoad)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    const auto elapsed_ms = BuildIndex([&](storage::index::Index *index, transaction::TransactionContext *txn) {
+      index->BulkLoad(common::ManagedPointer(txn), common::ManagedPointer(sql_table_), DISABLED);
+    });
+    state.SetIterationTime(static_cast<double>(elapsed_ms) / 1000.0);
+  }
+  state.SetItemsProcessed(state.iterations() * table_size_);
+}
+
+// Single-threaded scan with one BwTree insert per row, which is what the bulk load replaces
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBuildBenchmark, BwTreeInsertPerRow)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    const auto elapsed_ms = BuildIndex([&](storage::index::Index *index, transaction::TransactionContext *txn) {
+      index->Index::BulkLoad(common::ManagedPointer(txn), common::ManagedPointer(sql_table_), DISABLED);
+    });
+    state.SetIterationTime(static_cast<double>(elapsed_ms) / 1000.0);
+  }
+  state.SetItemsProcessed(state.iterations() * table_size_);
+}
+
+// ----------------------------------------------------------------------------
+// BENCHMARK REGISTRATION
+// ----------------------------------------------------------------------------
+// clang-format off
+BENCHMARK_REGISTER_F(IndexBuildBenchmark, BwTreeBulkLoad)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBuildBenchmark, BwTreeInsertPerRow)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+// clang-format on
+
+}  // namespace terrier
@@ -40,12 +40,15 @@ class IndexBenchmark : public benchmark::Fixture {
   // Table size chosen to exceed L3 cache size on benchmark machine
   const uint32_t table_size_ = 100000000;
 
+  // Number of keys per batch lookup, one vector of a sequential scan
+  const uint32_t batch_size_ = 2048;
+
   // SqlTable
   storage::SqlTable *sql_table_;
   storage::ProjectedRowInitializer tuple_initializer_ =
       storage::ProjectedRowInitializer::Create(std::vector<uint16_t>{1}, std::vector<uint16_t>{1});  // This is a dummy
 
-  // HashIndex or BwTreeIndex
+  // HashIndex, BwTreeIndex or ArtIndex
   common::ManagedPointer<storage::index::Index> index_;
   transaction::TimestampManager *timestamp_manager_;
   transaction::DeferredActionManager *deferred_action_manager_;
@@ -166,6 +169,42 @@ class IndexBenchmark : public benchmark::Fixture {
     txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
     return total_ns;
   }
+
+  // Same lookups as RunWorkload, but handed to the index a vector of keys at a time through ScanKeyBatch, as the index
+  // nested loop join does
+  uint64_t RunBatchWorkload() {
+    auto *scan_txn = txn_manager_->BeginTransaction();
+    const auto key_size = index_->GetProjectedRowInitializer().ProjectedRowSize();
+    std::vector<byte> key_buffers(batch_size_ * key_size);
+    std::vector<const storage::ProjectedRow *> keys(batch_size_);
+    std::vector<storage::ProjectedRow *> key_prs(batch_size_);
+    for (uint32_t i = 0; i < batch_size_; i++) {
+      key_prs[i] = index_->GetProjectedRowInitializer().InitializeRow(key_buffers.data() + i * key_size);
+      keys[i] = key_prs[i];
+    }
+    uint64_t total_ns = 0;
+    uint64_t elapsed_ns = 0;
+
+    std::vector<storage::TupleSlot> results;
+    std::vector<uint32_t> offsets;
+    for (uint32_t i = 0; i < table_size_; i += batch_size_) {
+      for (uint32_t j = 0; j < batch_size_; j++) {
+        const uint32_t random_key =
+            std::uniform_int_distribution(static_cast<uint32_t>(0), static_cast<uint32_t>(table_size_ - 1))(generator_);
+        *reinterpret_cast<uint32_t *>(key_prs[j]->AccessForceNotNull(0)) = random_key;
+      }
+      {
+        common::ScopedTimer<std::chrono::nanoseconds> timer(&elapsed_ns);
+        index_->ScanKeyBatch(*scan_txn, keys.data(), batch_size_, &results, &offsets);
+      }
+      EXPECT_EQ(results.size(), batch_size_);
+      results.clear();
+      total_ns += elapsed_ns;
+    }
+
+    txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    return total_ns;
+  }
 };
 
 // Determine required time to run key lookup with BwTree structure for index
@@ -199,6 +238,45 @@ BENCHMARK_DEFINE_F(IndexBenchmark, HashIndexRandomScanKey)(benchmark::State &sta
   state.SetItemsProcessed(state.iterations() * table_size_);
 }
 
+// Determine required time to run key lookup with adaptive radix tree structure for index
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBenchmark, ArtIndexRandomScanKey)(benchmark::State &state) {
+  CreateIndex(storage::index::IndexType::ART);
+  PopulateTableAndIndex();
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    // Run key lookup and record amount of time required in seconds
+    const auto total_ns = RunWorkload();
+    state.SetIterationTime(static_cast<double>(total_ns) / 1000000000.0);
+  }
+  // Determine total number of items processed
+  state.SetItemsProcessed(state.iterations() * table_size_);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBenchmark, BwTreeIndexRandomScanKeyBatch)(benchmark::State &state) {
+  CreateIndex(storage::index::IndexType::BWTREE);
+  PopulateTableAndIndex();
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    const auto total_ns = RunBatchWorkload();
+    state.SetIterationTime(static_cast<double>(total_ns) / 1000000000.0);
+  }
+  state.SetItemsProcessed(state.iterations() * table_size_);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(IndexBenchmark, HashIndexRandomScanKeyBatch)(benchmark::State &state) {
+  CreateIndex(storage::index::IndexType::HASHMAP);
+  PopulateTableAndIndex();
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    const auto total_ns = RunBatchWorkload();
+    state.SetIterationTime(static_cast<double>(total_ns) / 1000000000.0);
+  }
+  state.SetItemsProcessed(state.iterations() * table_size_);
+}
+
 // ----------------------------------------------------------------------------
 // BENCHMARK REGISTRATION
 // ----------------------------------------------------------------------------
@@ -209,6 +287,15 @@ BENCHMARK_REGISTER_F(IndexBenchmark, BwTreeIndexRandomScanKey)
 BENCHMARK_REGISTER_F(IndexBenchmark, HashIndexRandomScanKey)
     ->UseManualTime()
     ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBenchmark, ArtIndexRandomScanKey)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBenchmark, BwTreeIndexRandomScanKeyBatch)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexBenchmark, HashIndexRandomScanKeyBatch)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
 // clang-format on
 
 }  // namespace terrier
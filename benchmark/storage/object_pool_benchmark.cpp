@@ -0,0 +1,70 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_util/benchmark_config.h"
+#include "common/scoped_timer.h"
+#include "storage/record_buffer.h"
+#include "storage/storage_defs.h"
+#include "test_util/multithread_test_util.h"
+
+namespace terrier {
+
+// These benchmarks have every thread repeatedly get a handful of objects from a shared pool and release them again,
+// the way every transaction gets and releases its undo and redo buffer segments. They measure how well the pools
+// scale with the number of threads, so the objects themselves are never touched.
+class ObjectPoolBenchmark : public benchmark::Fixture {
+ public:
+  // Gets and releases batch_size_ objects at a time from the given pool on every thread
+  template <class Pool>
+  void GetRelease(benchmark::State *const state, Pool *const pool) {
+    common::WorkerPool thread_pool(BenchmarkConfig::num_threads, {});
+    thread_pool.Startup();
+
+    // NOLINTNEXTLINE
+    for (auto _ : *state) {
+      auto workload = [&](uint32_t id) {
+        std::vector<decltype(pool->Get())> objects;
+        objects.reserve(batch_size_);
+        for (uint32_t i = 0; i < num_batches_ / BenchmarkConfig::num_threads; i++) {
+          for (uint32_t j = 0; j < batch_size_; j++) objects.push_back(pool->Get());
+          for (auto *const object : objects) pool->Release(object);
+          objects.clear();
+        }
+      };
+
+      uint64_t elapsed_ms;
+      {
+        common::ScopedTimer<std::chrono::milliseconds> timer(&elapsed_ms);
+        MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool, BenchmarkConfig::num_threads, workload);
+      }
+      state->SetIterationTime(static_cast<double>(elapsed_ms) / 1000.0);
+    }
+    state->SetItemsProcessed(state->iterations() * (num_batches_ / BenchmarkConfig::num_threads) *
+                             BenchmarkConfig::num_threads * batch_size_);
+  }
+
+  // Workload
+  const uint32_t num_batches_ = 10000000;
+  const uint32_t batch_size_ = 4;
+};
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(ObjectPoolBenchmark, RecordBufferSegmentGetRelease)(benchmark::State &state) {
+  storage::RecordBufferSegmentPool pool(BenchmarkConfig::num_threads * batch_size_,
+                                        BenchmarkConfig::num_threads * batch_size_);
+  GetRelease(&state, &pool);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(ObjectPoolBenchmark, BlockGetRelease)(benchmark::State &state) {
+  storage::BlockStore pool(BenchmarkConfig::num_threads * batch_size_, BenchmarkConfig::num_threads * batch_size_);
+  GetRelease(&state, &pool);
+}
+
+BENCHMARK_REGISTER_F(ObjectPoolBenchmark, RecordBufferSegmentGetRelease)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->MinTime(3);
+BENCHMARK_REGISTER_F(ObjectPoolBenchmark, BlockGetRelease)->Unit(benchmark::kMillisecond)->UseManualTime()->MinTime(3);
+
+}  // namespace terrier
@@ -0,0 +1,26 @@
+// Perform (in vectorized fashion)
+//
+// SELECT colA FROM test_1 WHERE colA > -1 AND colA IN (3, 7, 7000, 20000)
+//
+// Should return 3 (number of output rows)
+
+fun main(execCtx: *ExecutionContext) -> int64 {
+  var ret = 0
+  var tvi: TableVectorIterator
+  var oids: [1]uint32
+  oids[0] = 1 // colA
+  var vals: [4]Integer
+  vals[0] = @intToSql(3)
+  vals[1] = @intToSql(7)
+  vals[2] = @intToSql(7000)
+  vals[3] = @intToSql(20000)
+  @tableIterInitBind(&tvi, execCtx, "test_1", oids)
+  for (; @tableIterAdvance(&tvi);) {
+    var pci = @tableIterGetPCI(&tvi)
+    @filterGt(pci, 0, 4, -1)
+    ret = ret + @filterIn(pci, 0, 4, vals)
+    @pciReset(pci)
+  }
+  @tableIterClose(&tvi)
+  return ret
+}
@@ -0,0 +1,25 @@
+// Perform (in vectorized fashion)
+//
+// SELECT colA FROM test_1
+// WHERE colA BETWEEN 1000 AND 2999 AND colA * 2 < 5000 AND colA <> 1234 AND colA IS NOT NULL
+//
+// Should return 1499 (number of output rows)
+
+fun main(execCtx: *ExecutionContext) -> int64 {
+  var ret = 0
+  var tvi: TableVectorIterator
+  var oids: [1]uint32
+  oids[0] = 1 // colA
+  @tableIterInitBind(&tvi, execCtx, "test_1", oids)
+  for (; @tableIterAdvance(&tvi);) {
+    var pci = @tableIterGetPCI(&tvi)
+    @filterBetween(pci, 0, 4, @intToSql(1000), @intToSql(2999))
+    // Arithmetic operation 2 is multiplication
+    @filterLt(pci, 0, 4, 2, @intToSql(2), @intToSql(5000))
+    @filterNe(pci, 0, 4, @intToSql(1234))
+    ret = ret + @filterIsNotNull(pci, 0)
+    @pciReset(pci)
+  }
+  @tableIterClose(&tvi)
+  return ret
+}
@@ -64,6 +64,7 @@ BENCHMARKS_TO_RUN = {
     "garbage_collector_benchmark":          DEFAULT_FAILURE_THRESHOLD,
     "large_transaction_benchmark":          DEFAULT_FAILURE_THRESHOLD,
     "index_wrapper_benchmark":              DEFAULT_FAILURE_THRESHOLD,
+    "index_build_benchmark":                DEFAULT_FAILURE_THRESHOLD,
     "logging_benchmark":                    DEFAULT_FAILURE_THRESHOLD,
     "recovery_benchmark":                   DEFAULT_FAILURE_THRESHOLD,
     "large_transaction_metrics_benchmark":  DEFAULT_FAILURE_THRESHOLD,
@@ -74,6 +75,7 @@ BENCHMARKS_TO_RUN = {
     "cuckoomap_benchmark":                  DEFAULT_FAILURE_THRESHOLD,
     "parser_benchmark":                     20,
     "slot_iterator_benchmark":              DEFAULT_FAILURE_THRESHOLD,
+    "object_pool_benchmark":                DEFAULT_FAILURE_THRESHOLD,
 }
 
 # The number of threads to use for multi-threaded benchmarks.
@@ -39,6 +39,8 @@ _tuple_num_linear_log_transformer = (_tuple_num_linear_log_train_transform, _tup
 OPUNIT_MODELING_TRANSFORMER_MAP = {
     OpUnit.GC_DEALLOC: None,
     OpUnit.GC_UNLINK: None,
+    OpUnit.GC_INDEX: None,
+    OpUnit.GC_COMPACTION: None,
     OpUnit.LOG_SERIAL: None,
     OpUnit.LOG_CONSUME: None,
     OpUnit.TXN_BEGIN: None,
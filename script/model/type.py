@@ -56,6 +56,10 @@ class OpUnit(enum.Enum):
     OP_DECIMAL_MULTIPLY = 18,
     OP_DECIMAL_DIVIDE = 19,
     OP_DECIMAL_COMPARE = 20,
+    GC_INDEX = 21,
+    gc_index = 21,
+    GC_COMPACTION = 22,
+    gc_compaction = 22,
 
 
 class ArithmeticFeature(enum.Enum):
@@ -27,6 +27,7 @@
 #include "planner/plannodes/index_scan_plan_node.h"
 #include "planner/plannodes/insert_plan_node.h"
 #include "planner/plannodes/limit_plan_node.h"
+#include "planner/plannodes/merge_join_plan_node.h"
 #include "planner/plannodes/nested_loop_join_plan_node.h"
 #include "planner/plannodes/order_by_plan_node.h"
 #include "planner/plannodes/plan_visitor.h"
@@ -226,7 +227,8 @@ void OperatingUnitRecorder::Visit(const planner::IndexScanPlanNode *plan) {
 void OperatingUnitRecorder::VisitAbstractJoinPlanNode(const planner::AbstractJoinPlanNode *plan) {
   if (plan_feature_type_ == ExecutionOperatingUnitType::HASHJOIN_PROBE ||
       plan_feature_type_ == ExecutionOperatingUnitType::NLJOIN_RIGHT ||
-      plan_feature_type_ == ExecutionOperatingUnitType::IDXJOIN) {
+      plan_feature_type_ == ExecutionOperatingUnitType::IDXJOIN ||
+      plan_feature_type_ == ExecutionOperatingUnitType::SORT_ITERATE) {
     // Right side stiches together outputs
     VisitAbstractPlanNode(plan);
 
@@ -272,6 +274,39 @@ void OperatingUnitRecorder::Visit(const planner::HashJoinPlanNode *plan) {
   RecordArithmeticFeatures(plan, 1);
 }
 
+void OperatingUnitRecorder::Visit(const planner::MergeJoinPlanNode *plan) {
+  if (plan_feature_type_ == ExecutionOperatingUnitType::SORT_BUILD) {
+    for (auto key : plan->GetLeftMergeKeys()) {
+      auto features = OperatingUnitUtil::ExtractFeaturesFromExpression(key);
+      arithmetic_feature_types_.insert(arithmetic_feature_types_.end(), std::make_move_iterator(features.begin()),
+                                       std::make_move_iterator(features.end()));
+    }
+
+    // The left child is buffered in the order it arrives in
+    auto *c_plan = plan->GetChild(0);
+    RecordArithmeticFeatures(c_plan, 1);
+    AggregateFeatures(plan_feature_type_, ComputeKeySize(plan->GetLeftMergeKeys()), plan->GetLeftMergeKeys().size(),
+                      c_plan, 1);
+  }
+
+  if (plan_feature_type_ == ExecutionOperatingUnitType::SORT_ITERATE) {
+    for (auto key : plan->GetRightMergeKeys()) {
+      auto features = OperatingUnitUtil::ExtractFeaturesFromExpression(key);
+      arithmetic_feature_types_.insert(arithmetic_feature_types_.end(), std::make_move_iterator(features.begin()),
+                                       std::make_move_iterator(features.end()));
+    }
+
+    // Every row of the right child is merged with the buffered left rows
+    auto *c_plan = plan->GetChild(1);
+    RecordArithmeticFeatures(c_plan, 1);
+    AggregateFeatures(plan_feature_type_, ComputeKeySize(plan->GetRightMergeKeys()), plan->GetRightMergeKeys().size(),
+                      c_plan, 1);
+  }
+
+  VisitAbstractJoinPlanNode(plan);
+  RecordArithmeticFeatures(plan, 1);
+}
+
 void OperatingUnitRecorder::Visit(const planner::NestedLoopJoinPlanNode *plan) {
   // NLJOIN_LEFT is a pass through translator
   if (plan_feature_type_ == ExecutionOperatingUnitType::NLJOIN_RIGHT) {
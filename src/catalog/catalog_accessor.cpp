@@ -175,4 +175,8 @@ common::ManagedPointer<storage::BlockStore> CatalogAccessor::GetBlockStore() con
   return catalog_->GetBlockStore();
 }
 
+common::ManagedPointer<transaction::TransactionManager> CatalogAccessor::GetTransactionManager() const {
+  return catalog_->GetTransactionManager();
+}
+
 }  // namespace terrier::catalog
@@ -1131,7 +1131,8 @@ bool DatabaseCatalog::DeleteIndex(const common::ManagedPointer<transaction::Tran
   // manager. See base function comment.
   txn->RegisterCommitAction(
       [=, garbage_collector{garbage_collector_}](transaction::DeferredActionManager *deferred_action_manager) {
-        if (index_ptr->Type() == storage::index::IndexType::BWTREE) {
+        if (index_ptr->Type() == storage::index::IndexType::BWTREE ||
+            index_ptr->Type() == storage::index::IndexType::ART) {
           garbage_collector->UnregisterIndexForGC(common::ManagedPointer(index_ptr));
         }
         // Unregistering from GC can happen immediately, but we have to double-defer freeing the actual objects
@@ -1202,14 +1203,15 @@ bool DatabaseCatalog::SetIndexPointer(const common::ManagedPointer<transaction::
   TERRIER_ASSERT(write_lock_.load() == txn->FinishTime(),
                  "Setting the object's pointer should only be done after successful DDL change request. i.e. this txn "
                  "should already have the lock.");
-  if (index_ptr->Type() == storage::index::IndexType::BWTREE) {
-    garbage_collector_->RegisterIndexForGC(common::ManagedPointer(index_ptr));
+  if (index_ptr->Type() == storage::index::IndexType::BWTREE || index_ptr->Type() == storage::index::IndexType::ART) {
+    garbage_collector_->RegisterIndexForGC(common::ManagedPointer(index_ptr), index);
   }
   // This needs to be deferred because if any items were subsequently inserted into this index, they will have deferred
   // abort actions that will be above this action on the abort stack.  The defer ensures we execute after them.
   txn->RegisterAbortAction(
       [=, garbage_collector{garbage_collector_}](transaction::DeferredActionManager *deferred_action_manager) {
-        if (index_ptr->Type() == storage::index::IndexType::BWTREE) {
+        if (index_ptr->Type() == storage::index::IndexType::BWTREE ||
+            index_ptr->Type() == storage::index::IndexType::ART) {
           garbage_collector->UnregisterIndexForGC(common::ManagedPointer(index_ptr));
         }
         deferred_action_manager->RegisterDeferredAction([=]() { delete index_ptr; });
@@ -1390,7 +1392,7 @@ void DatabaseCatalog::TearDown(const common::ManagedPointer<transaction::Transac
     for (auto table : tables) delete table;
 
     for (auto index : indexes) {
-      if (index->Type() == storage::index::IndexType::BWTREE) {
+      if (index->Type() == storage::index::IndexType::BWTREE || index->Type() == storage::index::IndexType::ART) {
         garbage_collector->UnregisterIndexForGC(common::ManagedPointer(index));
       }
       delete index;
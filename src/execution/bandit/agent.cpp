@@ -1,6 +1,9 @@
 #include "execution/bandit/agent.h"
 
 #include <algorithm>
+#include <vector>
+
+#include "common/macros.h"
 
 namespace terrier::execution::bandit {
 
@@ -18,6 +21,15 @@ void Agent::Reset() {
   time_step_ = 0;
 }
 
+void Agent::Restore(const std::vector<double> &value_estimates, const std::vector<uint32_t> &action_attempts,
+                    uint32_t time_step) {
+  TERRIER_ASSERT(value_estimates.size() == num_actions_ && action_attempts.size() == num_actions_,
+                 "Restored state must have one entry per action");
+  value_estimates_ = value_estimates;
+  action_attempts_ = action_attempts;
+  time_step_ = time_step;
+}
+
 uint32_t Agent::NextAction() {
   uint32_t action = policy_->NextAction(this);
   last_action_ = action;
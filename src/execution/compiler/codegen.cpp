@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "brain/operating_unit.h"
+#include "execution/sql/projected_columns_iterator.h"
 #include "execution/sql/value.h"
 #include "type/transient_value_peeker.h"
 #include "util/time_util.h"
@@ -122,6 +123,16 @@ ast::Expr *CodeGen::TableIterInit(ast::Identifier tvi, uint32_t table_oid, ast::
   return Factory()->NewBuiltinCallExpr(fun, std::move(args));
 }
 
+ast::Expr *CodeGen::TableIterFilterBlocks(ast::Identifier tvi, uint32_t col_idx, type::TypeId col_type, int64_t lo,
+                                          int64_t hi) {
+  ast::Expr *fun = BuiltinFunction(ast::Builtin::TableIterFilterBlocks);
+  ast::Expr *tvi_ptr = PointerTo(tvi);
+  ast::Expr *idx_expr = IntLiteral(col_idx);
+  ast::Expr *type_expr = IntLiteral(static_cast<int8_t>(col_type));
+  util::RegionVector<ast::Expr *> args{{tvi_ptr, idx_expr, type_expr, IntLiteral(lo), IntLiteral(hi)}, Region()};
+  return Factory()->NewBuiltinCallExpr(fun, std::move(args));
+}
+
 ast::Expr *CodeGen::PCIGet(ast::Identifier pci, type::TypeId type, bool nullable, uint32_t idx) {
   ast::Builtin builtin;
   ast::Type *ast_type;
@@ -177,33 +188,33 @@ ast::Expr *CodeGen::PCIGet(ast::Identifier pci, type::TypeId type, bool nullable
   return ret;
 }
 
-ast::Expr *CodeGen::PCIFilter(ast::Identifier pci, parser::ExpressionType comp_type, uint32_t col_idx,
-                              type::TypeId col_type, ast::Expr *filter_val) {
-  // Call @FilterComp(pci, col_idx, col_type, filter_val)
-  ast::Builtin builtin;
+namespace {
+
+ast::Builtin FilterBuiltin(parser::ExpressionType comp_type) {
   switch (comp_type) {
     case parser::ExpressionType::COMPARE_EQUAL:
-      builtin = ast::Builtin::FilterEq;
-      break;
+      return ast::Builtin::FilterEq;
     case parser::ExpressionType::COMPARE_NOT_EQUAL:
-      builtin = ast::Builtin::FilterNe;
-      break;
+      return ast::Builtin::FilterNe;
     case parser::ExpressionType::COMPARE_LESS_THAN:
-      builtin = ast::Builtin::FilterLt;
-      break;
+      return ast::Builtin::FilterLt;
     case parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
-      builtin = ast::Builtin::FilterLe;
-      break;
+      return ast::Builtin::FilterLe;
     case parser::ExpressionType::COMPARE_GREATER_THAN:
-      builtin = ast::Builtin::FilterGt;
-      break;
+      return ast::Builtin::FilterGt;
     case parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
-      builtin = ast::Builtin::FilterGe;
-      break;
+      return ast::Builtin::FilterGe;
     default:
       UNREACHABLE("Impossible filter comparison!");
   }
-  ast::Expr *fun = BuiltinFunction(builtin);
+}
+
+}  // namespace
+
+ast::Expr *CodeGen::PCIFilter(ast::Identifier pci, parser::ExpressionType comp_type, uint32_t col_idx,
+                              type::TypeId col_type, ast::Expr *filter_val) {
+  // Call @FilterComp(pci, col_idx, col_type, filter_val)
+  ast::Expr *fun = BuiltinFunction(FilterBuiltin(comp_type));
   ast::Expr *pci_expr = MakeExpr(pci);
   ast::Expr *idx_expr = IntLiteral(col_idx);
   ast::Expr *type_expr = IntLiteral(static_cast<int8_t>(col_type));
@@ -211,6 +222,76 @@ ast::Expr *CodeGen::PCIFilter(ast::Identifier pci, parser::ExpressionType comp_t
   return Factory()->NewBuiltinCallExpr(fun, std::move(args));
 }
 
+ast::Expr *CodeGen::PCIFilterColumn(ast::Identifier pci, parser::ExpressionType comp_type, uint32_t col_idx,
+                                    type::TypeId col_type, uint32_t col_idx_2, type::TypeId col_type_2) {
+  // Call @FilterComp(pci, col_idx, col_type, col_idx_2, col_type_2)
+  ast::Expr *fun = BuiltinFunction(FilterBuiltin(comp_type));
+  ast::Expr *pci_expr = MakeExpr(pci);
+  ast::Expr *idx_expr = IntLiteral(col_idx);
+  ast::Expr *type_expr = IntLiteral(static_cast<int8_t>(col_type));
+  ast::Expr *idx_expr_2 = IntLiteral(col_idx_2);
+  ast::Expr *type_expr_2 = IntLiteral(static_cast<int8_t>(col_type_2));
+  util::RegionVector<ast::Expr *> args{{pci_expr, idx_expr, type_expr, idx_expr_2, type_expr_2}, Region()};
+  return Factory()->NewBuiltinCallExpr(fun, std::move(args));
+}
+
+ast::Expr *CodeGen::PCIFilterArith(ast::Identifier pci, parser::ExpressionType comp_type, uint32_t col_idx,
+                                   type::TypeId col_type, parser::ExpressionType arith_type, ast::Expr *operand,
+                                   ast::Expr *filter_val) {
+  // Call @FilterComp(pci, col_idx, col_type, arith_op, operand, filter_val)
+  sql::ProjectedColumnsIterator::ArithmeticOp arith_op;
+  switch (arith_type) {
+    case parser::ExpressionType::OPERATOR_PLUS:
+      arith_op = sql::ProjectedColumnsIterator::ArithmeticOp::Plus;
+      break;
+    case parser::ExpressionType::OPERATOR_MINUS:
+      arith_op = sql::ProjectedColumnsIterator::ArithmeticOp::Minus;
+      break;
+    case parser::ExpressionType::OPERATOR_MULTIPLY:
+      arith_op = sql::ProjectedColumnsIterator::ArithmeticOp::Multiply;
+      break;
+    default:
+      UNREACHABLE("Impossible filter arithmetic!");
+  }
+  ast::Expr *fun = BuiltinFunction(FilterBuiltin(comp_type));
+  ast::Expr *pci_expr = MakeExpr(pci);
+  ast::Expr *idx_expr = IntLiteral(col_idx);
+  ast::Expr *type_expr = IntLiteral(static_cast<int8_t>(col_type));
+  ast::Expr *op_expr = IntLiteral(static_cast<int8_t>(arith_op));
+  util::RegionVector<ast::Expr *> args{{pci_expr, idx_expr, type_expr, op_expr, operand, filter_val}, Region()};
+  return Factory()->NewBuiltinCallExpr(fun, std::move(args));
+}
+
+ast::Expr *CodeGen::PCIFilterBetween(ast::Identifier pci, uint32_t col_idx, type::TypeId col_type, ast::Expr *lo,
+                                     ast::Expr *hi) {
+  // Call @filterBetween(pci, col_idx, col_type, lo, hi)
+  ast::Expr *fun = BuiltinFunction(ast::Builtin::FilterBetween);
+  ast::Expr *pci_expr = MakeExpr(pci);
+  ast::Expr *idx_expr = IntLiteral(col_idx);
+  ast::Expr *type_expr = IntLiteral(static_cast<int8_t>(col_type));
+  util::RegionVector<ast::Expr *> args{{pci_expr, idx_expr, type_expr, lo, hi}, Region()};
+  return Factory()->NewBuiltinCallExpr(fun, std::move(args));
+}
+
+ast::Expr *CodeGen::PCIFilterIn(ast::Identifier pci, uint32_t col_idx, type::TypeId col_type, ast::Identifier list) {
+  // Call @filterIn(pci, col_idx, col_type, list)
+  ast::Expr *fun = BuiltinFunction(ast::Builtin::FilterIn);
+  ast::Expr *pci_expr = MakeExpr(pci);
+  ast::Expr *idx_expr = IntLiteral(col_idx);
+  ast::Expr *type_expr = IntLiteral(static_cast<int8_t>(col_type));
+  util::RegionVector<ast::Expr *> args{{pci_expr, idx_expr, type_expr, MakeExpr(list)}, Region()};
+  return Factory()->NewBuiltinCallExpr(fun, std::move(args));
+}
+
+ast::Expr *CodeGen::PCIFilterNull(ast::Identifier pci, bool is_null, uint32_t col_idx) {
+  // Call @filterIsNull(pci, col_idx) or @filterIsNotNull(pci, col_idx)
+  ast::Expr *fun = BuiltinFunction(is_null ? ast::Builtin::FilterIsNull : ast::Builtin::FilterIsNotNull);
+  ast::Expr *pci_expr = MakeExpr(pci);
+  ast::Expr *idx_expr = IntLiteral(col_idx);
+  util::RegionVector<ast::Expr *> args{{pci_expr, idx_expr}, Region()};
+  return Factory()->NewBuiltinCallExpr(fun, std::move(args));
+}
+
 ast::Expr *CodeGen::ExecCtxGetMem() {
   return OneArgCall(ast::Builtin::ExecutionContextGetMemoryPool, exec_ctx_var_, false);
 }
@@ -504,6 +585,10 @@ ast::Expr *CodeGen::ArrayType(uint64_t num_elems, ast::BuiltinType::Kind kind) {
   return Factory()->NewArrayType(DUMMY_POS, IntLiteral(num_elems), BuiltinType(kind));
 }
 
+ast::Expr *CodeGen::ArrayType(uint64_t num_elems, ast::Expr *elem_type) {
+  return Factory()->NewArrayType(DUMMY_POS, IntLiteral(num_elems), elem_type);
+}
+
 ast::Expr *CodeGen::ArrayAccess(ast::Identifier arr, uint64_t idx) {
   return Factory()->NewIndexExpr(DUMMY_POS, MakeExpr(arr), IntLiteral(idx));
 }
@@ -84,6 +84,13 @@ void Compiler::MakePipelines(const terrier::planner::AbstractPlanNode &op, Pipel
   switch (op.GetPlanNodeType()) {
     case terrier::planner::PlanNodeType::AGGREGATE:
     case terrier::planner::PlanNodeType::ORDERBY: {
+      // Sorted aggregations stream through the current pipeline like every other operation.
+      if (TranslatorFactory::IsSortedAggregate(&op)) {
+        auto translator = TranslatorFactory::CreateRegularTranslator(&op, codegen_);
+        MakePipelines(*op.GetChild(0), curr_pipeline);
+        curr_pipeline->Add(std::move(translator));
+        return;
+      }
       // These nodes split in two parts: A "build" side (called bottom) and an "iterate" side (called top).
       auto bottom_translator = TranslatorFactory::CreateBottomTranslator(&op, codegen_);
       auto top_translator = TranslatorFactory::CreateTopTranslator(&op, bottom_translator.get(), codegen_);
@@ -96,8 +103,10 @@ void Compiler::MakePipelines(const terrier::planner::AbstractPlanNode &op, Pipel
       curr_pipeline->Add(std::move(top_translator));
       return;
     }
-    case terrier::planner::PlanNodeType::HASHJOIN: {
+    case terrier::planner::PlanNodeType::HASHJOIN:
+    case terrier::planner::PlanNodeType::MERGEJOIN: {
       // The hash join splits also splits in a "build" side (called left) and an "iterate" side (called right).
+      // The merge join buffers its left side the same way, and merges it with the right side as it is iterated.
       auto left_translator = TranslatorFactory::CreateLeftTranslator(&op, codegen_);
       auto right_translator = TranslatorFactory::CreateRightTranslator(&op, left_translator.get(), codegen_);
 
@@ -238,6 +238,37 @@ void AggregateHelper::GenKeyChecks(util::RegionVector<ast::Decl *> *decls) {
   }
 }
 
+void AggregateHelper::DeclareEntry(FunctionBuilder *builder) {
+  // var aht_entry: AHTStruct
+  ast::Expr *struct_type = codegen_->MakeExpr(global_info_.StructType());
+  builder->Append(codegen_->DeclareVariable(global_info_.Entry(), struct_type, nullptr));
+}
+
+void AggregateHelper::GenStartGroup(FunctionBuilder *builder) {
+  InitGroupByValues(builder, &global_info_);
+  InitGlobalAggregates(builder);
+}
+
+ast::Expr *AggregateHelper::GenGroupChanged() {
+  ast::Expr *changed = nullptr;
+  for (uint32_t term_idx = 0; term_idx < op_->GetGroupByTerms().size(); term_idx++) {
+    auto entry_val = [&]() { return codegen_->MemberExpr(global_info_.Entry(), group_bys_[term_idx]); };
+    auto new_val = [&]() { return codegen_->MemberExpr(agg_values_, group_bys_[term_idx]); };
+    // (@isSqlNull(entry_val) and @isSqlNotNull(new_val))
+    ast::Expr *to_not_null = codegen_->BinaryOp(parsing::Token::Type::AND, codegen_->IsSqlNull(entry_val()),
+                                                codegen_->IsSqlNotNull(new_val()));
+    // (@isSqlNull(new_val) or entry_val != new_val)
+    ast::Expr *not_equal = codegen_->Compare(parsing::Token::Type::BANG_EQUAL, entry_val(), new_val());
+    ast::Expr *differs = codegen_->BinaryOp(parsing::Token::Type::OR, codegen_->IsSqlNull(new_val()), not_equal);
+    // (@isSqlNotNull(entry_val) and (...))
+    ast::Expr *from_not_null =
+        codegen_->BinaryOp(parsing::Token::Type::AND, codegen_->IsSqlNotNull(entry_val()), differs);
+    ast::Expr *term_changed = codegen_->BinaryOp(parsing::Token::Type::OR, to_not_null, from_not_null);
+    changed = changed == nullptr ? term_changed : codegen_->BinaryOp(parsing::Token::Type::OR, changed, term_changed);
+  }
+  return changed;
+}
+
 void AggregateHelper::GenAdvanceNonDistinct(FunctionBuilder *builder) {
   for (uint32_t term_idx = 0; term_idx < op_->GetAggregateTerms().size(); term_idx++) {
     auto term = op_->GetAggregateTerms()[term_idx];
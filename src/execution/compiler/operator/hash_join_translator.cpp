@@ -3,7 +3,11 @@
 #include <utility>
 #include <vector>
 #include "execution/compiler/function_builder.h"
+#include "execution/compiler/operator/seq_scan_translator.h"
 #include "execution/compiler/translator_factory.h"
+#include "execution/sql/join_hash_table_vector_probe.h"
+#include "parser/expression/column_value_expression.h"
+#include "parser/expression/derived_value_expression.h"
 #include "planner/plannodes/hash_join_plan_node.h"
 
 namespace terrier::execution::compiler {
@@ -47,8 +51,8 @@ void HashJoinLeftTranslator::InitializeStructs(util::RegionVector<ast::Decl *> *
   util::RegionVector<ast::FieldDecl *> fields{codegen_->Region()};
   // Add child output columns
   GetChildOutputFields(&fields, LEFT_ATTR_NAME);
-  // Add the left semi join flag.
-  if (op_->GetLogicalJoinType() == planner::LogicalJoinType::LEFT_SEMI) {
+  // Add the match flag.
+  if (HasMarkFlag()) {
     fields.emplace_back(codegen_->MakeField(mark_, codegen_->BuiltinType(ast::BuiltinType::Bool)));
   }
   // Make the struct
@@ -59,6 +63,12 @@ void HashJoinLeftTranslator::InitializeStructs(util::RegionVector<ast::Decl *> *
 void HashJoinLeftTranslator::InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) {
   // @joinHTInit(&state.join_table, @execCtxGetMem(execCtx), @sizeOf(BuildRow))
   ast::Expr *init_call = codegen_->HTInitCall(ast::Builtin::JoinHashTableInit, join_ht_, build_struct_);
+  if (op_->IsPartitionedBuild()) {
+    // @joinHTInit(&state.join_table, @execCtxGetMem(execCtx), @sizeOf(BuildRow), true)
+    init_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableInit,
+                                      {codegen_->GetStateMemberPtr(join_ht_), codegen_->ExecCtxGetMem(),
+                                       codegen_->SizeOf(build_struct_), codegen_->BoolLiteral(true)});
+  }
   // Add it the setup statements
   setup_stmts->emplace_back(codegen_->MakeStmt(init_call));
 }
@@ -111,8 +121,8 @@ void HashJoinLeftTranslator::FillBuildRow(FunctionBuilder *builder) {
     ast::Expr *rhs = child_translator_->GetOutput(attr_idx);
     builder->Append(codegen_->Assign(lhs, rhs));
   }
-  // For left semi-joins, set the flag to true.
-  if (op_->GetLogicalJoinType() == planner::LogicalJoinType::LEFT_SEMI) {
+  // Mark the row as not matched yet.
+  if (HasMarkFlag()) {
     ast::Expr *lhs = GetMarkFlag();
     ast::Expr *rhs = codegen_->BoolLiteral(true);
     builder->Append(codegen_->Assign(lhs, rhs));
@@ -126,6 +136,18 @@ ast::Expr *HashJoinLeftTranslator::GetBuildValue(uint32_t idx) {
 
 ast::Expr *HashJoinLeftTranslator::GetMarkFlag() { return codegen_->MemberExpr(build_row_, mark_); }
 
+bool HashJoinLeftTranslator::HasMarkFlag() const {
+  switch (op_->GetLogicalJoinType()) {
+    case planner::LogicalJoinType::LEFT:
+    case planner::LogicalJoinType::OUTER:
+    case planner::LogicalJoinType::LEFT_SEMI:
+    case planner::LogicalJoinType::ANTI:
+      return true;
+    default:
+      return false;
+  }
+}
+
 ast::Expr *HashJoinLeftTranslator::GetOutput(uint32_t attr_idx) { return GetBuildValue(attr_idx); }
 
 ast::Expr *HashJoinLeftTranslator::GetChildOutput(uint32_t child_idx, uint32_t attr_idx, terrier::type::TypeId type) {
@@ -146,21 +168,64 @@ HashJoinRightTranslator::HashJoinRightTranslator(const terrier::planner::HashJoi
       probe_struct_{codegen->NewIdentifier("ProbeRow")},
       probe_row_{codegen->NewIdentifier("probe_row")},
       key_check_{codegen->NewIdentifier("joinKeyCheckFn")},
-      join_iter_{codegen->NewIdentifier("join_iter")} {}
+      join_iter_{codegen->NewIdentifier("join_iter")},
+      vec_probe_{codegen->NewIdentifier("vec_probe")},
+      probe_ht_{codegen->NewIdentifier("probe_ht")},
+      probe_entry_{codegen->NewIdentifier("probe_entry")},
+      part_iter_{codegen->NewIdentifier("part_iter")},
+      probe_matched_{codegen->NewIdentifier("probe_matched")},
+      build_entry_iter_{codegen->NewIdentifier("build_entry_iter")},
+      probe_entry_iter_{codegen->NewIdentifier("probe_entry_iter")} {}
 
 void HashJoinRightTranslator::Produce(FunctionBuilder *builder) {
-  // Declare the iterator
-  DeclareIterator(builder);
-  // Let right child produce its code
-  child_translator_->Produce(builder);
-  // Close iterator
-  GenIteratorClose(builder);
+  if (op_->IsPartitionedBuild()) {
+    // Let right child buffer the probe side, then join both sides
+    child_translator_->Produce(builder);
+    GenPartitionedJoinLoop(builder);
+  } else {
+    // Declare the iterator
+    DeclareIterator(builder);
+    // Declare the vectorized probe if the right child's vectors can be probed at once
+    use_vector_probe_ = CollectVectorProbeKeys();
+    if (use_vector_probe_) {
+      DeclareVectorProbe(builder);
+    }
+    // Let right child produce its code
+    child_translator_->Produce(builder);
+    // Close iterator
+    GenIteratorClose(builder);
+    if (use_vector_probe_) {
+      GenVectorProbeFree(builder);
+    }
+  }
+  // Once the probe side is exhausted, emit the rows that never matched. Unmatched probe rows of joins that are not
+  // partitioned are emitted as they are probed.
+  if (EmitsUnmatchedBuildRows()) {
+    GenUnmatchedRowsLoop(builder, true);
+  }
+  if (op_->IsPartitionedBuild() && EmitsUnmatchedProbeRows()) {
+    GenUnmatchedRowsLoop(builder, false);
+  }
 }
 
 void HashJoinRightTranslator::Abort(FunctionBuilder *builder) {
+  if (open_entry_iter_ != nullptr) {
+    // Both sides have already been joined when the parent consumes unmatched rows
+    builder->Append(
+        codegen_->MakeStmt(codegen_->OneArgCall(ast::Builtin::JoinHashTableEntryIterClose, *open_entry_iter_, true)));
+    return;
+  }
+  if (op_->IsPartitionedBuild()) {
+    // The right child has already finished when the parent consumes
+    GenPartitionIteratorClose(builder);
+    return;
+  }
   child_translator_->Abort(builder);
   // Close iterator
   GenIteratorClose(builder);
+  if (use_vector_probe_) {
+    GenVectorProbeFree(builder);
+  }
 }
 
 void HashJoinRightTranslator::Consume(FunctionBuilder *builder) {
@@ -170,22 +235,249 @@ void HashJoinRightTranslator::Consume(FunctionBuilder *builder) {
   }
   // Create the right hash_value
   GenHashValue(builder);
+  // Partitioned joins only buffer the probe tuple
+  if (op_->IsPartitionedBuild()) {
+    GenProbeBufferInsert(builder);
+    return;
+  }
+  // Track whether the probe tuple matches, to emit it with NULLs for the build side otherwise
+  if (EmitsUnmatchedProbeRows()) {
+    builder->Append(codegen_->DeclareVariable(probe_matched_, nullptr, codegen_->BoolLiteral(false)));
+  }
   // Generate the probe loop
   GenProbeLoop(builder);
   // Get the matching tuple
   DeclareMatch(builder);
-  // Check left semi join flag.
-  if (op_->GetLogicalJoinType() == planner::LogicalJoinType::LEFT_SEMI) {
-    GenLeftSemiJoinCondition(builder);
+  // Let the parent consume
+  GenMatch(builder);
+  // Close Loop
+  builder->FinishBlockStmt();
+  // if (!probe_matched) { ... }
+  if (EmitsUnmatchedProbeRows()) {
+    builder->StartIfStmt(codegen_->UnaryOp(parsing::Token::Type::BANG, codegen_->MakeExpr(probe_matched_)));
+    DeclareNullRow(builder, true);
+    parent_translator_->Consume(builder);
+    builder->FinishBlockStmt();
+  }
+}
+
+// Generated code:
+// @joinHTVecProbePrepare(&vec_probe, pci)
+// for (; @joinHTVecProbeHasNext(&vec_probe, pci);) {
+//   var build_row = @ptrCast(*BuildRow, @joinHTVecProbeGetRow(&vec_probe))
+//   ...
+// }
+bool HashJoinRightTranslator::ConsumeVector(FunctionBuilder *builder) {
+  if (!use_vector_probe_) return false;
+  const ast::Identifier &pci = *child_translator_->GetMaterializedTuple().first;
+
+  // Hash, look up and compare the keys of the whole vector
+  ast::Expr *prepare_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableVectorProbePrepare,
+                                                  {codegen_->PointerTo(vec_probe_), codegen_->MakeExpr(pci)});
+  builder->Append(codegen_->MakeStmt(prepare_call));
+
+  // Loop over the matches
+  ast::Expr *has_next_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableVectorProbeHasNext,
+                                                   {codegen_->PointerTo(vec_probe_), codegen_->MakeExpr(pci)});
+  builder->StartForStmt(nullptr, has_next_call, nullptr);
+
+  // Get the matching tuple
+  ast::Expr *get_row_call = codegen_->OneArgCall(ast::Builtin::JoinHashTableVectorProbeGetRow, vec_probe_, true);
+  ast::Expr *cast_call = codegen_->PtrCast(left_->build_struct_, get_row_call);
+  builder->Append(codegen_->DeclareVariable(left_->build_row_, nullptr, cast_call));
+
+  // Check the rest of the join predicate
+  const bool has_residual = HasResidualPredicate();
+  if (has_residual) {
+    auto pred_translator = TranslatorFactory::CreateExpressionTranslator(op_->GetJoinPredicate().Get(), codegen_);
+    builder->StartIfStmt(pred_translator->DeriveExpr(this));
   }
   // Let the parent consume
-  parent_translator_->Consume(builder);
+  GenMatch(builder);
   // Close if stmt
-  if (op_->GetLogicalJoinType() == planner::LogicalJoinType::LEFT_SEMI) {
+  if (has_residual) {
     builder->FinishBlockStmt();
   }
   // Close Loop
   builder->FinishBlockStmt();
+  return true;
+}
+
+bool HashJoinRightTranslator::CollectVectorProbeKeys() {
+  vector_probe_keys_.clear();
+  if (op_->IsPartitionedBuild()) return false;
+  // Probe rows are never emitted without a match, and only the build rows' mark flags track matches
+  const auto join_type = op_->GetLogicalJoinType();
+  if (join_type != planner::LogicalJoinType::INNER && join_type != planner::LogicalJoinType::LEFT_SEMI &&
+      join_type != planner::LogicalJoinType::ANTI) {
+    return false;
+  }
+
+  // The probe side must be a scan that hands out whole vectors
+  auto *scan = dynamic_cast<SeqScanTranslator *>(child_translator_);
+  if (scan == nullptr || !scan->IsVectorizable()) return false;
+
+  const auto &left_keys = op_->GetLeftHashKeys();
+  const auto &right_keys = op_->GetRightHashKeys();
+  if (right_keys.empty() || left_keys.size() != right_keys.size()) return false;
+
+  for (uint32_t i = 0; i < right_keys.size(); i++) {
+    // The build key must be a build row attribute
+    auto left_key = left_keys[i].CastManagedPointerTo<parser::DerivedValueExpression>();
+    if (left_keys[i]->GetExpressionType() != parser::ExpressionType::VALUE_TUPLE || left_key->GetTupleIdx() != 0) {
+      return false;
+    }
+    const auto build_attr_idx = static_cast<uint32_t>(left_key->GetValueIdx());
+    const auto build_type =
+        op_->GetChild(0)->GetOutputSchema()->GetColumn(build_attr_idx).GetExpr()->GetReturnValueType();
+
+    // The probe key must be a fixed-width column of the scan
+    auto right_key = right_keys[i].CastManagedPointerTo<parser::DerivedValueExpression>();
+    if (right_keys[i]->GetExpressionType() != parser::ExpressionType::VALUE_TUPLE || right_key->GetTupleIdx() != 1) {
+      return false;
+    }
+    auto probe_expr = op_->GetChild(1)->GetOutputSchema()->GetColumn(right_key->GetValueIdx()).GetExpr();
+    if (probe_expr->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE) return false;
+    const auto col_oid = probe_expr.CastManagedPointerTo<parser::ColumnValueExpression>()->GetColumnOid();
+    const auto probe_type = scan->GetColumnType(col_oid);
+    if (!sql::JoinHashTableVectorProbe::IsSupportedKeyType(probe_type) ||
+        !sql::JoinHashTableVectorProbe::IsSupportedKeyType(build_type)) {
+      return false;
+    }
+
+    // Both keys must be stored in the same kind of SQL value for their hashes to agree
+    if ((probe_type == type::TypeId::DECIMAL) != (build_type == type::TypeId::DECIMAL)) return false;
+
+    vector_probe_keys_.push_back({scan->GetColumnIndex(col_oid), probe_type, build_attr_idx});
+  }
+  return true;
+}
+
+bool HashJoinRightTranslator::HasResidualPredicate() const {
+  // The vectorized probe already compared the keys. Anything else in the predicate must still be checked.
+  const auto predicate = op_->GetJoinPredicate();
+  if (predicate == nullptr) return false;
+  if (predicate->GetExpressionType() == parser::ExpressionType::COMPARE_EQUAL) return vector_probe_keys_.size() != 1;
+  if (predicate->GetExpressionType() != parser::ExpressionType::CONJUNCTION_AND) return true;
+  if (predicate->GetChildrenSize() != vector_probe_keys_.size()) return true;
+  for (const auto &term : predicate->GetChildren()) {
+    if (term->GetExpressionType() != parser::ExpressionType::COMPARE_EQUAL) return true;
+  }
+  return false;
+}
+
+// var vec_probe: JoinHashTableVectorProbe
+// @joinHTVecProbeInit(&vec_probe, &state.join_ht)
+// @joinHTVecProbeAddKey(&vec_probe, col_idx, type, @offsetOf(BuildRow, left_attr))
+void HashJoinRightTranslator::DeclareVectorProbe(FunctionBuilder *builder) {
+  ast::Expr *probe_type = codegen_->BuiltinType(ast::BuiltinType::Kind::JoinHashTableVectorProbe);
+  builder->Append(codegen_->DeclareVariable(vec_probe_, probe_type, nullptr));
+
+  ast::Expr *init_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableVectorProbeInit,
+                                               {codegen_->PointerTo(vec_probe_),
+                                                codegen_->GetStateMemberPtr(left_->join_ht_)});
+  builder->Append(codegen_->MakeStmt(init_call));
+
+  for (const auto &key : vector_probe_keys_) {
+    ast::Identifier build_attr = codegen_->Context()->GetIdentifier(HashJoinLeftTranslator::LEFT_ATTR_NAME +
+                                                                     std::to_string(key.build_attr_idx_));
+    ast::Expr *offset_call = codegen_->BuiltinCall(
+        ast::Builtin::OffsetOf, {codegen_->MakeExpr(left_->build_struct_), codegen_->MakeExpr(build_attr)});
+    ast::Expr *add_key_call = codegen_->BuiltinCall(
+        ast::Builtin::JoinHashTableVectorProbeAddKey,
+        {codegen_->PointerTo(vec_probe_), codegen_->IntLiteral(key.col_idx_),
+         codegen_->IntLiteral(static_cast<int64_t>(key.type_)), offset_call});
+    builder->Append(codegen_->MakeStmt(add_key_call));
+  }
+}
+
+// Call @joinHTVecProbeFree(&vec_probe)
+void HashJoinRightTranslator::GenVectorProbeFree(FunctionBuilder *builder) {
+  ast::Expr *free_call = codegen_->OneArgCall(ast::Builtin::JoinHashTableVectorProbeFree, vec_probe_, true);
+  builder->Append(codegen_->MakeStmt(free_call));
+}
+
+// var probe_entry = @ptrCast(*ProbeRow, @joinHTInsert(&state.probe_ht, hash_val))
+// probe_entry.right_attr0 = probe_row.right_attr0
+// ...
+void HashJoinRightTranslator::GenProbeBufferInsert(FunctionBuilder *builder) {
+  std::vector<ast::Expr *> insert_args{codegen_->GetStateMemberPtr(probe_ht_), codegen_->MakeExpr(hash_val_)};
+  ast::Expr *insert_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableInsert, std::move(insert_args));
+  builder->Append(codegen_->DeclareVariable(probe_entry_, nullptr, codegen_->PtrCast(probe_struct_, insert_call)));
+  for (uint32_t attr_idx = 0; attr_idx < op_->GetChild(1)->GetOutputSchema()->GetColumns().size(); attr_idx++) {
+    ast::Identifier member = codegen_->Context()->GetIdentifier(RIGHT_ATTR_NAME + std::to_string(attr_idx));
+    builder->Append(
+        codegen_->Assign(codegen_->MemberExpr(probe_entry_, member), codegen_->MemberExpr(probe_row_, member)));
+  }
+  // Mark the row as not matched yet.
+  if (HasProbeMarkFlag()) {
+    builder->Append(
+        codegen_->Assign(codegen_->MemberExpr(probe_entry_, left_->mark_), codegen_->BoolLiteral(true)));
+  }
+}
+
+// Generated code:
+// var part_iter: JoinHashTablePartIter
+// for (@joinHTPartIterInit(&part_iter, &state.join_ht, &state.probe_ht);
+//      @joinHTPartIterHasNext(&part_iter, joinKeyCheckFn, execCtx);) {
+//   var probe_row = @ptrCast(*ProbeRow, @joinHTPartIterGetProbeRow(&part_iter))
+//   var build_row = @ptrCast(*BuildRow, @joinHTPartIterGetBuildRow(&part_iter))
+//   ...
+// }
+// @joinHTPartIterClose(&part_iter)
+void HashJoinRightTranslator::GenPartitionedJoinLoop(FunctionBuilder *builder) {
+  ast::Expr *iter_type = codegen_->BuiltinType(ast::BuiltinType::Kind::JoinHashTablePartIter);
+  builder->Append(codegen_->DeclareVariable(part_iter_, iter_type, nullptr));
+
+  ast::Expr *init_call = codegen_->BuiltinCall(
+      ast::Builtin::JoinHashTablePartIterInit,
+      {codegen_->PointerTo(part_iter_), codegen_->GetStateMemberPtr(left_->join_ht_),
+       codegen_->GetStateMemberPtr(probe_ht_)});
+  ast::Expr *has_next_call = codegen_->BuiltinCall(
+      ast::Builtin::JoinHashTablePartIterHasNext,
+      {codegen_->PointerTo(part_iter_), codegen_->MakeExpr(key_check_), codegen_->MakeExpr(codegen_->GetExecCtxVar())});
+  builder->StartForStmt(codegen_->MakeStmt(init_call), has_next_call, nullptr);
+
+  // Get the matching pair
+  ast::Expr *probe_call = codegen_->OneArgCall(ast::Builtin::JoinHashTablePartIterGetProbeRow, part_iter_, true);
+  builder->Append(codegen_->DeclareVariable(probe_row_, nullptr, codegen_->PtrCast(probe_struct_, probe_call)));
+  ast::Expr *build_call = codegen_->OneArgCall(ast::Builtin::JoinHashTablePartIterGetBuildRow, part_iter_, true);
+  builder->Append(
+      codegen_->DeclareVariable(left_->build_row_, nullptr, codegen_->PtrCast(left_->build_struct_, build_call)));
+
+  // Let the parent consume
+  GenMatch(builder);
+  // Close Loop
+  builder->FinishBlockStmt();
+  GenPartitionIteratorClose(builder);
+}
+
+// Call @joinHTPartIterClose(&part_iter)
+void HashJoinRightTranslator::GenPartitionIteratorClose(FunctionBuilder *builder) {
+  ast::Expr *close_call = codegen_->OneArgCall(ast::Builtin::JoinHashTablePartIterClose, part_iter_, true);
+  builder->Append(codegen_->MakeStmt(close_call));
+}
+
+// Declare the probe-side hash table of partitioned joins
+void HashJoinRightTranslator::InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) {
+  if (!op_->IsPartitionedBuild()) return;
+  // probe_ht : JoinHashTable
+  ast::Expr *ht_type = codegen_->BuiltinType(ast::BuiltinType::Kind::JoinHashTable);
+  state_fields->emplace_back(codegen_->MakeField(probe_ht_, ht_type));
+}
+
+// Call @joinHTInit(&state.probe_ht, @execCtxGetMem(execCtx), @sizeOf(ProbeRow))
+void HashJoinRightTranslator::InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) {
+  if (!op_->IsPartitionedBuild()) return;
+  ast::Expr *init_call = codegen_->HTInitCall(ast::Builtin::JoinHashTableInit, probe_ht_, probe_struct_);
+  setup_stmts->emplace_back(codegen_->MakeStmt(init_call));
+}
+
+// Call @joinHTFree(&state.probe_ht)
+void HashJoinRightTranslator::InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) {
+  if (!op_->IsPartitionedBuild()) return;
+  ast::Expr *free_call = codegen_->OneArgStateCall(ast::Builtin::JoinHashTableFree, probe_ht_);
+  teardown_stmts->emplace_back(codegen_->MakeStmt(free_call));
 }
 
 ast::Expr *HashJoinRightTranslator::GetOutput(uint32_t attr_idx) {
@@ -223,6 +515,10 @@ void HashJoinRightTranslator::InitializeStructs(util::RegionVector<ast::Decl *>
   // Otherwise let the struct have a field for each right child attribute.
   util::RegionVector<ast::FieldDecl *> fields{codegen_->Region()};
   GetChildOutputFields(&fields, RIGHT_ATTR_NAME);
+  // Add the match flag of buffered probe rows.
+  if (HasProbeMarkFlag()) {
+    fields.emplace_back(codegen_->MakeField(left_->mark_, codegen_->BuiltinType(ast::BuiltinType::Bool)));
+  }
   decls->emplace_back(codegen_->MakeStruct(probe_struct_, std::move(fields)));
 }
 
@@ -236,7 +532,10 @@ void HashJoinRightTranslator::InitializeHelperFunctions(util::RegionVector<ast::
 
   // Then make probe_row: *ProbeRow depending on whether the previous operator is a materializer.
   ast::FieldDecl *param2;
-  is_child_materializer_ = child_translator_->IsMaterializer(&is_child_ptr_);
+  // Partitioned joins always buffer their own probe rows, and joins that emit build rows without a match fill a probe
+  // row with NULLs for them
+  is_child_materializer_ =
+      !op_->IsPartitionedBuild() && !HasNullProbeRows() && child_translator_->IsMaterializer(&is_child_ptr_);
   if (is_child_materializer_) {
     // Use the previous tuple's name and type
     auto prev_tuple = child_translator_->GetMaterializedTuple();
@@ -353,12 +652,113 @@ void HashJoinRightTranslator::DeclareMatch(FunctionBuilder *builder) {
   builder->Append(codegen_->DeclareVariable(left_->build_row_, nullptr, cast_call));
 }
 
-void HashJoinRightTranslator::GenLeftSemiJoinCondition(FunctionBuilder *builder) {
-  ast::Expr *cond = left_->GetMarkFlag();
-  builder->StartIfStmt(cond);
-  // Set flag to false to prevent further iterations.
-  ast::Expr *lhs = left_->GetMarkFlag();
-  ast::Expr *rhs = codegen_->BoolLiteral(false);
-  builder->Append(codegen_->Assign(lhs, rhs));
+// Generated code for left semi joins, which only emit the first match of a build row:
+// if (build_row.mark) {
+//   build_row.mark = false
+//   ...
+// }
+// Generated code for outer and anti joins, which record the match of both rows:
+// build_row.mark = false
+// probe_matched = true (or probe_row.mark = false if the probe row is buffered)
+// ...
+void HashJoinRightTranslator::GenMatch(FunctionBuilder *builder) {
+  const auto join_type = op_->GetLogicalJoinType();
+  if (join_type == planner::LogicalJoinType::LEFT_SEMI) {
+    builder->StartIfStmt(left_->GetMarkFlag());
+    // Set flag to false to prevent further iterations.
+    builder->Append(codegen_->Assign(left_->GetMarkFlag(), codegen_->BoolLiteral(false)));
+    parent_translator_->Consume(builder);
+    builder->FinishBlockStmt();
+    return;
+  }
+  if (left_->HasMarkFlag()) {
+    builder->Append(codegen_->Assign(left_->GetMarkFlag(), codegen_->BoolLiteral(false)));
+  }
+  if (HasProbeMarkFlag()) {
+    builder->Append(codegen_->Assign(codegen_->MemberExpr(probe_row_, left_->mark_), codegen_->BoolLiteral(false)));
+  } else if (EmitsUnmatchedProbeRows()) {
+    builder->Append(codegen_->Assign(codegen_->MakeExpr(probe_matched_), codegen_->BoolLiteral(true)));
+  }
+  // Anti joins only emit the build rows that never match
+  if (join_type != planner::LogicalJoinType::ANTI) {
+    parent_translator_->Consume(builder);
+  }
+}
+
+// Generated code:
+// var build_entry_iter: JoinHashTableEntryIter
+// for (@joinHTEntryIterInit(&build_entry_iter, &state.join_ht); @joinHTEntryIterHasNext(&build_entry_iter);) {
+//   var build_row = @ptrCast(*BuildRow, @joinHTEntryIterGetRow(&build_entry_iter))
+//   if (build_row.mark) {
+//     var probe_row: ProbeRow
+//     probe_row.right_attr0 = @nullToSql(&probe_row.right_attr0)
+//     ...
+//   }
+// }
+// @joinHTEntryIterClose(&build_entry_iter)
+void HashJoinRightTranslator::GenUnmatchedRowsLoop(FunctionBuilder *builder, bool build_side) {
+  const ast::Identifier &iter = build_side ? build_entry_iter_ : probe_entry_iter_;
+  const ast::Identifier &table = build_side ? left_->join_ht_ : probe_ht_;
+  const ast::Identifier &row = build_side ? left_->build_row_ : probe_row_;
+  const ast::Identifier &row_struct = build_side ? left_->build_struct_ : probe_struct_;
+
+  ast::Expr *iter_type = codegen_->BuiltinType(ast::BuiltinType::Kind::JoinHashTableEntryIter);
+  builder->Append(codegen_->DeclareVariable(iter, iter_type, nullptr));
+  ast::Expr *init_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableEntryIterInit,
+                                               {codegen_->PointerTo(iter), codegen_->GetStateMemberPtr(table)});
+  ast::Expr *has_next_call = codegen_->OneArgCall(ast::Builtin::JoinHashTableEntryIterHasNext, iter, true);
+  builder->StartForStmt(codegen_->MakeStmt(init_call), has_next_call, nullptr);
+  ast::Expr *get_row_call = codegen_->OneArgCall(ast::Builtin::JoinHashTableEntryIterGetRow, iter, true);
+  builder->Append(codegen_->DeclareVariable(row, nullptr, codegen_->PtrCast(row_struct, get_row_call)));
+
+  // Rows whose mark no probe cleared are emitted with NULLs for the other side
+  builder->StartIfStmt(codegen_->MemberExpr(row, left_->mark_));
+  if (!build_side || HasNullProbeRows()) {
+    DeclareNullRow(builder, !build_side);
+  }
+  open_entry_iter_ = &iter;
+  parent_translator_->Consume(builder);
+  open_entry_iter_ = nullptr;
+  builder->FinishBlockStmt();
+  builder->FinishBlockStmt();
+
+  ast::Expr *close_call = codegen_->OneArgCall(ast::Builtin::JoinHashTableEntryIterClose, iter, true);
+  builder->Append(codegen_->MakeStmt(close_call));
+}
+
+// var build_row: BuildRow
+// build_row.left_attr0 = @nullToSql(&build_row.left_attr0)
+// ...
+void HashJoinRightTranslator::DeclareNullRow(FunctionBuilder *builder, bool build_side) {
+  const ast::Identifier &row = build_side ? left_->build_row_ : probe_row_;
+  const ast::Identifier &row_struct = build_side ? left_->build_struct_ : probe_struct_;
+  const char *attr_name = build_side ? HashJoinLeftTranslator::LEFT_ATTR_NAME : RIGHT_ATTR_NAME;
+  builder->Append(codegen_->DeclareVariable(row, codegen_->MakeExpr(row_struct), nullptr));
+  const auto &columns = op_->GetChild(build_side ? 0 : 1)->GetOutputSchema()->GetColumns();
+  for (uint32_t attr_idx = 0; attr_idx < columns.size(); attr_idx++) {
+    ast::Identifier member = codegen_->Context()->GetIdentifier(attr_name + std::to_string(attr_idx));
+    ast::Expr *null_value = codegen_->NullToSql(codegen_->PointerTo(codegen_->MemberExpr(row, member)));
+    builder->Append(codegen_->Assign(codegen_->MemberExpr(row, member), null_value));
+  }
+}
+
+bool HashJoinRightTranslator::EmitsUnmatchedBuildRows() const {
+  const auto join_type = op_->GetLogicalJoinType();
+  return join_type == planner::LogicalJoinType::LEFT || join_type == planner::LogicalJoinType::OUTER ||
+         join_type == planner::LogicalJoinType::ANTI;
+}
+
+bool HashJoinRightTranslator::EmitsUnmatchedProbeRows() const {
+  const auto join_type = op_->GetLogicalJoinType();
+  return join_type == planner::LogicalJoinType::RIGHT || join_type == planner::LogicalJoinType::OUTER;
+}
+
+bool HashJoinRightTranslator::HasNullProbeRows() const {
+  const auto join_type = op_->GetLogicalJoinType();
+  return join_type == planner::LogicalJoinType::LEFT || join_type == planner::LogicalJoinType::OUTER;
+}
+
+bool HashJoinRightTranslator::HasProbeMarkFlag() const {
+  return op_->IsPartitionedBuild() && EmitsUnmatchedProbeRows();
 }
 }  // namespace terrier::execution::compiler
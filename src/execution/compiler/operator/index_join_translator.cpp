@@ -2,6 +2,7 @@
 #include <memory>
 #include "execution/compiler/function_builder.h"
 #include "execution/compiler/operator/operator_translator.h"
+#include "execution/compiler/operator/seq_scan_translator.h"
 #include "execution/compiler/translator_factory.h"
 #include "planner/plannodes/index_join_plan_node.h"
 
@@ -18,6 +19,7 @@ IndexJoinTranslator::IndexJoinTranslator(const planner::IndexJoinPlanNode *op, C
       index_iter_(codegen_->NewIdentifier("index_iter")),
       col_oids_(codegen->NewIdentifier("col_oids")),
       index_pr_(codegen->NewIdentifier("index_pr")),
+      batch_key_pr_(codegen->NewIdentifier("batch_key_pr")),
       table_pr_(codegen->NewIdentifier("table_pr")),
       slot_(codegen->NewIdentifier("slot")) {}
 
@@ -46,9 +48,41 @@ void IndexJoinTranslator::Abort(FunctionBuilder *builder) {
 
 void IndexJoinTranslator::Consume(FunctionBuilder *builder) {
   // Fill the key with table data
-  FillKey(builder);
+  FillKey(builder, index_pr_);
   // Generate the loop
   GenForLoop(builder);
+  ConsumeMatch(builder);
+  // Close loop
+  builder->FinishBlockStmt();
+}
+
+bool IndexJoinTranslator::ConsumeVector(FunctionBuilder *builder) {
+  auto *scan = dynamic_cast<SeqScanTranslator *>(child_translator_);
+  if (scan == nullptr || !scan->IsVectorizable()) return false;
+
+  // Add the key of every outer tuple to the batch
+  scan->GenPCILoop(builder);
+  ast::Expr *add_key_call = codegen_->OneArgCall(ast::Builtin::IndexIteratorAddBatchKey, index_iter_, true);
+  builder->Append(codegen_->DeclareVariable(batch_key_pr_, nullptr, add_key_call));
+  FillKey(builder, batch_key_pr_);
+  builder->FinishBlockStmt();
+
+  // Probe the index with all the keys at once
+  ast::Expr *scan_call = codegen_->OneArgCall(ast::Builtin::IndexIteratorScanKeyBatch, index_iter_, true);
+  builder->Append(codegen_->MakeStmt(scan_call));
+
+  // Go over the outer tuples again, in the same order, and join each with the matches of its key
+  scan->GenPCIReset(builder);
+  scan->GenPCILoop(builder);
+  GenBatchForLoop(builder);
+  ConsumeMatch(builder);
+  // Close loops
+  builder->FinishBlockStmt();
+  builder->FinishBlockStmt();
+  return true;
+}
+
+void IndexJoinTranslator::ConsumeMatch(FunctionBuilder *builder) {
   // Get Table PR
   DeclareTablePR(builder);
   DeclareSlot(builder);
@@ -59,8 +93,6 @@ void IndexJoinTranslator::Consume(FunctionBuilder *builder) {
   parent_translator_->Consume(builder);
   // Close if statement
   if (has_predicate) builder->FinishBlockStmt();
-  // Close loop
-  builder->FinishBlockStmt();
 }
 
 ast::Expr *IndexJoinTranslator::GetOutput(uint32_t attr_idx) {
@@ -123,7 +155,7 @@ void IndexJoinTranslator::DeclareSlot(terrier::execution::compiler::FunctionBuil
   builder->Append(codegen_->DeclareVariable(slot_, nullptr, get_slot_call));
 }
 
-void IndexJoinTranslator::FillKey(FunctionBuilder *builder) {
+void IndexJoinTranslator::FillKey(FunctionBuilder *builder, ast::Identifier key_pr) {
   // Set key.attr_i = expr_i for each key attribute
   for (const auto &key : op_->GetIndexColumns()) {
     auto translator = TranslatorFactory::CreateExpressionTranslator(key.second.Get(), codegen_);
@@ -131,7 +163,7 @@ void IndexJoinTranslator::FillKey(FunctionBuilder *builder) {
     type::TypeId attr_type = index_schema_.GetColumn(!key.first - 1).Type();
     bool nullable = index_schema_.GetColumn(!key.first - 1).Nullable();
     auto set_key_call =
-        codegen_->PRSet(codegen_->MakeExpr(index_pr_), attr_type, nullable, attr_offset, translator->DeriveExpr(this));
+        codegen_->PRSet(codegen_->MakeExpr(key_pr), attr_type, nullable, attr_offset, translator->DeriveExpr(this));
     builder->Append(codegen_->MakeStmt(set_key_call));
   }
 }
@@ -147,6 +179,14 @@ void IndexJoinTranslator::GenForLoop(FunctionBuilder *builder) {
   builder->StartForStmt(loop_init, advance_call, nullptr);
 }
 
+void IndexJoinTranslator::GenBatchForLoop(FunctionBuilder *builder) {
+  // for (@indexIteratorNextBatchKey(&index_iter); @indexIteratorAdvance(&index_iter);)
+  ast::Expr *next_key_call = codegen_->OneArgCall(ast::Builtin::IndexIteratorNextBatchKey, index_iter_, true);
+  ast::Stmt *loop_init = codegen_->MakeStmt(next_key_call);
+  ast::Expr *advance_call = codegen_->OneArgCall(ast::Builtin::IndexIteratorAdvance, index_iter_, true);
+  builder->StartForStmt(loop_init, advance_call, nullptr);
+}
+
 void IndexJoinTranslator::GenPredicate(FunctionBuilder *builder) {
   auto translator = TranslatorFactory::CreateExpressionTranslator(op_->GetJoinPredicate().Get(), codegen_);
   ast::Expr *cond = translator->DeriveExpr(this);
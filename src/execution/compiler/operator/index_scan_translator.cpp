@@ -4,6 +4,7 @@
 #include "execution/compiler/function_builder.h"
 #include "execution/compiler/operator/operator_translator.h"
 #include "execution/compiler/translator_factory.h"
+#include "parser/expression/column_value_expression.h"
 #include "planner/plannodes/index_join_plan_node.h"
 
 namespace terrier::execution::compiler {
@@ -22,8 +23,18 @@ IndexScanTranslator::IndexScanTranslator(const planner::IndexScanPlanNode *op, C
       lo_index_pr_(codegen->NewIdentifier("lo_index_pr")),
       hi_index_pr_(codegen->NewIdentifier("hi_index_pr")),
       table_pr_(codegen->NewIdentifier("table_pr")),
+      key_pr_(codegen->NewIdentifier("key_pr")),
       pr_type_(codegen->Context()->GetIdentifier("ProjectedRow")),
-      slot_(codegen->NewIdentifier("slot")) {}
+      slot_(codegen->NewIdentifier("slot")) {
+  if (op_->IsIndexOnly()) {
+    for (const auto &key_col : index_schema_.GetColumns()) {
+      const auto key_expr = key_col.StoredExpression();
+      if (key_expr->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE) continue;
+      const auto col_oid = key_expr.CastManagedPointerTo<const parser::ColumnValueExpression>()->GetColumnOid();
+      key_col_oids_.emplace(col_oid, key_col.Oid());
+    }
+  }
+}
 
 void IndexScanTranslator::Produce(FunctionBuilder *builder) {
   // Create the col_oid array
@@ -58,8 +69,12 @@ void IndexScanTranslator::Consume(FunctionBuilder *builder) {
   }
   // Generate the loop
   GenForLoop(builder);
-  // Get Table PR
-  DeclareTablePR(builder);
+  // Get Table PR, or the key when the index covers the scan
+  if (op_->IsIndexOnly()) {
+    DeclareKeyPR(builder);
+  } else {
+    DeclareTablePR(builder);
+  }
   DeclareSlot(builder);
   bool has_predicate = op_->GetScanPredicate() != nullptr;
   if (has_predicate) GenPredicate(builder);
@@ -85,6 +100,10 @@ ast::Expr *IndexScanTranslator::GetChildOutput(uint32_t child_idx, uint32_t attr
 ast::Expr *IndexScanTranslator::GetTableColumn(const catalog::col_oid_t &col_oid) {
   auto type = table_schema_.GetColumn(col_oid).Type();
   auto nullable = table_schema_.GetColumn(col_oid).Nullable();
+  if (op_->IsIndexOnly()) {
+    uint16_t key_attr_idx = index_pm_.at(key_col_oids_.at(col_oid));
+    return codegen_->PRGet(codegen_->MakeExpr(key_pr_), type, nullable, key_attr_idx);
+  }
   uint16_t attr_idx = table_pm_[col_oid];
   return codegen_->PRGet(codegen_->MakeExpr(table_pr_), type, nullable, attr_idx);
 }
@@ -117,6 +136,11 @@ void IndexScanTranslator::DeclareIterator(FunctionBuilder *builder) {
   ast::Expr *init_call =
       codegen_->IndexIteratorInit(index_iter_, num_attrs, !op_->GetTableOid(), !op_->GetIndexOid(), col_oids_);
   builder->Append(codegen_->MakeStmt(init_call));
+  if (op_->IsIndexOnly()) {
+    // @indexIteratorSetKeyOnly(&index_iter)
+    ast::Expr *key_only_call = codegen_->OneArgCall(ast::Builtin::IndexIteratorSetKeyOnly, index_iter_, true);
+    builder->Append(codegen_->MakeStmt(key_only_call));
+  }
 }
 
 void IndexScanTranslator::DeclareIndexPR(terrier::execution::compiler::FunctionBuilder *builder) {
@@ -136,6 +160,11 @@ void IndexScanTranslator::DeclareTablePR(terrier::execution::compiler::FunctionB
   builder->Append(codegen_->DeclareVariable(table_pr_, nullptr, get_pr_call));
 }
 
+void IndexScanTranslator::DeclareKeyPR(terrier::execution::compiler::FunctionBuilder *builder) {
+  ast::Expr *get_pr_call = codegen_->OneArgCall(ast::Builtin::IndexIteratorGetKeyPR, index_iter_, true);
+  builder->Append(codegen_->DeclareVariable(key_pr_, nullptr, get_pr_call));
+}
+
 void IndexScanTranslator::DeclareSlot(terrier::execution::compiler::FunctionBuilder *builder) {
   ast::Expr *get_slot_call = codegen_->OneArgCall(ast::Builtin::IndexIteratorGetSlot, index_iter_, true);
   builder->Append(codegen_->DeclareVariable(slot_, nullptr, get_slot_call));
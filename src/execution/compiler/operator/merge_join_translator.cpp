@@ -0,0 +1,334 @@
+#include "execution/compiler/operator/merge_join_translator.h"
+#include <memory>
+#include <utility>
+#include <vector>
+#include "execution/compiler/function_builder.h"
+#include "execution/compiler/translator_factory.h"
+#include "planner/plannodes/merge_join_plan_node.h"
+
+namespace terrier::execution::compiler {
+MergeJoinLeftTranslator::MergeJoinLeftTranslator(const terrier::planner::MergeJoinPlanNode *op,
+                                                 execution::compiler::CodeGen *codegen)
+    : OperatorTranslator(codegen, brain::ExecutionOperatingUnitType::SORT_BUILD),
+      op_(op),
+      sorter_{codegen->NewIdentifier("merge_sorter")},
+      left_struct_{codegen->NewIdentifier("LeftRow")},
+      left_row_{codegen->NewIdentifier("left_row")},
+      comp_fn_{codegen->NewIdentifier("mergeSorterCompFn")},
+      comp_lhs_{codegen->NewIdentifier("lhs")},
+      comp_rhs_{codegen->NewIdentifier("rhs")} {}
+
+void MergeJoinLeftTranslator::Produce(FunctionBuilder *builder) {
+  // The left rows arrive sorted, so that the pipeline ends without sorting them
+  child_translator_->Produce(builder);
+}
+
+void MergeJoinLeftTranslator::Abort(FunctionBuilder *builder) { child_translator_->Abort(builder); }
+
+// Generated code:
+// if (@isSqlNotNull(left_key0) and ...) {
+//   var left_row = @ptrCast(*LeftRow, @sorterInsert(&state.merge_sorter))
+//   left_row.left_attr0 = ...
+// }
+void MergeJoinLeftTranslator::Consume(FunctionBuilder *builder) {
+  // Rows with a NULL key never join. Leaving them out keeps the buffered keys comparable.
+  ast::Expr *not_null = nullptr;
+  for (const auto &key : op_->GetLeftMergeKeys()) {
+    auto key_translator = TranslatorFactory::CreateExpressionTranslator(key.Get(), codegen_);
+    ast::Expr *key_not_null = codegen_->IsSqlNotNull(key_translator->DeriveExpr(this));
+    not_null = not_null == nullptr ? key_not_null
+                                   : codegen_->BinaryOp(parsing::Token::Type::AND, not_null, key_not_null);
+  }
+  builder->StartIfStmt(not_null);
+
+  ast::Expr *insert_call = codegen_->OneArgStateCall(ast::Builtin::SorterInsert, sorter_);
+  builder->Append(codegen_->DeclareVariable(left_row_, nullptr, codegen_->PtrCast(left_struct_, insert_call)));
+  for (uint32_t attr_idx = 0; attr_idx < op_->GetChild(0)->GetOutputSchema()->GetColumns().size(); attr_idx++) {
+    ast::Expr *lhs = GetAttribute(left_row_, attr_idx);
+    ast::Expr *rhs = child_translator_->GetOutput(attr_idx);
+    builder->Append(codegen_->Assign(lhs, rhs));
+  }
+  builder->FinishBlockStmt();
+}
+
+void MergeJoinLeftTranslator::InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) {
+  // merge_sorter: Sorter
+  ast::Expr *sorter_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Sorter);
+  state_fields->emplace_back(codegen_->MakeField(sorter_, sorter_type));
+}
+
+void MergeJoinLeftTranslator::InitializeStructs(util::RegionVector<ast::Decl *> *decls) {
+  util::RegionVector<ast::FieldDecl *> fields{codegen_->Region()};
+  GetChildOutputFields(&fields, LEFT_ATTR_NAME);
+  decls->emplace_back(codegen_->MakeStruct(left_struct_, std::move(fields)));
+}
+
+void MergeJoinLeftTranslator::InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) {
+  // Make a function (lhs *LeftRow, rhs *LeftRow) -> int32
+  ast::FieldDecl *lhs = codegen_->MakeField(comp_lhs_, codegen_->PointerType(left_struct_));
+  ast::FieldDecl *rhs = codegen_->MakeField(comp_rhs_, codegen_->PointerType(left_struct_));
+  ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Int32);
+  util::RegionVector<ast::FieldDecl *> params{{lhs, rhs}, codegen_->Region()};
+  FunctionBuilder builder{codegen_, comp_fn_, std::move(params), ret_type};
+  GenComparisons(&builder);
+  decls->push_back(builder.Finish());
+}
+
+void MergeJoinLeftTranslator::InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) {
+  // @sorterInit(&state.merge_sorter, @execCtxGetMem(execCtx), mergeSorterCompFn, @sizeOf(LeftRow))
+  std::vector<ast::Expr *> init_args{codegen_->GetStateMemberPtr(sorter_), codegen_->ExecCtxGetMem(),
+                                     codegen_->MakeExpr(comp_fn_), codegen_->SizeOf(left_struct_)};
+  ast::Expr *init_call = codegen_->BuiltinCall(ast::Builtin::SorterInit, std::move(init_args));
+  setup_stmts->emplace_back(codegen_->MakeStmt(init_call));
+}
+
+void MergeJoinLeftTranslator::InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) {
+  // @sorterFree(&state.merge_sorter)
+  ast::Expr *free_call = codegen_->OneArgStateCall(ast::Builtin::SorterFree, sorter_);
+  teardown_stmts->emplace_back(codegen_->MakeStmt(free_call));
+}
+
+ast::Expr *MergeJoinLeftTranslator::GetOutput(uint32_t attr_idx) { return GetAttribute(left_row_, attr_idx); }
+
+ast::Expr *MergeJoinLeftTranslator::GetChildOutput(uint32_t child_idx, uint32_t attr_idx,
+                                                   terrier::type::TypeId type) {
+  if (current_row_ == CurrentRow::Child) {
+    return child_translator_->GetOutput(attr_idx);
+  }
+  return GetAttribute(current_row_ == CurrentRow::Lhs ? comp_lhs_ : comp_rhs_, attr_idx);
+}
+
+ast::Expr *MergeJoinLeftTranslator::GetAttribute(ast::Identifier object, uint32_t attr_idx) {
+  ast::Identifier member = codegen_->Context()->GetIdentifier(LEFT_ATTR_NAME + std::to_string(attr_idx));
+  return codegen_->MemberExpr(object, member);
+}
+
+void MergeJoinLeftTranslator::GenComparisons(FunctionBuilder *builder) {
+  // For each merge key generate this:
+  // if (lhs.key_i < rhs.key_i) {return -1}
+  // if (lhs.key_i > rhs.key_i) {return 1}
+  // ...
+  // return 0
+  for (const auto &key : op_->GetLeftMergeKeys()) {
+    auto key_translator = TranslatorFactory::CreateExpressionTranslator(key.Get(), codegen_);
+    int32_t ret_value = -1;
+    for (const auto tok : {parsing::Token::Type::LESS, parsing::Token::Type::GREATER}) {
+      current_row_ = CurrentRow::Lhs;
+      ast::Expr *lhs_key = key_translator->DeriveExpr(this);
+      current_row_ = CurrentRow::Rhs;
+      ast::Expr *rhs_key = key_translator->DeriveExpr(this);
+      builder->StartIfStmt(codegen_->Compare(tok, lhs_key, rhs_key));
+      builder->Append(codegen_->ReturnStmt(codegen_->IntLiteral(ret_value)));
+      builder->FinishBlockStmt();
+      ret_value = -ret_value;
+    }
+  }
+  current_row_ = CurrentRow::Child;
+  builder->Append(codegen_->ReturnStmt(codegen_->IntLiteral(0)));
+}
+
+////////////////////////////////////////
+//// Right translator
+////////////////////////////////////////
+
+MergeJoinRightTranslator::MergeJoinRightTranslator(const terrier::planner::MergeJoinPlanNode *op,
+                                                   execution::compiler::CodeGen *codegen,
+                                                   execution::compiler::OperatorTranslator *left)
+    : OperatorTranslator{codegen, brain::ExecutionOperatingUnitType::SORT_ITERATE},
+      op_(op),
+      left_(dynamic_cast<MergeJoinLeftTranslator *>(left)),
+      probe_struct_{codegen->NewIdentifier("ProbeRow")},
+      probe_row_{codegen->NewIdentifier("probe_row")},
+      merge_cmp_{codegen->NewIdentifier("mergeJoinCmpFn")},
+      merge_iter_{codegen->NewIdentifier("merge_iter")},
+      run_start_{codegen->NewIdentifier("run_start")} {}
+
+void MergeJoinRightTranslator::Produce(FunctionBuilder *builder) {
+  // var run_start: uint64 = 0
+  // The index of the first left row whose keys are not smaller than those of the last probe row
+  ast::Expr *run_start_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Uint64);
+  builder->Append(codegen_->DeclareVariable(run_start_, run_start_type, codegen_->IntLiteral(0)));
+  // Let right child produce its code
+  child_translator_->Produce(builder);
+}
+
+void MergeJoinRightTranslator::Abort(FunctionBuilder *builder) {
+  // The parent only consumes within the merge loop
+  GenIteratorClose(builder);
+  child_translator_->Abort(builder);
+}
+
+// Generated code:
+// var probe_row: ProbeRow
+// probe_row.right_attr0 = ...
+// if (@isSqlNotNull(right_key0) and ...) {
+//   var merge_iter: SorterIterator
+//   @sorterIterInit(&merge_iter, &state.merge_sorter)
+//   @sorterIterSkipRows(&merge_iter, run_start)
+//   for (; @sorterIterHasNext(&merge_iter) and mergeJoinCmpFn(..., &probe_row) < 0; @sorterIterNext(&merge_iter)) {
+//     run_start = run_start + 1
+//   }
+//   for (; @sorterIterHasNext(&merge_iter) and mergeJoinCmpFn(..., &probe_row) == 0; @sorterIterNext(&merge_iter)) {
+//     var left_row = @ptrCast(*LeftRow, @sorterIterGetRow(&merge_iter))
+//     ...
+//   }
+//   @sorterIterClose(&merge_iter)
+// }
+void MergeJoinRightTranslator::Consume(FunctionBuilder *builder) {
+  FillProbeRow(builder);
+  builder->StartIfStmt(GenKeysNotNull());
+  DeclareIterator(builder);
+
+  // Skip the left rows with smaller keys. No later probe row, whose keys are at least as large, can match them.
+  GenMergeLoop(builder, parsing::Token::Type::LESS);
+  ast::Expr *next_run_start =
+      codegen_->BinaryOp(parsing::Token::Type::PLUS, codegen_->MakeExpr(run_start_), codegen_->IntLiteral(1));
+  builder->Append(codegen_->Assign(codegen_->MakeExpr(run_start_), next_run_start));
+  builder->FinishBlockStmt();
+
+  // Join with the run of left rows with equal keys. The next probe row starts over at the beginning of the run.
+  GenMergeLoop(builder, parsing::Token::Type::EQUAL_EQUAL);
+  DeclareMatch(builder);
+  if (op_->GetJoinPredicate() != nullptr) {
+    auto pred_translator = TranslatorFactory::CreateExpressionTranslator(op_->GetJoinPredicate().Get(), codegen_);
+    builder->StartIfStmt(pred_translator->DeriveExpr(this));
+    parent_translator_->Consume(builder);
+    builder->FinishBlockStmt();
+  } else {
+    parent_translator_->Consume(builder);
+  }
+  builder->FinishBlockStmt();
+
+  GenIteratorClose(builder);
+  builder->FinishBlockStmt();
+}
+
+void MergeJoinRightTranslator::FillProbeRow(FunctionBuilder *builder) {
+  builder->Append(codegen_->DeclareVariable(probe_row_, codegen_->MakeExpr(probe_struct_), nullptr));
+  for (uint32_t attr_idx = 0; attr_idx < op_->GetChild(1)->GetOutputSchema()->GetColumns().size(); attr_idx++) {
+    ast::Expr *lhs = GetProbeValue(attr_idx);
+    ast::Expr *rhs = child_translator_->GetOutput(attr_idx);
+    builder->Append(codegen_->Assign(lhs, rhs));
+  }
+}
+
+ast::Expr *MergeJoinRightTranslator::GenKeysNotNull() {
+  ast::Expr *not_null = nullptr;
+  for (const auto &key : op_->GetRightMergeKeys()) {
+    auto key_translator = TranslatorFactory::CreateExpressionTranslator(key.Get(), codegen_);
+    ast::Expr *key_not_null = codegen_->IsSqlNotNull(key_translator->DeriveExpr(this));
+    not_null = not_null == nullptr ? key_not_null
+                                   : codegen_->BinaryOp(parsing::Token::Type::AND, not_null, key_not_null);
+  }
+  return not_null;
+}
+
+void MergeJoinRightTranslator::DeclareIterator(FunctionBuilder *builder) {
+  // var merge_iter: SorterIterator
+  ast::Expr *iter_type = codegen_->BuiltinType(ast::BuiltinType::Kind::SorterIterator);
+  builder->Append(codegen_->DeclareVariable(merge_iter_, iter_type, nullptr));
+  // @sorterIterInit(&merge_iter, &state.merge_sorter)
+  ast::Expr *init_call = codegen_->BuiltinCall(
+      ast::Builtin::SorterIterInit, {codegen_->PointerTo(merge_iter_), codegen_->GetStateMemberPtr(left_->sorter_)});
+  builder->Append(codegen_->MakeStmt(init_call));
+  // @sorterIterSkipRows(&merge_iter, run_start)
+  ast::Expr *skip_call = codegen_->BuiltinCall(ast::Builtin::SorterIterSkipRows,
+                                               {codegen_->PointerTo(merge_iter_), codegen_->MakeExpr(run_start_)});
+  builder->Append(codegen_->MakeStmt(skip_call));
+}
+
+void MergeJoinRightTranslator::GenMergeLoop(FunctionBuilder *builder, parsing::Token::Type comp_type) {
+  // mergeJoinCmpFn(@ptrCast(*LeftRow, @sorterIterGetRow(&merge_iter)), &probe_row)
+  ast::Expr *get_row_call = codegen_->OneArgCall(ast::Builtin::SorterIterGetRow, merge_iter_, true);
+  util::RegionVector<ast::Expr *> cmp_args{
+      {codegen_->PtrCast(left_->left_struct_, get_row_call), codegen_->PointerTo(probe_row_)}, codegen_->Region()};
+  ast::Expr *cmp_call = codegen_->Factory()->NewCallExpr(codegen_->MakeExpr(merge_cmp_), std::move(cmp_args));
+
+  // for (; @sorterIterHasNext(&merge_iter) and cmp OP 0; @sorterIterNext(&merge_iter))
+  ast::Expr *has_next_call = codegen_->OneArgCall(ast::Builtin::SorterIterHasNext, merge_iter_, true);
+  ast::Expr *loop_cond = codegen_->BinaryOp(parsing::Token::Type::AND, has_next_call,
+                                            codegen_->Compare(comp_type, cmp_call, codegen_->IntLiteral(0)));
+  ast::Expr *next_call = codegen_->OneArgCall(ast::Builtin::SorterIterNext, merge_iter_, true);
+  builder->StartForStmt(nullptr, loop_cond, codegen_->MakeStmt(next_call));
+}
+
+// Call @sorterIterClose(&merge_iter)
+void MergeJoinRightTranslator::GenIteratorClose(FunctionBuilder *builder) {
+  ast::Expr *close_call = codegen_->OneArgCall(ast::Builtin::SorterIterClose, merge_iter_, true);
+  builder->Append(codegen_->MakeStmt(close_call));
+}
+
+// var left_row = @ptrCast(*LeftRow, @sorterIterGetRow(&merge_iter))
+void MergeJoinRightTranslator::DeclareMatch(FunctionBuilder *builder) {
+  ast::Expr *get_row_call = codegen_->OneArgCall(ast::Builtin::SorterIterGetRow, merge_iter_, true);
+  ast::Expr *cast_call = codegen_->PtrCast(left_->left_struct_, get_row_call);
+  builder->Append(codegen_->DeclareVariable(left_->left_row_, nullptr, cast_call));
+}
+
+ast::Expr *MergeJoinRightTranslator::GetOutput(uint32_t attr_idx) {
+  auto output_expr = op_->GetOutputSchema()->GetColumn(attr_idx).GetExpr();
+  std::unique_ptr<ExpressionTranslator> translator =
+      TranslatorFactory::CreateExpressionTranslator(output_expr.Get(), codegen_);
+  return translator->DeriveExpr(this);
+}
+
+ast::Expr *MergeJoinRightTranslator::GetChildOutput(uint32_t child_idx, uint32_t attr_idx,
+                                                    terrier::type::TypeId type) {
+  TERRIER_ASSERT(child_idx <= 1, "A merge join can only have two children.");
+  // For the left child, get the attribute of the left row
+  if (child_idx == 0) {
+    return left_->GetOutput(attr_idx);
+  }
+  // Otherwise get the output from the probe row.
+  return GetProbeValue(attr_idx);
+}
+
+ast::Expr *MergeJoinRightTranslator::GetProbeValue(uint32_t idx) {
+  ast::Identifier member = codegen_->Context()->GetIdentifier(RIGHT_ATTR_NAME + std::to_string(idx));
+  return codegen_->MemberExpr(probe_row_, member);
+}
+
+void MergeJoinRightTranslator::InitializeStructs(util::RegionVector<ast::Decl *> *decls) {
+  util::RegionVector<ast::FieldDecl *> fields{codegen_->Region()};
+  GetChildOutputFields(&fields, RIGHT_ATTR_NAME);
+  decls->emplace_back(codegen_->MakeStruct(probe_struct_, std::move(fields)));
+}
+
+// Declare a function that compares the merge keys of a left row with those of a probe row
+void MergeJoinRightTranslator::InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) {
+  // Generate the function type (*LeftRow, *ProbeRow) -> int32. The parameters take the names of the rows in the
+  // pipeline, so that the keys are derived the same way in both.
+  ast::FieldDecl *param1 = codegen_->MakeField(left_->left_row_, codegen_->PointerType(left_->left_struct_));
+  ast::FieldDecl *param2 = codegen_->MakeField(probe_row_, codegen_->PointerType(probe_struct_));
+  util::RegionVector<ast::FieldDecl *> params({param1, param2}, codegen_->Region());
+  ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Int32);
+
+  FunctionBuilder builder(codegen_, merge_cmp_, std::move(params), ret_type);
+  GenKeyComparisons(&builder);
+  decls->emplace_back(builder.Finish());
+}
+
+void MergeJoinRightTranslator::GenKeyComparisons(FunctionBuilder *builder) {
+  // For each pair of merge keys generate this:
+  // if (left_key_i < right_key_i) {return -1}
+  // if (left_key_i > right_key_i) {return 1}
+  // ...
+  // return 0
+  const auto &left_keys = op_->GetLeftMergeKeys();
+  const auto &right_keys = op_->GetRightMergeKeys();
+  TERRIER_ASSERT(left_keys.size() == right_keys.size(), "Both sides must have as many merge keys");
+  for (uint32_t i = 0; i < left_keys.size(); i++) {
+    auto left_translator = TranslatorFactory::CreateExpressionTranslator(left_keys[i].Get(), codegen_);
+    auto right_translator = TranslatorFactory::CreateExpressionTranslator(right_keys[i].Get(), codegen_);
+    int32_t ret_value = -1;
+    for (const auto tok : {parsing::Token::Type::LESS, parsing::Token::Type::GREATER}) {
+      ast::Expr *cond = codegen_->Compare(tok, left_translator->DeriveExpr(this), right_translator->DeriveExpr(this));
+      builder->StartIfStmt(cond);
+      builder->Append(codegen_->ReturnStmt(codegen_->IntLiteral(ret_value)));
+      builder->FinishBlockStmt();
+      ret_value = -ret_value;
+    }
+  }
+  builder->Append(codegen_->ReturnStmt(codegen_->IntLiteral(0)));
+}
+}  // namespace terrier::execution::compiler
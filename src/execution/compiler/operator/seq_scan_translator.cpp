@@ -1,16 +1,170 @@
 #include "execution/compiler/operator/seq_scan_translator.h"
 
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <utility>
+#include <vector>
 #include "execution/ast/type.h"
 #include "execution/compiler/codegen.h"
 #include "execution/compiler/function_builder.h"
 #include "execution/compiler/pipeline.h"
 #include "execution/compiler/translator_factory.h"
+#include "parser/expression/column_value_expression.h"
 #include "parser/expression/constant_value_expression.h"
 #include "planner/plannodes/seq_scan_plan_node.h"
+#include "type/transient_value_peeker.h"
 
 namespace terrier::execution::compiler {
 
+namespace {
+
+bool IsConstant(const terrier::parser::AbstractExpression *expr) {
+  return expr->GetExpressionType() == terrier::parser::ExpressionType::VALUE_CONSTANT;
+}
+
+bool IsIntegerType(terrier::type::TypeId type) {
+  return type >= terrier::type::TypeId::TINYINT && type <= terrier::type::TypeId::BIGINT;
+}
+
+bool IsVectorizableArithmetic(terrier::parser::ExpressionType type) {
+  return type == terrier::parser::ExpressionType::OPERATOR_PLUS ||
+         type == terrier::parser::ExpressionType::OPERATOR_MINUS ||
+         type == terrier::parser::ExpressionType::OPERATOR_MULTIPLY;
+}
+
+bool IsInclusiveBound(terrier::parser::ExpressionType type) {
+  return type == terrier::parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO ||
+         type == terrier::parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO;
+}
+
+catalog::col_oid_t ColumnOid(const terrier::parser::AbstractExpression *expr) {
+  return dynamic_cast<const terrier::parser::ColumnValueExpression *>(expr)->GetColumnOid();
+}
+
+// Flip a comparison so that its operands can be swapped (c < col is the same as col > c).
+terrier::parser::ExpressionType FlipComparison(terrier::parser::ExpressionType type) {
+  switch (type) {
+    case terrier::parser::ExpressionType::COMPARE_LESS_THAN:
+      return terrier::parser::ExpressionType::COMPARE_GREATER_THAN;
+    case terrier::parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
+      return terrier::parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO;
+    case terrier::parser::ExpressionType::COMPARE_GREATER_THAN:
+      return terrier::parser::ExpressionType::COMPARE_LESS_THAN;
+    case terrier::parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
+      return terrier::parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO;
+    default:
+      return type;
+  }
+}
+
+// The value of an integer constant, widened to 64 bits.
+bool PeekInteger(const terrier::type::TransientValue &val, int64_t *int_val) {
+  switch (val.Type()) {
+    case terrier::type::TypeId::TINYINT:
+      *int_val = terrier::type::TransientValuePeeker::PeekTinyInt(val);
+      return true;
+    case terrier::type::TypeId::SMALLINT:
+      *int_val = terrier::type::TransientValuePeeker::PeekSmallInt(val);
+      return true;
+    case terrier::type::TypeId::INTEGER:
+      *int_val = terrier::type::TransientValuePeeker::PeekInteger(val);
+      return true;
+    case terrier::type::TypeId::BIGINT:
+      *int_val = terrier::type::TransientValuePeeker::PeekBigInt(val);
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether the constant can be handed to the filters of a column of the given type.
+// NULL constants are rejected because the filters do not implement three-valued logic.
+// Integer constants must fit in the column's type since they are narrowed before filtering.
+bool IsCompatibleConstant(terrier::type::TypeId col_type, const terrier::parser::AbstractExpression *expr) {
+  if (!IsConstant(expr)) return false;
+  auto val = dynamic_cast<const terrier::parser::ConstantValueExpression *>(expr)->GetValue();
+  if (val.Null()) return false;
+  if (IsIntegerType(col_type)) {
+    int64_t int_val;
+    if (!PeekInteger(val, &int_val)) return false;
+    switch (col_type) {
+      case terrier::type::TypeId::TINYINT:
+        return int_val >= INT8_MIN && int_val <= INT8_MAX;
+      case terrier::type::TypeId::SMALLINT:
+        return int_val >= INT16_MIN && int_val <= INT16_MAX;
+      case terrier::type::TypeId::INTEGER:
+        return int_val >= INT32_MIN && int_val <= INT32_MAX;
+      default:
+        return true;
+    }
+  }
+  switch (col_type) {
+    case terrier::type::TypeId::BOOLEAN:
+    case terrier::type::TypeId::DECIMAL:
+    case terrier::type::TypeId::DATE:
+    case terrier::type::TypeId::TIMESTAMP:
+      return val.Type() == col_type;
+    case terrier::type::TypeId::VARCHAR:
+    case terrier::type::TypeId::VARBINARY:
+      return val.Type() == terrier::type::TypeId::VARCHAR || val.Type() == terrier::type::TypeId::VARBINARY;
+    default:
+      return false;
+  }
+}
+
+// If the term compares a column with a constant, return the column, the comparison and the constant with the
+// constant on the right side.
+bool GetColumnBound(const terrier::parser::AbstractExpression *term, catalog::col_oid_t *col_oid,
+                    terrier::parser::ExpressionType *comp_type, const terrier::parser::AbstractExpression **bound) {
+  if (!TranslatorFactory::IsComparisonOp(term->GetExpressionType())) return false;
+  auto left = term->GetChild(0).Get();
+  auto right = term->GetChild(1).Get();
+  *comp_type = term->GetExpressionType();
+  if (IsConstant(left)) {
+    std::swap(left, right);
+    *comp_type = FlipComparison(*comp_type);
+  }
+  if (left->GetExpressionType() != terrier::parser::ExpressionType::COLUMN_VALUE || !IsConstant(right)) return false;
+  *col_oid = ColumnOid(left);
+  *bound = right;
+  return true;
+}
+
+// The value of a constant as a column of the given type stores it, if the column's zone maps can be compared with it.
+bool GetZoneMapValue(terrier::type::TypeId col_type, const terrier::parser::AbstractExpression *expr,
+                     int64_t *stored_val) {
+  if (!IsCompatibleConstant(col_type, expr)) return false;
+  auto val = dynamic_cast<const terrier::parser::ConstantValueExpression *>(expr)->GetValue();
+  switch (col_type) {
+    case terrier::type::TypeId::DATE:
+      *stored_val = !terrier::type::TransientValuePeeker::PeekDate(val);
+      return true;
+    case terrier::type::TypeId::TIMESTAMP: {
+      // Zone maps can only order timestamps that are also valid signed values
+      auto timestamp = !terrier::type::TransientValuePeeker::PeekTimestamp(val);
+      *stored_val = static_cast<int64_t>(timestamp);
+      return timestamp <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+    }
+    default:
+      return IsIntegerType(col_type) && PeekInteger(val, stored_val);
+  }
+}
+
+// Collect the terms of nested conjunctions.
+void FlattenConjunction(const terrier::parser::AbstractExpression *predicate,
+                        std::vector<const terrier::parser::AbstractExpression *> *terms) {
+  if (predicate->GetExpressionType() == terrier::parser::ExpressionType::CONJUNCTION_AND) {
+    for (const auto &child : predicate->GetChildren()) {
+      FlattenConjunction(child.Get(), terms);
+    }
+    return;
+  }
+  terms->push_back(predicate);
+}
+
+}  // namespace
+
 SeqScanTranslator::SeqScanTranslator(const terrier::planner::SeqScanPlanNode *op, CodeGen *codegen)
     : OperatorTranslator(codegen, brain::ExecutionOperatingUnitType::SEQ_SCAN),
       op_(op),
@@ -56,6 +210,12 @@ void SeqScanTranslator::DoTableScan(FunctionBuilder *builder) {
   bool has_if_stmt = false;
   if (is_vectorizable_) {
     if (has_predicate_) GenVectorizedPredicate(builder, op_->GetScanPredicate().Get());
+    // The parent may consume the whole vector at once.
+    if (parent_translator_->ConsumeVector(builder)) {
+      // Close TVI loop
+      builder->FinishBlockStmt();
+      return;
+    }
     GenPCILoop(builder);
   } else {
     GenPCILoop(builder);
@@ -107,6 +267,57 @@ void SeqScanTranslator::DeclareTVI(FunctionBuilder *builder) {
   // Call @tableIterInit(&tvi, execCtx, table_oid, col_oids)
   ast::Expr *init_call = codegen_->TableIterInit(tvi_, !op_->GetTableOid(), col_oids_);
   builder->Append(codegen_->MakeStmt(init_call));
+  if (has_predicate_) GenBlockFilters(builder);
+}
+
+void SeqScanTranslator::GenBlockFilters(FunctionBuilder *builder) {
+  // Every term of the predicate's conjunction has to hold, so each comparison of a column with a constant bounds the
+  // values of the tuples that can pass. Intersect the bounds of every column.
+  std::vector<const terrier::parser::AbstractExpression *> terms;
+  FlattenConjunction(op_->GetScanPredicate().Get(), &terms);
+  std::map<catalog::col_oid_t, std::pair<int64_t, int64_t>> bounds;
+  for (const auto *term : terms) {
+    catalog::col_oid_t col_oid;
+    terrier::parser::ExpressionType comp_type;
+    const terrier::parser::AbstractExpression *bound;
+    int64_t val;
+    if (!GetColumnBound(term, &col_oid, &comp_type, &bound) || pm_.count(col_oid) == 0 ||
+        !GetZoneMapValue(schema_.GetColumn(col_oid).Type(), bound, &val)) {
+      continue;
+    }
+    int64_t lo = std::numeric_limits<int64_t>::min(), hi = std::numeric_limits<int64_t>::max();
+    switch (comp_type) {
+      case terrier::parser::ExpressionType::COMPARE_EQUAL:
+        lo = hi = val;
+        break;
+      case terrier::parser::ExpressionType::COMPARE_LESS_THAN:
+        if (val == std::numeric_limits<int64_t>::min()) continue;
+        hi = val - 1;
+        break;
+      case terrier::parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
+        hi = val;
+        break;
+      case terrier::parser::ExpressionType::COMPARE_GREATER_THAN:
+        if (val == std::numeric_limits<int64_t>::max()) continue;
+        lo = val + 1;
+        break;
+      case terrier::parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
+        lo = val;
+        break;
+      default:
+        continue;
+    }
+    auto it = bounds.emplace(col_oid, std::make_pair(lo, hi)).first;
+    it->second.first = std::max(it->second.first, lo);
+    it->second.second = std::min(it->second.second, hi);
+  }
+
+  // Call @tableIterFilterBlocks(&tvi, col_idx, col_type, lo, hi) for every bounded column
+  for (const auto &[col_oid, range] : bounds) {
+    auto col_type = schema_.GetColumn(col_oid).Type();
+    ast::Expr *filter_call = codegen_->TableIterFilterBlocks(tvi_, pm_[col_oid], col_type, range.first, range.second);
+    builder->Append(codegen_->MakeStmt(filter_call));
+  }
 }
 
 void SeqScanTranslator::SetOids(FunctionBuilder *builder) {
@@ -156,6 +367,12 @@ void SeqScanTranslator::GenPCILoop(FunctionBuilder *builder) {
   builder->StartForStmt(nullptr, has_next_call, loop_advance);
 }
 
+void SeqScanTranslator::GenPCIReset(FunctionBuilder *builder) {
+  ast::Builtin reset_fn =
+      (is_vectorizable_ && has_predicate_) ? ast::Builtin::PCIResetFiltered : ast::Builtin::PCIReset;
+  builder->Append(codegen_->MakeStmt(codegen_->OneArgCall(reset_fn, pci_, false)));
+}
+
 void SeqScanTranslator::GenScanCondition(FunctionBuilder *builder) {
   // Generate tuple at a time scan condition
   auto predicate = op_->GetScanPredicate();
@@ -176,61 +393,168 @@ void SeqScanTranslator::GenTVIReset(execution::compiler::FunctionBuilder *builde
   builder->Append(codegen_->MakeStmt(reset_call));
 }
 
-bool SeqScanTranslator::IsVectorizable(const terrier::parser::AbstractExpression *predicate) {
-  // TODO(Amadou): Does not currently work with negative numbers so it's commented out.
-  // Once that bug is fixed, comment back in.
-  /*
-  // Recursively walks down the query plan to ensure that predicate has the form ((colX comp int) AND (colY comp int)
-  ...) if (predicate == nullptr) return true;
+bool SeqScanTranslator::IsScanColumn(const terrier::parser::AbstractExpression *expr) const {
+  if (expr->GetExpressionType() != terrier::parser::ExpressionType::COLUMN_VALUE) return false;
+  auto cve = dynamic_cast<const terrier::parser::ColumnValueExpression *>(expr);
+  return pm_.count(cve->GetColumnOid()) > 0;
+}
+
+bool SeqScanTranslator::IsVectorizable(const terrier::parser::AbstractExpression *predicate) const {
+  // Recursively walks down the predicate to ensure that it is a conjunction of terms supported by the PCI filters.
+  if (predicate == nullptr) return true;
 
-  if (predicate->GetExpressionType() == terrier::parser::ExpressionType::CONJUNCTION_AND) {
-    return IsVectorizable(predicate->GetChild(0).Get()) && IsVectorizable(predicate->GetChild(1).Get());
-  }
-  if (TranslatorFactory::IsComparisonOp(predicate->GetExpressionType())) {
-    // left is TVE and right is constant integer.
-    // TODO(Amadou): Add support for floats here and in the SIMD code.
-    // TODO(Amadou): Support right TVE and left constant integers. Be sure to flip inequalities while codegening.
-    return predicate->GetChild(0)->GetExpressionType() == terrier::parser::ExpressionType::COLUMN_VALUE &&
-        predicate->GetChild(1)->GetExpressionType() == terrier::parser::ExpressionType::VALUE_CONSTANT &&
-        (predicate->GetChild(1)->GetReturnValueType() >= terrier::type::TypeId::TINYINT &&
-            predicate->GetChild(1)->GetReturnValueType() <= terrier::type::TypeId::BIGINT);
-  }*/
+  auto expr_type = predicate->GetExpressionType();
+  if (expr_type == terrier::parser::ExpressionType::CONJUNCTION_AND) {
+    for (const auto &child : predicate->GetChildren()) {
+      if (!IsVectorizable(child.Get())) return false;
+    }
+    return true;
+  }
+  if (TranslatorFactory::IsNullOp(expr_type)) {
+    return IsScanColumn(predicate->GetChild(0).Get());
+  }
+  if (expr_type == terrier::parser::ExpressionType::COMPARE_IN) {
+    // col IN (c1, c2, ...)
+    if (predicate->GetChildrenSize() < 2 || !IsScanColumn(predicate->GetChild(0).Get())) return false;
+    auto col_type = schema_.GetColumn(ColumnOid(predicate->GetChild(0).Get())).Type();
+    for (uint32_t i = 1; i < predicate->GetChildrenSize(); i++) {
+      if (!IsCompatibleConstant(col_type, predicate->GetChild(i).Get())) return false;
+    }
+    return true;
+  }
+  if (TranslatorFactory::IsComparisonOp(expr_type)) {
+    auto left = predicate->GetChild(0).Get();
+    auto right = predicate->GetChild(1).Get();
+    if (IsConstant(left)) std::swap(left, right);
+    if (IsScanColumn(left) && IsScanColumn(right)) {
+      // col1 comp col2: both columns must have the same type.
+      return schema_.GetColumn(ColumnOid(left)).Type() == schema_.GetColumn(ColumnOid(right)).Type();
+    }
+    if (IsScanColumn(left)) {
+      // col comp constant
+      return IsCompatibleConstant(schema_.GetColumn(ColumnOid(left)).Type(), right);
+    }
+    if (IsVectorizableArithmetic(left->GetExpressionType()) && IsScanColumn(left->GetChild(0).Get())) {
+      // (col arith_op constant) comp constant: the arithmetic is done on BIGINT or DECIMAL like the SQL values.
+      auto col_type = schema_.GetColumn(ColumnOid(left->GetChild(0).Get())).Type();
+      if (IsIntegerType(col_type)) {
+        col_type = terrier::type::TypeId::BIGINT;
+      } else if (col_type != terrier::type::TypeId::DECIMAL) {
+        return false;
+      }
+      return IsCompatibleConstant(col_type, left->GetChild(1).Get()) && IsCompatibleConstant(col_type, right);
+    }
+  }
   return false;
 }
 
 void SeqScanTranslator::GenVectorizedPredicate(FunctionBuilder *builder,
                                                const terrier::parser::AbstractExpression *predicate) {
-  if (predicate->GetExpressionType() == terrier::parser::ExpressionType::CONJUNCTION_AND) {
-    GenVectorizedPredicate(builder, predicate->GetChild(0).Get());
-    GenVectorizedPredicate(builder, predicate->GetChild(1).Get());
-  } else if (TranslatorFactory::IsComparisonOp(predicate->GetExpressionType())) {
-    auto left_cve = dynamic_cast<const terrier::parser::ColumnValueExpression *>(predicate->GetChild(0).Get());
-    auto col_idx = pm_[left_cve->GetColumnOid()];
-    auto col_type = schema_.GetColumn(left_cve->GetColumnOid()).Type();
-    auto const_val = dynamic_cast<const terrier::parser::ConstantValueExpression *>(predicate->GetChild(1).Get());
-    auto trans_val = const_val->GetValue();
-    auto type = trans_val.Type();
-    ast::Expr *filter_val;
-    switch (type) {
-      case terrier::type::TypeId::TINYINT:
-        filter_val = codegen_->IntLiteral(terrier::type::TransientValuePeeker::PeekTinyInt(trans_val));
-        break;
-      case terrier::type::TypeId::SMALLINT:
-        filter_val = codegen_->IntLiteral(terrier::type::TransientValuePeeker::PeekSmallInt(trans_val));
-        break;
-      case terrier::type::TypeId::INTEGER:
-        filter_val = codegen_->IntLiteral(terrier::type::TransientValuePeeker::PeekInteger(trans_val));
-        break;
-      case terrier::type::TypeId::BIGINT:
-        filter_val =
-            codegen_->IntLiteral(static_cast<int32_t>(terrier::type::TransientValuePeeker::PeekBigInt(trans_val)));
-        break;
-      default:
-        UNREACHABLE("Impossible vectorized predicate!");
+  std::vector<const terrier::parser::AbstractExpression *> terms;
+  FlattenConjunction(predicate, &terms);
+
+  // The parser has no BETWEEN, so (col >= lo AND col <= hi) is turned into a single range filter here.
+  std::vector<bool> done(terms.size(), false);
+  for (uint32_t i = 0; i < terms.size(); i++) {
+    if (done[i]) continue;
+    done[i] = true;
+    catalog::col_oid_t col_oid;
+    terrier::parser::ExpressionType comp_type;
+    const terrier::parser::AbstractExpression *bound;
+    bool is_between = false;
+    if (GetColumnBound(terms[i], &col_oid, &comp_type, &bound) && IsInclusiveBound(comp_type)) {
+      for (uint32_t j = i + 1; j < terms.size() && !is_between; j++) {
+        catalog::col_oid_t other_oid;
+        terrier::parser::ExpressionType other_type;
+        const terrier::parser::AbstractExpression *other_bound;
+        if (done[j] || !GetColumnBound(terms[j], &other_oid, &other_type, &other_bound) || other_oid != col_oid ||
+            !IsInclusiveBound(other_type) || other_type == comp_type) {
+          continue;
+        }
+        done[j] = true;
+        is_between = true;
+        bool is_lower = comp_type == terrier::parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO;
+        ast::Expr *lo = GenFilterValue(is_lower ? bound : other_bound);
+        ast::Expr *hi = GenFilterValue(is_lower ? other_bound : bound);
+        GenVectorizedNotNull(builder, col_oid);
+        auto col_type = schema_.GetColumn(col_oid).Type();
+        builder->Append(codegen_->MakeStmt(codegen_->PCIFilterBetween(pci_, pm_[col_oid], col_type, lo, hi)));
+      }
     }
-    ast::Expr *filter_call = codegen_->PCIFilter(pci_, predicate->GetExpressionType(), col_idx, col_type, filter_val);
-    builder->Append(codegen_->MakeStmt(filter_call));
+    if (!is_between) GenVectorizedTerm(builder, terms[i]);
+  }
+}
+
+void SeqScanTranslator::GenVectorizedTerm(FunctionBuilder *builder, const terrier::parser::AbstractExpression *term) {
+  auto expr_type = term->GetExpressionType();
+  if (TranslatorFactory::IsNullOp(expr_type)) {
+    auto col_idx = pm_[ColumnOid(term->GetChild(0).Get())];
+    bool is_null = expr_type == terrier::parser::ExpressionType::OPERATOR_IS_NULL;
+    builder->Append(codegen_->MakeStmt(codegen_->PCIFilterNull(pci_, is_null, col_idx)));
+    return;
+  }
+
+  if (expr_type == terrier::parser::ExpressionType::COMPARE_IN) {
+    // Declare: var in_list: [num_vals]SqlType, fill it, then call @filterIn(pci, col_idx, col_type, in_list)
+    auto col_oid = ColumnOid(term->GetChild(0).Get());
+    auto col_type = schema_.GetColumn(col_oid).Type();
+    auto num_vals = term->GetChildrenSize() - 1;
+    ast::Identifier in_list = codegen_->NewIdentifier("in_list");
+    ast::Expr *arr_type = codegen_->ArrayType(num_vals, codegen_->TplType(col_type));
+    builder->Append(codegen_->DeclareVariable(in_list, arr_type, nullptr));
+    for (uint32_t i = 0; i < num_vals; i++) {
+      ast::Expr *lhs = codegen_->ArrayAccess(in_list, i);
+      builder->Append(codegen_->Assign(lhs, GenFilterValue(term->GetChild(i + 1).Get())));
+    }
+    GenVectorizedNotNull(builder, col_oid);
+    builder->Append(codegen_->MakeStmt(codegen_->PCIFilterIn(pci_, pm_[col_oid], col_type, in_list)));
+    return;
+  }
+
+  // Put the constant on the right side.
+  TERRIER_ASSERT(TranslatorFactory::IsComparisonOp(expr_type), "Impossible vectorized predicate!");
+  auto left = term->GetChild(0).Get();
+  auto right = term->GetChild(1).Get();
+  if (IsConstant(left)) {
+    std::swap(left, right);
+    expr_type = FlipComparison(expr_type);
+  }
+
+  ast::Expr *filter_call;
+  if (IsScanColumn(left) && IsScanColumn(right)) {
+    auto left_oid = ColumnOid(left);
+    auto right_oid = ColumnOid(right);
+    GenVectorizedNotNull(builder, left_oid);
+    GenVectorizedNotNull(builder, right_oid);
+    filter_call = codegen_->PCIFilterColumn(pci_, expr_type, pm_[left_oid], schema_.GetColumn(left_oid).Type(),
+                                            pm_[right_oid], schema_.GetColumn(right_oid).Type());
+  } else if (IsScanColumn(left)) {
+    auto col_oid = ColumnOid(left);
+    GenVectorizedNotNull(builder, col_oid);
+    filter_call = codegen_->PCIFilter(pci_, expr_type, pm_[col_oid], schema_.GetColumn(col_oid).Type(),
+                                      GenFilterValue(right));
+  } else {
+    auto col_oid = ColumnOid(left->GetChild(0).Get());
+    GenVectorizedNotNull(builder, col_oid);
+    ast::Expr *operand = GenFilterValue(left->GetChild(1).Get());
+    filter_call = codegen_->PCIFilterArith(pci_, expr_type, pm_[col_oid], schema_.GetColumn(col_oid).Type(),
+                                           left->GetExpressionType(), operand, GenFilterValue(right));
+  }
+  builder->Append(codegen_->MakeStmt(filter_call));
+}
+
+void SeqScanTranslator::GenVectorizedNotNull(FunctionBuilder *builder, catalog::col_oid_t col_oid) {
+  if (!schema_.GetColumn(col_oid).Nullable()) return;
+  builder->Append(codegen_->MakeStmt(codegen_->PCIFilterNull(pci_, false, pm_[col_oid])));
+}
+
+ast::Expr *SeqScanTranslator::GenFilterValue(const terrier::parser::AbstractExpression *constant) {
+  auto trans_val = dynamic_cast<const terrier::parser::ConstantValueExpression *>(constant)->GetValue();
+  ast::Expr *val = codegen_->PeekValue(trans_val);
+  // Booleans are peeked as primitive literals.
+  if (trans_val.Type() == terrier::type::TypeId::BOOLEAN) {
+    val = codegen_->OneArgCall(ast::Builtin::BoolToSql, val);
   }
-  UNREACHABLE("This function should not be called on non vectorized predicates!");
+  return val;
 }
 }  // namespace terrier::execution::compiler
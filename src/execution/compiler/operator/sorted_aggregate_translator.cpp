@@ -0,0 +1,86 @@
+#include "execution/compiler/operator/sorted_aggregate_translator.h"
+#include "execution/compiler/function_builder.h"
+#include "execution/compiler/translator_factory.h"
+
+namespace terrier::execution::compiler {
+SortedAggregateTranslator::SortedAggregateTranslator(const terrier::planner::AggregatePlanNode *op, CodeGen *codegen)
+    : OperatorTranslator(codegen, brain::ExecutionOperatingUnitType::AGGREGATE_BUILD),
+      op_(op),
+      helper_(codegen, op),
+      has_group_(codegen->NewIdentifier("has_group")) {}
+
+void SortedAggregateTranslator::InitializeStructs(util::RegionVector<ast::Decl *> *decls) {
+  // Declare the values struct.
+  helper_.GenValuesStruct(decls);
+  // Declare the struct of the current group.
+  helper_.GenAHTStructs(decls);
+}
+
+void SortedAggregateTranslator::Produce(FunctionBuilder *builder) {
+  // var aht_entry: AHTStruct
+  helper_.DeclareEntry(builder);
+  // var has_group = false
+  builder->Append(codegen_->DeclareVariable(has_group_, nullptr, codegen_->BoolLiteral(false)));
+  child_translator_->Produce(builder);
+  child_done_ = true;
+  // Output the last group once the child is exhausted.
+  builder->StartIfStmt(codegen_->MakeExpr(has_group_));
+  GenOutputGroup(builder);
+  builder->FinishBlockStmt();
+}
+
+void SortedAggregateTranslator::Abort(FunctionBuilder *builder) {
+  // The child has already cleaned up when the last group is output.
+  if (!child_done_) child_translator_->Abort(builder);
+}
+
+void SortedAggregateTranslator::Consume(FunctionBuilder *builder) {
+  // Generate Values
+  helper_.FillValues(builder, this);
+  // if (has_group and group changed) { output the group; has_group = false }
+  ast::Expr *changed = codegen_->BinaryOp(parsing::Token::Type::AND, codegen_->MakeExpr(has_group_),
+                                          helper_.GenGroupChanged());
+  builder->StartIfStmt(changed);
+  GenOutputGroup(builder);
+  builder->Append(codegen_->Assign(codegen_->MakeExpr(has_group_), codegen_->BoolLiteral(false)));
+  builder->FinishBlockStmt();
+  // if (!has_group) { start a new group; has_group = true }
+  builder->StartIfStmt(codegen_->UnaryOp(parsing::Token::Type::BANG, codegen_->MakeExpr(has_group_)));
+  helper_.GenStartGroup(builder);
+  builder->Append(codegen_->Assign(codegen_->MakeExpr(has_group_), codegen_->BoolLiteral(true)));
+  builder->FinishBlockStmt();
+  // Advance non distinct aggregates
+  helper_.GenAdvanceNonDistinct(builder);
+}
+
+void SortedAggregateTranslator::GenOutputGroup(FunctionBuilder *builder) {
+  outputting_ = true;
+  // Generate an if statement for the having clause
+  auto predicate = op_->GetHavingClausePredicate();
+  if (predicate != nullptr) {
+    auto translator = TranslatorFactory::CreateExpressionTranslator(predicate.Get(), codegen_);
+    builder->StartIfStmt(translator->DeriveExpr(this));
+  }
+  parent_translator_->Consume(builder);
+  // Close having statement
+  if (predicate != nullptr) {
+    builder->FinishBlockStmt();
+  }
+  outputting_ = false;
+}
+
+ast::Expr *SortedAggregateTranslator::GetOutput(uint32_t attr_idx) {
+  auto output_expr = op_->GetOutputSchema()->GetColumn(attr_idx).GetExpr();
+  auto translator = TranslatorFactory::CreateExpressionTranslator(output_expr.Get(), codegen_);
+  return translator->DeriveExpr(this);
+}
+
+ast::Expr *SortedAggregateTranslator::GetChildOutput(uint32_t child_idx, uint32_t attr_idx,
+                                                     terrier::type::TypeId type) {
+  if (!outputting_) return child_translator_->GetOutput(attr_idx);
+  auto global_aht = helper_.GetGlobalAHT();
+  if (child_idx == 0) return codegen_->MemberExpr(global_aht->Entry(), helper_.GetGroupBy(attr_idx));
+  auto agg = codegen_->MemberExpr(global_aht->Entry(), helper_.GetAggregate(attr_idx));
+  return codegen_->OneArgCall(ast::Builtin::AggResult, codegen_->PointerTo(agg));
+}
+}  // namespace terrier::execution::compiler
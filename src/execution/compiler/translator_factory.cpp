@@ -1,5 +1,6 @@
 #include "execution/compiler/translator_factory.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "common/macros.h"
@@ -20,10 +21,12 @@
 #include "execution/compiler/operator/index_scan_translator.h"
 #include "execution/compiler/operator/insert_translator.h"
 #include "execution/compiler/operator/limit_translator.h"
+#include "execution/compiler/operator/merge_join_translator.h"
 #include "execution/compiler/operator/nested_loop_translator.h"
 #include "execution/compiler/operator/projection_translator.h"
 #include "execution/compiler/operator/seq_scan_translator.h"
 #include "execution/compiler/operator/sort_translator.h"
+#include "execution/compiler/operator/sorted_aggregate_translator.h"
 #include "execution/compiler/operator/static_aggregate_translator.h"
 #include "execution/compiler/operator/update_translator.h"
 #include "execution/compiler/pipeline.h"
@@ -59,11 +62,25 @@ std::unique_ptr<OperatorTranslator> TranslatorFactory::CreateRegularTranslator(
     case terrier::planner::PlanNodeType::LIMIT: {
       return std::make_unique<LimitTranslator>(static_cast<const planner::LimitPlanNode *>(op), codegen);
     }
+    case terrier::planner::PlanNodeType::AGGREGATE: {
+      TERRIER_ASSERT(IsSortedAggregate(op), "Only sorted aggregations do not break the pipeline");
+      return std::make_unique<SortedAggregateTranslator>(static_cast<const planner::AggregatePlanNode *>(op), codegen);
+    }
     default:
       UNREACHABLE("Unsupported plan nodes");
   }
 }
 
+bool TranslatorFactory::IsSortedAggregate(const terrier::planner::AbstractPlanNode *op) {
+  if (op->GetPlanNodeType() != terrier::planner::PlanNodeType::AGGREGATE) return false;
+  auto agg_op = static_cast<const planner::AggregatePlanNode *>(op);
+  if (agg_op->GetAggregateStrategyType() != planner::AggregateStrategyType::SORTED) return false;
+  // Static aggregations have a single group, and distinct aggregates need their hash tables.
+  if (agg_op->GetGroupByTerms().empty()) return false;
+  const auto &terms = agg_op->GetAggregateTerms();
+  return std::none_of(terms.begin(), terms.end(), [](const auto &term) { return term->IsDistinct(); });
+}
+
 std::unique_ptr<OperatorTranslator> TranslatorFactory::CreateBottomTranslator(
     const terrier::planner::AbstractPlanNode *op, CodeGen *codegen) {
   switch (op->GetPlanNodeType()) {
@@ -104,6 +121,8 @@ std::unique_ptr<OperatorTranslator> TranslatorFactory::CreateLeftTranslator(
   switch (op->GetPlanNodeType()) {
     case terrier::planner::PlanNodeType::HASHJOIN:
       return std::make_unique<HashJoinLeftTranslator>(static_cast<const planner::HashJoinPlanNode *>(op), codegen);
+    case terrier::planner::PlanNodeType::MERGEJOIN:
+      return std::make_unique<MergeJoinLeftTranslator>(static_cast<const planner::MergeJoinPlanNode *>(op), codegen);
     case terrier::planner::PlanNodeType::NESTLOOP:
       return std::make_unique<NestedLoopLeftTranslator>(static_cast<const planner::NestedLoopJoinPlanNode *>(op),
                                                         codegen);
@@ -118,6 +137,9 @@ std::unique_ptr<OperatorTranslator> TranslatorFactory::CreateRightTranslator(
     case terrier::planner::PlanNodeType::HASHJOIN:
       return std::make_unique<HashJoinRightTranslator>(static_cast<const planner::HashJoinPlanNode *>(op), codegen,
                                                        left);
+    case terrier::planner::PlanNodeType::MERGEJOIN:
+      return std::make_unique<MergeJoinRightTranslator>(static_cast<const planner::MergeJoinPlanNode *>(op), codegen,
+                                                        left);
     case terrier::planner::PlanNodeType::NESTLOOP:
       return std::make_unique<NestedLoopRightTranslator>(static_cast<const planner::NestedLoopJoinPlanNode *>(op),
                                                          codegen, left);
@@ -28,6 +28,13 @@ bool IsPointerToAggregatorValue(ast::Type *type) {
   return false;
 }
 
+bool IsIntegerConstant(ast::Expr *expr) {
+  if (auto *unary = expr->SafeAs<ast::UnaryOpExpr>()) {
+    return unary->Op() == parsing::Token::Type::MINUS && unary->Expression()->IsIntegerLiteral();
+  }
+  return expr->IsIntegerLiteral();
+}
+
 template <typename... ArgTypes>
 bool AreAllFunctions(const ArgTypes... type) {
   return (true && ... && type->IsFunctionType());
@@ -213,8 +220,9 @@ void Sema::CheckBuiltinSqlConversionCall(ast::CallExpr *call, ast::Builtin built
   }
 }
 
-void Sema::CheckBuiltinFilterCall(ast::CallExpr *call) {
-  if (!CheckArgCount(call, 4)) {
+void Sema::CheckBuiltinFilterCall(ast::CallExpr *call, ast::Builtin builtin) {
+  const bool is_null_filter = builtin == ast::Builtin::FilterIsNull || builtin == ast::Builtin::FilterIsNotNull;
+  if (!CheckArgCountAtLeast(call, is_null_filter ? 2 : 4)) {
     return;
   }
 
@@ -234,6 +242,14 @@ void Sema::CheckBuiltinFilterCall(ast::CallExpr *call) {
     return;
   }
 
+  // NULL filters only need the column index
+  if (is_null_filter) {
+    if (CheckArgCount(call, 2)) {
+      call->SetType(GetBuiltinType(ast::BuiltinType::Int64));
+    }
+    return;
+  }
+
   // The third call argument must be an type represented by an integer.
   // TODO(Amadou): This is subject to change. Ideally, there should be a builtin for every type like for PCIGet.
   if (!args[2]->IsIntegerLiteral()) {
@@ -241,6 +257,75 @@ void Sema::CheckBuiltinFilterCall(ast::CallExpr *call) {
     return;
   }
 
+  const auto integer_kind = ast::BuiltinType::Integer;
+  switch (builtin) {
+    case ast::Builtin::FilterBetween: {
+      // @filterBetween(pci, col_idx, col_type, lo, hi): both bounds are SQL values
+      if (!CheckArgCount(call, 5)) {
+        return;
+      }
+      for (uint32_t idx : {3u, 4u}) {
+        if (!args[idx]->GetType()->IsSqlValueType()) {
+          ReportIncorrectCallArg(call, idx, GetBuiltinType(integer_kind));
+          return;
+        }
+      }
+      break;
+    }
+    case ast::Builtin::FilterIn: {
+      // @filterIn(pci, col_idx, col_type, vals): the list is an array of SQL values
+      if (!CheckArgCount(call, 4)) {
+        return;
+      }
+      auto *list_type = args[3]->GetType()->SafeAs<ast::ArrayType>();
+      if (list_type == nullptr || list_type->HasUnknownLength() || !list_type->ElementType()->IsSqlValueType()) {
+        ReportIncorrectCallArg(call, 3, ast::ArrayType::Get(1, GetBuiltinType(integer_kind)));
+        return;
+      }
+      break;
+    }
+    default: {
+      switch (args.size()) {
+        case 4: {
+          // @filterXX(pci, col_idx, col_type, val): the value is either an integer constant or a SQL value
+          if (!IsIntegerConstant(args[3]) && !args[3]->GetType()->IsSqlValueType()) {
+            ReportIncorrectCallArg(call, 3, GetBuiltinType(integer_kind));
+            return;
+          }
+          break;
+        }
+        case 5: {
+          // @filterXX(pci, col_idx, col_type, col_idx_2, col_type_2): compare two columns
+          for (uint32_t idx : {3u, 4u}) {
+            if (!args[idx]->IsIntegerLiteral()) {
+              ReportIncorrectCallArg(call, idx, GetBuiltinType(int32_kind));
+              return;
+            }
+          }
+          break;
+        }
+        default: {
+          // @filterXX(pci, col_idx, col_type, arith_op, operand, val): compare (col arith_op operand) with val
+          if (!CheckArgCount(call, 6)) {
+            return;
+          }
+          if (!args[3]->IsIntegerLiteral()) {
+            ReportIncorrectCallArg(call, 3, GetBuiltinType(int32_kind));
+            return;
+          }
+          for (uint32_t idx : {4u, 5u}) {
+            if (!args[idx]->GetType()->IsSqlValueType()) {
+              ReportIncorrectCallArg(call, idx, GetBuiltinType(integer_kind));
+              return;
+            }
+          }
+          break;
+        }
+      }
+      break;
+    }
+  }
+
   // Set return type
   call->SetType(GetBuiltinType(ast::BuiltinType::Int64));
 }
@@ -617,7 +702,7 @@ void Sema::CheckBuiltinAggregatorCall(ast::CallExpr *call, ast::Builtin builtin)
 }
 
 void Sema::CheckBuiltinJoinHashTableInit(ast::CallExpr *call) {
-  if (!CheckArgCount(call, 3)) {
+  if (!CheckArgCountAtLeast(call, 3) || (call->NumArgs() > 3 && !CheckArgCount(call, 4))) {
     return;
   }
 
@@ -637,12 +722,18 @@ void Sema::CheckBuiltinJoinHashTableInit(ast::CallExpr *call) {
     return;
   }
 
-  // Third and last argument must be a 32-bit number representing the tuple size
+  // Third argument must be a 32-bit number representing the tuple size
   if (!args[2]->GetType()->IsIntegerType()) {
     ReportIncorrectCallArg(call, 2, GetBuiltinType(ast::BuiltinType::Uint32));
     return;
   }
 
+  // Optional fourth argument is a flag requesting a radix-partitioned build
+  if (call->NumArgs() > 3 && !args[3]->GetType()->IsSpecificBuiltin(ast::BuiltinType::Bool)) {
+    ReportIncorrectCallArg(call, 3, GetBuiltinType(ast::BuiltinType::Bool));
+    return;
+  }
+
   // This call returns nothing
   call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
 }
@@ -844,6 +935,212 @@ void Sema::CheckBuiltinJoinHashTableIterClose(execution::ast::CallExpr *call) {
   call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
 }
 
+void Sema::CheckBuiltinJoinHashTablePartIterCall(ast::CallExpr *call, ast::Builtin builtin) {
+  if (!CheckArgCountAtLeast(call, 1)) {
+    return;
+  }
+
+  const auto &args = call->Arguments();
+
+  // The first argument is always a pointer to a JoinHashTablePartitionIterator
+  const auto part_iter_kind = ast::BuiltinType::JoinHashTablePartIter;
+  if (!IsPointerToSpecificBuiltin(args[0]->GetType(), part_iter_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(part_iter_kind)->PointerTo());
+    return;
+  }
+
+  switch (builtin) {
+    case ast::Builtin::JoinHashTablePartIterInit: {
+      if (!CheckArgCount(call, 3)) {
+        return;
+      }
+      // The build and probe sides are both join hash tables
+      const auto jht_kind = ast::BuiltinType::JoinHashTable;
+      for (uint32_t arg_idx = 1; arg_idx < 3; arg_idx++) {
+        if (!IsPointerToSpecificBuiltin(args[arg_idx]->GetType(), jht_kind)) {
+          ReportIncorrectCallArg(call, arg_idx, GetBuiltinType(jht_kind)->PointerTo());
+          return;
+        }
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::JoinHashTablePartIterHasNext: {
+      if (!CheckArgCount(call, 3)) {
+        return;
+      }
+      // Second argument is a key equality function
+      auto *const key_eq_type = args[1]->GetType()->SafeAs<ast::FunctionType>();
+      if (key_eq_type == nullptr || key_eq_type->NumParams() != 3 ||
+          !key_eq_type->ReturnType()->IsSpecificBuiltin(ast::BuiltinType::Bool) ||
+          !key_eq_type->Params()[0].type_->IsPointerType() || !key_eq_type->Params()[1].type_->IsPointerType() ||
+          !key_eq_type->Params()[2].type_->IsPointerType()) {
+        GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadEqualityFunctionForJHTGetNext,
+                                   args[1]->GetType(), 1);
+        return;
+      }
+      // Third argument is an arbitrary pointer
+      if (!args[2]->GetType()->IsPointerType()) {
+        GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadPointerForJHTGetNext, args[2]->GetType(), 2);
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Bool));
+      break;
+    }
+    case ast::Builtin::JoinHashTablePartIterGetProbeRow:
+    case ast::Builtin::JoinHashTablePartIterGetBuildRow: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
+      break;
+    }
+    case ast::Builtin::JoinHashTablePartIterClose: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible partitioned join iterator call");
+    }
+  }
+}
+
+void Sema::CheckBuiltinJoinHashTableEntryIterCall(ast::CallExpr *call, ast::Builtin builtin) {
+  if (!CheckArgCountAtLeast(call, 1)) {
+    return;
+  }
+
+  const auto &args = call->Arguments();
+
+  // The first argument is always a pointer to a JoinHashTableEntryIterator
+  const auto entry_iter_kind = ast::BuiltinType::JoinHashTableEntryIter;
+  if (!IsPointerToSpecificBuiltin(args[0]->GetType(), entry_iter_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(entry_iter_kind)->PointerTo());
+    return;
+  }
+
+  switch (builtin) {
+    case ast::Builtin::JoinHashTableEntryIterInit: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // The second argument is the join hash table to iterate over
+      const auto jht_kind = ast::BuiltinType::JoinHashTable;
+      if (!IsPointerToSpecificBuiltin(args[1]->GetType(), jht_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(jht_kind)->PointerTo());
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::JoinHashTableEntryIterHasNext: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Bool));
+      break;
+    }
+    case ast::Builtin::JoinHashTableEntryIterGetRow: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
+      break;
+    }
+    case ast::Builtin::JoinHashTableEntryIterClose: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible join hash table entry iterator call");
+    }
+  }
+}
+
+void Sema::CheckBuiltinJoinHashTableVectorProbeCall(ast::CallExpr *call, ast::Builtin builtin) {
+  if (!CheckArgCountAtLeast(call, 1)) {
+    return;
+  }
+
+  const auto &args = call->Arguments();
+
+  // The first argument is a pointer to a JoinHashTableVectorProbe
+  const auto probe_kind = ast::BuiltinType::JoinHashTableVectorProbe;
+  if (!IsPointerToSpecificBuiltin(args[0]->GetType(), probe_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(probe_kind)->PointerTo());
+    return;
+  }
+
+  const auto pci_kind = ast::BuiltinType::ProjectedColumnsIterator;
+  switch (builtin) {
+    case ast::Builtin::JoinHashTableVectorProbeInit: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // The second argument is the JoinHashTable to probe
+      const auto jht_kind = ast::BuiltinType::JoinHashTable;
+      if (!IsPointerToSpecificBuiltin(args[1]->GetType(), jht_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(jht_kind)->PointerTo());
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeAddKey: {
+      if (!CheckArgCount(call, 4)) {
+        return;
+      }
+      // The column index, the column type and the offset of the key in the build row are integers
+      for (uint32_t arg_idx = 1; arg_idx < 4; arg_idx++) {
+        if (!args[arg_idx]->GetType()->IsIntegerType()) {
+          ReportIncorrectCallArg(call, arg_idx, GetBuiltinType(ast::BuiltinType::Uint32));
+          return;
+        }
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbePrepare:
+    case ast::Builtin::JoinHashTableVectorProbeHasNext: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // The second argument is the input vector
+      if (!IsPointerToSpecificBuiltin(args[1]->GetType(), pci_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(pci_kind)->PointerTo());
+        return;
+      }
+      call->SetType(GetBuiltinType(builtin == ast::Builtin::JoinHashTableVectorProbePrepare ? ast::BuiltinType::Nil
+                                                                                            : ast::BuiltinType::Bool));
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeGetRow: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      // This call returns a byte pointer
+      call->SetType(GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeFree: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible join hash table vector probe call");
+    }
+  }
+}
+
 void Sema::CheckBuiltinExecutionContextCall(ast::CallExpr *call, UNUSED_ATTRIBUTE ast::Builtin builtin) {
   uint32_t expected_arg_count = 1;
 
@@ -1087,6 +1384,20 @@ void Sema::CheckBuiltinTableIterCall(ast::CallExpr *call, ast::Builtin builtin)
       call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
       break;
     }
+    case ast::Builtin::TableIterFilterBlocks: {
+      // @tableIterFilterBlocks(tvi, col_idx, col_type, lo, hi): all but the iterator are integer literals
+      if (!CheckArgCount(call, 5)) {
+        return;
+      }
+      for (uint32_t idx = 1; idx < 5; idx++) {
+        if (!call_args[idx]->IsIntegerLiteral()) {
+          ReportIncorrectCallArg(call, idx, GetBuiltinType(ast::BuiltinType::Int64));
+          return;
+        }
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
     default: {
       UNREACHABLE("Impossible table iteration call");
     }
@@ -1356,6 +1667,36 @@ void Sema::CheckBuiltinSizeOfCall(ast::CallExpr *call) {
   call->SetType(GetBuiltinType(ast::BuiltinType::Uint32));
 }
 
+void Sema::CheckBuiltinOffsetOfCall(ast::CallExpr *call) {
+  if (!CheckArgCount(call, 2)) {
+    return;
+  }
+
+  // The first argument must be a struct type. The second argument is the name of one of its fields, so it is not
+  // resolved like a regular expression.
+  auto *struct_type = Resolve(call->Arguments()[0]);
+  if (struct_type == nullptr) {
+    return;
+  }
+  if (!struct_type->IsStructType()) {
+    GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadArgToOffsetOf, struct_type, 0);
+    return;
+  }
+
+  auto *field = call->Arguments()[1]->SafeAs<ast::IdentifierExpr>();
+  if (field == nullptr) {
+    GetErrorReporter()->Report(call->Position(), ErrorMessages::kBadArgToOffsetOf, struct_type, 1);
+    return;
+  }
+  if (struct_type->As<ast::StructType>()->LookupFieldByName(field->Name()) == nullptr) {
+    GetErrorReporter()->Report(call->Position(), ErrorMessages::kFieldObjectDoesNotExist, field->Name(), struct_type);
+    return;
+  }
+
+  // This call returns an unsigned 32-bit value for the offset of the field
+  call->SetType(GetBuiltinType(ast::BuiltinType::Uint32));
+}
+
 void Sema::CheckBuiltinPtrCastCall(ast::CallExpr *call) {
   if (!CheckArgCount(call, 2)) {
     return;
@@ -1596,6 +1937,20 @@ void Sema::CheckBuiltinSorterIterCall(ast::CallExpr *call, ast::Builtin builtin)
       call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
       break;
     }
+    case ast::Builtin::SorterIterSkipRows: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+
+      // The second argument is the number of rows to skip
+      const auto uint64_kind = ast::BuiltinType::Uint64;
+      if (!args[1]->GetType()->IsSpecificBuiltin(uint64_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(uint64_kind));
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
     case ast::Builtin::SorterIterGetRow: {
       call->SetType(GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
       break;
@@ -1746,7 +2101,10 @@ void Sema::CheckBuiltinIndexIteratorScan(execution::ast::CallExpr *call, ast::Bu
 
   switch (builtin) {
     case ast::Builtin::IndexIteratorScanKey:
-    case ast::Builtin::IndexIteratorScanDescending: {
+    case ast::Builtin::IndexIteratorScanDescending:
+    case ast::Builtin::IndexIteratorScanKeyBatch:
+    case ast::Builtin::IndexIteratorNextBatchKey:
+    case ast::Builtin::IndexIteratorSetKeyOnly: {
       if (!CheckArgCount(call, 1)) return;
       break;
     }
@@ -1816,6 +2174,8 @@ void Sema::CheckBuiltinIndexIteratorPRCall(ast::CallExpr *call, ast::Builtin bui
     case ast::Builtin::IndexIteratorGetLoPR:
     case ast::Builtin::IndexIteratorGetHiPR:
     case ast::Builtin::IndexIteratorGetTablePR:
+    case ast::Builtin::IndexIteratorGetKeyPR:
+    case ast::Builtin::IndexIteratorAddBatchKey:
       call->SetType(GetBuiltinType(ast::BuiltinType::ProjectedRow)->PointerTo());
       break;
     case ast::Builtin::IndexIteratorGetSlot:
@@ -2235,6 +2595,11 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     return;
   }
 
+  if (builtin == ast::Builtin::OffsetOf) {
+    CheckBuiltinOffsetOfCall(call);
+    return;
+  }
+
   // First, resolve all call arguments. If any fail, exit immediately.
   for (auto *arg : call->Arguments()) {
     auto *resolved_type = Resolve(arg);
@@ -2271,8 +2636,12 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     case ast::Builtin::FilterGt:
     case ast::Builtin::FilterLt:
     case ast::Builtin::FilterNe:
-    case ast::Builtin::FilterLe: {
-      CheckBuiltinFilterCall(call);
+    case ast::Builtin::FilterLe:
+    case ast::Builtin::FilterBetween:
+    case ast::Builtin::FilterIn:
+    case ast::Builtin::FilterIsNull:
+    case ast::Builtin::FilterIsNotNull: {
+      CheckBuiltinFilterCall(call, builtin);
       break;
     }
     case ast::Builtin::ExecutionContextGetMemoryPool:
@@ -2294,7 +2663,8 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     case ast::Builtin::TableIterAdvance:
     case ast::Builtin::TableIterReset:
     case ast::Builtin::TableIterGetPCI:
-    case ast::Builtin::TableIterClose: {
+    case ast::Builtin::TableIterClose:
+    case ast::Builtin::TableIterFilterBlocks: {
       CheckBuiltinTableIterCall(call, builtin);
       break;
     }
@@ -2403,6 +2773,21 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       CheckBuiltinJoinHashTableIterClose(call);
       break;
     }
+    case ast::Builtin::JoinHashTablePartIterInit:
+    case ast::Builtin::JoinHashTablePartIterHasNext:
+    case ast::Builtin::JoinHashTablePartIterGetProbeRow:
+    case ast::Builtin::JoinHashTablePartIterGetBuildRow:
+    case ast::Builtin::JoinHashTablePartIterClose: {
+      CheckBuiltinJoinHashTablePartIterCall(call, builtin);
+      break;
+    }
+    case ast::Builtin::JoinHashTableEntryIterInit:
+    case ast::Builtin::JoinHashTableEntryIterHasNext:
+    case ast::Builtin::JoinHashTableEntryIterGetRow:
+    case ast::Builtin::JoinHashTableEntryIterClose: {
+      CheckBuiltinJoinHashTableEntryIterCall(call, builtin);
+      break;
+    }
     case ast::Builtin::JoinHashTableBuild:
     case ast::Builtin::JoinHashTableBuildParallel: {
       CheckBuiltinJoinHashTableBuild(call, builtin);
@@ -2412,6 +2797,15 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       CheckBuiltinJoinHashTableFree(call);
       break;
     }
+    case ast::Builtin::JoinHashTableVectorProbeInit:
+    case ast::Builtin::JoinHashTableVectorProbeAddKey:
+    case ast::Builtin::JoinHashTableVectorProbePrepare:
+    case ast::Builtin::JoinHashTableVectorProbeHasNext:
+    case ast::Builtin::JoinHashTableVectorProbeGetRow:
+    case ast::Builtin::JoinHashTableVectorProbeFree: {
+      CheckBuiltinJoinHashTableVectorProbeCall(call, builtin);
+      break;
+    }
     case ast::Builtin::SorterInit: {
       CheckBuiltinSorterInit(call);
       break;
@@ -2435,6 +2829,7 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     case ast::Builtin::SorterIterInit:
     case ast::Builtin::SorterIterHasNext:
     case ast::Builtin::SorterIterNext:
+    case ast::Builtin::SorterIterSkipRows:
     case ast::Builtin::SorterIterGetRow:
     case ast::Builtin::SorterIterClose: {
       CheckBuiltinSorterIterCall(call, builtin);
@@ -2460,7 +2855,10 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     case ast::Builtin::IndexIteratorScanKey:
     case ast::Builtin::IndexIteratorScanAscending:
     case ast::Builtin::IndexIteratorScanDescending:
-    case ast::Builtin::IndexIteratorScanLimitDescending: {
+    case ast::Builtin::IndexIteratorScanLimitDescending:
+    case ast::Builtin::IndexIteratorScanKeyBatch:
+    case ast::Builtin::IndexIteratorNextBatchKey:
+    case ast::Builtin::IndexIteratorSetKeyOnly: {
       CheckBuiltinIndexIteratorScan(call, builtin);
       break;
     }
@@ -2472,7 +2870,9 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     case ast::Builtin::IndexIteratorGetLoPR:
     case ast::Builtin::IndexIteratorGetHiPR:
     case ast::Builtin::IndexIteratorGetSlot:
-    case ast::Builtin::IndexIteratorGetTablePR: {
+    case ast::Builtin::IndexIteratorGetTablePR:
+    case ast::Builtin::IndexIteratorGetKeyPR:
+    case ast::Builtin::IndexIteratorAddBatchKey: {
       CheckBuiltinIndexIteratorPRCall(call, builtin);
       break;
     }
@@ -154,6 +154,10 @@ bool DDLExecutors::CreateIndex(const common::ManagedPointer<catalog::CatalogAcce
   auto *const index = index_builder.Build();
   bool result UNUSED_ATTRIBUTE = accessor->SetIndexPointer(index_oid, index);
   TERRIER_ASSERT(result, "CreateIndex succeeded, SetIndexPointer must also succeed.");
-  return true;
+  // Populate the index with the table's existing tuples. The catalog now owns the index, so it is freed if we abort.
+  // Transactions already running cannot see the index, so it catches up with their writes once they are done.
+  const auto table_ptr = accessor->GetTable(table);
+  if (table_ptr == nullptr) return true;  // The table has no storage to load from
+  return index->BulkLoad(accessor->GetTxn(), table_ptr, accessor->GetTransactionManager());
 }
 }  // namespace terrier::execution::sql
@@ -1,10 +1,13 @@
 #include "execution/sql/filter_manager.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <utility>
 #include <vector>
 
+#include "common/hash_util.h"
 #include "execution/bandit/agent.h"
 #include "execution/bandit/multi_armed_bandit.h"
 #include "execution/bandit/policy.h"
@@ -42,19 +45,71 @@ std::unique_ptr<bandit::Policy> CreatePolicy(bandit::Policy::Kind policy_kind) {
 
 }  // namespace
 
-FilterManager::FilterManager(const bandit::Policy::Kind policy_kind) : policy_(CreatePolicy(policy_kind)) {}
+// ---------------------------------------------------------
+// Clause statistics
+// ---------------------------------------------------------
 
-FilterManager::~FilterManager() = default;
+double FilterManager::ClauseStats::Rank() const {
+  if (num_observations_ == 0) {
+    return std::numeric_limits<double>::lowest();
+  }
+  if (selectivity_ >= 1.0) {
+    return std::numeric_limits<double>::max();
+  }
+  return cost_per_tuple_ / (1.0 - selectivity_);
+}
+
+// ---------------------------------------------------------
+// Stats cache
+// ---------------------------------------------------------
+
+bool FilterManager::StatsCache::Lookup(const uint64_t key, LearnedState *state) const {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
+  auto iter = plans_.find(key);
+  if (iter == plans_.end()) {
+    return false;
+  }
+  *state = iter->second;
+  return true;
+}
+
+void FilterManager::StatsCache::Insert(const uint64_t key, LearnedState &&state) {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
+  if (plans_.size() >= K_DEFAULT_CAPACITY && plans_.count(key) == 0) {
+    plans_.erase(plans_.begin());
+  }
+  plans_[key] = std::move(state);
+}
+
+void FilterManager::StatsCache::Clear() {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
+  plans_.clear();
+}
+
+uint32_t FilterManager::StatsCache::NumPlans() const {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
+  return static_cast<uint32_t>(plans_.size());
+}
+
+// ---------------------------------------------------------
+// Filter manager
+// ---------------------------------------------------------
+
+FilterManager::FilterManager(const bandit::Policy::Kind policy_kind, StatsCache *stats_cache)
+    : policy_(CreatePolicy(policy_kind)), stats_cache_(stats_cache) {}
+
+FilterManager::~FilterManager() { SaveLearnedState(); }
 
 void FilterManager::StartNewClause() {
   TERRIER_ASSERT(!finalized_, "Cannot modify filter manager after finalization");
   clauses_.emplace_back();
 }
 
-void FilterManager::InsertClauseFlavor(const FilterManager::MatchFn flavor) {
+void FilterManager::InsertClauseFlavor(const FilterManager::MatchFn flavor, const uint64_t flavor_id) {
   TERRIER_ASSERT(!finalized_, "Cannot modify filter manager after finalization");
   TERRIER_ASSERT(!clauses_.empty(), "Inserting flavor without clause");
   clauses_.back().flavors_.push_back(flavor);
+  clauses_.back().flavor_ids_.push_back(flavor_id);
 }
 
 void FilterManager::Finalize() {
@@ -71,6 +126,10 @@ void FilterManager::Finalize() {
   for (uint32_t idx = 0; idx < clauses_.size(); idx++) {
     agents_.emplace_back(policy_.get(), ClauseAt(idx)->NumFlavors());
   }
+  clause_stats_.resize(clauses_.size());
+
+  // Start from what previous executions of this plan learned
+  RestoreLearnedState();
 
   finalized_ = true;
 }
@@ -80,11 +139,25 @@ void FilterManager::RunFilters(ProjectedColumnsIterator *const pci) {
 
   // Execute the clauses in what we currently believe to be the optimal order
   for (const uint32_t opt_clause_idx : optimal_clause_order_) {
-    RunFilterClause(pci, opt_clause_idx);
+    const uint32_t num_input = pci->NumSelected();
+    if (num_input == 0) {
+      // Nothing left to filter, the remaining clauses are no-ops
+      break;
+    }
+    RunFilterClause(pci, opt_clause_idx, num_input);
   }
+
+  // Use what we learned on this vector to order the clauses for the next one
+  ReorderClauses();
+}
+
+void FilterManager::ReorderClauses() {
+  std::stable_sort(optimal_clause_order_.begin(), optimal_clause_order_.end(),
+                   [this](uint32_t l, uint32_t r) { return clause_stats_[l].Rank() < clause_stats_[r].Rank(); });
 }
 
-void FilterManager::RunFilterClause(ProjectedColumnsIterator *const pci, const uint32_t clause_index) {
+void FilterManager::RunFilterClause(ProjectedColumnsIterator *const pci, const uint32_t clause_index,
+                                    const uint32_t num_input) {
   //
   // This function will execute the clause at the given clause index. But, we'll
   // be smart about it. We'll use our multi-armed bandit agent to predict the
@@ -102,14 +175,25 @@ void FilterManager::RunFilterClause(ProjectedColumnsIterator *const pci, const u
   const auto opt_match_func = ClauseAt(clause_index)->flavors_[opt_flavor_idx];
 
   // Run the filter
-  // NOLINTNEXTLINE
-  auto [_, exec_ms] = RunFilterClauseImpl(pci, opt_match_func);
-  (void)_;
+  auto [num_selected, exec_ms] = RunFilterClauseImpl(pci, opt_match_func);
 
   // Update the agent's state
   double reward = bandit::MultiArmedBandit::ExecutionTimeToReward(exec_ms);
   agent->Observe(reward);
   EXECUTION_LOG_DEBUG("Clause {} observed reward {}", clause_index, reward);
+
+  // Update the clause's statistics
+  const double selectivity = static_cast<double>(num_selected) / num_input;
+  const double cost_per_tuple = exec_ms * 1e6 / num_input;
+  ClauseStats *stats = &clause_stats_[clause_index];
+  if (stats->num_observations_ == 0) {
+    stats->selectivity_ = selectivity;
+    stats->cost_per_tuple_ = cost_per_tuple;
+  } else {
+    stats->selectivity_ += K_STATS_DECAY * (selectivity - stats->selectivity_);
+    stats->cost_per_tuple_ += K_STATS_DECAY * (cost_per_tuple - stats->cost_per_tuple_);
+  }
+  stats->num_observations_++;
 }
 
 std::pair<uint32_t, double> FilterManager::RunFilterClauseImpl(ProjectedColumnsIterator *const pci,
@@ -128,6 +212,65 @@ uint32_t FilterManager::GetOptimalFlavorForClause(const uint32_t clause_index) c
   return agent->GetCurrentOptimalAction();
 }
 
+uint64_t FilterManager::PlanKey() const {
+  // The addresses of the flavors change whenever the plan is compiled, and may be reused by another plan once it is
+  // freed, so the plan is identified by the identities of its flavors instead
+  common::hash_t key = common::HashUtil::Hash(clauses_.size());
+  for (const auto &clause : clauses_) {
+    key = common::HashUtil::CombineHashes(key, common::HashUtil::Hash(clause.NumFlavors()));
+    for (const auto flavor_id : clause.flavor_ids_) {
+      key = common::HashUtil::CombineHashes(key, common::HashUtil::Hash(flavor_id));
+    }
+  }
+  return key;
+}
+
+void FilterManager::RestoreLearnedState() {
+  LearnedState state;
+  if (stats_cache_ == nullptr || !stats_cache_->Lookup(PlanKey(), &state)) {
+    return;
+  }
+
+  // Guard against hash collisions with a plan of a different shape
+  if (state.clause_order_.size() != clauses_.size()) {
+    return;
+  }
+  for (uint32_t idx = 0; idx < clauses_.size(); idx++) {
+    if (state.value_estimates_[idx].size() != ClauseAt(idx)->NumFlavors()) {
+      return;
+    }
+  }
+
+  optimal_clause_order_ = std::move(state.clause_order_);
+  clause_stats_ = std::move(state.clause_stats_);
+  for (uint32_t idx = 0; idx < clauses_.size(); idx++) {
+    agents_[idx].Restore(state.value_estimates_[idx], state.action_attempts_[idx], state.time_steps_[idx]);
+  }
+}
+
+void FilterManager::SaveLearnedState() {
+  if (stats_cache_ == nullptr || !finalized_) {
+    return;
+  }
+
+  // Don't overwrite a useful state with one that never ran
+  const bool observed = std::any_of(clause_stats_.begin(), clause_stats_.end(),
+                                    [](const ClauseStats &stats) { return stats.num_observations_ > 0; });
+  if (!observed) {
+    return;
+  }
+
+  LearnedState state;
+  state.clause_order_ = optimal_clause_order_;
+  state.clause_stats_ = clause_stats_;
+  for (const auto &agent : agents_) {
+    state.value_estimates_.push_back(agent.ValueEstimates());
+    state.action_attempts_.push_back(agent.ActionAttempts());
+    state.time_steps_.push_back(agent.TimeStep());
+  }
+  stats_cache_->Insert(PlanKey(), std::move(state));
+}
+
 bandit::Agent *FilterManager::GetAgentFor(const uint32_t clause_index) { return &agents_[clause_index]; }
 
 const bandit::Agent *FilterManager::GetAgentFor(const uint32_t clause_index) const { return &agents_[clause_index]; }
@@ -1,4 +1,8 @@
 #include "execution/sql/index_iterator.h"
+
+#include <memory>
+#include <utility>
+
 #include "execution/sql/value.h"
 
 namespace terrier::execution::sql {
@@ -28,51 +32,113 @@ void IndexIterator::Init() {
   hi_index_pr_ = index_pri.InitializeRow(hi_index_buffer_);
 }
 
+void IndexIterator::OpenCursor(std::unique_ptr<storage::index::Index::Cursor> cursor) {
+  cursor_ = std::move(cursor);
+  curr_tuples_ = tuples_.data();
+  curr_index_ = 0;
+  num_tuples_ = 0;
+  keys_match_search_key_ = false;
+  if (key_only_) {
+    cursor_->KeepKeys();
+    if (key_buffer_ == nullptr) {
+      auto &index_pri = index_->GetProjectedRowInitializer();
+      key_buffer_ =
+          exec_ctx_->GetMemoryPool()->AllocateAligned(index_pri.ProjectedRowSize(), alignof(uint64_t), false);
+      key_pr_ = index_pri.InitializeRow(key_buffer_);
+    }
+  }
+}
+
 void IndexIterator::ScanKey() {
   // Scan the index
-  tuples_.clear();
+  OpenCursor(index_->OpenScanKey(*exec_ctx_->GetTxn(), *index_pr_));
+  // Point lookups can hand out the search key itself, there is nothing to decode
+  keys_match_search_key_ = true;
+  search_key_pr_ = index_pr_;
+}
+
+storage::ProjectedRow *IndexIterator::AddBatchKey() {
+  if (num_batch_keys_ == batch_keys_.size()) {
+    auto &index_pri = index_->GetProjectedRowInitializer();
+    void *const buffer =
+        exec_ctx_->GetMemoryPool()->AllocateAligned(index_pri.ProjectedRowSize(), alignof(uint64_t), false);
+    batch_key_buffers_.emplace_back(buffer);
+    batch_keys_.emplace_back(index_pri.InitializeRow(buffer));
+  }
+  return batch_keys_[num_batch_keys_++];
+}
+
+void IndexIterator::ScanKeyBatch() {
+  batch_tuples_.clear();
+  index_->ScanKeyBatch(*exec_ctx_->GetTxn(), batch_keys_.data(), num_batch_keys_, &batch_tuples_, &batch_offsets_);
+  next_batch_key_ = 0;
+  num_batch_keys_ = 0;
+}
+
+void IndexIterator::NextBatchKey() {
+  TERRIER_ASSERT(next_batch_key_ + 1 < batch_offsets_.size(), "Every key of the batch was already visited.");
+  cursor_.reset();
+  curr_tuples_ = batch_tuples_.data() + batch_offsets_[next_batch_key_];
   curr_index_ = 0;
-  index_->ScanKey(*exec_ctx_->GetTxn(), *index_pr_, &tuples_);
+  num_tuples_ = batch_offsets_[next_batch_key_ + 1] - batch_offsets_[next_batch_key_];
+  keys_match_search_key_ = true;
+  search_key_pr_ = batch_keys_[next_batch_key_];
+  next_batch_key_++;
 }
 
 void IndexIterator::ScanAscending(storage::index::ScanType scan_type, uint32_t limit) {
   // Scan the index
-  tuples_.clear();
-  curr_index_ = 0;
-  index_->ScanAscending(*exec_ctx_->GetTxn(), scan_type, num_attrs_, index_pr_, hi_index_pr_, limit, &tuples_);
+  OpenCursor(index_->OpenScanAscending(*exec_ctx_->GetTxn(), scan_type, num_attrs_, index_pr_, hi_index_pr_, limit));
 }
 
 void IndexIterator::ScanDescending() {
   // Scan the index
-  tuples_.clear();
-  curr_index_ = 0;
-  index_->ScanDescending(*exec_ctx_->GetTxn(), *index_pr_, *hi_index_pr_, &tuples_);
+  OpenCursor(index_->OpenScanDescending(*exec_ctx_->GetTxn(), *index_pr_, *hi_index_pr_, 0));
 }
 
 void IndexIterator::ScanLimitDescending(uint32_t limit) {
   // Scan the index
-  tuples_.clear();
-  curr_index_ = 0;
-  index_->ScanLimitDescending(*exec_ctx_->GetTxn(), *index_pr_, *hi_index_pr_, &tuples_, limit);
+  OpenCursor(index_->OpenScanDescending(*exec_ctx_->GetTxn(), *index_pr_, *hi_index_pr_, limit));
 }
 
 bool IndexIterator::Advance() {
-  if (curr_index_ < tuples_.size()) {
+  if (curr_index_ < num_tuples_) {
     ++curr_index_;
     return true;
   }
-  return false;
+  if (cursor_ == nullptr) return false;
+
+  // Current batch is used up, pull the next one out of the index
+  curr_index_ = 0;
+  num_tuples_ = cursor_->Next(tuples_.data(), K_BATCH_SIZE);
+  if (num_tuples_ == 0) {
+    cursor_.reset();
+    return false;
+  }
+  ++curr_index_;
+  return true;
 }
 
 storage::ProjectedRow *IndexIterator::TablePR() {
-  table_->Select(exec_ctx_->GetTxn(), tuples_[curr_index_ - 1], table_pr_);
+  table_->Select(exec_ctx_->GetTxn(), CurrentSlot(), table_pr_);
   return table_pr_;
 }
 
+storage::ProjectedRow *IndexIterator::KeyPR() {
+  TERRIER_ASSERT(key_only_, "KeyPR is only available for index-only scans.");
+  if (keys_match_search_key_) return search_key_pr_;
+  cursor_->CopyKey(curr_index_ - 1, key_pr_);
+  return key_pr_;
+}
+
 IndexIterator::~IndexIterator() {
   // Free allocated buffers
   exec_ctx_->GetMemoryPool()->Deallocate(table_buffer_, table_pr_->Size());
   exec_ctx_->GetMemoryPool()->Deallocate(index_buffer_, index_pr_->Size());
   exec_ctx_->GetMemoryPool()->Deallocate(hi_index_buffer_, hi_index_pr_->Size());
+  if (key_buffer_ != nullptr) exec_ctx_->GetMemoryPool()->Deallocate(key_buffer_, key_pr_->Size());
+  for (uint32_t i = 0; i < batch_keys_.size(); i++) {
+    exec_ctx_->GetMemoryPool()->Deallocate(batch_key_buffers_[i], batch_keys_[i]->Size());
+  }
 }
 }  // namespace terrier::execution::sql
@@ -3,7 +3,9 @@
 #include <tbb/tbb.h>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -17,16 +19,26 @@
 
 namespace terrier::execution::sql {
 
-JoinHashTable::JoinHashTable(MemoryPool *memory, uint32_t tuple_size, bool use_concise_ht)
+JoinHashTable::JoinHashTable(MemoryPool *memory, uint32_t tuple_size, bool use_concise_ht,
+                             bool use_partitioned_build)
     : entries_(sizeof(HashTableEntry) + tuple_size, MemoryPoolAllocator<byte>(memory)),
       owned_(memory),
+      memory_(memory),
+      partitioned_entries_(nullptr),
+      num_partitioned_entries_(0),
+      partition_offsets_(memory),
       concise_hash_table_(0),
       hll_estimator_(libcount::HLL::Create(K_DEFAULT_HLL_PRECISION)),
       built_(false),
-      use_concise_ht_(use_concise_ht) {}
+      use_concise_ht_(use_concise_ht),
+      use_partitioned_build_(use_partitioned_build),
+      radix_bits_(0) {}
 
-// Needed because we forward-declared HLL from libcount
-JoinHashTable::~JoinHashTable() = default;
+JoinHashTable::~JoinHashTable() {
+  if (partitioned_entries_ != nullptr) {
+    memory_->Deallocate(partitioned_entries_, num_partitioned_entries_ * entries_.ElementSize());
+  }
+}
 
 byte *JoinHashTable::AllocInputTuple(const hash_t hash) {
   // Add to unique_count estimation
@@ -73,6 +85,233 @@ void JoinHashTable::BuildGenericHashTable() noexcept {
   }
 }
 
+// ---------------------------------------------------------
+// Partitioned hash tables
+// ---------------------------------------------------------
+
+namespace {
+
+// The partition of a hash value on the 'bits' hash bits that follow its top
+// 'skip' bits
+ALWAYS_INLINE inline uint64_t RadixOf(const hash_t hash, const uint32_t skip, const uint32_t bits) {
+  return bits == 0 ? 0 : (hash << skip) >> (sizeof(hash_t) * 8 - bits);
+}
+
+/**
+ * Scatters entries into their partitions through software write-combining
+ * buffers. Entries are staged in a small per-partition buffer and written out
+ * a full buffer at a time, so a large fan-out writes whole cache lines and
+ * touches few pages at once.
+ */
+class PartitionScatter {
+ public:
+  // The bytes each partition stages before they're written out
+  static constexpr const uint64_t K_STAGING_BYTES_PER_PARTITION = 4 * common::Constants::CACHELINE_SIZE;
+
+  PartitionScatter(uint64_t entry_size, uint64_t num_partitions, byte *output, uint64_t write_idx[])
+      : entry_size_(entry_size),
+        capacity_(std::max(uint64_t{1}, K_STAGING_BYTES_PER_PARTITION / entry_size)),
+        staging_(new byte[num_partitions * capacity_ * entry_size]),
+        counts_(num_partitions, 0),
+        output_(output),
+        write_idx_(write_idx) {}
+
+  /**
+   * This class cannot be copied or moved
+   */
+  DISALLOW_COPY_AND_MOVE(PartitionScatter);
+
+  /**
+   * Write the entry @em entry to the partition @em part
+   */
+  void Add(const uint64_t part, const byte *entry) {
+    std::memcpy(StagingFor(part) + counts_[part] * entry_size_, entry, entry_size_);
+    if (++counts_[part] == capacity_) {
+      Flush(part);
+    }
+  }
+
+  /**
+   * Write out all staged entries
+   */
+  void FlushAll() {
+    for (uint64_t part = 0; part < counts_.size(); part++) {
+      Flush(part);
+    }
+  }
+
+ private:
+  byte *StagingFor(const uint64_t part) const { return staging_.get() + part * capacity_ * entry_size_; }
+
+  void Flush(const uint64_t part) {
+    std::memcpy(output_ + write_idx_[part] * entry_size_, StagingFor(part), counts_[part] * entry_size_);
+    write_idx_[part] += counts_[part];
+    counts_[part] = 0;
+  }
+
+ private:
+  // The size of the entries
+  const uint64_t entry_size_;
+  // The number of entries each partition stages
+  const uint64_t capacity_;
+  // The staging buffers of all partitions
+  std::unique_ptr<byte[]> staging_;
+  // The number of entries staged per partition
+  std::vector<uint64_t> counts_;
+  // Where the partitions are written, and the index of the next entry written
+  // to each partition
+  byte *const output_;
+  uint64_t *const write_idx_;
+};
+
+}  // namespace
+
+void JoinHashTable::PartitionEntries(const uint32_t radix_bits) {
+  TERRIER_ASSERT(partitioned_entries_ == nullptr, "Entries have already been partitioned");
+  TERRIER_ASSERT(radix_bits <= 2 * K_MAX_RADIX_BITS_PER_PASS, "Too many radix bits for two partitioning passes");
+
+  // All entries: ours, and those taken over from thread-local tables
+  std::vector<decltype(entries_) *> sources{&entries_};
+  for (auto &owned : owned_) {
+    sources.push_back(&owned);
+  }
+  uint64_t num_entries = 0;
+  for (const auto *source : sources) {
+    num_entries += source->size();
+  }
+
+  const uint64_t entry_size = entries_.ElementSize();
+  const uint32_t pass1_bits = std::min(radix_bits, K_MAX_RADIX_BITS_PER_PASS);
+  const uint32_t pass2_bits = radix_bits - pass1_bits;
+  const uint64_t num_pass1_parts = uint64_t{1} << pass1_bits;
+
+  radix_bits_ = radix_bits;
+  num_partitioned_entries_ = num_entries;
+  partitioned_entries_ = static_cast<byte *>(memory_->AllocateAligned(
+      std::max(uint64_t{1}, num_entries * entry_size), common::Constants::CACHELINE_SIZE, false));
+  partition_offsets_.assign(NumPartitions() + 1, 0);
+
+  // With two passes, the first pass writes into a temporary buffer and the
+  // second into the final one
+  byte *const pass1_output =
+      pass2_bits == 0 ? partitioned_entries_
+                      : static_cast<byte *>(memory_->AllocateAligned(std::max(uint64_t{1}, num_entries * entry_size),
+                                                                     common::Constants::CACHELINE_SIZE, false));
+
+  tbb::task_scheduler_init sched;
+
+  //
+  // Pass 1: histogram each source on the top bits. Each source then scatters
+  // into its own slice of every partition, so sources proceed in parallel.
+  //
+
+  std::vector<std::vector<uint64_t>> write_idx(sources.size(), std::vector<uint64_t>(num_pass1_parts, 0));
+  tbb::parallel_for(std::size_t{0}, sources.size(), [&](const std::size_t src) {
+    const auto &source = *sources[src];
+    for (uint64_t idx = 0; idx < source.size(); idx++) {
+      const auto *entry = reinterpret_cast<const HashTableEntry *>(source[idx]);
+      write_idx[src][RadixOf(entry->hash_, 0, pass1_bits)]++;
+    }
+  });
+
+  std::vector<uint64_t> pass1_offsets(num_pass1_parts + 1, 0);
+  for (uint64_t part = 0, offset = 0; part < num_pass1_parts; part++) {
+    pass1_offsets[part] = offset;
+    for (auto &source_write_idx : write_idx) {
+      const uint64_t count = source_write_idx[part];
+      source_write_idx[part] = offset;
+      offset += count;
+    }
+  }
+  pass1_offsets[num_pass1_parts] = num_entries;
+
+  tbb::parallel_for(std::size_t{0}, sources.size(), [&](const std::size_t src) {
+    const auto &source = *sources[src];
+    PartitionScatter scatter(entry_size, num_pass1_parts, pass1_output, write_idx[src].data());
+    for (uint64_t idx = 0; idx < source.size(); idx++) {
+      const byte *entry = source[idx];
+      scatter.Add(RadixOf(reinterpret_cast<const HashTableEntry *>(entry)->hash_, 0, pass1_bits), entry);
+    }
+    scatter.FlushAll();
+  });
+
+  if (pass2_bits == 0) {
+    std::copy(pass1_offsets.begin(), pass1_offsets.end(), partition_offsets_.begin());
+    return;
+  }
+
+  //
+  // Pass 2: split every first-pass partition on the following bits. The
+  // partitions are independent, and are processed in parallel.
+  //
+
+  const uint64_t num_pass2_parts = uint64_t{1} << pass2_bits;
+  tbb::parallel_for(uint64_t{0}, num_pass1_parts, [&](const uint64_t pass1_part) {
+    const uint64_t begin = pass1_offsets[pass1_part], end = pass1_offsets[pass1_part + 1];
+    std::vector<uint64_t> part_write_idx(num_pass2_parts, 0);
+    for (uint64_t idx = begin; idx < end; idx++) {
+      const auto *entry = reinterpret_cast<const HashTableEntry *>(pass1_output + idx * entry_size);
+      part_write_idx[RadixOf(entry->hash_, pass1_bits, pass2_bits)]++;
+    }
+
+    for (uint64_t part = 0, offset = begin; part < num_pass2_parts; part++) {
+      const uint64_t count = part_write_idx[part];
+      part_write_idx[part] = offset;
+      partition_offsets_[(pass1_part << pass2_bits) + part] = offset;
+      offset += count;
+    }
+
+    PartitionScatter scatter(entry_size, num_pass2_parts, partitioned_entries_, part_write_idx.data());
+    for (uint64_t idx = begin; idx < end; idx++) {
+      const byte *entry = pass1_output + idx * entry_size;
+      scatter.Add(RadixOf(reinterpret_cast<const HashTableEntry *>(entry)->hash_, pass1_bits, pass2_bits), entry);
+    }
+    scatter.FlushAll();
+  });
+  partition_offsets_[NumPartitions()] = num_entries;
+
+  memory_->Deallocate(pass1_output, std::max(uint64_t{1}, num_entries * entry_size));
+}
+
+void JoinHashTable::BuildPartitionedHashTable() {
+  uint64_t num_entries = entries_.size();
+  for (const auto &owned : owned_) {
+    num_entries += owned.size();
+  }
+
+  // Split the input until the tuples and directory of every partition fit in
+  // the L2 cache. Assume a directory of two pointers per entry.
+  const uint64_t l2_cache_size = CpuInfo::Instance()->GetCacheSize(CpuInfo::L2_CACHE);
+  const uint64_t total_size = num_entries * (entries_.ElementSize() + 2 * sizeof(HashTableEntry *));
+  uint32_t radix_bits = 0;
+  while (radix_bits < K_MAX_RADIX_BITS && (total_size >> radix_bits) > l2_cache_size) {
+    radix_bits++;
+  }
+
+  // A table that already fits in cache gains nothing from partitioning
+  if (radix_bits == 0 && owned_.empty()) {
+    BuildGenericHashTable();
+    return;
+  }
+
+  PartitionEntries(radix_bits);
+
+  // Build the table of every partition in parallel
+  partition_tables_ = std::make_unique<GenericHashTable[]>(NumPartitions());
+  tbb::task_scheduler_init sched;
+  tbb::parallel_for(uint64_t{0}, NumPartitions(), [this](const uint64_t part) {
+    const uint64_t begin = partition_offsets_[part], end = partition_offsets_[part + 1];
+    GenericHashTable &table = partition_tables_[part];
+    table.SetSize(std::max(uint64_t{1}, end - begin));
+    for (uint64_t idx = begin; idx < end; idx++) {
+      HashTableEntry *entry = PartitionedEntryAt(idx);
+      table.Insert<false>(entry, entry->hash_);
+    }
+  });
+
+  EXECUTION_LOG_DEBUG("JHT: partitioned {} tuples on {} bits", num_entries, radix_bits);
+}
+
 // ---------------------------------------------------------
 // Concise hash tables
 // ---------------------------------------------------------
@@ -580,7 +819,9 @@ void JoinHashTable::Build() {
   timer.Start();
 
   // Build
-  if (UseConciseHashTable()) {
+  if (UsePartitionedBuild()) {
+    BuildPartitionedHashTable();
+  } else if (UseConciseHashTable()) {
     BuildConciseHashTable();
   } else {
     BuildGenericHashTable();
@@ -622,6 +863,18 @@ void JoinHashTable::LookupBatchInGenericHashTable(uint32_t num_tuples, const has
   }
 }
 
+void JoinHashTable::LookupBatchInPartitionedHashTable(uint32_t num_tuples, const hash_t hashes[],
+                                                      const HashTableEntry *results[]) const {
+  // Every partition's table fits in cache, but the batch spans all partitions
+  for (uint32_t idx = 0, prefetch_idx = common::Constants::K_PREFETCH_DISTANCE; idx < num_tuples;
+       idx++, prefetch_idx++) {
+    if (LIKELY(prefetch_idx < num_tuples)) {
+      PartitionTable(PartitionOf(hashes[prefetch_idx])).PrefetchChainHead<true>(hashes[prefetch_idx]);
+    }
+    results[idx] = PartitionTable(PartitionOf(hashes[idx])).FindChainHead(hashes[idx]);
+  }
+}
+
 template <bool Prefetch>
 void JoinHashTable::LookupBatchInConciseHashTableInternal(uint32_t num_tuples, const hash_t hashes[],
                                                           const HashTableEntry *results[]) const {
@@ -652,7 +905,9 @@ void JoinHashTable::LookupBatchInConciseHashTable(uint32_t num_tuples, const has
 void JoinHashTable::LookupBatch(uint32_t num_tuples, const hash_t hashes[], const HashTableEntry *results[]) const {
   TERRIER_ASSERT(IsBuilt(), "Cannot perform lookup before table is built!");
 
-  if (UseConciseHashTable()) {
+  if (partition_tables_ != nullptr) {
+    LookupBatchInPartitionedHashTable(num_tuples, hashes, results);
+  } else if (UseConciseHashTable()) {
     LookupBatchInConciseHashTable(num_tuples, hashes, results);
   } else {
     LookupBatchInGenericHashTable(num_tuples, hashes, results);
@@ -699,6 +954,17 @@ void JoinHashTable::MergeParallel(const ThreadStateContainer *thread_state_conta
   uint64_t num_elem_estimate = hll_estimator_->Estimate();
   EXECUTION_LOG_DEBUG("Global unique count: {}", num_elem_estimate);
 
+  // A partitioned build takes over all thread-local entries and partitions
+  // them together, in parallel
+  if (UsePartitionedBuild()) {
+    owned_.reserve(tl_join_tables.size());
+    for (auto *source : tl_join_tables) {
+      owned_.emplace_back(std::move(source->entries_));
+    }
+    BuildPartitionedHashTable();
+    return;
+  }
+
   // Set size
   generic_hash_table_.SetSize(num_elem_estimate);
 
@@ -722,4 +988,77 @@ void JoinHashTable::MergeParallel(const ThreadStateContainer *thread_state_conta
   });
 }
 
+// ---------------------------------------------------------
+// Partitioned join iterator
+// ---------------------------------------------------------
+
+JoinHashTablePartitionIterator::JoinHashTablePartitionIterator(const JoinHashTable &build_table,
+                                                               JoinHashTable *probe_table)
+    : build_table_(build_table),
+      probe_table_(*probe_table),
+      part_(0),
+      next_probe_idx_(0),
+      probe_entry_(nullptr),
+      build_next_(nullptr),
+      build_match_(nullptr) {
+  TERRIER_ASSERT(build_table.IsBuilt(), "The build side must be built before probing");
+  probe_table->PartitionEntries(build_table.NumRadixBits());
+}
+
+bool JoinHashTablePartitionIterator::HasNext(const KeyEq key_eq, void *const opaque_ctx) {
+  while (true) {
+    // Continue along the bucket chain of the current probe tuple
+    while (build_next_ != nullptr) {
+      const HashTableEntry *candidate = build_next_;
+      build_next_ = build_next_->next_;
+      if (candidate->hash_ == probe_entry_->hash_ &&
+          key_eq(opaque_ctx, const_cast<byte *>(probe_entry_->payload_), const_cast<byte *>(candidate->payload_))) {
+        build_match_ = candidate;
+        return true;
+      }
+    }
+
+    // Move to the next probe tuple, and to the partition it belongs to
+    if (next_probe_idx_ == probe_table_.num_partitioned_entries_) {
+      return false;
+    }
+    while (next_probe_idx_ >= probe_table_.partition_offsets_[part_ + 1]) {
+      part_++;
+    }
+    probe_entry_ = probe_table_.PartitionedEntryAt(next_probe_idx_++);
+    build_next_ = build_table_.PartitionTable(part_).FindChainHead(probe_entry_->hash_);
+  }
+}
+
+// ---------------------------------------------------------
+// Entry iterator
+// ---------------------------------------------------------
+
+JoinHashTableEntryIterator::JoinHashTableEntryIterator(const JoinHashTable &table)
+    : table_(table), vector_idx_(0), next_idx_(0), entry_(nullptr) {}
+
+bool JoinHashTableEntryIterator::HasNext() {
+  if (table_.partitioned_entries_ != nullptr) {
+    if (next_idx_ == table_.num_partitioned_entries_) {
+      return false;
+    }
+    entry_ = table_.PartitionedEntryAt(next_idx_++);
+    return true;
+  }
+
+  // The table's own entries come first, then those taken over from other tables
+  while (true) {
+    const auto &entries = vector_idx_ == 0 ? table_.entries_ : table_.owned_[vector_idx_ - 1];
+    if (next_idx_ < entries.size()) {
+      entry_ = reinterpret_cast<const HashTableEntry *>(entries[next_idx_++]);
+      return true;
+    }
+    if (vector_idx_ == table_.owned_.size()) {
+      return false;
+    }
+    vector_idx_++;
+    next_idx_ = 0;
+  }
+}
+
 }  // namespace terrier::execution::sql
@@ -1,7 +1,12 @@
 #include "execution/sql/join_hash_table_vector_probe.h"
 #include "execution/sql/projected_columns_iterator.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "execution/sql/join_hash_table.h"
+#include "execution/sql/value.h"
+#include "execution/util/hash.h"
 
 namespace terrier::execution::sql {
 
@@ -33,4 +38,115 @@ void JoinHashTableVectorProbe::Prepare(ProjectedColumnsIterator *pci, const Hash
   table_.LookupBatch(pci->NumSelected(), hashes_, entries_);
 }
 
+void JoinHashTableVectorProbe::AddKey(const uint32_t col_idx, const type::TypeId type, const uint32_t build_offset) {
+  TERRIER_ASSERT(IsSupportedKeyType(type), "Key type cannot be probed column-wise");
+  keys_.push_back(Key{col_idx, type, build_offset,
+                      std::make_unique<KeyVal[]>(common::Constants::K_DEFAULT_VECTOR_SIZE),
+                      std::make_unique<bool[]>(common::Constants::K_DEFAULT_VECTOR_SIZE)});
+}
+
+template <typename T>
+void JoinHashTableVectorProbe::HashKeyColumn(ProjectedColumnsIterator *pci, Key *key) {
+  // Widen the value the way the SQL value would, so that the hashes agree with those computed by @hash() on the build
+  // side. NULLs hash to zero.
+  using WideType = std::conditional_t<std::is_floating_point_v<T>, double, int64_t>;
+  uint32_t idx = 0;
+  pci->ForEach([&]() {
+    bool null = false;
+    const auto val = static_cast<WideType>(*pci->Get<T, true>(key->col_idx_, &null));
+    if constexpr (std::is_floating_point_v<T>) {
+      key->vals_[idx].real_ = val;
+    } else {  // NOLINT
+      key->vals_[idx].int_ = val;
+    }
+    key->nulls_[idx] = null;
+    const hash_t hash = null ? 0 : util::Hasher::Hash<util::HashMethod::Crc>(val);
+    hashes_[idx] = util::Hasher::CombineHashes(hashes_[idx], hash);
+    idx++;
+  });
+}
+
+template <typename ValType>
+void JoinHashTableVectorProbe::FilterMatches(const Key &key) {
+  uint32_t num_matches = 0;
+  for (const auto &match : matches_) {
+    const auto *build_val = reinterpret_cast<const ValType *>(match.entry_->payload_ + key.build_offset_);
+    bool equal;
+    if constexpr (std::is_same_v<ValType, Real>) {
+      equal = build_val->val_ == key.vals_[match.probe_idx_].real_;
+    } else {  // NOLINT
+      equal = build_val->val_ == key.vals_[match.probe_idx_].int_;
+    }
+    matches_[num_matches] = match;
+    num_matches += static_cast<uint32_t>(equal && !build_val->is_null_ && !key.nulls_[match.probe_idx_]);
+  }
+  matches_.resize(num_matches);
+}
+
+void JoinHashTableVectorProbe::Prepare(ProjectedColumnsIterator *pci) {
+  TERRIER_ASSERT(pci->NumSelected() <= common::Constants::K_DEFAULT_VECTOR_SIZE,
+                 "ProjectedColumns size must be less than common::Constants::K_DEFAULT_VECTOR_SIZE");
+  TERRIER_ASSERT(!keys_.empty(), "Column-wise probes need at least one key");
+  const uint32_t num_probes = pci->NumSelected();
+
+  // Hash the batch a key column at a time. This matches @hash(), which starts from one.
+  std::fill(hashes_, hashes_ + num_probes, hash_t{1});
+  for (auto &key : keys_) {
+    switch (key.type_) {
+      case type::TypeId::TINYINT:
+        HashKeyColumn<int8_t>(pci, &key);
+        break;
+      case type::TypeId::SMALLINT:
+        HashKeyColumn<int16_t>(pci, &key);
+        break;
+      case type::TypeId::INTEGER:
+        HashKeyColumn<int32_t>(pci, &key);
+        break;
+      case type::TypeId::BIGINT:
+        HashKeyColumn<int64_t>(pci, &key);
+        break;
+      case type::TypeId::DECIMAL:
+        HashKeyColumn<double>(pci, &key);
+        break;
+      default:
+        UNREACHABLE("Key type cannot be probed column-wise");
+    }
+  }
+
+  // Find all chain heads at once, then collect every entry with a matching hash
+  table_.LookupBatch(num_probes, hashes_, entries_);
+  matches_.clear();
+  for (uint32_t idx = 0; idx < num_probes; idx++) {
+    for (const auto *entry = entries_[idx]; entry != nullptr; entry = entry->next_) {
+      if (entry->hash_ == hashes_[idx]) {
+        matches_.push_back(Match{idx, entry});
+      }
+    }
+  }
+
+  // Compare the keys of the candidates a column at a time
+  for (const auto &key : keys_) {
+    if (key.type_ == type::TypeId::DECIMAL) {
+      FilterMatches<Real>(key);
+    } else {
+      FilterMatches<Integer>(key);
+    }
+  }
+
+  match_idx_ = 0;
+}
+
+bool JoinHashTableVectorProbe::HasNextMatch(ProjectedColumnsIterator *pci) {
+  if (match_idx_ >= matches_.size()) {
+    return false;
+  }
+  const uint32_t probe_idx = matches_[match_idx_++].probe_idx_;
+  if (pci->IsFiltered()) {
+    pci->SetPosition<true>(probe_idx);
+  } else {
+    pci->SetPosition<false>(probe_idx);
+  }
+  return true;
+}
+
 }  // namespace terrier::execution::sql
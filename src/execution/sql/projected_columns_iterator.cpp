@@ -1,4 +1,12 @@
 #include "execution/sql/projected_columns_iterator.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 #include "execution/util/vector_util.h"
 #include "storage/projected_columns.h"
 #include "type/type_id.h"
@@ -16,6 +24,14 @@ ProjectedColumnsIterator::ProjectedColumnsIterator(storage::ProjectedColumns *pr
 
 void ProjectedColumnsIterator::SetProjectedColumn(storage::ProjectedColumns *projected_column) {
   projected_column_ = projected_column;
+  frozen_view_ = nullptr;
+  const uint16_t num_cols = projected_column_->NumColumns();
+  column_starts_.resize(num_cols);
+  column_null_bitmaps_.resize(num_cols);
+  for (uint16_t i = 0; i < num_cols; i++) {
+    column_starts_[i] = projected_column_->ColumnStart(i);
+    column_null_bitmaps_[i] = projected_column_->ColumnNullBitmap(i);
+  }
   num_selected_ = projected_column_->NumTuples();
   curr_idx_ = 0;
   selection_vector_[0] = K_INVALID_POS;
@@ -23,71 +39,486 @@ void ProjectedColumnsIterator::SetProjectedColumn(storage::ProjectedColumns *pro
   selection_vector_write_idx_ = 0;
 }
 
+void ProjectedColumnsIterator::SetFrozenColumns(const storage::FrozenColumnsView *view) {
+  frozen_view_ = view;
+  const uint16_t num_cols = view->NumColumns();
+  column_starts_.resize(num_cols);
+  column_null_bitmaps_.resize(num_cols);
+  for (uint16_t i = 0; i < num_cols; i++) {
+    column_starts_[i] = view->ColumnStart(i);
+    column_null_bitmaps_[i] = view->ColumnNullBitmap(i);
+  }
+  num_selected_ = view->NumTuples();
+  curr_idx_ = 0;
+  selection_vector_[0] = K_INVALID_POS;
+  selection_vector_read_idx_ = 0;
+  selection_vector_write_idx_ = 0;
+}
+
+namespace {
+
+// Tag used to pass a native column type to generic lambdas
+template <typename T>
+struct TypeTag {
+  using Type = T;
+};
+
+// Invoke the function with a tag for the native storage type of the given SQL type
+template <typename F>
+uint32_t DispatchOnType(const type::TypeId type, const F &fn) {
+  switch (type) {
+    case type::TypeId::BOOLEAN:
+      return fn(TypeTag<bool>{});
+    case type::TypeId::TINYINT:
+      return fn(TypeTag<int8_t>{});
+    case type::TypeId::SMALLINT:
+      return fn(TypeTag<int16_t>{});
+    case type::TypeId::INTEGER:
+      return fn(TypeTag<int32_t>{});
+    case type::TypeId::BIGINT:
+      return fn(TypeTag<int64_t>{});
+    case type::TypeId::DECIMAL:
+      return fn(TypeTag<double>{});
+    case type::TypeId::DATE:
+      return fn(TypeTag<uint32_t>{});
+    case type::TypeId::TIMESTAMP:
+      return fn(TypeTag<uint64_t>{});
+    case type::TypeId::VARCHAR:
+    case type::TypeId::VARBINARY:
+      return fn(TypeTag<storage::VarlenEntry>{});
+    default:
+      throw std::runtime_error("Filter not supported on type");
+  }
+}
+
+// Read the filter value as the given native type
+template <typename T>
+T GetFilterVal(const ProjectedColumnsIterator::FilterVal &val) {
+  if constexpr (std::is_same_v<T, bool>) {
+    return val.b_;
+  } else if constexpr (std::is_same_v<T, int8_t>) {  // NOLINT
+    return val.ti_;
+  } else if constexpr (std::is_same_v<T, int16_t>) {  // NOLINT
+    return val.si_;
+  } else if constexpr (std::is_same_v<T, int32_t>) {  // NOLINT
+    return val.i_;
+  } else if constexpr (std::is_same_v<T, int64_t>) {  // NOLINT
+    return val.bi_;
+  } else if constexpr (std::is_same_v<T, double>) {  // NOLINT
+    return val.r_;
+  } else if constexpr (std::is_same_v<T, uint32_t>) {  // NOLINT
+    return val.d_;
+  } else if constexpr (std::is_same_v<T, uint64_t>) {  // NOLINT
+    return val.ts_;
+  } else {  // NOLINT
+    static_assert(std::is_same_v<T, storage::VarlenEntry>, "Unsupported filter value type");
+    return val.str_;
+  }
+}
+
+// Whether values of the given native type can be read from the lightweight encoding of a frozen column
+template <typename T>
+constexpr bool IsEncodable() {
+  return std::is_integral_v<T> && !std::is_same_v<T, bool>;
+}
+
+// The inclusive range of values that satisfy a comparison with a constant value, or that fail it for not_equal_to
 template <typename T, template <typename> typename Op>
-uint32_t ProjectedColumnsIterator::FilterColByColImpl(const uint32_t col_idx_1, const uint32_t col_idx_2) {
-  // Get the input column's data
-  const auto *input_1 = reinterpret_cast<const T *>(projected_column_->ColumnStart(static_cast<uint16_t>(col_idx_1)));
-  const auto *input_2 = reinterpret_cast<const T *>(projected_column_->ColumnStart(static_cast<uint16_t>(col_idx_2)));
+std::pair<T, T> ComparisonRange(const T val) {
+  using Cmp = Op<T>;
+  constexpr T lowest = std::numeric_limits<T>::lowest(), highest = std::numeric_limits<T>::max();
+  if constexpr (std::is_same_v<Cmp, std::equal_to<T>> || std::is_same_v<Cmp, std::not_equal_to<T>>) {
+    return {val, val};
+  } else if constexpr (std::is_same_v<Cmp, std::less<T>>) {  // NOLINT
+    // An empty range if nothing is less than the value
+    return val == lowest ? std::make_pair(highest, lowest) : std::make_pair(lowest, static_cast<T>(val - 1));
+  } else if constexpr (std::is_same_v<Cmp, std::less_equal<T>>) {  // NOLINT
+    return {lowest, val};
+  } else if constexpr (std::is_same_v<Cmp, std::greater<T>>) {  // NOLINT
+    return val == highest ? std::make_pair(highest, lowest) : std::make_pair(static_cast<T>(val + 1), highest);
+  } else {  // NOLINT
+    static_assert(std::is_same_v<Cmp, std::greater_equal<T>>, "Unsupported filter operator");
+    return {val, highest};
+  }
+}
+
+// Words of a dictionary, sorted in the same order as std::string_view compares them
+class DictionaryWords {
+ public:
+  explicit DictionaryWords(const storage::ArrowVarlenColumn &dictionary) : dictionary_(dictionary) {}
 
+  // Code of the first word that is not less than the given one
+  uint64_t LowerBound(const std::string_view word) const {
+    return Search(word, [](const std::string_view lhs, const std::string_view rhs) { return lhs < rhs; });
+  }
+
+  // Code of the first word that is greater than the given one
+  uint64_t UpperBound(const std::string_view word) const {
+    return Search(word, [](const std::string_view lhs, const std::string_view rhs) { return lhs <= rhs; });
+  }
+
+  // Code of the given word, or the size of the dictionary if it does not hold the word
+  uint64_t Find(const std::string_view word) const {
+    const uint64_t code = LowerBound(word);
+    return code < Size() && Word(code) == word ? code : Size();
+  }
+
+  uint64_t Size() const { return dictionary_.OffsetsLength() - 1; }
+
+ private:
+  std::string_view Word(const uint64_t code) const {
+    const uint64_t *offsets = dictionary_.Offsets();
+    return {reinterpret_cast<const char *>(dictionary_.Values() + offsets[code]), offsets[code + 1] - offsets[code]};
+  }
+
+  // Binary search for the first code whose word does not satisfy before(word, needle)
+  template <typename F>
+  uint64_t Search(const std::string_view needle, const F &before) const {
+    uint64_t lo = 0, hi = Size();
+    while (lo < hi) {
+      const uint64_t mid = lo + (hi - lo) / 2;
+      if (before(Word(mid), needle)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  const storage::ArrowVarlenColumn &dictionary_;
+};
+
+}  // namespace
+
+template <typename P>
+uint32_t ProjectedColumnsIterator::FilterByPredicate(const P &pred) {
   // Use the existing selection vector if this PCI has been filtered
   const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
 
   // Filter!
   selection_vector_write_idx_ =
-      util::VectorUtil::FilterVectorByVector<T, Op>(input_1, input_2, num_selected_, selection_vector_, sel_vec);
+      util::VectorUtil::FilterVectorByPredicate(num_selected_, pred, selection_vector_, sel_vec);
 
-  // After the filter has been run on the entire vector projection, we need to
-  // ensure that we reset it so that clients can query the updated state of the
-  // PCI, and subsequent filters operate only on valid tuples potentially
-  // filtered out in this filter.
+  // Reset so that clients and subsequent filters only see the valid tuples
   ResetFiltered();
-
-  // After the call to ResetFiltered(), num_selected_ should indicate the number
-  // of valid tuples in the filter.
   return NumSelected();
 }
 
+template <bool Negate>
+uint32_t ProjectedColumnsIterator::FilterCodesInRange(const uint64_t *codes, const uint64_t lo, const uint64_t hi) {
+  if (lo >= hi) {
+    // Nothing is in an empty range
+    if constexpr (Negate) return NumSelected();  // NOLINT
+    return FilterByPredicate([](uint32_t) { return false; });
+  }
+  if constexpr (Negate) {
+    return FilterByPredicate([=](uint32_t i) { return codes[i] < lo || codes[i] >= hi; });
+  } else {  // NOLINT
+    const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
+    selection_vector_write_idx_ =
+        util::VectorUtil::FilterVectorBetween(codes, num_selected_, lo, hi - 1, selection_vector_, sel_vec);
+    ResetFiltered();
+    return NumSelected();
+  }
+}
+
+template <typename T, bool Negate>
+bool ProjectedColumnsIterator::FilterEncodedInRange(const uint32_t col_idx, T lo, T hi) {
+  if constexpr (!IsEncodable<T>()) {
+    return false;
+  } else {  // NOLINT
+    const storage::ArrowColumnInfo *col_info =
+        frozen_view_ == nullptr ? nullptr : frozen_view_->EncodedColumn(static_cast<uint16_t>(col_idx));
+    if (col_info == nullptr) return false;
+    const storage::ArrowEncodedColumn &encoded = col_info->EncodedColumn();
+    // The encoding reads values as signed integers, so unsigned values past the sign bit do not compare the same way
+    if (std::is_unsigned_v<T> && encoded.Min() < 0) return false;
+    const uint32_t offset = frozen_view_->Offset(), num_tuples = frozen_view_->NumTuples();
+    if (num_tuples > common::Constants::K_DEFAULT_VECTOR_SIZE) return false;
+
+    // Narrow the range down to the values of the block. The predicate may then turn out to be the same for all values.
+    const auto col_min = static_cast<T>(encoded.Min()), col_max = static_cast<T>(encoded.Max());
+    lo = std::max(lo, col_min);
+    hi = std::min(hi, col_max);
+    const bool none_in_range = lo > hi, all_in_range = lo == col_min && hi == col_max;
+    if ((none_in_range && Negate) || (all_in_range && !Negate)) return true;
+    if (none_in_range || all_in_range) {
+      FilterByPredicate([](uint32_t) { return false; });
+      return true;
+    }
+
+    const auto range_lo = static_cast<int64_t>(lo), range_hi = static_cast<int64_t>(hi);
+    const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
+    if (col_info->Type() == storage::ArrowColumnType::RUN_LENGTH_ENCODED) {
+      // Evaluate the predicate once per run
+      const uint32_t *run_ends = encoded.RunEnds();
+      const int64_t *run_values = encoded.RunValues();
+      uint32_t run = static_cast<uint32_t>(std::upper_bound(run_ends, run_ends + encoded.NumRuns(), offset) - run_ends);
+      const auto matches = [=](const int64_t value) { return (range_lo <= value && value <= range_hi) != Negate; };
+      uint32_t out_pos = 0;
+      if (sel_vec == nullptr) {
+        for (uint32_t pos = 0; pos < num_selected_; run++) {
+          const uint32_t run_end = std::min(run_ends[run] - offset, num_selected_);
+          if (matches(run_values[run])) {
+            for (; pos < run_end; pos++) selection_vector_[out_pos++] = pos;
+          }
+          pos = run_end;
+        }
+      } else {
+        // Filters keep positions in order, so runs can be walked alongside the selection vector
+        for (uint32_t i = 0; i < num_selected_; i++) {
+          const uint32_t pos = sel_vec[i];
+          while (run_ends[run] - offset <= pos) run++;
+          selection_vector_[out_pos] = pos;
+          out_pos += static_cast<uint32_t>(matches(run_values[run]));
+        }
+      }
+      selection_vector_write_idx_ = out_pos;
+      ResetFiltered();
+      return true;
+    }
+
+    if (arith_buffer_ == nullptr) {
+      arith_buffer_ = std::make_unique<byte[]>(common::Constants::K_DEFAULT_VECTOR_SIZE * sizeof(int64_t));
+    }
+    // Filter the decoded values of the view, which are relative to the given reference value
+    const auto filter_decoded = [&](const auto *decoded, const int64_t reference) {
+      using D = std::remove_cv_t<std::remove_pointer_t<decltype(decoded)>>;
+      const auto decoded_lo = static_cast<D>(static_cast<uint64_t>(range_lo) - static_cast<uint64_t>(reference));
+      const auto decoded_hi = static_cast<D>(static_cast<uint64_t>(range_hi) - static_cast<uint64_t>(reference));
+      if constexpr (Negate) {
+        FilterByPredicate([=](uint32_t i) { return decoded[i] < decoded_lo || decoded[i] > decoded_hi; });
+      } else {  // NOLINT
+        selection_vector_write_idx_ = util::VectorUtil::FilterVectorBetween(decoded, num_selected_, decoded_lo,
+                                                                            decoded_hi, selection_vector_, sel_vec);
+        ResetFiltered();
+      }
+    };
+
+    if (col_info->Type() == storage::ArrowColumnType::FRAME_OF_REFERENCE) {
+      // Compare the packed offsets from the smallest value, which are in range of each other since lo and hi are in
+      // range of the block
+      if (encoded.BitWidth() <= 32) {
+        auto *decoded = reinterpret_cast<uint32_t *>(arith_buffer_.get());
+        util::VectorUtil::UnpackBits(reinterpret_cast<const uint8_t *>(encoded.Packed()), encoded.BitWidth(), offset,
+                                     num_tuples, decoded);
+        filter_decoded(decoded, encoded.Min());
+      } else {
+        auto *decoded = reinterpret_cast<uint64_t *>(arith_buffer_.get());
+        for (uint32_t i = 0; i < num_tuples; i++) decoded[i] = encoded.Unpack(offset + i);
+        filter_decoded(decoded, encoded.Min());
+      }
+      return true;
+    }
+
+    TERRIER_ASSERT(col_info->Type() == storage::ArrowColumnType::DELTA_ENCODED, "Unknown lightweight encoding");
+    // Sum up the deltas from the closest anchor before the view, and then through the view
+    const auto reference = static_cast<uint64_t>(encoded.Reference());
+    const uint32_t anchor = offset / storage::ArrowEncodedColumn::K_DELTA_ANCHOR_INTERVAL;
+    auto value = static_cast<uint64_t>(encoded.RunValues()[anchor]);
+    for (uint32_t i = anchor * storage::ArrowEncodedColumn::K_DELTA_ANCHOR_INTERVAL + 1; i <= offset; i++)
+      value += reference + encoded.Unpack(i);
+    auto *decoded = reinterpret_cast<int64_t *>(arith_buffer_.get());
+    decoded[0] = static_cast<int64_t>(value);
+    for (uint32_t i = 1; i < num_tuples; i++) {
+      value += reference + encoded.Unpack(offset + i);
+      decoded[i] = static_cast<int64_t>(value);
+    }
+    filter_decoded(decoded, 0);
+    return true;
+  }
+}
+
+template <typename T, template <typename> typename Op>
+uint32_t ProjectedColumnsIterator::FilterColByColImpl(const uint32_t col_idx_1, const uint32_t col_idx_2) {
+  // Get the input column's data
+  const auto *input_1 = ColumnData<T>(col_idx_1);
+  const auto *input_2 = ColumnData<T>(col_idx_2);
+
+  // Strings have no SIMD kernel; compare their contents one at a time
+  if constexpr (std::is_same_v<T, storage::VarlenEntry>) {
+    return FilterByPredicate(
+        [&](uint32_t i) { return Op<std::string_view>()(input_1[i].StringView(), input_2[i].StringView()); });
+  } else {  // NOLINT
+    // Use the existing selection vector if this PCI has been filtered
+    const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
+
+    // Filter!
+    selection_vector_write_idx_ =
+        util::VectorUtil::FilterVectorByVector<T, Op>(input_1, input_2, num_selected_, selection_vector_, sel_vec);
+
+    // After the filter has been run on the entire vector projection, we need to
+    // ensure that we reset it so that clients can query the updated state of the
+    // PCI, and subsequent filters operate only on valid tuples potentially
+    // filtered out in this filter.
+    ResetFiltered();
+
+    // After the call to ResetFiltered(), num_selected_ should indicate the number
+    // of valid tuples in the filter.
+    return NumSelected();
+  }
+}
+
 // Filter an entire column's data by the provided constant value
 template <typename T, template <typename> typename Op>
 uint32_t ProjectedColumnsIterator::FilterColByValImpl(uint32_t col_idx, T val) {
   // Get the input column's data
-  const auto *input = reinterpret_cast<const T *>(projected_column_->ColumnStart(static_cast<uint16_t>(col_idx)));
+  const auto *input = ColumnData<T>(col_idx);
 
-  // Use the existing selection vector if this PCI has been filtered
+  // Strings have no SIMD kernel; compare their contents one at a time
+  if constexpr (std::is_same_v<T, storage::VarlenEntry>) {
+    const auto val_view = val.StringView();
+    if (const uint64_t *codes = DictionaryCodes(col_idx); codes != nullptr) {
+      // The dictionary is sorted, so every comparison boils down to a range of codes
+      const DictionaryWords words(*frozen_view_->Dictionary(static_cast<uint16_t>(col_idx)));
+      const uint64_t lo = words.LowerBound(val_view), hi = words.UpperBound(val_view);
+      using Cmp = Op<std::string_view>;
+      if constexpr (std::is_same_v<Cmp, std::equal_to<std::string_view>>) {
+        return FilterCodesInRange<false>(codes, lo, hi);
+      } else if constexpr (std::is_same_v<Cmp, std::not_equal_to<std::string_view>>) {  // NOLINT
+        return FilterCodesInRange<true>(codes, lo, hi);
+      } else if constexpr (std::is_same_v<Cmp, std::less<std::string_view>>) {  // NOLINT
+        return FilterCodesInRange<false>(codes, 0, lo);
+      } else if constexpr (std::is_same_v<Cmp, std::less_equal<std::string_view>>) {  // NOLINT
+        return FilterCodesInRange<false>(codes, 0, hi);
+      } else if constexpr (std::is_same_v<Cmp, std::greater<std::string_view>>) {  // NOLINT
+        return FilterCodesInRange<false>(codes, hi, words.Size());
+      } else {  // NOLINT
+        static_assert(std::is_same_v<Cmp, std::greater_equal<std::string_view>>, "Unsupported filter operator");
+        return FilterCodesInRange<false>(codes, lo, words.Size());
+      }
+    }
+    return FilterByPredicate([&](uint32_t i) { return Op<std::string_view>()(input[i].StringView(), val_view); });
+  } else {  // NOLINT
+    // Integer columns of frozen blocks may be filtered on their lightweight encoding instead
+    if constexpr (IsEncodable<T>()) {
+      const auto [lo, hi] = ComparisonRange<T, Op>(val);
+      if (FilterEncodedInRange<T, std::is_same_v<Op<T>, std::not_equal_to<T>>>(col_idx, lo, hi)) return NumSelected();
+    }
+
+    // Use the existing selection vector if this PCI has been filtered
+    const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
+
+    // Filter!
+    selection_vector_write_idx_ =
+        util::VectorUtil::FilterVectorByVal<T, Op>(input, num_selected_, val, selection_vector_, sel_vec);
+
+    // After the filter has been run on the entire vector projection, we need to
+    // ensure that we reset it so that clients can query the updated state of the
+    // PCI, and subsequent filters operate only on valid tuples potentially
+    // filtered out in this filter.
+    ResetFiltered();
+
+    // After the call to ResetFiltered(), num_selected_ should indicate the number
+    // of valid tuples in the filter.
+    return NumSelected();
+  }
+}
+
+template <typename T>
+uint32_t ProjectedColumnsIterator::FilterColBetweenImpl(uint32_t col_idx, T lo, T hi) {
+  const auto *input = ColumnData<T>(col_idx);
+
+  if constexpr (std::is_same_v<T, storage::VarlenEntry>) {
+    const auto lo_view = lo.StringView(), hi_view = hi.StringView();
+    if (const uint64_t *codes = DictionaryCodes(col_idx); codes != nullptr) {
+      const DictionaryWords words(*frozen_view_->Dictionary(static_cast<uint16_t>(col_idx)));
+      return FilterCodesInRange<false>(codes, words.LowerBound(lo_view), words.UpperBound(hi_view));
+    }
+    return FilterByPredicate([&](uint32_t i) {
+      const auto view = input[i].StringView();
+      return lo_view <= view && view <= hi_view;
+    });
+  } else {  // NOLINT
+    if (FilterEncodedInRange<T, false>(col_idx, lo, hi)) return NumSelected();
+    const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
+    selection_vector_write_idx_ =
+        util::VectorUtil::FilterVectorBetween(input, num_selected_, lo, hi, selection_vector_, sel_vec);
+    ResetFiltered();
+    return NumSelected();
+  }
+}
+
+template <typename T>
+uint32_t ProjectedColumnsIterator::FilterColInImpl(uint32_t col_idx, const FilterVal *vals, uint32_t num_vals) {
+  const auto *input = ColumnData<T>(col_idx);
+
+  if constexpr (std::is_same_v<T, storage::VarlenEntry>) {
+    if (const uint64_t *codes = DictionaryCodes(col_idx); codes != nullptr) {
+      // Values missing from the dictionary cannot match, so they map to a code that no value is encoded as
+      const DictionaryWords words(*frozen_view_->Dictionary(static_cast<uint16_t>(col_idx)));
+      auto list = std::make_unique<uint64_t[]>(num_vals);
+      for (uint32_t i = 0; i < num_vals; i++) list[i] = words.Find(vals[i].str_.StringView());
+      const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
+      selection_vector_write_idx_ =
+          util::VectorUtil::FilterVectorIn(codes, num_selected_, list.get(), num_vals, selection_vector_, sel_vec);
+      ResetFiltered();
+      return NumSelected();
+    }
+    std::vector<std::string_view> list;
+    list.reserve(num_vals);
+    for (uint32_t i = 0; i < num_vals; i++) list.emplace_back(vals[i].str_.StringView());
+    return FilterByPredicate([&](uint32_t i) {
+      return std::find(list.begin(), list.end(), input[i].StringView()) != list.end();
+    });
+  } else {  // NOLINT
+    auto list = std::make_unique<T[]>(num_vals);
+    for (uint32_t i = 0; i < num_vals; i++) list[i] = GetFilterVal<T>(vals[i]);
+    const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
+    selection_vector_write_idx_ =
+        util::VectorUtil::FilterVectorIn(input, num_selected_, list.get(), num_vals, selection_vector_, sel_vec);
+    ResetFiltered();
+    return NumSelected();
+  }
+}
+
+template <bool IsNull>
+uint32_t ProjectedColumnsIterator::FilterColByNull(uint32_t col_idx) {
+  // The storage layer marks non-NULL values with a set bit
+  const auto *null_bitmap = column_null_bitmaps_[col_idx];
+  return FilterByPredicate([null_bitmap](uint32_t i) { return null_bitmap->Test(i) != IsNull; });
+}
+
+template <typename T, typename R, template <typename> typename Op>
+uint32_t ProjectedColumnsIterator::FilterColArithByValImpl(uint32_t col_idx, ArithmeticOp arith_op, R operand,
+                                                           R val) {
+  static_assert(sizeof(R) <= sizeof(int64_t), "Arithmetic buffer is too small for the computation type");
+  if (arith_buffer_ == nullptr) {
+    arith_buffer_ = std::make_unique<byte[]>(common::Constants::K_DEFAULT_VECTOR_SIZE * sizeof(int64_t));
+  }
+
+  const auto *input = ColumnData<T>(col_idx);
+  auto *computed = reinterpret_cast<R *>(arith_buffer_.get());
   const uint32_t *sel_vec = (IsFiltered() ? selection_vector_ : nullptr);
 
-  // Filter!
+  // Compute the values of all active tuples, then filter them
+  switch (arith_op) {
+    case ArithmeticOp::Plus:
+      util::VectorUtil::ArithmeticVectorByVal<T, R, std::plus>(input, num_selected_, operand, computed, sel_vec);
+      break;
+    case ArithmeticOp::Minus:
+      util::VectorUtil::ArithmeticVectorByVal<T, R, std::minus>(input, num_selected_, operand, computed, sel_vec);
+      break;
+    case ArithmeticOp::Multiply:
+      util::VectorUtil::ArithmeticVectorByVal<T, R, std::multiplies>(input, num_selected_, operand, computed,
+                                                                     sel_vec);
+      break;
+  }
   selection_vector_write_idx_ =
-      util::VectorUtil::FilterVectorByVal<T, Op>(input, num_selected_, val, selection_vector_, sel_vec);
+      util::VectorUtil::FilterVectorByVal<R, Op>(computed, num_selected_, val, selection_vector_, sel_vec);
 
-  // After the filter has been run on the entire vector projection, we need to
-  // ensure that we reset it so that clients can query the updated state of the
-  // PCI, and subsequent filters operate only on valid tuples potentially
-  // filtered out in this filter.
   ResetFiltered();
-
-  // After the call to ResetFiltered(), num_selected_ should indicate the number
-  // of valid tuples in the filter.
   return NumSelected();
 }
 
 // Filter an entire column's data by the provided constant value
 template <template <typename> typename Op>
 uint32_t ProjectedColumnsIterator::FilterColByVal(uint32_t col_idx, type::TypeId type, FilterVal val) {
-  switch (type) {
-    case type::TypeId::SMALLINT: {
-      return FilterColByValImpl<int16_t, Op>(col_idx, val.si_);
-    }
-    case type::TypeId::INTEGER: {
-      return FilterColByValImpl<int32_t, Op>(col_idx, val.i_);
-    }
-    case type::TypeId::BIGINT: {
-      return FilterColByValImpl<int64_t, Op>(col_idx, val.bi_);
-    }
-    default: {
-      throw std::runtime_error("Filter not supported on type");
-    }
-  }
+  return DispatchOnType(type, [&](auto tag) {
+    using T = typename decltype(tag)::Type;
+    return FilterColByValImpl<T, Op>(col_idx, GetFilterVal<T>(val));
+  });
 }
 
 template <template <typename> typename Op>
@@ -95,19 +526,44 @@ uint32_t ProjectedColumnsIterator::FilterColByCol(const uint32_t col_idx_1, type
                                                   const uint32_t col_idx_2, type::TypeId type_2) {
   TERRIER_ASSERT(type_1 == type_2, "Incompatible column types for filter");
 
-  switch (type_1) {
-    case type::TypeId::SMALLINT: {
-      return FilterColByColImpl<int16_t, Op>(col_idx_1, col_idx_2);
-    }
-    case type::TypeId::INTEGER: {
-      return FilterColByColImpl<int32_t, Op>(col_idx_1, col_idx_2);
-    }
-    case type::TypeId::BIGINT: {
-      return FilterColByColImpl<int64_t, Op>(col_idx_1, col_idx_2);
-    }
-    default: {
-      throw std::runtime_error("Filter not supported on type");
-    }
+  return DispatchOnType(type_1, [&](auto tag) {
+    using T = typename decltype(tag)::Type;
+    return FilterColByColImpl<T, Op>(col_idx_1, col_idx_2);
+  });
+}
+
+uint32_t ProjectedColumnsIterator::FilterColBetween(uint32_t col_idx, type::TypeId type, FilterVal lo,
+                                                    FilterVal hi) {
+  return DispatchOnType(type, [&](auto tag) {
+    using T = typename decltype(tag)::Type;
+    return FilterColBetweenImpl<T>(col_idx, GetFilterVal<T>(lo), GetFilterVal<T>(hi));
+  });
+}
+
+uint32_t ProjectedColumnsIterator::FilterColIn(uint32_t col_idx, type::TypeId type, const FilterVal *vals,
+                                               uint32_t num_vals) {
+  return DispatchOnType(type, [&](auto tag) {
+    using T = typename decltype(tag)::Type;
+    return FilterColInImpl<T>(col_idx, vals, num_vals);
+  });
+}
+
+template <template <typename> typename Op>
+uint32_t ProjectedColumnsIterator::FilterColArithByVal(uint32_t col_idx, type::TypeId type, ArithmeticOp arith_op,
+                                                       FilterVal operand, FilterVal val) {
+  switch (type) {
+    case type::TypeId::TINYINT:
+      return FilterColArithByValImpl<int8_t, int64_t, Op>(col_idx, arith_op, operand.bi_, val.bi_);
+    case type::TypeId::SMALLINT:
+      return FilterColArithByValImpl<int16_t, int64_t, Op>(col_idx, arith_op, operand.bi_, val.bi_);
+    case type::TypeId::INTEGER:
+      return FilterColArithByValImpl<int32_t, int64_t, Op>(col_idx, arith_op, operand.bi_, val.bi_);
+    case type::TypeId::BIGINT:
+      return FilterColArithByValImpl<int64_t, int64_t, Op>(col_idx, arith_op, operand.bi_, val.bi_);
+    case type::TypeId::DECIMAL:
+      return FilterColArithByValImpl<double, double, Op>(col_idx, arith_op, operand.r_, val.r_);
+    default:
+      throw std::runtime_error("Arithmetic filter not supported on type");
   }
 }
 
@@ -129,4 +585,15 @@ template uint32_t ProjectedColumnsIterator::FilterColByCol<std::less_equal>(uint
 template uint32_t ProjectedColumnsIterator::FilterColByCol<std::not_equal_to>(uint32_t, type::TypeId, uint32_t,
                                                                               type::TypeId);
 
+#define INSTANTIATE_ARITH_FILTER(Op)                                                                        \
+  template uint32_t ProjectedColumnsIterator::FilterColArithByVal<Op>(uint32_t, type::TypeId, ArithmeticOp, \
+                                                                      FilterVal, FilterVal);
+INSTANTIATE_ARITH_FILTER(std::equal_to)
+INSTANTIATE_ARITH_FILTER(std::greater)
+INSTANTIATE_ARITH_FILTER(std::greater_equal)
+INSTANTIATE_ARITH_FILTER(std::less)
+INSTANTIATE_ARITH_FILTER(std::less_equal)
+INSTANTIATE_ARITH_FILTER(std::not_equal_to)
+#undef INSTANTIATE_ARITH_FILTER
+
 }  // namespace terrier::execution::sql
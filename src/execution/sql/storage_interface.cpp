@@ -15,6 +15,14 @@ StorageInterface::StorageInterface(exec::ExecutionContext *exec_ctx, catalog::ta
       exec_ctx_(exec_ctx),
       col_oids_(col_oids, col_oids + num_oids),
       need_indexes_(need_indexes) {
+  // Remember where the varlen columns are in the table PR, so that their values can be copied into the transaction
+  const auto &schema = exec_ctx->GetAccessor()->GetSchema(table_oid);
+  const auto projection_map = table_->ProjectionMapForOids(col_oids_);
+  for (const auto col_oid : col_oids_) {
+    if (schema.GetColumn(col_oid).AttrSize() == storage::VARLEN_COLUMN)
+      varlen_offsets_.push_back(projection_map.at(col_oid));
+  }
+
   // Initialize the index projected row if needed.
   if (need_indexes_) {
     // Get index pr size
@@ -49,6 +57,7 @@ storage::ProjectedRow *StorageInterface::GetIndexPR(catalog::index_oid_t index_o
 
 storage::TupleSlot StorageInterface::TableInsert() {
   exec_ctx_->RowsAffected()++;  // believe this should only happen in root plan nodes, so should reflect count of query
+  CopyVarlensIntoTxn();
   return table_->Insert(exec_ctx_->GetTxn(), table_redo_);
 }
 
@@ -62,9 +71,21 @@ bool StorageInterface::TableDelete(storage::TupleSlot table_tuple_slot) {
 bool StorageInterface::TableUpdate(storage::TupleSlot table_tuple_slot) {
   exec_ctx_->RowsAffected()++;  // believe this should only happen in root plan nodes, so should reflect count of query
   table_redo_->SetTupleSlot(table_tuple_slot);
+  CopyVarlensIntoTxn();
   return table_->Update(exec_ctx_->GetTxn(), table_redo_);
 }
 
+void StorageInterface::CopyVarlensIntoTxn() {
+  const auto txn = exec_ctx_->GetTxn();
+  storage::ProjectedRow *const delta = table_redo_->Delta();
+  for (const auto offset : varlen_offsets_) {
+    auto *const entry = reinterpret_cast<storage::VarlenEntry *>(delta->AccessWithNullCheck(offset));
+    // Values set into the PR still point to memory owned by the query, so the table needs its own copy
+    if (entry != nullptr && !entry->IsInlined() && !entry->NeedReclaim())
+      *entry = txn->CopyVarlen(entry->Content(), entry->Size());
+  }
+}
+
 bool StorageInterface::IndexInsert() {
   TERRIER_ASSERT(need_indexes_, "Index PR not allocated!");
   return curr_index_->Insert(exec_ctx_->GetTxn(), *index_pr_, table_redo_->GetTupleSlot());
@@ -38,18 +38,39 @@ bool TableVectorIterator::Init() {
 
 bool TableVectorIterator::Advance() {
   if (!initialized_) return false;
-  // First check if the iterator ended.
-  if (*iter_ == table_->end()) {
-    return false;
+  // The previous vector is done with, so the block it was read from in place can thaw again
+  frozen_view_.Release();
+  // Keep going until the iterator ends.
+  while (*iter_ != table_->end()) {
+    // Go straight to the next block if none of the tuples left in this one can pass the scan's predicate
+    if (!zone_ranges_.empty() && table_->TrySkipBlock(iter_.get(), *projected_columns_, zone_ranges_)) continue;
+    // Hand out frozen tuples as they are stored, unless the query's own writes would have to wait for the view
+    if (exec_ctx_->IsReadOnly() && table_->TryViewFrozen(iter_.get(), *projected_columns_, &frozen_view_)) {
+      // The rest of the block may turn out to be empty, so keep going until there are tuples to hand out
+      if (frozen_view_.NumTuples() == 0) continue;
+      pci_.SetFrozenColumns(&frozen_view_);
+      return true;
+    }
+    // Scan the table to set the projected column.
+    table_->Scan(exec_ctx_->GetTxn(), iter_.get(), projected_columns_);
+    pci_.SetProjectedColumn(projected_columns_);
+    return true;
   }
-  // Scan the table to set the projected column.
-  table_->Scan(exec_ctx_->GetTxn(), iter_.get(), projected_columns_);
-  pci_.SetProjectedColumn(projected_columns_);
-  return true;
+  return false;
+}
+
+void TableVectorIterator::FilterBlocks(const uint32_t col_idx, const type::TypeId col_type, const int64_t lo,
+                                       const int64_t hi) {
+  TERRIER_ASSERT((col_type >= type::TypeId::TINYINT && col_type <= type::TypeId::BIGINT) ||
+                     col_type == type::TypeId::DATE || col_type == type::TypeId::TIMESTAMP,
+                 "Zone maps only order integer values.");
+  const bool is_unsigned = col_type == type::TypeId::DATE || col_type == type::TypeId::TIMESTAMP;
+  zone_ranges_.push_back({static_cast<uint16_t>(col_idx), lo, hi, is_unsigned});
 }
 
 void TableVectorIterator::Reset() {
   if (!initialized_) return;
+  frozen_view_.Release();
   iter_ = std::make_unique<storage::DataTable::SlotIterator>(table_->begin());
 }
 
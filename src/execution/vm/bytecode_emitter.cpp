@@ -7,10 +7,86 @@
 
 namespace terrier::execution::vm {
 
+namespace {
+
+// Return the superinstruction fusing a Lea with the given trailing Deref.
+Bytecode GetFusedLeaDeref(Bytecode deref) {
+  switch (deref) {
+    case Bytecode::Deref1:
+      return Bytecode::LeaDeref1;
+    case Bytecode::Deref2:
+      return Bytecode::LeaDeref2;
+    case Bytecode::Deref4:
+      return Bytecode::LeaDeref4;
+    default:
+      return Bytecode::LeaDeref8;
+  }
+}
+
+// Return the superinstruction fusing the given bytecode with a trailing
+// JumpIfFalse on its result, or JumpIfFalse if there is no such instruction.
+Bytecode GetFusedJumpIfFalse(Bytecode bytecode) {
+  switch (bytecode) {
+#define GEN_CASE(op, type)    \
+  case Bytecode::op##_##type: \
+    return Bytecode::op##JumpIfFalse##_##type;
+#define GEN_COMPARISON_CASES(type, ...) \
+  GEN_CASE(GreaterThan, type)           \
+  GEN_CASE(GreaterThanEqual, type)      \
+  GEN_CASE(Equal, type)                 \
+  GEN_CASE(LessThan, type)              \
+  GEN_CASE(LessThanEqual, type)         \
+  GEN_CASE(NotEqual, type)
+    INT_TYPES(GEN_COMPARISON_CASES)
+#undef GEN_COMPARISON_CASES
+#undef GEN_CASE
+    case Bytecode::ForceBoolTruth:
+      return Bytecode::ForceBoolTruthJumpIfFalse;
+    case Bytecode::PCIHasNext:
+      return Bytecode::PCIHasNextJumpIfFalse;
+    case Bytecode::PCIHasNextFiltered:
+      return Bytecode::PCIHasNextFilteredJumpIfFalse;
+    default:
+      return Bytecode::JumpIfFalse;
+  }
+}
+
+}  // namespace
+
+bool BytecodeEmitter::PeekLast(Bytecode *bytecode, LocalVar *output) const {
+  if (last_bytecode_pos_ == K_NO_FUSION_CANDIDATE) {
+    return false;
+  }
+  const uint8_t *raw = &(*bytecode_)[last_bytecode_pos_];
+  *bytecode = Bytecodes::FromByte(*reinterpret_cast<const std::underlying_type_t<Bytecode> *>(raw));
+  if (Bytecodes::NumOperands(*bytecode) == 0 || Bytecodes::GetNthOperandType(*bytecode, 0) != OperandType::Local) {
+    return false;
+  }
+  *output = LocalVar::Decode(*reinterpret_cast<const uint32_t *>(raw + Bytecodes::GetNthOperandOffset(*bytecode, 0)));
+  return true;
+}
+
+void BytecodeEmitter::FuseWithLast(Bytecode fused) {
+  TERRIER_ASSERT(last_bytecode_pos_ != K_NO_FUSION_CANDIDATE, "No instruction to fuse with");
+  *reinterpret_cast<std::underlying_type_t<Bytecode> *>(&(*bytecode_)[last_bytecode_pos_]) = Bytecodes::ToByte(fused);
+}
+
 void BytecodeEmitter::EmitDeref(Bytecode bytecode, LocalVar dest, LocalVar src) {
   TERRIER_ASSERT(bytecode == Bytecode::Deref1 || bytecode == Bytecode::Deref2 || bytecode == Bytecode::Deref4 ||
                      bytecode == Bytecode::Deref8,
                  "Bytecode is not a Deref code");
+
+  // Member accesses generate a Lea to compute the field's address immediately
+  // followed by a Deref of that address. Fuse them into a single instruction.
+  Bytecode last;
+  LocalVar lea_dest;
+  if (PeekLast(&last, &lea_dest) && last == Bytecode::Lea &&
+      lea_dest.GetAddressMode() == LocalVar::AddressMode::Address && src == lea_dest.ValueOf()) {
+    FuseWithLast(GetFusedLeaDeref(bytecode));
+    EmitImpl(dest);
+    return;
+  }
+
   EmitAll(bytecode, dest, src);
 }
 
@@ -67,6 +143,9 @@ void BytecodeEmitter::EmitReturn() { EmitImpl(Bytecode::Return); }
 void BytecodeEmitter::Bind(BytecodeLabel *label) {
   TERRIER_ASSERT(!label->IsBound(), "Cannot rebind labels");
 
+  // The next instruction may be a jump target and must start a fresh instruction
+  last_bytecode_pos_ = K_NO_FUSION_CANDIDATE;
+
   std::size_t curr_offset = Position();
 
   if (label->IsForwardTarget()) {
@@ -123,6 +202,20 @@ void BytecodeEmitter::EmitJump(Bytecode bytecode, BytecodeLabel *label) {
 
 void BytecodeEmitter::EmitConditionalJump(Bytecode bytecode, LocalVar cond, BytecodeLabel *label) {
   TERRIER_ASSERT(Bytecodes::IsJump(bytecode), "Provided bytecode is not a jump");
+
+  // Branch conditions are usually computed by the instruction immediately
+  // preceding the jump. If possible, fuse the two into a single instruction.
+  Bytecode last;
+  LocalVar last_dest;
+  if (bytecode == Bytecode::JumpIfFalse && PeekLast(&last, &last_dest) &&
+      last_dest.GetAddressMode() == LocalVar::AddressMode::Address && cond == last_dest.ValueOf()) {
+    if (Bytecode fused = GetFusedJumpIfFalse(last); fused != Bytecode::JumpIfFalse) {
+      FuseWithLast(fused);
+      EmitJump(label);
+      return;
+    }
+  }
+
   EmitAll(bytecode, cond);
   EmitJump(label);
 }
@@ -260,6 +353,11 @@ void BytecodeEmitter::EmitTableIterInit(Bytecode bytecode, LocalVar iter, LocalV
   EmitAll(bytecode, iter, exec_ctx, table_oid, col_oids, num_oids);
 }
 
+void BytecodeEmitter::EmitTableIterFilterBlocks(LocalVar iter, uint32_t col_idx, int8_t type, int64_t lo,
+                                                int64_t hi) {
+  EmitAll(Bytecode::TableVectorIteratorFilterBlocks, iter, col_idx, type, lo, hi);
+}
+
 void BytecodeEmitter::EmitAddCol(Bytecode bytecode, LocalVar iter, uint32_t col_oid) {
   EmitAll(bytecode, iter, col_oid);
 }
@@ -278,8 +376,38 @@ void BytecodeEmitter::EmitPCIVectorFilter(Bytecode bytecode, LocalVar selected,
   EmitAll(bytecode, selected, pci, col_idx, type, val);
 }
 
-void BytecodeEmitter::EmitFilterManagerInsertFlavor(LocalVar fmb, FunctionId func) {
-  EmitAll(Bytecode::FilterManagerInsertFlavor, fmb, func);
+void BytecodeEmitter::EmitPCIVectorFilterSql(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx,
+                                             int8_t type, LocalVar val) {
+  EmitAll(bytecode, selected, pci, col_idx, type, val);
+}
+
+void BytecodeEmitter::EmitPCIVectorFilterColumn(Bytecode bytecode, LocalVar selected, LocalVar pci,
+                                                uint32_t col_idx_1, int8_t type_1, uint32_t col_idx_2,
+                                                int8_t type_2) {
+  EmitAll(bytecode, selected, pci, col_idx_1, type_1, col_idx_2, type_2);
+}
+
+void BytecodeEmitter::EmitPCIVectorFilterArith(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx,
+                                               int8_t type, int8_t arith_op, LocalVar operand, LocalVar val) {
+  EmitAll(bytecode, selected, pci, col_idx, type, arith_op, operand, val);
+}
+
+void BytecodeEmitter::EmitPCIVectorFilterBetween(LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type,
+                                                 LocalVar lo, LocalVar hi) {
+  EmitAll(Bytecode::PCIFilterBetween, selected, pci, col_idx, type, lo, hi);
+}
+
+void BytecodeEmitter::EmitPCIVectorFilterIn(LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type,
+                                            LocalVar list, uint32_t num_vals) {
+  EmitAll(Bytecode::PCIFilterIn, selected, pci, col_idx, type, list, num_vals);
+}
+
+void BytecodeEmitter::EmitPCIVectorFilterNull(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx) {
+  EmitAll(bytecode, selected, pci, col_idx);
+}
+
+void BytecodeEmitter::EmitFilterManagerInsertFlavor(LocalVar fmb, FunctionId func, int64_t flavor_id) {
+  EmitAll(Bytecode::FilterManagerInsertFlavor, fmb, func, flavor_id);
 }
 
 void BytecodeEmitter::EmitAggHashTableLookup(LocalVar dest, LocalVar agg_ht, LocalVar hash, FunctionId key_eq_fn,
@@ -308,6 +436,11 @@ void BytecodeEmitter::EmitJoinHashTableIterHasNext(LocalVar has_more, LocalVar i
   EmitAll(Bytecode::JoinHashTableIterHasNext, has_more, iterator, key_eq, opaque_ctx, probe_tuple);
 }
 
+void BytecodeEmitter::EmitJoinHashTablePartIterHasNext(LocalVar has_more, LocalVar iterator, FunctionId key_eq,
+                                                       LocalVar opaque_ctx) {
+  EmitAll(Bytecode::JoinHashTablePartIterHasNext, has_more, iterator, key_eq, opaque_ctx);
+}
+
 void BytecodeEmitter::EmitSorterInit(Bytecode bytecode, LocalVar sorter, LocalVar region, FunctionId cmp_fn,
                                      LocalVar tuple_size) {
   EmitAll(bytecode, sorter, region, cmp_fn, tuple_size);
@@ -1,9 +1,11 @@
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "catalog/catalog.h"
+#include "common/hash_util.h"
 #include "common/macros.h"
 #include "execution/ast/builtins.h"
 #include "execution/ast/context.h"
@@ -630,6 +632,16 @@ void BytecodeGenerator::VisitBuiltinTableIterCall(ast::CallExpr *call, ast::Buil
       Emitter()->Emit(Bytecode::TableVectorIteratorFree, iter);
       break;
     }
+    case ast::Builtin::TableIterFilterBlocks: {
+      // The column index, its type and the bounds are all integer literals
+      const auto &args = call->Arguments();
+      auto col_idx = static_cast<uint32_t>(args[1]->As<ast::LitExpr>()->Int64Val());
+      auto col_type = static_cast<int8_t>(args[2]->As<ast::LitExpr>()->Int64Val());
+      int64_t lo = args[3]->As<ast::LitExpr>()->Int64Val();
+      int64_t hi = args[4]->As<ast::LitExpr>()->Int64Val();
+      Emitter()->EmitTableIterFilterBlocks(iter, col_idx, col_type, lo, hi);
+      break;
+    }
     default: {
       UNREACHABLE("Impossible table iteration call");
     }
@@ -867,7 +879,9 @@ void BytecodeGenerator::VisitBuiltinFilterManagerCall(ast::CallExpr *call, ast::
       for (uint32_t arg_idx = 1; arg_idx < call->NumArgs(); arg_idx++) {
         const std::string func_name = call->Arguments()[arg_idx]->As<ast::IdentifierExpr>()->Name().Data();
         const FunctionId func_id = LookupFuncIdByName(func_name);
-        Emitter()->EmitFilterManagerInsertFlavor(filter_manager, func_id);
+        // The identity of the flavor is only known once its bytecode is, so it is filled in at the end
+        Emitter()->EmitFilterManagerInsertFlavor(filter_manager, func_id, 0);
+        flavor_ids_.emplace_back(Emitter()->Position() - sizeof(int64_t), func_id);
       }
       break;
     }
@@ -899,46 +913,118 @@ void BytecodeGenerator::VisitBuiltinFilterCall(ast::CallExpr *call, ast::Builtin
     ret_val = CurrentFunction()->NewLocal(call->GetType());
   }
 
-  // Collect the three call arguments
+  const auto &args = call->Arguments();
   // Projected Column Iterator
-  LocalVar pci = VisitExpressionForRValue(call->Arguments()[0]);
+  LocalVar pci = VisitExpressionForRValue(args[0]);
   // Column index
-  auto col_idx = static_cast<uint16_t>(call->Arguments()[1]->As<ast::LitExpr>()->Int64Val());
-  auto col_type = static_cast<int8_t>(call->Arguments()[2]->As<ast::LitExpr>()->Int64Val());
-  // Filter value
-  int64_t val = call->Arguments()[3]->As<ast::LitExpr>()->Int64Val();
+  auto col_idx = static_cast<uint16_t>(args[1]->As<ast::LitExpr>()->Int64Val());
 
-  Bytecode bytecode;
+  // NULL filters do not need the column type
+  if (builtin == ast::Builtin::FilterIsNull || builtin == ast::Builtin::FilterIsNotNull) {
+    const Bytecode bytecode =
+        builtin == ast::Builtin::FilterIsNull ? Bytecode::PCIFilterIsNull : Bytecode::PCIFilterIsNotNull;
+    Emitter()->EmitPCIVectorFilterNull(bytecode, ret_val, pci, col_idx);
+    return;
+  }
+
+  auto col_type = static_cast<int8_t>(args[2]->As<ast::LitExpr>()->Int64Val());
+
+  if (builtin == ast::Builtin::FilterBetween) {
+    LocalVar lo = VisitExpressionForLValue(args[3]);
+    LocalVar hi = VisitExpressionForLValue(args[4]);
+    Emitter()->EmitPCIVectorFilterBetween(ret_val, pci, col_idx, col_type, lo, hi);
+    return;
+  }
+
+  if (builtin == ast::Builtin::FilterIn) {
+    auto *list_type = args[3]->GetType()->As<ast::ArrayType>();
+    LocalVar list = VisitExpressionForLValue(args[3]);
+    Emitter()->EmitPCIVectorFilterIn(ret_val, pci, col_idx, col_type, list,
+                                     static_cast<uint32_t>(list_type->Length()));
+    return;
+  }
+
+  // Each comparison has one bytecode per flavor: integer constant, SQL value, column, and arithmetic
+  Bytecode bytecodes[4];
   switch (builtin) {
     case ast::Builtin::FilterEq: {
-      bytecode = Bytecode::PCIFilterEqual;
+      bytecodes[0] = Bytecode::PCIFilterEqual;
+      bytecodes[1] = Bytecode::PCIFilterEqualSql;
+      bytecodes[2] = Bytecode::PCIFilterEqualColumn;
+      bytecodes[3] = Bytecode::PCIFilterEqualArith;
       break;
     }
     case ast::Builtin::FilterGt: {
-      bytecode = Bytecode::PCIFilterGreaterThan;
+      bytecodes[0] = Bytecode::PCIFilterGreaterThan;
+      bytecodes[1] = Bytecode::PCIFilterGreaterThanSql;
+      bytecodes[2] = Bytecode::PCIFilterGreaterThanColumn;
+      bytecodes[3] = Bytecode::PCIFilterGreaterThanArith;
       break;
     }
     case ast::Builtin::FilterGe: {
-      bytecode = Bytecode::PCIFilterGreaterThanEqual;
+      bytecodes[0] = Bytecode::PCIFilterGreaterThanEqual;
+      bytecodes[1] = Bytecode::PCIFilterGreaterThanEqualSql;
+      bytecodes[2] = Bytecode::PCIFilterGreaterThanEqualColumn;
+      bytecodes[3] = Bytecode::PCIFilterGreaterThanEqualArith;
       break;
     }
     case ast::Builtin::FilterLt: {
-      bytecode = Bytecode::PCIFilterLessThan;
+      bytecodes[0] = Bytecode::PCIFilterLessThan;
+      bytecodes[1] = Bytecode::PCIFilterLessThanSql;
+      bytecodes[2] = Bytecode::PCIFilterLessThanColumn;
+      bytecodes[3] = Bytecode::PCIFilterLessThanArith;
       break;
     }
     case ast::Builtin::FilterLe: {
-      bytecode = Bytecode::PCIFilterLessThanEqual;
+      bytecodes[0] = Bytecode::PCIFilterLessThanEqual;
+      bytecodes[1] = Bytecode::PCIFilterLessThanEqualSql;
+      bytecodes[2] = Bytecode::PCIFilterLessThanEqualColumn;
+      bytecodes[3] = Bytecode::PCIFilterLessThanEqualArith;
       break;
     }
     case ast::Builtin::FilterNe: {
-      bytecode = Bytecode::PCIFilterNotEqual;
+      bytecodes[0] = Bytecode::PCIFilterNotEqual;
+      bytecodes[1] = Bytecode::PCIFilterNotEqualSql;
+      bytecodes[2] = Bytecode::PCIFilterNotEqualColumn;
+      bytecodes[3] = Bytecode::PCIFilterNotEqualArith;
       break;
     }
     default: {
       UNREACHABLE("Impossible bytecode");
     }
   }
-  Emitter()->EmitPCIVectorFilter(bytecode, ret_val, pci, col_idx, col_type, val);
+
+  switch (args.size()) {
+    case 4: {
+      if (args[3]->GetType()->IsSqlValueType()) {
+        LocalVar val = VisitExpressionForLValue(args[3]);
+        Emitter()->EmitPCIVectorFilterSql(bytecodes[1], ret_val, pci, col_idx, col_type, val);
+        break;
+      }
+      // Legacy integer constant, possibly negated
+      int64_t val;
+      if (auto *unary = args[3]->SafeAs<ast::UnaryOpExpr>()) {
+        val = -unary->Expression()->As<ast::LitExpr>()->Int64Val();
+      } else {
+        val = args[3]->As<ast::LitExpr>()->Int64Val();
+      }
+      Emitter()->EmitPCIVectorFilter(bytecodes[0], ret_val, pci, col_idx, col_type, val);
+      break;
+    }
+    case 5: {
+      auto col_idx_2 = static_cast<uint16_t>(args[3]->As<ast::LitExpr>()->Int64Val());
+      auto col_type_2 = static_cast<int8_t>(args[4]->As<ast::LitExpr>()->Int64Val());
+      Emitter()->EmitPCIVectorFilterColumn(bytecodes[2], ret_val, pci, col_idx, col_type, col_idx_2, col_type_2);
+      break;
+    }
+    default: {
+      auto arith_op = static_cast<int8_t>(args[3]->As<ast::LitExpr>()->Int64Val());
+      LocalVar operand = VisitExpressionForLValue(args[4]);
+      LocalVar val = VisitExpressionForLValue(args[5]);
+      Emitter()->EmitPCIVectorFilterArith(bytecodes[3], ret_val, pci, col_idx, col_type, arith_op, operand, val);
+      break;
+    }
+  }
 }
 
 void BytecodeGenerator::VisitBuiltinAggHashTableCall(ast::CallExpr *call, ast::Builtin builtin) {
@@ -1236,7 +1322,15 @@ void BytecodeGenerator::VisitBuiltinJoinHashTableCall(ast::CallExpr *call, ast::
       LocalVar join_hash_table = VisitExpressionForRValue(call->Arguments()[0]);
       LocalVar memory = VisitExpressionForRValue(call->Arguments()[1]);
       LocalVar entry_size = VisitExpressionForRValue(call->Arguments()[2]);
-      Emitter()->Emit(Bytecode::JoinHashTableInit, join_hash_table, memory, entry_size);
+      LocalVar use_partitioned_build;
+      if (call->NumArgs() > 3) {
+        use_partitioned_build = VisitExpressionForRValue(call->Arguments()[3]);
+      } else {
+        ast::Context *ctx = call->GetType()->GetContext();
+        use_partitioned_build = CurrentFunction()->NewLocal(ast::BuiltinType::Get(ctx, ast::BuiltinType::Bool));
+        Emitter()->EmitAssignImm1(use_partitioned_build, 0);
+      }
+      Emitter()->Emit(Bytecode::JoinHashTableInit, join_hash_table, memory, entry_size, use_partitioned_build);
       break;
     }
     case ast::Builtin::JoinHashTableInsert: {
@@ -1280,6 +1374,61 @@ void BytecodeGenerator::VisitBuiltinJoinHashTableCall(ast::CallExpr *call, ast::
       Emitter()->Emit(Bytecode::JoinHashTableIterClose, iterator);
       break;
     }
+    case ast::Builtin::JoinHashTablePartIterInit: {
+      LocalVar iterator = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar build_table = VisitExpressionForRValue(call->Arguments()[1]);
+      LocalVar probe_table = VisitExpressionForRValue(call->Arguments()[2]);
+      Emitter()->Emit(Bytecode::JoinHashTablePartIterInit, iterator, build_table, probe_table);
+      break;
+    }
+    case ast::Builtin::JoinHashTablePartIterHasNext: {
+      LocalVar has_more = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar iterator = VisitExpressionForRValue(call->Arguments()[0]);
+      const std::string key_eq_name = call->Arguments()[1]->As<ast::IdentifierExpr>()->Name().Data();
+      LocalVar opaque_ctx = VisitExpressionForRValue(call->Arguments()[2]);
+      Emitter()->EmitJoinHashTablePartIterHasNext(has_more, iterator, LookupFuncIdByName(key_eq_name), opaque_ctx);
+      ExecutionResult()->SetDestination(has_more.ValueOf());
+      break;
+    }
+    case ast::Builtin::JoinHashTablePartIterGetProbeRow:
+    case ast::Builtin::JoinHashTablePartIterGetBuildRow: {
+      LocalVar dest = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar iterator = VisitExpressionForRValue(call->Arguments()[0]);
+      Emitter()->Emit(builtin == ast::Builtin::JoinHashTablePartIterGetProbeRow
+                          ? Bytecode::JoinHashTablePartIterGetProbeRow
+                          : Bytecode::JoinHashTablePartIterGetBuildRow,
+                      dest, iterator);
+      break;
+    }
+    case ast::Builtin::JoinHashTablePartIterClose: {
+      LocalVar iterator = VisitExpressionForRValue(call->Arguments()[0]);
+      Emitter()->Emit(Bytecode::JoinHashTablePartIterClose, iterator);
+      break;
+    }
+    case ast::Builtin::JoinHashTableEntryIterInit: {
+      LocalVar iterator = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar join_hash_table = VisitExpressionForRValue(call->Arguments()[1]);
+      Emitter()->Emit(Bytecode::JoinHashTableEntryIterInit, iterator, join_hash_table);
+      break;
+    }
+    case ast::Builtin::JoinHashTableEntryIterHasNext: {
+      LocalVar has_more = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar iterator = VisitExpressionForRValue(call->Arguments()[0]);
+      Emitter()->Emit(Bytecode::JoinHashTableEntryIterHasNext, has_more, iterator);
+      ExecutionResult()->SetDestination(has_more.ValueOf());
+      break;
+    }
+    case ast::Builtin::JoinHashTableEntryIterGetRow: {
+      LocalVar dest = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar iterator = VisitExpressionForRValue(call->Arguments()[0]);
+      Emitter()->Emit(Bytecode::JoinHashTableEntryIterGetRow, dest, iterator);
+      break;
+    }
+    case ast::Builtin::JoinHashTableEntryIterClose: {
+      LocalVar iterator = VisitExpressionForRValue(call->Arguments()[0]);
+      Emitter()->Emit(Bytecode::JoinHashTableEntryIterClose, iterator);
+      break;
+    }
     case ast::Builtin::JoinHashTableBuildParallel: {
       LocalVar join_hash_table = VisitExpressionForRValue(call->Arguments()[0]);
       LocalVar tls = VisitExpressionForRValue(call->Arguments()[1]);
@@ -1292,6 +1441,45 @@ void BytecodeGenerator::VisitBuiltinJoinHashTableCall(ast::CallExpr *call, ast::
       Emitter()->Emit(Bytecode::JoinHashTableFree, join_hash_table);
       break;
     }
+    case ast::Builtin::JoinHashTableVectorProbeInit: {
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar join_hash_table = VisitExpressionForRValue(call->Arguments()[1]);
+      Emitter()->Emit(Bytecode::JoinHashTableVectorProbeInit, probe, join_hash_table);
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeAddKey: {
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar col_idx = VisitExpressionForRValue(call->Arguments()[1]);
+      LocalVar type = VisitExpressionForRValue(call->Arguments()[2]);
+      LocalVar build_offset = VisitExpressionForRValue(call->Arguments()[3]);
+      Emitter()->Emit(Bytecode::JoinHashTableVectorProbeAddKey, probe, col_idx, type, build_offset);
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbePrepare: {
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar pci = VisitExpressionForRValue(call->Arguments()[1]);
+      Emitter()->Emit(Bytecode::JoinHashTableVectorProbePrepare, probe, pci);
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeHasNext: {
+      LocalVar has_more = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar pci = VisitExpressionForRValue(call->Arguments()[1]);
+      Emitter()->Emit(Bytecode::JoinHashTableVectorProbeHasNext, has_more, probe, pci);
+      ExecutionResult()->SetDestination(has_more.ValueOf());
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeGetRow: {
+      LocalVar dest = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      Emitter()->Emit(Bytecode::JoinHashTableVectorProbeGetRow, dest, probe);
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeFree: {
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      Emitter()->Emit(Bytecode::JoinHashTableVectorProbeFree, probe);
+      break;
+    }
     default: {
       UNREACHABLE("Impossible bytecode");
     }
@@ -1382,6 +1570,11 @@ void BytecodeGenerator::VisitBuiltinSorterIterCall(ast::CallExpr *call, ast::Bui
       Emitter()->Emit(Bytecode::SorterIteratorNext, sorter_iter);
       break;
     }
+    case ast::Builtin::SorterIterSkipRows: {
+      LocalVar num_rows = VisitExpressionForRValue(call->Arguments()[1]);
+      Emitter()->Emit(Bytecode::SorterIteratorSkipRows, sorter_iter, num_rows);
+      break;
+    }
     case ast::Builtin::SorterIterGetRow: {
       LocalVar row_ptr =
           ExecutionResult()->GetOrCreateDestination(ast::BuiltinType::Get(ctx, ast::BuiltinType::Uint8)->PointerTo());
@@ -1521,6 +1714,15 @@ void BytecodeGenerator::VisitBuiltinTrigCall(ast::CallExpr *call, ast::Builtin b
   ExecutionResult()->SetDestination(dest.ValueOf());
 }
 
+void BytecodeGenerator::VisitBuiltinOffsetOfCall(ast::CallExpr *call) {
+  auto *struct_type = call->Arguments()[0]->GetType()->As<ast::StructType>();
+  auto *field = call->Arguments()[1]->As<ast::IdentifierExpr>();
+  LocalVar offset_var = ExecutionResult()->GetOrCreateDestination(
+      ast::BuiltinType::Get(struct_type->GetContext(), ast::BuiltinType::Uint32));
+  Emitter()->EmitAssignImm4(offset_var, struct_type->GetOffsetOfFieldByName(field->Name()));
+  ExecutionResult()->SetDestination(offset_var.ValueOf());
+}
+
 void BytecodeGenerator::VisitBuiltinSizeOfCall(ast::CallExpr *call) {
   ast::Type *target_type = call->Arguments()[0]->GetType();
   LocalVar size_var = ExecutionResult()->GetOrCreateDestination(
@@ -1612,6 +1814,18 @@ void BytecodeGenerator::VisitBuiltinIndexIteratorCall(ast::CallExpr *call, ast::
       Emitter()->Emit(Bytecode::IndexIteratorScanLimitDescending, iterator, limit);
       break;
     }
+    case ast::Builtin::IndexIteratorScanKeyBatch: {
+      Emitter()->Emit(Bytecode::IndexIteratorScanKeyBatch, iterator);
+      break;
+    }
+    case ast::Builtin::IndexIteratorNextBatchKey: {
+      Emitter()->Emit(Bytecode::IndexIteratorNextBatchKey, iterator);
+      break;
+    }
+    case ast::Builtin::IndexIteratorSetKeyOnly: {
+      Emitter()->Emit(Bytecode::IndexIteratorSetKeyOnly, iterator);
+      break;
+    }
     case ast::Builtin::IndexIteratorAdvance: {
       LocalVar cond = ExecutionResult()->GetOrCreateDestination(ast::BuiltinType::Get(ctx, ast::BuiltinType::Bool));
       Emitter()->Emit(Bytecode::IndexIteratorAdvance, cond, iterator);
@@ -1642,6 +1856,16 @@ void BytecodeGenerator::VisitBuiltinIndexIteratorCall(ast::CallExpr *call, ast::
       Emitter()->Emit(Bytecode::IndexIteratorGetTablePR, pr, iterator);
       break;
     }
+    case ast::Builtin::IndexIteratorGetKeyPR: {
+      LocalVar pr = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      Emitter()->Emit(Bytecode::IndexIteratorGetKeyPR, pr, iterator);
+      break;
+    }
+    case ast::Builtin::IndexIteratorAddBatchKey: {
+      LocalVar pr = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      Emitter()->Emit(Bytecode::IndexIteratorAddBatchKey, pr, iterator);
+      break;
+    }
     case ast::Builtin::IndexIteratorGetSlot: {
       LocalVar pr = ExecutionResult()->GetOrCreateDestination(call->GetType());
       Emitter()->Emit(Bytecode::IndexIteratorGetSlot, pr, iterator);
@@ -2076,7 +2300,11 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::FilterGe:
     case ast::Builtin::FilterLt:
     case ast::Builtin::FilterLe:
-    case ast::Builtin::FilterNe: {
+    case ast::Builtin::FilterNe:
+    case ast::Builtin::FilterBetween:
+    case ast::Builtin::FilterIn:
+    case ast::Builtin::FilterIsNull:
+    case ast::Builtin::FilterIsNotNull: {
       VisitBuiltinFilterCall(call, builtin);
       break;
     }
@@ -2099,7 +2327,8 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::TableIterAdvance:
     case ast::Builtin::TableIterReset:
     case ast::Builtin::TableIterGetPCI:
-    case ast::Builtin::TableIterClose: {
+    case ast::Builtin::TableIterClose:
+    case ast::Builtin::TableIterFilterBlocks: {
       VisitBuiltinTableIterCall(call, builtin);
       break;
     }
@@ -2190,9 +2419,24 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::JoinHashTableIterGetRow:
     case ast::Builtin::JoinHashTableIterHasNext:
     case ast::Builtin::JoinHashTableIterClose:
+    case ast::Builtin::JoinHashTablePartIterInit:
+    case ast::Builtin::JoinHashTablePartIterHasNext:
+    case ast::Builtin::JoinHashTablePartIterGetProbeRow:
+    case ast::Builtin::JoinHashTablePartIterGetBuildRow:
+    case ast::Builtin::JoinHashTablePartIterClose:
+    case ast::Builtin::JoinHashTableEntryIterInit:
+    case ast::Builtin::JoinHashTableEntryIterHasNext:
+    case ast::Builtin::JoinHashTableEntryIterGetRow:
+    case ast::Builtin::JoinHashTableEntryIterClose:
     case ast::Builtin::JoinHashTableBuild:
     case ast::Builtin::JoinHashTableBuildParallel:
-    case ast::Builtin::JoinHashTableFree: {
+    case ast::Builtin::JoinHashTableFree:
+    case ast::Builtin::JoinHashTableVectorProbeInit:
+    case ast::Builtin::JoinHashTableVectorProbeAddKey:
+    case ast::Builtin::JoinHashTableVectorProbePrepare:
+    case ast::Builtin::JoinHashTableVectorProbeHasNext:
+    case ast::Builtin::JoinHashTableVectorProbeGetRow:
+    case ast::Builtin::JoinHashTableVectorProbeFree: {
       VisitBuiltinJoinHashTableCall(call, builtin);
       break;
     }
@@ -2210,6 +2454,7 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::SorterIterInit:
     case ast::Builtin::SorterIterHasNext:
     case ast::Builtin::SorterIterNext:
+    case ast::Builtin::SorterIterSkipRows:
     case ast::Builtin::SorterIterGetRow:
     case ast::Builtin::SorterIterClose: {
       VisitBuiltinSorterIterCall(call, builtin);
@@ -2233,6 +2478,10 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
       VisitBuiltinSizeOfCall(call);
       break;
     }
+    case ast::Builtin::OffsetOf: {
+      VisitBuiltinOffsetOfCall(call);
+      break;
+    }
     case ast::Builtin::PtrCast: {
       Visit(call->Arguments()[1]);
       break;
@@ -2247,12 +2496,17 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::IndexIteratorScanAscending:
     case ast::Builtin::IndexIteratorScanDescending:
     case ast::Builtin::IndexIteratorScanLimitDescending:
+    case ast::Builtin::IndexIteratorScanKeyBatch:
+    case ast::Builtin::IndexIteratorNextBatchKey:
+    case ast::Builtin::IndexIteratorSetKeyOnly:
     case ast::Builtin::IndexIteratorAdvance:
     case ast::Builtin::IndexIteratorFree:
     case ast::Builtin::IndexIteratorGetPR:
     case ast::Builtin::IndexIteratorGetLoPR:
     case ast::Builtin::IndexIteratorGetHiPR:
     case ast::Builtin::IndexIteratorGetTablePR:
+    case ast::Builtin::IndexIteratorGetKeyPR:
+    case ast::Builtin::IndexIteratorAddBatchKey:
     case ast::Builtin::IndexIteratorGetSlot:
       VisitBuiltinIndexIteratorCall(call, builtin);
       break;
@@ -2901,6 +3155,22 @@ FunctionId BytecodeGenerator::LookupFuncIdByName(const std::string &name) const
   return iter->second;
 }
 
+void BytecodeGenerator::FillFlavorIds() {
+  // A flavor is identified by its name and bytecode rather than by the address of its compiled function, which
+  // differs every time the same code is compiled, so that filter managers find what earlier compilations learned
+  std::vector<common::hash_t> ids;
+  for (const auto &[pos, func_id] : flavor_ids_) {
+    const FunctionInfo &func = functions_[func_id];
+    const auto [start, end] = func.BytecodeRange();
+    ids.push_back(common::HashUtil::CombineHashes(
+        common::HashUtil::Hash(func.Name()),
+        common::HashUtil::HashBytes(reinterpret_cast<const byte *>(&bytecode_[start]), end - start)));
+  }
+  for (uint32_t idx = 0; idx < flavor_ids_.size(); idx++) {
+    std::memcpy(&bytecode_[flavor_ids_[idx].first], &ids[idx], sizeof(int64_t));
+  }
+}
+
 LocalVar BytecodeGenerator::VisitExpressionForLValue(ast::Expr *expr) {
   LValueResultScope scope(this);
   Visit(expr);
@@ -2959,6 +3229,7 @@ std::unique_ptr<BytecodeModule> BytecodeGenerator::Compile(ast::AstNode *root, e
                                                            const std::string &name) {
   BytecodeGenerator generator{exec_ctx};
   generator.Visit(root);
+  generator.FillFlavorIds();
 
   // Create the bytecode module. Note that we move the bytecode and functions
   // array from the generator into the module.
@@ -1,8 +1,82 @@
 #include "execution/vm/bytecode_handlers.h"
 
+#include <vector>
+
 #include "catalog/catalog_defs.h"
 #include "execution/exec/execution_context.h"
 #include "execution/sql/projected_columns_iterator.h"
+#include "execution/sql/value.h"
+
+namespace {
+
+using terrier::execution::sql::ProjectedColumnsIterator;
+
+// Convert a SQL value into a filter value for a column of the given type.
+ProjectedColumnsIterator::FilterVal MakeFilterVal(const terrier::execution::sql::Val *val,
+                                                  const terrier::type::TypeId type) {
+  namespace sql = terrier::execution::sql;
+  TERRIER_ASSERT(!val->is_null_, "Vectorized filters cannot compare against NULL");
+  switch (type) {
+    case terrier::type::TypeId::BOOLEAN:
+      return ProjectedColumnsIterator::FilterVal{.b_ = static_cast<const sql::BoolVal *>(val)->val_};
+    case terrier::type::TypeId::TINYINT:
+    case terrier::type::TypeId::SMALLINT:
+    case terrier::type::TypeId::INTEGER:
+    case terrier::type::TypeId::BIGINT:
+      return ProjectedColumnsIterator::MakeFilterVal(static_cast<const sql::Integer *>(val)->val_, type);
+    case terrier::type::TypeId::DECIMAL:
+      return ProjectedColumnsIterator::FilterVal{.r_ = static_cast<const sql::Real *>(val)->val_};
+    case terrier::type::TypeId::DATE:
+      return ProjectedColumnsIterator::FilterVal{.d_ = static_cast<const sql::DateVal *>(val)->val_.ToNative()};
+    case terrier::type::TypeId::TIMESTAMP:
+      return ProjectedColumnsIterator::FilterVal{.ts_ = static_cast<const sql::TimestampVal *>(val)->val_.ToNative()};
+    case terrier::type::TypeId::VARCHAR:
+    case terrier::type::TypeId::VARBINARY:
+      return ProjectedColumnsIterator::FilterVal{
+          .str_ = sql::StringVal::CreateVarlen(*static_cast<const sql::StringVal *>(val), false)};
+    default:
+      throw std::runtime_error("Filter not supported on type");
+  }
+}
+
+// Convert a SQL value into the operand of an arithmetic filter, which is computed in 64-bit integer arithmetic for
+// integer columns, and double arithmetic otherwise.
+ProjectedColumnsIterator::FilterVal MakeArithFilterVal(const terrier::execution::sql::Val *val,
+                                                       const terrier::type::TypeId type) {
+  namespace sql = terrier::execution::sql;
+  TERRIER_ASSERT(!val->is_null_, "Vectorized filters cannot compare against NULL");
+  if (type == terrier::type::TypeId::DECIMAL) {
+    return ProjectedColumnsIterator::FilterVal{.r_ = static_cast<const sql::Real *>(val)->val_};
+  }
+  return ProjectedColumnsIterator::FilterVal{.bi_ = static_cast<const sql::Integer *>(val)->val_};
+}
+
+// Return the size of a single element in an array of SQL values of the given type.
+uint32_t SqlValStride(const terrier::type::TypeId type) {
+  namespace sql = terrier::execution::sql;
+  switch (type) {
+    case terrier::type::TypeId::BOOLEAN:
+      return sizeof(sql::BoolVal);
+    case terrier::type::TypeId::TINYINT:
+    case terrier::type::TypeId::SMALLINT:
+    case terrier::type::TypeId::INTEGER:
+    case terrier::type::TypeId::BIGINT:
+      return sizeof(sql::Integer);
+    case terrier::type::TypeId::DECIMAL:
+      return sizeof(sql::Real);
+    case terrier::type::TypeId::DATE:
+      return sizeof(sql::DateVal);
+    case terrier::type::TypeId::TIMESTAMP:
+      return sizeof(sql::TimestampVal);
+    case terrier::type::TypeId::VARCHAR:
+    case terrier::type::TypeId::VARBINARY:
+      return sizeof(sql::StringVal);
+    default:
+      throw std::runtime_error("Filter not supported on type");
+  }
+}
+
+}  // namespace
 
 extern "C" {
 
@@ -42,6 +116,11 @@ void OpTableVectorIteratorFree(terrier::execution::sql::TableVectorIterator *ite
   iter->~TableVectorIterator();
 }
 
+void OpTableVectorIteratorFilterBlocks(terrier::execution::sql::TableVectorIterator *iter, uint32_t col_idx,
+                                       int8_t type, int64_t lo, int64_t hi) {
+  iter->FilterBlocks(col_idx, static_cast<terrier::type::TypeId>(type), lo, hi);
+}
+
 void OpPCIFilterEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter, uint32_t col_idx,
                       int8_t type, int64_t val) {
   auto sql_type = static_cast<terrier::type::TypeId>(type);
@@ -84,6 +163,54 @@ void OpPCIFilterNotEqual(uint64_t *size, terrier::execution::sql::ProjectedColum
   *size = iter->FilterColByVal<std::not_equal_to>(col_idx, sql_type, v);
 }
 
+#define GEN_PCI_FILTER_OPS(Op, Comparison)                                                                       \
+  void OpPCIFilter##Op##Sql(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,             \
+                            uint32_t col_idx, int8_t type, const terrier::execution::sql::Val *val) {            \
+    auto sql_type = static_cast<terrier::type::TypeId>(type);                                                    \
+    *size = iter->FilterColByVal<Comparison>(col_idx, sql_type, MakeFilterVal(val, sql_type));                   \
+  }                                                                                                              \
+  void OpPCIFilter##Op##Column(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,          \
+                               uint32_t col_idx_1, int8_t type_1, uint32_t col_idx_2, int8_t type_2) {           \
+    *size = iter->FilterColByCol<Comparison>(col_idx_1, static_cast<terrier::type::TypeId>(type_1), col_idx_2,   \
+                                             static_cast<terrier::type::TypeId>(type_2));                        \
+  }                                                                                                              \
+  void OpPCIFilter##Op##Arith(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,           \
+                              uint32_t col_idx, int8_t type, int8_t arith_op,                                    \
+                              const terrier::execution::sql::Val *operand,                                       \
+                              const terrier::execution::sql::Val *val) {                                         \
+    auto sql_type = static_cast<terrier::type::TypeId>(type);                                                    \
+    *size = iter->FilterColArithByVal<Comparison>(col_idx, sql_type,                                             \
+                                                  static_cast<ProjectedColumnsIterator::ArithmeticOp>(arith_op), \
+                                                  MakeArithFilterVal(operand, sql_type),                         \
+                                                  MakeArithFilterVal(val, sql_type));                            \
+  }
+GEN_PCI_FILTER_OPS(Equal, std::equal_to)
+GEN_PCI_FILTER_OPS(GreaterThan, std::greater)
+GEN_PCI_FILTER_OPS(GreaterThanEqual, std::greater_equal)
+GEN_PCI_FILTER_OPS(LessThan, std::less)
+GEN_PCI_FILTER_OPS(LessThanEqual, std::less_equal)
+GEN_PCI_FILTER_OPS(NotEqual, std::not_equal_to)
+#undef GEN_PCI_FILTER_OPS
+
+void OpPCIFilterBetween(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter, uint32_t col_idx,
+                        int8_t type, const terrier::execution::sql::Val *lo, const terrier::execution::sql::Val *hi) {
+  auto sql_type = static_cast<terrier::type::TypeId>(type);
+  *size = iter->FilterColBetween(col_idx, sql_type, MakeFilterVal(lo, sql_type), MakeFilterVal(hi, sql_type));
+}
+
+void OpPCIFilterIn(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter, uint32_t col_idx,
+                   int8_t type, const terrier::byte *list, uint32_t num_vals) {
+  auto sql_type = static_cast<terrier::type::TypeId>(type);
+  const uint32_t stride = SqlValStride(sql_type);
+  std::vector<ProjectedColumnsIterator::FilterVal> vals;
+  vals.reserve(num_vals);
+  for (uint32_t i = 0; i < num_vals; i++) {
+    const auto *val = reinterpret_cast<const terrier::execution::sql::Val *>(list + i * stride);
+    vals.emplace_back(MakeFilterVal(val, sql_type));
+  }
+  *size = iter->FilterColIn(col_idx, sql_type, vals.data(), num_vals);
+}
+
 // ---------------------------------------------------------
 // Filter Manager
 // ---------------------------------------------------------
@@ -97,8 +224,8 @@ void OpFilterManagerStartNewClause(terrier::execution::sql::FilterManager *filte
 }
 
 void OpFilterManagerInsertFlavor(terrier::execution::sql::FilterManager *filter_manager,
-                                 terrier::execution::sql::FilterManager::MatchFn flavor) {
-  filter_manager->InsertClauseFlavor(flavor);
+                                 terrier::execution::sql::FilterManager::MatchFn flavor, int64_t flavor_id) {
+  filter_manager->InsertClauseFlavor(flavor, static_cast<uint64_t>(flavor_id));
 }
 
 void OpFilterManagerFinalize(terrier::execution::sql::FilterManager *filter_manager) { filter_manager->Finalize(); }
@@ -115,8 +242,8 @@ void OpFilterManagerFree(terrier::execution::sql::FilterManager *filter_manager)
 // ---------------------------------------------------------
 
 void OpJoinHashTableInit(terrier::execution::sql::JoinHashTable *join_hash_table,
-                         terrier::execution::sql::MemoryPool *memory, uint32_t tuple_size) {
-  new (join_hash_table) terrier::execution::sql::JoinHashTable(memory, tuple_size);
+                         terrier::execution::sql::MemoryPool *memory, uint32_t tuple_size, bool use_partitioned_build) {
+  new (join_hash_table) terrier::execution::sql::JoinHashTable(memory, tuple_size, false, use_partitioned_build);
 }
 
 void OpJoinHashTableBuild(terrier::execution::sql::JoinHashTable *join_hash_table) { join_hash_table->Build(); }
@@ -129,6 +256,36 @@ void OpJoinHashTableBuildParallel(terrier::execution::sql::JoinHashTable *join_h
 
 void OpJoinHashTableFree(terrier::execution::sql::JoinHashTable *join_hash_table) { join_hash_table->~JoinHashTable(); }
 
+void OpJoinHashTablePartIterInit(terrier::execution::sql::JoinHashTablePartitionIterator *iterator,
+                                 terrier::execution::sql::JoinHashTable *build_table,
+                                 terrier::execution::sql::JoinHashTable *probe_table) {
+  new (iterator) terrier::execution::sql::JoinHashTablePartitionIterator(*build_table, probe_table);
+}
+
+void OpJoinHashTableEntryIterInit(terrier::execution::sql::JoinHashTableEntryIterator *iterator,
+                                  terrier::execution::sql::JoinHashTable *join_hash_table) {
+  new (iterator) terrier::execution::sql::JoinHashTableEntryIterator(*join_hash_table);
+}
+
+void OpJoinHashTableVectorProbeInit(terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                    terrier::execution::sql::JoinHashTable *join_hash_table) {
+  new (probe) terrier::execution::sql::JoinHashTableVectorProbe(*join_hash_table);
+}
+
+void OpJoinHashTableVectorProbeAddKey(terrier::execution::sql::JoinHashTableVectorProbe *probe, uint32_t col_idx,
+                                      int32_t type, uint32_t build_offset) {
+  probe->AddKey(col_idx, static_cast<terrier::type::TypeId>(type), build_offset);
+}
+
+void OpJoinHashTableVectorProbePrepare(terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                       terrier::execution::sql::ProjectedColumnsIterator *pci) {
+  probe->Prepare(pci);
+}
+
+void OpJoinHashTableVectorProbeFree(terrier::execution::sql::JoinHashTableVectorProbe *probe) {
+  probe->~JoinHashTableVectorProbe();
+}
+
 // ---------------------------------------------------------
 // Aggregation Hash Table
 // ---------------------------------------------------------
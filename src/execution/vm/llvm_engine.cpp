@@ -561,8 +561,9 @@ void LLVMEngine::CompiledModuleBuilder::BuildSimpleCFG(const FunctionInfo &func_
       if (Bytecodes::IsTerminal(bytecode)) {
         if (Bytecodes::IsJump(bytecode)) {
           // Unconditional Jump
-          std::size_t branch_target_pos =
-              iter.GetPosition() + Bytecodes::GetNthOperandOffset(bytecode, 0) + iter.GetJumpOffsetOperand(0);
+          const uint32_t jump_operand = Bytecodes::GetJumpOffsetOperandIndex(bytecode);
+          std::size_t branch_target_pos = iter.GetPosition() + Bytecodes::GetNthOperandOffset(bytecode, jump_operand) +
+                                          iter.GetJumpOffsetOperand(jump_operand);
 
           if (blocks->find(branch_target_pos) == blocks->end()) {
             (*blocks)[branch_target_pos] = nullptr;
@@ -582,8 +583,9 @@ void LLVMEngine::CompiledModuleBuilder::BuildSimpleCFG(const FunctionInfo &func_
           (*blocks)[fallthrough_pos] = nullptr;
         }
 
-        std::size_t branch_target_pos =
-            iter.GetPosition() + Bytecodes::GetNthOperandOffset(bytecode, 1) + iter.GetJumpOffsetOperand(1);
+        const uint32_t jump_operand = Bytecodes::GetJumpOffsetOperandIndex(bytecode);
+        std::size_t branch_target_pos = iter.GetPosition() + Bytecodes::GetNthOperandOffset(bytecode, jump_operand) +
+                                        iter.GetJumpOffsetOperand(jump_operand);
 
         if (blocks->find(branch_target_pos) == blocks->end()) {
           bb_begin_positions.push_back(branch_target_pos);
@@ -822,6 +824,30 @@ void LLVMEngine::CompiledModuleBuilder::DefineFunction(const FunctionInfo &func_
       }
 
       default: {
+        if (Bytecodes::IsFusedConditionalJump(bytecode)) {
+          //
+          // Fused conditional jumps call their handler to compute (and store)
+          // the branch condition, then branch on the returned condition as
+          // JumpIfFalse would.
+          //
+
+          const uint32_t jump_operand = Bytecodes::GetJumpOffsetOperandIndex(bytecode);
+          std::size_t fallthrough_bb_pos = iter.GetPosition() + iter.CurrentBytecodeSize();
+          std::size_t branch_target_bb_pos = iter.GetPosition() +
+                                             Bytecodes::GetNthOperandOffset(bytecode, jump_operand) +
+                                             iter.GetJumpOffsetOperand(jump_operand);
+          TERRIER_ASSERT(blocks[fallthrough_bb_pos] != nullptr,
+                         "Branch fallthrough does not point to valid basic block");
+          TERRIER_ASSERT(blocks[branch_target_bb_pos] != nullptr, "Branch target does not point to valid basic block");
+
+          llvm::Value *cond = issue_call(LookupBytecodeHandler(bytecode), args);
+          if (!cond->getType()->isIntegerTy(1)) {
+            cond = ir_builder->CreateICmpNE(cond, llvm::ConstantInt::get(cond->getType(), 0, false));
+          }
+          ir_builder->CreateCondBr(cond, blocks[fallthrough_bb_pos], blocks[branch_target_bb_pos]);
+          break;
+        }
+
         //
         // In the default case, each bytecode makes a function call into its
         // bytecode handler function.
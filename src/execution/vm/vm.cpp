@@ -449,6 +449,89 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  // -------------------------------------------------------
+  // Superinstructions
+  // -------------------------------------------------------
+
+#define GEN_LEA_DEREF(type, size)                          \
+  OP(LeaDeref##size) : {                                   \
+    auto **ptr = frame->LocalAt<byte **>(READ_LOCAL_ID()); \
+    auto *base = frame->LocalAt<byte *>(READ_LOCAL_ID());  \
+    auto offset = READ_UIMM4();                            \
+    auto *dest = frame->LocalAt<type *>(READ_LOCAL_ID());  \
+    OpLeaDeref##size(ptr, base, offset, dest);             \
+    DISPATCH_NEXT();                                       \
+  }
+  GEN_LEA_DEREF(int8_t, 1);
+  GEN_LEA_DEREF(int16_t, 2);
+  GEN_LEA_DEREF(int32_t, 4);
+  GEN_LEA_DEREF(int64_t, 8);
+#undef GEN_LEA_DEREF
+
+  // The fused conditional jumps keep the branch condition in a register
+  // rather than reloading it from the frame as a separate JumpIfFalse would.
+
+#define DO_GEN_COMPARISON_JUMP(op, type)                               \
+  OP(op##JumpIfFalse##_##type) : {                                     \
+    auto *dest = frame->LocalAt<bool *>(READ_LOCAL_ID());              \
+    auto lhs = frame->LocalAt<type>(READ_LOCAL_ID());                  \
+    auto rhs = frame->LocalAt<type>(READ_LOCAL_ID());                  \
+    auto skip = PEEK_JMP_OFFSET();                                     \
+    if (OpJumpIfFalse(Op##op##JumpIfFalse##_##type(dest, lhs, rhs))) { \
+      ip += skip;                                                      \
+    } else {                                                           \
+      READ_JMP_OFFSET();                                               \
+    }                                                                  \
+    DISPATCH_NEXT();                                                   \
+  }
+#define GEN_COMPARISON_JUMP_TYPES(type, ...)     \
+  DO_GEN_COMPARISON_JUMP(GreaterThan, type)      \
+  DO_GEN_COMPARISON_JUMP(GreaterThanEqual, type) \
+  DO_GEN_COMPARISON_JUMP(Equal, type)            \
+  DO_GEN_COMPARISON_JUMP(LessThan, type)         \
+  DO_GEN_COMPARISON_JUMP(LessThanEqual, type)    \
+  DO_GEN_COMPARISON_JUMP(NotEqual, type)
+
+  INT_TYPES(GEN_COMPARISON_JUMP_TYPES)
+#undef GEN_COMPARISON_JUMP_TYPES
+#undef DO_GEN_COMPARISON_JUMP
+
+  OP(ForceBoolTruthJumpIfFalse) : {
+    auto *result = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *input = frame->LocalAt<sql::BoolVal *>(READ_LOCAL_ID());
+    auto skip = PEEK_JMP_OFFSET();
+    if (OpJumpIfFalse(OpForceBoolTruthJumpIfFalse(result, input))) {
+      ip += skip;
+    } else {
+      READ_JMP_OFFSET();
+    }
+    DISPATCH_NEXT();
+  }
+
+  OP(PCIHasNextJumpIfFalse) : {
+    auto *has_more = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto skip = PEEK_JMP_OFFSET();
+    if (OpJumpIfFalse(OpPCIHasNextJumpIfFalse(has_more, iter))) {
+      ip += skip;
+    } else {
+      READ_JMP_OFFSET();
+    }
+    DISPATCH_NEXT();
+  }
+
+  OP(PCIHasNextFilteredJumpIfFalse) : {
+    auto *has_more = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto skip = PEEK_JMP_OFFSET();
+    if (OpJumpIfFalse(OpPCIHasNextFilteredJumpIfFalse(has_more, iter))) {
+      ip += skip;
+    } else {
+      READ_JMP_OFFSET();
+    }
+    DISPATCH_NEXT();
+  }
+
   OP(Call) : {
     ip = ExecuteCall(ip, frame);
     DISPATCH_NEXT();
@@ -576,6 +659,16 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(TableVectorIteratorFilterBlocks) : {
+    auto *iter = frame->LocalAt<sql::TableVectorIterator *>(READ_LOCAL_ID());
+    auto col_idx = READ_UIMM4();
+    auto type = READ_IMM1();
+    auto lo = READ_IMM8();
+    auto hi = READ_IMM8();
+    OpTableVectorIteratorFilterBlocks(iter, col_idx, type, lo, hi);
+    DISPATCH_NEXT();
+  }
+
   OP(ParallelScanTable) : {
     auto db_oid = READ_UIMM4();
     auto table_oid = READ_UIMM4();
@@ -701,6 +794,83 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
   GEN_PCI_FILTER(NotEqual)
 #undef GEN_PCI_FILTER
 
+#define GEN_PCI_FILTER_OPS(Op)                                                                     \
+  OP(PCIFilter##Op##Sql) : {                                                                       \
+    auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());                                      \
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());                 \
+    auto col_idx = READ_UIMM4();                                                                   \
+    auto type = READ_IMM1();                                                                       \
+    auto *val = frame->LocalAt<const sql::Val *>(READ_LOCAL_ID());                                 \
+    OpPCIFilter##Op##Sql(size, iter, col_idx, type, val);                                          \
+    DISPATCH_NEXT();                                                                               \
+  }                                                                                                \
+  OP(PCIFilter##Op##Column) : {                                                                    \
+    auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());                                      \
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());                 \
+    auto col_idx_1 = READ_UIMM4();                                                                 \
+    auto type_1 = READ_IMM1();                                                                     \
+    auto col_idx_2 = READ_UIMM4();                                                                 \
+    auto type_2 = READ_IMM1();                                                                     \
+    OpPCIFilter##Op##Column(size, iter, col_idx_1, type_1, col_idx_2, type_2);                     \
+    DISPATCH_NEXT();                                                                               \
+  }                                                                                                \
+  OP(PCIFilter##Op##Arith) : {                                                                     \
+    auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());                                      \
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());                 \
+    auto col_idx = READ_UIMM4();                                                                   \
+    auto type = READ_IMM1();                                                                       \
+    auto arith_op = READ_IMM1();                                                                   \
+    auto *operand = frame->LocalAt<const sql::Val *>(READ_LOCAL_ID());                             \
+    auto *val = frame->LocalAt<const sql::Val *>(READ_LOCAL_ID());                                 \
+    OpPCIFilter##Op##Arith(size, iter, col_idx, type, arith_op, operand, val);                     \
+    DISPATCH_NEXT();                                                                               \
+  }
+  GEN_PCI_FILTER_OPS(Equal)
+  GEN_PCI_FILTER_OPS(GreaterThan)
+  GEN_PCI_FILTER_OPS(GreaterThanEqual)
+  GEN_PCI_FILTER_OPS(LessThan)
+  GEN_PCI_FILTER_OPS(LessThanEqual)
+  GEN_PCI_FILTER_OPS(NotEqual)
+#undef GEN_PCI_FILTER_OPS
+
+  OP(PCIFilterBetween) : {
+    auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto col_idx = READ_UIMM4();
+    auto type = READ_IMM1();
+    auto *lo = frame->LocalAt<const sql::Val *>(READ_LOCAL_ID());
+    auto *hi = frame->LocalAt<const sql::Val *>(READ_LOCAL_ID());
+    OpPCIFilterBetween(size, iter, col_idx, type, lo, hi);
+    DISPATCH_NEXT();
+  }
+
+  OP(PCIFilterIn) : {
+    auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto col_idx = READ_UIMM4();
+    auto type = READ_IMM1();
+    auto *list = frame->LocalAt<const byte *>(READ_LOCAL_ID());
+    auto num_vals = READ_UIMM4();
+    OpPCIFilterIn(size, iter, col_idx, type, list, num_vals);
+    DISPATCH_NEXT();
+  }
+
+  OP(PCIFilterIsNull) : {
+    auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto col_idx = READ_UIMM4();
+    OpPCIFilterIsNull(size, iter, col_idx);
+    DISPATCH_NEXT();
+  }
+
+  OP(PCIFilterIsNotNull) : {
+    auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto col_idx = READ_UIMM4();
+    OpPCIFilterIsNotNull(size, iter, col_idx);
+    DISPATCH_NEXT();
+  }
+
   // ------------------------------------------------------
   // Hashing
   // ------------------------------------------------------
@@ -753,7 +923,8 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     auto *filter_manager = frame->LocalAt<sql::FilterManager *>(READ_LOCAL_ID());
     auto func_id = READ_FUNC_ID();
     auto fn = reinterpret_cast<sql::FilterManager::MatchFn>(module_->GetRawFunctionImpl(func_id));
-    OpFilterManagerInsertFlavor(filter_manager, fn);
+    auto flavor_id = READ_IMM8();
+    OpFilterManagerInsertFlavor(filter_manager, fn, flavor_id);
     DISPATCH_NEXT();
   }
 
@@ -1300,7 +1471,8 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
     auto *memory = frame->LocalAt<sql::MemoryPool *>(READ_LOCAL_ID());
     auto tuple_size = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
-    OpJoinHashTableInit(join_hash_table, memory, tuple_size);
+    auto use_partitioned_build = frame->LocalAt<bool>(READ_LOCAL_ID());
+    OpJoinHashTableInit(join_hash_table, memory, tuple_size, use_partitioned_build);
     DISPATCH_NEXT();
   }
 
@@ -1344,6 +1516,72 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(JoinHashTablePartIterInit) : {
+    auto *iterator = frame->LocalAt<sql::JoinHashTablePartitionIterator *>(READ_LOCAL_ID());
+    auto *build_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    auto *probe_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    OpJoinHashTablePartIterInit(iterator, build_table, probe_table);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTablePartIterHasNext) : {
+    auto *has_more = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *iterator = frame->LocalAt<sql::JoinHashTablePartitionIterator *>(READ_LOCAL_ID());
+    auto cmp_func_id = READ_FUNC_ID();
+    auto cmp_fn =
+        reinterpret_cast<sql::JoinHashTablePartitionIterator::KeyEq>(module_->GetRawFunctionImpl(cmp_func_id));
+    auto *opaque_ctx = frame->LocalAt<void *>(READ_LOCAL_ID());
+    OpJoinHashTablePartIterHasNext(has_more, iterator, cmp_fn, opaque_ctx);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTablePartIterGetProbeRow) : {
+    auto *result = frame->LocalAt<const byte **>(READ_LOCAL_ID());
+    auto *iterator = frame->LocalAt<sql::JoinHashTablePartitionIterator *>(READ_LOCAL_ID());
+    OpJoinHashTablePartIterGetProbeRow(result, iterator);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTablePartIterGetBuildRow) : {
+    auto *result = frame->LocalAt<const byte **>(READ_LOCAL_ID());
+    auto *iterator = frame->LocalAt<sql::JoinHashTablePartitionIterator *>(READ_LOCAL_ID());
+    OpJoinHashTablePartIterGetBuildRow(result, iterator);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTablePartIterClose) : {
+    auto *iterator = frame->LocalAt<sql::JoinHashTablePartitionIterator *>(READ_LOCAL_ID());
+    OpJoinHashTablePartIterClose(iterator);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableEntryIterInit) : {
+    auto *iterator = frame->LocalAt<sql::JoinHashTableEntryIterator *>(READ_LOCAL_ID());
+    auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    OpJoinHashTableEntryIterInit(iterator, join_hash_table);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableEntryIterHasNext) : {
+    auto *has_more = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *iterator = frame->LocalAt<sql::JoinHashTableEntryIterator *>(READ_LOCAL_ID());
+    OpJoinHashTableEntryIterHasNext(has_more, iterator);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableEntryIterGetRow) : {
+    auto *result = frame->LocalAt<const byte **>(READ_LOCAL_ID());
+    auto *iterator = frame->LocalAt<sql::JoinHashTableEntryIterator *>(READ_LOCAL_ID());
+    OpJoinHashTableEntryIterGetRow(result, iterator);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableEntryIterClose) : {
+    auto *iterator = frame->LocalAt<sql::JoinHashTableEntryIterator *>(READ_LOCAL_ID());
+    OpJoinHashTableEntryIterClose(iterator);
+    DISPATCH_NEXT();
+  }
+
   OP(JoinHashTableBuild) : {
     auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
     OpJoinHashTableBuild(join_hash_table);
@@ -1364,6 +1602,50 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(JoinHashTableVectorProbeInit) : {
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    OpJoinHashTableVectorProbeInit(probe, join_hash_table);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbeAddKey) : {
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    auto col_idx = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    auto type = frame->LocalAt<int32_t>(READ_LOCAL_ID());
+    auto build_offset = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
+    OpJoinHashTableVectorProbeAddKey(probe, col_idx, type, build_offset);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbePrepare) : {
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    auto *pci = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    OpJoinHashTableVectorProbePrepare(probe, pci);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbeHasNext) : {
+    auto *has_more = frame->LocalAt<bool *>(READ_LOCAL_ID());
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    auto *pci = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    OpJoinHashTableVectorProbeHasNext(has_more, probe, pci);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbeGetRow) : {
+    auto *result = frame->LocalAt<const byte **>(READ_LOCAL_ID());
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    OpJoinHashTableVectorProbeGetRow(result, probe);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbeFree) : {
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    OpJoinHashTableVectorProbeFree(probe);
+    DISPATCH_NEXT();
+  }
+
   // -------------------------------------------------------
   // Sorting
   // -------------------------------------------------------
@@ -1450,6 +1732,13 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(SorterIteratorSkipRows) : {
+    auto *iter = frame->LocalAt<sql::SorterIterator *>(READ_LOCAL_ID());
+    auto num_rows = frame->LocalAt<uint64_t>(READ_LOCAL_ID());
+    OpSorterIteratorSkipRows(iter, num_rows);
+    DISPATCH_NEXT();
+  }
+
   OP(SorterIteratorGetRow) : {
     const auto **row = frame->LocalAt<const byte **>(READ_LOCAL_ID());
     auto *iter = frame->LocalAt<sql::SorterIterator *>(READ_LOCAL_ID());
@@ -1527,6 +1816,24 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(IndexIteratorScanKeyBatch) : {
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    OpIndexIteratorScanKeyBatch(iter);
+    DISPATCH_NEXT();
+  }
+
+  OP(IndexIteratorNextBatchKey) : {
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    OpIndexIteratorNextBatchKey(iter);
+    DISPATCH_NEXT();
+  }
+
+  OP(IndexIteratorSetKeyOnly) : {
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    OpIndexIteratorSetKeyOnly(iter);
+    DISPATCH_NEXT();
+  }
+
   OP(IndexIteratorFree) : {
     auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
     OpIndexIteratorFree(iter);
@@ -1568,6 +1875,20 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(IndexIteratorGetKeyPR) : {
+    auto *pr = frame->LocalAt<storage::ProjectedRow **>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    OpIndexIteratorGetKeyPR(pr, iter);
+    DISPATCH_NEXT();
+  }
+
+  OP(IndexIteratorAddBatchKey) : {
+    auto *pr = frame->LocalAt<storage::ProjectedRow **>(READ_LOCAL_ID());
+    auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
+    OpIndexIteratorAddBatchKey(pr, iter);
+    DISPATCH_NEXT();
+  }
+
   OP(IndexIteratorGetSlot) : {
     auto *slot = frame->LocalAt<storage::TupleSlot *>(READ_LOCAL_ID());
     auto *iter = frame->LocalAt<sql::IndexIterator *>(READ_LOCAL_ID());
@@ -19,8 +19,10 @@ class CompilerTest_SimpleAggregateTest_Test;
 class CompilerTest_CountStarTest_Test;
 class CompilerTest_SimpleSortTest_Test;
 class CompilerTest_SimpleAggregateHavingTest_Test;
+class CompilerTest_SortedAggregateTest_Test;
 class CompilerTest_SimpleHashJoinTest_Test;
 class CompilerTest_MultiWayHashJoinTest_Test;
+class CompilerTest_SimpleMergeJoinTest_Test;
 class CompilerTest_SimpleNestedLoopJoinTest_Test;
 class CompilerTest_SimpleIndexNestedLoopJoinTest_Test;
 class CompilerTest_SimpleIndexNestedLoopJoinMultiColumnTest_Test;
@@ -137,8 +139,10 @@ class PipelineOperatingUnits {
   friend class terrier::execution::compiler::test::CompilerTest_CountStarTest_Test;
   friend class terrier::execution::compiler::test::CompilerTest_SimpleSortTest_Test;
   friend class terrier::execution::compiler::test::CompilerTest_SimpleAggregateHavingTest_Test;
+  friend class terrier::execution::compiler::test::CompilerTest_SortedAggregateTest_Test;
   friend class terrier::execution::compiler::test::CompilerTest_SimpleHashJoinTest_Test;
   friend class terrier::execution::compiler::test::CompilerTest_MultiWayHashJoinTest_Test;
+  friend class terrier::execution::compiler::test::CompilerTest_SimpleMergeJoinTest_Test;
   friend class terrier::execution::compiler::test::CompilerTest_SimpleNestedLoopJoinTest_Test;
   friend class terrier::execution::compiler::test::CompilerTest_SimpleIndexNestedLoopJoinTest_Test;
   friend class terrier::execution::compiler::test::CompilerTest_SimpleIndexNestedLoopJoinMultiColumnTest_Test;
@@ -130,6 +130,11 @@ class Catalog {
    */
   common::ManagedPointer<storage::BlockStore> GetBlockStore() const;
 
+  /**
+   * @return the TransactionManager the Catalog begins its own transactions with
+   */
+  common::ManagedPointer<transaction::TransactionManager> GetTransactionManager() const { return txn_manager_; }
+
  private:
   DISALLOW_COPY_AND_MOVE(Catalog);
   friend class storage::RecoveryManager;
@@ -337,6 +337,17 @@ class CatalogAccessor {
    */
   common::ManagedPointer<storage::BlockStore> GetBlockStore() const;
 
+  /**
+   * @return TransactionManager for work that must run in transactions of its own, like catching a new index up with
+   * concurrent writes
+   */
+  common::ManagedPointer<transaction::TransactionManager> GetTransactionManager() const;
+
+  /**
+   * @return the transaction context this accessor operates in
+   */
+  common::ManagedPointer<transaction::TransactionContext> GetTxn() const { return txn_; }
+
   /**
    * Instantiates a new accessor into the catalog for the given database.
    * @param catalog pointer to the catalog being accessed
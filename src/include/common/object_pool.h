@@ -1,9 +1,16 @@
 #pragma once
 
-#include <queue>
+#include <atomic>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
 #include "common/allocator.h"
+#include "common/constants.h"
+#include "common/container/concurrent_queue.h"
+#include "common/macros.h"
 #include "common/spin_latch.h"
 #include "common/strong_typedef.h"
 
@@ -50,6 +57,13 @@ class AllocatorFailureException : public std::exception {
  *
  * This prevents liberal calls to malloc and new in the code and makes tracking
  * our memory performance easier.
+ *
+ * Released objects are cached per thread in a small magazine, so that a thread that repeatedly gets and releases
+ * objects (e.g. a transaction's undo and redo buffer segments) does not touch any shared state. Magazines that
+ * overflow spill half of their objects to a lock-free global free list, and empty magazines refill from it. Only
+ * allocating and deleting objects, which go through the allocator, take a latch. A thread that finds neither its
+ * magazine nor the global list holding anything, and may not allocate any more, takes objects cached by other threads
+ * before giving up, so the size and reuse limits hold for the pool as a whole.
  * @tparam T the type of objects in the pool.
  * @tparam The allocator to use when constructing and destructing a new object.
  *         In most cases it can be left out and the default allocator will
@@ -70,7 +84,21 @@ class ObjectPool {
    * @param reuse_limit the maximum number of reusable objects
    */
   ObjectPool(uint64_t size_limit, uint64_t reuse_limit)
-      : size_limit_(size_limit), reuse_limit_(reuse_limit), current_size_(0) {}
+      : id_(next_id_++), size_limit_(size_limit), reuse_limit_(reuse_limit), current_size_(0) {}
+
+  /**
+   * Initializes a new object pool that hands out objects from the given allocator.
+   *
+   * @param size_limit the maximum number of objects the object pool controls
+   * @param reuse_limit the maximum number of reusable objects
+   * @param alloc allocator to construct and destruct objects with
+   */
+  ObjectPool(uint64_t size_limit, uint64_t reuse_limit, Allocator alloc)
+      : alloc_(std::move(alloc)),
+        id_(next_id_++),
+        size_limit_(size_limit),
+        reuse_limit_(reuse_limit),
+        current_size_(0) {}
 
   /**
    * Destructs the memory pool. Frees any memory it holds.
@@ -80,13 +108,13 @@ class ObjectPool {
    */
   ~ObjectPool() {
     T *result = nullptr;
-    while (!reuse_queue_.empty()) {
-      result = reuse_queue_.front();
-      alloc_.Delete(result);
-      reuse_queue_.pop();
-    }
+    while (global_free_list_.Dequeue(&result)) alloc_.Delete(result);
+    for (auto &magazine : magazines_)
+      for (T *const obj : magazine->objects_) alloc_.Delete(obj);
   }
 
+  DISALLOW_COPY_AND_MOVE(ObjectPool)
+
   /**
    * Returns a piece of memory to hold an object of T.
    * @throw NoMoreObjectException if the object pool has reached the limit of how many objects it may hand out.
@@ -94,20 +122,10 @@ class ObjectPool {
    * @return pointer to memory that can hold T
    */
   T *Get() {
-    SpinLatch::ScopedSpinLatch guard(&latch_);
-    if (reuse_queue_.empty() && current_size_ >= size_limit_) throw NoMoreObjectException(size_limit_);
-    T *result = nullptr;
-    if (reuse_queue_.empty()) {
-      result = alloc_.New();  // result could be null because the allocator may not find enough memory space
-      if (result != nullptr) current_size_++;
-    } else {
-      result = reuse_queue_.front();
-      reuse_queue_.pop();
-      alloc_.Reuse(result);
-    }
-    // If result is nullptr. The call to alloc_.New() failed (i.e. can't allocate more memory from the system).
-    if (result == nullptr) throw AllocatorFailureException();
-    TERRIER_ASSERT(current_size_ <= size_limit_, "Object pool has exceeded its size limit.");
+    T *result = TakeCached(LocalMagazine());
+    if (result == nullptr) result = Allocate();
+    if (result == nullptr) result = Steal();
+    if (result == nullptr) throw NoMoreObjectException(size_limit_.load());
     return result;
   }
 
@@ -147,14 +165,12 @@ class ObjectPool {
    * @param new_reuse_limit
    */
   void SetReuseLimit(uint64_t new_reuse_limit) {
-    SpinLatch::ScopedSpinLatch guard(&latch_);
     reuse_limit_ = new_reuse_limit;
-    T *obj = nullptr;
-    while (reuse_queue_.size() > reuse_limit_) {
-      obj = reuse_queue_.front();
-      alloc_.Delete(obj);
-      reuse_queue_.pop();
-      current_size_--;
+    while (num_reusable_.load() > reuse_limit_.load()) {
+      T *const obj = Steal();
+      // Another thread got to the remaining reusable objects first
+      if (obj == nullptr) break;
+      Free(obj);
     }
   }
 
@@ -167,30 +183,140 @@ class ObjectPool {
    */
   void Release(T *obj) {
     TERRIER_ASSERT(obj != nullptr, "releasing a null pointer");
-    SpinLatch::ScopedSpinLatch guard(&latch_);
-    if (reuse_queue_.size() >= reuse_limit_) {
-      alloc_.Delete(obj);
-      current_size_--;
-    } else {
-      reuse_queue_.push(obj);
+    if (num_reusable_++ >= reuse_limit_.load()) {
+      num_reusable_--;
+      Free(obj);
+      return;
+    }
+    Magazine *const magazine = LocalMagazine();
+    SpinLatch::ScopedSpinLatch guard(&magazine->latch_);
+    magazine->objects_.push_back(obj);
+    if (magazine->objects_.size() > MAGAZINE_SIZE) {
+      // Keep the other half around for this thread, so a thread alternating between getting and releasing around the
+      // boundary does not go to the global list every time
+      for (uint32_t i = 0; i < MAGAZINE_SIZE / 2; i++) {
+        global_free_list_.Enqueue(magazine->objects_.back());
+        magazine->objects_.pop_back();
+      }
     }
   }
 
   /**
    * @return size limit of the object pool
    */
-  uint64_t GetSizeLimit() const { return size_limit_; }
+  uint64_t GetSizeLimit() const { return size_limit_.load(); }
 
- private:
+  /**
+   * Number of reusable objects a thread caches before spilling half of them to the shared free list
+   */
+  static constexpr uint32_t MAGAZINE_SIZE = 32;
+
+ protected:
+  /** allocator objects come from and go back to */
   Allocator alloc_;
+  /** protects the allocator, the size limit and the number of allocated objects */
   SpinLatch latch_;
-  // TODO(yangjuns): We don't need to reuse objects in a FIFO pattern. We could potentially pass a second template
-  // parameter to define the backing container for the std::queue. That way we can measure each backing container.
-  std::queue<T *> reuse_queue_;
-  uint64_t size_limit_;   // the maximum number of objects a object pool can have
-  uint64_t reuse_limit_;  // the maximum number of reusable objects in reuse_queue
+
+ private:
+  // Reusable objects cached by a single thread. The latch is only contended when another thread steals from it.
+  struct alignas(Constants::CACHELINE_SIZE) Magazine {
+    SpinLatch latch_;
+    std::vector<T *> objects_;
+  };
+
+  // Distinguishes pools in the per-thread lookup of magazines. Ids are never reused, so the stale entries of destructed
+  // pools are never looked up again.
+  static inline std::atomic<uint64_t> next_id_{0};
+  const uint64_t id_;
+
+  // Every thread's magazine, owned by the pool so that objects cached by a thread that has exited can still be reached
+  SpinLatch magazines_latch_;
+  std::vector<std::unique_ptr<Magazine>> magazines_;
+  ConcurrentQueue<T *> global_free_list_;
+
+  std::atomic<uint64_t> size_limit_;  // the maximum number of objects a object pool can have
+  std::atomic<uint64_t> reuse_limit_;  // the maximum number of reusable objects in magazines and the global free list
   // current_size_ represents the number of objects the object pool has allocated,
-  // including objects that have been given out to callers and those reside in reuse_queue
+  // including objects that have been given out to callers and those that are reusable
   uint64_t current_size_;
+  // number of objects in magazines and the global free list, including ones about to be put there
+  std::atomic<uint64_t> num_reusable_{0};
+
+  Magazine *LocalMagazine() {
+    // Remember the last pool this thread used, which saves the hash lookup when a thread mostly uses one pool
+    thread_local uint64_t cached_id = UINT64_MAX;
+    thread_local Magazine *cached_magazine = nullptr;
+    thread_local std::unordered_map<uint64_t, Magazine *> thread_magazines;
+    if (cached_id == id_) return cached_magazine;
+    auto it = thread_magazines.find(id_);
+    if (it == thread_magazines.end()) {
+      SpinLatch::ScopedSpinLatch guard(&magazines_latch_);
+      magazines_.emplace_back(std::make_unique<Magazine>());
+      it = thread_magazines.emplace(id_, magazines_.back().get()).first;
+    }
+    cached_id = id_;
+    cached_magazine = it->second;
+    return cached_magazine;
+  }
+
+  // Takes a reusable object from the given magazine, refilling it from the global free list if it is empty
+  T *TakeCached(Magazine *const magazine) {
+    T *result = nullptr;
+    {
+      SpinLatch::ScopedSpinLatch guard(&magazine->latch_);
+      if (magazine->objects_.empty()) {
+        T *obj = nullptr;
+        while (magazine->objects_.size() < MAGAZINE_SIZE / 2 && global_free_list_.Dequeue(&obj))
+          magazine->objects_.push_back(obj);
+      }
+      if (magazine->objects_.empty()) return nullptr;
+      result = magazine->objects_.back();
+      magazine->objects_.pop_back();
+    }
+    num_reusable_--;
+    alloc_.Reuse(result);
+    return result;
+  }
+
+  // Allocates a new object, if the size limit allows it
+  T *Allocate() {
+    SpinLatch::ScopedSpinLatch guard(&latch_);
+    if (current_size_ >= size_limit_) return nullptr;
+    // result could be null because the allocator may not find enough memory space
+    T *const result = alloc_.New();
+    if (result == nullptr) throw AllocatorFailureException();
+    current_size_++;
+    return result;
+  }
+
+  // Takes a reusable object from the global free list or any thread's magazine
+  T *Steal() {
+    T *result = nullptr;
+    if (global_free_list_.Dequeue(&result)) {
+      num_reusable_--;
+      alloc_.Reuse(result);
+      return result;
+    }
+    SpinLatch::ScopedSpinLatch guard(&magazines_latch_);
+    for (auto &magazine : magazines_) {
+      {
+        SpinLatch::ScopedSpinLatch magazine_guard(&magazine->latch_);
+        if (magazine->objects_.empty()) continue;
+        result = magazine->objects_.back();
+        magazine->objects_.pop_back();
+      }
+      num_reusable_--;
+      alloc_.Reuse(result);
+      return result;
+    }
+    return nullptr;
+  }
+
+  // Gives an object back to the allocator
+  void Free(T *const obj) {
+    SpinLatch::ScopedSpinLatch guard(&latch_);
+    alloc_.Delete(obj);
+    current_size_--;
+  }
 };
 }  // namespace terrier::common
@@ -32,6 +32,10 @@ namespace terrier::execution::ast {
   F(FilterLe, filterLe)                                                 \
   F(FilterLt, filterLt)                                                 \
   F(FilterNe, filterNe)                                                 \
+  F(FilterBetween, filterBetween)                                       \
+  F(FilterIn, filterIn)                                                 \
+  F(FilterIsNull, filterIsNull)                                         \
+  F(FilterIsNotNull, filterIsNotNull)                                   \
                                                                         \
   /* Thread State Container */                                          \
   F(ExecutionContextGetMemoryPool, execCtxGetMem)                       \
@@ -50,6 +54,7 @@ namespace terrier::execution::ast {
   F(TableIterGetPCI, tableIterGetPCI)                                   \
   F(TableIterClose, tableIterClose)                                     \
   F(TableIterReset, tableIterReset)                                     \
+  F(TableIterFilterBlocks, tableIterFilterBlocks)                       \
   F(TableIterParallel, iterateTableParallel)                            \
                                                                         \
   /* PCI */                                                             \
@@ -123,9 +128,24 @@ namespace terrier::execution::ast {
   F(JoinHashTableIterHasNext, joinHTIterHasNext)                        \
   F(JoinHashTableIterGetRow, joinHTIterGetRow)                          \
   F(JoinHashTableIterClose, joinHTIterClose)                            \
+  F(JoinHashTablePartIterInit, joinHTPartIterInit)                      \
+  F(JoinHashTablePartIterHasNext, joinHTPartIterHasNext)                \
+  F(JoinHashTablePartIterGetProbeRow, joinHTPartIterGetProbeRow)        \
+  F(JoinHashTablePartIterGetBuildRow, joinHTPartIterGetBuildRow)        \
+  F(JoinHashTablePartIterClose, joinHTPartIterClose)                    \
+  F(JoinHashTableEntryIterInit, joinHTEntryIterInit)                    \
+  F(JoinHashTableEntryIterHasNext, joinHTEntryIterHasNext)              \
+  F(JoinHashTableEntryIterGetRow, joinHTEntryIterGetRow)                \
+  F(JoinHashTableEntryIterClose, joinHTEntryIterClose)                  \
   F(JoinHashTableBuild, joinHTBuild)                                    \
   F(JoinHashTableBuildParallel, joinHTBuildParallel)                    \
   F(JoinHashTableFree, joinHTFree)                                      \
+  F(JoinHashTableVectorProbeInit, joinHTVecProbeInit)                   \
+  F(JoinHashTableVectorProbeAddKey, joinHTVecProbeAddKey)               \
+  F(JoinHashTableVectorProbePrepare, joinHTVecProbePrepare)             \
+  F(JoinHashTableVectorProbeHasNext, joinHTVecProbeHasNext)             \
+  F(JoinHashTableVectorProbeGetRow, joinHTVecProbeGetRow)               \
+  F(JoinHashTableVectorProbeFree, joinHTVecProbeFree)                   \
                                                                         \
   /* Sorting */                                                         \
   F(SorterInit, sorterInit)                                             \
@@ -139,6 +159,7 @@ namespace terrier::execution::ast {
   F(SorterIterInit, sorterIterInit)                                     \
   F(SorterIterHasNext, sorterIterHasNext)                               \
   F(SorterIterNext, sorterIterNext)                                     \
+  F(SorterIterSkipRows, sorterIterSkipRows)                             \
   F(SorterIterGetRow, sorterIterGetRow)                                 \
   F(SorterIterClose, sorterIterClose)                                   \
                                                                         \
@@ -155,6 +176,7 @@ namespace terrier::execution::ast {
                                                                         \
   /* Generic */                                                         \
   F(SizeOf, sizeOf)                                                     \
+  F(OffsetOf, offsetOf)                                                 \
   F(PtrCast, ptrCast)                                                   \
                                                                         \
   /* Output Buffer */                                                   \
@@ -168,12 +190,17 @@ namespace terrier::execution::ast {
   F(IndexIteratorScanAscending, indexIteratorScanAscending)             \
   F(IndexIteratorScanDescending, indexIteratorScanDescending)           \
   F(IndexIteratorScanLimitDescending, indexIteratorScanLimitDescending) \
+  F(IndexIteratorScanKeyBatch, indexIteratorScanKeyBatch)               \
+  F(IndexIteratorNextBatchKey, indexIteratorNextBatchKey)               \
+  F(IndexIteratorSetKeyOnly, indexIteratorSetKeyOnly)                   \
   F(IndexIteratorAdvance, indexIteratorAdvance)                         \
   F(IndexIteratorGetPR, indexIteratorGetPR)                             \
   F(IndexIteratorGetLoPR, indexIteratorGetLoPR)                         \
   F(IndexIteratorGetHiPR, indexIteratorGetHiPR)                         \
   F(IndexIteratorGetSlot, indexIteratorGetSlot)                         \
   F(IndexIteratorGetTablePR, indexIteratorGetTablePR)                   \
+  F(IndexIteratorGetKeyPR, indexIteratorGetKeyPR)                       \
+  F(IndexIteratorAddBatchKey, indexIteratorAddBatchKey)                 \
   F(IndexIteratorFree, indexIteratorFree)                               \
                                                                         \
   /* Projected Row Operations */                                        \
@@ -64,6 +64,8 @@ class Context;
   NON_PRIM(JoinHashTable, terrier::execution::sql::JoinHashTable)                               \
   NON_PRIM(JoinHashTableVectorProbe, terrier::execution::sql::JoinHashTableVectorProbe)         \
   NON_PRIM(JoinHashTableIterator, terrier::execution::sql::JoinHashTableIterator)               \
+  NON_PRIM(JoinHashTablePartIter, terrier::execution::sql::JoinHashTablePartitionIterator)      \
+  NON_PRIM(JoinHashTableEntryIter, terrier::execution::sql::JoinHashTableEntryIterator)         \
   NON_PRIM(MemoryPool, terrier::execution::sql::MemoryPool)                                     \
   NON_PRIM(Sorter, terrier::execution::sql::Sorter)                                             \
   NON_PRIM(SorterIterator, terrier::execution::sql::SorterIterator)                             \
@@ -28,6 +28,16 @@ class Agent {
    */
   void Reset();
 
+  /**
+   * Resume from state collected by another agent with the same number of
+   * actions, e.g., in a previous execution of the same query.
+   * @param value_estimates estimated value of each action
+   * @param action_attempts number of times each action was taken
+   * @param time_step the time step to resume from
+   */
+  void Restore(const std::vector<double> &value_estimates, const std::vector<uint32_t> &action_attempts,
+               uint32_t time_step);
+
   /**
    * Return the next action to be taken.
    */
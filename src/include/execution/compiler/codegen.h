@@ -224,6 +224,11 @@ class CodeGen {
    */
   ast::Expr *ArrayType(uint64_t num_elems, ast::BuiltinType::Kind kind);
 
+  /**
+   * @return the type represented by [num_elems]elem_type;
+   */
+  ast::Expr *ArrayType(uint64_t num_elems, ast::Expr *elem_type);
+
   /**
    *
    * @return the expression arr[idx]
@@ -437,6 +442,18 @@ class CodeGen {
    */
   ast::Expr *TableIterInit(ast::Identifier tvi, uint32_t table_oid, ast::Identifier col_oids);
 
+  /**
+   * Call tableIterFilterBlocks(&tvi, col_idx, col_type, lo, hi)
+   * @param tvi The identifier of table vector iterator
+   * @param col_idx Index of the column to prune blocks on.
+   * @param col_type The type of the column.
+   * @param lo The inclusive lower bound, as stored in the column.
+   * @param hi The inclusive upper bound, as stored in the column.
+   * @return The expression corresponding to the builtin call.
+   */
+  ast::Expr *TableIterFilterBlocks(ast::Identifier tvi, uint32_t col_idx, terrier::type::TypeId col_type, int64_t lo,
+                                   int64_t hi);
+
   /**
    * Call pciGetTypeNullable(pci, idx)
    * @param pci The identifier of the projected columns iterator
@@ -453,12 +470,71 @@ class CodeGen {
    * @param comp_type The type of comparison being performed.
    * @param col_idx Index of the column being filtered.
    * @param col_type The type of the column being filtered.
-   * @param filter_val The value to filter byc
+   * @param filter_val The SQL value to filter by
    * @return The expression corresponding to the builtin call.
    */
   ast::Expr *PCIFilter(ast::Identifier pci, terrier::parser::ExpressionType comp_type, uint32_t col_idx,
                        terrier::type::TypeId col_type, ast::Expr *filter_val);
 
+  /**
+   * Call filterCompType(pci, col_idx, col_type, col_idx_2, col_type_2)
+   * @param pci The identifier of the projected columns iterator
+   * @param comp_type The type of comparison being performed.
+   * @param col_idx Index of the left column.
+   * @param col_type The type of the left column.
+   * @param col_idx_2 Index of the right column.
+   * @param col_type_2 The type of the right column.
+   * @return The expression corresponding to the builtin call.
+   */
+  ast::Expr *PCIFilterColumn(ast::Identifier pci, terrier::parser::ExpressionType comp_type, uint32_t col_idx,
+                             terrier::type::TypeId col_type, uint32_t col_idx_2, terrier::type::TypeId col_type_2);
+
+  /**
+   * Call filterCompType(pci, col_idx, col_type, arith_op, operand, filter_val)
+   * @param pci The identifier of the projected columns iterator
+   * @param comp_type The type of comparison being performed.
+   * @param col_idx Index of the column being filtered.
+   * @param col_type The type of the column being filtered.
+   * @param arith_type The arithmetic operation applied to the column (+, - or *).
+   * @param operand The SQL value of the right operand of the arithmetic operation.
+   * @param filter_val The SQL value to filter by
+   * @return The expression corresponding to the builtin call.
+   */
+  ast::Expr *PCIFilterArith(ast::Identifier pci, terrier::parser::ExpressionType comp_type, uint32_t col_idx,
+                            terrier::type::TypeId col_type, terrier::parser::ExpressionType arith_type,
+                            ast::Expr *operand, ast::Expr *filter_val);
+
+  /**
+   * Call filterBetween(pci, col_idx, col_type, lo, hi)
+   * @param pci The identifier of the projected columns iterator
+   * @param col_idx Index of the column being filtered.
+   * @param col_type The type of the column being filtered.
+   * @param lo The SQL value of the inclusive lower bound
+   * @param hi The SQL value of the inclusive upper bound
+   * @return The expression corresponding to the builtin call.
+   */
+  ast::Expr *PCIFilterBetween(ast::Identifier pci, uint32_t col_idx, terrier::type::TypeId col_type, ast::Expr *lo,
+                              ast::Expr *hi);
+
+  /**
+   * Call filterIn(pci, col_idx, col_type, list)
+   * @param pci The identifier of the projected columns iterator
+   * @param col_idx Index of the column being filtered.
+   * @param col_type The type of the column being filtered.
+   * @param list The identifier of the array of SQL values
+   * @return The expression corresponding to the builtin call.
+   */
+  ast::Expr *PCIFilterIn(ast::Identifier pci, uint32_t col_idx, terrier::type::TypeId col_type, ast::Identifier list);
+
+  /**
+   * Call filterIsNull(pci, col_idx) or filterIsNotNull(pci, col_idx)
+   * @param pci The identifier of the projected columns iterator
+   * @param is_null Whether to keep the NULL or the non-NULL tuples.
+   * @param col_idx Index of the column being filtered.
+   * @return The expression corresponding to the builtin call.
+   */
+  ast::Expr *PCIFilterNull(ast::Identifier pci, bool is_null, uint32_t col_idx);
+
   /**
    * Call execCtxGetMem(execCtx)
    * @return The expression corresponding to the builtin call.
@@ -157,6 +157,25 @@ class AggregateHelper {
    */
   void FillValues(FunctionBuilder *builder, OperatorTranslator *translator);
 
+  /**
+   * Declare the entry of the global hash table as a local, to hold a single group.
+   * @param builder Current function builder
+   */
+  void DeclareEntry(FunctionBuilder *builder);
+
+  /**
+   * Start a new group in the entry of the global hash table, from the current values.
+   * @param builder Current function builder
+   */
+  void GenStartGroup(FunctionBuilder *builder);
+
+  /**
+   * Generate the condition under which the current values belong to another group than the entry of the global
+   * hash table. NULL group by terms belong to the same group.
+   * @return the condition
+   */
+  ast::Expr *GenGroupChanged();
+
   /**
    * Unconditionally advance non distinct aggregates.
    * @param builder Current function builder.
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "execution/compiler/expression/expression_translator.h"
 #include "execution/compiler/operator/operator_translator.h"
 #include "planner/plannodes/hash_join_plan_node.h"
@@ -65,6 +67,9 @@ class HashJoinLeftTranslator : public OperatorTranslator {
   // Get the mark flag
   ast::Expr *GetMarkFlag();
 
+  // Whether build rows carry the mark flag, which stays set until a probe row matches them
+  bool HasMarkFlag() const;
+
   // Build the hash table
   void GenBuildCall(FunctionBuilder *builder);
 
@@ -77,7 +82,7 @@ class HashJoinLeftTranslator : public OperatorTranslator {
   ast::Identifier build_struct_;
   ast::Identifier build_row_;
   ast::Identifier join_ht_;
-  // This boolean is used for semi and anti joins.
+  // This boolean is used for semi, anti and outer joins.
   // It indicates whether a tuple has been matched or not.
   ast::Identifier mark_;
 };
@@ -99,8 +104,11 @@ class HashJoinRightTranslator : public OperatorTranslator {
   void Abort(FunctionBuilder *builder) override;
   void Consume(FunctionBuilder *builder) override;
 
-  // Does nothing
-  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override {}
+  // Probe the hash table with the whole vector if all join keys are fixed-width scan columns
+  bool ConsumeVector(FunctionBuilder *builder) override;
+
+  // Add the probe-side hash table of partitioned joins
+  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override;
 
   // Declare JoinProbe struct if the previous operator is not a materializer
   void InitializeStructs(util::RegionVector<ast::Decl *> *decls) override;
@@ -108,11 +116,11 @@ class HashJoinRightTranslator : public OperatorTranslator {
   // Declare the keyCheck function
   void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override;
 
-  // Does nothing (left operator already initialized the hash table)
-  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override {}
+  // Call @joinHTInit on the probe-side hash table of partitioned joins (the left operator initializes the build side)
+  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override;
 
-  // Does nothing (left operator already freed the hash table)
-  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override {}
+  // Call @joinHTFree on the probe-side hash table of partitioned joins (the left operator frees the build side)
+  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override;
 
   // Get the output at idx
   ast::Expr *GetOutput(uint32_t attr_idx) override;
@@ -144,12 +152,61 @@ class HashJoinRightTranslator : public OperatorTranslator {
   // Declare the matching tuple
   void DeclareMatch(FunctionBuilder *builder);
 
-  // If statement for left semi joins
-  void GenLeftSemiJoinCondition(FunctionBuilder *builder);
+  // Record a match in the mark flags and let the parent consume it, as the join type requires
+  void GenMatch(FunctionBuilder *builder);
+
+  // Loop over the build rows (or the buffered probe rows) that no row of the other side matched
+  void GenUnmatchedRowsLoop(FunctionBuilder *builder, bool build_side);
+
+  // Declare a build row (or a probe row) with NULL attributes, for a row of the other side without a match
+  void DeclareNullRow(FunctionBuilder *builder, bool build_side);
+
+  // Whether the join emits the build rows without a match (left outer, full outer and anti joins)
+  bool EmitsUnmatchedBuildRows() const;
+
+  // Whether the join emits the probe rows without a match (right outer and full outer joins)
+  bool EmitsUnmatchedProbeRows() const;
+
+  // Whether unmatched build rows are emitted with a NULL probe row
+  bool HasNullProbeRows() const;
+
+  // Whether buffered probe rows carry a mark flag, which partitioned joins need to emit unmatched probe rows
+  bool HasProbeMarkFlag() const;
 
   // Complete the join key check function
   void GenKeyCheck(FunctionBuilder *builder);
 
+  // Collect the join keys of the vectorized probe. Returns false if some key cannot be probed column-wise.
+  bool CollectVectorProbeKeys();
+
+  // Whether the join predicate checks more than the equality of the join keys
+  bool HasResidualPredicate() const;
+
+  // Declare the vectorized probe and register its keys
+  void DeclareVectorProbe(FunctionBuilder *builder);
+
+  // @joinHTVecProbeFree(&vec_probe)
+  void GenVectorProbeFree(FunctionBuilder *builder);
+
+  // Buffer the probe row in the probe-side hash table of partitioned joins
+  void GenProbeBufferInsert(FunctionBuilder *builder);
+
+  // Join both buffered sides a partition at a time
+  void GenPartitionedJoinLoop(FunctionBuilder *builder);
+
+  // @joinHTPartIterClose(&part_iter)
+  void GenPartitionIteratorClose(FunctionBuilder *builder);
+
+  // A join key of the vectorized probe
+  struct VectorProbeKey {
+    // The index of the key column in the probe pci
+    uint16_t col_idx_;
+    // The type of the key column
+    terrier::type::TypeId type_;
+    // The build row attribute holding the key
+    uint32_t build_attr_idx_;
+  };
+
   // The hash join plan node
   const planner::HashJoinPlanNode *op_;
   // The left translator
@@ -161,6 +218,10 @@ class HashJoinRightTranslator : public OperatorTranslator {
   bool is_child_materializer_{false};
   bool is_child_ptr_{false};
 
+  // Whether the right child's vectors are probed at once, and with which keys
+  bool use_vector_probe_{false};
+  std::vector<VectorProbeKey> vector_probe_keys_;
+
   // Structs, functions, and locals
   static constexpr const char *RIGHT_ATTR_NAME = "right_attr";
   ast::Identifier hash_val_;
@@ -168,5 +229,15 @@ class HashJoinRightTranslator : public OperatorTranslator {
   ast::Identifier probe_row_;
   ast::Identifier key_check_;
   ast::Identifier join_iter_;
+  ast::Identifier vec_probe_;
+  ast::Identifier probe_ht_;
+  ast::Identifier probe_entry_;
+  ast::Identifier part_iter_;
+  ast::Identifier probe_matched_;
+  ast::Identifier build_entry_iter_;
+  ast::Identifier probe_entry_iter_;
+
+  // The iterator over unmatched rows whose loop the parent is consuming in, which an abort must close
+  const ast::Identifier *open_entry_iter_{nullptr};
 };
 }  // namespace terrier::execution::compiler
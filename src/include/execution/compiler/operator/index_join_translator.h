@@ -38,6 +38,9 @@ class IndexJoinTranslator : public OperatorTranslator {
   void Abort(FunctionBuilder *builder) override;
   void Consume(FunctionBuilder *builder) override;
 
+  // Probe the index with the keys of the whole vector at once if the outer side is a vectorizable scan
+  bool ConsumeVector(FunctionBuilder *builder) override;
+
   ast::Expr *GetOutput(uint32_t attr_idx) override;
   ast::Expr *GetChildOutput(uint32_t child_idx, uint32_t attr_idx, terrier::type::TypeId type) override;
   ast::Expr *GetTableColumn(const catalog::col_oid_t &col_oid) override;
@@ -51,10 +54,14 @@ class IndexJoinTranslator : public OperatorTranslator {
   void DeclareIterator(FunctionBuilder *builder);
   // Set the column oids to scan
   void SetOids(FunctionBuilder *builder);
-  // Fill the key with table data
-  void FillKey(FunctionBuilder *builder);
+  // Fill the given key with table data
+  void FillKey(FunctionBuilder *builder, ast::Identifier key_pr);
   // Generate the index iteration loop
   void GenForLoop(FunctionBuilder *builder);
+  // Generate the loop over the matches of the next key of a batch probe
+  void GenBatchForLoop(FunctionBuilder *builder);
+  // Join the current index match with the outer tuple
+  void ConsumeMatch(FunctionBuilder *builder);
   // Generate the join predicate's if statement
   void GenPredicate(FunctionBuilder *builder);
   // Free the iterator
@@ -77,6 +84,7 @@ class IndexJoinTranslator : public OperatorTranslator {
   ast::Identifier index_iter_;
   ast::Identifier col_oids_;
   ast::Identifier index_pr_;
+  ast::Identifier batch_key_pr_;
   ast::Identifier table_pr_;
   ast::Identifier slot_;
 };
@@ -47,7 +47,7 @@ class IndexScanTranslator : public OperatorTranslator {
 
   // Return the projected row and its type
   std::pair<const ast::Identifier *, const ast::Identifier *> GetMaterializedTuple() override {
-    return {&table_pr_, &pr_type_};
+    return {op_->IsIndexOnly() ? &key_pr_ : &table_pr_, &pr_type_};
   }
 
   ast::Expr *GetOutput(uint32_t attr_idx) override;
@@ -76,6 +76,8 @@ class IndexScanTranslator : public OperatorTranslator {
   void DeclareIndexPR(FunctionBuilder *builder);
   // Get Table PR
   void DeclareTablePR(FunctionBuilder *builder);
+  // Get the key of the current entry, for index-only scans
+  void DeclareKeyPR(FunctionBuilder *builder);
   // Get Slot
   void DeclareSlot(FunctionBuilder *builder);
 
@@ -86,6 +88,8 @@ class IndexScanTranslator : public OperatorTranslator {
   storage::ProjectionMap table_pm_;
   const catalog::IndexSchema &index_schema_;
   const std::unordered_map<catalog::indexkeycol_oid_t, uint16_t> &index_pm_;
+  // Key column holding each table column, for index-only scans
+  std::unordered_map<catalog::col_oid_t, catalog::indexkeycol_oid_t> key_col_oids_;
   // Structs and local variables
   ast::Identifier index_iter_;
   ast::Identifier col_oids_;
@@ -93,6 +97,7 @@ class IndexScanTranslator : public OperatorTranslator {
   ast::Identifier lo_index_pr_;
   ast::Identifier hi_index_pr_;
   ast::Identifier table_pr_;
+  ast::Identifier key_pr_;
   ast::Identifier pr_type_;
   ast::Identifier slot_;
 };
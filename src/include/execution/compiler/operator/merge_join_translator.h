@@ -0,0 +1,156 @@
+#pragma once
+
+#include "execution/compiler/expression/expression_translator.h"
+#include "execution/compiler/operator/operator_translator.h"
+#include "planner/plannodes/merge_join_plan_node.h"
+
+namespace terrier::execution::compiler {
+
+// Forward declare for friendship
+class MergeJoinRightTranslator;
+
+/**
+ * Left translator for merge joins. It buffers the left rows in a sorter, in the order they arrive in. They arrive
+ * sorted on the merge keys, so that the sorter never needs to sort them.
+ */
+class MergeJoinLeftTranslator : public OperatorTranslator {
+ public:
+  /**
+   * Constructor
+   * @param op The plan node
+   * @param codegen The code generator
+   */
+  MergeJoinLeftTranslator(const terrier::planner::MergeJoinPlanNode *op, CodeGen *codegen);
+
+  // Insert tuples into the sorter
+  void Produce(FunctionBuilder *builder) override;
+  void Abort(FunctionBuilder *builder) override;
+  void Consume(FunctionBuilder *builder) override;
+
+  // Add the sorter
+  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override;
+
+  // Declare LeftRow struct
+  void InitializeStructs(util::RegionVector<ast::Decl *> *decls) override;
+
+  // Create the comparison function of the sorter
+  void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override;
+
+  // Call @sorterInit on the sorter
+  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override;
+
+  // Call @sorterFree on the sorter
+  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override;
+
+  ast::Expr *GetOutput(uint32_t attr_idx) override;
+
+  ast::Expr *GetChildOutput(uint32_t child_idx, uint32_t attr_idx, terrier::type::TypeId type) override;
+
+  const planner::AbstractPlanNode *Op() override { return op_; }
+
+ private:
+  friend class MergeJoinRightTranslator;
+
+  // Return the member of the object at the given index
+  ast::Expr *GetAttribute(ast::Identifier object, uint32_t attr_idx);
+
+  // Generate the comparisons of the merge keys in the comparison function
+  void GenComparisons(FunctionBuilder *builder);
+
+  // The merge join plan node
+  const planner::MergeJoinPlanNode *op_;
+
+  // GetChildOutput returns the child's output in the pipeline, and the lhs or rhs in the comparison function
+  enum class CurrentRow { Child, Lhs, Rhs };
+  CurrentRow current_row_{CurrentRow::Child};
+
+  // Structs, functions, and locals
+  static constexpr const char *LEFT_ATTR_NAME = "left_attr";
+  ast::Identifier sorter_;
+  ast::Identifier left_struct_;
+  ast::Identifier left_row_;
+  ast::Identifier comp_fn_;
+  ast::Identifier comp_lhs_;
+  ast::Identifier comp_rhs_;
+};
+
+/**
+ * Right translator for merge joins. Each right row resumes the scan of the buffered left rows where the previous one
+ * left it, skips the left rows with smaller keys, and joins with the run of left rows with equal keys.
+ */
+class MergeJoinRightTranslator : public OperatorTranslator {
+ public:
+  /**
+   * Constructor
+   * @param op The plan node
+   * @param codegen The code generator
+   * @param left The corresponding left translator
+   */
+  MergeJoinRightTranslator(const terrier::planner::MergeJoinPlanNode *op, CodeGen *codegen, OperatorTranslator *left);
+
+  void Produce(FunctionBuilder *builder) override;
+  void Abort(FunctionBuilder *builder) override;
+  void Consume(FunctionBuilder *builder) override;
+
+  // Does nothing
+  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override {}
+
+  // Declare ProbeRow struct
+  void InitializeStructs(util::RegionVector<ast::Decl *> *decls) override;
+
+  // Declare the function that compares the merge keys of a left row and a probe row
+  void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override;
+
+  // Does nothing
+  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override {}
+
+  // Does nothing
+  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override {}
+
+  // Get the output at idx
+  ast::Expr *GetOutput(uint32_t attr_idx) override;
+
+  // Dispatch the call to the correct child
+  ast::Expr *GetChildOutput(uint32_t child_idx, uint32_t attr_idx, terrier::type::TypeId type) override;
+
+  const planner::AbstractPlanNode *Op() override { return op_; }
+
+ private:
+  // Returns a probe value
+  ast::Expr *GetProbeValue(uint32_t idx);
+
+  // Fill the probe row
+  void FillProbeRow(FunctionBuilder *builder);
+
+  // Whether all of the right merge keys are not NULL
+  ast::Expr *GenKeysNotNull();
+
+  // Declare the sorter iterator, and skip the left rows that earlier probe rows went past
+  void DeclareIterator(FunctionBuilder *builder);
+
+  // Loop over the left rows whose keys compare to the probe row's keys with the given operator
+  void GenMergeLoop(FunctionBuilder *builder, parsing::Token::Type comp_type);
+
+  // Close the iterator after the loops
+  void GenIteratorClose(FunctionBuilder *builder);
+
+  // Declare the matching tuple
+  void DeclareMatch(FunctionBuilder *builder);
+
+  // Complete the merge key comparison function
+  void GenKeyComparisons(FunctionBuilder *builder);
+
+  // The merge join plan node
+  const planner::MergeJoinPlanNode *op_;
+  // The left translator
+  MergeJoinLeftTranslator *left_;
+
+  // Structs, functions, and locals
+  static constexpr const char *RIGHT_ATTR_NAME = "right_attr";
+  ast::Identifier probe_struct_;
+  ast::Identifier probe_row_;
+  ast::Identifier merge_cmp_;
+  ast::Identifier merge_iter_;
+  ast::Identifier run_start_;
+};
+}  // namespace terrier::execution::compiler
@@ -97,6 +97,14 @@ class OperatorTranslator : public ExpressionEvaluator {
    */
   virtual bool IsVectorizable() { return false; }
 
+  /**
+   * Called by a child that produces vectors of tuples (i.e., a sequential scan) before it starts its tuple-at-a-time
+   * loop. An operator that can process the whole vector at once generates its own loop here.
+   * @param builder The builder of the pipeline function
+   * @return Whether the vector was consumed. If so, the child must not generate its tuple-at-a-time loop.
+   */
+  virtual bool ConsumeVector(FunctionBuilder *builder) { return false; }
+
   /**
    * @return Whether this operator is parallelizable
    */
@@ -55,10 +55,12 @@ class SeqScanTranslator : public OperatorTranslator {
   bool IsVectorizable() override { return is_vectorizable_; }
   /**
    * Recursively walk down the predicate tree to check if it is vectorizable.
+   * A predicate is vectorizable if it is a conjunction of comparisons between a column and a constant, between two
+   * columns of the same type or between (column +-* constant) and a constant, of IN lists and of NULL checks.
    * @param predicate The predicate to check
    * @return Whether the predicate is vectorizable or not.
    */
-  static bool IsVectorizable(const terrier::parser::AbstractExpression *predicate);
+  bool IsVectorizable(const terrier::parser::AbstractExpression *predicate) const;
 
   // Return the pci and its type
   std::pair<const ast::Identifier *, const ast::Identifier *> GetMaterializedTuple() override {
@@ -68,6 +70,35 @@ class SeqScanTranslator : public OperatorTranslator {
   // Used by column value expression to get a column.
   ast::Expr *GetTableColumn(const catalog::col_oid_t &col_oid) override;
 
+  /**
+   * @param col_oid oid of a column read by the scan
+   * @return the index of the column in the pci
+   */
+  uint16_t GetColumnIndex(const catalog::col_oid_t &col_oid) { return pm_[col_oid]; }
+
+  /**
+   * @param col_oid oid of a column read by the scan
+   * @return the type of the column
+   */
+  terrier::type::TypeId GetColumnType(const catalog::col_oid_t &col_oid) const {
+    return schema_.GetColumn(col_oid).Type();
+  }
+
+  /**
+   * Generates the loop over the tuples of the current vector, which skips the tuples that failed a vectorized
+   * predicate.
+   * for (; @pciHasNext(pci); @pciAdvance(pci)) {...}
+   * @param builder The builder of the pipeline function
+   */
+  void GenPCILoop(FunctionBuilder *builder);
+
+  /**
+   * Rewinds the current vector, so that another loop can go over it again.
+   * @pciReset(pci) or the filtered version
+   * @param builder The builder of the pipeline function
+   */
+  void GenPCIReset(FunctionBuilder *builder);
+
   // Return the current slot.
   ast::Expr *GetSlot() override { return codegen_->PointerTo(slot_); }
 
@@ -79,6 +110,9 @@ class SeqScanTranslator : public OperatorTranslator {
 
   void SetOids(FunctionBuilder *builder);
 
+  // @tableIterFilterBlocks(&tvi, ...) for the columns the predicate compares with constants
+  void GenBlockFilters(FunctionBuilder *builder);
+
   void DoTableScan(FunctionBuilder *builder);
 
   // for (@tableIterInit(&tvi, ...); @tableIterAdvance(&tvi);) {...}
@@ -87,10 +121,6 @@ class SeqScanTranslator : public OperatorTranslator {
   void DeclarePCI(FunctionBuilder *builder);
   void DeclareSlot(FunctionBuilder *builder);
 
-  // var pci = @tableIterGetPCI(&tvi)
-  // for (; @pciHasNext(pci); @pciAdvance(pci)) {...}
-  void GenPCILoop(FunctionBuilder *builder);
-
   // if (cond) {...}
   void GenScanCondition(FunctionBuilder *builder);
 
@@ -103,6 +133,18 @@ class SeqScanTranslator : public OperatorTranslator {
   // Generated vectorized filters
   void GenVectorizedPredicate(FunctionBuilder *builder, const terrier::parser::AbstractExpression *predicate);
 
+  // Generate the vectorized filter of a single conjunction term
+  void GenVectorizedTerm(FunctionBuilder *builder, const terrier::parser::AbstractExpression *term);
+
+  // @filterIsNotNull(pci, col_idx) if the column is nullable. The other filters do not check NULLs.
+  void GenVectorizedNotNull(FunctionBuilder *builder, catalog::col_oid_t col_oid);
+
+  // Whether the expression is a column read by this scan
+  bool IsScanColumn(const terrier::parser::AbstractExpression *expr) const;
+
+  // The SQL value of a constant filter operand
+  ast::Expr *GenFilterValue(const terrier::parser::AbstractExpression *constant);
+
   // Create the input oids used for the scans.
   // When the plan's oid list is empty (like in "SELECT COUNT(*)"), then we just read the first column of the table.
   // Otherwise we just read the plan's oid list.
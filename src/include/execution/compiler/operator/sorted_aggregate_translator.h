@@ -0,0 +1,64 @@
+#pragma once
+
+#include "execution/compiler/operator/aggregate_util.h"
+#include "execution/compiler/operator/operator_translator.h"
+#include "planner/plannodes/aggregate_plan_node.h"
+
+namespace terrier::execution::compiler {
+
+/**
+ * A sorted aggregation has its input sorted on the group by terms. The rows of a group then arrive one after the other,
+ * so that each group is aggregated in a single entry, and output as soon as a row of the next group arrives. Unlike a
+ * regular aggregation, it needs no aggregation hash table and does not break the pipeline.
+ */
+class SortedAggregateTranslator : public OperatorTranslator {
+ public:
+  /**
+   * Constructor
+   * @param op plan node to translate
+   * @param codegen code generator
+   */
+  SortedAggregateTranslator(const terrier::planner::AggregatePlanNode *op, CodeGen *codegen);
+
+  // Does nothing
+  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override {}
+
+  // Declare the values and entry structs
+  void InitializeStructs(util::RegionVector<ast::Decl *> *decls) override;
+
+  // Does nothing
+  void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override {}
+
+  // Does nothing
+  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override {}
+
+  // Does nothing
+  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override {}
+
+  void Produce(FunctionBuilder *builder) override;
+  void Abort(FunctionBuilder *builder) override;
+  void Consume(FunctionBuilder *builder) override;
+
+  // Get the output at idx
+  ast::Expr *GetOutput(uint32_t attr_idx) override;
+
+  // Pass through to the child while aggregating, and return the group by or aggregate term while outputting a group
+  ast::Expr *GetChildOutput(uint32_t child_idx, uint32_t attr_idx, terrier::type::TypeId type) override;
+
+  const planner::AbstractPlanNode *Op() override { return op_; }
+
+ private:
+  // Output the current group, if it satisfies the having clause
+  void GenOutputGroup(FunctionBuilder *builder);
+
+  const planner::AggregatePlanNode *op_;
+  AggregateHelper helper_;
+  // Whether the current group is being output, rather than the child's rows aggregated
+  bool outputting_{false};
+  // Whether the child's code is already generated, so that the last group is being output after it
+  bool child_done_{false};
+
+  // Structs, Functions, and local variables needed.
+  ast::Identifier has_group_;
+};
+}  // namespace terrier::execution::compiler
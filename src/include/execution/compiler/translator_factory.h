@@ -23,6 +23,12 @@ class TranslatorFactory {
   static std::unique_ptr<OperatorTranslator> CreateRegularTranslator(const planner::AbstractPlanNode *op,
                                                                      CodeGen *codegen);
 
+  /**
+   * Whether this is an aggregation whose input is sorted on its group by terms, which aggregates in a single regular
+   * translator instead of splitting into a bottom and a top translator
+   */
+  static bool IsSortedAggregate(const planner::AbstractPlanNode *op);
+
   /**
    * Create a bottom expression translator
    */
@@ -173,6 +173,18 @@ class EXPORT ExecutionContext {
    */
   uint64_t &RowsAffected() { return rows_affected_; }
 
+  /**
+   * Allow or forbid the query to read frozen blocks in place. Only queries that do not modify any table may do so,
+   * since writes to a block have to wait for its in-place readers to leave.
+   * @param read_only true if the query does not modify any table
+   */
+  void SetReadOnly(bool read_only) { read_only_ = read_only; }
+
+  /**
+   * @return true if the query does not modify any table, and may read frozen blocks in place
+   */
+  bool IsReadOnly() const { return read_only_; }
+
   /**
    * Set the PipelineOperatingUnits
    * @param op PipelineOperatingUnits for executing the given query
@@ -193,5 +205,6 @@ class EXPORT ExecutionContext {
   uint8_t execution_mode_;
   std::vector<type::TransientValue> params_;
   uint64_t rows_affected_ = 0;
+  bool read_only_ = false;
 };
 }  // namespace terrier::execution::exec
@@ -78,6 +78,10 @@ namespace sema {
     "ptrCast() expects (compile-time *DestType, *T) arguments.  Received "                                            \
     "type '%0' in position %1",                                                                                       \
     (ast::Type *, uint32_t))                                                                                          \
+  F(BadArgToOffsetOf,                                                                                                 \
+    "offsetOf() expects (compile-time StructType, field name) arguments.  Received "                                  \
+    "type '%0' in position %1",                                                                                       \
+    (ast::Type *, uint32_t))                                                                                          \
   F(BadHashArg, "cannot hash type '%0'", (ast::Type *))                                                               \
   F(MissingArrayLength, "missing array length (either compile-time number or '*')", ())                               \
   F(NotASQLAggregate, "'%0' is not a SQL aggregator type", (ast::Type *))                                             \
@@ -120,7 +120,7 @@ class Sema : public ast::AstVisitor<Sema> {
   void CheckBuiltinSqlNullCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinSqlConversionCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinDateFunctionCall(ast::CallExpr *call, ast::Builtin builtin);
-  void CheckBuiltinFilterCall(ast::CallExpr *call);
+  void CheckBuiltinFilterCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinAggHashTableCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinAggHashTableIterCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinAggPartIterCall(ast::CallExpr *call, ast::Builtin builtin);
@@ -131,8 +131,11 @@ class Sema : public ast::AstVisitor<Sema> {
   void CheckBuiltinJoinHashTableIterHasNext(ast::CallExpr *call);
   void CheckBuiltinJoinHashTableIterGetRow(ast::CallExpr *call);
   void CheckBuiltinJoinHashTableIterClose(ast::CallExpr *call);
+  void CheckBuiltinJoinHashTablePartIterCall(ast::CallExpr *call, ast::Builtin builtin);
+  void CheckBuiltinJoinHashTableEntryIterCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinJoinHashTableBuild(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinJoinHashTableFree(ast::CallExpr *call);
+  void CheckBuiltinJoinHashTableVectorProbeCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinSorterInit(ast::CallExpr *call);
   void CheckBuiltinSorterInsert(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinSorterSort(ast::CallExpr *call, ast::Builtin builtin);
@@ -142,6 +145,7 @@ class Sema : public ast::AstVisitor<Sema> {
   void CheckBuiltinThreadStateContainerCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckMathTrigCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinSizeOfCall(ast::CallExpr *call);
+  void CheckBuiltinOffsetOfCall(ast::CallExpr *call);
   void CheckBuiltinPtrCastCall(ast::CallExpr *call);
   void CheckBuiltinTableIterCall(ast::CallExpr *call, ast::Builtin builtin);
   void CheckBuiltinTableIterParCall(ast::CallExpr *call);
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "common/macros.h"
+#include "common/spin_latch.h"
 #include "execution/bandit/policy.h"
 #include "execution/util/execution_common.h"
 
@@ -35,17 +37,142 @@ class EXPORT FilterManager {
      */
     std::vector<MatchFn> flavors_;
 
+    /**
+     * identities of the flavors, which stay the same across compilations of the same code
+     */
+    std::vector<uint64_t> flavor_ids_;
+
     /**
      * Return the number of flavors
      */
     uint32_t NumFlavors() const { return static_cast<uint32_t>(flavors_.size()); }
   };
 
+  /**
+   * Statistics observed for one clause, smoothed over the vectors it ran on.
+   */
+  struct ClauseStats {
+    /**
+     * Fraction of the input tuples that passed the clause
+     */
+    double selectivity_{1.0};
+
+    /**
+     * Execution time per input tuple, in nanoseconds
+     */
+    double cost_per_tuple_{0.0};
+
+    /**
+     * Number of vectors the statistics were collected over
+     */
+    uint64_t num_observations_{0};
+
+    /**
+     * Return the rank of the clause. Running the clauses of a conjunction in
+     * increasing rank minimizes the expected cost of the filter: cheap clauses
+     * that discard many tuples go first. Clauses without observations rank
+     * first so that they get measured.
+     */
+    double Rank() const;
+  };
+
+  /**
+   * Everything a filter manager learned about its clauses during one query
+   * execution.
+   */
+  struct LearnedState {
+    /**
+     * The order the clauses should run in
+     */
+    std::vector<uint32_t> clause_order_;
+
+    /**
+     * The statistics of each clause
+     */
+    std::vector<ClauseStats> clause_stats_;
+
+    /**
+     * The value estimates of each clause's bandit agent
+     */
+    std::vector<std::vector<double>> value_estimates_;
+
+    /**
+     * The action attempts of each clause's bandit agent
+     */
+    std::vector<std::vector<uint32_t>> action_attempts_;
+
+    /**
+     * The time step of each clause's bandit agent
+     */
+    std::vector<uint32_t> time_steps_;
+  };
+
+  /**
+   * A cache of the state learned by filter managers, keyed by the plan they
+   * execute, i.e., their clauses and the identities of their flavors. Filter
+   * managers save their state into the cache when they are destroyed, and
+   * restore it when they are finalized, so that repeated executions of the
+   * same scan start with the best known clause order and flavors, even when
+   * every execution compiles the scan anew.
+   */
+  class EXPORT StatsCache {
+   public:
+    /**
+     * Maximum number of plans in the cache. Inserting into a full cache evicts
+     * an arbitrary plan.
+     */
+    static constexpr uint32_t K_DEFAULT_CAPACITY = 1024;
+
+    /**
+     * @return the process-wide cache used by generated code
+     */
+    static StatsCache *Instance() {
+      static StatsCache instance;
+      return &instance;
+    }
+
+    /**
+     * Look up the state learned for a plan
+     * @param key the key of the plan
+     * @param[out] state the learned state, if found
+     * @return true if the plan was found, false otherwise
+     */
+    bool Lookup(uint64_t key, LearnedState *state) const;
+
+    /**
+     * Save the state learned for a plan, overwriting any previous state
+     * @param key the key of the plan
+     * @param state the learned state
+     */
+    void Insert(uint64_t key, LearnedState &&state);
+
+    /**
+     * Remove all plans from the cache
+     */
+    void Clear();
+
+    /**
+     * @return the number of plans in the cache
+     */
+    uint32_t NumPlans() const;
+
+   private:
+    mutable common::SpinLatch latch_;
+    std::unordered_map<uint64_t, LearnedState> plans_;
+  };
+
+  /**
+   * Weight of the newest observation when smoothing clause statistics.
+   */
+  static constexpr double K_STATS_DECAY = 0.2;
+
   /**
    * Construct the filter using the given adaptive policy
    * @param policy_kind
+   * @param stats_cache the cache to restore and save learned state, or nullptr to start from scratch every time
    */
-  explicit FilterManager(bandit::Policy::Kind policy_kind = bandit::Policy::Kind::EpsilonGreedy);
+  explicit FilterManager(bandit::Policy::Kind policy_kind = bandit::Policy::Kind::EpsilonGreedy,
+                         StatsCache *stats_cache = StatsCache::Instance());
 
   /**
    * Destructor
@@ -65,8 +192,11 @@ class EXPORT FilterManager {
   /**
    * Insert a flavor for the current clause in the filter
    * @param flavor A filter flavor
+   * @param flavor_id The identity of the flavor in the stats cache. It must
+   *                  stay the same across compilations of the same code, and
+   *                  differ for different code, e.g., a hash of its bytecode.
    */
-  void InsertClauseFlavor(FilterManager::MatchFn flavor);
+  void InsertClauseFlavor(FilterManager::MatchFn flavor, uint64_t flavor_id);
 
   /**
    * Make the manager immutable.
@@ -74,11 +204,24 @@ class EXPORT FilterManager {
   void Finalize();
 
   /**
-   * Run the filters over the given projection @em pci
+   * Run the filters over the given projection @em pci. The clauses are run in
+   * increasing rank, and reordered after every vector based on their observed
+   * selectivity and cost.
    * @param pci The input vector
    */
   void RunFilters(ProjectedColumnsIterator *pci);
 
+  /**
+   * @return the order the clauses will run in on the next vector
+   */
+  const std::vector<uint32_t> &GetClauseOrder() const { return optimal_clause_order_; }
+
+  /**
+   * @param clause_index The index of the clause
+   * @return the statistics observed for the clause at index @em clause_index
+   */
+  const ClauseStats &GetClauseStats(uint32_t clause_index) const { return clause_stats_[clause_index]; }
+
   /**
    * Return the index of the current optimal implementation flavor for the
    * clause at index @em clause_index
@@ -88,8 +231,20 @@ class EXPORT FilterManager {
   uint32_t GetOptimalFlavorForClause(uint32_t clause_index) const;
 
  private:
-  // Run a specific clause of the filter
-  void RunFilterClause(ProjectedColumnsIterator *pci, uint32_t clause_index);
+  // Run a specific clause of the filter over num_input tuples
+  void RunFilterClause(ProjectedColumnsIterator *pci, uint32_t clause_index, uint32_t num_input);
+
+  // Sort the clauses by rank
+  void ReorderClauses();
+
+  // The key of this filter's plan in the stats cache
+  uint64_t PlanKey() const;
+
+  // Restore the state learned by a previous execution of the plan, if any
+  void RestoreLearnedState();
+
+  // Save the state learned by this execution of the plan
+  void SaveLearnedState();
 
   // Run the given matching function
   std::pair<uint32_t, double> RunFilterClauseImpl(ProjectedColumnsIterator *pci, FilterManager::MatchFn func);
@@ -110,6 +265,10 @@ class EXPORT FilterManager {
   std::unique_ptr<bandit::Policy> policy_;
   // The agents, one per clause
   std::vector<bandit::Agent> agents_;
+  // The observed statistics, one per clause
+  std::vector<ClauseStats> clause_stats_;
+  // Where learned state is restored from and saved to
+  StatsCache *stats_cache_;
   // Has the manager's clauses been finalized?
   bool finalized_{false};
 };
@@ -5,11 +5,13 @@
 #include "catalog/catalog_defs.h"
 #include "execution/exec/execution_context.h"
 #include "execution/sql/projected_columns_iterator.h"
+#include "storage/index/index.h"
 #include "storage/storage_defs.h"
 
 namespace terrier::execution::sql {
 /**
- * Allows iteration for indices from TPL.
+ * Allows iteration for indices from TPL. Scans open a cursor on the index and pull visible tuples from it a batch at a
+ * time as the iterator is advanced, so a scan that is abandoned early never looks at the rest of the index.
  */
 class EXPORT IndexIterator {
  public:
@@ -57,6 +59,29 @@ class EXPORT IndexIterator {
    */
   void ScanLimitDescending(uint32_t limit);
 
+  /**
+   * Adds a key to the batch that the next call to ScanKeyBatch looks up.
+   * @return projected row to fill with the key, built with the index's ProjectedRowInitializer
+   */
+  storage::ProjectedRow *AddBatchKey();
+
+  /**
+   * Looks up all the keys added since the last batch at once, through the index's ScanKeyBatch. NextBatchKey then
+   * walks through the results one key at a time, in the order the keys were added.
+   */
+  void ScanKeyBatch();
+
+  /**
+   * Moves on to the next key of the last batch. The following calls to Advance iterate over the values of that key.
+   */
+  void NextBatchKey();
+
+  /**
+   * Turns the following scans into index-only scans, which read the key of each tuple through KeyPR instead of
+   * fetching the tuple from the table.
+   */
+  void SetKeyOnly() { key_only_ = true; }
+
   /**
    * Advances the iterator. Return true if successful
    * @return whether the iterator was advanced or not.
@@ -84,26 +109,58 @@ class EXPORT IndexIterator {
    */
   storage::ProjectedRow *TablePR();
 
+  /**
+   * Read the index key of the current tuple, without touching the table. Requires SetKeyOnly.
+   * @return projected row with the index key. Its varlens are only valid until the iterator is advanced.
+   */
+  storage::ProjectedRow *KeyPR();
+
   /**
    * @return The current tuple slot of the iterator.
    */
-  storage::TupleSlot CurrentSlot() { return tuples_[curr_index_ - 1]; }
+  storage::TupleSlot CurrentSlot() { return curr_tuples_[curr_index_ - 1]; }
 
  private:
+  // Maximum number of tuple slots fetched from the index cursor at a time
+  static constexpr uint32_t K_BATCH_SIZE = 256;
+
+  // Starts iterating over a newly opened cursor
+  void OpenCursor(std::unique_ptr<storage::index::Index::Cursor> cursor);
+
   exec::ExecutionContext *exec_ctx_;
   uint32_t num_attrs_;
   std::vector<catalog::col_oid_t> col_oids_;
   common::ManagedPointer<storage::index::Index> index_;
   common::ManagedPointer<storage::SqlTable> table_;
 
+  std::unique_ptr<storage::index::Index::Cursor> cursor_;
   uint32_t curr_index_ = 0;
+  uint32_t num_tuples_ = 0;
+  bool key_only_ = false;
+  // Whether every tuple of the current scan has the search key, as in point lookups
+  bool keys_match_search_key_ = false;
   void *index_buffer_;
   void *hi_index_buffer_;
+  void *key_buffer_ = nullptr;
   void *table_buffer_;
   storage::ProjectedRow *index_pr_;
   storage::ProjectedRow *hi_index_pr_;
+  storage::ProjectedRow *key_pr_ = nullptr;
   storage::ProjectedRow *table_pr_;
-  std::vector<storage::TupleSlot> tuples_{};
+  std::vector<storage::TupleSlot> tuples_ = std::vector<storage::TupleSlot>(K_BATCH_SIZE);
+  // Tuple slots being iterated over, either those pulled from the cursor or those of a key of a batch lookup
+  const storage::TupleSlot *curr_tuples_ = tuples_.data();
+  // Key of the current point lookup, handed out as the key of every tuple in index-only scans
+  storage::ProjectedRow *search_key_pr_ = nullptr;
+
+  // Keys of the batch lookup, whose buffers are kept around for the following batches
+  std::vector<void *> batch_key_buffers_;
+  std::vector<storage::ProjectedRow *> batch_keys_;
+  uint32_t num_batch_keys_ = 0;
+  // Results of the last batch lookup, see Index::ScanKeyBatch
+  std::vector<storage::TupleSlot> batch_tuples_;
+  std::vector<uint32_t> batch_offsets_;
+  uint32_t next_batch_key_ = 0;
 };
 
 }  // namespace terrier::execution::sql
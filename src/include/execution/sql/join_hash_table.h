@@ -23,6 +23,8 @@ namespace terrier::execution::sql {
 
 class ThreadStateContainer;
 class JoinHashTableIterator;
+class JoinHashTablePartitionIterator;
+class JoinHashTableEntryIterator;
 
 /**
  * The main join hash table. Join hash tables are bulk-loaded through calls to
@@ -36,14 +38,28 @@ class EXPORT JoinHashTable {
    */
   static constexpr uint32_t K_DEFAULT_HLL_PRECISION = 10;
 
+  /**
+   * The most radix bits a partitioned build splits its input on
+   */
+  static constexpr uint32_t K_MAX_RADIX_BITS = 16;
+
+  /**
+   * The most radix bits a single partitioning pass splits its input on. Beyond
+   * this fan-out, the write-combining buffers of a pass no longer fit in cache.
+   */
+  static constexpr uint32_t K_MAX_RADIX_BITS_PER_PASS = 8;
+
   /**
    * Construct a join hash table. All memory allocations are sourced from the
    * injected @em memory, and thus, are ephemeral.
    * @param memory The memory pool to allocate memory from
    * @param tuple_size The size of the tuple stored in this join hash table
    * @param use_concise_ht Whether to use a concise or generic join index
+   * @param use_partitioned_build Whether to radix-partition the input and
+   *                              build one cache-resident table per partition
    */
-  explicit JoinHashTable(MemoryPool *memory, uint32_t tuple_size, bool use_concise_ht = false);
+  explicit JoinHashTable(MemoryPool *memory, uint32_t tuple_size, bool use_concise_ht = false,
+                         bool use_partitioned_build = false);
 
   /**
    * This class cannot be copied or moved
@@ -111,6 +127,13 @@ class EXPORT JoinHashTable {
    * used to store materialized build-side tuples)
    */
   uint64_t GetJoinIndexMemoryUsage() const noexcept {
+    if (partition_tables_ != nullptr) {
+      uint64_t usage = 0;
+      for (uint64_t part = 0; part < NumPartitions(); part++) {
+        usage += partition_tables_[part].GetTotalMemoryUsage();
+      }
+      return usage;
+    }
     return UseConciseHashTable() ? concise_hash_table_.GetTotalMemoryUsage()
                                  : generic_hash_table_.GetTotalMemoryUsage();
   }
@@ -135,8 +158,25 @@ class EXPORT JoinHashTable {
    */
   bool UseConciseHashTable() const noexcept { return use_concise_ht_; }
 
+  /**
+   * Is this join radix-partitioning its input before building?
+   */
+  bool UsePartitionedBuild() const noexcept { return use_partitioned_build_; }
+
+  /**
+   * Return the number of hash bits the entries were radix-partitioned on
+   */
+  uint32_t NumRadixBits() const noexcept { return radix_bits_; }
+
+  /**
+   * Return the number of partitions the entries were radix-partitioned into
+   */
+  uint64_t NumPartitions() const noexcept { return uint64_t{1} << radix_bits_; }
+
  private:
   friend class execution::sql::test::JoinHashTableTest;
+  friend class JoinHashTablePartitionIterator;
+  friend class JoinHashTableEntryIterator;
 
   // Access a stored entry by index
   HashTableEntry *EntryAt(const uint64_t idx) noexcept { return reinterpret_cast<HashTableEntry *>(entries_[idx]); }
@@ -145,9 +185,30 @@ class EXPORT JoinHashTable {
     return reinterpret_cast<const HashTableEntry *>(entries_[idx]);
   }
 
-  // Dispatched from Build() to build either a generic or concise hash table
+  // Access a radix-partitioned entry by index
+  HashTableEntry *PartitionedEntryAt(const uint64_t idx) const noexcept {
+    return reinterpret_cast<HashTableEntry *>(partitioned_entries_ + idx * entries_.ElementSize());
+  }
+
+  // The partition a hash value belongs to, i.e., the top radix bits of the hash
+  uint64_t PartitionOf(const hash_t hash) const noexcept {
+    return radix_bits_ == 0 ? 0 : hash >> (sizeof(hash_t) * 8 - radix_bits_);
+  }
+
+  // The table holding the entries of the given partition
+  const GenericHashTable &PartitionTable(const uint64_t part) const noexcept {
+    return partition_tables_ == nullptr ? generic_hash_table_ : partition_tables_[part];
+  }
+
+  // Dispatched from Build() to build either a generic, concise or partitioned
+  // hash table
   void BuildGenericHashTable() noexcept;
   void BuildConciseHashTable();
+  void BuildPartitionedHashTable();
+
+  // Radix-partition all buffered entries, including those taken over from
+  // thread-local tables, on the top 'radix_bits' bits of their hash values
+  void PartitionEntries(uint32_t radix_bits);
 
   // Dispatched from BuildGenericHashTable()
   template <bool Prefetch>
@@ -169,6 +230,8 @@ class EXPORT JoinHashTable {
   // Dispatched from LookupBatch() to lookup from either a generic or concise
   // hash table in batched manner
   void LookupBatchInGenericHashTable(uint32_t num_tuples, const hash_t hashes[], const HashTableEntry *results[]) const;
+  void LookupBatchInPartitionedHashTable(uint32_t num_tuples, const hash_t hashes[],
+                                         const HashTableEntry *results[]) const;
   void LookupBatchInConciseHashTable(uint32_t num_tuples, const hash_t hashes[], const HashTableEntry *results[]) const;
 
   // Dispatched from LookupBatchInGenericHashTable()
@@ -194,9 +257,19 @@ class EXPORT JoinHashTable {
   // List of entries this hash table has taken ownership of
   MemPoolVector<decltype(entries_)> owned_;
 
+  // The memory pool entries are allocated from
+  MemoryPool *memory_;
+
   // The generic hash table
   GenericHashTable generic_hash_table_;
 
+  // The radix-partitioned copy of all entries, the index in it where each
+  // partition begins (plus a final end index), and the table of each partition
+  byte *partitioned_entries_;
+  uint64_t num_partitioned_entries_;
+  MemPoolVector<uint64_t> partition_offsets_;
+  std::unique_ptr<GenericHashTable[]> partition_tables_;
+
   // The concise hash table
   ConciseHashTable concise_hash_table_;
 
@@ -211,6 +284,12 @@ class EXPORT JoinHashTable {
 
   // Should we use a concise hash table?
   bool use_concise_ht_;
+
+  // Should we radix-partition entries before building?
+  bool use_partitioned_build_;
+
+  // The number of hash bits entries were partitioned on
+  uint32_t radix_bits_;
 };
 
 /**
@@ -254,6 +333,99 @@ class EXPORT JoinHashTableIterator {
   hash_t hash_;
 };
 
+/**
+ * The iterator used for radix-partitioned joins. The probe side is buffered in
+ * its own join hash table, which this iterator partitions on the same bits as
+ * the built build side. The join then proceeds a partition at a time, so every
+ * probe only touches the cache-resident table of its partition.
+ */
+class EXPORT JoinHashTablePartitionIterator {
+ public:
+  /**
+   * Function used to check equality of hash keys
+   */
+  using KeyEq = JoinHashTableIterator::KeyEq;
+
+  /**
+   * Partition the buffered probe side and position the iterator before the
+   * first match.
+   * @param build_table The built build-side table
+   * @param probe_table The table buffering the probe side. It is partitioned,
+   *                    but never built.
+   */
+  JoinHashTablePartitionIterator(const JoinHashTable &build_table, JoinHashTable *probe_table);
+
+  /**
+   * Advance to the next matching pair and return true if it is found.
+   * @param key_eq The function used to determine key equality
+   * @param opaque_ctx An opaque context passed into the key equality function
+   * @return true iff there is a next match.
+   */
+  bool HasNext(KeyEq key_eq, void *opaque_ctx);
+
+  /**
+   * Return the probe tuple of the current match.
+   */
+  const byte *GetProbeRow() const noexcept { return probe_entry_->payload_; }
+
+  /**
+   * Return the build tuple of the current match.
+   */
+  const byte *GetBuildRow() const noexcept { return build_match_->payload_; }
+
+ private:
+  // The build and probe sides
+  const JoinHashTable &build_table_;
+  const JoinHashTable &probe_table_;
+  // The partition of the current probe tuple
+  uint64_t part_;
+  // The index of the next probe tuple
+  uint64_t next_probe_idx_;
+  // The current probe tuple
+  const HashTableEntry *probe_entry_;
+  // The next build tuple to compare against the current probe tuple
+  const HashTableEntry *build_next_;
+  // The build tuple of the current match
+  const HashTableEntry *build_match_;
+};
+
+/**
+ * The iterator over every entry of a join hash table, in no particular order.
+ * Outer and anti joins keep a match flag in each build tuple, which the probe
+ * clears, and scan the table with this iterator once probing is done to emit
+ * the tuples that never matched. Partitioned tables hand out their partitioned
+ * copy of the entries, which is the copy that probes see.
+ */
+class EXPORT JoinHashTableEntryIterator {
+ public:
+  /**
+   * Position the iterator before the first entry of the given table.
+   * @param table The table to iterate over
+   */
+  explicit JoinHashTableEntryIterator(const JoinHashTable &table);
+
+  /**
+   * Advance to the next entry and return true if there is one.
+   */
+  bool HasNext();
+
+  /**
+   * Return the tuple of the current entry.
+   */
+  const byte *GetRow() const noexcept { return entry_->payload_; }
+
+ private:
+  // The table being iterated over
+  const JoinHashTable &table_;
+  // The vector of entries being iterated over: zero for the table's own
+  // entries, and one past the index of an owned vector otherwise
+  uint64_t vector_idx_;
+  // The index of the next entry in the current vector
+  uint64_t next_idx_;
+  // The current entry
+  const HashTableEntry *entry_;
+};
+
 // ---------------------------------------------------------
 // JoinHashTable implementation
 // ---------------------------------------------------------
@@ -263,7 +435,7 @@ class EXPORT JoinHashTableIterator {
  */
 template <>
 inline JoinHashTableIterator JoinHashTable::Lookup<false>(const hash_t hash) const {
-  HashTableEntry *entry = generic_hash_table_.FindChainHead(hash);
+  HashTableEntry *entry = PartitionTable(PartitionOf(hash)).FindChainHead(hash);
   while (entry != nullptr && entry->hash_ != hash) {
     entry = entry->next_;
   }
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "execution/sql/hash_table_entry.h"
 #include "execution/sql/projected_columns_iterator.h"
 #include "execution/util/execution_common.h"
+#include "type/type_id.h"
 
 namespace terrier::execution::sql {
 
@@ -44,15 +48,100 @@ class EXPORT JoinHashTableVectorProbe {
    */
   const HashTableEntry *GetNextOutput(ProjectedColumnsIterator *pci, KeyEqFn key_eq_fn);
 
+  /**
+   * @param type The SQL type of a join key column
+   * @return Whether keys of the given type can be hashed and compared column-wise
+   */
+  static bool IsSupportedKeyType(type::TypeId type) {
+    switch (type) {
+      case type::TypeId::TINYINT:
+      case type::TypeId::SMALLINT:
+      case type::TypeId::INTEGER:
+      case type::TypeId::BIGINT:
+      case type::TypeId::DECIMAL:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /**
+   * Register a fixed-width join key. The key is read from the column at index @em col_idx of the probe input and is
+   * compared against the SQL value (i.e., an Integer or a Real) stored @em build_offset bytes into each build tuple.
+   * Keys are hashed in registration order, which must match the order used by @hash() when building the table.
+   * @param col_idx The index of the key column in the probe input
+   * @param type The SQL type of the key column
+   * @param build_offset The offset of the key in the build tuples
+   */
+  void AddKey(uint32_t col_idx, type::TypeId type, uint32_t build_offset);
+
+  /**
+   * Setup a vectorized lookup of the batch @em pci using the registered keys. The key columns are hashed a column at
+   * a time, all bucket chains are looked up at once (prefetching when the table does not fit in cache), and the keys
+   * of the candidate matches are compared a column at a time. NULL keys never match.
+   * @param pci The input vector
+   */
+  void Prepare(ProjectedColumnsIterator *pci);
+
+  /**
+   * Move to the next match found by Prepare(ProjectedColumnsIterator*), positioning @em pci at the probe tuple.
+   * @param pci The input vector the matches were computed on
+   * @return True if there is another match; false otherwise
+   */
+  bool HasNextMatch(ProjectedColumnsIterator *pci);
+
+  /**
+   * @return The build tuple of the current match
+   */
+  const byte *GetMatchRow() const { return matches_[match_idx_ - 1].entry_->payload_; }
+
+ private:
+  // A key value of the current batch, widened to the representation of the SQL value it is compared against
+  union KeyVal {
+    int64_t int_;
+    double real_;
+  };
+
+  // A fixed-width join key
+  struct Key {
+    // The index of the key column in the probe input
+    uint32_t col_idx_;
+    // The SQL type of the key column
+    type::TypeId type_;
+    // The offset of the key's SQL value in the build tuples
+    uint32_t build_offset_;
+    // The key values of the current batch, and whether they are NULL
+    std::unique_ptr<KeyVal[]> vals_;
+    std::unique_ptr<bool[]> nulls_;
+  };
+
+  // A probe tuple and a build tuple that may join
+  struct Match {
+    uint32_t probe_idx_;
+    const HashTableEntry *entry_;
+  };
+
+  // Read the key column into the key's buffer and mix its hash into the hash vector
+  template <typename T>
+  void HashKeyColumn(ProjectedColumnsIterator *pci, Key *key);
+
+  // Remove the candidate matches whose build key differs from the buffered probe key
+  template <typename ValType>
+  void FilterMatches(const Key &key);
+
  private:
   // The table we're probing
   const JoinHashTable &table_;
   // The current index in the entries output we're iterating over
-  uint16_t match_idx_;
+  uint32_t match_idx_;
   // The vector of computed hashes
   hash_t hashes_[common::Constants::K_DEFAULT_VECTOR_SIZE];
   // The vector of entries
   const HashTableEntry *entries_[common::Constants::K_DEFAULT_VECTOR_SIZE];
+  // The registered fixed-width keys
+  std::vector<Key> keys_;
+  // The matches of the current batch
+  std::vector<Match> matches_;
 };
 
 // ---------------------------------------------------------
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 #include <type_traits>
+#include <vector>
+#include "storage/frozen_columns_view.h"
 #include "storage/projected_columns.h"
 
 #include "common/macros.h"
@@ -50,6 +53,14 @@ class EXPORT ProjectedColumnsIterator {
    */
   void SetProjectedColumn(storage::ProjectedColumns *projected_column);
 
+  /**
+   * Reset this iterator to begin iteration over the tuples of a frozen block, read in place through the given view.
+   * Filters on dictionary compressed columns of the block are evaluated on the dictionary codes. The view must stay
+   * pointed at the tuples for as long as they are being iterated over.
+   * @param view The view over the frozen tuples to iterate over
+   */
+  void SetFrozenColumns(const storage::FrozenColumnsView *view);
+
   // -------------------------------------------------------
   // Tuple-at-a-time API
   // -------------------------------------------------------
@@ -57,7 +68,10 @@ class EXPORT ProjectedColumnsIterator {
   /**
    * @return The current tuple slot
    */
-  storage::TupleSlot CurrentSlot() { return projected_column_->TupleSlots()[curr_idx_]; }
+  storage::TupleSlot CurrentSlot() {
+    if (frozen_view_ != nullptr) return {frozen_view_->Block(), frozen_view_->Offset() + curr_idx_};
+    return projected_column_->TupleSlots()[curr_idx_];
+  }
 
   /**
    * Get a pointer to the value in the column at index @em col_idx
@@ -166,15 +180,40 @@ class EXPORT ProjectedColumnsIterator {
      * an int64_t filter value
      */
     int64_t bi_;
+    /**
+     * a boolean filter value
+     */
+    bool b_;
+    /**
+     * a double filter value
+     */
+    double r_;
+    /**
+     * a date filter value, in its native storage representation
+     */
+    uint32_t d_;
+    /**
+     * a timestamp filter value, in its native storage representation
+     */
+    uint64_t ts_;
+    /**
+     * a varchar filter value
+     */
+    storage::VarlenEntry str_;
   };
 
+  /**
+   * Arithmetic operations supported by vectorized filters over computed values.
+   */
+  enum class ArithmeticOp : uint8_t { Plus, Minus, Multiply };
+
   /**
    * Creates a filter value according to the given type.
    * @param val filter value
    * @param type type of the value
    * @return filter val of the given type
    */
-  FilterVal MakeFilterVal(int64_t val, type::TypeId type) {
+  static FilterVal MakeFilterVal(int64_t val, type::TypeId type) {
     switch (type) {
       case type::TypeId::TINYINT:
         return FilterVal{.ti_ = static_cast<int8_t>(val)};
@@ -191,6 +230,8 @@ class EXPORT ProjectedColumnsIterator {
 
   /**
    * Filter the column at index @em col_idx by the given constant value @em val.
+   * Comparisons are made on raw column values; NULLs are not checked and must
+   * be removed separately with FilterColIsNotNull() if the column is nullable.
    * @tparam Op The filtering operator.
    * @param col_idx The index of the column in the projection to filter.
    * @param type The type of the column.
@@ -202,7 +243,7 @@ class EXPORT ProjectedColumnsIterator {
 
   /**
    * Filter the column at index @em col_idx_1 with the contents of the column
-   * at index @em col_idx_2.
+   * at index @em col_idx_2. NULLs are not checked.
    * @tparam Op The filtering operator.
    * @param col_idx_1 The index of the first column to compare.
    * @param type_1 the Type of the first column.
@@ -213,6 +254,60 @@ class EXPORT ProjectedColumnsIterator {
   template <template <typename> typename Op>
   uint32_t FilterColByCol(uint32_t col_idx_1, type::TypeId type_1, uint32_t col_idx_2, type::TypeId type_2);
 
+  /**
+   * Filter the column at index @em col_idx to values in the inclusive range
+   * [@em lo, @em hi]. NULLs are not checked.
+   * @param col_idx The index of the column in the projection to filter.
+   * @param type The type of the column.
+   * @param lo The inclusive lower bound.
+   * @param hi The inclusive upper bound.
+   * @return The number of selected elements.
+   */
+  uint32_t FilterColBetween(uint32_t col_idx, type::TypeId type, FilterVal lo, FilterVal hi);
+
+  /**
+   * Filter the column at index @em col_idx to values that appear in the list
+   * @em vals. NULLs are not checked.
+   * @param col_idx The index of the column in the projection to filter.
+   * @param type The type of the column.
+   * @param vals The list of values.
+   * @param num_vals The number of values in the list.
+   * @return The number of selected elements.
+   */
+  uint32_t FilterColIn(uint32_t col_idx, type::TypeId type, const FilterVal *vals, uint32_t num_vals);
+
+  /**
+   * Filter the column at index @em col_idx to NULL values.
+   * @param col_idx The index of the column in the projection to filter.
+   * @return The number of selected elements.
+   */
+  uint32_t FilterColIsNull(uint32_t col_idx) { return FilterColByNull<true>(col_idx); }
+
+  /**
+   * Filter the column at index @em col_idx to non-NULL values.
+   * @param col_idx The index of the column in the projection to filter.
+   * @return The number of selected elements.
+   */
+  uint32_t FilterColIsNotNull(uint32_t col_idx) { return FilterColByNull<false>(col_idx); }
+
+  /**
+   * Filter the column at index @em col_idx by comparing the result of
+   * (col @em arith_op @em operand) with the constant value @em val. Integer
+   * columns are computed in 64-bit arithmetic (operand and value are read from
+   * FilterVal::bi_), and DECIMAL columns in double arithmetic (FilterVal::r_).
+   * NULLs are not checked.
+   * @tparam Op The filtering operator.
+   * @param col_idx The index of the column in the projection to filter.
+   * @param type The type of the column.
+   * @param arith_op The arithmetic operation to apply to every column value.
+   * @param operand The constant right-hand operand of the arithmetic operation.
+   * @param val The value to compare the computed values with.
+   * @return The number of selected elements.
+   */
+  template <template <typename> typename Op>
+  uint32_t FilterColArithByVal(uint32_t col_idx, type::TypeId type, ArithmeticOp arith_op, FilterVal operand,
+                               FilterVal val);
+
   /**
    * Return the number of selected tuples after any filters have been applied
    */
@@ -227,13 +322,65 @@ class EXPORT ProjectedColumnsIterator {
   template <typename T, template <typename> typename Op>
   uint32_t FilterColByColImpl(uint32_t col_idx_1, uint32_t col_idx_2);
 
+  // Filter a column by an inclusive range
+  template <typename T>
+  uint32_t FilterColBetweenImpl(uint32_t col_idx, T lo, T hi);
+
+  // Filter a column by a list of values
+  template <typename T>
+  uint32_t FilterColInImpl(uint32_t col_idx, const FilterVal *vals, uint32_t num_vals);
+
+  // Filter a column by its NULL indicator
+  template <bool IsNull>
+  uint32_t FilterColByNull(uint32_t col_idx);
+
+  // Filter a column by a computed value
+  template <typename T, typename R, template <typename> typename Op>
+  uint32_t FilterColArithByValImpl(uint32_t col_idx, ArithmeticOp arith_op, R operand, R val);
+
+  // Filter the current selection by an arbitrary position predicate
+  template <typename P>
+  uint32_t FilterByPredicate(const P &pred);
+
+  // Filter a dictionary compressed column to the codes in [lo, hi), or outside of it if Negate is set
+  template <bool Negate>
+  uint32_t FilterCodesInRange(const uint64_t *codes, uint64_t lo, uint64_t hi);
+
+  // Filter a lightweight encoded integer column to the values in [lo, hi], or outside of it if Negate is set, without
+  // reading its plain values. Returns false without filtering if the column is not encoded or the encoding does not
+  // apply to the type.
+  template <typename T, bool Negate>
+  bool FilterEncodedInRange(uint32_t col_idx, T lo, T hi);
+
+  // Get the dictionary codes of the column at the given index, or nullptr if it is not read from a dictionary
+  const uint64_t *DictionaryCodes(uint32_t col_idx) const {
+    return frozen_view_ == nullptr ? nullptr : frozen_view_->DictionaryCodes(static_cast<uint16_t>(col_idx));
+  }
+
+  // Get the typed data of the column at the given index
+  template <typename T>
+  const T *ColumnData(uint32_t col_idx) const {
+    return reinterpret_cast<const T *>(column_starts_[col_idx]);
+  }
+
  private:
   // The selection vector used to filter the ProjectedColumns
   alignas(common::Constants::CACHELINE_SIZE) uint32_t selection_vector_[common::Constants::K_DEFAULT_VECTOR_SIZE];
 
+  // Scratch space for computed values in arithmetic filters and for decoded values of encoded columns, allocated
+  // lazily
+  std::unique_ptr<byte[]> arith_buffer_;
+
   // The projected column we are iterating over.
   storage::ProjectedColumns *projected_column_{nullptr};
 
+  // The frozen tuples we are iterating over in place instead, if any
+  const storage::FrozenColumnsView *frozen_view_{nullptr};
+
+  // The start of the values and of the NULL bitmap of every column, in whichever of the two we are iterating over
+  std::vector<const byte *> column_starts_;
+  std::vector<const common::RawBitmap *> column_null_bitmaps_;
+
   // The current raw position in the ProjectedColumns we're pointing to
   uint32_t curr_idx_{0};
 
@@ -261,9 +408,9 @@ inline const T *ProjectedColumnsIterator::Get(uint32_t col_idx, bool *null) cons
   // NOLINTNEXTLINE: bugprone-suspicious-semicolon: seems like a false positive because of constexpr
   if constexpr (Nullable) {
     TERRIER_ASSERT(null != nullptr, "Missing output variable for NULL indicator");
-    *null = !projected_column_->ColumnNullBitmap(static_cast<uint16_t>(col_idx))->Test(curr_idx_);
+    *null = !column_null_bitmaps_[col_idx]->Test(curr_idx_);
   }
-  const T *col_data = reinterpret_cast<T *>(projected_column_->ColumnStart(static_cast<uint16_t>(col_idx)));
+  const T *col_data = reinterpret_cast<const T *>(column_starts_[col_idx]);
   return &col_data[curr_idx_];
 }
 
@@ -289,7 +436,9 @@ inline void ProjectedColumnsIterator::Match(bool matched) {
   selection_vector_write_idx_ += matched ? 1 : 0;
 }
 
-inline bool ProjectedColumnsIterator::HasNext() const { return curr_idx_ < projected_column_->NumTuples(); }
+inline bool ProjectedColumnsIterator::HasNext() const {
+  return curr_idx_ < (frozen_view_ == nullptr ? projected_column_->NumTuples() : frozen_view_->NumTuples());
+}
 
 inline bool ProjectedColumnsIterator::HasNextFiltered() const { return selection_vector_read_idx_ < NumSelected(); }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <vector>
 
 #include "common/macros.h"
@@ -170,6 +172,15 @@ class EXPORT SorterIterator {
    */
   void Next() { this->operator++(); }
 
+  /**
+   * Advance the iterator by the given number of rows, or to the end if fewer rows are left
+   * @param num_rows number of rows to skip
+   */
+  void SkipRows(uint64_t num_rows) {
+    const auto remaining = static_cast<uint64_t>(end_ - iter_);
+    iter_ += static_cast<std::ptrdiff_t>(std::min(num_rows, remaining));
+  }
+
   /**
    * Return a pointer to the current row. It assumed the called has checked the
    * iterator is valid.
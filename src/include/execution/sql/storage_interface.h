@@ -78,6 +78,12 @@ class EXPORT StorageInterface {
   bool IndexInsertUnique();
 
  protected:
+  /**
+   * Copies the out-of-line varlen values of the table PR into memory owned by the transaction, before the PR is
+   * written into the table.
+   */
+  void CopyVarlensIntoTxn();
+
   /**
    * Oid of the table being accessed.
    */
@@ -102,6 +108,10 @@ class EXPORT StorageInterface {
    * Columns being accessed.
    */
   std::vector<catalog::col_oid_t> col_oids_;
+  /**
+   * Offsets of the varlen columns in the table PR.
+   */
+  std::vector<uint16_t> varlen_offsets_;
   /**
    * Whether indexes will be accessed (used to avoid unnecessary allocation).
    */
@@ -58,6 +58,16 @@ class EXPORT TableVectorIterator {
    */
   void Reset();
 
+  /**
+   * Skip the blocks whose zone maps show that none of their values of the given column lie within [lo, hi]. The
+   * filter only prunes whole blocks, so the tuples handed out still have to be filtered. It is kept across resets.
+   * @param col_idx index of the column in the projection
+   * @param col_type SQL type of the column. Must be an integer, a date or a timestamp.
+   * @param lo lower bound, in the representation the column is stored in
+   * @param hi upper bound, in the representation the column is stored in
+   */
+  void FilterBlocks(uint32_t col_idx, type::TypeId col_type, int64_t lo, int64_t hi);
+
   /**
    * @return the iterator over the current active projection
    */
@@ -101,6 +111,10 @@ class EXPORT TableVectorIterator {
   storage::ProjectedColumns *projected_columns_ = nullptr;
   // Iterator of the slots in the PC
   std::unique_ptr<storage::DataTable::SlotIterator> iter_ = nullptr;
+  // View of the frozen tuples the PCI is reading in place, if any
+  storage::FrozenColumnsView frozen_view_;
+  // Ranges pushed down from the scan's predicate to prune blocks with
+  std::vector<storage::DataTable::ZoneRange> zone_ranges_;
 
   bool initialized_ = false;
 };
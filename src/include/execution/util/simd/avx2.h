@@ -2,6 +2,8 @@
 
 #include <immintrin.h>
 
+#include <cstring>
+
 #include "common/macros.h"
 #include "execution/util/execution_common.h"
 #include "execution/util/simd/types.h"
@@ -960,4 +962,44 @@ static inline uint32_t FilterVectorByVector(const T *RESTRICT in_1, const T *RES
   return out_pos;
 }
 
+// ---------------------------------------------------------
+// Bit Unpacking
+// ---------------------------------------------------------
+
+/**
+ * Widest packed integers the unpacking kernel handles. Every lane reads the four bytes starting at the byte holding
+ * the first bit of its integer, which covers the whole integer as long as it is no wider than 32 - 7 bits.
+ */
+constexpr uint32_t K_MAX_UNPACK_BIT_WIDTH = 25;
+
+/**
+ * Unpack bit-packed unsigned integers into 32-bit integers, eight at a time.
+ * @return The number of integers unpacked, which is zero if they are wider than K_MAX_UNPACK_BIT_WIDTH bits.
+ */
+static inline uint32_t UnpackBits(const uint8_t *RESTRICT in, const uint32_t bit_width, const uint32_t first,
+                                  const uint32_t count, uint32_t *RESTRICT out) {
+  if (bit_width > K_MAX_UNPACK_BIT_WIDTH) return 0;
+
+  const Vec8 lane_bits = Vec8(0, 1, 2, 3, 4, 5, 6, 7) * Vec8(static_cast<int32_t>(bit_width));
+  const Vec8 mask(static_cast<int32_t>((1u << bit_width) - 1)), bit_in_byte(7);
+
+  uint32_t pos = 0;
+  for (; pos + Vec8::Size() <= count; pos += Vec8::Size()) {
+    const Vec8 bits = Vec8(static_cast<int32_t>((first + pos) * bit_width)) + lane_bits;
+    const Vec8 bytes = bits >> 3;
+#if USE_GATHER == 1
+    const Vec8 words(_mm256_i32gather_epi32(reinterpret_cast<const int32_t *>(in), bytes, 1));
+#else
+    alignas(32) int32_t x[Vec8::Size()];
+    bytes.Store(x);
+    int32_t w[Vec8::Size()];
+    for (uint32_t lane = 0; lane < Vec8::Size(); lane++) std::memcpy(&w[lane], in + x[lane], sizeof(int32_t));
+    const Vec8 words(w[0], w[1], w[2], w[3], w[4], w[5], w[6], w[7]);
+#endif
+    ((words >> (bits & bit_in_byte)) & mask).Store(out + pos);
+  }
+
+  return pos;
+}
+
 }  // namespace terrier::execution::util::simd
@@ -1042,4 +1042,38 @@ static inline uint32_t FilterVectorByVector(const T *RESTRICT in_1, const T *RES
   return out_pos;
 }
 
+// ---------------------------------------------------------
+// Bit Unpacking
+// ---------------------------------------------------------
+
+/**
+ * Widest packed integers the unpacking kernel handles. Every lane reads the four bytes starting at the byte holding
+ * the first bit of its integer, which covers the whole integer as long as it is no wider than 32 - 7 bits.
+ */
+constexpr uint32_t K_MAX_UNPACK_BIT_WIDTH = 25;
+
+/**
+ * Unpack bit-packed unsigned integers into 32-bit integers, sixteen at a time.
+ * @return The number of integers unpacked, which is zero if they are wider than K_MAX_UNPACK_BIT_WIDTH bits.
+ */
+static inline uint32_t UnpackBits(const uint8_t *RESTRICT in, const uint32_t bit_width, const uint32_t first,
+                                  const uint32_t count, uint32_t *RESTRICT out) {
+  if (bit_width > K_MAX_UNPACK_BIT_WIDTH) return 0;
+
+  const auto b = static_cast<int32_t>(bit_width);
+  const Vec16 lane_bits(0, b, 2 * b, 3 * b, 4 * b, 5 * b, 6 * b, 7 * b, 8 * b, 9 * b, 10 * b, 11 * b, 12 * b, 13 * b,
+                        14 * b, 15 * b);
+  const Vec16 mask(static_cast<int32_t>((1u << bit_width) - 1)), bit_in_byte(7);
+
+  constexpr auto lanes = static_cast<uint32_t>(Vec16::Size());
+  uint32_t pos = 0;
+  for (; pos + lanes <= count; pos += lanes) {
+    const Vec16 bits = Vec16(static_cast<int32_t>((first + pos) * bit_width)) + lane_bits;
+    const Vec16 words(_mm512_i32gather_epi32(bits >> 3, in, 1));
+    ((words >> (bits & bit_in_byte)) & mask).Store(out + pos);
+  }
+
+  return pos;
+}
+
 }  // namespace terrier::execution::util::simd
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstring>
 #include <functional>
+#include <type_traits>
 
 #include "execution/util/execution_common.h"
 #include "execution/util/simd.h"
@@ -20,7 +22,9 @@ class VectorUtil {
   /**
    * Filter an input vector by a constant value and store the indexes of valid
    * elements in the output vector. If a selection vector is provided, only
-   * vector elements from the selection vector will be read.
+   * vector elements from the selection vector will be read. Signed integer
+   * inputs use SIMD kernels when available; all other types (e.g., floating
+   * point, dates) use the scalar loop.
    * @tparam T The data type of the elements stored in the input vector.
    * @tparam Op The filter comparison operation.
    * @param in The input vector.
@@ -37,10 +41,11 @@ class VectorUtil {
     static_assert(std::is_same_v<bool, std::invoke_result_t<Op<T>, T, T>>);
 
     uint32_t in_pos = 0;
-#if defined(__AVX2__) || defined(__AVX512F__)
-    uint32_t out_pos = simd::FilterVectorByVal<T, Op>(in, in_count, val, out, sel, &in_pos);
-#else
     uint32_t out_pos = 0;
+#if defined(__AVX2__) || defined(__AVX512F__)
+    if constexpr (IsSimdFilterable<T>()) {
+      out_pos = simd::FilterVectorByVal<T, Op>(in, in_count, val, out, sel, &in_pos);
+    }
 #endif
 
     if (sel == nullptr) {
@@ -81,10 +86,11 @@ class VectorUtil {
     static_assert(std::is_same_v<bool, std::invoke_result_t<Op<T>, T, T>>);
 
     uint32_t in_pos = 0;
-#if defined(__AVX2__) || defined(__AVX512F__)
-    uint32_t out_pos = simd::FilterVectorByVector<T, Op>(in_1, in_2, in_count, out, sel, &in_pos);
-#else
     uint32_t out_pos = 0;
+#if defined(__AVX2__) || defined(__AVX512F__)
+    if constexpr (IsSimdFilterable<T>()) {
+      out_pos = simd::FilterVectorByVector<T, Op>(in_1, in_2, in_count, out, sel, &in_pos);
+    }
 #endif
 
     if (sel == nullptr) {
@@ -104,6 +110,142 @@ class VectorUtil {
     return out_pos;
   }
 
+  /**
+   * Filter the positions of an input vector by an arbitrary predicate, and
+   * store the positions that pass into an output vector. The predicate is
+   * invoked with a (zero-based) position, not a value, so that it may read
+   * any number of input vectors, null bitmaps, etc. If a selection vector is
+   * provided, only the positions in the selection vector are tested. The
+   * output vector may alias the selection vector.
+   * @tparam P The predicate type. Must be invocable as bool(uint32_t).
+   * @param in_count The number of elements in the input (or selection) vector.
+   * @param pred The predicate to evaluate on each position.
+   * @param[out] out The vector storing the positions that pass the predicate.
+   * @param sel The selection vector storing positions to process.
+   * @return The number of elements that pass the filter.
+   */
+  template <typename P>
+  static uint32_t FilterVectorByPredicate(const uint32_t in_count, const P &pred, uint32_t *out,
+                                          const uint32_t *sel) {
+    static_assert(std::is_invocable_r_v<bool, P, uint32_t>, "Predicate must accept a position and return a bool");
+
+    uint32_t out_pos = 0;
+    if (sel == nullptr) {
+      for (uint32_t in_pos = 0; in_pos < in_count; in_pos++) {
+        const bool cmp = pred(in_pos);
+        out[out_pos] = in_pos;
+        out_pos += static_cast<uint32_t>(cmp);
+      }
+    } else {
+      for (uint32_t in_pos = 0; in_pos < in_count; in_pos++) {
+        const uint32_t pos = sel[in_pos];
+        const bool cmp = pred(pos);
+        out[out_pos] = pos;
+        out_pos += static_cast<uint32_t>(cmp);
+      }
+    }
+    return out_pos;
+  }
+
+  /**
+   * Filter an input vector by the inclusive range [lo, hi], i.e., SQL's
+   * BETWEEN, and store the indexes of valid elements in the output vector.
+   * @tparam T The data type of the elements stored in the input vector.
+   * @param in The input vector.
+   * @param in_count The number of elements in the input (or selection) vector.
+   * @param lo The inclusive lower bound.
+   * @param hi The inclusive upper bound.
+   * @param[out] out The vector storing indexes of valid input elements.
+   * @param sel The selection vector used to read input values.
+   * @return The number of elements that pass the filter.
+   */
+  template <typename T>
+  static uint32_t FilterVectorBetween(const T *RESTRICT in, const uint32_t in_count, const T lo, const T hi,
+                                      uint32_t *out, const uint32_t *sel) {
+    return FilterVectorByPredicate(in_count, [&](uint32_t i) { return lo <= in[i] && in[i] <= hi; }, out, sel);
+  }
+
+  /**
+   * Filter an input vector by membership in a list of constant values, i.e.,
+   * SQL's IN, and store the indexes of valid elements in the output vector.
+   * @tparam T The data type of the elements stored in the input vector.
+   * @param in The input vector.
+   * @param in_count The number of elements in the input (or selection) vector.
+   * @param vals The list of values to check membership in.
+   * @param num_vals The number of values in the list.
+   * @param[out] out The vector storing indexes of valid input elements.
+   * @param sel The selection vector used to read input values.
+   * @return The number of elements that pass the filter.
+   */
+  template <typename T>
+  static uint32_t FilterVectorIn(const T *RESTRICT in, const uint32_t in_count, const T *RESTRICT vals,
+                                 const uint32_t num_vals, uint32_t *out, const uint32_t *sel) {
+    return FilterVectorByPredicate(in_count,
+                                   [&](uint32_t i) {
+                                     bool found = false;
+                                     for (uint32_t j = 0; j < num_vals; j++) found |= (in[i] == vals[j]);
+                                     return found;
+                                   },
+                                   out, sel);
+  }
+
+  /**
+   * Apply an arithmetic operation between every element of an input vector and
+   * a constant value, and store the results into an output vector. Results are
+   * written at the same position as their input so that the output can be
+   * filtered with the same selection vector. Inputs are widened to the result
+   * type before the operation is applied.
+   * @tparam T The data type of the elements stored in the input vector.
+   * @tparam R The data type of the results.
+   * @tparam Op The arithmetic operation (e.g., std::plus).
+   * @param in The input vector.
+   * @param in_count The number of elements in the input (or selection) vector.
+   * @param val The constant right-hand operand.
+   * @param[out] out The vector storing the results.
+   * @param sel The selection vector used to read input values.
+   */
+  template <typename T, typename R, template <typename> typename Op>
+  static void ArithmeticVectorByVal(const T *RESTRICT in, const uint32_t in_count, const R val, R *RESTRICT out,
+                                    const uint32_t *RESTRICT sel) {
+    if (sel == nullptr) {
+      for (uint32_t in_pos = 0; in_pos < in_count; in_pos++) {
+        out[in_pos] = Op<R>()(static_cast<R>(in[in_pos]), val);
+      }
+    } else {
+      for (uint32_t in_pos = 0; in_pos < in_count; in_pos++) {
+        out[sel[in_pos]] = Op<R>()(static_cast<R>(in[sel[in_pos]]), val);
+      }
+    }
+  }
+
+  /**
+   * Unpack consecutive bit-packed unsigned integers into a vector of 32-bit
+   * integers. Integers are packed back to back, starting from the least
+   * significant bit of the first byte. The input must remain readable for at
+   * least eight bytes past the last packed integer.
+   * @param in The packed integers.
+   * @param bit_width The number of bits of every packed integer, at most 32.
+   * @param first The position of the first integer to unpack.
+   * @param count The number of integers to unpack.
+   * @param[out] out The vector storing the unpacked integers.
+   */
+  static void UnpackBits(const uint8_t *RESTRICT in, const uint32_t bit_width, const uint32_t first,
+                         const uint32_t count, uint32_t *RESTRICT out) {
+    TERRIER_ASSERT(bit_width <= 32, "Packed integers do not fit into the output");
+    uint32_t pos = 0;
+#if defined(__AVX2__) || defined(__AVX512F__)
+    pos = simd::UnpackBits(in, bit_width, first, count, out);
+#endif
+
+    const uint64_t mask = (uint64_t(1) << bit_width) - 1;
+    for (; pos < count; pos++) {
+      const uint64_t bit = static_cast<uint64_t>(first + pos) * bit_width;
+      uint64_t word;
+      std::memcpy(&word, in + bit / 8, sizeof(word));
+      out[pos] = static_cast<uint32_t>((word >> (bit % 8)) & mask);
+    }
+  }
+
   /**
    * Gather potentially non-contiguous indexes from an input vector and store
    * them into an output vector. Only elements whose indexes are stored in the
@@ -181,6 +323,14 @@ class VectorUtil {
                             uint32_t *RESTRICT sel) -> std::enable_if_t<std::is_pointer_v<T>, uint32_t> {
     return FilterNe(reinterpret_cast<const intptr_t *>(in), in_count, intptr_t(0), out, sel);
   }
+
+ private:
+  // The SIMD filter kernels use signed comparisons, so only signed integers
+  // may use them. Everything else is filtered by the scalar loops above.
+  template <typename T>
+  static constexpr bool IsSimdFilterable() {
+    return std::is_integral_v<T> && std::is_signed_v<T>;
+  }
 };
 
 }  // namespace terrier::execution::util
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <vector>
 
 #include "execution/util/execution_common.h"
@@ -21,7 +22,8 @@ class BytecodeEmitter {
    * the provided bytecode vector
    * @param bytecode vector to emit bytecodes into
    */
-  explicit BytecodeEmitter(std::vector<uint8_t> *bytecode) : bytecode_(bytecode) {}
+  explicit BytecodeEmitter(std::vector<uint8_t> *bytecode)
+      : bytecode_(bytecode), last_bytecode_pos_(K_NO_FUSION_CANDIDATE) {}
 
   /**
    * Cannot copy or move this class
@@ -311,6 +313,16 @@ class BytecodeEmitter {
   void EmitTableIterInit(Bytecode bytecode, LocalVar iter, LocalVar exec_ctx, uint32_t table_oid, LocalVar col_oids,
                          uint32_t num_oids);
 
+  /**
+   * Emit TVI block filter code
+   * @param iter TVI to filter the blocks of
+   * @param col_idx index of the column to filter on
+   * @param type type of the column
+   * @param lo lower bound of the column's values
+   * @param hi upper bound of the column's values
+   */
+  void EmitTableIterFilterBlocks(LocalVar iter, uint32_t col_idx, int8_t type, int64_t lo, int64_t hi);
+
   /**
    * Emit bytecode to add a column for scanning
    * @param bytecode bytecode to emit
@@ -347,10 +359,85 @@ class BytecodeEmitter {
   void EmitPCIVectorFilter(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type,
                            int64_t val);
 
+  /**
+   * Filter a column in the iterator by a SQL value
+   * @param bytecode filter bytecode to emit
+   * @param selected output variable for the number of selected values
+   * @param pci PCI to filter
+   * @param col_idx index of the column to filter
+   * @param type type of the column
+   * @param val SQL filter value
+   */
+  void EmitPCIVectorFilterSql(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type,
+                              LocalVar val);
+
+  /**
+   * Filter a column in the iterator by another column in the same iterator
+   * @param bytecode filter bytecode to emit
+   * @param selected output variable for the number of selected values
+   * @param pci PCI to filter
+   * @param col_idx_1 index of the first column
+   * @param type_1 type of the first column
+   * @param col_idx_2 index of the second column
+   * @param type_2 type of the second column
+   */
+  void EmitPCIVectorFilterColumn(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx_1, int8_t type_1,
+                                 uint32_t col_idx_2, int8_t type_2);
+
+  /**
+   * Filter a column in the iterator by the result of an arithmetic operation on it
+   * @param bytecode filter bytecode to emit
+   * @param selected output variable for the number of selected values
+   * @param pci PCI to filter
+   * @param col_idx index of the column to filter
+   * @param type type of the column
+   * @param arith_op arithmetic operation to apply on the column
+   * @param operand SQL value of the right operand of the arithmetic operation
+   * @param val SQL filter value
+   */
+  void EmitPCIVectorFilterArith(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type,
+                                int8_t arith_op, LocalVar operand, LocalVar val);
+
+  /**
+   * Filter a column in the iterator by an inclusive range
+   * @param selected output variable for the number of selected values
+   * @param pci PCI to filter
+   * @param col_idx index of the column to filter
+   * @param type type of the column
+   * @param lo SQL value of the lower bound
+   * @param hi SQL value of the upper bound
+   */
+  void EmitPCIVectorFilterBetween(LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type, LocalVar lo,
+                                  LocalVar hi);
+
+  /**
+   * Filter a column in the iterator by a list of values
+   * @param selected output variable for the number of selected values
+   * @param pci PCI to filter
+   * @param col_idx index of the column to filter
+   * @param type type of the column
+   * @param list array of SQL values
+   * @param num_vals number of values in the array
+   */
+  void EmitPCIVectorFilterIn(LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type, LocalVar list,
+                             uint32_t num_vals);
+
+  /**
+   * Filter a column in the iterator by its NULL indicator
+   * @param bytecode filter bytecode to emit
+   * @param selected output variable for the number of selected values
+   * @param pci PCI to filter
+   * @param col_idx index of the column to filter
+   */
+  void EmitPCIVectorFilterNull(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx);
+
   /**
    * Insert a filter flavor into the filter manager builder
+   * @param fmb the filter manager
+   * @param func the flavor
+   * @param flavor_id identity of the flavor that stays the same across compilations of the same code
    */
-  void EmitFilterManagerInsertFlavor(LocalVar fmb, FunctionId func);
+  void EmitFilterManagerInsertFlavor(LocalVar fmb, FunctionId func, int64_t flavor_id);
 
   /**
    * Lookup a single entry in the aggregation hash table
@@ -380,6 +467,11 @@ class BytecodeEmitter {
   void EmitJoinHashTableIterHasNext(LocalVar has_more, LocalVar iterator, FunctionId key_eq, LocalVar opaque_ctx,
                                     LocalVar probe_tuple);
 
+  /**
+   * Emit partitioned join iteration code
+   */
+  void EmitJoinHashTablePartIterHasNext(LocalVar has_more, LocalVar iterator, FunctionId key_eq, LocalVar opaque_ctx);
+
   /**
    * Initialize a sorter instance
    */
@@ -472,7 +564,10 @@ class BytecodeEmitter {
    * Emit a bytecode
    * @param bytecode bytecode to emit
    */
-  void EmitImpl(Bytecode bytecode) { EmitScalarValue(Bytecodes::ToByte(bytecode)); }
+  void EmitImpl(Bytecode bytecode) {
+    last_bytecode_pos_ = Position();
+    EmitScalarValue(Bytecodes::ToByte(bytecode));
+  }
 
   /**
    * Emit a local variable reference by encoding it into the bytecode stream
@@ -507,8 +602,25 @@ class BytecodeEmitter {
    */
   void EmitJump(BytecodeLabel *label);
 
+ private:
+  // Marker indicating that the next instruction cannot be fused with the last.
+  static constexpr std::size_t K_NO_FUSION_CANDIDATE = std::numeric_limits<std::size_t>::max();
+
+  // If the last emitted instruction can still be fused with the next one (i.e.,
+  // no label was bound since), return true and store its bytecode and first
+  // operand, which is its output for all fusible bytecodes.
+  bool PeekLast(Bytecode *bytecode, LocalVar *output) const;
+
+  // Overwrite the opcode of the last emitted instruction with the given
+  // superinstruction. The caller emits the remaining operands, if any.
+  void FuseWithLast(Bytecode fused);
+
  private:
   std::vector<uint8_t> *bytecode_;
+  // The position of the last instruction emitted, used for superinstruction
+  // fusion. Reset whenever a label is bound, since the next instruction may be
+  // a jump target.
+  std::size_t last_bytecode_pos_;
 };
 
 }  // namespace terrier::execution::vm
@@ -83,6 +83,7 @@ class BytecodeGenerator : public ast::AstVisitor<BytecodeGenerator> {
   void VisitExecutionContextCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinThreadStateContainerCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinSizeOfCall(ast::CallExpr *call);
+  void VisitBuiltinOffsetOfCall(ast::CallExpr *call);
   void VisitBuiltinTrigCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinOutputCall(ast::CallExpr *call, ast::Builtin builtin);
   void VisitBuiltinIndexIteratorCall(ast::CallExpr *call, ast::Builtin builtin);
@@ -154,6 +155,9 @@ class BytecodeGenerator : public ast::AstVisitor<BytecodeGenerator> {
   // Lookup a function's ID by its name
   FunctionId LookupFuncIdByName(const std::string &name) const;
 
+  // Fill in the identities of all filter flavors, once the bytecode of all functions is generated
+  void FillFlavorIds();
+
   // -------------------------------------------------------
   // Accessors
   // -------------------------------------------------------
@@ -174,6 +178,9 @@ class BytecodeGenerator : public ast::AstVisitor<BytecodeGenerator> {
   // Cache of function names to IDs for faster lookup
   std::unordered_map<std::string, FunctionId> func_map_;
 
+  // Positions of the flavor identities to fill in, and the flavors they identify
+  std::vector<std::pair<std::size_t, FunctionId>> flavor_ids_;
+
   // Emitter to write bytecode ops
   BytecodeEmitter emitter_;
 
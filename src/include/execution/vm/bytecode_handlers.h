@@ -15,6 +15,7 @@
 #include "execution/sql/functions/string_functions.h"
 #include "execution/sql/index_iterator.h"
 #include "execution/sql/join_hash_table.h"
+#include "execution/sql/join_hash_table_vector_probe.h"
 #include "execution/sql/projected_columns_iterator.h"
 #include "execution/sql/runtime_types.h"
 #include "execution/sql/sorter.h"
@@ -255,6 +256,9 @@ VM_OP_HOT void OpTableVectorIteratorGetPCI(terrier::execution::sql::ProjectedCol
   *pci = iter->GetProjectedColumnsIterator();
 }
 
+VM_OP void OpTableVectorIteratorFilterBlocks(terrier::execution::sql::TableVectorIterator *iter, uint32_t col_idx,
+                                             int8_t type, int64_t lo, int64_t hi);
+
 VM_OP_HOT void OpParallelScanTable(const uint32_t db_oid, const uint32_t table_oid, void *const query_state,
                                    terrier::execution::sql::ThreadStateContainer *const thread_states,
                                    const terrier::execution::sql::TableVectorIterator::ScanFn scanner) {
@@ -557,6 +561,40 @@ VM_OP void OpPCIFilterLessThanEqual(uint64_t *size, terrier::execution::sql::Pro
 VM_OP void OpPCIFilterNotEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
                                uint32_t col_idx, int8_t type, int64_t val);
 
+#define GEN_PCI_FILTER_OPS(Op)                                                                                \
+  VM_OP void OpPCIFilter##Op##Sql(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,    \
+                                  uint32_t col_idx, int8_t type, const terrier::execution::sql::Val *val);    \
+  VM_OP void OpPCIFilter##Op##Column(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter, \
+                                     uint32_t col_idx_1, int8_t type_1, uint32_t col_idx_2, int8_t type_2);   \
+  VM_OP void OpPCIFilter##Op##Arith(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,  \
+                                    uint32_t col_idx, int8_t type, int8_t arith_op,                           \
+                                    const terrier::execution::sql::Val *operand,                              \
+                                    const terrier::execution::sql::Val *val);
+GEN_PCI_FILTER_OPS(Equal)
+GEN_PCI_FILTER_OPS(GreaterThan)
+GEN_PCI_FILTER_OPS(GreaterThanEqual)
+GEN_PCI_FILTER_OPS(LessThan)
+GEN_PCI_FILTER_OPS(LessThanEqual)
+GEN_PCI_FILTER_OPS(NotEqual)
+#undef GEN_PCI_FILTER_OPS
+
+VM_OP void OpPCIFilterBetween(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter, uint32_t col_idx,
+                              int8_t type, const terrier::execution::sql::Val *lo,
+                              const terrier::execution::sql::Val *hi);
+
+VM_OP void OpPCIFilterIn(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter, uint32_t col_idx,
+                         int8_t type, const terrier::byte *list, uint32_t num_vals);
+
+VM_OP_HOT void OpPCIFilterIsNull(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                 uint32_t col_idx) {
+  *size = iter->FilterColIsNull(col_idx);
+}
+
+VM_OP_HOT void OpPCIFilterIsNotNull(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                    uint32_t col_idx) {
+  *size = iter->FilterColIsNotNull(col_idx);
+}
+
 // ---------------------------------------------------------
 // Hashing
 // ---------------------------------------------------------
@@ -590,7 +628,7 @@ VM_OP void OpFilterManagerInit(terrier::execution::sql::FilterManager *filter_ma
 VM_OP void OpFilterManagerStartNewClause(terrier::execution::sql::FilterManager *filter_manager);
 
 VM_OP void OpFilterManagerInsertFlavor(terrier::execution::sql::FilterManager *filter_manager,
-                                       terrier::execution::sql::FilterManager::MatchFn flavor);
+                                       terrier::execution::sql::FilterManager::MatchFn flavor, int64_t flavor_id);
 
 VM_OP void OpFilterManagerFinalize(terrier::execution::sql::FilterManager *filter_manager);
 
@@ -1126,7 +1164,8 @@ VM_OP_HOT void OpAvgAggregateFree(terrier::execution::sql::AvgAggregate *agg) {
 // ---------------------------------------------------------
 
 VM_OP void OpJoinHashTableInit(terrier::execution::sql::JoinHashTable *join_hash_table,
-                               terrier::execution::sql::MemoryPool *memory, uint32_t tuple_size);
+                               terrier::execution::sql::MemoryPool *memory, uint32_t tuple_size,
+                               bool use_partitioned_build);
 
 VM_OP_HOT void OpJoinHashTableAllocTuple(terrier::byte **result,
                                          terrier::execution::sql::JoinHashTable *join_hash_table,
@@ -1160,8 +1199,72 @@ VM_OP_HOT void OpJoinHashTableIterClose(terrier::execution::sql::JoinHashTableIt
   iterator->~JoinHashTableIterator();
 }
 
+VM_OP void OpJoinHashTablePartIterInit(terrier::execution::sql::JoinHashTablePartitionIterator *iterator,
+                                       terrier::execution::sql::JoinHashTable *build_table,
+                                       terrier::execution::sql::JoinHashTable *probe_table);
+
+VM_OP_HOT void OpJoinHashTablePartIterHasNext(bool *has_more,
+                                              terrier::execution::sql::JoinHashTablePartitionIterator *iterator,
+                                              terrier::execution::sql::JoinHashTablePartitionIterator::KeyEq key_eq,
+                                              void *opaque_ctx) {
+  *has_more = iterator->HasNext(key_eq, opaque_ctx);
+}
+
+VM_OP_HOT void OpJoinHashTablePartIterGetProbeRow(const terrier::byte **result,
+                                                  terrier::execution::sql::JoinHashTablePartitionIterator *iterator) {
+  *result = iterator->GetProbeRow();
+}
+
+VM_OP_HOT void OpJoinHashTablePartIterGetBuildRow(const terrier::byte **result,
+                                                  terrier::execution::sql::JoinHashTablePartitionIterator *iterator) {
+  *result = iterator->GetBuildRow();
+}
+
+VM_OP_HOT void OpJoinHashTablePartIterClose(terrier::execution::sql::JoinHashTablePartitionIterator *iterator) {
+  iterator->~JoinHashTablePartitionIterator();
+}
+
+VM_OP void OpJoinHashTableEntryIterInit(terrier::execution::sql::JoinHashTableEntryIterator *iterator,
+                                        terrier::execution::sql::JoinHashTable *join_hash_table);
+
+VM_OP_HOT void OpJoinHashTableEntryIterHasNext(bool *has_more,
+                                               terrier::execution::sql::JoinHashTableEntryIterator *iterator) {
+  *has_more = iterator->HasNext();
+}
+
+VM_OP_HOT void OpJoinHashTableEntryIterGetRow(const terrier::byte **result,
+                                              terrier::execution::sql::JoinHashTableEntryIterator *iterator) {
+  *result = iterator->GetRow();
+}
+
+VM_OP_HOT void OpJoinHashTableEntryIterClose(terrier::execution::sql::JoinHashTableEntryIterator *iterator) {
+  iterator->~JoinHashTableEntryIterator();
+}
+
 VM_OP void OpJoinHashTableFree(terrier::execution::sql::JoinHashTable *join_hash_table);
 
+VM_OP void OpJoinHashTableVectorProbeInit(terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                          terrier::execution::sql::JoinHashTable *join_hash_table);
+
+VM_OP void OpJoinHashTableVectorProbeAddKey(terrier::execution::sql::JoinHashTableVectorProbe *probe, uint32_t col_idx,
+                                            int32_t type, uint32_t build_offset);
+
+VM_OP void OpJoinHashTableVectorProbePrepare(terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                             terrier::execution::sql::ProjectedColumnsIterator *pci);
+
+VM_OP_HOT void OpJoinHashTableVectorProbeHasNext(bool *has_more,
+                                                 terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                                 terrier::execution::sql::ProjectedColumnsIterator *pci) {
+  *has_more = probe->HasNextMatch(pci);
+}
+
+VM_OP_HOT void OpJoinHashTableVectorProbeGetRow(const terrier::byte **result,
+                                                terrier::execution::sql::JoinHashTableVectorProbe *probe) {
+  *result = probe->GetMatchRow();
+}
+
+VM_OP void OpJoinHashTableVectorProbeFree(terrier::execution::sql::JoinHashTableVectorProbe *probe);
+
 // ---------------------------------------------------------
 // Sorting
 // ---------------------------------------------------------
@@ -1201,6 +1304,10 @@ VM_OP_HOT void OpSorterIteratorHasNext(bool *has_more, terrier::execution::sql::
 
 VM_OP_HOT void OpSorterIteratorNext(terrier::execution::sql::SorterIterator *iter) { iter->Next(); }
 
+VM_OP_HOT void OpSorterIteratorSkipRows(terrier::execution::sql::SorterIterator *iter, uint64_t num_rows) {
+  iter->SkipRows(num_rows);
+}
+
 VM_OP_HOT void OpSorterIteratorGetRow(const terrier::byte **row, terrier::execution::sql::SorterIterator *iter) {
   *row = iter->GetRow();
 }
@@ -1449,6 +1556,12 @@ VM_OP_WARM void OpIndexIteratorScanLimitDescending(terrier::execution::sql::Inde
   iter->ScanLimitDescending(limit);
 }
 
+VM_OP_WARM void OpIndexIteratorScanKeyBatch(terrier::execution::sql::IndexIterator *iter) { iter->ScanKeyBatch(); }
+
+VM_OP_WARM void OpIndexIteratorNextBatchKey(terrier::execution::sql::IndexIterator *iter) { iter->NextBatchKey(); }
+
+VM_OP_WARM void OpIndexIteratorSetKeyOnly(terrier::execution::sql::IndexIterator *iter) { iter->SetKeyOnly(); }
+
 VM_OP_WARM void OpIndexIteratorAdvance(bool *has_more, terrier::execution::sql::IndexIterator *iter) {
   *has_more = iter->Advance();
 }
@@ -1473,6 +1586,16 @@ VM_OP_WARM void OpIndexIteratorGetTablePR(terrier::storage::ProjectedRow **pr,
   *pr = iter->TablePR();
 }
 
+VM_OP_WARM void OpIndexIteratorGetKeyPR(terrier::storage::ProjectedRow **pr,
+                                        terrier::execution::sql::IndexIterator *iter) {
+  *pr = iter->KeyPR();
+}
+
+VM_OP_WARM void OpIndexIteratorAddBatchKey(terrier::storage::ProjectedRow **pr,
+                                           terrier::execution::sql::IndexIterator *iter) {
+  *pr = iter->AddBatchKey();
+}
+
 VM_OP_WARM void OpIndexIteratorGetSlot(terrier::storage::TupleSlot *slot,
                                        terrier::execution::sql::IndexIterator *iter) {
   *slot = iter->CurrentSlot();
@@ -1729,4 +1852,71 @@ VM_OP_HOT void OpGetParamString(terrier::execution::sql::StringVal *ret,
   }
 }
 
+// ---------------------------------------------------------
+// Superinstructions
+// ---------------------------------------------------------
+
+// Each superinstruction performs the exact same work as the bytecode sequence
+// it replaces, including all writes to intermediate locals, so fusing never
+// changes program semantics. Fused conditional jumps return the condition so
+// that the interpreter and the JIT can branch on it without re-reading the
+// frame.
+
+#define GEN_LEA_DEREF(type, size)                                                                          \
+  VM_OP_HOT void OpLeaDeref##size(terrier::byte **ptr, terrier::byte *base, uint32_t offset, type *dest) { \
+    OpLea(ptr, base, offset);                                                                              \
+    OpDeref##size(dest, reinterpret_cast<const type *>(*ptr));                                             \
+  }
+GEN_LEA_DEREF(int8_t, 1)
+GEN_LEA_DEREF(int16_t, 2)
+GEN_LEA_DEREF(int32_t, 4)
+GEN_LEA_DEREF(int64_t, 8)
+#undef GEN_LEA_DEREF
+
+#define COMPARISON_JUMPS(type, ...)                                                         \
+  VM_OP_HOT bool OpGreaterThanJumpIfFalse##_##type(bool *result, type lhs, type rhs) {      \
+    OpGreaterThan##_##type(result, lhs, rhs);                                               \
+    return *result;                                                                         \
+  }                                                                                         \
+  VM_OP_HOT bool OpGreaterThanEqualJumpIfFalse##_##type(bool *result, type lhs, type rhs) { \
+    OpGreaterThanEqual##_##type(result, lhs, rhs);                                          \
+    return *result;                                                                         \
+  }                                                                                         \
+  VM_OP_HOT bool OpEqualJumpIfFalse##_##type(bool *result, type lhs, type rhs) {            \
+    OpEqual##_##type(result, lhs, rhs);                                                     \
+    return *result;                                                                         \
+  }                                                                                         \
+  VM_OP_HOT bool OpLessThanJumpIfFalse##_##type(bool *result, type lhs, type rhs) {         \
+    OpLessThan##_##type(result, lhs, rhs);                                                  \
+    return *result;                                                                         \
+  }                                                                                         \
+  VM_OP_HOT bool OpLessThanEqualJumpIfFalse##_##type(bool *result, type lhs, type rhs) {    \
+    OpLessThanEqual##_##type(result, lhs, rhs);                                             \
+    return *result;                                                                         \
+  }                                                                                         \
+  VM_OP_HOT bool OpNotEqualJumpIfFalse##_##type(bool *result, type lhs, type rhs) {         \
+    OpNotEqual##_##type(result, lhs, rhs);                                                  \
+    return *result;                                                                         \
+  }
+
+INT_TYPES(COMPARISON_JUMPS);
+
+#undef COMPARISON_JUMPS
+
+VM_OP_HOT bool OpForceBoolTruthJumpIfFalse(bool *result, terrier::execution::sql::BoolVal *input) {
+  OpForceBoolTruth(result, input);
+  return *result;
+}
+
+VM_OP_HOT bool OpPCIHasNextJumpIfFalse(bool *has_more, terrier::execution::sql::ProjectedColumnsIterator *pci) {
+  OpPCIHasNext(has_more, pci);
+  return *has_more;
+}
+
+VM_OP_HOT bool OpPCIHasNextFilteredJumpIfFalse(bool *has_more,
+                                               terrier::execution::sql::ProjectedColumnsIterator *pci) {
+  OpPCIHasNextFiltered(has_more, pci);
+  return *has_more;
+}
+
 }  // extern "C"
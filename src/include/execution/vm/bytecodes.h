@@ -93,6 +93,28 @@ namespace terrier::execution::vm {
   F(Lea, OperandType::Local, OperandType::Local, OperandType::Imm4)                                                   \
   F(LeaScaled, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Imm4, OperandType::Imm4)      \
                                                                                                                       \
+  /* Superinstructions. These are never generated directly, but fused by the emitter from common sequences. */        \
+  F(LeaDeref1, OperandType::Local, OperandType::Local, OperandType::Imm4, OperandType::Local)                         \
+  F(LeaDeref2, OperandType::Local, OperandType::Local, OperandType::Imm4, OperandType::Local)                         \
+  F(LeaDeref4, OperandType::Local, OperandType::Local, OperandType::Imm4, OperandType::Local)                         \
+  F(LeaDeref8, OperandType::Local, OperandType::Local, OperandType::Imm4, OperandType::Local)                         \
+  /* NOTE: The fused conditional jumps below must remain contiguous. See Bytecodes::IsFusedConditionalJump(). */      \
+  CREATE_FOR_INT_TYPES(F, GreaterThanJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::Local,         \
+                       OperandType::JumpOffset)                                                                       \
+  CREATE_FOR_INT_TYPES(F, GreaterThanEqualJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::Local,    \
+                       OperandType::JumpOffset)                                                                       \
+  CREATE_FOR_INT_TYPES(F, EqualJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::Local,               \
+                       OperandType::JumpOffset)                                                                       \
+  CREATE_FOR_INT_TYPES(F, LessThanJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::Local,            \
+                       OperandType::JumpOffset)                                                                       \
+  CREATE_FOR_INT_TYPES(F, LessThanEqualJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::Local,       \
+                       OperandType::JumpOffset)                                                                       \
+  CREATE_FOR_INT_TYPES(F, NotEqualJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::Local,            \
+                       OperandType::JumpOffset)                                                                       \
+  F(ForceBoolTruthJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::JumpOffset)                       \
+  F(PCIHasNextJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::JumpOffset)                           \
+  F(PCIHasNextFilteredJumpIfFalse, OperandType::Local, OperandType::Local, OperandType::JumpOffset)                   \
+                                                                                                                      \
   /* Function calls */                                                                                                \
   F(Call, OperandType::FunctionId, OperandType::LocalCount)                                                           \
   F(Return)                                                                                                           \
@@ -118,6 +140,8 @@ namespace terrier::execution::vm {
   F(TableVectorIteratorReset, OperandType::Local)                                                                     \
   F(TableVectorIteratorFree, OperandType::Local)                                                                      \
   F(TableVectorIteratorGetPCI, OperandType::Local, OperandType::Local)                                                \
+  F(TableVectorIteratorFilterBlocks, OperandType::Local, OperandType::UImm4, OperandType::Imm1, OperandType::Imm8,    \
+    OperandType::Imm8)                                                                                                \
   F(ParallelScanTable, OperandType::UImm4, OperandType::UImm4, OperandType::Local, OperandType::Local,                \
     OperandType::FunctionId)                                                                                          \
                                                                                                                       \
@@ -164,11 +188,53 @@ namespace terrier::execution::vm {
     OperandType::Imm8)                                                                                                \
   F(PCIFilterNotEqual, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,                 \
     OperandType::Imm8)                                                                                                \
+  F(PCIFilterEqualSql, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,                 \
+    OperandType::Local)                                                                                               \
+  F(PCIFilterGreaterThanSql, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,           \
+    OperandType::Local)                                                                                               \
+  F(PCIFilterGreaterThanEqualSql, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,      \
+    OperandType::Local)                                                                                               \
+  F(PCIFilterLessThanSql, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,              \
+    OperandType::Local)                                                                                               \
+  F(PCIFilterLessThanEqualSql, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,         \
+    OperandType::Local)                                                                                               \
+  F(PCIFilterNotEqualSql, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,              \
+    OperandType::Local)                                                                                               \
+  F(PCIFilterEqualColumn, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,              \
+    OperandType::UImm4, OperandType::Imm1)                                                                            \
+  F(PCIFilterGreaterThanColumn, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,        \
+    OperandType::UImm4, OperandType::Imm1)                                                                            \
+  F(PCIFilterGreaterThanEqualColumn, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,   \
+    OperandType::UImm4, OperandType::Imm1)                                                                            \
+  F(PCIFilterLessThanColumn, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,           \
+    OperandType::UImm4, OperandType::Imm1)                                                                            \
+  F(PCIFilterLessThanEqualColumn, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,      \
+    OperandType::UImm4, OperandType::Imm1)                                                                            \
+  F(PCIFilterNotEqualColumn, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,           \
+    OperandType::UImm4, OperandType::Imm1)                                                                            \
+  F(PCIFilterEqualArith, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,               \
+    OperandType::Imm1, OperandType::Local, OperandType::Local)                                                        \
+  F(PCIFilterGreaterThanArith, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,         \
+    OperandType::Imm1, OperandType::Local, OperandType::Local)                                                        \
+  F(PCIFilterGreaterThanEqualArith, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,    \
+    OperandType::Imm1, OperandType::Local, OperandType::Local)                                                        \
+  F(PCIFilterLessThanArith, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,            \
+    OperandType::Imm1, OperandType::Local, OperandType::Local)                                                        \
+  F(PCIFilterLessThanEqualArith, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,       \
+    OperandType::Imm1, OperandType::Local, OperandType::Local)                                                        \
+  F(PCIFilterNotEqualArith, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,            \
+    OperandType::Imm1, OperandType::Local, OperandType::Local)                                                        \
+  F(PCIFilterBetween, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,                  \
+    OperandType::Local, OperandType::Local)                                                                           \
+  F(PCIFilterIn, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1, OperandType::Local,   \
+    OperandType::UImm4)                                                                                               \
+  F(PCIFilterIsNull, OperandType::Local, OperandType::Local, OperandType::UImm4)                                      \
+  F(PCIFilterIsNotNull, OperandType::Local, OperandType::Local, OperandType::UImm4)                                   \
                                                                                                                       \
   /* Filter Manager */                                                                                                \
   F(FilterManagerInit, OperandType::Local)                                                                            \
   F(FilterManagerStartNewClause, OperandType::Local)                                                                  \
-  F(FilterManagerInsertFlavor, OperandType::Local, OperandType::FunctionId)                                           \
+  F(FilterManagerInsertFlavor, OperandType::Local, OperandType::FunctionId, OperandType::Imm8)                       \
   F(FilterManagerFinalize, OperandType::Local)                                                                        \
   F(FilterManagerRunFilters, OperandType::Local, OperandType::Local)                                                  \
   F(FilterManagerFree, OperandType::Local)                                                                            \
@@ -328,16 +394,31 @@ namespace terrier::execution::vm {
   F(RealMinAggregateFree, OperandType::Local)                                                                         \
                                                                                                                       \
   /* Hash Joins */                                                                                                    \
-  F(JoinHashTableInit, OperandType::Local, OperandType::Local, OperandType::Local)                                    \
+  F(JoinHashTableInit, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)                \
   F(JoinHashTableAllocTuple, OperandType::Local, OperandType::Local, OperandType::Local)                              \
   F(JoinHashTableIterInit, OperandType::Local, OperandType::Local, OperandType::Local)                                \
   F(JoinHashTableIterHasNext, OperandType::Local, OperandType::Local, OperandType::FunctionId, OperandType::Local,    \
     OperandType::Local)                                                                                               \
   F(JoinHashTableIterGetRow, OperandType::Local, OperandType::Local)                                                  \
   F(JoinHashTableIterClose, OperandType::Local)                                                                       \
+  F(JoinHashTablePartIterInit, OperandType::Local, OperandType::Local, OperandType::Local)                            \
+  F(JoinHashTablePartIterHasNext, OperandType::Local, OperandType::Local, OperandType::FunctionId, OperandType::Local) \
+  F(JoinHashTablePartIterGetProbeRow, OperandType::Local, OperandType::Local)                                         \
+  F(JoinHashTablePartIterGetBuildRow, OperandType::Local, OperandType::Local)                                         \
+  F(JoinHashTablePartIterClose, OperandType::Local)                                                                   \
+  F(JoinHashTableEntryIterInit, OperandType::Local, OperandType::Local)                                               \
+  F(JoinHashTableEntryIterHasNext, OperandType::Local, OperandType::Local)                                            \
+  F(JoinHashTableEntryIterGetRow, OperandType::Local, OperandType::Local)                                             \
+  F(JoinHashTableEntryIterClose, OperandType::Local)                                                                  \
   F(JoinHashTableBuild, OperandType::Local)                                                                           \
   F(JoinHashTableBuildParallel, OperandType::Local, OperandType::Local, OperandType::Local)                           \
   F(JoinHashTableFree, OperandType::Local)                                                                            \
+  F(JoinHashTableVectorProbeInit, OperandType::Local, OperandType::Local)                                             \
+  F(JoinHashTableVectorProbeAddKey, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)    \
+  F(JoinHashTableVectorProbePrepare, OperandType::Local, OperandType::Local)                                          \
+  F(JoinHashTableVectorProbeHasNext, OperandType::Local, OperandType::Local, OperandType::Local)                      \
+  F(JoinHashTableVectorProbeGetRow, OperandType::Local, OperandType::Local)                                           \
+  F(JoinHashTableVectorProbeFree, OperandType::Local)                                                                 \
                                                                                                                       \
   /* Sorting */                                                                                                       \
   F(SorterInit, OperandType::Local, OperandType::Local, OperandType::FunctionId, OperandType::Local)                  \
@@ -352,6 +433,7 @@ namespace terrier::execution::vm {
   F(SorterIteratorGetRow, OperandType::Local, OperandType::Local)                                                     \
   F(SorterIteratorHasNext, OperandType::Local, OperandType::Local)                                                    \
   F(SorterIteratorNext, OperandType::Local)                                                                           \
+  F(SorterIteratorSkipRows, OperandType::Local, OperandType::Local)                                                   \
   F(SorterIteratorFree, OperandType::Local)                                                                           \
                                                                                                                       \
   /* Output */                                                                                                        \
@@ -366,12 +448,17 @@ namespace terrier::execution::vm {
   F(IndexIteratorScanAscending, OperandType::Local, OperandType::Local, OperandType::Local)                           \
   F(IndexIteratorScanDescending, OperandType::Local)                                                                  \
   F(IndexIteratorScanLimitDescending, OperandType::Local, OperandType::Local)                                         \
+  F(IndexIteratorScanKeyBatch, OperandType::Local)                                                                    \
+  F(IndexIteratorNextBatchKey, OperandType::Local)                                                                    \
+  F(IndexIteratorSetKeyOnly, OperandType::Local)                                                                      \
   F(IndexIteratorFree, OperandType::Local)                                                                            \
   F(IndexIteratorAdvance, OperandType::Local, OperandType::Local)                                                     \
   F(IndexIteratorGetPR, OperandType::Local, OperandType::Local)                                                       \
   F(IndexIteratorGetLoPR, OperandType::Local, OperandType::Local)                                                     \
   F(IndexIteratorGetHiPR, OperandType::Local, OperandType::Local)                                                     \
   F(IndexIteratorGetTablePR, OperandType::Local, OperandType::Local)                                                  \
+  F(IndexIteratorGetKeyPR, OperandType::Local, OperandType::Local)                                                    \
+  F(IndexIteratorAddBatchKey, OperandType::Local, OperandType::Local)                                                 \
   F(IndexIteratorGetSlot, OperandType::Local, OperandType::Local)                                                     \
                                                                                                                       \
   /* ProjectedRow */                                                                                                  \
@@ -613,7 +700,28 @@ class Bytecodes {
    * @return whether the given bytecode is a jump bytecode.
    */
   static constexpr bool IsJump(Bytecode bytecode) {
-    return (bytecode == Bytecode::Jump || bytecode == Bytecode::JumpIfFalse || bytecode == Bytecode::JumpIfTrue);
+    return (bytecode == Bytecode::Jump || bytecode == Bytecode::JumpIfFalse || bytecode == Bytecode::JumpIfTrue ||
+            IsFusedConditionalJump(bytecode));
+  }
+
+  /**
+   * Checks whether the given bytecode is a superinstruction that computes a boolean condition and then performs a
+   * JumpIfFalse on it. The condition is always the first operand and the jump offset is always the last operand.
+   * @param bytecode bytecode to check
+   * @return whether the given bytecode is a fused conditional jump bytecode.
+   */
+  static constexpr bool IsFusedConditionalJump(Bytecode bytecode) {
+    return bytecode >= Bytecode::GreaterThanJumpIfFalse_int8_t && bytecode <= Bytecode::PCIHasNextFilteredJumpIfFalse;
+  }
+
+  /**
+   * Jump bytecodes always encode their jump offset as their last operand.
+   * @param bytecode jump bytecode
+   * @return the index of the jump offset operand of the given jump bytecode
+   */
+  static uint32_t GetJumpOffsetOperandIndex(Bytecode bytecode) {
+    TERRIER_ASSERT(IsJump(bytecode), "Bytecode is not a jump");
+    return NumOperands(bytecode) - 1;
   }
 
   /**
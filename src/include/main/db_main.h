@@ -16,6 +16,9 @@
 #include "optimizer/statistics/stats_storage.h"
 #include "settings/settings_manager.h"
 #include "settings/settings_param.h"
+#include "storage/access_observer.h"
+#include "storage/block_compactor.h"
+#include "storage/block_compactor_thread.h"
 #include "storage/garbage_collector_thread.h"
 #include "transaction/deferred_action_manager.h"
 #include "transaction/transaction_manager.h"
@@ -110,7 +113,7 @@ class DBMain {
   };
 
   /**
-   * BlockStore and GarbageCollector
+   * BlockStore, GarbageCollector, and the BlockCompactor and AccessObserver attached to it
    */
   class StorageLayer {
    public:
@@ -118,19 +121,36 @@ class DBMain {
      * @param txn_layer arguments to the GarbageCollector
      * @param block_store_size_limit argument to the BlockStore
      * @param block_store_reuse_limit argument to the BlockStore
+     * @param block_store_page_size argument to the BlockStore
+     * @param block_store_numa_aware argument to the BlockStore
+     * @param block_store_prefault argument to the BlockStore
      * @param use_gc enable GarbageCollector
+     * @param use_compaction enable BlockCompactor and attach an AccessObserver to the GarbageCollector
+     * @param cold_data_epoch_threshold argument to the AccessObserver
      * @param log_manager needed for safe destruction of StorageLayer
      */
     StorageLayer(const common::ManagedPointer<TransactionLayer> txn_layer, const uint64_t block_store_size_limit,
-                 const uint64_t block_store_reuse_limit, const bool use_gc,
+                 const uint64_t block_store_reuse_limit, const storage::BlockPageSize block_store_page_size,
+                 const bool block_store_numa_aware, const uint64_t block_store_prefault, const bool use_gc,
+                 const bool use_compaction, const uint64_t cold_data_epoch_threshold,
                  const common::ManagedPointer<storage::LogManager> log_manager)
         : deferred_action_manager_(txn_layer->GetDeferredActionManager()), log_manager_(log_manager) {
+      if (use_compaction) {
+        TERRIER_ASSERT(use_gc, "BlockCompactor needs GarbageCollector to observe accesses.");
+        // Tuple moves do not maintain indexes or write to the log yet, so only blocks that are already compact are
+        // frozen
+        block_compactor_ = std::make_unique<storage::BlockCompactor>(false);
+        access_observer_ = std::make_unique<storage::AccessObserver>(block_compactor_.get(), cold_data_epoch_threshold);
+      }
+
       if (use_gc)
-        garbage_collector_ = std::make_unique<storage::GarbageCollector>(txn_layer->GetTimestampManager(),
-                                                                         txn_layer->GetDeferredActionManager(),
-                                                                         txn_layer->GetTransactionManager(), DISABLED);
+        garbage_collector_ = std::make_unique<storage::GarbageCollector>(
+            txn_layer->GetTimestampManager(), txn_layer->GetDeferredActionManager(),
+            txn_layer->GetTransactionManager(), access_observer_.get());
 
-      block_store_ = std::make_unique<storage::BlockStore>(block_store_size_limit, block_store_reuse_limit);
+      block_store_ = std::make_unique<storage::BlockStore>(block_store_size_limit, block_store_reuse_limit,
+                                                           block_store_page_size, block_store_numa_aware,
+                                                           block_store_prefault);
     }
 
     ~StorageLayer() {
@@ -156,9 +176,25 @@ class DBMain {
      */
     common::ManagedPointer<storage::BlockStore> GetBlockStore() const { return common::ManagedPointer(block_store_); }
 
+    /**
+     * @return ManagedPointer to the component, can be nullptr if disabled
+     */
+    common::ManagedPointer<storage::BlockCompactor> GetBlockCompactor() const {
+      return common::ManagedPointer(block_compactor_);
+    }
+
+    /**
+     * @return ManagedPointer to the component, can be nullptr if disabled
+     */
+    common::ManagedPointer<storage::AccessObserver> GetAccessObserver() const {
+      return common::ManagedPointer(access_observer_);
+    }
+
    private:
-    // Order currently does not matter in this layer
+    // Order matters here for destruction order, the GarbageCollector reports to the observer and compactor
     std::unique_ptr<storage::BlockStore> block_store_;
+    std::unique_ptr<storage::BlockCompactor> block_compactor_;
+    std::unique_ptr<storage::AccessObserver> access_observer_;
     std::unique_ptr<storage::GarbageCollector> garbage_collector_;
 
     // External dependencies for this layer
@@ -292,7 +328,7 @@ class DBMain {
       }
 
       std::unique_ptr<common::DedicatedThreadRegistry> thread_registry = DISABLED;
-      if (use_thread_registry_ || use_logging_ || use_network_)
+      if (use_thread_registry_ || use_logging_ || use_network_ || use_compaction_)
         thread_registry = std::make_unique<common::DedicatedThreadRegistry>(common::ManagedPointer(metrics_manager));
 
       auto buffer_segment_pool =
@@ -310,9 +346,10 @@ class DBMain {
       auto txn_layer = std::make_unique<TransactionLayer>(common::ManagedPointer(buffer_segment_pool), use_gc_,
                                                           common::ManagedPointer(log_manager));
 
-      auto storage_layer =
-          std::make_unique<StorageLayer>(common::ManagedPointer(txn_layer), block_store_size_, block_store_reuse_,
-                                         use_gc_, common::ManagedPointer(log_manager));
+      auto storage_layer = std::make_unique<StorageLayer>(
+          common::ManagedPointer(txn_layer), block_store_size_, block_store_reuse_, block_store_page_size_,
+          block_store_numa_aware_, block_store_prefault_, use_gc_, use_compaction_,
+          static_cast<uint64_t>(cold_data_epoch_threshold_), common::ManagedPointer(log_manager));
 
       std::unique_ptr<CatalogLayer> catalog_layer = DISABLED;
       if (use_catalog_) {
@@ -331,6 +368,16 @@ class DBMain {
                                                                       common::ManagedPointer(metrics_manager));
       }
 
+      std::unique_ptr<storage::BlockCompactorThread> compactor_thread = DISABLED;
+      if (use_compaction_) {
+        TERRIER_ASSERT(use_gc_thread_ && gc_thread != DISABLED,
+                       "BlockCompactorThread needs GarbageCollectorThread to observe accesses.");
+        compactor_thread = std::make_unique<storage::BlockCompactorThread>(
+            common::ManagedPointer(thread_registry), storage_layer->GetBlockCompactor(),
+            txn_layer->GetDeferredActionManager(), txn_layer->GetTransactionManager(),
+            std::chrono::milliseconds{compaction_interval_}, static_cast<uint64_t>(compaction_batch_size_));
+      }
+
       std::unique_ptr<optimizer::StatsStorage> stats_storage = DISABLED;
       if (use_stats_storage_) {
         stats_storage = std::make_unique<optimizer::StatsStorage>();
@@ -349,7 +396,7 @@ class DBMain {
         TERRIER_ASSERT(use_execution_ && execution_layer != DISABLED, "TrafficCopLayer needs ExecutionLayer.");
         traffic_cop = std::make_unique<trafficcop::TrafficCop>(
             txn_layer->GetTransactionManager(), catalog_layer->GetCatalog(), DISABLED,
-            common::ManagedPointer(stats_storage), optimizer_timeout_);
+            common::ManagedPointer(stats_storage), optimizer_timeout_, optimizer_num_threads_);
       }
 
       std::unique_ptr<NetworkLayer> network_layer = DISABLED;
@@ -369,6 +416,7 @@ class DBMain {
       db_main->storage_layer_ = std::move(storage_layer);
       db_main->catalog_layer_ = std::move(catalog_layer);
       db_main->gc_thread_ = std::move(gc_thread);
+      db_main->compactor_thread_ = std::move(compactor_thread);
       db_main->stats_storage_ = std::move(stats_storage);
       db_main->execution_layer_ = std::move(execution_layer);
       db_main->traffic_cop_ = std::move(traffic_cop);
@@ -512,6 +560,33 @@ class DBMain {
       return *this;
     }
 
+    /**
+     * @param value use component
+     * @return self reference for chaining
+     */
+    Builder &SetUseCompaction(const bool value) {
+      use_compaction_ = value;
+      return *this;
+    }
+
+    /**
+     * @param value AccessObserver argument
+     * @return self reference for chaining
+     */
+    Builder &SetColdDataEpochThreshold(const int32_t value) {
+      cold_data_epoch_threshold_ = value;
+      return *this;
+    }
+
+    /**
+     * @param value BlockCompactorThread argument
+     * @return self reference for chaining
+     */
+    Builder &SetCompactionInterval(const int32_t value) {
+      compaction_interval_ = value;
+      return *this;
+    }
+
     /**
      * @param value use component
      * @return self reference for chaining
@@ -575,6 +650,33 @@ class DBMain {
       return *this;
     }
 
+    /**
+     * @param value BlockStore argument
+     * @return self reference for chaining
+     */
+    Builder &SetBlockStorePageSize(const storage::BlockPageSize value) {
+      block_store_page_size_ = value;
+      return *this;
+    }
+
+    /**
+     * @param value BlockStore argument
+     * @return self reference for chaining
+     */
+    Builder &SetBlockStoreNumaAware(const bool value) {
+      block_store_numa_aware_ = value;
+      return *this;
+    }
+
+    /**
+     * @param value BlockStore argument
+     * @return self reference for chaining
+     */
+    Builder &SetBlockStorePrefault(const uint64_t value) {
+      block_store_prefault_ = value;
+      return *this;
+    }
+
     /**
      * @param value TrafficCop argument
      * @return self reference for chaining
@@ -584,6 +686,15 @@ class DBMain {
       return *this;
     }
 
+    /**
+     * @param value TrafficCop argument
+     * @return self reference for chaining
+     */
+    Builder &SetOptimizerNumThreads(const uint32_t value) {
+      optimizer_num_threads_ = value;
+      return *this;
+    }
+
     /**
      * @param value use component
      * @return self reference for chaining
@@ -617,12 +728,20 @@ class DBMain {
     bool create_default_database_ = true;
     uint64_t block_store_size_ = 1e5;
     uint64_t block_store_reuse_ = 1e3;
+    storage::BlockPageSize block_store_page_size_ = storage::BlockPageSize::DEFAULT;
+    bool block_store_numa_aware_ = false;
+    uint64_t block_store_prefault_ = 0;
     int32_t gc_interval_ = 10;
     bool use_gc_thread_ = false;
+    bool use_compaction_ = false;
+    int32_t cold_data_epoch_threshold_ = 10;
+    int32_t compaction_interval_ = 100;
+    int32_t compaction_batch_size_ = 100;
     bool use_stats_storage_ = false;
     bool use_execution_ = false;
     bool use_traffic_cop_ = false;
     uint64_t optimizer_timeout_ = 5000;
+    uint32_t optimizer_num_threads_ = 1;
     uint16_t network_port_ = 15721;
     bool use_network_ = false;
 
@@ -641,6 +760,18 @@ class DBMain {
           static_cast<uint64_t>(settings_manager->GetInt(settings::Param::record_buffer_segment_reuse));
       block_store_size_ = static_cast<uint64_t>(settings_manager->GetInt(settings::Param::block_store_size));
       block_store_reuse_ = static_cast<uint64_t>(settings_manager->GetInt(settings::Param::block_store_reuse));
+      switch (settings_manager->GetInt(settings::Param::block_store_huge_page_size)) {
+        case 2:
+          block_store_page_size_ = storage::BlockPageSize::HUGE_2MB;
+          break;
+        case 1024:
+          block_store_page_size_ = storage::BlockPageSize::HUGE_1GB;
+          break;
+        default:
+          block_store_page_size_ = storage::BlockPageSize::DEFAULT;
+      }
+      block_store_numa_aware_ = settings_manager->GetBool(settings::Param::block_store_numa_aware);
+      block_store_prefault_ = static_cast<uint64_t>(settings_manager->GetInt(settings::Param::block_store_prefault));
 
       log_file_path_ = settings_manager->GetString(settings::Param::log_file_path);
       num_log_manager_buffers_ =
@@ -651,9 +782,13 @@ class DBMain {
           static_cast<uint64_t>(settings_manager->GetInt64(settings::Param::log_persist_threshold));
 
       gc_interval_ = settings_manager->GetInt(settings::Param::gc_interval);
+      cold_data_epoch_threshold_ = settings_manager->GetInt(settings::Param::cold_data_epoch_threshold);
+      compaction_interval_ = settings_manager->GetInt(settings::Param::compaction_interval);
+      compaction_batch_size_ = settings_manager->GetInt(settings::Param::compaction_batch_size);
 
       network_port_ = static_cast<uint16_t>(settings_manager->GetInt(settings::Param::port));
       optimizer_timeout_ = static_cast<uint64_t>(settings_manager->GetInt(settings::Param::task_execution_timeout));
+      optimizer_num_threads_ = static_cast<uint32_t>(settings_manager->GetInt(settings::Param::optimizer_num_threads));
 
       return settings_manager;
     }
@@ -721,6 +856,13 @@ class DBMain {
     return common::ManagedPointer(gc_thread_);
   }
 
+  /**
+   * @return ManagedPointer to the component, can be nullptr if disabled
+   */
+  common::ManagedPointer<storage::BlockCompactorThread> GetBlockCompactorThread() const {
+    return common::ManagedPointer(compactor_thread_);
+  }
+
   /**
    * @return ManagedPointer to the component, can be nullptr if disabled
    */
@@ -756,6 +898,8 @@ class DBMain {
   std::unique_ptr<CatalogLayer> catalog_layer_;
   std::unique_ptr<storage::GarbageCollectorThread>
       gc_thread_;  // thread needs to die before manual invocations of GC in CatalogLayer and others
+  std::unique_ptr<storage::BlockCompactorThread>
+      compactor_thread_;  // thread needs to die before the GC threads and the final flushes of the system
   std::unique_ptr<optimizer::StatsStorage> stats_storage_;
   std::unique_ptr<ExecutionLayer> execution_layer_;
   std::unique_ptr<trafficcop::TrafficCop> traffic_cop_;
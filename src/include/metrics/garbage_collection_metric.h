@@ -28,6 +28,12 @@ class GarbageCollectionMetricRawData : public AbstractRawData {
     if (!other_db_metric->unlink_data_.empty()) {
       unlink_data_.splice(unlink_data_.cbegin(), other_db_metric->unlink_data_);
     }
+    if (!other_db_metric->index_data_.empty()) {
+      index_data_.splice(index_data_.cbegin(), other_db_metric->index_data_);
+    }
+    if (!other_db_metric->compaction_data_.empty()) {
+      compaction_data_.splice(compaction_data_.cbegin(), other_db_metric->compaction_data_);
+    }
   }
 
   /**
@@ -47,6 +53,8 @@ class GarbageCollectionMetricRawData : public AbstractRawData {
 
     auto &serializer_outfile = (*outfiles)[0];
     auto &consumer_outfile = (*outfiles)[1];
+    auto &index_outfile = (*outfiles)[2];
+    auto &compaction_outfile = (*outfiles)[3];
 
     for (const auto &data : deallocate_data_) {
       serializer_outfile << data.num_processed_ << ", ";
@@ -58,20 +66,35 @@ class GarbageCollectionMetricRawData : public AbstractRawData {
       data.resource_metrics_.ToCSV(consumer_outfile);
       consumer_outfile << std::endl;
     }
+    for (const auto &data : index_data_) {
+      index_outfile << data.num_indexes_ << ", " << data.index_oid_ << ", " << data.num_retained_ << ", ";
+      data.resource_metrics_.ToCSV(index_outfile);
+      index_outfile << std::endl;
+    }
+    for (const auto &data : compaction_data_) {
+      compaction_outfile << data.num_processed_ << ", " << data.num_frozen_ << ", " << data.num_bytes_reclaimed_
+                         << ", ";
+      data.resource_metrics_.ToCSV(compaction_outfile);
+      compaction_outfile << std::endl;
+    }
     deallocate_data_.clear();
     unlink_data_.clear();
+    index_data_.clear();
+    compaction_data_.clear();
   }
 
   /**
    * Files to use for writing to CSV.
    */
-  static constexpr std::array<std::string_view, 2> FILES = {"./gc_deallocate.csv", "./gc_unlink.csv"};
+  static constexpr std::array<std::string_view, 4> FILES = {"./gc_deallocate.csv", "./gc_unlink.csv",
+                                                            "./gc_index.csv", "./gc_compaction.csv"};
   /**
    * Columns to use for writing to CSV.
    * Note: This includes the columns for the input feature, but not the output (resource counters)
    */
-  static constexpr std::array<std::string_view, 2> FEATURE_COLUMNS = {"num_processed",
-                                                                      "num_processed, num_buffers, num_readonly"};
+  static constexpr std::array<std::string_view, 4> FEATURE_COLUMNS = {
+      "num_processed", "num_processed, num_buffers, num_readonly", "num_indexes, index_oid, num_retained",
+      "num_processed, num_frozen, num_bytes_reclaimed"};
 
  private:
   friend class GarbageCollectionMetric;
@@ -86,6 +109,16 @@ class GarbageCollectionMetricRawData : public AbstractRawData {
     unlink_data_.emplace_front(num_processed, num_buffers, num_readonly, resource_metrics);
   }
 
+  void RecordIndexData(const uint64_t num_indexes, const catalog::index_oid_t index_oid, const uint64_t num_retained,
+                       const common::ResourceTracker::Metrics &resource_metrics) {
+    index_data_.emplace_front(num_indexes, index_oid, num_retained, resource_metrics);
+  }
+
+  void RecordCompactionData(const uint64_t num_processed, const uint64_t num_frozen, const uint64_t num_bytes_reclaimed,
+                            const common::ResourceTracker::Metrics &resource_metrics) {
+    compaction_data_.emplace_front(num_processed, num_frozen, num_bytes_reclaimed, resource_metrics);
+  }
+
   struct DeallocateData {
     DeallocateData(const uint64_t num_processed, const common::ResourceTracker::Metrics &resource_metrics)
         : num_processed_(num_processed), resource_metrics_(resource_metrics) {}
@@ -106,12 +139,41 @@ class GarbageCollectionMetricRawData : public AbstractRawData {
     const common::ResourceTracker::Metrics resource_metrics_;
   };
 
+  struct IndexData {
+    IndexData(const uint64_t num_indexes, const catalog::index_oid_t index_oid, const uint64_t num_retained,
+              const common::ResourceTracker::Metrics &resource_metrics)
+        : num_indexes_(num_indexes),
+          index_oid_(index_oid),
+          num_retained_(num_retained),
+          resource_metrics_(resource_metrics) {}
+    const uint64_t num_indexes_;
+    const catalog::index_oid_t index_oid_;
+    const uint64_t num_retained_;
+    const common::ResourceTracker::Metrics resource_metrics_;
+  };
+
+  struct CompactionData {
+    CompactionData(const uint64_t num_processed, const uint64_t num_frozen, const uint64_t num_bytes_reclaimed,
+                   const common::ResourceTracker::Metrics &resource_metrics)
+        : num_processed_(num_processed),
+          num_frozen_(num_frozen),
+          num_bytes_reclaimed_(num_bytes_reclaimed),
+          resource_metrics_(resource_metrics) {}
+    const uint64_t num_processed_;
+    const uint64_t num_frozen_;
+    const uint64_t num_bytes_reclaimed_;
+    const common::ResourceTracker::Metrics resource_metrics_;
+  };
+
   std::list<DeallocateData> deallocate_data_;
   std::list<UnlinkData> unlink_data_;
+  std::list<IndexData> index_data_;
+  std::list<CompactionData> compaction_data_;
 };
 
 /**
- * Metrics for the garbage collection components of the system: currently deallocation and unlinking
+ * Metrics for the garbage collection components of the system: currently deallocation, unlinking, index garbage
+ * collection and block compaction
  */
 class GarbageCollectionMetric : public AbstractMetric<GarbageCollectionMetricRawData> {
  private:
@@ -124,5 +186,13 @@ class GarbageCollectionMetric : public AbstractMetric<GarbageCollectionMetricRaw
                         const common::ResourceTracker::Metrics &resource_metrics) {
     GetRawData()->RecordUnlinkData(num_processed, num_buffers, num_readonly, resource_metrics);
   }
+  void RecordIndexData(const uint64_t num_indexes, const catalog::index_oid_t index_oid, const uint64_t num_retained,
+                       const common::ResourceTracker::Metrics &resource_metrics) {
+    GetRawData()->RecordIndexData(num_indexes, index_oid, num_retained, resource_metrics);
+  }
+  void RecordCompactionData(const uint64_t num_processed, const uint64_t num_frozen, const uint64_t num_bytes_reclaimed,
+                            const common::ResourceTracker::Metrics &resource_metrics) {
+    GetRawData()->RecordCompactionData(num_processed, num_frozen, num_bytes_reclaimed, resource_metrics);
+  }
 };
 }  // namespace terrier::metrics
@@ -82,6 +82,34 @@ class MetricsStore {
     gc_metric_->RecordUnlinkData(num_processed, num_buffers, num_readonly, resource_metrics);
   }
 
+  /**
+   * Record metrics from an index garbage collection pass, one datapoint per index
+   * @param num_indexes first entry of metrics datapoint
+   * @param index_oid second entry of metrics datapoint
+   * @param num_retained third entry of metrics datapoint
+   * @param resource_metrics forth entry of metrics datapoint
+   */
+  void RecordIndexGCData(const uint64_t num_indexes, const catalog::index_oid_t index_oid, const uint64_t num_retained,
+                         const common::ResourceTracker::Metrics &resource_metrics) {
+    TERRIER_ASSERT(ComponentEnabled(MetricsComponent::GARBAGECOLLECTION), "GarbageCollectionMetric not enabled.");
+    TERRIER_ASSERT(gc_metric_ != nullptr, "GarbageCollectionMetric not allocated. Check MetricsStore constructor.");
+    gc_metric_->RecordIndexData(num_indexes, index_oid, num_retained, resource_metrics);
+  }
+
+  /**
+   * Record metrics from a pass of the block compactor
+   * @param num_processed first entry of metrics datapoint
+   * @param num_frozen second entry of metrics datapoint
+   * @param num_bytes_reclaimed third entry of metrics datapoint
+   * @param resource_metrics forth entry of metrics datapoint
+   */
+  void RecordCompactionData(const uint64_t num_processed, const uint64_t num_frozen, const uint64_t num_bytes_reclaimed,
+                            const common::ResourceTracker::Metrics &resource_metrics) {
+    TERRIER_ASSERT(ComponentEnabled(MetricsComponent::GARBAGECOLLECTION), "GarbageCollectionMetric not enabled.");
+    TERRIER_ASSERT(gc_metric_ != nullptr, "GarbageCollectionMetric not allocated. Check MetricsStore constructor.");
+    gc_metric_->RecordCompactionData(num_processed, num_frozen, num_bytes_reclaimed, resource_metrics);
+  }
+
   /**
    * Record metrics for transaction manager when beginning transaction
    * @param resource_metrics first entry of txn datapoint
@@ -69,7 +69,8 @@ class GroupBindingIterator : public BindingIterator {
         group_id_(id),
         pattern_(pattern),
         target_group_(memo_.GetGroupByID(id)),
-        num_group_items_(target_group_->GetLogicalExpressions().size()),
+        group_items_(target_group_->GetLogicalExpressions()),
+        num_group_items_(group_items_.size()),
         current_item_index_(0) {
     OPTIMIZER_LOG_TRACE("Attempting to bind on group {0}", id);
   }
@@ -102,6 +103,11 @@ class GroupBindingIterator : public BindingIterator {
    */
   Group *target_group_;
 
+  /**
+   * Logical expressions of the Group when binding started, as concurrent tasks may add more
+   */
+  std::vector<GroupExpression *> group_items_;
+
   /**
    * Number of items in the Group to try
    */
@@ -134,6 +134,12 @@ class ChildPropertyDeriver : public OperatorVisitor {
    */
   void Visit(const OuterHashJoin *op) override;
 
+  /**
+   * Visitor function for InnerMergeJoin
+   * @param op InnerMergeJoin operator to visit
+   */
+  void Visit(const InnerMergeJoin *op) override;
+
   /**
    * Visitor function for Insert
    * @param op Insert operator to visit
@@ -262,8 +268,10 @@ class ChildPropertyDeriver : public OperatorVisitor {
  private:
   /**
    * Derives properties for a JOIN
+   * @param keeps_probe_order whether the join outputs its rows in the order of the probe side, so that a sort on
+   * columns of the probe side can be pushed down to it. Outer joins append their unmatched rows at the end.
    */
-  void DeriveForJoin();
+  void DeriveForJoin(bool keeps_probe_order = true);
 
   /**
    * Any property requirements
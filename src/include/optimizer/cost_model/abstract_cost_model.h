@@ -15,7 +15,7 @@ class Memo;
 
 /**
  * Interface defining a cost model.
- * A cost model's primary entrypoint is CalculateCost()
+ * A cost model's primary entrypoint is CalculateCost(), which several optimizer tasks may call at once.
  */
 class AbstractCostModel : public OperatorVisitor {
  public:
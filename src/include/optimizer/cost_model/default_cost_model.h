@@ -33,11 +33,13 @@ class DefaultCostModel : public AbstractCostModel {
    * @return calculated cost
    */
   double CalculateCost(transaction::TransactionContext *txn, Memo *memo, GroupExpression *gexpr) override {
-    gexpr_ = gexpr;
-    memo_ = memo;
-    txn_ = txn;
-    gexpr_->Op().Accept(common::ManagedPointer<OperatorVisitor>(this));
-    return output_cost_;
+    // Optimizer tasks may cost expressions concurrently, so each call visits its own copy
+    DefaultCostModel visitor(*this);
+    visitor.gexpr_ = gexpr;
+    visitor.memo_ = memo;
+    visitor.txn_ = txn;
+    gexpr->Op().Accept(common::ManagedPointer<OperatorVisitor>(&visitor));
+    return visitor.output_cost_;
   }
 
   /**
@@ -127,26 +129,48 @@ class DefaultCostModel : public AbstractCostModel {
   void Visit(UNUSED_ATTRIBUTE const InnerHashJoin *op) override {
     auto left_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(0))->GetNumRows();
     auto right_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(1))->GetNumRows();
-    output_cost_ = (left_child_rows + right_child_rows) * DEFAULT_TUPLE_COST;
+    output_cost_ = HashJoinCost(left_child_rows, right_child_rows);
   }
 
   /**
    * Left hash join operator to visit
    * @param op operator
    */
-  void Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) override {}
+  void Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) override {
+    auto left_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(0))->GetNumRows();
+    auto right_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(1))->GetNumRows();
+    output_cost_ = HashJoinCost(left_child_rows, right_child_rows);
+  }
 
   /**
    * Right hash join operator to visit
    * @param op operator
    */
-  void Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) override {}
+  void Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) override {
+    auto left_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(0))->GetNumRows();
+    auto right_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(1))->GetNumRows();
+    output_cost_ = HashJoinCost(left_child_rows, right_child_rows);
+  }
 
   /**
    * Outer hash join operator to visit
    * @param op operator
    */
-  void Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) override {}
+  void Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) override {
+    auto left_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(0))->GetNumRows();
+    auto right_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(1))->GetNumRows();
+    output_cost_ = HashJoinCost(left_child_rows, right_child_rows);
+  }
+
+  /**
+   * Inner merge join operator to visit
+   * @param op operator
+   */
+  void Visit(UNUSED_ATTRIBUTE const InnerMergeJoin *op) override {
+    auto left_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(0))->GetNumRows();
+    auto right_child_rows = memo_->GetGroupByID(gexpr_->GetChildGroupId(1))->GetNumRows();
+    output_cost_ = MergeJoinCost(left_child_rows, right_child_rows);
+  }
 
   /**
    * Insert operator to visit
@@ -196,6 +220,27 @@ class DefaultCostModel : public AbstractCostModel {
    */
   void SetStatsStorage(StatsStorage *storage) { stats_storage_ = storage; }
 
+  /**
+   * Cost of a hash join, which builds a hash table over one input and probes it with the other
+   * @param left_child_rows number of rows of the left input
+   * @param right_child_rows number of rows of the right input
+   * @return cost of the join itself, without the cost of its inputs
+   */
+  static double HashJoinCost(double left_child_rows, double right_child_rows) {
+    return (left_child_rows + right_child_rows) * DEFAULT_TUPLE_COST;
+  }
+
+  /**
+   * Cost of a merge join, which walks both inputs in the order of the join keys. Rows are only compared, never hashed.
+   * The cost of sorting the inputs, if they are not sorted already, is added by the sort enforced below the join.
+   * @param left_child_rows number of rows of the left input
+   * @param right_child_rows number of rows of the right input
+   * @return cost of the join itself, without the cost of its inputs
+   */
+  static double MergeJoinCost(double left_child_rows, double right_child_rows) {
+    return (left_child_rows + right_child_rows) * DEFAULT_COMPARE_COST;
+  }
+
  private:
   /**
    * Function used to calculate cost of hashing based on the number of rows in the child group
@@ -262,6 +307,11 @@ class DefaultCostModel : public AbstractCostModel {
    */
   static constexpr double DEFAULT_INDEX_TUPLE_COST = 0.005;
 
+  /**
+   * Estimate the cost of comparing each row against the current row of a sorted input.
+   */
+  static constexpr double DEFAULT_COMPARE_COST = 0.005;
+
   /**
    * Default output cost if cost cannot be calculated.
    */
@@ -15,6 +15,7 @@ class GroupExpression;
  * This cost model is meant to just be a trivial cost model. The decisions it makes are as follows
  * Always choose index scan (cost of 0) over sequential scan (cost of 1)
  * Choose NL if left rows is a single record (for single record lookup queries), else choose hash join
+ * Choose hash join over merge join
  * Choose hash group by over sort group by
  */
 class TrivialCostModel : public AbstractCostModel {
@@ -31,11 +32,13 @@ class TrivialCostModel : public AbstractCostModel {
    * @param gexpr GroupExpression to calculate cost for
    */
   double CalculateCost(transaction::TransactionContext *txn, Memo *memo, GroupExpression *gexpr) override {
-    gexpr_ = gexpr;
-    memo_ = memo;
-    txn_ = txn;
-    gexpr_->Op().Accept(common::ManagedPointer<OperatorVisitor>(this));
-    return output_cost_;
+    // Optimizer tasks may cost expressions concurrently, so each call visits its own copy
+    TrivialCostModel visitor(*this);
+    visitor.gexpr_ = gexpr;
+    visitor.memo_ = memo;
+    visitor.txn_ = txn;
+    gexpr->Op().Accept(common::ManagedPointer<OperatorVisitor>(&visitor));
+    return visitor.output_cost_;
   };
 
   /**
@@ -116,6 +119,12 @@ class TrivialCostModel : public AbstractCostModel {
    */
   void Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) override {}
 
+  /**
+   * Visit a InnerMergeJoin operator
+   * @param op operator
+   */
+  void Visit(UNUSED_ATTRIBUTE const InnerMergeJoin *op) override { output_cost_ = 2.f; }
+
   /**
    * Visit a Insert operator
    * @param op operator
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -8,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/spin_latch.h"
 #include "optimizer/group_expression.h"
 #include "optimizer/operator_node_contents.h"
 #include "optimizer/optimizer_defs.h"
@@ -18,11 +20,16 @@
 namespace terrier::optimizer {
 
 class GroupExpression;
+class OptimizerTask;
 
 /**
  * Group collects together GroupExpressions that represent logically
  * equivalent expression trees.  A Group tracks both logical and
  * physical GroupExpressions.
+ *
+ * Expressions, costs and statistics may be added by concurrent optimizer tasks, so readers get copies of the expression
+ * lists rather than references to them. Column stats are never replaced once added, so the pointers handed out to them
+ * stay valid.
  */
 class Group {
  public:
@@ -91,13 +98,19 @@ class Group {
    * Gets the vector of all logical expressions
    * @returns Logical expressions belonging to this group
    */
-  const std::vector<GroupExpression *> &GetLogicalExpressions() const { return logical_expressions_; }
+  std::vector<GroupExpression *> GetLogicalExpressions() const {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    return logical_expressions_;
+  }
 
   /**
    * Gets the vector of all physical expressions
    *@returns Physical expressions belonging to this group
    */
-  const std::vector<GroupExpression *> &GetPhysicalExpressions() const { return physical_expressions_; }
+  std::vector<GroupExpression *> GetPhysicalExpressions() const {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    return physical_expressions_;
+  }
 
   /**
    * Gets the cost lower bound
@@ -106,6 +119,25 @@ class Group {
    */
   double GetCostLB() { return cost_lower_bound_; }
 
+  /**
+   * Starts optimizing the group for a PropertySet, unless another task is already optimizing it for the same one, or
+   * is still exploring it. Since there is no cycle in the tree, the group counts as explored from then on, even
+   * before all its expressions are.
+   *
+   * @param properties PropertySet to optimize for
+   * @param waiter task to hand back from FinishOptimizing() if another task is optimizing the group
+   * @param explore set to whether the caller has to explore the group, if it is to optimize it
+   * @returns whether the caller is to optimize the group, in which case it has to call FinishOptimizing()
+   */
+  bool StartOptimizing(PropertySet *properties, OptimizerTask *waiter, bool *explore);
+
+  /**
+   * Ends the optimization started by StartOptimizing()
+   * @param properties PropertySet the group has been optimized for
+   * @returns tasks that waited for the optimization
+   */
+  std::vector<OptimizerTask *> FinishOptimizing(PropertySet *properties);
+
   /**
    * Sets a flag indicating the group has been explored
    */
@@ -134,6 +166,7 @@ class Group {
    * @param column_name Column to get stats for
    */
   common::ManagedPointer<ColumnStats> GetStats(const std::string &column_name) {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
     TERRIER_ASSERT(stats_.count(column_name) != 0U, "Column Stats missing");
     return common::ManagedPointer<ColumnStats>(stats_[column_name].get());
   }
@@ -142,15 +175,19 @@ class Group {
    * Checks if there are stats for a column
    * @param column_name Column to check
    */
-  bool HasColumnStats(const std::string &column_name) { return stats_.count(column_name) != 0U; }
+  bool HasColumnStats(const std::string &column_name) {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    return stats_.count(column_name) != 0U;
+  }
 
   /**
-   * Add stats for a column
+   * Add stats for a column, unless there are some already, which are kept since they were derived the same way
    * @param column_name Column to add stats
    * @param stats Stats to add
    */
   void AddStats(const std::string &column_name, std::unique_ptr<ColumnStats> stats) {
-    stats_[column_name] = std::move(stats);
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    stats_.emplace(column_name, std::move(stats));
   }
 
   /**
@@ -170,6 +207,7 @@ class Group {
    * Should only be called during rewrite phase.
    */
   GroupExpression *GetLogicalExpression() {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
     TERRIER_ASSERT(logical_expressions_.size() == 1, "There should exist only 1 logical expression");
     TERRIER_ASSERT(physical_expressions_.empty(), "No physical expressions should be present");
     return logical_expressions_[0];
@@ -196,7 +234,17 @@ class Group {
   /**
    * Whether equivalent logical expressions have been explored for this group
    */
-  bool has_explored_;
+  std::atomic<bool> has_explored_;
+
+  /**
+   * Property requirements the group is being optimized for, with the tasks waiting for each optimization
+   */
+  std::unordered_map<PropertySet *, std::vector<OptimizerTask *>, PropSetPtrHash, PropSetPtrEq> optimizing_;
+
+  /**
+   * Property requirements of the optimization that explores the group, while it runs
+   */
+  PropertySet *exploring_ = nullptr;
 
   /**
    * Vector of equivalent logical expressions
@@ -224,12 +272,17 @@ class Group {
   /**
    * Number of rows
    */
-  int num_rows_ = -1;
+  std::atomic<int> num_rows_{-1};
 
   /**
    * Cost Lower Bound
    */
   double cost_lower_bound_ = -1;
+
+  /**
+   * Protects the expression lists, the lowest cost expressions, the optimizations under way and the column stats
+   */
+  mutable common::SpinLatch latch_;
 };
 
 }  // namespace terrier::optimizer
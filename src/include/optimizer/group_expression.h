@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <bitset>
 #include <map>
 #include <tuple>
@@ -8,6 +9,7 @@
 #include <vector>
 
 #include "common/hash_util.h"
+#include "common/spin_latch.h"
 #include "optimizer/group.h"
 #include "optimizer/operator_node_contents.h"
 #include "optimizer/optimizer_defs.h"
@@ -86,7 +88,10 @@ class GroupExpression {
    * @param requirements PropertySet that needs to be satisfied
    * @returns Lowest cost to satisfy that PropertySet
    */
-  double GetCost(PropertySet *requirements) const { return std::get<0>(lowest_cost_table_.find(requirements)->second); }
+  double GetCost(PropertySet *requirements) const {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    return std::get<0>(lowest_cost_table_.find(requirements)->second);
+  }
 
   /**
    * Gets the input properties needed for a given required properties
@@ -94,6 +99,7 @@ class GroupExpression {
    * @returns vector of children input properties required
    */
   std::vector<PropertySet *> GetInputProperties(PropertySet *requirements) const {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
     return std::get<1>(lowest_cost_table_.find(requirements)->second);
   }
 
@@ -128,14 +134,20 @@ class GroupExpression {
    * Marks a rule as having being explored in this GroupExpression
    * @param rule Rule to mark as explored
    */
-  void SetRuleExplored(Rule *rule) { rule_mask_.set(rule->GetRuleIdx(), true); }
+  void SetRuleExplored(Rule *rule) {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    rule_mask_.set(rule->GetRuleIdx(), true);
+  }
 
   /**
    * Checks whether a rule has been explored
    * @param rule Rule to see if explored
    * @returns TRUE if the rule has been explored already
    */
-  bool HasRuleExplored(Rule *rule) { return rule_mask_.test(rule->GetRuleIdx()); }
+  bool HasRuleExplored(Rule *rule) {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    return rule_mask_.test(rule->GetRuleIdx());
+  }
 
   /**
    * Sets a flag indicating stats have been derived
@@ -177,7 +189,7 @@ class GroupExpression {
   /**
    * Flag of whether stats are derived
    */
-  bool stats_derived_;
+  std::atomic<bool> stats_derived_;
 
   /**
    * Mapping from output properties to the corresponding best cost, statistics,
@@ -185,6 +197,11 @@ class GroupExpression {
    */
   std::unordered_map<PropertySet *, std::tuple<double, std::vector<PropertySet *>>, PropSetPtrHash, PropSetPtrEq>
       lowest_cost_table_;
+
+  /**
+   * Protects the explored rules and the lowest cost table, which concurrent optimizer tasks may update
+   */
+  mutable common::SpinLatch latch_;
 };
 
 }  // namespace terrier::optimizer
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "common/macros.h"
+
+namespace terrier::optimizer {
+
+/**
+ * JoinEnumerator picks the order in which to join a set of relations, given how many rows each of them has and which
+ * of them the join predicates connect. Plans are costed as trees of hash joins with the DefaultCostModel, with the
+ * output of every join estimated the way the StatsCalculator estimates it for a LogicalInnerJoin.
+ *
+ * Up to a threshold number of relations, the cheapest bushy tree without cross products is found with DPccp
+ * (Moerkotte and Neumann, "Analysis of Two Existing and One New Dynamic Programming Algorithm for the Generation of
+ * Optimal Bushy Join Trees without Cross Products", VLDB 2006), which only visits connected subgraphs of the join graph
+ * and pairs of them that a predicate connects. Predicates over more than two relations do not connect any pair of
+ * relations in the graph, and are only applied once all of their relations are joined. The plans of the connected
+ * components of the graph are then joined by cross products. Above the threshold, all relations are joined greedily.
+ */
+class JoinEnumerator {
+ public:
+  /**
+   * Number of relations up to which join orders are enumerated exhaustively
+   */
+  static constexpr uint32_t DEFAULT_DP_THRESHOLD = 12;
+
+  /**
+   * Maximum number of relations a join order can be picked for
+   */
+  static constexpr uint32_t MAX_RELATIONS = 64;
+
+  /**
+   * Marks the missing children of the plan of a single relation
+   */
+  static constexpr uint32_t NO_PLAN = UINT32_MAX;
+
+  /**
+   * Plan of a single relation, or of the join of two smaller plans
+   */
+  struct Plan {
+    /**
+     * Set of the relations the plan joins, as a bitmask over their indexes
+     */
+    uint64_t relations_;
+
+    /**
+     * Index of the plan of the left input, or NO_PLAN for a single relation
+     */
+    uint32_t left_;
+
+    /**
+     * Index of the plan of the right input, or NO_PLAN for a single relation
+     */
+    uint32_t right_;
+
+    /**
+     * Indexes of the predicates applied by this join
+     */
+    std::vector<uint32_t> predicates_;
+
+    /**
+     * Estimated number of output rows
+     */
+    double num_rows_;
+
+    /**
+     * Estimated cost of the plan, including its inputs
+     */
+    double cost_;
+  };
+
+  /**
+   * Constructs an enumerator without any relations
+   * @param dp_threshold number of relations up to which join orders are enumerated exhaustively
+   */
+  explicit JoinEnumerator(uint32_t dp_threshold = DEFAULT_DP_THRESHOLD) : dp_threshold_(dp_threshold) {}
+
+  DISALLOW_COPY_AND_MOVE(JoinEnumerator)
+
+  /**
+   * Adds a relation to join. Relations are numbered in the order they are added, and a relation's plan has the same
+   * index as the relation.
+   * @param num_rows estimated number of rows of the relation
+   * @return index of the relation
+   */
+  uint32_t AddRelation(double num_rows);
+
+  /**
+   * Adds a join predicate. Predicates are numbered in the order they are added.
+   * @param relations bitmask of the relations the predicate refers to. A predicate that refers to no relation is
+   * applied by the topmost join.
+   * @param equi_join whether the predicate is an equality between columns of two of the relations
+   */
+  void AddPredicate(uint64_t relations, bool equi_join);
+
+  /**
+   * Picks the order to join all relations in. Must only be called once, after at least one relation has been added.
+   * @return index of the plan that joins all relations
+   */
+  uint32_t Enumerate();
+
+  /**
+   * @param idx index of a plan
+   * @return the plan with the given index
+   */
+  const Plan &GetPlan(uint32_t idx) const { return plans_[idx]; }
+
+  /**
+   * @return whether the join order was enumerated exhaustively, rather than picked greedily
+   */
+  bool IsExhaustive() const { return adjacent_.size() <= dp_threshold_; }
+
+ private:
+  struct Predicate {
+    uint64_t relations_;
+    bool equi_join_;
+  };
+
+  static uint64_t Bit(uint32_t idx) { return uint64_t{1} << idx; }
+  static bool IsSingleton(uint64_t set) { return (set & (set - 1)) == 0; }
+
+  // Whether the predicate is applied by the plan of the given set of relations, or by one of its inputs
+  static bool IsApplied(const Predicate &predicate, uint64_t relations) {
+    return (predicate.relations_ & ~relations) == 0 && !IsSingleton(relations);
+  }
+
+  // Builds, without storing it, the plan that joins the given two plans
+  Plan Join(uint32_t left, uint32_t right) const;
+
+  // Whether some predicate refers to relations from both of the given plans
+  bool Connects(uint32_t left, uint32_t right) const;
+
+  // Relabels relations breadth-first, one connected component after the other, as DPccp requires
+  void LabelBreadthFirst();
+
+  // DPccp, over sets of relation labels
+  void EnumerateConnectedSubgraphs();
+  void ExpandSubgraph(uint64_t subgraph, uint64_t excluded);
+  void EmitSubgraph(uint64_t subgraph);
+  void ExpandComplement(uint64_t subgraph, uint64_t complement, uint64_t excluded);
+  void EmitPair(uint64_t subgraph, uint64_t complement);
+  uint64_t Neighborhood(uint64_t labels) const;
+
+  // Joins the given plans into one, picking the pair with the smallest output at every step
+  uint32_t JoinGreedily(std::vector<uint32_t> inputs);
+
+  const uint32_t dp_threshold_;
+  std::vector<Plan> plans_;
+  std::vector<Predicate> predicates_;
+
+  // Relations each relation shares a predicate over exactly two relations with, by relation index
+  std::vector<uint64_t> adjacent_;
+  // Relation labelled with each label, and the neighbours of each label
+  std::vector<uint32_t> relation_of_label_;
+  std::vector<uint64_t> label_neighbors_;
+  // Labels of the relations in each connected component
+  std::vector<uint64_t> components_;
+  // Index of the cheapest plan found so far for a connected set of relation labels
+  std::unordered_map<uint64_t, uint32_t> best_plans_;
+};
+
+}  // namespace terrier::optimizer
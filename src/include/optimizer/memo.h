@@ -4,6 +4,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "common/shared_latch.h"
 #include "optimizer/group.h"
 #include "optimizer/group_expression.h"
 #include "optimizer/operator_node.h"
@@ -38,6 +39,8 @@ struct GExprPtrEq {
 /**
  * Memo class provides for tracking Groups and GroupExpressions and provides the
  * mechanisms by which we can do duplicate group detection.
+ *
+ * Concurrent optimizer tasks may insert expressions and look up groups at the same time.
  */
 class Memo {
  public:
@@ -94,9 +97,8 @@ class Memo {
    * @returns Group with specified ID
    */
   Group *GetGroupByID(group_id_t id) const {
-    auto idx = !id;
-    TERRIER_ASSERT(idx >= 0 && static_cast<size_t>(idx) < groups_.size(), "group_id out of bounds");
-    return groups_[idx];
+    common::SharedLatch::ScopedSharedLatch guard(&latch_);
+    return GetGroupByIDLatched(id);
   }
 
   /**
@@ -106,6 +108,7 @@ class Memo {
    * @param group_id GroupID of Group to erase
    */
   void EraseExpression(group_id_t group_id) {
+    common::SharedLatch::ScopedExclusiveLatch guard(&latch_);
     auto idx = !group_id;
     TERRIER_ASSERT(idx >= 0 && static_cast<size_t>(idx) < groups_.size(), "group_id out of bounds");
 
@@ -115,6 +118,17 @@ class Memo {
   }
 
  private:
+  /**
+   * Gets the group with certain ID while the latch is already held
+   * @param id ID of the group to get
+   * @returns Group with specified ID
+   */
+  Group *GetGroupByIDLatched(group_id_t id) const {
+    auto idx = !id;
+    TERRIER_ASSERT(idx >= 0 && static_cast<size_t>(idx) < groups_.size(), "group_id out of bounds");
+    return groups_[idx];
+  }
+
   /**
    * Creates a new group
    * @param gexpr GroupExpression to collect metadata from
@@ -132,6 +146,11 @@ class Memo {
    * Vector of groups tracked
    */
   std::vector<Group *> groups_;
+
+  /**
+   * Protects the tracked GroupExpressions and groups
+   */
+  mutable common::SharedLatch latch_;
 };
 
 }  // namespace terrier::optimizer
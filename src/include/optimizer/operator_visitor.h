@@ -108,6 +108,12 @@ class OperatorVisitor {
    */
   virtual void Visit(const OuterHashJoin *outer_hash_join) {}
 
+  /**
+   * Visit a InnerMergeJoin operator
+   * @param inner_merge_join operator
+   */
+  virtual void Visit(const InnerMergeJoin *inner_merge_join) {}
+
   /**
    * Visit a Insert operator
    * @param insert operator
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
 
 #include "optimizer/optimizer_task.h"
@@ -64,9 +65,9 @@ class OptimizationContext {
   PropertySet *required_prop_;
 
   /**
-   * Cost Upper Bound (for pruning)
+   * Cost Upper Bound (for pruning), shared by the concurrent tasks optimizing under this context
    */
-  double cost_upper_bound_;
+  std::atomic<double> cost_upper_bound_;
 };
 
 }  // namespace terrier::optimizer
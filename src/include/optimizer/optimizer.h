@@ -25,7 +25,9 @@ class TransactionContext;
 
 namespace optimizer {
 
+class JoinEnumerator;
 class OperatorNode;
+class OptimizerJoinTest;
 
 /**
  * Optimizer class that implements the AbstractOptimizer abstract class
@@ -41,11 +43,16 @@ class Optimizer : public AbstractOptimizer {
    * Constructor for Optimizer with a cost_model
    * @param model Cost Model to use for the optimizer
    * @param task_execution_timeout time in ms to spend on a task
+   * @param num_threads number of threads to search the plan space with
    */
-  explicit Optimizer(std::unique_ptr<AbstractCostModel> model, const uint64_t task_execution_timeout)
+  explicit Optimizer(std::unique_ptr<AbstractCostModel> model, const uint64_t task_execution_timeout,
+                     const uint32_t num_threads = 1)
       : cost_model_(std::move(model)),
         context_(std::make_unique<OptimizerContext>(common::ManagedPointer(cost_model_))),
-        task_execution_timeout_(task_execution_timeout) {}
+        task_execution_timeout_(task_execution_timeout),
+        num_threads_(num_threads) {
+    TERRIER_ASSERT(num_threads_ > 0, "Optimizer needs at least one thread");
+  }
 
   /**
    * Build the plan tree for query execution
@@ -67,6 +74,9 @@ class Optimizer : public AbstractOptimizer {
   void Reset() override;
 
  private:
+  // Inspects the memo before it is reset
+  friend class OptimizerJoinTest;
+
   /**
    * Invoke a single optimization pass through the entire query.
    * The optimization pass includes rewriting and optimization logic.
@@ -75,6 +85,58 @@ class Optimizer : public AbstractOptimizer {
    */
   void OptimizeLoop(group_id_t root_group_id, PropertySet *required_props);
 
+  /**
+   * Collects the groups at the root of every tree of inner joins in the rewritten query
+   * @param group_id Group to start searching at
+   * @param join_roots Groups found so far, to add to
+   */
+  void FindJoinTrees(group_id_t group_id, std::vector<group_id_t> *join_roots);
+
+  /**
+   * Collects the joins and the inputs of the tree of inner joins rooted at the given group
+   * @param group_id Group of the root of the tree, or of an input to it
+   * @param inputs Groups of the inputs of the tree, to add to
+   * @param joins Logical expressions of the joins of the tree, to add to
+   */
+  void CollectJoinTree(group_id_t group_id, std::vector<group_id_t> *inputs, std::vector<GroupExpression *> *joins);
+
+  /**
+   * Picks the order of the joins of a tree of inner joins with the JoinEnumerator, from the estimated sizes of its
+   * inputs, and adds the chosen tree to the memo. The join reordering rules are not applied to the joins of the
+   * original or the chosen tree afterwards, as every join is added with both orders of its inputs, and exploring more
+   * orders would be based on the same estimates. Trees whose predicates refer to other tables are left to the rules.
+   * @param root_group_id Group of the root of the tree
+   * @param added_joins Join expressions added to the memo, to add to
+   */
+  void EnumerateJoinOrder(group_id_t root_group_id, std::vector<GroupExpression *> *added_joins);
+
+  /**
+   * Adds the given plan of the JoinEnumerator to the memo
+   * @param enumerator JoinEnumerator that picked the plan
+   * @param plan_idx Index of the plan
+   * @param inputs Groups of the relations the enumerator joined
+   * @param predicates Predicates the enumerator applied
+   * @param target_group Group to add the plan to, or UNDEFINED_GROUP for a new group
+   * @param added_joins Join expressions added to the memo, to add to
+   * @returns Group of the plan
+   */
+  group_id_t AddJoinTree(const JoinEnumerator &enumerator, uint32_t plan_idx, const std::vector<group_id_t> &inputs,
+                         const std::vector<AnnotatedExpression> &predicates, group_id_t target_group,
+                         std::vector<GroupExpression *> *added_joins);
+
+  /**
+   * Adds the inner join of two groups to the memo, in both orders, and marks the join reordering rules as explored
+   * for both expressions
+   * @param left Group of one input
+   * @param right Group of the other input
+   * @param predicates Join predicates
+   * @param target_group Group to add the join to, or UNDEFINED_GROUP for a new group
+   * @param added_joins Join expressions added to the memo, to add to
+   * @returns Group of the join
+   */
+  group_id_t AddJoin(group_id_t left, group_id_t right, const std::vector<AnnotatedExpression> &predicates,
+                     group_id_t target_group, std::vector<GroupExpression *> *added_joins);
+
   /**
    * Retrieve the lowest cost execution plan with the given properties
    *
@@ -101,9 +163,21 @@ class Optimizer : public AbstractOptimizer {
    */
   void ExecuteTaskStack(OptimizerTaskStack *task_stack, group_id_t root_group_id, OptimizationContext *root_context);
 
+  /**
+   * Execute the tasks of the given concurrent task pool on num_threads_ threads, with the same time limit as
+   * ExecuteTaskStack, except that it applies to the wall-clock time of the whole execution
+   *
+   * @param task_pool Optimizer's concurrent Task Pool to execute through
+   * @param root_group_id Root Group ID to check whether there is a plan or not
+   * @param root_context OptimizerContext to use that maintains required properties
+   */
+  void ExecuteConcurrentTaskPool(ConcurrentOptimizerTaskPool *task_pool, group_id_t root_group_id,
+                                 OptimizationContext *root_context);
+
   std::unique_ptr<AbstractCostModel> cost_model_;
   std::unique_ptr<OptimizerContext> context_;
   const uint64_t task_execution_timeout_;
+  const uint32_t num_threads_;
 };
 
 }  // namespace optimizer
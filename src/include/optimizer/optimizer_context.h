@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "common/settings.h"
+#include "common/spin_latch.h"
 #include "optimizer/cost_model/abstract_cost_model.h"
 #include "optimizer/group_expression.h"
 #include "optimizer/memo.h"
@@ -79,7 +80,10 @@ class OptimizerContext {
    * Adds a OptimizationContext to the tracking list
    * @param ctx OptimizationContext to add to tracking
    */
-  void AddOptimizationContext(OptimizationContext *ctx) { track_list_.push_back(ctx); }
+  void AddOptimizationContext(OptimizationContext *ctx) {
+    common::SpinLatch::ScopedSpinLatch guard(&track_list_latch_);
+    track_list_.push_back(ctx);
+  }
 
   /**
    * Pushes a task to the task pool managed
@@ -87,6 +91,26 @@ class OptimizerContext {
    */
   void PushTask(OptimizerTask *task) { task_pool_->Push(task); }
 
+  /**
+   * Pushes a task to the task pool managed, which waits for the tasks pushed after it
+   * @param task Task to push
+   * @see OptimizerTaskPool::PushDependent
+   */
+  void PushDependentTask(OptimizerTask *task) { task_pool_->PushDependent(task); }
+
+  /**
+   * Pushes a task to the task pool managed, which waits for ResumeTask()
+   * @param task Task to push
+   * @see OptimizerTaskPool::PushSuspended
+   */
+  void PushSuspendedTask(OptimizerTask *task) { task_pool_->PushSuspended(task); }
+
+  /**
+   * Makes a task pushed with PushSuspendedTask() runnable
+   * @param task Task to resume
+   */
+  void ResumeTask(OptimizerTask *task) { task_pool_->Resume(task); }
+
   /**
    * Gets the cost model
    * @returns Cost Model
@@ -223,6 +247,7 @@ class OptimizerContext {
   StatsStorage *stats_storage_;
   transaction::TransactionContext *txn_;
   std::vector<OptimizationContext *> track_list_;
+  common::SpinLatch track_list_latch_;
 };
 
 }  // namespace optimizer
@@ -99,6 +99,7 @@ enum class OpType {
   LEFTHASHJOIN,
   RIGHTHASHJOIN,
   OUTERHASHJOIN,
+  INNERMERGEJOIN,
   INSERT,
   INSERTSELECT,
   DELETE,
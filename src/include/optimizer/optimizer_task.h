@@ -89,6 +89,24 @@ class OptimizerTask {
    */
   void PushTask(OptimizerTask *task);
 
+  /**
+   * Convenience to push a task onto same task pool, which waits for the tasks pushed after it
+   * @param task Task to push
+   */
+  void PushDependentTask(OptimizerTask *task);
+
+  /**
+   * Convenience to push a task onto same task pool, which waits for ResumeTask()
+   * @param task Task to push
+   */
+  void PushSuspendedTask(OptimizerTask *task);
+
+  /**
+   * Convenience to make a task pushed with PushSuspendedTask() runnable
+   * @param task Task to resume
+   */
+  void ResumeTask(OptimizerTask *task);
+
   /**
    * Trivial destructor
    */
@@ -122,6 +140,13 @@ class OptimizeGroup : public OptimizerTask {
   OptimizeGroup(Group *group, OptimizationContext *context)
       : OptimizerTask(context, OptimizerTaskType::OPTIMIZE_GROUP), group_(group) {}
 
+  /**
+   * Constructor for the OptimizeGroup that ends the optimization, once all tasks the given one pushed have run
+   * @param task OptimizeGroup task that started the optimization
+   */
+  explicit OptimizeGroup(OptimizeGroup *task)
+      : OptimizerTask(task->context_, OptimizerTaskType::OPTIMIZE_GROUP), group_(task->group_), finish_(true) {}
+
   /**
    * Function to execute the task
    */
@@ -132,6 +157,11 @@ class OptimizeGroup : public OptimizerTask {
    * Group to optimize
    */
   Group *group_;
+
+  /**
+   * Whether the task ends the optimization and resumes the tasks waiting for it
+   */
+  bool finish_ = false;
 };
 
 /**
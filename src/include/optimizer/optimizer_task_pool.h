@@ -1,7 +1,16 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <stack>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "common/constants.h"
+#include "common/spin_latch.h"
 #include "optimizer/optimizer_task.h"
 
 namespace terrier::optimizer {
@@ -23,6 +32,27 @@ class OptimizerTaskPool {
    */
   virtual void Push(OptimizerTask *task) = 0;
 
+  /**
+   * Adds a task that may only run once all tasks pushed after it by the same task, up to the next task pushed with
+   * this function, have run, together with all the tasks those push in turn. The stack runs tasks in that order anyway.
+   * @param task OptimizerTask to add
+   */
+  virtual void PushDependent(OptimizerTask *task) { Push(task); }
+
+  /**
+   * Adds a task that only becomes runnable once Resume() is called for it, which lets a task wait for work some
+   * unrelated task is doing. The pushing task waits for it like for any other task it pushes. The stack never has to
+   * wait, since it runs the tasks a task pushes before any other, and runs the task right away.
+   * @param task OptimizerTask to add
+   */
+  virtual void PushSuspended(OptimizerTask *task) { Push(task); }
+
+  /**
+   * Makes a task added with PushSuspended() runnable. May be called before the task that pushed it has finished.
+   * @param task OptimizerTask to resume
+   */
+  virtual void Resume(OptimizerTask *task) {}
+
   /**
    * Virtual interface function to check whether the pool is empty
    */
@@ -83,4 +113,143 @@ class OptimizerTaskStack : public OptimizerTaskPool {
   std::stack<OptimizerTask *> task_stack_;
 };
 
+/**
+ * Work-stealing implementation of the OptimizerTaskPool, which lets several threads execute tasks at once.
+ *
+ * Tasks pushed by a running task are held back until Finish() is called for it, and then become runnable unless they
+ * were pushed with PushDependent(), in which case they wait for the tasks pushed after them, or with PushSuspended(), in
+ * which case they wait for Resume(). A task only finishes once all tasks it pushed have. Tasks that do not depend on
+ * each other run in any order, possibly concurrently.
+ *
+ * Every thread pops from the back of its own queue, so that it goes depth-first like the stack does, and steals from
+ * the front of other threads' queues, where the largest pieces of remaining work are, when its own queue runs dry.
+ */
+class ConcurrentOptimizerTaskPool : public OptimizerTaskPool {
+ public:
+  /**
+   * Constructs an empty pool
+   * @param num_threads number of threads that will pop tasks from the pool
+   */
+  explicit ConcurrentOptimizerTaskPool(uint32_t num_threads);
+
+  /**
+   * Destructor for ConcurrentOptimizerTaskPool, which deletes all tasks that have not run
+   */
+  ~ConcurrentOptimizerTaskPool() override { Clear(); }
+
+  DISALLOW_COPY_AND_MOVE(ConcurrentOptimizerTaskPool)
+
+  /**
+   * Takes a runnable task, which the calling thread has to execute and then hand back through Finish()
+   * @returns Next OptimizerTask to execute, or nullptr if no task is runnable at the moment
+   */
+  OptimizerTask *Pop() override;
+
+  /**
+   * Reports that the calling thread is done executing the task it popped last. Schedules the tasks it pushed, and
+   * deletes it.
+   * @param task OptimizerTask returned by the last call to Pop() on this thread
+   */
+  void Finish(OptimizerTask *task);
+
+  /**
+   * Implementation of the Push interface of OptimizerTaskPool
+   * @param task OptimizerTask to add to the task pool
+   */
+  void Push(OptimizerTask *task) override { Push(task, PushKind::INDEPENDENT); }
+
+  /**
+   * Implementation of the PushDependent interface of OptimizerTaskPool
+   * @param task OptimizerTask to add to the task pool
+   */
+  void PushDependent(OptimizerTask *task) override { Push(task, PushKind::DEPENDENT); }
+
+  /**
+   * Implementation of the PushSuspended interface of OptimizerTaskPool
+   * @param task OptimizerTask to add to the task pool
+   */
+  void PushSuspended(OptimizerTask *task) override { Push(task, PushKind::SUSPENDED); }
+
+  /**
+   * Implementation of the Resume interface of OptimizerTaskPool
+   * @param task OptimizerTask to resume
+   */
+  void Resume(OptimizerTask *task) override;
+
+  /**
+   * Checks whether any task has not finished yet. Tasks pushed from outside of a task are scheduled by this call.
+   * @returns TRUE if all tasks have finished
+   */
+  bool Empty() override;
+
+  /**
+   * Deletes all tasks that have not run. Must not be called while any thread is executing a task from the pool.
+   */
+  void Clear();
+
+ private:
+  // How a task waits for the others
+  enum class PushKind : uint8_t { INDEPENDENT, DEPENDENT, SUSPENDED };
+
+  // A task, and the counter of what it waits for
+  struct Node {
+    Node(OptimizerTask *task, Node *parent) : task_(task), parent_(parent), num_pending_(0) {}
+    OptimizerTask *task_;
+    // Node that waits for this one to finish, either to run (if dependent) or to finish itself
+    Node *parent_;
+    // Before the task runs, the number of tasks it waits for, plus one while it is suspended. After, the number of its
+    // pushed tasks that have not finished, plus one while it is being scheduled.
+    std::atomic<uint32_t> num_pending_;
+    bool executed_ = false;
+  };
+
+  // Per-thread deque of runnable tasks
+  struct alignas(common::Constants::CACHELINE_SIZE) TaskQueue {
+    common::SpinLatch latch_;
+    std::deque<Node *> nodes_;
+  };
+
+  // State of the calling thread
+  struct WorkerState {
+    uint64_t pool_id_ = 0;
+    uint32_t queue_idx_ = 0;
+    Node *current_ = nullptr;
+    std::vector<std::pair<OptimizerTask *, PushKind>> pushes_;
+  };
+
+  static WorkerState &LocalState();
+
+  // Returns the state of the calling thread, assigning it a queue when it first uses this pool
+  WorkerState &Worker();
+
+  void Push(OptimizerTask *task, PushKind kind);
+
+  // Makes the given tasks, pushed in order, wait for each other as described in the class comment, makes the parent
+  // wait for them, and enqueues the ones that are runnable right away
+  void Schedule(Node *parent, const std::vector<std::pair<OptimizerTask *, PushKind>> &pushes, uint32_t queue_idx);
+
+  // Counts down one pending task of the given node, and propagates finished nodes up
+  void Release(Node *node, uint32_t queue_idx);
+
+  void Enqueue(Node *node, uint32_t queue_idx);
+
+  // Deletes a task that has not run as if it had finished, together with every task that was only waiting for it
+  void Unwind(Node *node);
+
+  const uint64_t id_;
+  std::vector<TaskQueue> queues_;
+  std::atomic<uint32_t> num_workers_{0};
+
+  // Parent of all tasks pushed from outside of a task, and the pushes not yet scheduled
+  Node root_{nullptr, nullptr};
+  common::SpinLatch root_latch_;
+  std::atomic<bool> has_root_pushes_{false};
+  std::vector<std::pair<OptimizerTask *, PushKind>> root_pushes_;
+
+  // Scheduled tasks that wait for Resume(), and tasks resumed before they were scheduled
+  common::SpinLatch suspended_latch_;
+  std::unordered_map<OptimizerTask *, Node *> suspended_;
+  std::unordered_set<OptimizerTask *> resumed_;
+};
+
 }  // namespace terrier::optimizer
@@ -671,10 +671,14 @@ class InnerHashJoin : public OperatorNodeContents<InnerHashJoin> {
 class LeftHashJoin : public OperatorNodeContents<LeftHashJoin> {
  public:
   /**
-   * @param join_predicate predicate for join
+   * @param join_predicates predicates for join
+   * @param left_keys left keys to join
+   * @param right_keys right keys to join
    * @return a LeftHashJoin operator
    */
-  static Operator Make(common::ManagedPointer<parser::AbstractExpression> join_predicate);
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys);
 
   /**
    * Copy
@@ -687,15 +691,35 @@ class LeftHashJoin : public OperatorNodeContents<LeftHashJoin> {
   common::hash_t Hash() const override;
 
   /**
-   * @return Predicate for the join
+   * @return Left join keys
    */
-  const common::ManagedPointer<parser::AbstractExpression> &GetJoinPredicate() const { return join_predicate_; }
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftKeys() const { return left_keys_; }
+
+  /**
+   * @return Right join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightKeys() const { return right_keys_; }
+
+  /**
+   * @return Predicates for the Join
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
 
  private:
+  /**
+   * Left join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys_;
+
+  /**
+   * Right join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys_;
+
   /**
    * Predicate for join
    */
-  common::ManagedPointer<parser::AbstractExpression> join_predicate_;
+  std::vector<AnnotatedExpression> join_predicates_;
 };
 
 /**
@@ -704,10 +728,14 @@ class LeftHashJoin : public OperatorNodeContents<LeftHashJoin> {
 class RightHashJoin : public OperatorNodeContents<RightHashJoin> {
  public:
   /**
-   * @param join_predicate predicate for join
+   * @param join_predicates predicates for join
+   * @param left_keys left keys to join
+   * @param right_keys right keys to join
    * @return a RightHashJoin operator
    */
-  static Operator Make(common::ManagedPointer<parser::AbstractExpression> join_predicate);
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys);
 
   /**
    * Copy
@@ -720,15 +748,35 @@ class RightHashJoin : public OperatorNodeContents<RightHashJoin> {
   common::hash_t Hash() const override;
 
   /**
-   * @return Predicate for the join
+   * @return Left join keys
    */
-  const common::ManagedPointer<parser::AbstractExpression> &GetJoinPredicate() const { return join_predicate_; }
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftKeys() const { return left_keys_; }
+
+  /**
+   * @return Right join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightKeys() const { return right_keys_; }
+
+  /**
+   * @return Predicates for the Join
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
 
  private:
+  /**
+   * Left join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys_;
+
+  /**
+   * Right join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys_;
+
   /**
    * Predicate for join
    */
-  common::ManagedPointer<parser::AbstractExpression> join_predicate_;
+  std::vector<AnnotatedExpression> join_predicates_;
 };
 
 /**
@@ -737,10 +785,14 @@ class RightHashJoin : public OperatorNodeContents<RightHashJoin> {
 class OuterHashJoin : public OperatorNodeContents<OuterHashJoin> {
  public:
   /**
-   * @param join_predicate predicate for join
-   * @return a OuterHashJoin operator
+   * @param join_predicates predicates for join
+   * @param left_keys left keys to join
+   * @param right_keys right keys to join
+   * @return an OuterHashJoin operator
    */
-  static Operator Make(common::ManagedPointer<parser::AbstractExpression> join_predicate);
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys);
 
   /**
    * Copy
@@ -753,15 +805,92 @@ class OuterHashJoin : public OperatorNodeContents<OuterHashJoin> {
   common::hash_t Hash() const override;
 
   /**
-   * @return Predicate for the join
+   * @return Left join keys
    */
-  const common::ManagedPointer<parser::AbstractExpression> &GetJoinPredicate() const { return join_predicate_; }
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftKeys() const { return left_keys_; }
+
+  /**
+   * @return Right join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightKeys() const { return right_keys_; }
+
+  /**
+   * @return Predicates for the Join
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
 
  private:
+  /**
+   * Left join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys_;
+
+  /**
+   * Right join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys_;
+
   /**
    * Predicate for join
    */
-  common::ManagedPointer<parser::AbstractExpression> join_predicate_;
+  std::vector<AnnotatedExpression> join_predicates_;
+};
+
+/**
+ * Physical operator for inner sort-merge join. Both children are required to be sorted by their join keys.
+ */
+class InnerMergeJoin : public OperatorNodeContents<InnerMergeJoin> {
+ public:
+  /**
+   * @param join_predicates predicates for join
+   * @param left_keys left keys to join, which the left child is sorted by
+   * @param right_keys right keys to join, which the right child is sorted by
+   * @return an InnerMergeJoin operator
+   */
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys);
+
+  /**
+   * Copy
+   * @returns copy of this
+   */
+  BaseOperatorNodeContents *Copy() const override;
+
+  bool operator==(const BaseOperatorNodeContents &r) override;
+
+  common::hash_t Hash() const override;
+
+  /**
+   * @return Left join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftKeys() const { return left_keys_; }
+
+  /**
+   * @return Right join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightKeys() const { return right_keys_; }
+
+  /**
+   * @return Predicates for the Join
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
+
+ private:
+  /**
+   * Left join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys_;
+
+  /**
+   * Right join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys_;
+
+  /**
+   * Predicate for join
+   */
+  std::vector<AnnotatedExpression> join_predicates_;
 };
 
 /**
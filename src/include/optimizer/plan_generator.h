@@ -55,6 +55,7 @@ class PlanGenerator : public OperatorVisitor {
    * @param output_cols Columns output by the Operator
    * @param children_plans Children plan nodes
    * @param children_expr_map Vector of children expression -> col offset mapping
+   * @param children_num_rows Estimated number of rows output by each child (-1 if unknown)
    * @returns Output plan node
    */
   std::unique_ptr<planner::AbstractPlanNode> ConvertOpNode(
@@ -62,7 +63,7 @@ class PlanGenerator : public OperatorVisitor {
       PropertySet *required_props, const std::vector<common::ManagedPointer<parser::AbstractExpression>> &required_cols,
       const std::vector<common::ManagedPointer<parser::AbstractExpression>> &output_cols,
       std::vector<std::unique_ptr<planner::AbstractPlanNode>> &&children_plans,
-      std::vector<ExprMap> &&children_expr_map);
+      std::vector<ExprMap> &&children_expr_map, std::vector<int> children_num_rows = {});
 
   /**
    * Visitor function for a TableFreeScan operator
@@ -154,6 +155,12 @@ class PlanGenerator : public OperatorVisitor {
    */
   void Visit(const OuterHashJoin *op) override;
 
+  /**
+   * Visitor function for a InnerMergeJoin operator
+   * @param op InnerMergeJoin operator being visited
+   */
+  void Visit(const InnerMergeJoin *op) override;
+
   /**
    * Visitor function for a Insert operator
    * @param op Insert operator being visited
@@ -286,6 +293,11 @@ class PlanGenerator : public OperatorVisitor {
   void Visit(const Analyze *analyze) override;
 
  private:
+  /**
+   * Hash joins whose build side is estimated to have at least this many rows radix-partition their inputs
+   */
+  static constexpr int K_PARTITIONED_BUILD_MIN_ROWS = 1 << 20;
+
   /**
    * Register a pointer to be deleted on transaction commit/abort
    * @param ptr Pointer to delete
@@ -340,6 +352,18 @@ class PlanGenerator : public OperatorVisitor {
    */
   void CorrectOutputPlanWithProjection();
 
+  /**
+   * Constructs a HashJoin Plan
+   * @param join_predicates predicates of the join
+   * @param left_keys hash keys of the left (build) child
+   * @param right_keys hash keys of the right (probe) child
+   * @param join_type type of the join
+   */
+  void BuildHashJoinPlan(const std::vector<AnnotatedExpression> &join_predicates,
+                         const std::vector<common::ManagedPointer<parser::AbstractExpression>> &left_keys,
+                         const std::vector<common::ManagedPointer<parser::AbstractExpression>> &right_keys,
+                         planner::LogicalJoinType join_type);
+
   /**
    * Constructs an Aggregate Plan
    * @param aggr_type AggregateType
@@ -378,6 +402,11 @@ class PlanGenerator : public OperatorVisitor {
    */
   std::vector<ExprMap> children_expr_map_;
 
+  /**
+   * Estimated number of rows output by each child (-1 if unknown)
+   */
+  std::vector<int> children_num_rows_;
+
   /**
    * Final output plan
    */
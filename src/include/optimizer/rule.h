@@ -32,9 +32,14 @@ enum class RuleType : uint32_t {
   INSERT_TO_PHYSICAL,
   INSERT_SELECT_TO_PHYSICAL,
   AGGREGATE_TO_HASH_AGGREGATE,
+  AGGREGATE_TO_SORT_AGGREGATE,
   AGGREGATE_TO_PLAIN_AGGREGATE,
   INNER_JOIN_TO_NL_JOIN,
   INNER_JOIN_TO_HASH_JOIN,
+  INNER_JOIN_TO_MERGE_JOIN,
+  LEFT_JOIN_TO_HASH_JOIN,
+  RIGHT_JOIN_TO_HASH_JOIN,
+  OUTER_JOIN_TO_HASH_JOIN,
   IMPLEMENT_DISTINCT,
   IMPLEMENT_LIMIT,
   EXPORT_EXTERNAL_FILE_TO_PHYSICAL,
@@ -288,6 +288,34 @@ class LogicalGroupByToPhysicalHashGroupBy : public Rule {
                  OptimizationContext *context) const override;
 };
 
+/**
+ * Rule transforms LogicalGroupBy -> SortGroupBy
+ */
+class LogicalGroupByToPhysicalSortGroupBy : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  LogicalGroupByToPhysicalSortGroupBy();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
 /**
  * Rule transforms LogicalAggregate -> Aggregate
  */
@@ -372,6 +400,118 @@ class LogicalInnerJoinToPhysicalInnerHashJoin : public Rule {
                  OptimizationContext *context) const override;
 };
 
+/**
+ * Rule transforms Logical Inner Join to InnerMergeJoin
+ */
+class LogicalInnerJoinToPhysicalInnerMergeJoin : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  LogicalInnerJoinToPhysicalInnerMergeJoin();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
+/**
+ * Rule transforms Logical Left Join to LeftHashJoin
+ */
+class LogicalLeftJoinToPhysicalLeftHashJoin : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  LogicalLeftJoinToPhysicalLeftHashJoin();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
+/**
+ * Rule transforms Logical Right Join to RightHashJoin
+ */
+class LogicalRightJoinToPhysicalRightHashJoin : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  LogicalRightJoinToPhysicalRightHashJoin();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
+/**
+ * Rule transforms Logical Outer Join to OuterHashJoin
+ */
+class LogicalOuterJoinToPhysicalOuterHashJoin : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  LogicalOuterJoinToPhysicalOuterHashJoin();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
 /**
  * Rule transforms LogicalLimit -> Limit
  */
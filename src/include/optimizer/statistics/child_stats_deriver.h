@@ -76,6 +76,12 @@ class ChildStatsDeriver : public OperatorVisitor {
    */
   void PassDownRequiredCols();
 
+  /**
+   * Function to pass down all required_cols_ and the columns the join predicates refer to
+   * @param join_predicates predicates of the join
+   */
+  void PassDownJoinCols(const std::vector<AnnotatedExpression> &join_predicates);
+
   /**
    * Function for passing down a single column
    * @param col Column to passdown
@@ -45,6 +45,24 @@ class StatsCalculator : public OperatorVisitor {
    */
   void Visit(const LogicalInnerJoin *op) override;
 
+  /**
+   * Visit a LogicalLeftJoin
+   * @param op Operator being visited
+   */
+  void Visit(const LogicalLeftJoin *op) override;
+
+  /**
+   * Visit a LogicalRightJoin
+   * @param op Operator being visited
+   */
+  void Visit(const LogicalRightJoin *op) override;
+
+  /**
+   * Visit a LogicalOuterJoin
+   * @param op Operator being visited
+   */
+  void Visit(const LogicalOuterJoin *op) override;
+
   /**
    * Visit a LogicalAggregateAndGroupBy
    * @param op Operator being visited
@@ -58,6 +76,15 @@ class StatsCalculator : public OperatorVisitor {
   void Visit(const LogicalLimit *op) override;
 
  private:
+  /**
+   * Estimates the output of a join, and copies the stats of the required columns from its children
+   * @param join_predicates predicates of the join
+   * @param preserve_left whether every row of the left child is output, as by left and full outer joins
+   * @param preserve_right whether every row of the right child is output, as by right and full outer joins
+   */
+  void CalculateJoinStats(const std::vector<AnnotatedExpression> &join_predicates, bool preserve_left,
+                          bool preserve_right);
+
   /**
    * Add the base table stats if the base table maintain stats, or else
    * use default stats
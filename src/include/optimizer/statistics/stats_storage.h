@@ -9,6 +9,7 @@
 #include "common/hash_util.h"
 #include "common/macros.h"
 #include "common/managed_pointer.h"
+#include "common/shared_latch.h"
 
 #include "optimizer/statistics/column_stats.h"
 #include "optimizer/statistics/table_stats.h"
@@ -60,7 +61,7 @@ namespace terrier::optimizer {
 /**
  * Manages all the existing table stats objects. Stores them in an
  * unordered map and keeps track of them using their database and table oids. Can
- * add, update, or delete table stats objects from the storage map.
+ * add, update, or delete table stats objects from the storage map. Several threads may use it at once.
  */
 class StatsStorage {
  public:
@@ -97,6 +98,7 @@ class StatsStorage {
 
  private:
   friend class DefaultCostModelTests;  // needs to allow tests to add table stats to stats storage obj
+  friend class OptimizerJoinTest;      // adds the stats of the tables it joins
 
   /**
    * The following tests check to make sure the protected insert/delete functions work.
@@ -110,5 +112,10 @@ class StatsStorage {
    * TableStats pointers. This represents the storage for TableStats objects.
    */
   std::unordered_map<StatsStorageKey, std::unique_ptr<TableStats>> table_stats_storage_;
+
+  /**
+   * Protects the storage map
+   */
+  common::SharedLatch latch_;
 };
 }  // namespace terrier::optimizer
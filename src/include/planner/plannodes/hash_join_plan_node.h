@@ -46,6 +46,15 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
       return *this;
     }
 
+    /**
+     * @param partitioned_build whether to radix-partition both inputs and join a partition at a time
+     * @return builder object
+     */
+    Builder &SetPartitionedBuild(bool partitioned_build) {
+      partitioned_build_ = partitioned_build;
+      return *this;
+    }
+
     // TODO(WAN) do we want to invalidate the builder after build?
     /**
      * Build the hash join plan node
@@ -54,7 +63,7 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
     std::unique_ptr<HashJoinPlanNode> Build() {
       return std::unique_ptr<HashJoinPlanNode>(
           new HashJoinPlanNode(std::move(children_), std::move(output_schema_), join_type_, join_predicate_,
-                               std::move(left_hash_keys_), std::move(right_hash_keys_)));
+                               std::move(left_hash_keys_), std::move(right_hash_keys_), partitioned_build_));
     }
 
    protected:
@@ -66,6 +75,10 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
      * right side hash keys
      */
     std::vector<common::ManagedPointer<parser::AbstractExpression>> right_hash_keys_;
+    /**
+     * whether to radix-partition both inputs
+     */
+    bool partitioned_build_ = false;
   };
 
  private:
@@ -76,15 +89,18 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
    * @param predicate join predicate
    * @param left_hash_keys left side keys to be hashed on
    * @param right_hash_keys right side keys to be hashed on
+   * @param partitioned_build whether to radix-partition both inputs
    */
   HashJoinPlanNode(std::vector<std::unique_ptr<AbstractPlanNode>> &&children,
                    std::unique_ptr<OutputSchema> output_schema, LogicalJoinType join_type,
                    common::ManagedPointer<parser::AbstractExpression> predicate,
                    std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_hash_keys,
-                   std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_hash_keys)
+                   std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_hash_keys,
+                   bool partitioned_build)
       : AbstractJoinPlanNode(std::move(children), std::move(output_schema), join_type, predicate),
         left_hash_keys_(std::move(left_hash_keys)),
-        right_hash_keys_(std::move(right_hash_keys)) {}
+        right_hash_keys_(std::move(right_hash_keys)),
+        partitioned_build_(partitioned_build) {}
 
  public:
   /**
@@ -113,6 +129,11 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
     return right_hash_keys_;
   }
 
+  /**
+   * @return true if both inputs are radix-partitioned and joined a partition at a time
+   */
+  bool IsPartitionedBuild() const { return partitioned_build_; }
+
   /**
    * @return the hashed value of this plan node
    */
@@ -129,6 +150,9 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
   // The left and right expressions that constitute the join keys
   std::vector<common::ManagedPointer<parser::AbstractExpression>> left_hash_keys_;
   std::vector<common::ManagedPointer<parser::AbstractExpression>> right_hash_keys_;
+
+  // Whether both inputs are radix-partitioned, which pays off for build sides much larger than the cache
+  bool partitioned_build_ = false;
 };
 
 DEFINE_JSON_DECLARATIONS(HashJoinPlanNode);
@@ -69,6 +69,15 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
       return *this;
     }
 
+    /**
+     * @param index_only whether the index covers every column the scan reads, so tuples need not be fetched
+     * @return builder object
+     */
+    Builder &SetIndexOnly(bool index_only) {
+      index_only_ = index_only;
+      return *this;
+    }
+
     /**
      * Sets the index cols.
      */
@@ -110,7 +119,7 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
       return std::unique_ptr<IndexScanPlanNode>(new IndexScanPlanNode(
           std::move(children_), std::move(output_schema_), scan_predicate_, std::move(column_oids_), is_for_update_,
           database_oid_, namespace_oid_, index_oid_, table_oid_, scan_type_, std::move(lo_index_cols_),
-          std::move(hi_index_cols_), scan_limit_));
+          std::move(hi_index_cols_), scan_limit_, index_only_));
     }
 
    private:
@@ -121,6 +130,7 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
     std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> lo_index_cols_{};
     std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> hi_index_cols_{};
     uint32_t scan_limit_{0};
+    bool index_only_{false};
   };
 
  private:
@@ -137,6 +147,7 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
    * @param lo_index_cols lower bound of the scan (or exact key when scan type = Exact).
    * @param hi_index_cols upper bound of the scan
    * @param scan_limit limit of the scan if any
+   * @param index_only whether the scan reads only key columns
    */
   IndexScanPlanNode(std::vector<std::unique_ptr<AbstractPlanNode>> &&children,
                     std::unique_ptr<OutputSchema> output_schema,
@@ -146,7 +157,7 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
                     catalog::table_oid_t table_oid, IndexScanType scan_type,
                     std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> &&lo_index_cols,
                     std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> &&hi_index_cols,
-                    uint32_t scan_limit)
+                    uint32_t scan_limit, bool index_only)
       : AbstractScanPlanNode(std::move(children), std::move(output_schema), predicate, is_for_update, database_oid,
                              namespace_oid),
         scan_type_(scan_type),
@@ -155,7 +166,8 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
         column_oids_(column_oids),
         lo_index_cols_(std::move(lo_index_cols)),
         hi_index_cols_(std::move(hi_index_cols)),
-        scan_limit_(scan_limit) {}
+        scan_limit_(scan_limit),
+        index_only_(index_only) {}
 
  public:
   /**
@@ -211,6 +223,11 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
    */
   uint32_t ScanLimit() const { return scan_limit_; }
 
+  /**
+   * @return true if every column the scan reads is an index key column, so values come straight from the index keys
+   */
+  bool IsIndexOnly() const { return index_only_; }
+
   /**
    * @return the type of this plan node
    */
@@ -235,6 +252,7 @@ class IndexScanPlanNode : public AbstractScanPlanNode {
   std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> lo_index_cols_{};
   std::unordered_map<catalog::indexkeycol_oid_t, IndexExpression> hi_index_cols_{};
   uint32_t scan_limit_;
+  bool index_only_;
 };
 
 DEFINE_JSON_DECLARATIONS(IndexScanPlanNode)
@@ -29,6 +29,7 @@ enum class PlanNodeType {
   NESTLOOP,
   HASHJOIN,
   INDEXNLJOIN,
+  MERGEJOIN,
 
   // Mutator Nodes
   UPDATE,
@@ -88,7 +89,8 @@ enum class LogicalJoinType {
   INNER = 3,                  // inner
   OUTER = 4,                  // outer
   SEMI = 5,                   // IN+Subquery is SEMI
-  LEFT_SEMI = 6               // LEFT SEMI join
+  LEFT_SEMI = 6,              // LEFT SEMI join
+  ANTI = 7                    // LEFT ANTI join (NOT EXISTS)
 };
 
 //===--------------------------------------------------------------------===//
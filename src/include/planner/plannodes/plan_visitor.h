@@ -25,6 +25,7 @@ class IndexJoinPlanNode;
 class IndexScanPlanNode;
 class InsertPlanNode;
 class LimitPlanNode;
+class MergeJoinPlanNode;
 class NestedLoopJoinPlanNode;
 class OrderByPlanNode;
 class ProjectionPlanNode;
@@ -178,6 +179,12 @@ class PlanVisitor {
    */
   virtual void Visit(UNUSED_ATTRIBUTE const LimitPlanNode *plan) {}
 
+  /**
+   * Visit an MergeJoinPlanNode
+   * @param plan MergeJoinPlanNode
+   */
+  virtual void Visit(UNUSED_ATTRIBUTE const MergeJoinPlanNode *plan) {}
+
   /**
    * Visit an NestedLoopJoinPlanNode
    * @param plan NestedLoopJoinPlanNode
@@ -55,6 +55,37 @@ SETTING_int(
     terrier::settings::Callbacks::BlockStoreReuseLimit
 )
 
+// BlockStore huge pages
+SETTING_int(
+    block_store_huge_page_size,
+    "Size in MB of the huge pages to map storage blocks from: 0 (regular pages), 2 or 1024 (default: 0)",
+    0,
+    0,
+    1024,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
+// BlockStore NUMA placement
+SETTING_bool(
+    block_store_numa_aware,
+    "Whether to place storage blocks on the NUMA node of the thread inserting into them (default: false)",
+    false,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
+// BlockStore pre-faulted reserve
+SETTING_int(
+    block_store_prefault,
+    "The number of storage blocks to map and fault in at startup, if blocks are mapped (default: 0)",
+    0,
+    0,
+    1000000,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
 // Garbage collector thread interval
 SETTING_int(
     gc_interval,
@@ -66,6 +97,39 @@ SETTING_int(
     terrier::settings::Callbacks::NoOp
 )
 
+// Number of GC invocations without a write after which a full block is considered cold
+SETTING_int(
+    cold_data_epoch_threshold,
+    "Number of garbage collector invocations without a write after which a block is compacted (default: 10)",
+    10,
+    1,
+    1000000,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
+// Block compactor thread interval
+SETTING_int(
+    compaction_interval,
+    "Block compactor thread interval (ms) (default: 100)",
+    100,
+    1,
+    10000,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
+// Maximum number of blocks the block compactor thread processes per interval
+SETTING_int(
+    compaction_batch_size,
+    "The maximum number of blocks the block compactor thread processes per interval (default: 100)",
+    100,
+    1,
+    1000000,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
 // Path to log file for WAL
 SETTING_string(
     log_file_path,
@@ -114,6 +178,10 @@ SETTING_int(task_execution_timeout,
             "assuming one plan has been found (default 5000)",
             5000, 1000, 60000, false, terrier::settings::Callbacks::NoOp)
 
+SETTING_int(optimizer_num_threads,
+            "Number of threads the optimizer searches the plan space of a query with (default 1)",
+            1, 1, 64, false, terrier::settings::Callbacks::NoOp)
+
 // Parallel Execution
 SETTING_bool(
     parallel_execution,
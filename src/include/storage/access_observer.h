@@ -32,8 +32,10 @@ class AccessObserver {
   /**
    * Constructs a new AccessObserver that will send its observations to the given block compactor
    * @param compactor the compactor to use after identifying a cold block
+   * @param cold_epoch_threshold number of GC invocations without a write after which a block is considered cold
    */
-  explicit AccessObserver(BlockCompactor *compactor) : compactor_(compactor) {}
+  explicit AccessObserver(BlockCompactor *compactor, const uint64_t cold_epoch_threshold = COLD_DATA_EPOCH_THRESHOLD)
+      : cold_epoch_threshold_(cold_epoch_threshold), compactor_(compactor) {}
 
   /**
    * Signals to the AccessObserver that a new GC run has begun. This is useful as a measurement of time to the
@@ -50,6 +52,7 @@ class AccessObserver {
   void ObserveWrite(RawBlock *block);
 
  private:
+  const uint64_t cold_epoch_threshold_;
   uint64_t gc_epoch_ = 0;  // estimate time using the number of times GC has run
   // Here RawBlock * should suffice as a unique identifier of the block. Although a block can be
   // reused, that process should only be triggered through compaction, which happens only if the
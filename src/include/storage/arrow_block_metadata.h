@@ -1,4 +1,7 @@
 #pragma once
+#include <atomic>
+#include <cstring>
+#include <limits>
 #include <map>
 #include <unordered_set>
 #include <utility>
@@ -11,9 +14,18 @@ namespace terrier::storage {
 // TODO(Tianyu): In this future, there can be situations where varlen fields should not be gathered
 // compressed (e.g, blob). Can add a flag here to handle that.
 /**
- * Type of Arrow column
+ * Type of Arrow column. Fixed-length columns can additionally carry one of the lightweight encodings chosen by the
+ * BlockCompactor. Such an encoding is a scan accelerator rather than compression: it is kept next to the plain values
+ * of the block, which stay in place, and thus adds to the memory of the block.
  */
-enum class ArrowColumnType : uint8_t { FIXED_LENGTH = 0, GATHERED_VARLEN, DICTIONARY_COMPRESSED };
+enum class ArrowColumnType : uint8_t {
+  FIXED_LENGTH = 0,
+  GATHERED_VARLEN,
+  DICTIONARY_COMPRESSED,
+  RUN_LENGTH_ENCODED,
+  FRAME_OF_REFERENCE,
+  DELTA_ENCODED
+};
 
 /**
  * Stores information about an Arrow varlen column. This class implements an Arrow list, with
@@ -115,13 +127,239 @@ class ArrowVarlenColumn {
   uint64_t *offsets_ = nullptr;
 };
 
+/**
+ * Stores a lightweight encoding of a fixed-length integer column. Values are read as signed integers of the attribute
+ * size, and null values are encoded as the value before them (or the first value, if there is none), so that every
+ * slot decodes to a value in [Min(), Max()]. Depending on the type of the owning ArrowColumnInfo:
+ *
+ * - RUN_LENGTH_ENCODED: run i holds RunValues()[i] for all slots in [RunEnds()[i - 1], RunEnds()[i]).
+ * - FRAME_OF_REFERENCE: slot i holds Min() plus the i-th BitWidth()-bit integer of Packed().
+ * - DELTA_ENCODED: slot i holds the value of slot i - 1 plus Reference() plus the i-th BitWidth()-bit integer of
+ *   Packed(). The value of every K_DELTA_ANCHOR_INTERVAL-th slot is kept in RunValues(), so that decoding can start
+ *   anywhere without summing up all deltas from the beginning of the block.
+ *
+ * Packed integers are laid out back to back starting from the least significant bit of the first word. The packed
+ * array always ends in a padding word, so that readers may load a full word at the position of any packed integer.
+ *
+ * The encoding only speeds up scans of frozen blocks and never replaces the plain values, which Select, MVCC thawing
+ * and the Arrow export read directly. Its memory is thus bounded instead: an encoding is only kept if Size() is at
+ * most 1 / K_MAX_SIZE_DIVISOR of the plain values it stands for.
+ */
+class ArrowEncodedColumn {
+ public:
+  /**
+   * Number of slots between the anchor values of a delta encoded column
+   */
+  static constexpr uint32_t K_DELTA_ANCHOR_INTERVAL = 128;
+
+  /**
+   * An encoding may take up at most this fraction of the size of the plain values of its column
+   */
+  static constexpr uint32_t K_MAX_SIZE_DIVISOR = 4;
+
+  /**
+   * Constructs an empty ArrowEncodedColumn
+   */
+  ArrowEncodedColumn() = default;
+
+  DISALLOW_COPY(ArrowEncodedColumn)
+
+  /**
+   * Move constructor
+   * @param other object to move from
+   */
+  ArrowEncodedColumn(ArrowEncodedColumn &&other) noexcept
+      : min_(other.min_),
+        max_(other.max_),
+        reference_(other.reference_),
+        num_runs_(other.num_runs_),
+        num_words_(other.num_words_),
+        bit_width_(other.bit_width_),
+        run_values_(other.run_values_),
+        run_ends_(other.run_ends_),
+        packed_(other.packed_) {
+    other.run_values_ = nullptr;
+    other.run_ends_ = nullptr;
+    other.packed_ = nullptr;
+  }
+
+  /**
+   * Move-assignment operator
+   * @param other object to move from
+   * @return self-reference
+   */
+  ArrowEncodedColumn &operator=(ArrowEncodedColumn &&other) noexcept {
+    if (this != &other) {
+      Deallocate();
+      min_ = other.min_;
+      max_ = other.max_;
+      reference_ = other.reference_;
+      num_runs_ = other.num_runs_;
+      num_words_ = other.num_words_;
+      bit_width_ = other.bit_width_;
+      run_values_ = other.run_values_;
+      other.run_values_ = nullptr;
+      run_ends_ = other.run_ends_;
+      other.run_ends_ = nullptr;
+      packed_ = other.packed_;
+      other.packed_ = nullptr;
+    }
+    return *this;
+  }
+
+  /**
+   * Destructs an ArrowEncodedColumn
+   */
+  ~ArrowEncodedColumn() { Deallocate(); }
+
+  /**
+   * @return reference to the smallest value in the column
+   */
+  int64_t &Min() { return min_; }
+
+  /**
+   * @return smallest value in the column
+   */
+  int64_t Min() const { return min_; }
+
+  /**
+   * @return reference to the largest value in the column
+   */
+  int64_t &Max() { return max_; }
+
+  /**
+   * @return largest value in the column
+   */
+  int64_t Max() const { return max_; }
+
+  /**
+   * @return reference to the value added to every packed delta of a delta encoded column
+   */
+  int64_t &Reference() { return reference_; }
+
+  /**
+   * @return value added to every packed delta of a delta encoded column
+   */
+  int64_t Reference() const { return reference_; }
+
+  /**
+   * @return number of runs of a run-length encoded column, or of anchors of a delta encoded column
+   */
+  uint32_t NumRuns() const { return num_runs_; }
+
+  /**
+   * @return number of bits of every packed integer
+   */
+  uint8_t BitWidth() const { return bit_width_; }
+
+  /**
+   * @return values of the runs of a run-length encoded column, or the anchors of a delta encoded column
+   */
+  int64_t *RunValues() const { return run_values_; }
+
+  /**
+   * @return end offsets (exclusive) of the runs of a run-length encoded column
+   */
+  uint32_t *RunEnds() const { return run_ends_; }
+
+  /**
+   * @return the packed integers of a frame-of-reference or delta encoded column
+   */
+  uint64_t *Packed() const { return packed_; }
+
+  /**
+   * @return number of bytes allocated for the encoding, on top of the plain values of the column
+   */
+  uint64_t Size() const {
+    const uint64_t run_size = run_ends_ == nullptr ? sizeof(int64_t) : sizeof(int64_t) + sizeof(uint32_t);
+    return num_runs_ * run_size + static_cast<uint64_t>(num_words_) * sizeof(uint64_t);
+  }
+
+  /**
+   * Allocates the arrays of runs (or anchors), which are uninitialized
+   * @param num_runs number of runs
+   * @param with_ends whether to allocate the end offsets of the runs as well
+   */
+  void AllocateRuns(const uint32_t num_runs, const bool with_ends) {
+    TERRIER_ASSERT(run_values_ == nullptr && run_ends_ == nullptr, "runs are already allocated");
+    num_runs_ = num_runs;
+    run_values_ = common::AllocationUtil::AllocateAligned<int64_t>(num_runs);
+    if (with_ends) run_ends_ = common::AllocationUtil::AllocateAligned<uint32_t>(num_runs);
+  }
+
+  /**
+   * Allocates the zeroed array of packed integers
+   * @param num_values number of integers to pack
+   * @param bit_width number of bits of every packed integer, at most 64
+   */
+  void AllocatePacked(const uint32_t num_values, const uint8_t bit_width) {
+    TERRIER_ASSERT(packed_ == nullptr, "packed integers are already allocated");
+    TERRIER_ASSERT(bit_width <= 64, "packed integers cannot be wider than a word");
+    bit_width_ = bit_width;
+    // One more word for padding
+    num_words_ = static_cast<uint32_t>((static_cast<uint64_t>(num_values) * bit_width + 63) / 64 + 1);
+    packed_ = common::AllocationUtil::AllocateAligned<uint64_t>(num_words_);
+    std::memset(packed_, 0, num_words_ * sizeof(uint64_t));
+  }
+
+  /**
+   * Packs an integer into the given position. The integer must fit into BitWidth() bits and its position must still
+   * be zero.
+   * @param pos position of the integer
+   * @param value the integer
+   */
+  void Pack(const uint32_t pos, const uint64_t value) {
+    if (bit_width_ == 0) return;
+    const uint64_t bit = static_cast<uint64_t>(pos) * bit_width_;
+    const uint64_t word = bit / 64, shift = bit % 64;
+    packed_[word] |= value << shift;
+    if (shift + bit_width_ > 64) packed_[word + 1] |= value >> (64 - shift);
+  }
+
+  /**
+   * @param pos position of the integer
+   * @return the packed integer at the given position
+   */
+  uint64_t Unpack(const uint32_t pos) const {
+    if (bit_width_ == 0) return 0;
+    const uint64_t bit = static_cast<uint64_t>(pos) * bit_width_;
+    const uint64_t word = bit / 64, shift = bit % 64;
+    uint64_t value = packed_[word] >> shift;
+    if (shift + bit_width_ > 64) value |= packed_[word + 1] << (64 - shift);
+    return bit_width_ == 64 ? value : value & ((uint64_t(1) << bit_width_) - 1);
+  }
+
+  /**
+   * Deallocates all associated buffers in the ArrowEncodedColumn
+   */
+  void Deallocate() {
+    delete[] run_values_;
+    run_values_ = nullptr;
+    delete[] run_ends_;
+    run_ends_ = nullptr;
+    delete[] packed_;
+    packed_ = nullptr;
+    num_runs_ = 0;
+    num_words_ = 0;
+  }
+
+ private:
+  int64_t min_ = 0, max_ = 0, reference_ = 0;
+  uint32_t num_runs_ = 0, num_words_ = 0;
+  uint8_t bit_width_ = 0;
+  int64_t *run_values_ = nullptr;
+  uint32_t *run_ends_ = nullptr;
+  uint64_t *packed_ = nullptr;
+};
+
 /**
  * An ArrowColumnInfo object contains everything needed to reason about Arrow storage of a column in the block.
  *
  * All columns has a type associated with it. Gathered varlen columns has an ArrowVarlenColumn. If the column
  * is dictionary-compressed, it has an ArrowVarlenColumn that is the dictionary, and an indices array that encodes
  * the values. Notice here that the meaning of the ArrowVarlenColumn is different for dictionary-encoded columns
- * and simple gathered columns.
+ * and simple gathered columns. Fixed-length columns that are lightweight encoded have an ArrowEncodedColumn to speed up
+ * scans, while their plain values stay in the block.
  */
 class ArrowColumnInfo {
  public:
@@ -135,7 +373,10 @@ class ArrowColumnInfo {
    * @param other the object to move from
    */
   ArrowColumnInfo(ArrowColumnInfo &&other) noexcept
-      : type_(other.type_), varlen_column_(std::move(other.varlen_column_)), indices_(other.indices_) {
+      : type_(other.type_),
+        varlen_column_(std::move(other.varlen_column_)),
+        indices_(other.indices_),
+        encoded_column_(std::move(other.encoded_column_)) {
     other.indices_ = nullptr;
   }
 
@@ -156,6 +397,7 @@ class ArrowColumnInfo {
       delete[] indices_;
       indices_ = other.indices_;
       other.indices_ = nullptr;
+      encoded_column_ = std::move(other.encoded_column_);
     }
     return *this;
   }
@@ -164,6 +406,10 @@ class ArrowColumnInfo {
    * @return type of the Arrow Column
    */
   ArrowColumnType &Type() { return type_; }
+  /**
+   * @return type of the Arrow Column
+   */
+  ArrowColumnType Type() const { return type_; }
   /**
    * @return ArrowVarlenColumn object for the column
    */
@@ -181,21 +427,117 @@ class ArrowColumnInfo {
   }
 
   /**
-   * Deallocates all associated buffers in the ArrowVarlenColumn
+   * @return whether the column is a fixed-length column with a lightweight encoding
+   */
+  bool IsEncoded() const {
+    return type_ == ArrowColumnType::RUN_LENGTH_ENCODED || type_ == ArrowColumnType::FRAME_OF_REFERENCE ||
+           type_ == ArrowColumnType::DELTA_ENCODED;
+  }
+
+  /**
+   * @return ArrowEncodedColumn object for the column. This is only meaningful if the column is lightweight encoded.
+   */
+  ArrowEncodedColumn &EncodedColumn() { return encoded_column_; }
+
+  /**
+   * @return ArrowEncodedColumn object for the column. This is only meaningful if the column is lightweight encoded.
+   */
+  const ArrowEncodedColumn &EncodedColumn() const { return encoded_column_; }
+
+  /**
+   * Deallocates all associated buffers in the ArrowColumnInfo
    */
   void Deallocate() {
     delete[] indices_;
+    indices_ = nullptr;
     varlen_column_.Deallocate();
+    encoded_column_.Deallocate();
   }
 
  private:
   /**
    * type of this Arrow column
    */
-  ArrowColumnType type_;
+  ArrowColumnType type_ = ArrowColumnType::FIXED_LENGTH;
   ArrowVarlenColumn varlen_column_;  // For varlen and dictionary
   // TODO(Tianyu): Add null bitmap
   uint64_t *indices_ = nullptr;  // for dictionary
+  ArrowEncodedColumn encoded_column_;  // for lightweight encoded fixed-length columns
+};
+
+/**
+ * Per-block summary of the values of a fixed-length column, used to skip whole blocks during scans. Values are kept
+ * sign-extended to 64 bits, whatever the attribute size. While the block is hot, writers only ever widen the range
+ * before they write a value, so it covers every value a transaction could see in the block (and possibly some that are
+ * long gone). The BlockCompactor narrows it down to the exact range of the live values when the block is frozen; the
+ * matching null count is the one of the ArrowBlockMetadata. An empty range means the column holds no non-null value.
+ * Zone maps are not maintained for varlen columns.
+ */
+class ColumnZoneMap {
+ public:
+  MEM_REINTERPRETATION_ONLY(ColumnZoneMap)
+
+  /**
+   * Empties the range
+   */
+  void Reset() { Set(std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()); }
+
+  /**
+   * Sets the range. Only safe to call when no writer can touch the block.
+   * @param min smallest value in the column
+   * @param max largest value in the column
+   */
+  void Set(const int64_t min, const int64_t max) {
+    min_.store(min);
+    max_.store(max);
+  }
+
+  /**
+   * Extends the range to cover the given value.
+   * @param value value about to be written into the column
+   */
+  void Widen(const int64_t value) {
+    int64_t current = min_.load();
+    while (value < current && !min_.compare_exchange_weak(current, value)) {
+    }
+    current = max_.load();
+    while (value > current && !max_.compare_exchange_weak(current, value)) {
+    }
+  }
+
+  /**
+   * @return smallest value the column may hold
+   */
+  int64_t Min() const { return min_.load(); }
+
+  /**
+   * @return largest value the column may hold
+   */
+  int64_t Max() const { return max_.load(); }
+
+  /**
+   * @return true if the column holds no non-null value
+   */
+  bool IsEmpty() const { return Min() > Max(); }
+
+  /**
+   * Checks whether some value of the column may fall in the given inclusive range. Columns of unsigned values are
+   * only known to be in the same order as their sign-extended values when none of them has its top bit set.
+   * @param lo lower bound of the range
+   * @param hi upper bound of the range
+   * @param is_unsigned whether the column stores unsigned values
+   * @return false if no value of the column can be in the range
+   */
+  bool MayContain(const int64_t lo, const int64_t hi, const bool is_unsigned) const {
+    const int64_t min = Min(), max = Max();
+    if (min > max) return false;
+    if (is_unsigned && min < 0) return true;
+    return lo <= max && min <= hi;
+  }
+
+ private:
+  std::atomic<int64_t> min_;
+  std::atomic<int64_t> max_;
 };
 
 /**
@@ -217,16 +559,18 @@ class ArrowBlockMetadata {
    */
   static uint32_t Size(uint16_t num_cols) {
     return StorageUtil::PadUpToSize(sizeof(uint64_t), static_cast<uint32_t>(sizeof(uint32_t)) * (num_cols + 1)) +
-           num_cols * static_cast<uint32_t>(sizeof(ArrowColumnInfo));
+           num_cols * static_cast<uint32_t>(sizeof(ArrowColumnInfo) + sizeof(ColumnZoneMap));
   }
 
   /**
-   * Zeroes out the memory chunk for block metadata
+   * Zeroes out the memory chunk for block metadata and empties the zone maps
    * @param num_cols number of columsn stored in the block
    */
   void Initialize(uint16_t num_cols) {
     // Need to 0 out this block to make sure all the counts are 0 and all the pointers are nullptrs
     memset(this, 0, Size(num_cols));
+    ColumnZoneMap *zone_maps = ZoneMaps(num_cols);
+    for (uint16_t i = 0; i < num_cols; i++) zone_maps[i].Reset();
   }
 
   /**
@@ -274,9 +618,34 @@ class ArrowBlockMetadata {
     return reinterpret_cast<ArrowColumnInfo *>(null_count_end)[!col_id];
   }
 
+  /**
+   * @param layout layout object of the Block
+   * @param col_id the column of interest
+   * @return zone map of the given column
+   */
+  ColumnZoneMap &GetZoneMap(const BlockLayout &layout, col_id_t col_id) {
+    return ZoneMaps(layout.NumColumns())[!col_id];
+  }
+
+  /**
+   * @param layout layout object of the Block
+   * @param col_id the column of interest
+   * @return zone map of the given column
+   */
+  const ColumnZoneMap &GetZoneMap(const BlockLayout &layout, col_id_t col_id) const {
+    return const_cast<ArrowBlockMetadata *>(this)->ZoneMaps(layout.NumColumns())[!col_id];
+  }
+
  private:
+  ColumnZoneMap *ZoneMaps(uint16_t num_cols) {
+    byte *null_count_end =
+        storage::StorageUtil::AlignedPtr(sizeof(uint64_t), varlen_content_ + sizeof(uint32_t) * num_cols);
+    return reinterpret_cast<ColumnZoneMap *>(null_count_end + num_cols * sizeof(ArrowColumnInfo));
+  }
+
   uint32_t num_records_;  // number of actual records
   // null_count[num_cols] (32-bit) | padding up to 8 byte-aligned | arrow_varlen_buffers[num_cols] |
+  // zone_maps[num_cols]
   byte varlen_content_[];
 };
 }  // namespace terrier::storage
@@ -1,8 +1,10 @@
 #pragma once
+#include <limits>
 #include <queue>
 #include <unordered_map>
 #include <utility>
 #include <vector>
+#include "common/spin_latch.h"
 #include "storage/arrow_block_metadata.h"
 #include "storage/data_table.h"
 #include "storage/storage_defs.h"
@@ -49,21 +51,39 @@ class BlockCompactor {
   };
 
  public:
+  /**
+   * Constructs a new BlockCompactor
+   * @param move_tuples whether gaps in a block may be filled by moving tuples around. Moves do not maintain indexes or
+   *                    write to the log yet (see MoveTuple), so compactors running against live tables with indexes
+   *                    should only freeze blocks whose tuples are already contiguous.
+   */
+  explicit BlockCompactor(const bool move_tuples = true) : move_tuples_(move_tuples) {}
+
   FAKED_IN_TEST ~BlockCompactor() = default;
 
   /**
    * Processes the compaction queue and mark processed blocks as cold if successful. The compaction can fail due
    * to live versions or contention. There will be a brief window where user transactions writing to the block
    * can be aborted, but no readers would be blocked.
+   * @param deferred_action_manager used to defer freeing the varlens of frozen blocks and requeueing blocks
+   * @param txn_manager used to run the compaction transactions
+   * @param max_blocks maximum number of blocks to take off the queue in this invocation. Any blocks left over stay in
+   *                   the queue for the next invocation.
+   * @return number of blocks that were frozen in this invocation
    */
-  void ProcessCompactionQueue(transaction::DeferredActionManager *deferred_action_manager,
-                              transaction::TransactionManager *txn_manager);
+  uint32_t ProcessCompactionQueue(transaction::DeferredActionManager *deferred_action_manager,
+                                  transaction::TransactionManager *txn_manager,
+                                  uint64_t max_blocks = std::numeric_limits<uint64_t>::max());
 
   /**
-   * Adds a block associated with a data table to the compaction to be processed in the future.
+   * Adds a block associated with a data table to the compaction to be processed in the future. This can be called
+   * concurrently with ProcessCompactionQueue.
    * @param block the block that needs to be processed by the compactor
    */
-  FAKED_IN_TEST void PutInQueue(RawBlock *block) { compaction_queue_.push(block); }
+  FAKED_IN_TEST void PutInQueue(RawBlock *block) {
+    common::SpinLatch::ScopedSpinLatch guard(&queue_latch_);
+    compaction_queue_.push(block);
+  }
 
  private:
   bool EliminateGaps(CompactionGroup *cg);
@@ -73,13 +93,25 @@ class BlockCompactor {
   // Move a tuple and updated associated information in their respective blocks
   bool MoveTuple(CompactionGroup *cg, TupleSlot from, TupleSlot to);
 
-  void GatherVarlens(std::vector<const byte *> *loose_ptrs, RawBlock *block, DataTable *table);
+  // The Gather functions return the number of bytes of out-of-line varlens added to loose_varlens. GatherVarlens also
+  // picks the encoding of every fixed-length column.
+  uint64_t GatherVarlens(std::vector<VarlenEntry> *loose_varlens, RawBlock *block, DataTable *table);
+
+  // Pick the cheaper of the two varlen layouts for a column whose type was never set
+  ArrowColumnType ChooseVarlenType(const ArrowBlockMetadata &metadata, common::RawConcurrentBitmap *column_bitmap,
+                                   const VarlenEntry *values);
+
+  // Encode a fixed-length integer column with whichever lightweight encoding is smallest, if any is small enough to be
+  // worth keeping next to the plain values
+  template <typename T>
+  void EncodeFixedLength(ArrowBlockMetadata *metadata, col_id_t col_id, common::RawConcurrentBitmap *column_bitmap,
+                         ArrowColumnInfo *col, const T *values);
 
-  void CopyToArrowVarlen(std::vector<const byte *> *loose_ptrs, ArrowBlockMetadata *metadata, col_id_t col_id,
-                         common::RawConcurrentBitmap *column_bitmap, ArrowColumnInfo *col, VarlenEntry *values);
+  uint64_t CopyToArrowVarlen(std::vector<VarlenEntry> *loose_varlens, ArrowBlockMetadata *metadata, col_id_t col_id,
+                             common::RawConcurrentBitmap *column_bitmap, ArrowColumnInfo *col, VarlenEntry *values);
 
-  void BuildDictionary(std::vector<const byte *> *loose_ptrs, ArrowBlockMetadata *metadata, col_id_t col_id,
-                       common::RawConcurrentBitmap *column_bitmap, ArrowColumnInfo *col, VarlenEntry *values);
+  uint64_t BuildDictionary(std::vector<VarlenEntry> *loose_varlens, ArrowBlockMetadata *metadata, col_id_t col_id,
+                           common::RawConcurrentBitmap *column_bitmap, ArrowColumnInfo *col, VarlenEntry *values);
 
   void ComputeFilled(const BlockLayout &layout, std::vector<uint32_t> *filled, const std::vector<uint32_t> &empty) {
     // Reconstruct the list of filled slots
@@ -94,6 +126,9 @@ class BlockCompactor {
     }
   }
 
+  const bool move_tuples_;
+  // Blocks are enqueued from the GC thread and processed on the compaction thread
+  common::SpinLatch queue_latch_;
   std::queue<RawBlock *> compaction_queue_;
 };
 }  // namespace terrier::storage
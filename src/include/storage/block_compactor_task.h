@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>              // NOLINT
+#include <condition_variable>  // NOLINT
+#include <mutex>               // NOLINT
+
+#include "common/dedicated_thread_task.h"
+#include "storage/block_compactor.h"
+#include "transaction/deferred_action_manager.h"
+#include "transaction/transaction_manager.h"
+
+namespace terrier::storage {
+
+/**
+ * A BlockCompactorTask periodically processes the compaction queue of a BlockCompactor, so that blocks the
+ * AccessObserver has found to be cold are compacted and frozen in the background.
+ */
+class BlockCompactorTask : public common::DedicatedThreadTask {
+ public:
+  /**
+   * Constructs a new BlockCompactorTask
+   * @param compactor the compactor whose queue to process
+   * @param deferred_action_manager argument to ProcessCompactionQueue
+   * @param txn_manager argument to ProcessCompactionQueue
+   * @param compaction_interval sleep time between passes over the compaction queue
+   * @param compaction_batch_size maximum number of blocks to process in one pass
+   */
+  BlockCompactorTask(BlockCompactor *compactor, transaction::DeferredActionManager *deferred_action_manager,
+                     transaction::TransactionManager *txn_manager, const std::chrono::milliseconds compaction_interval,
+                     const uint64_t compaction_batch_size)
+      : run_task_(false),
+        compactor_(compactor),
+        deferred_action_manager_(deferred_action_manager),
+        txn_manager_(txn_manager),
+        compaction_interval_(compaction_interval),
+        compaction_batch_size_(compaction_batch_size) {}
+
+  /**
+   * Runs the compaction loop. Called by thread registry upon initialization of thread
+   */
+  void RunTask() override;
+
+  /**
+   * Signals task to stop. Called by thread registry upon termination of thread
+   */
+  void Terminate() override;
+
+ private:
+  // Flag to signal task to run or stop
+  volatile bool run_task_;
+  // Wakes up the task early when it is terminated
+  std::mutex run_lock_;
+  std::condition_variable run_cv_;
+
+  BlockCompactor *const compactor_;
+  transaction::DeferredActionManager *const deferred_action_manager_;
+  transaction::TransactionManager *const txn_manager_;
+  const std::chrono::milliseconds compaction_interval_;
+  const uint64_t compaction_batch_size_;
+};
+
+}  // namespace terrier::storage
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>  // NOLINT
+
+#include "common/dedicated_thread_owner.h"
+#include "common/dedicated_thread_registry.h"
+#include "storage/block_compactor_task.h"
+
+namespace terrier::storage {
+
+/**
+ * Owns the dedicated thread that drives a BlockCompactor. Together with an AccessObserver attached to the garbage
+ * collector, this moves blocks that have gone cold through compaction into the frozen state without user involvement.
+ * The thread is registered with the DedicatedThreadRegistry on construction and stopped on destruction.
+ */
+class BlockCompactorThread : public common::DedicatedThreadOwner {
+ public:
+  /**
+   * @param thread_registry registry to run the compaction thread on
+   * @param compactor the compactor whose queue to process
+   * @param deferred_action_manager argument to ProcessCompactionQueue
+   * @param txn_manager argument to ProcessCompactionQueue
+   * @param compaction_interval sleep time between passes over the compaction queue
+   * @param compaction_batch_size maximum number of blocks to process in one pass
+   */
+  BlockCompactorThread(const common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry,
+                       const common::ManagedPointer<BlockCompactor> compactor,
+                       const common::ManagedPointer<transaction::DeferredActionManager> deferred_action_manager,
+                       const common::ManagedPointer<transaction::TransactionManager> txn_manager,
+                       const std::chrono::milliseconds compaction_interval, const uint64_t compaction_batch_size)
+      : DedicatedThreadOwner(thread_registry),
+        compactor_task_(thread_registry_->RegisterDedicatedThread<BlockCompactorTask>(
+            this /* requester */, compactor.Get(), deferred_action_manager.Get(), txn_manager.Get(),
+            compaction_interval, compaction_batch_size)) {}
+
+  ~BlockCompactorThread() override {
+    auto result UNUSED_ATTRIBUTE =
+        thread_registry_->StopTask(this, compactor_task_.CastManagedPointerTo<common::DedicatedThreadTask>());
+    TERRIER_ASSERT(result, "BlockCompactorTask should have been stopped");
+  }
+
+ private:
+  const common::ManagedPointer<BlockCompactorTask> compactor_task_;
+};
+
+}  // namespace terrier::storage
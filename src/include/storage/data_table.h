@@ -6,6 +6,7 @@
 #include "common/managed_pointer.h"
 #include "common/performance_counter.h"
 #include "storage/arrow_serializer.h"
+#include "storage/frozen_columns_view.h"
 #include "storage/projected_columns.h"
 #include "storage/storage_defs.h"
 #include "storage/tuple_access_strategy.h"
@@ -26,6 +27,8 @@ template <typename KeyType>
 class BwTreeIndex;
 template <typename KeyType>
 class HashIndex;
+template <typename KeyType>
+class ArtIndex;
 }  // namespace index
 
 // clang-format off
@@ -157,6 +160,58 @@ class DataTable {
   void Scan(common::ManagedPointer<transaction::TransactionContext> txn, SlotIterator *start_pos,
             ProjectedColumns *out_buffer) const;
 
+  /**
+   * Zero-copy alternative to Scan for tuples in FROZEN blocks. If the given iterator points into a frozen block, points
+   * the view at as many of the following tuples of that block as would fit into the given buffer, without copying
+   * them. Frozen blocks hold no versions, so these tuples are visible to every transaction. The block stays frozen
+   * until the view is released, and the iterator is mutated to point to one slot past the last slot in the view.
+   *
+   * The view may come back empty if there are no tuples left in the block, in which case the iterator still moves on to
+   * the next block. Nothing happens if the tuples are not frozen, and the caller has to Scan them instead.
+   *
+   * @param start_pos iterator to the starting location for the sequential scan
+   * @param projection buffer whose projection list and capacity the view follows. Its contents are not touched.
+   * @param[out] view view to point at the tuples. It must have been released.
+   * @return true if the view was pointed at the tuples, false if they have to be scanned
+   */
+  bool TryViewFrozen(SlotIterator *start_pos, const ProjectedColumns &projection, FrozenColumnsView *view) const;
+
+  /**
+   * Inclusive range of the values a scan is looking for in one of the columns of its projection, given in the
+   * sign-extended form of ColumnZoneMap.
+   */
+  struct ZoneRange {
+    /**
+     * index of the column in the projection list
+     */
+    uint16_t projection_list_index_;
+    /**
+     * lower bound of the range
+     */
+    int64_t lo_;
+    /**
+     * upper bound of the range
+     */
+    int64_t hi_;
+    /**
+     * whether the column stores unsigned values
+     */
+    bool is_unsigned_;
+  };
+
+  /**
+   * Uses the zone maps of the block the given iterator points into to skip the rest of that block, if they show that
+   * none of its values of some column falls in the range the scan is looking for. The iterator is then mutated to point
+   * to the start of the next block.
+   *
+   * @param start_pos iterator to the starting location for the sequential scan
+   * @param projection buffer whose projection list the ranges refer to. Its contents are not touched.
+   * @param ranges ranges every tuple of the scan has to fall in
+   * @return true if the rest of the block was skipped
+   */
+  bool TrySkipBlock(SlotIterator *start_pos, const ProjectedColumns &projection,
+                    const std::vector<ZoneRange> &ranges) const;
+
   /**
    * @return the first tuple slot contained in the data table
    */
@@ -174,6 +229,16 @@ class DataTable {
    */
   SlotIterator end() const;  // NOLINT for STL name compability
 
+  /**
+   * Takes a snapshot of the blocks in the data table, e.g. to split a scan across threads. Blocks allocated after the
+   * call only contain tuples that are not visible to any transaction that had already started before it.
+   * @return the blocks of this data table, in allocation order
+   */
+  std::vector<RawBlock *> GetBlocks() const {
+    common::SpinLatch::ScopedSpinLatch guard(&blocks_latch_);
+    return {blocks_.begin(), blocks_.end()};
+  }
+
   /**
    * Update the tuple according to the redo buffer given, and update the version chain to link to an
    * undo record that is allocated in the txn. The undo record is populated with a before-image of the tuple in the
@@ -233,6 +298,8 @@ class DataTable {
   friend class index::BwTreeIndex;
   template <typename KeyType>
   friend class index::HashIndex;
+  template <typename KeyType>
+  friend class index::ArtIndex;
   // The block compactor elides transactional protection in the gather/compression phase and
   // needs raw access to the underlying table.
   friend class BlockCompactor;
@@ -266,6 +333,17 @@ class DataTable {
   bool SelectIntoBuffer(common::ManagedPointer<transaction::TransactionContext> txn, TupleSlot slot,
                         RowType *out_buffer) const;
 
+  // Materializes the visible tuples among num_slots consecutive slots of a block, starting at offset, into out_buffer
+  // from row filled onwards. Runs of slots without versions are copied a column segment at a time, and only the other
+  // slots are selected tuple by tuple. Returns the number of rows in out_buffer afterwards.
+  uint32_t ScanBlock(common::ManagedPointer<transaction::TransactionContext> txn, RawBlock *block, uint32_t offset,
+                     uint32_t num_slots, ProjectedColumns *out_buffer, uint32_t filled) const;
+
+  // Copies num_slots consecutive slots of a block, starting at offset, into out_buffer from row out_offset onwards,
+  // without any visibility checks
+  void CopyColumnSegments(RawBlock *block, uint32_t offset, uint32_t num_slots, ProjectedColumns *out_buffer,
+                          uint32_t out_offset) const;
+
   void InsertInto(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &redo,
                   TupleSlot dest);
   // Atomically read out the version pointer value.
@@ -304,5 +382,17 @@ class DataTable {
    * @return true if tuple is visible to this txn, false otherwise
    */
   bool IsVisible(const transaction::TransactionContext &txn, TupleSlot slot) const;
+
+  /**
+   * Batched version of IsVisible. The version pointers of upcoming slots are prefetched while earlier slots are being
+   * checked, which hides most of the cache misses of probing tuples scattered across blocks.
+   * @param txn the calling transaction
+   * @param slots the slots to check
+   * @param num_slots number of slots to check
+   * @param[out] visible positions of the visible slots, in ascending order. Must have room for num_slots entries.
+   * @return number of visible slots
+   */
+  uint32_t FilterVisible(const transaction::TransactionContext &txn, const TupleSlot *slots, uint32_t num_slots,
+                         uint32_t *visible) const;
 };
 }  // namespace terrier::storage
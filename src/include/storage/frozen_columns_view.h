@@ -0,0 +1,131 @@
+#pragma once
+
+#include <vector>
+
+#include "common/container/bitmap.h"
+#include "common/macros.h"
+#include "storage/arrow_block_metadata.h"
+#include "storage/storage_defs.h"
+
+namespace terrier::storage {
+
+class DataTable;
+
+/**
+ * A zero-copy view over consecutive tuples of a FROZEN block, following the projection list of a ProjectedColumns.
+ * Frozen blocks hold no versions and are laid out the same way as ProjectedColumns, one array of values and one null
+ * bitmap per column, so readers can consume their columns directly instead of copying them out first. Dictionary
+ * compressed columns additionally expose their dictionary codes, and lightweight encoded integer columns their
+ * encoding, so that predicates can be evaluated on the encoded data.
+ *
+ * A view that is pointing at tuples holds an in-place read on their block, which keeps writers from thawing the block.
+ * It must be released as soon as the reader is done with the tuples, and the same thread must not attempt to write to
+ * the block before that, or it would wait on itself forever.
+ */
+class FrozenColumnsView {
+ public:
+  /**
+   * Creates a view that is not pointing at any tuples.
+   */
+  FrozenColumnsView() = default;
+
+  DISALLOW_COPY_AND_MOVE(FrozenColumnsView)
+
+  /**
+   * Releases the view if it is still pointing at tuples.
+   */
+  ~FrozenColumnsView() { Release(); }
+
+  /**
+   * Lets go of the block the view is pointing at, if any. The view cannot be read from afterwards.
+   */
+  void Release() {
+    if (block_ == nullptr) return;
+    block_->controller_.ReleaseInPlaceRead();
+    block_ = nullptr;
+    num_tuples_ = 0;
+  }
+
+  /**
+   * @return the block the view is pointing at, or nullptr if it is released
+   */
+  RawBlock *Block() const { return block_; }
+
+  /**
+   * @return offset in the block of the first tuple in the view
+   */
+  uint32_t Offset() const { return offset_; }
+
+  /**
+   * @return number of tuples in the view
+   */
+  uint32_t NumTuples() const { return num_tuples_; }
+
+  /**
+   * @return number of columns in the view
+   */
+  uint16_t NumColumns() const { return static_cast<uint16_t>(column_starts_.size()); }
+
+  /**
+   * @param projection_list_index index of the column in the projection list
+   * @return value of the column for the first tuple in the view, with the values of the other tuples following it
+   */
+  const byte *ColumnStart(const uint16_t projection_list_index) const {
+    TERRIER_ASSERT(projection_list_index < NumColumns(), "Column offset out of bounds.");
+    return column_starts_[projection_list_index];
+  }
+
+  /**
+   * @param projection_list_index index of the column in the projection list
+   * @return null bitmap of the column, with bit 0 standing for the first tuple in the view. As in ProjectedColumns, a
+   *         set bit means that the value is not null.
+   */
+  const common::RawBitmap *ColumnNullBitmap(const uint16_t projection_list_index) const {
+    TERRIER_ASSERT(projection_list_index < NumColumns(), "Column offset out of bounds.");
+    return column_null_bitmaps_[projection_list_index];
+  }
+
+  /**
+   * @param projection_list_index index of the column in the projection list
+   * @return dictionary code of the column for the first tuple in the view, with the codes of the other tuples following
+   *         it, or nullptr if the column is not dictionary compressed. Codes of null values are undefined.
+   */
+  const uint64_t *DictionaryCodes(const uint16_t projection_list_index) const {
+    TERRIER_ASSERT(projection_list_index < NumColumns(), "Column offset out of bounds.");
+    return dictionary_codes_[projection_list_index];
+  }
+
+  /**
+   * @param projection_list_index index of the column in the projection list
+   * @return the dictionary of the column, whose words are sorted so that codes compare the same way as the words they
+   *         encode, or nullptr if the column is not dictionary compressed
+   */
+  const ArrowVarlenColumn *Dictionary(const uint16_t projection_list_index) const {
+    TERRIER_ASSERT(projection_list_index < NumColumns(), "Column offset out of bounds.");
+    return dictionaries_[projection_list_index];
+  }
+
+  /**
+   * @param projection_list_index index of the column in the projection list
+   * @return column info of the column if it is a lightweight encoded fixed-length column, or nullptr otherwise. The
+   *         encoding covers the whole block, so slot Offset() of the encoding stands for the first tuple in the view.
+   */
+  const ArrowColumnInfo *EncodedColumn(const uint16_t projection_list_index) const {
+    TERRIER_ASSERT(projection_list_index < NumColumns(), "Column offset out of bounds.");
+    return encoded_columns_[projection_list_index];
+  }
+
+ private:
+  friend class DataTable;
+
+  RawBlock *block_ = nullptr;
+  uint32_t offset_ = 0;
+  uint32_t num_tuples_ = 0;
+  std::vector<const byte *> column_starts_;
+  std::vector<const common::RawBitmap *> column_null_bitmaps_;
+  std::vector<const uint64_t *> dictionary_codes_;
+  std::vector<const ArrowVarlenColumn *> dictionaries_;
+  std::vector<const ArrowColumnInfo *> encoded_columns_;
+};
+
+}  // namespace terrier::storage
@@ -1,12 +1,12 @@
 #pragma once
 
 #include <queue>
-#include <unordered_set>
 #include <utility>
 
-#include "common/shared_latch.h"
+#include "catalog/catalog_defs.h"
 #include "storage/access_observer.h"
 #include "storage/index/index.h"
+#include "storage/index_garbage_collector.h"
 #include "transaction/transaction_context.h"
 #include "transaction/transaction_defs.h"
 #include "transaction/transaction_manager.h"
@@ -58,21 +58,34 @@ class GarbageCollector {
    * the transaction if safe to do so. The only exception is read-only transactions, which can be deallocated in a
    * single GC pass.
    * @return A pair of numbers: the first is the number of transactions deallocated (deleted) on this iteration, while
-   * the second is the number of transactions unlinked on this iteration.
+   * the second is the number of transactions unlinked on this iteration. Indexes are not collected here, see
+   * GetIndexGarbageCollector().
    */
   std::pair<uint32_t, uint32_t> PerformGarbageCollection();
 
   /**
    * Register an index to be periodically garbage collected
    * @param index pointer to the index to register
+   * @param index_oid oid of the index in the catalog, only used to attribute metrics
    */
-  void RegisterIndexForGC(common::ManagedPointer<index::Index> index);
+  void RegisterIndexForGC(common::ManagedPointer<index::Index> index,
+                          catalog::index_oid_t index_oid = catalog::INVALID_INDEX_OID) {
+    index_gc_.RegisterIndex(index, index_oid);
+  }
 
   /**
    * Unregister an index to be periodically garbage collected
    * @param index pointer to the index to unregister
    */
-  void UnregisterIndexForGC(common::ManagedPointer<index::Index> index);
+  void UnregisterIndexForGC(common::ManagedPointer<index::Index> index) { index_gc_.UnregisterIndex(index); }
+
+  /**
+   * @return the collector for the indexes registered with this GC. It runs on its own schedule, e.g. on a separate
+   * thread of the GarbageCollectorThread, so that index reclamation does not delay version chain processing.
+   */
+  common::ManagedPointer<IndexGarbageCollector> GetIndexGarbageCollector() {
+    return common::ManagedPointer(&index_gc_);
+  }
 
  private:
   /**
@@ -98,8 +111,6 @@ class GarbageCollector {
 
   void TruncateVersionChain(DataTable *table, TupleSlot slot, transaction::timestamp_t oldest) const;
 
-  void ProcessIndexes();
-
   const common::ManagedPointer<transaction::TimestampManager> timestamp_manager_;
   const common::ManagedPointer<transaction::DeferredActionManager> deferred_action_manager_;
   const common::ManagedPointer<transaction::TransactionManager> txn_manager_;
@@ -111,8 +122,7 @@ class GarbageCollector {
   // queue of txns that need to be unlinked
   transaction::TransactionQueue txns_to_unlink_;
 
-  std::unordered_set<common::ManagedPointer<index::Index>> indexes_;
-  common::SharedLatch indexes_latch_;
+  IndexGarbageCollector index_gc_;
 };
 
 }  // namespace terrier::storage
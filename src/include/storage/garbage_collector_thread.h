@@ -14,7 +14,8 @@ namespace terrier::storage {
 
 /**
  * Class for spinning off a thread that runs garbage collection at a fixed interval. This should be used in most cases
- * to enable GC in the system unless you need fine-grained control over table state or profiling.
+ * to enable GC in the system unless you need fine-grained control over table state or profiling. Indexes are collected
+ * on a second thread at the same interval, so that a pass over many indexes never holds up version chain processing.
  */
 class GarbageCollectorThread {
  public:
@@ -29,25 +30,28 @@ class GarbageCollectorThread {
   ~GarbageCollectorThread() { StopGC(); }
 
   /**
-   * Kill the GC thread and run GC a few times to clean up the system.
+   * Kill the GC threads and run GC a few times to clean up the system.
    */
   void StopGC() {
     TERRIER_ASSERT(run_gc_, "GC should already be running.");
     run_gc_ = false;
     gc_thread_.join();
+    index_gc_thread_.join();
     for (uint8_t i = 0; i < transaction::MIN_GC_INVOCATIONS; i++) {
       gc_->PerformGarbageCollection();
+      gc_->GetIndexGarbageCollector()->PerformGarbageCollection();
     }
   }
 
   /**
-   * Spawn the GC thread if it has been previously stopped.
+   * Spawn the GC threads if they have been previously stopped.
    */
   void StartGC() {
     TERRIER_ASSERT(!run_gc_, "GC should not already be running.");
     run_gc_ = true;
     gc_paused_ = false;
     gc_thread_ = std::thread([this] { GCThreadLoop(); });
+    index_gc_thread_ = std::thread([this] { IndexGCThreadLoop(); });
   }
 
   /**
@@ -78,6 +82,7 @@ class GarbageCollectorThread {
   volatile bool gc_paused_;
   std::chrono::milliseconds gc_period_;
   std::thread gc_thread_;
+  std::thread index_gc_thread_;
 
   void GCThreadLoop() {
     while (run_gc_) {
@@ -85,6 +90,13 @@ class GarbageCollectorThread {
       if (!gc_paused_) gc_->PerformGarbageCollection();
     }
   }
+
+  void IndexGCThreadLoop() {
+    while (run_gc_) {
+      std::this_thread::sleep_for(gc_period_);
+      if (!gc_paused_) gc_->GetIndexGarbageCollector()->PerformGarbageCollection();
+    }
+  }
 };
 
 }  // namespace terrier::storage
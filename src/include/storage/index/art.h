@@ -0,0 +1,1003 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>  // NOLINT
+#include <thread>  // NOLINT
+#include <type_traits>
+#include <vector>
+
+#include "common/macros.h"
+#include "portable_endian/portable_endian.h"
+
+namespace terrier::storage::index {
+
+/**
+ * Concurrent adaptive radix tree (Leis et al., "The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases")
+ * synchronized with optimistic lock coupling (Leis et al., "The ART of Practical Synchronization"). Every inner node
+ * carries a version lock. Readers never write to shared memory: they validate the versions of the nodes they read and
+ * restart if a writer got in the way. Writers lock only the nodes they modify. Nodes that are replaced or removed are
+ * reclaimed through epochs once no reader can still hold a reference to them.
+ *
+ * The tree stores (key, value) entries as binary-comparable byte strings: the bytes of the key followed by the value in
+ * big-endian order. Keys must therefore order by memcmp over their bytes, which is the layout CompactIntsKey uses for
+ * its integers and GenericKey for its normalized attributes. Inner nodes store the prefix their subtree shares only
+ * once, which keeps long keys with common prefixes compact. Because the value is part of the entry, a key can map to
+ * many values and every entry is unique.
+ *
+ * @tparam KeyType fixed-size key that exposes its binary-comparable bytes through KeyData()
+ * @tparam ValueType 8-byte value
+ */
+template <typename KeyType, typename ValueType>
+class AdaptiveRadixTree {
+  static_assert(sizeof(ValueType) == sizeof(uint64_t), "Values are stored as the last 8 bytes of each entry.");
+  static_assert(std::is_trivially_copyable_v<KeyType> && std::is_trivially_copyable_v<ValueType>,
+                "Entries are copied in and out of the leaves byte by byte.");
+
+ public:
+  /**
+   * Length of an entry in bytes: the key followed by the value
+   */
+  static constexpr uint32_t K_ENTRY_LENGTH = sizeof(KeyType) + sizeof(ValueType);
+
+  /**
+   * Binary-comparable encoding of an entry, used to position scans
+   */
+  using EntryBytes = std::array<uint8_t, K_ENTRY_LENGTH>;
+
+  AdaptiveRadixTree() : root_(new Node256()) {}
+
+  ~AdaptiveRadixTree() { FreeChild(root_); }
+
+  DISALLOW_COPY_AND_MOVE(AdaptiveRadixTree)
+
+  /**
+   * @param key key of the entry
+   * @param value value of the entry
+   * @return encoding of the entry
+   */
+  static EntryBytes Encode(const KeyType &key, const ValueType value) {
+    uint64_t value_bits;
+    std::memcpy(&value_bits, &value, sizeof(ValueType));
+    return EncodeBits(key, value_bits);
+  }
+
+  /**
+   * @param key key to bound
+   * @param upper true for the bound past every entry of key, false for the bound before every entry of key
+   * @return encoding of the bound
+   */
+  static EntryBytes EncodeBound(const KeyType &key, const bool upper) {
+    return EncodeBits(key, upper ? ~uint64_t{0} : uint64_t{0});
+  }
+
+  /**
+   * Advances an encoding to the next possible entry.
+   * @param[in,out] entry encoding to advance
+   * @return false if entry was already the last possible entry
+   */
+  static bool Successor(EntryBytes *const entry) {
+    for (uint32_t i = K_ENTRY_LENGTH; i-- > 0;) {
+      if (++(*entry)[i] != 0) return true;
+    }
+    return false;
+  }
+
+  /**
+   * Moves an encoding back to the previous possible entry.
+   * @param[in,out] entry encoding to move back
+   * @return false if entry was already the first possible entry
+   */
+  static bool Predecessor(EntryBytes *const entry) {
+    for (uint32_t i = K_ENTRY_LENGTH; i-- > 0;) {
+      if ((*entry)[i]-- != 0) return true;
+    }
+    return false;
+  }
+
+  /**
+   * Inserts an entry.
+   * @param key key of the entry
+   * @param value value of the entry
+   * @return false if the entry already exists
+   */
+  bool Insert(const KeyType &key, const ValueType value) {
+    auto *const leaf = new Leaf{key, value};
+    const EntryBytes entry = Encode(key, value);
+    EpochGuard guard(&epoch_manager_);
+    OpResult result;
+    while ((result = TryInsert(entry, leaf)) == OpResult::RESTART) {
+    }
+    if (result == OpResult::SUCCESS) return true;
+    delete leaf;
+    return false;
+  }
+
+  /**
+   * Deletes an entry.
+   * @param key key of the entry
+   * @param value value of the entry
+   * @return false if the entry does not exist
+   */
+  bool Delete(const KeyType &key, const ValueType value) {
+    const EntryBytes entry = Encode(key, value);
+    EpochGuard guard(&epoch_manager_);
+    OpResult result;
+    while ((result = TryDelete(entry)) == OpResult::RESTART) {
+    }
+    return result == OpResult::SUCCESS;
+  }
+
+  /**
+   * Appends all the values of a key.
+   * @param key key to look up
+   * @param[out] values values of the key, in entry order
+   */
+  void GetValue(const KeyType &key, std::vector<ValueType> *const values) {
+    KeyVisitor visitor(key, values);
+    ScanAscending(EncodeBound(key, false), &visitor);
+  }
+
+  /**
+   * Visits entries in ascending order, starting at the first entry at or after start. The visitor must provide
+   * void Reset(), called before the scan starts over, and bool Visit(const KeyType &, ValueType), which returns false
+   * to end the scan. Keys passed to Visit are only valid for the duration of the call.
+   * @param start encoding to start at
+   * @param visitor visitor to call on each entry
+   */
+  template <typename Visitor>
+  void ScanAscending(const EntryBytes &start, Visitor *const visitor) {
+    Scan<true>(start, visitor);
+  }
+
+  /**
+   * Visits entries in descending order, starting at the last entry at or before start. See ScanAscending.
+   * @param start encoding to start at
+   * @param visitor visitor to call on each entry
+   */
+  template <typename Visitor>
+  void ScanDescending(const EntryBytes &start, Visitor *const visitor) {
+    Scan<false>(start, visitor);
+  }
+
+  /**
+   * Frees the nodes that no reader can reach anymore. Must be called periodically, and is a no-op while another thread
+   * is already collecting.
+   */
+  void PerformGarbageCollection() { epoch_manager_.TryAdvance(); }
+
+  /**
+   * @return number of nodes unlinked from the tree that are still waiting for readers to leave before being freed
+   */
+  uint64_t NumRetainedGarbageNodes() const { return epoch_manager_.NumRetained(); }
+
+ private:
+  enum class NodeType : uint8_t { NODE4, NODE16, NODE48, NODE256 };
+
+  enum class OpResult : uint8_t { SUCCESS, FAILURE, RESTART };
+
+  // Version lock layout: bit 0 marks a node that was unlinked from the tree, bit 1 marks a write-locked node, and the
+  // remaining bits count the writes to the node
+  static constexpr uint64_t K_OBSOLETE_BIT = 0b01;
+  static constexpr uint64_t K_LOCKED_BIT = 0b10;
+
+  struct Node {
+    explicit Node(const NodeType type) : type_(type) {}
+    std::atomic<uint64_t> version_{0};
+    const NodeType type_;
+    // Path compression: the bytes shared by every entry below this node, which the node consumes before branching
+    uint16_t prefix_len_ = 0;
+    uint16_t num_children_ = 0;
+    uint8_t prefix_[K_ENTRY_LENGTH];
+  };
+
+  struct Node4 : Node {
+    Node4() : Node(NodeType::NODE4) {}
+    // Sorted, so that children can be visited in order
+    uint8_t keys_[4];
+    std::atomic<Node *> children_[4]{};
+  };
+
+  struct Node16 : Node {
+    Node16() : Node(NodeType::NODE16) {}
+    // Sorted, so that children can be visited in order
+    uint8_t keys_[16];
+    std::atomic<Node *> children_[16]{};
+  };
+
+  static constexpr uint8_t K_NODE48_EMPTY = 48;
+
+  struct Node48 : Node {
+    Node48() : Node(NodeType::NODE48) { std::memset(child_index_, K_NODE48_EMPTY, sizeof(child_index_)); }
+    uint8_t child_index_[256];
+    std::atomic<Node *> children_[48]{};
+  };
+
+  struct Node256 : Node {
+    Node256() : Node(NodeType::NODE256) {}
+    std::atomic<Node *> children_[256]{};
+  };
+
+  // Entries live in leaves, which are stored in the child slots of inner nodes as tagged pointers. Leaves are never
+  // modified once published.
+  struct Leaf {
+    const KeyType key_;
+    const ValueType value_;
+  };
+
+  /**
+   * Epoch-based reclamation. Threads announce the epoch they operate in, and nodes unlinked from the tree are retired
+   * into the epoch current at the time. Garbage from an epoch is freed once the global epoch has moved past it and no
+   * thread is left in it. Only three epochs can be live at a time, so the counters and garbage lists form a ring.
+   */
+  class EpochManager {
+   public:
+    EpochManager() = default;
+
+    ~EpochManager() {
+      for (auto &garbage : garbage_) FreeGarbage(garbage.exchange(nullptr));
+    }
+
+    DISALLOW_COPY_AND_MOVE(EpochManager)
+
+    uint64_t Enter() {
+      while (true) {
+        const uint64_t epoch = epoch_.load();
+        num_active_[epoch % K_NUM_EPOCHS].fetch_add(1);
+        // The epoch might have moved on before we were counted, in which case it may already be reclaiming
+        if (epoch_.load() == epoch) return epoch;
+        num_active_[epoch % K_NUM_EPOCHS].fetch_sub(1);
+      }
+    }
+
+    void Exit(const uint64_t epoch) { num_active_[epoch % K_NUM_EPOCHS].fetch_sub(1); }
+
+    void Retire(Node *const child) {
+      auto *const garbage = new Garbage{child, nullptr};
+      num_retained_.fetch_add(1, std::memory_order_relaxed);
+      auto &head = garbage_[epoch_.load() % K_NUM_EPOCHS];
+      garbage->next_ = head.load();
+      while (!head.compare_exchange_weak(garbage->next_, garbage)) {
+      }
+    }
+
+    void TryAdvance() {
+      std::unique_lock<std::mutex> lock(advance_latch_, std::try_to_lock);
+      if (!lock.owns_lock()) return;
+      const uint64_t epoch = epoch_.load();
+      // Garbage retired in the previous epoch can only be reached by threads that entered no later than that epoch
+      const uint64_t previous = (epoch + K_NUM_EPOCHS - 1) % K_NUM_EPOCHS;
+      if (num_active_[previous].load() != 0) return;
+      num_retained_.fetch_sub(FreeGarbage(garbage_[previous].exchange(nullptr)), std::memory_order_relaxed);
+      epoch_.store(epoch + 1);
+    }
+
+    uint64_t NumRetained() const { return num_retained_.load(std::memory_order_relaxed); }
+
+   private:
+    static constexpr uint64_t K_NUM_EPOCHS = 3;
+
+    struct Garbage {
+      Node *const child_;
+      Garbage *next_;
+    };
+
+    static uint64_t FreeGarbage(Garbage *garbage) {
+      uint64_t num_freed = 0;
+      while (garbage != nullptr) {
+        Garbage *const next = garbage->next_;
+        FreeNode(garbage->child_);
+        delete garbage;
+        garbage = next;
+        num_freed++;
+      }
+      return num_freed;
+    }
+
+    std::atomic<uint64_t> epoch_{0};
+    std::array<std::atomic<uint64_t>, K_NUM_EPOCHS> num_active_{};
+    std::array<std::atomic<Garbage *>, K_NUM_EPOCHS> garbage_{};
+    std::mutex advance_latch_;
+    // Retired nodes that have not been freed yet, only maintained for metrics
+    std::atomic<uint64_t> num_retained_{0};
+  };
+
+  class EpochGuard {
+   public:
+    explicit EpochGuard(EpochManager *const epoch_manager)
+        : epoch_manager_(epoch_manager), epoch_(epoch_manager->Enter()) {}
+    ~EpochGuard() { epoch_manager_->Exit(epoch_); }
+    DISALLOW_COPY_AND_MOVE(EpochGuard)
+
+   private:
+    EpochManager *const epoch_manager_;
+    const uint64_t epoch_;
+  };
+
+  // Collects the values of a single key for GetValue
+  class KeyVisitor {
+   public:
+    KeyVisitor(const KeyType &key, std::vector<ValueType> *const values)
+        : key_(key), values_(values), initial_size_(values->size()) {}
+
+    void Reset() { values_->resize(initial_size_); }
+
+    bool Visit(const KeyType &key, const ValueType value) {
+      if (std::memcmp(key.KeyData(), key_.KeyData(), sizeof(KeyType)) != 0) return false;
+      values_->emplace_back(value);
+      return true;
+    }
+
+   private:
+    const KeyType &key_;
+    std::vector<ValueType> *const values_;
+    const size_t initial_size_;
+  };
+
+  Node *const root_;
+  EpochManager epoch_manager_;
+
+  static EntryBytes EncodeBits(const KeyType &key, const uint64_t value_bits) {
+    EntryBytes entry;
+    std::memcpy(entry.data(), key.KeyData(), sizeof(KeyType));
+    const uint64_t big_endian = htobe64(value_bits);
+    std::memcpy(entry.data() + sizeof(KeyType), &big_endian, sizeof(uint64_t));
+    return entry;
+  }
+
+  static EntryBytes Encode(const Leaf &leaf) { return Encode(leaf.key_, leaf.value_); }
+
+  static bool IsLeaf(const Node *const child) { return (reinterpret_cast<uintptr_t>(child) & 1) != 0; }
+
+  static Node *TagLeaf(Leaf *const leaf) { return reinterpret_cast<Node *>(reinterpret_cast<uintptr_t>(leaf) | 1); }
+
+  static const Leaf *UntagLeaf(const Node *const child) {
+    return reinterpret_cast<const Leaf *>(reinterpret_cast<uintptr_t>(child) & ~uintptr_t{1});
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------
+  // Version locks
+  // ---------------------------------------------------------------------------------------------------------------
+
+  static uint64_t ReadLockOrRestart(const Node *const node, bool *const restart) {
+    uint64_t version = node->version_.load();
+    while ((version & K_LOCKED_BIT) != 0) {
+      std::this_thread::yield();
+      version = node->version_.load();
+    }
+    if ((version & K_OBSOLETE_BIT) != 0) *restart = true;
+    return version;
+  }
+
+  static void ReadUnlockOrRestart(const Node *const node, const uint64_t version, bool *const restart) {
+    if (node->version_.load() != version) *restart = true;
+  }
+
+  static void UpgradeToWriteLockOrRestart(Node *const node, uint64_t version, bool *const restart) {
+    if (!node->version_.compare_exchange_strong(version, version + K_LOCKED_BIT)) *restart = true;
+  }
+
+  static void WriteLockOrRestart(Node *const node, bool *const restart) {
+    while (true) {
+      const uint64_t version = ReadLockOrRestart(node, restart);
+      if (*restart) return;
+      UpgradeToWriteLockOrRestart(node, version, restart);
+      if (!*restart) return;
+      *restart = false;
+    }
+  }
+
+  // Clears the lock bit and bumps the write count in one step
+  static void WriteUnlock(Node *const node) { node->version_.fetch_add(K_LOCKED_BIT); }
+
+  static void WriteUnlockObsolete(Node *const node) { node->version_.fetch_add(K_LOCKED_BIT | K_OBSOLETE_BIT); }
+
+  // ---------------------------------------------------------------------------------------------------------------
+  // Node operations. Reads may race with writers, so they bound every index by the capacity of the node and leave it to
+  // the version check to throw away inconsistent results. Writes require the node to be write-locked.
+  // ---------------------------------------------------------------------------------------------------------------
+
+  static void SetPrefix(Node *const node, const uint8_t *const prefix, const uint32_t prefix_len) {
+    TERRIER_ASSERT(prefix_len <= K_ENTRY_LENGTH, "Prefix cannot be longer than an entry.");
+    std::memmove(node->prefix_, prefix, prefix_len);
+    node->prefix_len_ = static_cast<uint16_t>(prefix_len);
+  }
+
+  static Node *GetChild(const Node *const node, const uint8_t byte) {
+    switch (node->type_) {
+      case NodeType::NODE4: {
+        const auto *const n = static_cast<const Node4 *>(node);
+        const uint32_t num_children = std::min<uint32_t>(n->num_children_, 4);
+        for (uint32_t i = 0; i < num_children; i++) {
+          if (n->keys_[i] == byte) return n->children_[i].load(std::memory_order_relaxed);
+        }
+        return nullptr;
+      }
+      case NodeType::NODE16: {
+        const auto *const n = static_cast<const Node16 *>(node);
+        const uint32_t num_children = std::min<uint32_t>(n->num_children_, 16);
+        for (uint32_t i = 0; i < num_children; i++) {
+          if (n->keys_[i] == byte) return n->children_[i].load(std::memory_order_relaxed);
+        }
+        return nullptr;
+      }
+      case NodeType::NODE48: {
+        const auto *const n = static_cast<const Node48 *>(node);
+        const uint8_t slot = n->child_index_[byte];
+        return slot < K_NODE48_EMPTY ? n->children_[slot].load(std::memory_order_relaxed) : nullptr;
+      }
+      case NodeType::NODE256:
+        return static_cast<const Node256 *>(node)->children_[byte].load(std::memory_order_relaxed);
+    }
+    return nullptr;
+  }
+
+  // Copies out the children of a node in ascending key order and returns how many there are
+  static uint32_t GetChildren(const Node *const node, uint8_t *const keys, Node **const children) {
+    uint32_t num_children = 0;
+    switch (node->type_) {
+      case NodeType::NODE4: {
+        const auto *const n = static_cast<const Node4 *>(node);
+        num_children = std::min<uint32_t>(n->num_children_, 4);
+        for (uint32_t i = 0; i < num_children; i++) {
+          keys[i] = n->keys_[i];
+          children[i] = n->children_[i].load(std::memory_order_relaxed);
+        }
+        break;
+      }
+      case NodeType::NODE16: {
+        const auto *const n = static_cast<const Node16 *>(node);
+        num_children = std::min<uint32_t>(n->num_children_, 16);
+        for (uint32_t i = 0; i < num_children; i++) {
+          keys[i] = n->keys_[i];
+          children[i] = n->children_[i].load(std::memory_order_relaxed);
+        }
+        break;
+      }
+      case NodeType::NODE48: {
+        const auto *const n = static_cast<const Node48 *>(node);
+        for (uint32_t byte = 0; byte < 256; byte++) {
+          const uint8_t slot = n->child_index_[byte];
+          if (slot >= K_NODE48_EMPTY) continue;
+          Node *const child = n->children_[slot].load(std::memory_order_relaxed);
+          if (child == nullptr) continue;
+          keys[num_children] = static_cast<uint8_t>(byte);
+          children[num_children++] = child;
+        }
+        break;
+      }
+      case NodeType::NODE256: {
+        const auto *const n = static_cast<const Node256 *>(node);
+        for (uint32_t byte = 0; byte < 256; byte++) {
+          Node *const child = n->children_[byte].load(std::memory_order_relaxed);
+          if (child == nullptr) continue;
+          keys[num_children] = static_cast<uint8_t>(byte);
+          children[num_children++] = child;
+        }
+        break;
+      }
+    }
+    return num_children;
+  }
+
+  static bool IsFull(const Node *const node) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        return node->num_children_ >= 4;
+      case NodeType::NODE16:
+        return node->num_children_ >= 16;
+      case NodeType::NODE48:
+        return node->num_children_ >= 48;
+      case NodeType::NODE256:
+        return false;
+    }
+    return false;
+  }
+
+  // Whether the node should shrink once a child is removed. The thresholds leave some slack so that a node does not
+  // flip between two types when children come and go at the boundary.
+  static bool IsUnderfull(const Node *const node) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        return false;
+      case NodeType::NODE16:
+        return node->num_children_ <= 3;
+      case NodeType::NODE48:
+        return node->num_children_ <= 12;
+      case NodeType::NODE256:
+        return node->num_children_ <= 37;
+    }
+    return false;
+  }
+
+  template <typename SortedNode>
+  static void InsertSorted(SortedNode *const n, const uint8_t byte, Node *const child) {
+    uint32_t pos = 0;
+    while (pos < n->num_children_ && n->keys_[pos] < byte) pos++;
+    for (uint32_t i = n->num_children_; i > pos; i--) {
+      n->keys_[i] = n->keys_[i - 1];
+      n->children_[i].store(n->children_[i - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    n->keys_[pos] = byte;
+    n->children_[pos].store(child, std::memory_order_relaxed);
+    n->num_children_++;
+  }
+
+  template <typename SortedNode>
+  static void RemoveSorted(SortedNode *const n, const uint8_t byte) {
+    uint32_t pos = 0;
+    while (pos < n->num_children_ && n->keys_[pos] != byte) pos++;
+    TERRIER_ASSERT(pos < n->num_children_, "Removing a child that does not exist.");
+    for (uint32_t i = pos + 1; i < n->num_children_; i++) {
+      n->keys_[i - 1] = n->keys_[i];
+      n->children_[i - 1].store(n->children_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    n->num_children_--;
+  }
+
+  static void InsertChild(Node *const node, const uint8_t byte, Node *const child) {
+    TERRIER_ASSERT(!IsFull(node), "Node must have room for the child.");
+    switch (node->type_) {
+      case NodeType::NODE4:
+        InsertSorted(static_cast<Node4 *>(node), byte, child);
+        break;
+      case NodeType::NODE16:
+        InsertSorted(static_cast<Node16 *>(node), byte, child);
+        break;
+      case NodeType::NODE48: {
+        auto *const n = static_cast<Node48 *>(node);
+        uint8_t slot = 0;
+        while (n->children_[slot].load(std::memory_order_relaxed) != nullptr) slot++;
+        n->children_[slot].store(child, std::memory_order_relaxed);
+        n->child_index_[byte] = slot;
+        n->num_children_++;
+        break;
+      }
+      case NodeType::NODE256: {
+        auto *const n = static_cast<Node256 *>(node);
+        n->children_[byte].store(child, std::memory_order_relaxed);
+        n->num_children_++;
+        break;
+      }
+    }
+  }
+
+  static void ChangeChild(Node *const node, const uint8_t byte, Node *const child) {
+    switch (node->type_) {
+      case NodeType::NODE4: {
+        auto *const n = static_cast<Node4 *>(node);
+        for (uint32_t i = 0; i < n->num_children_; i++) {
+          if (n->keys_[i] == byte) n->children_[i].store(child, std::memory_order_relaxed);
+        }
+        break;
+      }
+      case NodeType::NODE16: {
+        auto *const n = static_cast<Node16 *>(node);
+        for (uint32_t i = 0; i < n->num_children_; i++) {
+          if (n->keys_[i] == byte) n->children_[i].store(child, std::memory_order_relaxed);
+        }
+        break;
+      }
+      case NodeType::NODE48: {
+        auto *const n = static_cast<Node48 *>(node);
+        n->children_[n->child_index_[byte]].store(child, std::memory_order_relaxed);
+        break;
+      }
+      case NodeType::NODE256:
+        static_cast<Node256 *>(node)->children_[byte].store(child, std::memory_order_relaxed);
+        break;
+    }
+  }
+
+  static void RemoveChild(Node *const node, const uint8_t byte) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        RemoveSorted(static_cast<Node4 *>(node), byte);
+        break;
+      case NodeType::NODE16:
+        RemoveSorted(static_cast<Node16 *>(node), byte);
+        break;
+      case NodeType::NODE48: {
+        auto *const n = static_cast<Node48 *>(node);
+        n->children_[n->child_index_[byte]].store(nullptr, std::memory_order_relaxed);
+        n->child_index_[byte] = K_NODE48_EMPTY;
+        n->num_children_--;
+        break;
+      }
+      case NodeType::NODE256: {
+        auto *const n = static_cast<Node256 *>(node);
+        n->children_[byte].store(nullptr, std::memory_order_relaxed);
+        n->num_children_--;
+        break;
+      }
+    }
+  }
+
+  static Node *NewNode(const NodeType type) {
+    switch (type) {
+      case NodeType::NODE4:
+        return new Node4();
+      case NodeType::NODE16:
+        return new Node16();
+      case NodeType::NODE48:
+        return new Node48();
+      case NodeType::NODE256:
+        return new Node256();
+    }
+    return nullptr;
+  }
+
+  // Copies a locked node into a new node of the given type, which must have room for all of its children
+  static Node *CopyNode(const Node *const node, const NodeType type) {
+    Node *const copy = NewNode(type);
+    SetPrefix(copy, node->prefix_, node->prefix_len_);
+    uint8_t keys[256];
+    Node *children[256];
+    const uint32_t num_children = GetChildren(node, keys, children);
+    for (uint32_t i = 0; i < num_children; i++) InsertChild(copy, keys[i], children[i]);
+    return copy;
+  }
+
+  static Node *Grow(const Node *const node) {
+    switch (node->type_) {
+      case NodeType::NODE4:
+        return CopyNode(node, NodeType::NODE16);
+      case NodeType::NODE16:
+        return CopyNode(node, NodeType::NODE48);
+      default:
+        return CopyNode(node, NodeType::NODE256);
+    }
+  }
+
+  static Node *Shrink(const Node *const node) {
+    switch (node->type_) {
+      case NodeType::NODE256:
+        return CopyNode(node, NodeType::NODE48);
+      case NodeType::NODE48:
+        return CopyNode(node, NodeType::NODE16);
+      default:
+        return CopyNode(node, NodeType::NODE4);
+    }
+  }
+
+  // Frees a child and, for inner nodes, only the node itself
+  static void FreeNode(Node *const child) {
+    if (IsLeaf(child)) {
+      delete UntagLeaf(child);
+      return;
+    }
+    switch (child->type_) {
+      case NodeType::NODE4:
+        delete static_cast<Node4 *>(child);
+        break;
+      case NodeType::NODE16:
+        delete static_cast<Node16 *>(child);
+        break;
+      case NodeType::NODE48:
+        delete static_cast<Node48 *>(child);
+        break;
+      case NodeType::NODE256:
+        delete static_cast<Node256 *>(child);
+        break;
+    }
+  }
+
+  // Frees a child and everything below it
+  static void FreeChild(Node *const child) {
+    if (!IsLeaf(child)) {
+      uint8_t keys[256];
+      Node *children[256];
+      const uint32_t num_children = GetChildren(child, keys, children);
+      for (uint32_t i = 0; i < num_children; i++) FreeChild(children[i]);
+    }
+    FreeNode(child);
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------
+  // Tree operations. Each attempt returns RESTART if a concurrent writer invalidated what it read, in which case the
+  // caller retries from the root.
+  // ---------------------------------------------------------------------------------------------------------------
+
+  OpResult TryInsert(const EntryBytes &entry, Leaf *const leaf) {
+    bool restart = false;
+    Node *node = nullptr;
+    Node *next = root_;
+    Node *parent = nullptr;
+    uint8_t parent_byte = 0;
+    uint8_t node_byte = 0;
+    uint64_t parent_version = 0;
+    uint32_t level = 0;
+
+    while (true) {
+      parent = node;
+      parent_byte = node_byte;
+      node = next;
+      const uint64_t version = ReadLockOrRestart(node, &restart);
+      if (restart) return OpResult::RESTART;
+      // The parent must still lead here, or node may have moved to a different level of the tree
+      if (parent != nullptr) {
+        ReadUnlockOrRestart(parent, parent_version, &restart);
+        if (restart) return OpResult::RESTART;
+      }
+
+      const uint32_t prefix_len = std::min<uint32_t>(node->prefix_len_, K_ENTRY_LENGTH - level);
+      uint32_t match_len = 0;
+      while (match_len < prefix_len && node->prefix_[match_len] == entry[level + match_len]) match_len++;
+      if (match_len < prefix_len) {
+        // The entry branches off inside the prefix, so a new node takes over the shared part of the prefix. The root
+        // has no prefix, so there is always a parent here.
+        UpgradeToWriteLockOrRestart(parent, parent_version, &restart);
+        if (restart) return OpResult::RESTART;
+        UpgradeToWriteLockOrRestart(node, version, &restart);
+        if (restart) {
+          WriteUnlock(parent);
+          return OpResult::RESTART;
+        }
+        Node *const split = new Node4();
+        SetPrefix(split, node->prefix_, match_len);
+        InsertChild(split, entry[level + match_len], TagLeaf(leaf));
+        InsertChild(split, node->prefix_[match_len], node);
+        ChangeChild(parent, parent_byte, split);
+        SetPrefix(node, node->prefix_ + match_len + 1, node->prefix_len_ - match_len - 1);
+        WriteUnlock(node);
+        WriteUnlock(parent);
+        return OpResult::SUCCESS;
+      }
+      level += prefix_len;
+      // Only reachable through an inconsistent read, which the version check will catch
+      if (level >= K_ENTRY_LENGTH) return OpResult::RESTART;
+
+      node_byte = entry[level];
+      Node *const child = GetChild(node, node_byte);
+      ReadUnlockOrRestart(node, version, &restart);
+      if (restart) return OpResult::RESTART;
+
+      if (child == nullptr) return InsertAndUnlock(node, version, parent, parent_version, parent_byte, node_byte, leaf);
+
+      if (IsLeaf(child)) {
+        // Lazy expansion: the slot holds a single entry, which has to be pushed down into a new node
+        UpgradeToWriteLockOrRestart(node, version, &restart);
+        if (restart) return OpResult::RESTART;
+        const EntryBytes existing = Encode(*UntagLeaf(child));
+        uint32_t branch = level + 1;
+        while (branch < K_ENTRY_LENGTH && existing[branch] == entry[branch]) branch++;
+        if (branch == K_ENTRY_LENGTH) {
+          WriteUnlock(node);
+          return OpResult::FAILURE;
+        }
+        Node *const expanded = new Node4();
+        SetPrefix(expanded, entry.data() + level + 1, branch - level - 1);
+        InsertChild(expanded, existing[branch], child);
+        InsertChild(expanded, entry[branch], TagLeaf(leaf));
+        ChangeChild(node, node_byte, expanded);
+        WriteUnlock(node);
+        return OpResult::SUCCESS;
+      }
+
+      level++;
+      parent_version = version;
+      next = child;
+    }
+  }
+
+  OpResult InsertAndUnlock(Node *const node, const uint64_t version, Node *const parent, const uint64_t parent_version,
+                           const uint8_t parent_byte, const uint8_t byte, Leaf *const leaf) {
+    bool restart = false;
+    if (!IsFull(node)) {
+      UpgradeToWriteLockOrRestart(node, version, &restart);
+      if (restart) return OpResult::RESTART;
+      if (parent != nullptr) {
+        ReadUnlockOrRestart(parent, parent_version, &restart);
+        if (restart) {
+          WriteUnlock(node);
+          return OpResult::RESTART;
+        }
+      }
+      InsertChild(node, byte, TagLeaf(leaf));
+      WriteUnlock(node);
+      return OpResult::SUCCESS;
+    }
+
+    // The root never fills up, so there is always a parent here
+    UpgradeToWriteLockOrRestart(parent, parent_version, &restart);
+    if (restart) return OpResult::RESTART;
+    UpgradeToWriteLockOrRestart(node, version, &restart);
+    if (restart) {
+      WriteUnlock(parent);
+      return OpResult::RESTART;
+    }
+    Node *const grown = Grow(node);
+    InsertChild(grown, byte, TagLeaf(leaf));
+    ChangeChild(parent, parent_byte, grown);
+    WriteUnlock(parent);
+    WriteUnlockObsolete(node);
+    epoch_manager_.Retire(node);
+    return OpResult::SUCCESS;
+  }
+
+  OpResult TryDelete(const EntryBytes &entry) {
+    bool restart = false;
+    Node *node = nullptr;
+    Node *next = root_;
+    Node *parent = nullptr;
+    uint8_t parent_byte = 0;
+    uint8_t node_byte = 0;
+    uint64_t parent_version = 0;
+    uint32_t level = 0;
+
+    while (true) {
+      parent = node;
+      parent_byte = node_byte;
+      node = next;
+      const uint64_t version = ReadLockOrRestart(node, &restart);
+      if (restart) return OpResult::RESTART;
+      // The parent must still lead here, or node may have moved to a different level of the tree
+      if (parent != nullptr) {
+        ReadUnlockOrRestart(parent, parent_version, &restart);
+        if (restart) return OpResult::RESTART;
+      }
+
+      const uint32_t prefix_len = std::min<uint32_t>(node->prefix_len_, K_ENTRY_LENGTH - level);
+      if (std::memcmp(node->prefix_, entry.data() + level, prefix_len) != 0) {
+        ReadUnlockOrRestart(node, version, &restart);
+        return restart ? OpResult::RESTART : OpResult::FAILURE;
+      }
+      level += prefix_len;
+      if (level >= K_ENTRY_LENGTH) return OpResult::RESTART;
+
+      node_byte = entry[level];
+      Node *const child = GetChild(node, node_byte);
+      ReadUnlockOrRestart(node, version, &restart);
+      if (restart) return OpResult::RESTART;
+      if (child == nullptr) return OpResult::FAILURE;
+
+      if (IsLeaf(child)) {
+        // Leaves are immutable and only freed once we leave the epoch, so this is safe even if the leaf was removed
+        if (Encode(*UntagLeaf(child)) != entry) return OpResult::FAILURE;
+
+        if (node->num_children_ == 2 && parent != nullptr) {
+          // The node is left with a single child, which takes its place
+          UpgradeToWriteLockOrRestart(parent, parent_version, &restart);
+          if (restart) return OpResult::RESTART;
+          UpgradeToWriteLockOrRestart(node, version, &restart);
+          if (restart) {
+            WriteUnlock(parent);
+            return OpResult::RESTART;
+          }
+          uint8_t keys[256];
+          Node *children[256];
+          GetChildren(node, keys, children);
+          const uint32_t other = keys[0] == node_byte ? 1 : 0;
+          if (!IsLeaf(children[other])) {
+            // The remaining child absorbs the node's prefix and the byte it branched on
+            Node *const survivor = children[other];
+            WriteLockOrRestart(survivor, &restart);
+            if (restart) {
+              WriteUnlock(node);
+              WriteUnlock(parent);
+              return OpResult::RESTART;
+            }
+            uint8_t merged[2 * K_ENTRY_LENGTH + 1];
+            std::memcpy(merged, node->prefix_, node->prefix_len_);
+            merged[node->prefix_len_] = keys[other];
+            std::memcpy(merged + node->prefix_len_ + 1, survivor->prefix_, survivor->prefix_len_);
+            SetPrefix(survivor, merged, node->prefix_len_ + 1 + survivor->prefix_len_);
+            ChangeChild(parent, parent_byte, survivor);
+            WriteUnlock(survivor);
+          } else {
+            ChangeChild(parent, parent_byte, children[other]);
+          }
+          WriteUnlock(parent);
+          WriteUnlockObsolete(node);
+          epoch_manager_.Retire(node);
+        } else if (IsUnderfull(node) && parent != nullptr) {
+          UpgradeToWriteLockOrRestart(parent, parent_version, &restart);
+          if (restart) return OpResult::RESTART;
+          UpgradeToWriteLockOrRestart(node, version, &restart);
+          if (restart) {
+            WriteUnlock(parent);
+            return OpResult::RESTART;
+          }
+          RemoveChild(node, node_byte);
+          Node *const shrunk = Shrink(node);
+          ChangeChild(parent, parent_byte, shrunk);
+          WriteUnlock(parent);
+          WriteUnlockObsolete(node);
+          epoch_manager_.Retire(node);
+        } else {
+          UpgradeToWriteLockOrRestart(node, version, &restart);
+          if (restart) return OpResult::RESTART;
+          RemoveChild(node, node_byte);
+          WriteUnlock(node);
+        }
+        epoch_manager_.Retire(child);
+        return OpResult::SUCCESS;
+      }
+
+      level++;
+      parent_version = version;
+      next = child;
+    }
+  }
+
+  template <bool Ascending, typename Visitor>
+  void Scan(const EntryBytes &start, Visitor *const visitor) {
+    EpochGuard guard(&epoch_manager_);
+    while (true) {
+      visitor->Reset();
+      bool stop = false;
+      if (ScanNode<Ascending>(nullptr, 0, root_, 0, start, true, visitor, &stop)) return;
+    }
+  }
+
+  // Visits the entries below node in order. bounded is true while the path to node matches start, which means some of
+  // the entries below node might lie before start. Returns false if the scan has to restart.
+  template <bool Ascending, typename Visitor>
+  bool ScanNode(const Node *const parent, const uint64_t parent_version, const Node *const node, uint32_t level,
+                const EntryBytes &start, bool bounded, Visitor *const visitor, bool *const stop) {
+    bool restart = false;
+    const uint64_t version = ReadLockOrRestart(node, &restart);
+    if (restart) return false;
+    if (parent != nullptr) {
+      ReadUnlockOrRestart(parent, parent_version, &restart);
+      if (restart) return false;
+    }
+
+    const uint32_t prefix_len = std::min<uint32_t>(node->prefix_len_, K_ENTRY_LENGTH - level);
+    for (uint32_t i = 0; bounded && i < prefix_len; i++) {
+      const uint8_t byte = node->prefix_[i];
+      if (byte == start[level + i]) continue;
+      if ((byte > start[level + i]) == Ascending) {
+        // Every entry below node lies past start
+        bounded = false;
+      } else {
+        // Every entry below node lies before start
+        ReadUnlockOrRestart(node, version, &restart);
+        return !restart;
+      }
+    }
+    level += prefix_len;
+    if (level >= K_ENTRY_LENGTH) return false;
+
+    // Children are copied out and validated before descending, so later writes to node cannot affect this scan
+    uint8_t keys[256];
+    Node *children[256];
+    const uint32_t num_children = GetChildren(node, keys, children);
+    ReadUnlockOrRestart(node, version, &restart);
+    if (restart) return false;
+
+    for (uint32_t n = 0; n < num_children; n++) {
+      const uint32_t i = Ascending ? n : num_children - 1 - n;
+      bool child_bounded = false;
+      if (bounded) {
+        if (keys[i] == start[level]) {
+          child_bounded = true;
+        } else if ((keys[i] < start[level]) == Ascending) {
+          continue;
+        }
+      }
+
+      if (IsLeaf(children[i])) {
+        const Leaf *const leaf = UntagLeaf(children[i]);
+        if (child_bounded) {
+          const int cmp = std::memcmp(Encode(*leaf).data(), start.data(), K_ENTRY_LENGTH);
+          if (Ascending ? cmp < 0 : cmp > 0) continue;
+        }
+        if (!visitor->Visit(leaf->key_, leaf->value_)) {
+          *stop = true;
+          return true;
+        }
+      } else {
+        if (!ScanNode<Ascending>(node, version, children[i], level + 1, start, child_bounded, visitor, stop)) {
+          return false;
+        }
+        if (*stop) return true;
+      }
+    }
+    return true;
+  }
+};
+
+}  // namespace terrier::storage::index
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/spin_latch.h"
+#include "storage/index/art.h"
+#include "storage/index/index.h"
+#include "storage/index/index_defs.h"
+#include "transaction/deferred_action_manager.h"
+#include "transaction/transaction_context.h"
+#include "transaction/transaction_manager.h"
+
+namespace terrier::storage::index {
+template <uint8_t KeySize>
+class CompactIntsKey;
+template <uint16_t KeySize>
+class GenericKey;
+
+/**
+ * Wrapper around an adaptive radix tree. The tree indexes keys by their bytes, so it only supports key types that are
+ * binary-comparable, i.e. CompactIntsKey and GenericKey.
+ * @tparam KeyType the type of keys stored in the tree
+ */
+template <typename KeyType>
+class ArtIndex final : public Index {
+  friend class IndexBuilder;
+
+ private:
+  // Number of latches that serialize InsertUnique on keys that hash to the same stripe
+  static constexpr uint32_t K_NUM_UNIQUE_LATCHES = 64;
+
+  explicit ArtIndex(IndexMetadata metadata)
+      : Index(std::move(metadata)), art_{new AdaptiveRadixTree<KeyType, TupleSlot>()} {}
+
+  const std::unique_ptr<AdaptiveRadixTree<KeyType, TupleSlot>> art_;
+  std::array<common::SpinLatch, K_NUM_UNIQUE_LATCHES> unique_latches_;
+
+ public:
+  IndexType Type() const final { return IndexType::ART; }
+
+  void PerformGarbageCollection() final { art_->PerformGarbageCollection(); };
+
+  uint64_t NumRetainedGarbageNodes() const final { return art_->NumRetainedGarbageNodes(); }
+
+  bool Insert(const common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+              const TupleSlot location) final {
+    TERRIER_ASSERT(!(metadata_.GetSchema().Unique()),
+                   "This Insert is designed for secondary indexes with no uniqueness constraints.");
+    KeyType index_key;
+    index_key.SetFromProjectedRow(tuple, metadata_, metadata_.GetSchema().GetColumns().size());
+    const bool result = art_->Insert(index_key, location);
+
+    TERRIER_ASSERT(result, "non-unique index shouldn't fail to insert. If it did, something went wrong in the ART.");
+    // Register an abort action with the txn context in case of rollback
+    txn->RegisterAbortAction([=]() {
+      const bool UNUSED_ATTRIBUTE result = art_->Delete(index_key, location);
+      TERRIER_ASSERT(result, "Delete on the index failed.");
+    });
+    return result;
+  }
+
+  bool InsertUnique(const common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+                    const TupleSlot location) final {
+    TERRIER_ASSERT(metadata_.GetSchema().Unique(), "This Insert is designed for indexes with uniqueness constraints.");
+    KeyType index_key;
+    index_key.SetFromProjectedRow(tuple, metadata_, metadata_.GetSchema().GetColumns().size());
+    bool predicate_satisfied = false;
+
+    {
+      // The tree has no conditional insert, so the check and the insert must not interleave with another InsertUnique
+      // on the same key
+      const auto stripe = std::hash<KeyType>()(index_key) % K_NUM_UNIQUE_LATCHES;
+      common::SpinLatch::ScopedSpinLatch guard(&unique_latches_[stripe]);
+
+      // The predicate checks if any matching keys have write-write conflicts or are still visible to the calling txn.
+      std::vector<TupleSlot> existing;
+      art_->GetValue(index_key, &existing);
+      for (const auto slot : existing) {
+        const auto *const data_table = slot.GetBlock()->data_table_;
+        if (data_table->HasConflict(*txn, slot) || data_table->IsVisible(*txn, slot)) {
+          predicate_satisfied = true;
+          break;
+        }
+      }
+      if (!predicate_satisfied) art_->Insert(index_key, location);
+    }
+
+    const bool result = !predicate_satisfied;
+    if (result) {
+      // Register an abort action with the txn context in case of rollback
+      txn->RegisterAbortAction([=]() {
+        const bool UNUSED_ATTRIBUTE result = art_->Delete(index_key, location);
+        TERRIER_ASSERT(result, "Delete on the index failed.");
+      });
+    } else {
+      // Presumably you've already made modifications to a DataTable (the source of the TupleSlot argument to this
+      // function) however, the index found a constraint violation and cannot allow that operation to succeed. For MVCC
+      // correctness, this txn must now abort for the GC to clean up the version chain in the DataTable correctly.
+      txn->SetMustAbort();
+    }
+
+    return result;
+  }
+
+  void Delete(const common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
+              const TupleSlot location) final {
+    KeyType index_key;
+    index_key.SetFromProjectedRow(tuple, metadata_, metadata_.GetSchema().GetColumns().size());
+
+    TERRIER_ASSERT(!(location.GetBlock()->data_table_->HasConflict(*txn, location)) &&
+                       !(location.GetBlock()->data_table_->IsVisible(*txn, location)),
+                   "Called index delete on a TupleSlot that has a conflict with this txn or is still visible.");
+
+    // Register a deferred action for the GC with txn manager. See base function comment.
+    txn->RegisterCommitAction([=](transaction::DeferredActionManager *deferred_action_manager) {
+      deferred_action_manager->RegisterDeferredAction([=]() {
+        const bool UNUSED_ATTRIBUTE result = art_->Delete(index_key, location);
+        TERRIER_ASSERT(result, "Deferred delete on the index failed.");
+      });
+    });
+  }
+
+  void ScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key,
+               std::vector<TupleSlot> *value_list) final {
+    TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+
+    std::vector<TupleSlot> results;
+
+    // Build search key
+    KeyType index_key;
+    index_key.SetFromProjectedRow(key, metadata_, metadata_.GetSchema().GetColumns().size());
+
+    // Perform lookup in the ART
+    art_->GetValue(index_key, &results);
+
+    // Avoid resizing our value_list, even if it means over-provisioning
+    value_list->reserve(results.size());
+
+    // Perform visibility check on result
+    for (const auto &result : results) {
+      if (IsVisible(txn, result)) value_list->emplace_back(result);
+    }
+
+    TERRIER_ASSERT(!(metadata_.GetSchema().Unique()) || (metadata_.GetSchema().Unique() && value_list->size() <= 1),
+                   "Invalid number of results for unique index.");
+  }
+
+  std::unique_ptr<Cursor> OpenScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key) final {
+    KeyType index_key;
+    index_key.SetFromProjectedRow(key, metadata_, metadata_.GetSchema().GetColumns().size());
+
+    std::vector<TupleSlot> results;
+    art_->GetValue(index_key, &results);
+    return std::make_unique<SlotListCursor>(txn, std::move(results));
+  }
+
+  void ScanKeyBatch(const transaction::TransactionContext &txn, const ProjectedRow *const *keys, uint32_t num_keys,
+                    std::vector<TupleSlot> *value_list, std::vector<uint32_t> *key_offsets) final;
+
+  std::unique_ptr<Cursor> OpenScanAscending(const transaction::TransactionContext &txn, ScanType scan_type,
+                                            uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
+                                            uint32_t limit) final;
+
+  std::unique_ptr<Cursor> OpenScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                                             const ProjectedRow &high_key, uint32_t limit) final;
+
+  void ScanAscending(const transaction::TransactionContext &txn, ScanType scan_type, uint32_t num_attrs,
+                     ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
+                     std::vector<TupleSlot> *value_list) final;
+
+  void ScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                      const ProjectedRow &high_key, std::vector<TupleSlot> *value_list) final;
+
+  void ScanLimitDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                           const ProjectedRow &high_key, std::vector<TupleSlot> *value_list, uint32_t limit) final;
+
+ private:
+  // Cursors over a range of the tree, see art_index.cpp
+  class AscendingCursor;
+  class DescendingCursor;
+};
+
+extern template class ArtIndex<CompactIntsKey<8>>;
+extern template class ArtIndex<CompactIntsKey<16>>;
+extern template class ArtIndex<CompactIntsKey<24>>;
+extern template class ArtIndex<CompactIntsKey<32>>;
+
+extern template class ArtIndex<GenericKey<64>>;
+extern template class ArtIndex<GenericKey<128>>;
+extern template class ArtIndex<GenericKey<256>>;
+
+}  // namespace terrier::storage::index
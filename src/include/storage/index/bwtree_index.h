@@ -8,6 +8,7 @@
 #include "bwtree/bwtree.h"
 #include "storage/index/index.h"
 #include "storage/index/index_defs.h"
+#include "storage/sql_table.h"
 #include "transaction/deferred_action_manager.h"
 #include "transaction/transaction_context.h"
 #include "transaction/transaction_manager.h"
@@ -32,11 +33,27 @@ class BwTreeIndex final : public Index {
 
   const std::unique_ptr<third_party::bwtree::BwTree<KeyType, TupleSlot>> bwtree_;
 
+  // Tuples written while the index was being built, whose entries BulkLoad's catch-up fixes
+  TableWriteSet written_;
+
+  // Brings the entries of the tuples written while the index was being built up to date, see BulkLoad
+  void CatchUp(common::ManagedPointer<transaction::TransactionManager> txn_manager,
+               common::ManagedPointer<SqlTable> table);
+
+  // Whether the tuple was written while the index was being built, in which case its entry may be missing or already
+  // removed by the catch-up
+  bool WrittenDuringBuild(const TupleSlot location) {
+    common::SpinLatch::ScopedSpinLatch guard(&written_.latch_);
+    return written_.slots_.count(location) > 0;
+  }
+
  public:
   IndexType Type() const final { return IndexType::BWTREE; }
 
   void PerformGarbageCollection() final { bwtree_->PerformGarbageCollection(); };
 
+  uint64_t NumRetainedGarbageNodes() const final { return bwtree_->GetRetainedGarbageNodeCount(); }
+
   bool Insert(const common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
               const TupleSlot location) final {
     TERRIER_ASSERT(!(metadata_.GetSchema().Unique()),
@@ -91,6 +108,14 @@ class BwTreeIndex final : public Index {
     return result;
   }
 
+  /**
+   * Builds the tree bottom-up from the sorted keys of the table. Given a txn manager, the index records the tuples
+   * written from the creating txn's snapshot on. Once the creating txn commits and all transactions that were running
+   * then are done, a deferred action fixes the entries of those tuples in a new txn, and the index stops building.
+   */
+  bool BulkLoad(common::ManagedPointer<transaction::TransactionContext> txn, common::ManagedPointer<SqlTable> table,
+                common::ManagedPointer<transaction::TransactionManager> txn_manager) final;
+
   void Delete(const common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
               const TupleSlot location) final {
     KeyType index_key;
@@ -104,7 +129,7 @@ class BwTreeIndex final : public Index {
     txn->RegisterCommitAction([=](transaction::DeferredActionManager *deferred_action_manager) {
       deferred_action_manager->RegisterDeferredAction([=]() {
         const bool UNUSED_ATTRIBUTE result = bwtree_->Delete(index_key, location);
-        TERRIER_ASSERT(result, "Deferred delete on the index failed.");
+        TERRIER_ASSERT(result || WrittenDuringBuild(location), "Deferred delete on the index failed.");
       });
     });
   }
@@ -134,82 +159,39 @@ class BwTreeIndex final : public Index {
                    "Invalid number of results for unique index.");
   }
 
-  void ScanAscending(const transaction::TransactionContext &txn, ScanType scan_type, uint32_t num_attrs,
-                     ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
-                     std::vector<TupleSlot> *value_list) final {
-    TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
-    TERRIER_ASSERT(scan_type == ScanType::Closed || scan_type == ScanType::OpenLow || scan_type == ScanType::OpenHigh ||
-                       scan_type == ScanType::OpenBoth,
-                   "Invalid scan_type passed into BwTreeIndex::Scan");
+  std::unique_ptr<Cursor> OpenScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key) final {
+    KeyType index_key;
+    index_key.SetFromProjectedRow(key, metadata_, metadata_.GetSchema().GetColumns().size());
 
-    bool low_key_exists = (scan_type == ScanType::Closed || scan_type == ScanType::OpenHigh);
-    bool high_key_exists = (scan_type == ScanType::Closed || scan_type == ScanType::OpenLow);
+    std::vector<TupleSlot> results;
+    bwtree_->GetValue(index_key, results);
+    return std::make_unique<SlotListCursor>(txn, std::move(results));
+  }
 
-    // Build search keys
-    KeyType index_low_key, index_high_key;
-    if (low_key_exists) index_low_key.SetFromProjectedRow(*low_key, metadata_, num_attrs);
-    if (high_key_exists) index_high_key.SetFromProjectedRow(*high_key, metadata_, num_attrs);
+  void ScanKeyBatch(const transaction::TransactionContext &txn, const ProjectedRow *const *keys, uint32_t num_keys,
+                    std::vector<TupleSlot> *value_list, std::vector<uint32_t> *key_offsets) final;
 
-    // Perform lookup in BwTree
-    auto scan_itr = low_key_exists ? bwtree_->Begin(index_low_key) : bwtree_->Begin();
-
-    // Limit of 0 indicates "no limit"
-    while ((limit == 0 || value_list->size() < limit) && !scan_itr.IsEnd() &&
-           (!high_key_exists || scan_itr->first.PartialLessThan(index_high_key, &metadata_, num_attrs))) {
-      // Perform visibility check on result
-      if (IsVisible(txn, scan_itr->second)) value_list->emplace_back(scan_itr->second);
-      scan_itr++;
-    }
-  }
+  std::unique_ptr<Cursor> OpenScanAscending(const transaction::TransactionContext &txn, ScanType scan_type,
+                                            uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
+                                            uint32_t limit) final;
 
-  void ScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
-                      const ProjectedRow &high_key, std::vector<TupleSlot> *value_list) final {
-    TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  std::unique_ptr<Cursor> OpenScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                                             const ProjectedRow &high_key, uint32_t limit) final;
 
-    // Build search keys
-    KeyType index_low_key, index_high_key;
-    index_low_key.SetFromProjectedRow(low_key, metadata_, metadata_.GetSchema().GetColumns().size());
-    index_high_key.SetFromProjectedRow(high_key, metadata_, metadata_.GetSchema().GetColumns().size());
+  void ScanAscending(const transaction::TransactionContext &txn, ScanType scan_type, uint32_t num_attrs,
+                     ProjectedRow *low_key, ProjectedRow *high_key, uint32_t limit,
+                     std::vector<TupleSlot> *value_list) final;
 
-    // Perform lookup in BwTree
-    auto scan_itr = bwtree_->Begin(index_high_key);
-    // Back up one element if we didn't match the high key
-    // This currently uses the BwTree's decrement operator on the iterator, which is not guaranteed to be
-    // constant time. In some cases it may be faster to do an ascending scan and then reverse the result vector. It
-    // depends on the visibility selectivity and final result set size. We can change the implementation in the future
-    // if it proves to be a problem.
-    if (scan_itr.IsEnd() || bwtree_->KeyCmpGreater(scan_itr->first, index_high_key)) scan_itr--;
-
-    while (!scan_itr.IsREnd() && (bwtree_->KeyCmpGreaterEqual(scan_itr->first, index_low_key))) {
-      // Perform visibility check on result
-      if (IsVisible(txn, scan_itr->second)) value_list->emplace_back(scan_itr->second);
-      scan_itr--;
-    }
-  }
+  void ScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                      const ProjectedRow &high_key, std::vector<TupleSlot> *value_list) final;
 
   void ScanLimitDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
-                           const ProjectedRow &high_key, std::vector<TupleSlot> *value_list,
-                           const uint32_t limit) final {
-    TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
-    TERRIER_ASSERT(limit > 0, "Limit must be greater than 0.");
+                           const ProjectedRow &high_key, std::vector<TupleSlot> *value_list, uint32_t limit) final;
 
-    // Build search keys
-    KeyType index_low_key, index_high_key;
-    index_low_key.SetFromProjectedRow(low_key, metadata_, metadata_.GetSchema().GetColumns().size());
-    index_high_key.SetFromProjectedRow(high_key, metadata_, metadata_.GetSchema().GetColumns().size());
-
-    // Perform lookup in BwTree
-    auto scan_itr = bwtree_->Begin(index_high_key);
-    // Back up one element if we didn't match the high key, see comment on line 152.
-    if (scan_itr.IsEnd() || bwtree_->KeyCmpGreater(scan_itr->first, index_high_key)) scan_itr--;
-
-    while (value_list->size() < limit && !scan_itr.IsREnd() &&
-           (bwtree_->KeyCmpGreaterEqual(scan_itr->first, index_low_key))) {
-      // Perform visibility check on result
-      if (IsVisible(txn, scan_itr->second)) value_list->emplace_back(scan_itr->second);
-      scan_itr--;
-    }
-  }
+ private:
+  // Cursors over a range of the tree, see bwtree_index.cpp
+  class AscendingCursor;
+  class DescendingCursor;
 };
 
 extern template class BwTreeIndex<CompactIntsKey<8>>;
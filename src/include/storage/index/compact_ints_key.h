@@ -93,6 +93,38 @@ class CompactIntsKey {
     }
   }
 
+  /**
+   * Inverse of SetFromProjectedRow, decodes all attributes of the key into a ProjectedRow
+   * @param[out] to ProjectedRow built with the index's ProjectedRowInitializer
+   * @param metadata index information, primarily attribute sizes and the precomputed offsets to translate PR layout to
+   * CompactIntsKey
+   */
+  void CopyToProjectedRow(storage::ProjectedRow *const to, const IndexMetadata &metadata) const {
+    const auto &attr_sizes = metadata.GetAttributeSizes();
+    const auto &compact_ints_offsets = metadata.GetCompactIntsOffsets();
+    TERRIER_ASSERT(attr_sizes.size() == to->NumColumns(), "attr_sizes and ProjectedRow must be equal in size.");
+
+    for (uint16_t i = 0; i < to->NumColumns(); i++) {
+      byte *const attr = to->AccessForceNotNull(static_cast<uint16_t>(to->ColumnIds()[i]));
+      switch (attr_sizes[i]) {
+        case sizeof(int8_t):
+          *reinterpret_cast<int8_t *>(attr) = GetInteger<int8_t>(compact_ints_offsets[i]);
+          break;
+        case sizeof(int16_t):
+          *reinterpret_cast<int16_t *>(attr) = GetInteger<int16_t>(compact_ints_offsets[i]);
+          break;
+        case sizeof(int32_t):
+          *reinterpret_cast<int32_t *>(attr) = GetInteger<int32_t>(compact_ints_offsets[i]);
+          break;
+        case sizeof(int64_t):
+          *reinterpret_cast<int64_t *>(attr) = GetInteger<int64_t>(compact_ints_offsets[i]);
+          break;
+        default:
+          throw std::runtime_error("Invalid attribute size.");
+      }
+    }
+  }
+
   /**
    * Returns whether this key is less than another key up to num_attrs for comparison.
    * @param rhs other key to compare against
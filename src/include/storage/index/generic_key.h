@@ -1,11 +1,9 @@
 #pragma once
 
-#include <algorithm>
 #include <cstring>
 #include <functional>
-#include <vector>
+#include <type_traits>
 
-#include "common/hash_util.h"
 #include "storage/index/index_metadata.h"
 #include "storage/projected_row.h"
 #include "storage/storage_defs.h"
@@ -20,6 +18,17 @@ constexpr uint16_t GENERICKEY_MAX_SIZE = 256;
 /**
  * GenericKey is a slower key type than CompactIntsKey for use when the constraints of CompactIntsKey make it
  * unsuitable. For example, GenericKey supports VARLEN and NULLable attributes.
+ *
+ * The key stores a normalized encoding of its attributes that orders the same way as the attributes themselves, so
+ * keys compare and hash with a single memcmp or hash over their bytes, and the ART can index them directly. Every
+ * attribute takes a fixed-size slot at the offset precomputed by IndexMetadata::GetNormalizedAttributeOffsets():
+ *   - a NULL indicator byte, 0 for NULL and 1 otherwise, so NULL sorts first. A NULL slot is all zeros.
+ *   - signed integers in big-endian with the sign bit flipped, unsigned DATE and TIMESTAMP in big-endian, and DECIMAL
+ *     with the sign bit flipped for positive values and every bit flipped for negative ones.
+ *   - varlens as their content padded with zeros to the maximum size, followed by their big-endian size. Comparing the
+ *     padded content first and the size second gives the same order as comparing the content and breaking ties by
+ *     length, and keeps the content contiguous so that CopyToProjectedRow can point into the key.
+ * The rest of the buffer is zeroed, so keys of the same index can be compared over their whole buffer.
  * @tparam KeySize number of bytes for the key's internal buffer
  */
 template <uint16_t KeySize>
@@ -31,233 +40,225 @@ class GenericKey {
    * Set the GenericKey's data based on a ProjectedRow and associated index metadata
    * @param from ProjectedRow to generate GenericKey representation of
    * @param metadata index information, key_schema used to interpret PR data correctly
-   * @param num_attrs Number of attributes
+   * @param num_attrs Number of attributes. The attributes past it are encoded as NULL, which makes this the smallest
+   *                  key with the given prefix.
    */
   void SetFromProjectedRow(const storage::ProjectedRow &from, const IndexMetadata &metadata, size_t num_attrs) {
-    TERRIER_ASSERT(from.NumColumns() == metadata.GetSchema().GetColumns().size(),
+    const auto &key_cols = metadata.GetSchema().GetColumns();
+    const auto &normalized_offsets = metadata.GetNormalizedAttributeOffsets();
+    TERRIER_ASSERT(from.NumColumns() == key_cols.size(),
                    "ProjectedRow should have the same number of columns at the original key schema.");
-    metadata_ = &metadata;
-    std::memset(key_data_, 0, KeySize);
+    TERRIER_ASSERT(num_attrs > 0 && num_attrs <= key_cols.size(), "Number of attributes violates invariant");
+    TERRIER_ASSERT(metadata.NormalizedKeySize() <= KeySize, "Normalized key will access out of bounds.");
 
-    if (metadata.MustInlineVarlen()) {
-      const auto &key_schema = metadata.GetSchema();
-      const auto &inlined_attr_sizes = metadata.GetInlinedAttributeSizes();
-
-      const ProjectedRowInitializer &generic_key_initializer = metadata.GetInlinedPRInitializer();
-
-      auto *const pr = GetProjectedRow();
-      generic_key_initializer.InitializeRow(pr);
-
-      UNUSED_ATTRIBUTE const auto &key_cols = key_schema.GetColumns();
-      TERRIER_ASSERT(num_attrs > 0 && num_attrs <= key_cols.size(), "Number of attributes violates invariant");
-
-      for (uint16_t i = 0; i < num_attrs; i++) {
-        const auto offset = static_cast<uint16_t>(from.ColumnIds()[i]);
-        TERRIER_ASSERT(offset == static_cast<uint16_t>(pr->ColumnIds()[i]), "PRs must have the same comparison order!");
-        const byte *const from_attr = from.AccessWithNullCheck(offset);
-        if (from_attr == nullptr) {
-          pr->SetNull(offset);
-        } else {
-          const auto inlined_attr_size = inlined_attr_sizes[i];
-          // TODO(Gus): Magic number
-          if (inlined_attr_size <= 16) {
-            std::memcpy(pr->AccessForceNotNull(offset), from_attr, inlined_attr_sizes[i]);
-          } else {
-            // Convert the VarlenEntry to be inlined
-            const auto varlen = *reinterpret_cast<const VarlenEntry *const>(from_attr);
-            byte *const to_attr = pr->AccessForceNotNull(offset);
-            const auto varlen_size = varlen.Size();
-            *reinterpret_cast<uint32_t *const>(to_attr) = varlen_size;
-            TERRIER_ASSERT(reinterpret_cast<uintptr_t>(to_attr) + sizeof(uint32_t) + varlen_size <=
-                               reinterpret_cast<uintptr_t>(this) + KeySize,
-                           "ProjectedRow will access out of bounds.");
-            std::memcpy(to_attr + sizeof(uint32_t), varlen.Content(), varlen_size);
-          }
-        }
-      }
-    } else {
-      TERRIER_ASSERT(
-          reinterpret_cast<uintptr_t>(GetProjectedRow()) + from.Size() <= reinterpret_cast<uintptr_t>(this) + KeySize,
-          "ProjectedRow will access out of bounds.");
-      // We recast GetProjectedRow() as a workaround for -Wclass-memaccess
-      std::memcpy(static_cast<void *>(GetProjectedRow()), &from, from.Size());
+    std::memset(key_data_, 0, KeySize);
+    for (uint16_t i = 0; i < num_attrs; i++) {
+      const byte *const from_attr = from.AccessWithNullCheck(static_cast<uint16_t>(from.ColumnIds()[i]));
+      if (from_attr == nullptr) continue;
+      byte *const to_slot = key_data_ + normalized_offsets[i];
+      to_slot[0] = static_cast<byte>(K_NOT_NULL);
+      EncodeAttribute(key_cols[i].Type(), from_attr, to_slot + 1,
+                      static_cast<uint16_t>(normalized_offsets[i + 1] - normalized_offsets[i] - 1));
     }
   }
 
   /**
-   * @return Aligned pointer to the key's internal ProjectedRow, exposed for hasher and comparators
+   * Inverse of SetFromProjectedRow, copies all attributes of the key into a ProjectedRow
+   * @param[out] to ProjectedRow built with the index's ProjectedRowInitializer. Varlens that are too big to be inlined
+   *                into a VarlenEntry point into this key, so they are only valid as long as the key is.
+   * @param metadata index information, key_schema used to interpret PR data correctly
    */
-  const ProjectedRow *GetProjectedRow() const {
-    const auto *pr = reinterpret_cast<const ProjectedRow *>(StorageUtil::AlignedPtr(sizeof(uint64_t), key_data_));
-    TERRIER_ASSERT(reinterpret_cast<uintptr_t>(pr) % sizeof(uint64_t) == 0,
-                   "ProjectedRow must be aligned to 8 bytes for atomicity guarantees.");
-    TERRIER_ASSERT(reinterpret_cast<uintptr_t>(pr) + pr->Size() <= reinterpret_cast<uintptr_t>(this) + KeySize,
-                   "ProjectedRow will access out of bounds.");
-    return pr;
+  void CopyToProjectedRow(storage::ProjectedRow *const to, const IndexMetadata &metadata) const {
+    const auto &key_cols = metadata.GetSchema().GetColumns();
+    const auto &normalized_offsets = metadata.GetNormalizedAttributeOffsets();
+    TERRIER_ASSERT(to->NumColumns() == key_cols.size(),
+                   "ProjectedRow should have the same number of columns at the original key schema.");
+
+    for (uint16_t i = 0; i < to->NumColumns(); i++) {
+      const auto offset = static_cast<uint16_t>(to->ColumnIds()[i]);
+      const byte *const from_slot = key_data_ + normalized_offsets[i];
+      if (static_cast<uint8_t>(from_slot[0]) != K_NOT_NULL) {
+        to->SetNull(offset);
+        continue;
+      }
+      DecodeAttribute(key_cols[i].Type(), from_slot + 1,
+                      static_cast<uint16_t>(normalized_offsets[i + 1] - normalized_offsets[i] - 1),
+                      to->AccessForceNotNull(offset));
+    }
   }
 
   /**
-   * @return metadata of the index for this key, exposed for hasher and comparators
+   * @return the key's normalized bytes, which order the same way as the key
    */
-  const IndexMetadata &GetIndexMetadata() const {
-    TERRIER_ASSERT(metadata_ != nullptr, "This key has no metadata.");
-    return *metadata_;
-  }
+  const byte *KeyData() const { return key_data_; }
 
   /**
-   * Utility class to evaluate comparisons of embedded types within a ProjectedRow. This is not exposed somewhere like
-   * type/type_util.h becauase these do not enforce SQL comparison semantics (i.e. NULL comparisons evaluate to NULL).
-   * These comparisons are merely for ordering semantics. If it makes sense for this to be moved somewhere more general
-   * purpose in the future, feel free to do so, but for now the only use is in GenericKey and I don't want to encourage
-   * their misuse elsewhere in the system.
+   * Returns whether this key is less than another key up to num_attrs for comparison.
+   * @param rhs other key to compare against
+   * @param metadata IndexMetadata
+   * @param num_attrs attributes to compare against
+   * @returns whether this is less than other
    */
-  struct TypeComparators {
-    TypeComparators() = delete;
-
-    /**
-     * @param lhs_attr first VarlenEntry to be compared
-     * @param rhs_attr second VarlenEntry to be compared
-     * @return std::memcmp semantics: < 0 means first is less than second, 0 means equal, > 0 means first is greater
-     * than second
-     */
-    static int CompareVarlens(const byte *const lhs_attr, const byte *const rhs_attr) {
-      const uint32_t lhs_size = *reinterpret_cast<const uint32_t *const>(lhs_attr);
-      const uint32_t rhs_size = *reinterpret_cast<const uint32_t *const>(rhs_attr);
-      const auto smallest_size = std::min(lhs_size, rhs_size);
-
-      // get the pointers to the content
-      const byte *const lhs_content = lhs_attr + sizeof(uint32_t);
-      const byte *const rhs_content = rhs_attr + sizeof(uint32_t);
-      auto result = std::memcmp(lhs_content, rhs_content, smallest_size);
-      if (result == 0 && lhs_size != rhs_size) {
-        // strings compared as equal, but they have different lengths. Decide based on length
-        result = lhs_size - rhs_size;
-      }
-      return result;
-    }
-
-#define COMPARE_FUNC(OP)                                                                                              \
-  switch (type_id) {                                                                                                  \
-    case type::TypeId::BOOLEAN:                                                                                       \
-    case type::TypeId::TINYINT:                                                                                       \
-      return *reinterpret_cast<const int8_t *const>(lhs_attr) OP * reinterpret_cast<const int8_t *const>(rhs_attr);   \
-    case type::TypeId::SMALLINT:                                                                                      \
-      return *reinterpret_cast<const int16_t *const>(lhs_attr) OP * reinterpret_cast<const int16_t *const>(rhs_attr); \
-    case type::TypeId::INTEGER:                                                                                       \
-      return *reinterpret_cast<const int32_t *const>(lhs_attr) OP * reinterpret_cast<const int32_t *const>(rhs_attr); \
-    case type::TypeId::DATE:                                                                                          \
-      return *reinterpret_cast<const uint32_t *const>(lhs_attr) OP *                                                  \
-             reinterpret_cast<const uint32_t *const>(rhs_attr);                                                       \
-    case type::TypeId::BIGINT:                                                                                        \
-      return *reinterpret_cast<const int64_t *const>(lhs_attr) OP * reinterpret_cast<const int64_t *const>(rhs_attr); \
-    case type::TypeId::DECIMAL:                                                                                       \
-      return *reinterpret_cast<const double *const>(lhs_attr) OP * reinterpret_cast<const double *const>(rhs_attr);   \
-    case type::TypeId::TIMESTAMP:                                                                                     \
-      return *reinterpret_cast<const uint64_t *const>(lhs_attr) OP *                                                  \
-             reinterpret_cast<const uint64_t *const>(rhs_attr);                                                       \
-    case type::TypeId::VARCHAR:                                                                                       \
-    case type::TypeId::VARBINARY: {                                                                                   \
-      return CompareVarlens(lhs_attr, rhs_attr) OP 0;                                                                 \
-    }                                                                                                                 \
-    default:                                                                                                          \
-      throw std::runtime_error("Unknown TypeId in terrier::storage::index::GenericKey::TypeComparators.");            \
+  bool PartialLessThan(const GenericKey<KeySize> &rhs, const IndexMetadata *metadata, size_t num_attrs) const {
+    TERRIER_ASSERT(num_attrs > 0 && num_attrs <= metadata->GetSchema().GetColumns().size(),
+                   "Invalid num_attrs for generic key");
+    // The attributes' slots are laid out in key schema order, so the first num_attrs attributes are a byte prefix
+    return std::memcmp(key_data_, rhs.key_data_, metadata->GetNormalizedAttributeOffsets()[num_attrs]) <= 0;
   }
 
-    /**
-     * @param type_id TypeId to interpret both pointers as
-     * @param lhs_attr first value to be compared
-     * @param rhs_attr second value to be compared
-     * @return true if first is less than second
-     */
-    static bool CompareLessThan(const type::TypeId type_id, const byte *const lhs_attr, const byte *const rhs_attr) {
-      COMPARE_FUNC(<)  // NOLINT
-    }
+ private:
+  static constexpr uint8_t K_NOT_NULL = 1;
 
-    /**
-     * @param type_id TypeId to interpret both pointers as
-     * @param lhs_attr first value to be compared
-     * @param rhs_attr second value to be compared
-     * @return true if first is greater than second
-     */
-    static bool CompareGreaterThan(const type::TypeId type_id, const byte *const lhs_attr, const byte *const rhs_attr) {
-      COMPARE_FUNC(>)  // NOLINT
+  template <typename T>
+  static void EncodeBigEndian(const T value, byte *const to) {
+    for (uint32_t i = 0; i < sizeof(T); i++) {
+      to[i] = static_cast<byte>(value >> (8 * (sizeof(T) - 1 - i)));
     }
+  }
 
-    /**
-     * @param type_id TypeId to interpret both pointers as
-     * @param lhs_attr first value to be compared
-     * @param rhs_attr second value to be compared
-     * @return true if first is equal to second
-     */
-    static bool CompareEquals(const type::TypeId type_id, const byte *const lhs_attr, const byte *const rhs_attr) {
-      COMPARE_FUNC(==)
+  template <typename T>
+  static T DecodeBigEndian(const byte *const from) {
+    T value = 0;
+    for (uint32_t i = 0; i < sizeof(T); i++) {
+      value = static_cast<T>((value << 8) | static_cast<uint8_t>(from[i]));
     }
-  };
+    return value;
+  }
 
-  /**
-   * Returns whether this key is less than another key up to num_attrs for comparison.
-   * @param rhs other key to compare against
-   * @param metadata IndexMetadata
-   * @param num_attrs attributes to compare against
-   * @returns whether this is less than other
-   */
-  bool PartialLessThan(const GenericKey<KeySize> &rhs, UNUSED_ATTRIBUTE const IndexMetadata *metadata,
-                       size_t num_attrs) const {
-    const auto &key_schema = GetIndexMetadata().GetSchema();
-    UNUSED_ATTRIBUTE const auto &key_cols = key_schema.GetColumns();
-    TERRIER_ASSERT(num_attrs > 0 && num_attrs <= key_cols.size(), "Invalid num_attrs for generic key");
+  template <typename Signed>
+  static void EncodeSigned(const byte *const from, byte *const to) {
+    using Unsigned = std::make_unsigned_t<Signed>;
+    Unsigned value;
+    std::memcpy(&value, from, sizeof(Unsigned));
+    EncodeBigEndian<Unsigned>(static_cast<Unsigned>(value ^ SignBit<Unsigned>()), to);
+  }
 
-    for (uint16_t i = 0; i < num_attrs; i++) {
-      const auto *const lhs_pr = GetProjectedRow();
-      const auto *const rhs_pr = rhs.GetProjectedRow();
-
-      const auto offset = static_cast<uint16_t>(lhs_pr->ColumnIds()[i]);
-      TERRIER_ASSERT(lhs_pr->ColumnIds()[i] == rhs_pr->ColumnIds()[i], "Comparison orders should be the same.");
-
-      const byte *const lhs_attr = lhs_pr->AccessWithNullCheck(offset);
-      const byte *const rhs_attr = rhs_pr->AccessWithNullCheck(offset);
-
-      if (lhs_attr == nullptr) {
-        if (rhs_attr == nullptr) {
-          // attributes are both NULL (equal), continue
-          continue;
-        }
-        // lhs is NULL, rhs is non-NULL, lhs is less than
-        return true;
-      }
+  template <typename Signed>
+  static void DecodeSigned(const byte *const from, byte *const to) {
+    using Unsigned = std::make_unsigned_t<Signed>;
+    const auto value = static_cast<Unsigned>(DecodeBigEndian<Unsigned>(from) ^ SignBit<Unsigned>());
+    std::memcpy(to, &value, sizeof(Unsigned));
+  }
 
-      if (rhs_attr == nullptr) {
-        // lhs is non-NULL, rhs is NULL, lhs is greater than
-        return false;
-      }
+  template <typename Unsigned>
+  static void EncodeUnsigned(const byte *const from, byte *const to) {
+    Unsigned value;
+    std::memcpy(&value, from, sizeof(Unsigned));
+    EncodeBigEndian<Unsigned>(value, to);
+  }
 
-      const terrier::type::TypeId type_id = key_schema.GetColumns()[i].Type();
+  template <typename Unsigned>
+  static void DecodeUnsigned(const byte *const from, byte *const to) {
+    const auto value = DecodeBigEndian<Unsigned>(from);
+    std::memcpy(to, &value, sizeof(Unsigned));
+  }
 
-      if (terrier::storage::index::GenericKey<KeySize>::TypeComparators::CompareLessThan(type_id, lhs_attr, rhs_attr))
-        return true;
-      if (terrier::storage::index::GenericKey<KeySize>::TypeComparators::CompareGreaterThan(type_id, lhs_attr,
-                                                                                            rhs_attr))
-        return false;
+  template <typename Unsigned>
+  static constexpr Unsigned SignBit() {
+    return static_cast<Unsigned>(Unsigned{1} << (8 * sizeof(Unsigned) - 1));
+  }
 
-      // attributes are equal, continue
-    }
+  static void EncodeDecimal(const byte *const from, byte *const to) {
+    double value;
+    std::memcpy(&value, from, sizeof(double));
+    // -0.0 and 0.0 are equal, so they need the same bytes
+    if (value == 0.0) value = 0.0;
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(uint64_t));
+    bits = (bits & SignBit<uint64_t>()) != 0 ? ~bits : bits ^ SignBit<uint64_t>();
+    EncodeBigEndian<uint64_t>(bits, to);
+  }
 
-    // keys are equal
-    return true;
+  static void DecodeDecimal(const byte *const from, byte *const to) {
+    uint64_t bits = DecodeBigEndian<uint64_t>(from);
+    bits = (bits & SignBit<uint64_t>()) != 0 ? bits ^ SignBit<uint64_t>() : ~bits;
+    std::memcpy(to, &bits, sizeof(uint64_t));
   }
 
- private:
-  ProjectedRow *GetProjectedRow() {
-    auto *pr = reinterpret_cast<ProjectedRow *>(StorageUtil::AlignedPtr(sizeof(uint64_t), key_data_));
-    TERRIER_ASSERT(reinterpret_cast<uintptr_t>(pr) % sizeof(uint64_t) == 0,
-                   "ProjectedRow must be aligned to 8 bytes for atomicity guarantees.");
-    TERRIER_ASSERT(reinterpret_cast<uintptr_t>(pr) + pr->Size() < reinterpret_cast<uintptr_t>(this) + KeySize,
-                   "ProjectedRow will access out of bounds.");
-    return pr;
+  static void EncodeVarlen(const byte *const from, byte *const to, const uint16_t slot_size) {
+    const auto varlen = *reinterpret_cast<const VarlenEntry *>(from);
+    const uint32_t max_size = slot_size - sizeof(uint32_t);
+    TERRIER_ASSERT(varlen.Size() <= max_size, "Varlen is larger than the key schema allows.");
+    std::memcpy(to, varlen.Content(), varlen.Size());
+    EncodeBigEndian<uint32_t>(varlen.Size(), to + max_size);
+  }
+
+  static void DecodeVarlen(const byte *const from, const uint16_t slot_size, byte *const to) {
+    const auto size = DecodeBigEndian<uint32_t>(from + slot_size - sizeof(uint32_t));
+    *reinterpret_cast<VarlenEntry *>(to) = size <= VarlenEntry::InlineThreshold()
+                                               ? VarlenEntry::CreateInline(from, size)
+                                               : VarlenEntry::Create(from, size, false);
+  }
+
+  static void EncodeAttribute(const type::TypeId type_id, const byte *const from, byte *const to,
+                              const uint16_t slot_size) {
+    switch (type_id) {
+      case type::TypeId::BOOLEAN:
+      case type::TypeId::TINYINT:
+        EncodeSigned<int8_t>(from, to);
+        break;
+      case type::TypeId::SMALLINT:
+        EncodeSigned<int16_t>(from, to);
+        break;
+      case type::TypeId::INTEGER:
+        EncodeSigned<int32_t>(from, to);
+        break;
+      case type::TypeId::DATE:
+        EncodeUnsigned<uint32_t>(from, to);
+        break;
+      case type::TypeId::BIGINT:
+        EncodeSigned<int64_t>(from, to);
+        break;
+      case type::TypeId::DECIMAL:
+        EncodeDecimal(from, to);
+        break;
+      case type::TypeId::TIMESTAMP:
+        EncodeUnsigned<uint64_t>(from, to);
+        break;
+      case type::TypeId::VARCHAR:
+      case type::TypeId::VARBINARY:
+        EncodeVarlen(from, to, slot_size);
+        break;
+      default:
+        throw std::runtime_error("Unknown TypeId in terrier::storage::index::GenericKey::EncodeAttribute.");
+    }
+  }
+
+  static void DecodeAttribute(const type::TypeId type_id, const byte *const from, const uint16_t slot_size,
+                              byte *const to) {
+    switch (type_id) {
+      case type::TypeId::BOOLEAN:
+      case type::TypeId::TINYINT:
+        DecodeSigned<int8_t>(from, to);
+        break;
+      case type::TypeId::SMALLINT:
+        DecodeSigned<int16_t>(from, to);
+        break;
+      case type::TypeId::INTEGER:
+        DecodeSigned<int32_t>(from, to);
+        break;
+      case type::TypeId::DATE:
+        DecodeUnsigned<uint32_t>(from, to);
+        break;
+      case type::TypeId::BIGINT:
+        DecodeSigned<int64_t>(from, to);
+        break;
+      case type::TypeId::DECIMAL:
+        DecodeDecimal(from, to);
+        break;
+      case type::TypeId::TIMESTAMP:
+        DecodeUnsigned<uint64_t>(from, to);
+        break;
+      case type::TypeId::VARCHAR:
+      case type::TypeId::VARBINARY:
+        DecodeVarlen(from, slot_size, to);
+        break;
+      default:
+        throw std::runtime_error("Unknown TypeId in terrier::storage::index::GenericKey::DecodeAttribute.");
+    }
   }
 
   byte key_data_[KeySize];
-  const IndexMetadata *metadata_ = nullptr;
 };
 
 extern template class GenericKey<64>;
@@ -280,27 +281,7 @@ struct hash<terrier::storage::index::GenericKey<KeySize>> {
    * @return hash of the key's underlying data
    */
   size_t operator()(terrier::storage::index::GenericKey<KeySize> const &key) const {
-    const auto &metadata = key.GetIndexMetadata();
-
-    const auto &key_schema = metadata.GetSchema();
-    const auto &inlined_attr_sizes = metadata.GetInlinedAttributeSizes();
-
-    uint64_t running_hash = 0;
-
-    const auto *const pr = key.GetProjectedRow();
-
-    const auto &key_cols = key_schema.GetColumns();
-    for (uint16_t i = 0; i < key_cols.size(); i++) {
-      const auto offset = static_cast<uint16_t>(pr->ColumnIds()[i]);
-      const byte *const attr = pr->AccessWithNullCheck(offset);
-      if (attr == nullptr) {
-        continue;
-      }
-
-      running_hash = XXH3_64bits_withSeed(reinterpret_cast<const void *>(attr), inlined_attr_sizes[i], running_hash);
-    }
-
-    return running_hash;
+    return XXH3_64bits(reinterpret_cast<const void *>(key.KeyData()), KeySize);
   }
 };
 
@@ -317,45 +298,7 @@ struct equal_to<terrier::storage::index::GenericKey<KeySize>> {
    */
   bool operator()(const terrier::storage::index::GenericKey<KeySize> &lhs,
                   const terrier::storage::index::GenericKey<KeySize> &rhs) const {
-    const auto &key_schema = lhs.GetIndexMetadata().GetSchema();
-
-    const auto &key_cols = key_schema.GetColumns();
-    for (uint16_t i = 0; i < key_cols.size(); i++) {
-      const auto *const lhs_pr = lhs.GetProjectedRow();
-      const auto *const rhs_pr = rhs.GetProjectedRow();
-
-      const auto offset = static_cast<uint16_t>(lhs_pr->ColumnIds()[i]);
-      TERRIER_ASSERT(lhs_pr->ColumnIds()[i] == rhs_pr->ColumnIds()[i], "Comparison orders should be the same.");
-
-      const byte *const lhs_attr = lhs_pr->AccessWithNullCheck(offset);
-      const byte *const rhs_attr = rhs_pr->AccessWithNullCheck(offset);
-
-      if (lhs_attr == nullptr) {
-        if (rhs_attr == nullptr) {
-          // attributes are both NULL (equal), continue
-          continue;
-        }
-        // lhs is NULL, rhs is non-NULL, return non-equal
-        return false;
-      }
-
-      if (rhs_attr == nullptr) {
-        // lhs is non-NULL, rhs is NULL, return non-equal
-        return false;
-      }
-
-      const terrier::type::TypeId type_id = key_schema.GetColumns()[i].Type();
-
-      if (!terrier::storage::index::GenericKey<KeySize>::TypeComparators::CompareEquals(type_id, lhs_attr, rhs_attr)) {
-        // one of the attrs didn't match, return non-equal
-        return false;
-      }
-
-      // attributes are equal, continue
-    }
-
-    // keys are equal
-    return true;
+    return std::memcmp(lhs.KeyData(), rhs.KeyData(), KeySize) == 0;
   }
 };
 
@@ -372,46 +315,7 @@ struct less<terrier::storage::index::GenericKey<KeySize>> {
    */
   bool operator()(const terrier::storage::index::GenericKey<KeySize> &lhs,
                   const terrier::storage::index::GenericKey<KeySize> &rhs) const {
-    const auto &key_schema = lhs.GetIndexMetadata().GetSchema();
-    const auto &key_cols = key_schema.GetColumns();
-
-    for (uint16_t i = 0; i < key_cols.size(); i++) {
-      const auto *const lhs_pr = lhs.GetProjectedRow();
-      const auto *const rhs_pr = rhs.GetProjectedRow();
-
-      const auto offset = static_cast<uint16_t>(lhs_pr->ColumnIds()[i]);
-      TERRIER_ASSERT(lhs_pr->ColumnIds()[i] == rhs_pr->ColumnIds()[i], "Comparison orders should be the same.");
-
-      const byte *const lhs_attr = lhs_pr->AccessWithNullCheck(offset);
-      const byte *const rhs_attr = rhs_pr->AccessWithNullCheck(offset);
-
-      if (lhs_attr == nullptr) {
-        if (rhs_attr == nullptr) {
-          // attributes are both NULL (equal), continue
-          continue;
-        }
-        // lhs is NULL, rhs is non-NULL, lhs is less than
-        return true;
-      }
-
-      if (rhs_attr == nullptr) {
-        // lhs is non-NULL, rhs is NULL, lhs is greater than
-        return false;
-      }
-
-      const terrier::type::TypeId type_id = key_schema.GetColumns()[i].Type();
-
-      if (terrier::storage::index::GenericKey<KeySize>::TypeComparators::CompareLessThan(type_id, lhs_attr, rhs_attr))
-        return true;
-      if (terrier::storage::index::GenericKey<KeySize>::TypeComparators::CompareGreaterThan(type_id, lhs_attr,
-                                                                                            rhs_attr))
-        return false;
-
-      // attributes are equal, continue
-    }
-
-    // keys are equal
-    return false;
+    return std::memcmp(lhs.KeyData(), rhs.KeyData(), KeySize) < 0;
   }
 };
 }  // namespace std
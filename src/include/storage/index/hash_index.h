@@ -3,18 +3,16 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
-#include <unordered_set>
 #include <utility>
-#include <variant>  // NOLINT (Matt): lint thinks this C++17 header is a C header because it only knows C++11
 #include <vector>
 
 #include "libcuckoo/cuckoohash_map.hh"
 #include "storage/index/index.h"
 #include "storage/index/index_defs.h"
+#include "storage/index/inline_multi_value.h"
 #include "transaction/deferred_action_manager.h"
 #include "transaction/transaction_context.h"
 #include "transaction/transaction_manager.h"
-#include "xxHash/xxh3.h"
 
 namespace terrier::storage::index {
 
@@ -29,9 +27,9 @@ constexpr uint16_t INITIAL_CUCKOOHASH_MAP_SIZE = 256;
 
 /**
  * Wrapper around libcuckoo's hash map. The MVCC is logic is similar to our reference index (BwTreeIndex). Much of the
- * logic here is related to the cuckoohash_map not being a multimap. We get around this by making the value type a
- * std::variant that can either be a TupleSlot if there's only a single value for a given key, or a std::unordered_set
- * of TupleSlots if a single key needs to map to multiple TupleSlots.
+ * logic here is related to the cuckoohash_map not being a multimap. We get around this by making the value type an
+ * InlineMultiValue, which stores the first few TupleSlots of a key inline and only spills to the heap for keys with
+ * more values than that.
  * @tparam KeyType the type of keys stored in the map
  */
 template <typename KeyType>
@@ -39,14 +37,12 @@ class HashIndex final : public Index {
   friend class IndexBuilder;
 
  private:
-  struct TupleSlotHash {
-    std::size_t operator()(const TupleSlot &slot) const {
-      return XXH3_64bits(reinterpret_cast<const void *>(&slot), sizeof(TupleSlot));
-    }
-  };
+  // Number of values a key holds before its values spill to the heap
+  static constexpr uint32_t K_INLINE_VALUES = 3;
+  // Number of lookups a batch prefetches ahead of the one it is performing
+  static constexpr uint32_t K_PREFETCH_DISTANCE = 8;
 
-  using ValueMap = std::unordered_set<TupleSlot, TupleSlotHash>;
-  using ValueType = std::variant<TupleSlot, ValueMap>;
+  using ValueType = InlineMultiValue<TupleSlot, K_INLINE_VALUES>;
 
   explicit HashIndex(IndexMetadata metadata)
       : Index(std::move(metadata)), hash_map_{new cuckoohash_map<KeyType, ValueType>(INITIAL_CUCKOOHASH_MAP_SIZE)} {}
@@ -61,25 +57,13 @@ class HashIndex final : public Index {
   [=]() {                                                                                                              \
     /* See the underlying container's API for more details, but the lambda below is invoked when the key is found. */  \
     auto key_found_fn = [location](ValueType &value) -> bool {                                                         \
-      if (std::holds_alternative<TupleSlot>(value)) {                                                                  \
-        /* It's just a TupleSlot, functor should return true for cuckoohash_map's uprase_fn to erase key/value pair */ \
+      if (value.Size() == 1) {                                                                                         \
+        /* It's the last value, functor should return true for cuckoohash_map's uprase_fn to erase key/value pair */  \
+        TERRIER_ASSERT(value.Contains(location), "Erasing a value that is not in the index.");                         \
         return true;                                                                                                   \
       }                                                                                                                \
-      auto &value_map = std::get<ValueMap>(value);                                                                     \
-      if (value_map.size() == 2) {                                                                                     \
-        /* functor should replace the ValueMap with a TupleSlot for the other location */                              \
-        for (const auto i : value_map) {                                                                               \
-          if (i != location) {                                                                                         \
-            value = i; /* Assigning TupleSlot type will change the std::variant to TupleSlot and free the ValueMap */  \
-            TERRIER_ASSERT(std::holds_alternative<TupleSlot>(value), "value should now be a TupleSlot.");              \
-            return false; /* Return false so cuckoohash_map's uprase_fn doesn't erase key/value pair */                \
-          }                                                                                                            \
-        }                                                                                                              \
-      }                                                                                                                \
-      /* ValueMap contains more than 2 elements, erase location from the ValueMap */                                   \
-      const auto UNUSED_ATTRIBUTE erase_result = value_map.erase(location);                                            \
-      TERRIER_ASSERT(erase_result == 1, "Erasing from the ValueMap should not fail.");                                 \
-      TERRIER_ASSERT(value_map.size() > 1, "ValueMap should not have fewer than 2 elements.");                         \
+      const bool UNUSED_ATTRIBUTE erase_result = value.Erase(location);                                                \
+      TERRIER_ASSERT(erase_result, "Erasing from the values should not fail.");                                        \
       return false; /* Return false so cuckoohash_map's uprase_fn doesn't erase key/value pair */                      \
     };                                                                                                                 \
     const bool UNUSED_ATTRIBUTE uprase_result = hash_map_->uprase_fn(index_key, key_found_fn);                         \
@@ -112,16 +96,8 @@ class HashIndex final : public Index {
      * return true if cuckoohash_map's uprase_fn should delete the key/value pair. For inserts we always return false.
      */
     auto key_found_fn = [location, &insert_result](ValueType &value) -> bool {
-      if (std::holds_alternative<TupleSlot>(value)) {
-        // replace the TupleSlot with a ValueMap containing both the old and new inserted value
-        const auto existing_location = std::get<TupleSlot>(value);
-        value = ValueMap({{location}, {existing_location}}, 2);
-        insert_result = true;
-      } else {
-        // insert the location to the cuckoohash_map
-        auto &value_map = std::get<ValueMap>(value);
-        insert_result = value_map.emplace(location).second;
-      }
+      // add the location to the key's values
+      insert_result = value.Insert(location);
       return false;
     };
 
@@ -171,26 +147,14 @@ class HashIndex final : public Index {
      * return true if cuckoohash_map's uprase_fn should delete the key/value pair. For inserts we always return false.
      */
     auto key_found_fn = [location, &insert_result, &predicate_satisfied, predicate](ValueType &value) -> bool {
-      if (std::holds_alternative<TupleSlot>(value)) {
-        const auto existing_location = std::get<TupleSlot>(value);
-        predicate_satisfied = predicate(existing_location);
-        if (!predicate_satisfied) {
-          // replace the TupleSlot with a ValueMap containing both the old and new inserted value
-          value = ValueMap({{location}, {existing_location}}, 2);
-          insert_result = true;
-        }
-      } else {
-        auto &value_map = std::get<ValueMap>(value);
-
-        predicate_satisfied = std::any_of(value_map.cbegin(), value_map.cend(), predicate);
-
-        if (!predicate_satisfied) {
-          // insert the location to the cuckoohash_map
-          insert_result = value_map.emplace(location).second;
-          TERRIER_ASSERT(insert_result,
-                         " index shouldn't fail to insert after predicate check. If it did, something went wrong deep "
-                         "inside the hash map itself.");
-        }
+      predicate_satisfied = std::any_of(value.begin(), value.end(), predicate);
+
+      if (!predicate_satisfied) {
+        // add the location to the key's values
+        insert_result = value.Insert(location);
+        TERRIER_ASSERT(insert_result,
+                       " index shouldn't fail to insert after predicate check. If it did, something went wrong deep "
+                       "inside the hash map itself.");
       }
       return false;
     };
@@ -251,15 +215,8 @@ class HashIndex final : public Index {
      * key_found_fn)
      */
     auto key_found_fn = [value_list, &txn](const ValueType &value) -> void {
-      if (std::holds_alternative<TupleSlot>(value)) {
-        const auto existing_location = std::get<TupleSlot>(value);
-        if (IsVisible(txn, existing_location)) value_list->emplace_back(existing_location);
-      } else {
-        const auto &value_map = std::get<ValueMap>(value);
-
-        for (const auto i : value_map) {
-          if (IsVisible(txn, i)) value_list->emplace_back(i);
-        }
+      for (const auto i : value) {
+        if (IsVisible(txn, i)) value_list->emplace_back(i);
       }
     };
 
@@ -269,6 +226,49 @@ class HashIndex final : public Index {
                    "Invalid number of results for unique index.");
   }
 
+  std::unique_ptr<Cursor> OpenScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key) final {
+    // Build search key
+    KeyType index_key;
+    index_key.SetFromProjectedRow(key, metadata_, metadata_.GetSchema().GetColumns().size());
+
+    // Copy the values out under the bucket lock, visibility is checked as the cursor hands them out
+    std::vector<TupleSlot> results;
+    auto key_found_fn = [&results](const ValueType &value) -> void {
+      results.insert(results.end(), value.begin(), value.end());
+    };
+
+    hash_map_->find_fn(index_key, key_found_fn);
+    return std::make_unique<SlotListCursor>(txn, std::move(results));
+  }
+
+  void ScanKeyBatch(const transaction::TransactionContext &txn, const ProjectedRow *const *const keys,
+                    const uint32_t num_keys, std::vector<TupleSlot> *const value_list,
+                    std::vector<uint32_t> *const key_offsets) final {
+    const auto num_attrs = metadata_.GetSchema().GetColumns().size();
+    std::vector<KeyType> index_keys(num_keys);
+    for (uint32_t key_idx = 0; key_idx < num_keys; key_idx++) {
+      index_keys[key_idx].SetFromProjectedRow(*keys[key_idx], metadata_, num_attrs);
+    }
+
+    // Prefetch the buckets of each key a few lookups ahead, so that the cache misses of consecutive keys overlap
+    // instead of being paid one after the other
+    std::vector<TupleSlot> candidates;
+    std::vector<CandidateRange> ranges(num_keys);
+    for (uint32_t key_idx = 0; key_idx < std::min(num_keys, K_PREFETCH_DISTANCE); key_idx++) {
+      hash_map_->prefetch(index_keys[key_idx]);
+    }
+    for (uint32_t key_idx = 0; key_idx < num_keys; key_idx++) {
+      if (key_idx + K_PREFETCH_DISTANCE < num_keys) hash_map_->prefetch(index_keys[key_idx + K_PREFETCH_DISTANCE]);
+      const auto begin = static_cast<uint32_t>(candidates.size());
+      hash_map_->find_fn(index_keys[key_idx], [&candidates](const ValueType &value) -> void {
+        candidates.insert(candidates.end(), value.begin(), value.end());
+      });
+      ranges[key_idx] = {begin, static_cast<uint32_t>(candidates.size())};
+    }
+
+    GatherKeyBatch(txn, candidates, ranges, value_list, key_offsets);
+  }
+
 #undef ERASE_KEY_ACTION
 };
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -12,6 +16,15 @@
 #include "storage/storage_defs.h"
 #include "transaction/transaction_context.h"
 
+namespace terrier::storage {
+class SqlTable;
+struct TableWriteSet;
+}  // namespace terrier::storage
+
+namespace terrier::transaction {
+class TransactionManager;
+}  // namespace terrier::transaction
+
 namespace terrier::storage::index {
 
 enum ScanType : uint32_t {
@@ -31,6 +44,79 @@ enum ScanType : uint32_t {
  * modifying the underlying structure or returning results.
  */
 class Index {
+ public:
+  /**
+   * An open scan over the index that hands out its results a batch at a time, so callers only pay for the values they
+   * consume. Visibility is checked a batch at a time as values are handed out. A cursor must not outlive its index or
+   * the calling txn.
+   */
+  class Cursor {
+   public:
+    virtual ~Cursor() = default;
+
+    /**
+     * Fetches the next batch of values that are visible to the calling txn.
+     * @param[out] slots buffer to fill with values
+     * @param max_slots capacity of the buffer
+     * @return number of values written, 0 once the scan (or its limit) is exhausted
+     */
+    uint32_t Next(TupleSlot *slots, uint32_t max_slots);
+
+    /**
+     * Makes the cursor hold on to the keys of the values it returns, so that index-only scans can read them back with
+     * CopyKey instead of fetching the tuples. Must be called before the first call to Next.
+     */
+    void KeepKeys() { keep_keys_ = true; }
+
+    /**
+     * Copies out the key of a value returned by the last call to Next. Requires KeepKeys.
+     * @param idx position of the value in the last batch
+     * @param[out] key projected row built with the index's ProjectedRowInitializer. Varlens may point into the cursor
+     *             and are only valid until the next call to Next.
+     */
+    void CopyKey(const uint32_t idx, ProjectedRow *const key) const {
+      TERRIER_ASSERT(keep_keys_, "The cursor was not asked to keep its keys.");
+      CopyCandidateKey(visible_[idx], key);
+    }
+
+   protected:
+    /**
+     * @param txn txn context for the calling txn, used for visibility checks
+     * @param limit maximum number of visible values to return over the life of the cursor, 0 for no limit
+     */
+    Cursor(const transaction::TransactionContext &txn, const uint32_t limit) : txn_(txn), limit_(limit) {}
+
+    /**
+     * Fetches the next values in scan order without checking their visibility.
+     * @param[out] slots buffer to fill with values
+     * @param max_slots maximum number of values to write
+     * @return number of values written, 0 once the scan is exhausted
+     */
+    virtual uint32_t NextCandidates(TupleSlot *slots, uint32_t max_slots) = 0;
+
+    /**
+     * Copies out the key of a value returned by the last call to NextCandidates.
+     * @param candidate_idx position of the value in the last batch of candidates
+     * @param[out] key projected row built with the index's ProjectedRowInitializer
+     */
+    virtual void CopyCandidateKey(uint32_t candidate_idx, ProjectedRow *key) const {
+      TERRIER_ASSERT(false, "You called a method on a cursor type that hasn't implemented it.");
+    }
+
+    /**
+     * @return true if NextCandidates needs to hold on to the keys of the values it returns
+     */
+    bool KeepsKeys() const { return keep_keys_; }
+
+   private:
+    const transaction::TransactionContext &txn_;
+    const uint32_t limit_;
+    uint32_t num_returned_ = 0;
+    bool keep_keys_ = false;
+    // Positions of the visible values within the last batch of candidates
+    std::vector<uint32_t> visible_;
+  };
+
  private:
   friend class IndexKeyTests;
   friend class storage::RecoveryManager;
@@ -52,12 +138,144 @@ class Index {
     return data_table->IsVisible(txn, slot);
   }
 
+  /**
+   * Batched version of IsVisible. All slots must belong to the table this index is built on.
+   * @param txn the calling transaction
+   * @param slots the slots to check
+   * @param num_slots number of slots to check
+   * @param[out] visible positions of the visible slots, in ascending order
+   * @return number of visible slots
+   */
+  static uint32_t FilterVisible(const transaction::TransactionContext &txn, const TupleSlot *const slots,
+                                const uint32_t num_slots, uint32_t *const visible) {
+    if (num_slots == 0) return 0;
+    const auto *const data_table = slots[0].GetBlock()->data_table_;
+    return data_table->FilterVisible(txn, slots, num_slots, visible);
+  }
+
+  /**
+   * Cursor over values that were all looked up when the scan was opened, as for point lookups.
+   */
+  class SlotListCursor final : public Cursor {
+   public:
+    /**
+     * @param txn txn context for the calling txn, used for visibility checks
+     * @param slots the values to hand out, not yet checked for visibility
+     */
+    SlotListCursor(const transaction::TransactionContext &txn, std::vector<TupleSlot> &&slots)
+        : Cursor(txn, 0), slots_(std::move(slots)) {}
+
+   protected:
+    uint32_t NextCandidates(TupleSlot *const slots, const uint32_t max_slots) final {
+      const auto num_slots = static_cast<uint32_t>(std::min<size_t>(max_slots, slots_.size() - next_));
+      std::copy(slots_.cbegin() + next_, slots_.cbegin() + next_ + num_slots, slots);
+      next_ += num_slots;
+      return num_slots;
+    }
+
+   private:
+    const std::vector<TupleSlot> slots_;
+    size_t next_ = 0;
+  };
+
+  /**
+   * Drains a cursor into a vector, for the materializing scan methods.
+   * @param cursor the cursor to drain
+   * @param[out] value_list the values returned by the cursor
+   */
+  static void DrainCursor(Cursor *cursor, std::vector<TupleSlot> *value_list);
+
+  /**
+   * Positions [begin, end) of the values of one key of a batch lookup within the list of candidates
+   */
+  using CandidateRange = std::pair<uint32_t, uint32_t>;
+
+  /**
+   * Finishes a batch lookup by checking the visibility of all candidates at once, and laying out the visible values by
+   * key as ScanKeyBatch returns them.
+   * @param txn the calling transaction
+   * @param candidates the values of all keys of the batch in probe order, not yet checked for visibility
+   * @param ranges for each key in batch order, the range of its values in candidates. Repeated keys may share a range.
+   * @param[out] value_list the visible values, grouped by key in batch order
+   * @param[out] key_offsets ranges.size() + 1 offsets of the values of each key in value_list
+   */
+  static void GatherKeyBatch(const transaction::TransactionContext &txn, const std::vector<TupleSlot> &candidates,
+                             const std::vector<CandidateRange> &ranges, std::vector<TupleSlot> *value_list,
+                             std::vector<uint32_t> *key_offsets);
+
   /**
    * Creates a new index wrapper.
    * @param metadata index description
    */
   explicit Index(IndexMetadata metadata) : metadata_(std::move(metadata)) {}
 
+  /**
+   * Reads the index keys of tuples out of the table the index is built on. Keys are built by copying the indexed
+   * columns, so indexes on expressions are not supported.
+   */
+  class TableKeyReader {
+   public:
+    /**
+     * @param index the index to build keys for
+     * @param table the table the index is built on
+     */
+    TableKeyReader(const Index &index, common::ManagedPointer<SqlTable> table);
+
+    ~TableKeyReader() {
+      delete[] table_buffer_;
+      delete[] index_buffer_;
+    }
+
+    DISALLOW_COPY_AND_MOVE(TableKeyReader)
+
+    /**
+     * Reads the key of a tuple, as visible to the calling txn.
+     * @param txn the calling transaction, used for visibility
+     * @param slot the tuple to read
+     * @return true if the tuple is visible to txn and Key() has been set to its key, false otherwise
+     */
+    bool Read(common::ManagedPointer<transaction::TransactionContext> txn, TupleSlot slot);
+
+    /**
+     * @return the key of the tuple read last
+     */
+    const ProjectedRow &Key() const { return *index_pr_; }
+
+   private:
+    const Index &index_;
+    const common::ManagedPointer<SqlTable> table_;
+    ProjectionMap pr_map_;
+    byte *table_buffer_;
+    byte *index_buffer_;
+    ProjectedRow *table_pr_;
+    ProjectedRow *index_pr_;
+  };
+
+  /**
+   * Materializes the index key of every tuple in the given blocks that is visible to the calling txn.
+   * @param txn the calling transaction, used for visibility
+   * @param table the table being indexed
+   * @param blocks_begin first block to scan
+   * @param blocks_end one past the last block to scan
+   * @param key_fn invoked with the key and location of every visible tuple
+   * @param written if not null, the slots of the tuples written since txn's snapshot, visible or not, are added to it
+   */
+  void ScanTableKeys(common::ManagedPointer<transaction::TransactionContext> txn,
+                     common::ManagedPointer<SqlTable> table, std::vector<RawBlock *>::const_iterator blocks_begin,
+                     std::vector<RawBlock *>::const_iterator blocks_end,
+                     const std::function<void(const ProjectedRow &, TupleSlot)> &key_fn,
+                     TableWriteSet *written = nullptr) const;
+
+  /**
+   * Whether the index is still catching up with the writes that ran alongside its build, see BulkLoad
+   */
+  std::atomic<bool> building_ = false;
+
+  /**
+   * Whether the index holds every tuple it should, see IsValid
+   */
+  std::atomic<bool> valid_ = true;
+
  public:
   virtual ~Index() = default;
 
@@ -72,6 +290,12 @@ class Index {
    */
   virtual void PerformGarbageCollection() {}
 
+  /**
+   * @return number of nodes that have been unlinked from the index but not yet reclaimed by garbage collection. Index
+   * types that do not defer reclamation always report 0.
+   */
+  virtual uint64_t NumRetainedGarbageNodes() const { return 0; }
+
   /**
    * Inserts a new key-value pair into the index, used for non-unique key indexes.
    * @param txn txn context for the calling txn, used to register abort actions
@@ -93,6 +317,37 @@ class Index {
   virtual bool InsertUnique(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &tuple,
                             TupleSlot location) = 0;
 
+  /**
+   * Populates a newly built, still empty index with every tuple of the table that is visible to the calling txn. The
+   * index must not yet be reachable by other transactions, so implementations need not register abort actions: aborting
+   * the creating txn drops the index as a whole. The default implementation inserts keys one at a time.
+   *
+   * Transactions that began before the creating txn commits cannot see the index, so they write to the table without
+   * maintaining it. Given a txn manager, an implementation may catch up with those writes once they are all done, in a
+   * txn of its own, and report IsBuilding() until then, and !IsValid() from then on if it cannot index all of them. The
+   * default implementation does not catch up.
+   * @param txn txn context for the creating txn, used for visibility
+   * @param table the table the index is being built on
+   * @param txn_manager manager to begin the catch-up txn with, or DISABLED if no other txn writes to the table
+   * @return false if the index is unique and the table contains duplicate keys, true otherwise
+   */
+  virtual bool BulkLoad(common::ManagedPointer<transaction::TransactionContext> txn,
+                        common::ManagedPointer<SqlTable> table,
+                        common::ManagedPointer<transaction::TransactionManager> txn_manager);
+
+  /**
+   * @return true while the index may miss tuples written by transactions that ran alongside its build, so that it must
+   * not be used to find tuples yet. Transactions that can see the index must still maintain it.
+   */
+  bool IsBuilding() const { return building_.load(); }
+
+  /**
+   * @return false if catching up left the index without a committed tuple, which happens when a unique index finds
+   * that transactions that ran alongside its build wrote duplicate keys. Such an index must never be used to find
+   * tuples, and should be dropped. Transactions that can see it must still maintain it.
+   */
+  bool IsValid() const { return valid_.load(); }
+
   /**
    * Doesn't immediately call delete on the index. Registers a commit action in the txn that will eventually register a
    * deferred action for the GC to safely call delete on the index when no more transactions need to access the key.
@@ -112,6 +367,20 @@ class Index {
   virtual void ScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key,
                        std::vector<TupleSlot> *value_list) = 0;
 
+  /**
+   * Finds all the values associated with each key of a batch, as for the inner side of an index nested loop join.
+   * Index types override this to probe the keys in an order that shares work between lookups, and to check the
+   * visibility of all values at once. The default implementation looks up one key at a time.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param keys the keys to look for, which may repeat
+   * @param num_keys number of keys
+   * @param[out] value_list the values of all keys, grouped by key in the order of keys
+   * @param[out] key_offsets num_keys + 1 offsets into value_list, the values of keys[i] are at positions
+   *             [key_offsets[i], key_offsets[i + 1])
+   */
+  virtual void ScanKeyBatch(const transaction::TransactionContext &txn, const ProjectedRow *const *keys,
+                            uint32_t num_keys, std::vector<TupleSlot> *value_list, std::vector<uint32_t> *key_offsets);
+
   /**
    * Finds all the values between the given keys in our index, sorted in ascending order.
    * @param txn txn context for the calling txn, used for visibility checks
@@ -153,6 +422,46 @@ class Index {
     TERRIER_ASSERT(false, "You called a method on an index type that hasn't implemented it.");
   }
 
+  /**
+   * Opens a cursor over all the values associated with the given key.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param key the key to look for
+   * @return cursor over the values, which no longer depends on key
+   */
+  virtual std::unique_ptr<Cursor> OpenScanKey(const transaction::TransactionContext &txn, const ProjectedRow &key) = 0;
+
+  /**
+   * Opens a cursor over the values between the given keys, in ascending order.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param scan_type Scan Type
+   * @param num_attrs Number of attributes to compare
+   * @param low_key the key to start at
+   * @param high_key the key to end at
+   * @param limit maximum number of values to return, 0 for no limit
+   * @return cursor over the values, which no longer depends on the keys
+   */
+  virtual std::unique_ptr<Cursor> OpenScanAscending(const transaction::TransactionContext &txn, ScanType scan_type,
+                                                    uint32_t num_attrs, ProjectedRow *low_key, ProjectedRow *high_key,
+                                                    uint32_t limit) {
+    TERRIER_ASSERT(false, "You called a method on an index type that hasn't implemented it.");
+    return nullptr;
+  }
+
+  /**
+   * Opens a cursor over the values between the given keys, in descending order.
+   * @param txn txn context for the calling txn, used for visibility checks
+   * @param low_key the key to end at
+   * @param high_key the key to start at
+   * @param limit maximum number of values to return, 0 for no limit
+   * @return cursor over the values, which no longer depends on the keys
+   */
+  virtual std::unique_ptr<Cursor> OpenScanDescending(const transaction::TransactionContext &txn,
+                                                     const ProjectedRow &low_key, const ProjectedRow &high_key,
+                                                     uint32_t limit) {
+    TERRIER_ASSERT(false, "You called a method on an index type that hasn't implemented it.");
+    return nullptr;
+  }
+
   /**
    * @return mapping from key oid to projected row offset
    */
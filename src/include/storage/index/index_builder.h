@@ -4,6 +4,7 @@
 #include <vector>
 #include "catalog/catalog_defs.h"
 #include "catalog/index_schema.h"
+#include "storage/index/art_index.h"
 #include "storage/index/bwtree_index.h"
 #include "storage/index/compact_ints_key.h"
 #include "storage/index/generic_key.h"
@@ -49,6 +50,10 @@ class IndexBuilder {
         if (simple_key && metadata.KeySize() <= COMPACTINTSKEY_MAX_SIZE) return BuildBwTreeIntsKey(std::move(metadata));
         return BuildBwTreeGenericKey(std::move(metadata));
       }
+      case IndexType::ART: {
+        if (simple_key && metadata.KeySize() <= COMPACTINTSKEY_MAX_SIZE) return BuildArtIntsKey(std::move(metadata));
+        return BuildArtGenericKey(std::move(metadata));
+      }
       case IndexType::HASHMAP: {
         if (simple_key && metadata.KeySize() <= HASHKEY_MAX_SIZE) return BuildHashIntsKey(std::move(metadata));
         return BuildHashGenericKey(std::move(metadata));
@@ -88,13 +93,9 @@ class IndexBuilder {
 
   Index *BuildBwTreeGenericKey(IndexMetadata metadata) const {
     metadata.SetKeyKind(IndexKeyKind::GENERICKEY);
-    const auto pr_size = metadata.GetInlinedPRInitializer().ProjectedRowSize();
-    Index *index = nullptr;
-
-    const auto key_size =
-        (pr_size + 8) +
-        sizeof(uintptr_t);  // account for potential padding of the PR and the size of the pointer for metadata
+    const auto key_size = metadata.NormalizedKeySize();
     TERRIER_ASSERT(key_size <= GENERICKEY_MAX_SIZE, "Key size exceeds maximum for this key type.");
+    Index *index = nullptr;
 
     if (key_size <= 64) {
       index = new BwTreeIndex<GenericKey<64>>(std::move(metadata));
@@ -107,6 +108,40 @@ class IndexBuilder {
     return index;
   }
 
+  Index *BuildArtIntsKey(IndexMetadata metadata) const {
+    metadata.SetKeyKind(IndexKeyKind::COMPACTINTSKEY);
+    const auto key_size = metadata.KeySize();
+    TERRIER_ASSERT(key_size <= COMPACTINTSKEY_MAX_SIZE, "Key size exceeds maximum for this key type.");
+    Index *index = nullptr;
+    if (key_size <= 8) {
+      index = new ArtIndex<CompactIntsKey<8>>(std::move(metadata));
+    } else if (key_size <= 16) {
+      index = new ArtIndex<CompactIntsKey<16>>(std::move(metadata));
+    } else if (key_size <= 24) {
+      index = new ArtIndex<CompactIntsKey<24>>(std::move(metadata));
+    } else if (key_size <= 32) {
+      index = new ArtIndex<CompactIntsKey<32>>(std::move(metadata));
+    }
+    TERRIER_ASSERT(index != nullptr, "Failed to create an IntsKey index.");
+    return index;
+  }
+
+  Index *BuildArtGenericKey(IndexMetadata metadata) const {
+    metadata.SetKeyKind(IndexKeyKind::GENERICKEY);
+    const auto key_size = metadata.NormalizedKeySize();
+    TERRIER_ASSERT(key_size <= GENERICKEY_MAX_SIZE, "Key size exceeds maximum for this key type.");
+    Index *index = nullptr;
+    if (key_size <= 64) {
+      index = new ArtIndex<GenericKey<64>>(std::move(metadata));
+    } else if (key_size <= 128) {
+      index = new ArtIndex<GenericKey<128>>(std::move(metadata));
+    } else if (key_size <= 256) {
+      index = new ArtIndex<GenericKey<256>>(std::move(metadata));
+    }
+    TERRIER_ASSERT(index != nullptr, "Failed to create an GenericKey index.");
+    return index;
+  }
+
   Index *BuildHashIntsKey(IndexMetadata metadata) const {
     metadata.SetKeyKind(IndexKeyKind::HASHKEY);
     const auto key_size = metadata.KeySize();
@@ -131,13 +166,9 @@ class IndexBuilder {
 
   Index *BuildHashGenericKey(IndexMetadata metadata) const {
     metadata.SetKeyKind(IndexKeyKind::GENERICKEY);
-    const auto pr_size = metadata.GetInlinedPRInitializer().ProjectedRowSize();
+    const auto key_size = metadata.NormalizedKeySize();
+    TERRIER_ASSERT(key_size <= GENERICKEY_MAX_SIZE, "Key size exceeds maximum for this key type.");
     Index *index = nullptr;
-
-    const auto key_size =
-        (pr_size + 8) +
-        sizeof(uintptr_t);  // account for potential padding of the PR and the size of the pointer for metadata
-
     if (key_size <= 64) {
       index = new HashIndex<GenericKey<64>>(std::move(metadata));
     } else if (key_size <= 128) {
@@ -32,6 +32,7 @@ class IndexMetadata {
         key_oid_to_offset_(std::move(other.key_oid_to_offset_)),
         initializer_(std::move(other.initializer_)),
         inlined_initializer_(std::move(other.inlined_initializer_)),
+        normalized_attr_offsets_(std::move(other.normalized_attr_offsets_)),
         key_size_(other.key_size_),
         key_kind_(other.key_kind_) {}
 
@@ -50,6 +51,7 @@ class IndexMetadata {
             ProjectedRowInitializer::Create(GetRealAttrSizes(attr_sizes_), ComputePROffsets(inlined_attr_sizes_))),
         inlined_initializer_(
             ProjectedRowInitializer::Create(inlined_attr_sizes_, ComputePROffsets(inlined_attr_sizes_))),
+        normalized_attr_offsets_(ComputeNormalizedAttributeOffsets(key_schema_)),
         key_size_(ComputeKeySize(key_schema_)) {}
 
   /**
@@ -94,6 +96,17 @@ class IndexMetadata {
    */
   const ProjectedRowInitializer &GetInlinedPRInitializer() const { return inlined_initializer_; }
 
+  /**
+   * @return where each attribute's normalized encoding starts in a GenericKey (key schema order), followed by the end
+   * of the last attribute
+   */
+  const std::vector<uint16_t> &GetNormalizedAttributeOffsets() const { return normalized_attr_offsets_; }
+
+  /**
+   * @return number of bytes of a GenericKey's normalized encoding
+   */
+  uint16_t NormalizedKeySize() const { return normalized_attr_offsets_.back(); }
+
   /**
    * @return sum of attribute sizes, NOT inlined attribute sizes
    */
@@ -125,6 +138,7 @@ class IndexMetadata {
   std::unordered_map<catalog::indexkeycol_oid_t, uint16_t> key_oid_to_offset_;  // for execution layer
   ProjectedRowInitializer initializer_;                                         // user-facing initializer
   ProjectedRowInitializer inlined_initializer_;                                 // for GenericKey, internal only
+  std::vector<uint16_t> normalized_attr_offsets_;                               // for GenericKey
   uint16_t key_size_;                                                           // for IndexBuilder
   IndexKeyKind key_kind_;                                                       // for testing
 
@@ -184,6 +198,35 @@ class IndexMetadata {
     return inlined_attr_sizes;
   }
 
+  /**
+   * Computes where each attribute of a GenericKey's normalized encoding starts, plus the end of the last one. Every
+   * attribute takes a NULL indicator byte followed by its value: fixed-size types keep their size, and varlens take
+   * their maximum content size (at least what fits in a VarlenEntry) followed by 4 bytes of size.
+   * e.g.   if key_schema is {INTEGER, VARCHAR(20), TINYINT}
+   *        then offsets returned are {0, 5, 30, 32}
+   */
+  static std::vector<uint16_t> ComputeNormalizedAttributeOffsets(const catalog::IndexSchema &key_schema) {
+    std::vector<uint16_t> offsets;
+    const auto &key_cols = key_schema.GetColumns();
+    offsets.reserve(key_cols.size() + 1);
+    offsets.emplace_back(0);
+    for (const auto &key : key_cols) {
+      uint16_t value_size;
+      switch (key.Type()) {
+        case type::TypeId::VARBINARY:
+        case type::TypeId::VARCHAR:
+          value_size = static_cast<uint16_t>(
+              std::max(key.MaxVarlenSize(), static_cast<uint16_t>(VarlenEntry::InlineThreshold())) + sizeof(uint32_t));
+          break;
+        default:
+          value_size = type::TypeUtil::GetTypeSize(key.Type());
+          break;
+      }
+      offsets.emplace_back(static_cast<uint16_t>(offsets.back() + 1 + value_size));
+    }
+    return offsets;
+  }
+
   /**
    * Computes whether we need to manually inline varlen attributes, i.e. too big for VarlenEntry::CreateInline.
    */
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "common/macros.h"
+
+namespace terrier::storage::index {
+
+/**
+ * Compact set of values for a single key of a hash index, stored as an unordered array. The first InlineCapacity values
+ * live inside the object itself, so keys with few values never touch the allocator. Larger sets spill to a single
+ * contiguous heap array that grows geometrically, and move back inline once they shrink enough.
+ *
+ * Membership checks are linear scans, which beat hashing for the moderate fan-outs this is meant for. The container is
+ * not synchronized: the hash map serializes updates to a key under its bucket lock, and the container keeps that
+ * critical section short by allocating only when it spills or grows.
+ *
+ * @tparam T trivially copyable value type
+ * @tparam InlineCapacity number of values stored without a heap allocation
+ */
+template <typename T, uint32_t InlineCapacity>
+class InlineMultiValue {
+  static_assert(std::is_trivially_copyable_v<T>, "Values are copied around as raw bytes.");
+  static_assert(InlineCapacity > 0, "At least one value must fit inline.");
+
+ public:
+  /**
+   * Creates an empty set.
+   */
+  InlineMultiValue() : size_(0), capacity_(InlineCapacity) {}
+
+  /**
+   * @param value the first value of the key
+   */
+  explicit InlineMultiValue(const T value) : size_(1), capacity_(InlineCapacity) { inline_[0] = value; }
+
+  /**
+   * @param other the values to copy
+   */
+  InlineMultiValue(const InlineMultiValue &other) : size_(other.size_), capacity_(InlineCapacity) {
+    if (size_ > InlineCapacity) {
+      capacity_ = size_;
+      heap_ = new T[capacity_];
+    }
+    std::memcpy(Data(), other.Data(), size_ * sizeof(T));
+  }
+
+  /**
+   * @param other the values to take over, left empty
+   */
+  InlineMultiValue(InlineMultiValue &&other) noexcept { TakeFrom(&other); }
+
+  /**
+   * @param other the values to copy
+   * @return self-reference
+   */
+  InlineMultiValue &operator=(const InlineMultiValue &other) {
+    if (this != &other) {
+      InlineMultiValue copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  /**
+   * @param other the values to take over, left empty
+   * @return self-reference
+   */
+  InlineMultiValue &operator=(InlineMultiValue &&other) noexcept {
+    if (this != &other) {
+      if (!IsInline()) delete[] heap_;
+      TakeFrom(&other);
+    }
+    return *this;
+  }
+
+  ~InlineMultiValue() {
+    if (!IsInline()) delete[] heap_;
+  }
+
+  /**
+   * @return number of values
+   */
+  uint32_t Size() const { return size_; }
+
+  /**
+   * @return pointer to the first value
+   */
+  const T *begin() const { return Data(); }  // NOLINT for STL name compability
+
+  /**
+   * @return pointer one past the last value
+   */
+  const T *end() const { return Data() + size_; }  // NOLINT for STL name compability
+
+  /**
+   * @param value value to look for
+   * @return true if the value is in the set
+   */
+  bool Contains(const T value) const { return std::find(begin(), end(), value) != end(); }
+
+  /**
+   * Adds a value to the set.
+   * @param value value to add
+   * @return false if the value was already in the set
+   */
+  bool Insert(const T value) {
+    if (Contains(value)) return false;
+    if (size_ == capacity_) Reallocate(2 * capacity_);
+    Data()[size_++] = value;
+    return true;
+  }
+
+  /**
+   * Removes a value from the set. The last value takes its place, so the order of values is not stable.
+   * @param value value to remove
+   * @return false if the value was not in the set
+   */
+  bool Erase(const T value) {
+    T *const data = Data();
+    T *const it = std::find(data, data + size_, value);
+    if (it == data + size_) return false;
+    *it = data[--size_];
+    // Move back inline once the values fit again. The hysteresis keeps a set that hovers around the inline capacity
+    // from reallocating on every insert and erase.
+    if (!IsInline() && size_ <= InlineCapacity / 2) Reallocate(InlineCapacity);
+    return true;
+  }
+
+ private:
+  uint32_t size_;
+  // Equal to InlineCapacity while the values are inline, larger once they spilled to the heap
+  uint32_t capacity_;
+  union {
+    T inline_[InlineCapacity];
+    T *heap_;
+  };
+
+  bool IsInline() const { return capacity_ == InlineCapacity; }
+
+  T *Data() { return IsInline() ? inline_ : heap_; }
+
+  const T *Data() const { return IsInline() ? inline_ : heap_; }
+
+  void TakeFrom(InlineMultiValue *const other) {
+    size_ = other->size_;
+    capacity_ = other->capacity_;
+    if (other->IsInline()) {
+      std::memcpy(inline_, other->inline_, size_ * sizeof(T));
+    } else {
+      heap_ = other->heap_;
+    }
+    other->size_ = 0;
+    other->capacity_ = InlineCapacity;
+  }
+
+  void Reallocate(const uint32_t new_capacity) {
+    TERRIER_ASSERT(new_capacity >= size_, "Reallocation cannot drop values.");
+    T *const old_data = Data();
+    const bool was_inline = IsInline();
+    if (new_capacity == InlineCapacity) {
+      // Only reached when moving back from the heap
+      T *const heap = heap_;
+      std::memcpy(inline_, heap, size_ * sizeof(T));
+      delete[] heap;
+    } else {
+      T *const new_data = new T[new_capacity];
+      std::memcpy(new_data, old_data, size_ * sizeof(T));
+      if (!was_inline) delete[] old_data;
+      heap_ = new_data;
+    }
+    capacity_ = new_capacity;
+  }
+};
+
+}  // namespace terrier::storage::index
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <mutex>  // NOLINT
+#include <unordered_map>
+
+#include "catalog/catalog_defs.h"
+#include "common/macros.h"
+#include "common/managed_pointer.h"
+#include "common/shared_latch.h"
+#include "storage/index/index.h"
+
+namespace terrier::storage {
+
+/**
+ * Drives the reclamation of memory that indexes retire internally, e.g. the delta chains of a BwTree or the nodes of an
+ * ART, independently from the garbage collector's processing of version chains. Every index keeps its own epochs, so a
+ * pass collects all registered indexes concurrently. Passes themselves are serialized, since advancing the epochs of a
+ * single index is not thread-safe.
+ */
+class IndexGarbageCollector {
+ public:
+  IndexGarbageCollector() = default;
+
+  DISALLOW_COPY_AND_MOVE(IndexGarbageCollector)
+
+  /**
+   * Register an index to be periodically garbage collected
+   * @param index pointer to the index to register
+   * @param index_oid oid of the index in the catalog, only used to attribute metrics
+   */
+  void RegisterIndex(common::ManagedPointer<index::Index> index, catalog::index_oid_t index_oid);
+
+  /**
+   * Unregister an index to be periodically garbage collected. Blocks until a pass that might still be collecting the
+   * index has finished, so the index can be freed once this returns.
+   * @param index pointer to the index to unregister
+   */
+  void UnregisterIndex(common::ManagedPointer<index::Index> index);
+
+  /**
+   * Invokes garbage collection on every registered index, using all available cores. Records the garbage each index
+   * retains afterwards if garbage collection metrics are enabled on the calling thread.
+   * @return number of indexes collected
+   */
+  uint32_t PerformGarbageCollection();
+
+ private:
+  std::unordered_map<common::ManagedPointer<index::Index>, catalog::index_oid_t> indexes_;
+  common::SharedLatch indexes_latch_;
+  // Serializes passes, which would otherwise advance the same epochs from several threads
+  std::mutex collection_latch_;
+};
+
+}  // namespace terrier::storage
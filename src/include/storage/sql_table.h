@@ -1,11 +1,14 @@
 #pragma once
+#include <atomic>
 #include <list>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "catalog/schema.h"
+#include "common/spin_latch.h"
 #include "storage/data_table.h"
 #include "storage/projected_columns.h"
 #include "storage/projected_row.h"
@@ -21,6 +24,20 @@ class RandomSqlTableTransaction;
 
 namespace terrier::storage {
 
+/**
+ * Slots of the tuples written to a SqlTable while the set watches it. See SqlTable::WatchWrites.
+ */
+struct TableWriteSet {
+  /**
+   * Protects slots_
+   */
+  common::SpinLatch latch_;
+  /**
+   * Slots of the tuples that were inserted, updated or deleted
+   */
+  std::unordered_set<TupleSlot> slots_;
+};
+
 /**
  * A SqlTable is a thin layer above DataTable that replaces storage layer concepts like BlockLayout with SQL layer
  * concepts like Schema. The goal is to hide concepts like col_id_t and BlockLayout above the SqlTable level.
@@ -87,6 +104,8 @@ class SqlTable {
       // For MVCC correctness, this txn must now abort for the GC to clean up the version chain in the DataTable
       // correctly.
       txn->SetMustAbort();
+    } else {
+      RecordWrite(redo->GetTupleSlot());
     }
     return result;
   }
@@ -107,6 +126,7 @@ class SqlTable {
                    "immediately before?");
     const auto slot = table_.data_table_->Insert(txn, *(redo->Delta()));
     redo->SetTupleSlot(slot);
+    RecordWrite(slot);
     return slot;
   }
 
@@ -130,6 +150,8 @@ class SqlTable {
       // For MVCC correctness, this txn must now abort for the GC to clean up the version chain in the DataTable
       // correctly.
       txn->SetMustAbort();
+    } else {
+      RecordWrite(slot);
     }
     return result;
   }
@@ -151,6 +173,35 @@ class SqlTable {
     return table_.data_table_->Scan(txn, start_pos, out_buffer);
   }
 
+  /**
+   * Zero-copy alternative to Scan for tuples in FROZEN blocks. If the given iterator points into a frozen block, points
+   * the view at as many of the following tuples of that block as would fit into the given buffer, and mutates the
+   * iterator to point to one slot past them. The view may come back empty if the block has no tuples left.
+   *
+   * @param start_pos iterator to the starting location for the sequential scan
+   * @param projection buffer whose projection list and capacity the view follows. Its contents are not touched.
+   * @param[out] view view to point at the tuples. It must have been released.
+   * @return true if the view was pointed at the tuples, false if they have to be scanned
+   */
+  bool TryViewFrozen(DataTable::SlotIterator *const start_pos, const ProjectedColumns &projection,
+                     FrozenColumnsView *const view) const {
+    return table_.data_table_->TryViewFrozen(start_pos, projection, view);
+  }
+
+  /**
+   * Uses the zone maps of the block the given iterator points into to skip the rest of that block, if they show that
+   * none of its values of some column falls in the range the scan is looking for.
+   *
+   * @param start_pos iterator to the starting location for the sequential scan
+   * @param projection buffer whose projection list the ranges refer to. Its contents are not touched.
+   * @param ranges ranges every tuple of the scan has to fall in
+   * @return true if the rest of the block was skipped
+   */
+  bool TrySkipBlock(DataTable::SlotIterator *const start_pos, const ProjectedColumns &projection,
+                    const std::vector<DataTable::ZoneRange> &ranges) const {
+    return table_.data_table_->TrySkipBlock(start_pos, projection, ranges);
+  }
+
   /**
    * @return the first tuple slot contained in the underlying DataTable
    */
@@ -161,6 +212,26 @@ class SqlTable {
    */
   DataTable::SlotIterator end() const { return table_.data_table_->end(); }  // NOLINT for STL name compability
 
+  /**
+   * @return the blocks of the underlying DataTable, in allocation order
+   */
+  std::vector<RawBlock *> GetBlocks() const { return table_.data_table_->GetBlocks(); }
+
+  /**
+   * Starts adding the slot of every tuple that is inserted, updated or deleted from now on to the given set, so that an
+   * index built from a snapshot of the table can find the tuples written after the snapshot. A write that was under
+   * way when the set was added may go unrecorded, but it installed its version before this returns, so a scan started
+   * afterwards sees that version.
+   * @param writes set to add the written slots to, under its latch. It must be unwatched before it is freed.
+   */
+  void WatchWrites(TableWriteSet *writes);
+
+  /**
+   * Stops adding written slots to the given set. No write records to it once this returns.
+   * @param writes a set that watches this table
+   */
+  void UnwatchWrites(TableWriteSet *writes);
+
   /**
    * Generates an ProjectedColumnsInitializer for the execution layer to use. This performs the translation from col_oid
    * to col_id for the Initializer's constructor so that the execution layer doesn't need to know anything about col_id.
@@ -214,6 +285,21 @@ class SqlTable {
   // Eventually we'll support adding more tables when schema changes. For now we'll always access the one DataTable.
   DataTableVersion table_;
 
+  // Sets the written slots are added to, see WatchWrites. Writers only take the latch while there are any.
+  mutable common::SpinLatch watchers_latch_;
+  std::vector<TableWriteSet *> watchers_;
+  std::atomic<uint32_t> num_watchers_ = 0;
+
+  // Adds the slot of a tuple that was just written to every watching set
+  void RecordWrite(const TupleSlot slot) const {
+    if (num_watchers_.load() == 0) return;
+    common::SpinLatch::ScopedSpinLatch guard(&watchers_latch_);
+    for (auto *const writes : watchers_) {
+      common::SpinLatch::ScopedSpinLatch writes_guard(&writes->latch_);
+      writes->slots_.insert(slot);
+    }
+  }
+
   /**
    * Given a set of col_oids, return a vector of corresponding col_ids to use for ProjectionInitialization
    * @param col_oids set of col_oids, they must be in the table's ColumnMap
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <map>
 #include <ostream>
 #include <string>
 #include <string_view>  // NOLINT
@@ -165,15 +166,54 @@ class TupleSlot {
 };
 
 /**
- * Allocator that allocates a block
+ * Pages that a BlockAllocator maps its blocks from
+ */
+enum class BlockPageSize : uint8_t {
+  /** regular pages of the operating system */
+  DEFAULT = 0,
+  /** 2MB huge pages, falling back to transparent huge pages if none are reserved */
+  HUGE_2MB,
+  /** 1GB huge pages, falling back to transparent huge pages if none are reserved */
+  HUGE_1GB
+};
+
+/**
+ * Allocator that allocates a block. By default every block is a separate heap allocation. Configured with huge pages
+ * or NUMA awareness, blocks are instead carved out of large mapped chunks, which are faulted in as soon as they are
+ * mapped so that inserts never take page faults. In NUMA-aware mode every chunk is bound to the NUMA node of the thread
+ * that asked for a block, and blocks are handed out from, and given back to, the free list of that node.
  */
 class BlockAllocator {
  public:
+  /**
+   * Allocates blocks from the heap, one at a time and without any placement policy.
+   */
+  BlockAllocator() = default;
+
+  /**
+   * @param page_size pages to map blocks from
+   * @param numa_aware whether to place blocks on the NUMA node of the thread allocating them
+   */
+  BlockAllocator(BlockPageSize page_size, bool numa_aware) : page_size_(page_size), numa_aware_(numa_aware) {}
+
+  /**
+   * Unmaps all chunks. Blocks that were not deleted yet become invalid.
+   */
+  ~BlockAllocator();
+
+  DISALLOW_COPY(BlockAllocator)
+
+  /**
+   * Takes over the chunks of the given allocator
+   * @param other allocator to move from
+   */
+  BlockAllocator(BlockAllocator &&other) noexcept = default;
+
   /**
    * Allocates a new object by calling its constructor.
-   * @return a pointer to the allocated object.
+   * @return a pointer to the allocated object, nullptr if no memory could be mapped
    */
-  RawBlock *New() { return new RawBlock(); }
+  RawBlock *New() { return Mapped() ? NewMapped() : new RawBlock(); }
 
   /**
    * Reuse a reused chunk of memory to be handed out again
@@ -186,7 +226,73 @@ class BlockAllocator {
    * Deletes the object by calling its destructor.
    * @param ptr a pointer to the object to be deleted.
    */
-  void Delete(RawBlock *const ptr) { delete ptr; }
+  void Delete(RawBlock *const ptr) {
+    if (Mapped())
+      DeleteMapped(ptr);
+    else
+      delete ptr;
+  }
+
+  /**
+   * Maps and faults in chunks until at least the given number of blocks are free, spreading them evenly over the NUMA
+   * nodes in NUMA-aware mode. Does nothing if blocks come from the heap.
+   * @param num_blocks number of blocks to keep ready
+   * @return number of blocks that are ready to be handed out without mapping memory
+   */
+  uint64_t Reserve(uint64_t num_blocks);
+
+  /**
+   * @return number of mapped blocks that are ready to be handed out
+   */
+  uint64_t NumFreeBlocks() const;
+
+  /**
+   * @return whether blocks are carved out of mapped chunks rather than allocated from the heap
+   */
+  bool Mapped() const { return page_size_ != BlockPageSize::DEFAULT || numa_aware_; }
+
+  /**
+   * @return whether blocks are placed on the NUMA node of the thread allocating them
+   */
+  bool NumaAware() const { return numa_aware_; }
+
+  /**
+   * @param block block to look up. Its memory must have been touched.
+   * @return NUMA node the memory of the given block resides on, or -1 if it cannot be determined
+   */
+  static int32_t NumaNode(const RawBlock *block);
+
+  /**
+   * @return NUMA node of the cpu the calling thread is running on, or -1 if it cannot be determined
+   */
+  static int32_t CurrentNumaNode();
+
+  /**
+   * @return number of NUMA nodes this process may allocate memory on
+   */
+  static uint32_t NumNumaNodes();
+
+ private:
+  // Bookkeeping for one mapped region
+  struct Chunk {
+    uint64_t size_;
+    uint32_t node_;
+  };
+
+  BlockPageSize page_size_ = BlockPageSize::DEFAULT;
+  bool numa_aware_ = false;
+  // Mapped chunks, by start address. Chunks are only unmapped when the allocator goes away.
+  std::map<uintptr_t, Chunk> chunks_;
+  // Free blocks of the mapped chunks, per NUMA node (a single list if not NUMA-aware)
+  std::vector<std::vector<RawBlock *>> free_blocks_;
+
+  RawBlock *NewMapped();
+  void DeleteMapped(RawBlock *block);
+  // Maps, binds and faults in a new chunk and puts its blocks on the free list of the given node
+  bool MapChunk(uint32_t node);
+  // Node whose free list to use for the calling thread
+  uint32_t LocalNode() const;
+  std::vector<RawBlock *> &FreeList(uint32_t node);
 };
 
 /**
@@ -194,7 +300,57 @@ class BlockAllocator {
  * aligned, so we will need to use the default constructor instead of raw
  * malloc.
  */
-using BlockStore = common::ObjectPool<RawBlock, BlockAllocator>;
+class BlockStore : public common::ObjectPool<RawBlock, BlockAllocator> {
+ public:
+  /**
+   * Initializes a block store that allocates its blocks from the heap
+   * @param size_limit the maximum number of blocks the block store hands out
+   * @param reuse_limit the maximum number of released blocks kept for reuse
+   */
+  BlockStore(uint64_t size_limit, uint64_t reuse_limit) : ObjectPool(size_limit, reuse_limit) {}
+
+  /**
+   * Initializes a block store that maps its blocks according to the given policy. In NUMA-aware mode released blocks
+   * go straight back to the free list of their node instead of a shared reuse queue, so the reuse limit is ignored.
+   * @param size_limit the maximum number of blocks the block store hands out
+   * @param reuse_limit the maximum number of released blocks kept for reuse
+   * @param page_size pages to map blocks from
+   * @param numa_aware whether to place blocks on the NUMA node of the thread allocating them
+   * @param prefault_blocks number of blocks to map and fault in right away
+   */
+  BlockStore(uint64_t size_limit, uint64_t reuse_limit, BlockPageSize page_size, bool numa_aware,
+             uint64_t prefault_blocks)
+      : ObjectPool(size_limit, numa_aware ? 0 : reuse_limit, BlockAllocator(page_size, numa_aware)) {
+    Reserve(prefault_blocks);
+  }
+
+  /**
+   * Maps and faults in enough memory for the given number of blocks, so that allocating them later is cheap.
+   * @param num_blocks number of blocks to keep ready
+   * @return number of blocks ready to be handed out without mapping memory
+   */
+  uint64_t Reserve(const uint64_t num_blocks) {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    return alloc_.Reserve(num_blocks);
+  }
+
+  /**
+   * Groups the given blocks by the NUMA node their memory resides on, so that parallel scans can hand each range of
+   * blocks to threads running on the same node.
+   * @param blocks blocks to group, e.g. those of a DataTable
+   * @return one list of blocks per NUMA node, in the order they were given. Blocks whose node cannot be determined
+   *         go to node 0.
+   */
+  static std::vector<std::vector<RawBlock *>> GroupByNumaNode(const std::vector<RawBlock *> &blocks) {
+    std::vector<std::vector<RawBlock *>> result(BlockAllocator::NumNumaNodes());
+    for (RawBlock *const block : blocks) {
+      const auto node = static_cast<uint32_t>(std::max(BlockAllocator::NumaNode(block), 0));
+      if (node >= result.size()) result.resize(node + 1);
+      result[node].push_back(block);
+    }
+    return result;
+  }
+};
 /**
  * Used by SqlTable to map between col_oids in Schema and col_ids in BlockLayout
  */
@@ -244,12 +400,26 @@ class VarlenEntry {
   static VarlenEntry Create(const byte *content, uint32_t size, bool reclaim) {
     VarlenEntry result;
     TERRIER_ASSERT(size > InlineThreshold(), "small varlen values should be inlined");
+    TERRIER_ASSERT(size <= MaxSize(), "varlen value is too large");
     result.size_ = reclaim ? size : (INT32_MIN | size);  // the first bit denotes whether we can reclaim it
     std::memcpy(result.prefix_, content, sizeof(uint32_t));
     result.content_ = content;
     return result;
   }
 
+  /**
+   * Constructs a new reclaimable varlen entry whose content was allocated from a VarlenArena. The GC hands such content
+   * back to its arena chunk instead of deleting it.
+   * @param content pointer to the varlen content, allocated from a VarlenArena
+   * @param size length of the varlen content, in bytes (no C-style nul-terminator)
+   * @return constructed VarlenEntry object
+   */
+  static VarlenEntry CreateInArena(const byte *content, uint32_t size) {
+    VarlenEntry result = Create(content, size, true);
+    result.size_ |= ARENA_FLAG;
+    return result;
+  }
+
   /**
    * Constructs a new varlen entry, with the associated varlen value inlined within the struct itself. This is only
    * possible when the inlined value is smaller than InlineThreshold() as defined. The value is copied and the given
@@ -280,10 +450,15 @@ class VarlenEntry {
    */
   static constexpr uint32_t PrefixSize() { return sizeof(uint32_t); }
 
+  /**
+   * @return The maximum size of a varlen value, in bytes (1GB, as in Postgres)
+   */
+  static constexpr uint32_t MaxSize() { return ARENA_FLAG - 1; }
+
   /**
    * @return size of the varlen value stored in this entry, in bytes.
    */
-  uint32_t Size() const { return static_cast<uint32_t>(INT32_MAX & size_); }
+  uint32_t Size() const { return static_cast<uint32_t>(MaxSize() & size_); }
 
   /**
    * @return whether the content is inlined or not.
@@ -299,6 +474,11 @@ class VarlenEntry {
     return size_ > static_cast<int32_t>(InlineThreshold());
   }
 
+  /**
+   * @return whether the content was allocated from a VarlenArena, and has to be given back to it to be reclaimed
+   */
+  bool IsInArena() const { return (size_ & ARENA_FLAG) != 0; }
+
   /**
    * @return pointer to the stored prefix of the varlen entry
    */
@@ -363,6 +543,9 @@ class VarlenEntry {
   }
 
  private:
+  // The second bit of the size marks content allocated from a VarlenArena
+  static constexpr int32_t ARENA_FLAG = 1 << 30;
+
   int32_t size_;                   // buffer reclaimable => sign bit is 0 or size <= InlineThreshold
   byte prefix_[sizeof(uint32_t)];  // Explicit padding so that we can use these bits for inlined values or prefix
   const byte *content_;            // pointer to content of the varlen entry if not inlined
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+
+#include "common/macros.h"
+#include "common/strong_typedef.h"
+#include "storage/storage_defs.h"
+
+namespace terrier::storage {
+
+/**
+ * A VarlenArena hands out the content of the varlen values a single transaction writes. Content is bump-allocated from
+ * large chunks, rather than being allocated (and later deleted by the GC) one value at a time. Each chunk counts the
+ * values in it that have not been reclaimed yet, plus one reference held by the arena while it is still allocating from
+ * the chunk. Once the arena goes away together with its transaction, a chunk is owned by the values in it, and the last
+ * one the GC or the BlockCompactor reclaims frees the whole chunk.
+ *
+ * Allocating is not thread-safe, as a transaction only runs on one thread. Reclaiming may happen from any thread.
+ */
+class VarlenArena {
+ public:
+  /**
+   * Size of the chunks content is allocated from. Chunks are aligned to their size, so that the chunk of a value can
+   * be found from its content pointer.
+   */
+  static constexpr uint32_t CHUNK_SIZE = 1 << 16;
+
+  /**
+   * Values larger than this are allocated by themselves, so that a single large value does not waste most of a chunk
+   */
+  static constexpr uint32_t MAX_ARENA_VALUE_SIZE = CHUNK_SIZE / 8;
+
+  /**
+   * Constructs an empty arena. No memory is allocated until the first value is.
+   */
+  VarlenArena() = default;
+
+  /**
+   * Gives up the arena's reference to the chunk it is allocating from. Values already handed out stay valid.
+   */
+  ~VarlenArena() {
+    if (chunk_ != nullptr) Release(chunk_);
+  }
+
+  DISALLOW_COPY_AND_MOVE(VarlenArena)
+
+  /**
+   * Copies the given varlen value into memory owned by the arena, or inlines it if it is small enough. Values too large
+   * for the arena are copied into a buffer of their own, as if allocated outside of the arena.
+   * @param content content of the varlen value
+   * @param size length of the varlen value, in bytes
+   * @return reclaimable varlen entry holding a copy of the value
+   */
+  VarlenEntry Copy(const byte *content, uint32_t size);
+
+  /**
+   * Reclaims the content of the given varlen entry, which must be reclaimable. Content from an arena is given back to
+   * its chunk, and all other content is deleted.
+   * @param entry varlen entry whose content is no longer visible to any transaction
+   */
+  static void Deallocate(const VarlenEntry &entry) {
+    TERRIER_ASSERT(entry.NeedReclaim(), "Only reclaimable varlen entries can be deallocated");
+    if (entry.IsInArena())
+      Release(ChunkOf(entry.Content()));
+    else
+      delete[] entry.Content();
+  }
+
+  /**
+   * @return number of chunks this arena has allocated from so far
+   */
+  uint32_t NumChunks() const { return num_chunks_; }
+
+ private:
+  // Header at the start of every chunk
+  struct alignas(8) Chunk {
+    std::atomic<uint32_t> num_references_;
+  };
+
+  static Chunk *ChunkOf(const byte *content) {
+    return reinterpret_cast<Chunk *>(reinterpret_cast<uintptr_t>(content) & ~static_cast<uintptr_t>(CHUNK_SIZE - 1));
+  }
+
+  static void Release(Chunk *chunk);
+
+  // Chunk currently allocated from, and the offset in it of the next free byte
+  Chunk *chunk_ = nullptr;
+  uint32_t offset_ = CHUNK_SIZE;
+  uint32_t num_chunks_ = 0;
+};
+
+}  // namespace terrier::storage
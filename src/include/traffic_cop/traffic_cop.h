@@ -42,16 +42,19 @@ class TrafficCop {
    * @param replication_log_provider if given, the tcop will forward replication logs to this provider
    * @param stats_storage for optimizer calls
    * @param optimizer_timeout for optimizer calls
+   * @param optimizer_num_threads for optimizer calls
    */
   TrafficCop(common::ManagedPointer<transaction::TransactionManager> txn_manager,
              common::ManagedPointer<catalog::Catalog> catalog,
              common::ManagedPointer<storage::ReplicationLogProvider> replication_log_provider,
-             common::ManagedPointer<optimizer::StatsStorage> stats_storage, uint64_t optimizer_timeout)
+             common::ManagedPointer<optimizer::StatsStorage> stats_storage, uint64_t optimizer_timeout,
+             uint32_t optimizer_num_threads = 1)
       : txn_manager_(txn_manager),
         catalog_(catalog),
         replication_log_provider_(replication_log_provider),
         stats_storage_(stats_storage),
-        optimizer_timeout_(optimizer_timeout) {}
+        optimizer_timeout_(optimizer_timeout),
+        optimizer_num_threads_(optimizer_num_threads) {}
 
   virtual ~TrafficCop() = default;
 
@@ -151,6 +154,7 @@ class TrafficCop {
   common::ManagedPointer<storage::ReplicationLogProvider> replication_log_provider_;
   common::ManagedPointer<optimizer::StatsStorage> stats_storage_;
   uint64_t optimizer_timeout_;
+  uint32_t optimizer_num_threads_;
 };
 
 }  // namespace terrier::trafficcop
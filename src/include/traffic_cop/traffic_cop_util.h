@@ -46,13 +46,15 @@ class TrafficCopUtil {
    * @param stats_storage used by optimizer
    * @param cost_model used by optimizer
    * @param optimizer_timeout used by optimizer
+   * @param optimizer_num_threads used by optimizer
    * @return physical plan that can be executed
    */
   static std::unique_ptr<planner::AbstractPlanNode> Optimize(
       common::ManagedPointer<transaction::TransactionContext> txn,
       common::ManagedPointer<catalog::CatalogAccessor> accessor, common::ManagedPointer<parser::ParseResult> query,
       catalog::db_oid_t db_oid, common::ManagedPointer<optimizer::StatsStorage> stats_storage,
-      std::unique_ptr<optimizer::AbstractCostModel> cost_model, uint64_t optimizer_timeout);
+      std::unique_ptr<optimizer::AbstractCostModel> cost_model, uint64_t optimizer_timeout,
+      uint32_t optimizer_num_threads = 1);
 
   /**
    * Converts parser statement types (which rely on multiple enums) to a single QueryType enum from the network layer
@@ -88,6 +88,7 @@ class DeferredActionManager {
     for (int i = 0; i < MIN_GC_INVOCATIONS; i++) {
       if (log_manager != DISABLED) log_manager->ForceFlush();
       gc->PerformGarbageCollection();
+      gc->GetIndexGarbageCollector()->PerformGarbageCollection();
     }
   }
 
@@ -10,6 +10,7 @@
 #include "storage/storage_defs.h"
 #include "storage/tuple_access_strategy.h"
 #include "storage/undo_record.h"
+#include "storage/varlen_arena.h"
 #include "storage/write_ahead_log/log_record.h"
 #include "transaction/transaction_util.h"
 
@@ -58,7 +59,7 @@ class TransactionContext {
    * DataTable.
    */
   ~TransactionContext() {
-    for (const byte *ptr : loose_ptrs_) delete[] ptr;
+    for (const storage::VarlenEntry &varlen : loose_varlens_) storage::VarlenArena::Deallocate(varlen);
   }
 
   /**
@@ -152,11 +153,23 @@ class TransactionContext {
     storage::DeleteRecord::Initialize(redo_buffer_.NewEntry(size), start_time_, db_oid, table_oid, slot);
   }
 
-  // TODO(Tianyu): We need to discuss what happens to the loose_ptrs field now that we have deferred actions.
+  /**
+   * Copies a varlen value that is about to be written into a table into memory owned by this transaction. Values are
+   * packed into the chunks of a per-transaction arena, which the GC reclaims whole once none of their values are
+   * visible anymore, rather than being allocated and reclaimed one at a time.
+   * @param content content of the varlen value
+   * @param size length of the varlen value, in bytes
+   * @return reclaimable varlen entry holding a copy of the value
+   */
+  storage::VarlenEntry CopyVarlen(const byte *const content, const uint32_t size) {
+    return varlen_arena_.Copy(content, size);
+  }
+
+  // TODO(Tianyu): We need to discuss what happens to the loose_varlens field now that we have deferred actions.
   /**
    * @return whether the transaction is read-only
    */
-  bool IsReadOnly() const { return undo_buffer_.Empty() && loose_ptrs_.empty(); }
+  bool IsReadOnly() const { return undo_buffer_.Empty() && loose_varlens_.empty(); }
 
   /**
    * Defers an action to be called if and only if the transaction aborts.  Actions executed LIFO.
@@ -218,7 +231,9 @@ class TransactionContext {
   storage::RedoBuffer redo_buffer_;
   // TODO(Tianyu): Maybe not so much of a good idea to do this. Make explicit queue in GC?
   //
-  std::vector<const byte *> loose_ptrs_;
+  std::vector<storage::VarlenEntry> loose_varlens_;
+  // Memory for the varlen values written by this transaction
+  storage::VarlenArena varlen_arena_;
 
   // These actions will be triggered (not deferred) at abort/commit.
   std::forward_list<TransactionEndAction> abort_actions_;
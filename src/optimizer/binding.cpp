@@ -26,7 +26,7 @@ bool GroupBindingIterator::HasNext() {
   if (current_iterator_ == nullptr) {
     // Keep checking item iterators until we find a match
     while (current_item_index_ < num_group_items_) {
-      auto gexpr = target_group_->GetLogicalExpressions()[current_item_index_];
+      auto gexpr = group_items_[current_item_index_];
       auto gexpr_it = new GroupExprBindingIterator(memo_, gexpr, pattern_);
       current_iterator_.reset(gexpr_it);
 
@@ -107,9 +107,22 @@ void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const RightNLJoin *op) {}
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const OuterNLJoin *op) {}
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const InnerHashJoin *op) { DeriveForJoin(); }
 
-void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) {}
-void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) {}
-void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {}
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) { DeriveForJoin(false); }
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) { DeriveForJoin(false); }
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) { DeriveForJoin(false); }
+
+void ChildPropertyDeriver::Visit(const InnerMergeJoin *op) {
+  // Each child must provide sort for its join keys. The right child streams through the join, so that the output
+  // keeps its order.
+  std::vector<OrderByOrderingType> left_ascending(op->GetLeftKeys().size(), OrderByOrderingType::ASC);
+  std::vector<OrderByOrderingType> right_ascending(op->GetRightKeys().size(), OrderByOrderingType::ASC);
+
+  auto left_prop_set =
+      new PropertySet(std::vector<Property *>{new PropertySort(op->GetLeftKeys(), std::move(left_ascending))});
+  auto right_prop_set =
+      new PropertySet(std::vector<Property *>{new PropertySort(op->GetRightKeys(), std::move(right_ascending))});
+  output_.emplace_back(right_prop_set->Copy(), std::vector<PropertySet *>{left_prop_set, right_prop_set});
+}
 
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const Insert *op) {
   std::vector<PropertySet *> child_input_properties;
@@ -145,8 +158,9 @@ void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const ExportExternalFile *op)
   output_.emplace_back(requirements_->Copy(), std::move(child_input_properties));
 }
 
-void ChildPropertyDeriver::DeriveForJoin() {
+void ChildPropertyDeriver::DeriveForJoin(const bool keeps_probe_order) {
   output_.emplace_back(new PropertySet(), std::vector<PropertySet *>{new PropertySet(), new PropertySet()});
+  if (!keeps_probe_order) return;
 
   // If there is sort property and all the sort columns are from the probe
   // table (currently right table), we can push down the sort property
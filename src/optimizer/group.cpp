@@ -19,6 +19,7 @@ Group::~Group() {
 }
 
 void Group::EraseLogicalExpression() {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
   TERRIER_ASSERT(logical_expressions_.size() == 1, "There should exist only 1 logical expression");
   TERRIER_ASSERT(physical_expressions_.empty(), "No physical expressions should be present");
   delete logical_expressions_[0];
@@ -28,6 +29,7 @@ void Group::EraseLogicalExpression() {
 void Group::AddExpression(GroupExpression *expr, bool enforced) {
   // Do duplicate detection
   expr->SetGroupID(id_);
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
   if (enforced)
     enforced_exprs_.push_back(expr);
   else if (expr->Op().IsPhysical())
@@ -40,6 +42,7 @@ bool Group::SetExpressionCost(GroupExpression *expr, double cost, PropertySet *p
   OPTIMIZER_LOG_TRACE("Adding expression cost on group {0} with op {1}", expr->GetGroupID(),
                       expr->Op().GetName().c_str());
 
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
   auto it = lowest_cost_expressions_.find(properties);
   if (it == lowest_cost_expressions_.end()) {
     // not exist so insert
@@ -59,6 +62,7 @@ bool Group::SetExpressionCost(GroupExpression *expr, double cost, PropertySet *p
 }
 
 GroupExpression *Group::GetBestExpression(PropertySet *properties) {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
   auto it = lowest_cost_expressions_.find(properties);
   if (it != lowest_cost_expressions_.end()) {
     return std::get<1>(it->second);
@@ -68,8 +72,35 @@ GroupExpression *Group::GetBestExpression(PropertySet *properties) {
 }
 
 bool Group::HasExpressions(PropertySet *properties) const {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
   const auto &it = lowest_cost_expressions_.find(properties);
   return (it != lowest_cost_expressions_.end());
 }
 
+bool Group::StartOptimizing(PropertySet *properties, OptimizerTask *waiter, bool *explore) {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
+  auto it = optimizing_.find(properties);
+  // Until the group is explored, its physical expressions are incomplete for any properties
+  if (it == optimizing_.end() && exploring_ != nullptr) it = optimizing_.find(exploring_);
+  if (it != optimizing_.end()) {
+    it->second.push_back(waiter);
+    return false;
+  }
+
+  optimizing_.emplace(properties, std::vector<OptimizerTask *>());
+  *explore = !has_explored_.exchange(true);
+  if (*explore) exploring_ = properties;
+  return true;
+}
+
+std::vector<OptimizerTask *> Group::FinishOptimizing(PropertySet *properties) {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
+  auto it = optimizing_.find(properties);
+  TERRIER_ASSERT(it != optimizing_.end(), "Group is not being optimized for the properties");
+  auto waiters = std::move(it->second);
+  optimizing_.erase(it);
+  if (exploring_ == properties) exploring_ = nullptr;
+  return waiters;
+}
+
 }  // namespace terrier::optimizer
@@ -10,6 +10,7 @@ namespace terrier::optimizer {
 
 void GroupExpression::SetLocalHashTable(PropertySet *output_properties,
                                         std::vector<PropertySet *> input_properties_list, double cost) {
+  common::SpinLatch::ScopedSpinLatch guard(&latch_);
   auto it = lowest_cost_table_.find(output_properties);
   if (it == lowest_cost_table_.end()) {
     // No other cost to compare against
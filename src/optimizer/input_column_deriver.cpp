@@ -144,17 +144,13 @@ void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const OuterNLJoin *op) {
 
 void InputColumnDeriver::Visit(const InnerHashJoin *op) { JoinHelper(op); }
 
-void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) {
-  TERRIER_ASSERT(0, "LeftHashJoin not supported");
-}
+void InputColumnDeriver::Visit(const LeftHashJoin *op) { JoinHelper(op); }
 
-void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) {
-  TERRIER_ASSERT(0, "RightHashJoin not supported");
-}
+void InputColumnDeriver::Visit(const RightHashJoin *op) { JoinHelper(op); }
 
-void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {
-  TERRIER_ASSERT(0, "OuterHashJoin not supported");
-}
+void InputColumnDeriver::Visit(const OuterHashJoin *op) { JoinHelper(op); }
+
+void InputColumnDeriver::Visit(const InnerMergeJoin *op) { JoinHelper(op); }
 
 void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const Insert *op) {
   auto input = std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>{};
@@ -293,6 +289,26 @@ void InputColumnDeriver::JoinHelper(const BaseOperatorNodeContents *op) {
     join_conds = join_op->GetJoinPredicates();
     left_keys = join_op->GetLeftKeys();
     right_keys = join_op->GetRightKeys();
+  } else if (op->GetType() == OpType::LEFTHASHJOIN) {
+    auto join_op = reinterpret_cast<const LeftHashJoin *>(op);
+    join_conds = join_op->GetJoinPredicates();
+    left_keys = join_op->GetLeftKeys();
+    right_keys = join_op->GetRightKeys();
+  } else if (op->GetType() == OpType::RIGHTHASHJOIN) {
+    auto join_op = reinterpret_cast<const RightHashJoin *>(op);
+    join_conds = join_op->GetJoinPredicates();
+    left_keys = join_op->GetLeftKeys();
+    right_keys = join_op->GetRightKeys();
+  } else if (op->GetType() == OpType::OUTERHASHJOIN) {
+    auto join_op = reinterpret_cast<const OuterHashJoin *>(op);
+    join_conds = join_op->GetJoinPredicates();
+    left_keys = join_op->GetLeftKeys();
+    right_keys = join_op->GetRightKeys();
+  } else if (op->GetType() == OpType::INNERMERGEJOIN) {
+    auto join_op = reinterpret_cast<const InnerMergeJoin *>(op);
+    join_conds = join_op->GetJoinPredicates();
+    left_keys = join_op->GetLeftKeys();
+    right_keys = join_op->GetRightKeys();
   } else if (op->GetType() == OpType::INNERNLJOIN) {
     auto join_op = reinterpret_cast<const InnerNLJoin *>(op);
     join_conds = join_op->GetJoinPredicates();
@@ -0,0 +1,211 @@
+#include "optimizer/join_enumerator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "optimizer/cost_model/default_cost_model.h"
+
+namespace terrier::optimizer {
+
+namespace {
+// Calls the given function on every non-empty subset of the given set, in increasing order. Subsets thus come before
+// their supersets, which DPccp relies on to find the best plans of the inputs of a join before costing the join.
+template <typename Function>
+void ForEachSubset(const uint64_t set, const Function &function) {
+  for (uint64_t subset = set & (~set + 1); subset != 0; subset = (subset - set) & set) function(subset);
+}
+}  // namespace
+
+uint32_t JoinEnumerator::AddRelation(const double num_rows) {
+  TERRIER_ASSERT(plans_.size() < MAX_RELATIONS, "Too many relations to join");
+  const auto idx = static_cast<uint32_t>(plans_.size());
+  plans_.push_back(Plan{Bit(idx), NO_PLAN, NO_PLAN, {}, num_rows, 0});
+  adjacent_.push_back(0);
+  return idx;
+}
+
+void JoinEnumerator::AddPredicate(const uint64_t relations, const bool equi_join) {
+  predicates_.push_back(Predicate{relations, equi_join});
+}
+
+uint32_t JoinEnumerator::Enumerate() {
+  TERRIER_ASSERT(!plans_.empty(), "Nothing to join");
+  const auto num_relations = static_cast<uint32_t>(plans_.size());
+  const uint64_t all_relations = num_relations == MAX_RELATIONS ? ~uint64_t{0} : Bit(num_relations) - 1;
+  for (auto &predicate : predicates_) {
+    TERRIER_ASSERT((predicate.relations_ & ~all_relations) == 0, "Predicate refers to an unknown relation");
+    if (predicate.relations_ == 0) predicate.relations_ = all_relations;
+    // Only predicates over exactly two relations are edges of the join graph
+    const uint64_t relations = predicate.relations_;
+    if (IsSingleton(relations) || !IsSingleton(relations & (relations - 1))) continue;
+    const auto first = static_cast<uint32_t>(__builtin_ctzll(relations));
+    const auto second = static_cast<uint32_t>(__builtin_ctzll(relations & (relations - 1)));
+    adjacent_[first] |= Bit(second);
+    adjacent_[second] |= Bit(first);
+  }
+
+  std::vector<uint32_t> inputs;
+  if (IsExhaustive()) {
+    LabelBreadthFirst();
+    EnumerateConnectedSubgraphs();
+    for (const uint64_t component : components_) inputs.push_back(best_plans_.at(component));
+  } else {
+    for (uint32_t idx = 0; idx < num_relations; idx++) inputs.push_back(idx);
+  }
+  return JoinGreedily(std::move(inputs));
+}
+
+JoinEnumerator::Plan JoinEnumerator::Join(const uint32_t left, const uint32_t right) const {
+  const Plan &left_plan = plans_[left];
+  const Plan &right_plan = plans_[right];
+  Plan plan{left_plan.relations_ | right_plan.relations_, left, right, {}, left_plan.num_rows_ * right_plan.num_rows_,
+            0};
+  for (uint32_t idx = 0; idx < predicates_.size(); idx++) {
+    const Predicate &predicate = predicates_[idx];
+    if (!IsApplied(predicate, plan.relations_) || IsApplied(predicate, left_plan.relations_) ||
+        IsApplied(predicate, right_plan.relations_))
+      continue;
+    plan.predicates_.push_back(idx);
+    // Same estimate as the StatsCalculator makes for the join conditions of a LogicalInnerJoin
+    if (predicate.equi_join_) plan.num_rows_ /= std::max({left_plan.num_rows_, right_plan.num_rows_, 1.0});
+  }
+  plan.cost_ = left_plan.cost_ + right_plan.cost_ +
+               DefaultCostModel::HashJoinCost(left_plan.num_rows_, right_plan.num_rows_);
+  return plan;
+}
+
+bool JoinEnumerator::Connects(const uint32_t left, const uint32_t right) const {
+  const uint64_t left_relations = plans_[left].relations_;
+  const uint64_t right_relations = plans_[right].relations_;
+  return std::any_of(predicates_.begin(), predicates_.end(), [&](const Predicate &predicate) {
+    return (predicate.relations_ & left_relations) != 0 && (predicate.relations_ & right_relations) != 0 &&
+           (predicate.relations_ & ~(left_relations | right_relations)) == 0;
+  });
+}
+
+void JoinEnumerator::LabelBreadthFirst() {
+  const auto num_relations = static_cast<uint32_t>(plans_.size());
+  std::vector<uint32_t> labels(num_relations, NO_PLAN);
+  for (uint32_t start = 0; start < num_relations; start++) {
+    if (labels[start] != NO_PLAN) continue;
+    uint64_t component = 0;
+    std::queue<uint32_t> queue;
+    labels[start] = static_cast<uint32_t>(relation_of_label_.size());
+    relation_of_label_.push_back(start);
+    queue.push(start);
+    while (!queue.empty()) {
+      const uint32_t relation = queue.front();
+      queue.pop();
+      component |= Bit(labels[relation]);
+      for (uint32_t neighbor = 0; neighbor < num_relations; neighbor++) {
+        if ((adjacent_[relation] & Bit(neighbor)) == 0 || labels[neighbor] != NO_PLAN) continue;
+        labels[neighbor] = static_cast<uint32_t>(relation_of_label_.size());
+        relation_of_label_.push_back(neighbor);
+        queue.push(neighbor);
+      }
+    }
+    components_.push_back(component);
+  }
+
+  label_neighbors_.assign(num_relations, 0);
+  for (uint32_t relation = 0; relation < num_relations; relation++) {
+    for (uint32_t neighbor = 0; neighbor < num_relations; neighbor++) {
+      if ((adjacent_[relation] & Bit(neighbor)) != 0) label_neighbors_[labels[relation]] |= Bit(labels[neighbor]);
+    }
+  }
+}
+
+void JoinEnumerator::EnumerateConnectedSubgraphs() {
+  const auto num_labels = static_cast<uint32_t>(relation_of_label_.size());
+  for (uint32_t label = 0; label < num_labels; label++) best_plans_[Bit(label)] = relation_of_label_[label];
+
+  // Subgraphs are only ever extended with labels above their first one, so that each one is visited exactly once
+  for (uint32_t label = num_labels; label-- > 0;) {
+    EmitSubgraph(Bit(label));
+    ExpandSubgraph(Bit(label), Bit(label) | (Bit(label) - 1));
+  }
+}
+
+void JoinEnumerator::ExpandSubgraph(const uint64_t subgraph, const uint64_t excluded) {
+  const uint64_t neighborhood = Neighborhood(subgraph) & ~excluded;
+  ForEachSubset(neighborhood, [&](const uint64_t subset) { EmitSubgraph(subgraph | subset); });
+  ForEachSubset(neighborhood,
+                [&](const uint64_t subset) { ExpandSubgraph(subgraph | subset, excluded | neighborhood); });
+}
+
+void JoinEnumerator::EmitSubgraph(const uint64_t subgraph) {
+  // Complements only hold labels above the subgraph's first one, so that each pair is visited in one order only
+  const uint64_t first = subgraph & (~subgraph + 1);
+  const uint64_t excluded = subgraph | (first | (first - 1));
+  const uint64_t neighborhood = Neighborhood(subgraph) & ~excluded;
+  for (uint32_t label = 64; label-- > 0;) {
+    if ((neighborhood & Bit(label)) == 0) continue;
+    EmitPair(subgraph, Bit(label));
+    ExpandComplement(subgraph, Bit(label), excluded | (neighborhood & (Bit(label) | (Bit(label) - 1))));
+  }
+}
+
+void JoinEnumerator::ExpandComplement(const uint64_t subgraph, const uint64_t complement, const uint64_t excluded) {
+  const uint64_t neighborhood = Neighborhood(complement) & ~excluded;
+  ForEachSubset(neighborhood, [&](const uint64_t subset) { EmitPair(subgraph, complement | subset); });
+  ForEachSubset(neighborhood, [&](const uint64_t subset) {
+    ExpandComplement(subgraph, complement | subset, excluded | neighborhood);
+  });
+}
+
+void JoinEnumerator::EmitPair(const uint64_t subgraph, const uint64_t complement) {
+  // Labelling breadth-first and visiting subsets in increasing order guarantee that the plans of both inputs are final
+  TERRIER_ASSERT(best_plans_.count(subgraph) != 0 && best_plans_.count(complement) != 0, "Input plan missing");
+  // Joins cost the same either way around, so the pair is only costed in one order
+  Plan plan = Join(best_plans_[subgraph], best_plans_[complement]);
+  const auto it = best_plans_.find(subgraph | complement);
+  if (it == best_plans_.end()) {
+    best_plans_.emplace(subgraph | complement, static_cast<uint32_t>(plans_.size()));
+    plans_.push_back(std::move(plan));
+  } else if (plan.cost_ < plans_[it->second].cost_) {
+    // No plan refers to the replaced one yet, as only larger sets of relations are joined after this one
+    plans_[it->second] = std::move(plan);
+  }
+}
+
+uint64_t JoinEnumerator::Neighborhood(const uint64_t labels) const {
+  uint64_t neighborhood = 0;
+  for (uint64_t remaining = labels; remaining != 0; remaining &= remaining - 1) {
+    neighborhood |= label_neighbors_[__builtin_ctzll(remaining)];
+  }
+  return neighborhood & ~labels;
+}
+
+uint32_t JoinEnumerator::JoinGreedily(std::vector<uint32_t> inputs) {
+  while (inputs.size() > 1) {
+    // Join the pair with the smallest output, preferring pairs that a predicate connects over cross products
+    size_t best_left = 0;
+    size_t best_right = 1;
+    Plan best_plan = Join(inputs[0], inputs[1]);
+    bool best_connects = Connects(inputs[0], inputs[1]);
+    for (size_t left = 0; left < inputs.size(); left++) {
+      for (size_t right = left + 1; right < inputs.size(); right++) {
+        if (left == 0 && right == 1) continue;
+        const bool connects = Connects(inputs[left], inputs[right]);
+        if (best_connects && !connects) continue;
+        Plan plan = Join(inputs[left], inputs[right]);
+        if (connects == best_connects &&
+            std::make_pair(plan.num_rows_, plan.cost_) >= std::make_pair(best_plan.num_rows_, best_plan.cost_))
+          continue;
+        best_left = left;
+        best_right = right;
+        best_plan = std::move(plan);
+        best_connects = connects;
+      }
+    }
+    inputs[best_left] = static_cast<uint32_t>(plans_.size());
+    plans_.push_back(std::move(best_plan));
+    inputs.erase(inputs.begin() + static_cast<std::ptrdiff_t>(best_right));
+  }
+  return inputs[0];
+}
+
+}  // namespace terrier::optimizer
@@ -1,6 +1,11 @@
 #include "optimizer/optimizer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <exception>
 #include <memory>
+#include <thread>  // NOLINT
 #include <utility>
 #include <vector>
 
@@ -8,6 +13,8 @@
 #include "common/scoped_timer.h"
 #include "optimizer/binding.h"
 #include "optimizer/input_column_deriver.h"
+#include "optimizer/join_enumerator.h"
+#include "optimizer/logical_operators.h"
 #include "optimizer/operator_visitor.h"
 #include "optimizer/optimization_context.h"
 #include "optimizer/optimizer_task_pool.h"
@@ -90,6 +97,7 @@ std::unique_ptr<planner::AbstractPlanNode> Optimizer::ChooseBestPlan(
   // root plan. Also keep propagate expression to column offset mapping
   std::vector<std::unique_ptr<planner::AbstractPlanNode>> children_plans;
   std::vector<ExprMap> children_expr_map;
+  std::vector<int> children_num_rows;
   for (size_t i = 0; i < child_groups.size(); ++i) {
     ExprMap child_expr_map;
     for (unsigned offset = 0; offset < input_cols[i].size(); ++offset) {
@@ -102,6 +110,7 @@ std::unique_ptr<planner::AbstractPlanNode> Optimizer::ChooseBestPlan(
 
     children_plans.emplace_back(std::move(child_plan));
     children_expr_map.push_back(child_expr_map);
+    children_num_rows.push_back(context_->GetMemo().GetGroupByID(child_groups[i])->GetNumRows());
   }
 
   // Derive root plan
@@ -109,7 +118,8 @@ std::unique_ptr<planner::AbstractPlanNode> Optimizer::ChooseBestPlan(
 
   PlanGenerator generator;
   auto plan = generator.ConvertOpNode(txn, accessor, op, required_props, required_cols, output_cols,
-                                      std::move(children_plans), std::move(children_expr_map));
+                                      std::move(children_plans), std::move(children_expr_map),
+                                      std::move(children_num_rows));
   OPTIMIZER_LOG_TRACE("Finish Choosing best plan for group {0}", id);
 
   delete op;
@@ -118,22 +128,160 @@ std::unique_ptr<planner::AbstractPlanNode> Optimizer::ChooseBestPlan(
 
 void Optimizer::OptimizeLoop(group_id_t root_group_id, PropertySet *required_props) {
   auto root_context = new OptimizationContext(context_.get(), required_props->Copy());
-  auto task_stack = new OptimizerTaskStack();
-  context_->SetTaskPool(task_stack);
+  // Only pay for synchronizing tasks when there are several threads to run them
+  OptimizerTaskPool *task_pool;
+  OptimizerTaskStack *task_stack = nullptr;
+  ConcurrentOptimizerTaskPool *concurrent_pool = nullptr;
+  if (num_threads_ > 1)
+    task_pool = concurrent_pool = new ConcurrentOptimizerTaskPool(num_threads_);
+  else
+    task_pool = task_stack = new OptimizerTaskStack();
+  context_->SetTaskPool(task_pool);
   context_->AddOptimizationContext(root_context);
+  auto execute_task_pool = [&] {
+    if (concurrent_pool != nullptr)
+      ExecuteConcurrentTaskPool(concurrent_pool, root_group_id, root_context);
+    else
+      ExecuteTaskStack(task_stack, root_group_id, root_context);
+  };
 
   // Perform rewrite first
-  task_stack->Push(new TopDownRewrite(root_group_id, root_context, RuleSetName::PREDICATE_PUSH_DOWN));
-  task_stack->Push(new BottomUpRewrite(root_group_id, root_context, RuleSetName::UNNEST_SUBQUERY, false));
-  ExecuteTaskStack(task_stack, root_group_id, root_context);
+  task_pool->PushDependent(new TopDownRewrite(root_group_id, root_context, RuleSetName::PREDICATE_PUSH_DOWN));
+  task_pool->Push(new BottomUpRewrite(root_group_id, root_context, RuleSetName::UNNEST_SUBQUERY, false));
+  execute_task_pool();
 
-  // Perform optimization after the rewrite
+  // Pick the order of every tree of inner joins next, from the stats of its inputs
   Memo &memo = context_->GetMemo();
-  task_stack->Push(new OptimizeGroup(memo.GetGroupByID(root_group_id), root_context));
+  GroupExpression *root_gexpr = memo.GetGroupByID(root_group_id)->GetLogicalExpression();
+  std::vector<group_id_t> join_roots;
+  FindJoinTrees(root_group_id, &join_roots);
+  if (!join_roots.empty()) {
+    for (const group_id_t join_root : join_roots) {
+      task_pool->Push(new DeriveStats(memo.GetGroupByID(join_root)->GetLogicalExpression(), ExprSet{}, root_context));
+    }
+    execute_task_pool();
+    std::vector<GroupExpression *> added_joins;
+    for (const group_id_t join_root : join_roots) EnumerateJoinOrder(join_root, &added_joins);
+
+    // The joins of the chosen trees start new groups, whose sizes the costs of the joins above them depend on
+    for (GroupExpression *join : added_joins) {
+      if (!join->HasDerivedStats()) task_pool->Push(new DeriveStats(join, ExprSet{}, root_context));
+    }
+    execute_task_pool();
+  }
+
+  // Perform optimization after the rewrite
+  task_pool->PushDependent(new OptimizeGroup(memo.GetGroupByID(root_group_id), root_context));
 
   // Derive stats for the only one logical expression before optimizing
-  task_stack->Push(new DeriveStats(memo.GetGroupByID(root_group_id)->GetLogicalExpression(), ExprSet{}, root_context));
-  ExecuteTaskStack(task_stack, root_group_id, root_context);
+  task_pool->Push(new DeriveStats(root_gexpr, ExprSet{}, root_context));
+  execute_task_pool();
+}
+
+void Optimizer::FindJoinTrees(group_id_t group_id, std::vector<group_id_t> *join_roots) {
+  GroupExpression *gexpr = context_->GetMemo().GetGroupByID(group_id)->GetLogicalExpression();
+  if (gexpr->Op().GetType() != OpType::LOGICALINNERJOIN) {
+    for (const group_id_t child : gexpr->GetChildGroupIDs()) FindJoinTrees(child, join_roots);
+    return;
+  }
+
+  join_roots->push_back(group_id);
+  std::vector<group_id_t> inputs;
+  std::vector<GroupExpression *> joins;
+  CollectJoinTree(group_id, &inputs, &joins);
+  for (const group_id_t input : inputs) FindJoinTrees(input, join_roots);
+}
+
+void Optimizer::CollectJoinTree(group_id_t group_id, std::vector<group_id_t> *inputs,
+                                std::vector<GroupExpression *> *joins) {
+  GroupExpression *gexpr = context_->GetMemo().GetGroupByID(group_id)->GetLogicalExpression();
+  if (gexpr->Op().GetType() != OpType::LOGICALINNERJOIN) {
+    inputs->push_back(group_id);
+    return;
+  }
+
+  joins->push_back(gexpr);
+  for (const group_id_t child : gexpr->GetChildGroupIDs()) CollectJoinTree(child, inputs, joins);
+}
+
+void Optimizer::EnumerateJoinOrder(group_id_t root_group_id, std::vector<GroupExpression *> *added_joins) {
+  Memo &memo = context_->GetMemo();
+  std::vector<group_id_t> inputs;
+  std::vector<GroupExpression *> joins;
+  CollectJoinTree(root_group_id, &inputs, &joins);
+  if (inputs.size() > JoinEnumerator::MAX_RELATIONS) return;
+
+  JoinEnumerator enumerator;
+  for (const group_id_t input : inputs) enumerator.AddRelation(std::max(memo.GetGroupByID(input)->GetNumRows(), 0));
+
+  std::vector<AnnotatedExpression> predicates;
+  for (GroupExpression *join : joins) {
+    for (const auto &predicate : join->Op().As<LogicalInnerJoin>()->GetJoinPredicates()) {
+      uint64_t relations = 0;
+      for (const auto &alias : predicate.GetTableAliasSet()) {
+        uint64_t alias_relations = 0;
+        for (size_t idx = 0; idx < inputs.size(); idx++) {
+          if (memo.GetGroupByID(inputs[idx])->GetTableAliases().count(alias) != 0) {
+            alias_relations |= uint64_t{1} << idx;
+          }
+        }
+        // A column from outside the tree, e.g. of an outer query, leaves the tree to the rules
+        if (alias_relations == 0) return;
+        relations |= alias_relations;
+      }
+
+      // Same join conditions as the StatsCalculator estimates the selectivity of
+      const auto expr = predicate.GetExpr();
+      const bool equi_join = expr->GetExpressionType() == parser::ExpressionType::COMPARE_EQUAL &&
+                             expr->GetChild(0)->GetExpressionType() == parser::ExpressionType::COLUMN_VALUE &&
+                             expr->GetChild(1)->GetExpressionType() == parser::ExpressionType::COLUMN_VALUE;
+      enumerator.AddPredicate(relations, equi_join);
+      predicates.push_back(predicate);
+    }
+  }
+  const uint32_t root = enumerator.Enumerate();
+  OPTIMIZER_LOG_DEBUG("Picked the order of {0} joins {1}", joins.size(),
+                      enumerator.IsExhaustive() ? "exhaustively" : "greedily");
+
+  for (GroupExpression *join : joins) {
+    const auto join_predicates = join->Op().As<LogicalInnerJoin>()->GetJoinPredicates();
+    AddJoin(join->GetChildGroupId(0), join->GetChildGroupId(1), join_predicates, join->GetGroupID(), added_joins);
+  }
+  AddJoinTree(enumerator, root, inputs, predicates, root_group_id, added_joins);
+}
+
+group_id_t Optimizer::AddJoinTree(const JoinEnumerator &enumerator, uint32_t plan_idx,
+                                  const std::vector<group_id_t> &inputs,
+                                  const std::vector<AnnotatedExpression> &predicates, group_id_t target_group,
+                                  std::vector<GroupExpression *> *added_joins) {
+  const auto &plan = enumerator.GetPlan(plan_idx);
+  if (plan.left_ == JoinEnumerator::NO_PLAN) return inputs[plan_idx];
+
+  const group_id_t left = AddJoinTree(enumerator, plan.left_, inputs, predicates, UNDEFINED_GROUP, added_joins);
+  const group_id_t right = AddJoinTree(enumerator, plan.right_, inputs, predicates, UNDEFINED_GROUP, added_joins);
+  std::vector<AnnotatedExpression> join_predicates;
+  for (const uint32_t idx : plan.predicates_) join_predicates.push_back(predicates[idx]);
+  return AddJoin(left, right, join_predicates, target_group, added_joins);
+}
+
+group_id_t Optimizer::AddJoin(group_id_t left, group_id_t right, const std::vector<AnnotatedExpression> &predicates,
+                              group_id_t target_group, std::vector<GroupExpression *> *added_joins) {
+  Memo &memo = context_->GetMemo();
+  auto join = memo.InsertExpression(
+      new GroupExpression(LogicalInnerJoin::Make(std::vector<AnnotatedExpression>(predicates)), {left, right}),
+      target_group, false);
+  auto commuted_join = memo.InsertExpression(
+      new GroupExpression(LogicalInnerJoin::Make(std::vector<AnnotatedExpression>(predicates)), {right, left}),
+      join->GetGroupID(), false);
+
+  for (Rule *rule : context_->GetRuleSet().GetRulesByName(RuleSetName::LOGICAL_TRANSFORMATION)) {
+    if (rule->GetType() != RuleType::INNER_JOIN_COMMUTE && rule->GetType() != RuleType::INNER_JOIN_ASSOCIATE) continue;
+    join->SetRuleExplored(rule);
+    commuted_join->SetRuleExplored(rule);
+  }
+  added_joins->push_back(join);
+  added_joins->push_back(commuted_join);
+  return join->GetGroupID();
 }
 
 void Optimizer::ExecuteTaskStack(OptimizerTaskStack *task_stack, group_id_t root_group_id,
@@ -162,4 +310,54 @@ void Optimizer::ExecuteTaskStack(OptimizerTaskStack *task_stack, group_id_t root
   }
 }
 
+void Optimizer::ExecuteConcurrentTaskPool(ConcurrentOptimizerTaskPool *task_pool, group_id_t root_group_id,
+                                          OptimizationContext *root_context) {
+  auto root_group = context_->GetMemo().GetGroupByID(root_group_id);
+  const auto &required_props = root_context->GetRequiredProperties();
+  const auto start = std::chrono::steady_clock::now();
+
+  std::atomic<bool> stop{false};
+  common::SpinLatch exception_latch;
+  std::exception_ptr exception;
+
+  auto worker = [&] {
+    while (!stop.load() && !task_pool->Empty()) {
+      // Check to see if we have at least one plan, and if we have exceeded our
+      // timeout limit
+      const auto elapsed_time = static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+      if (elapsed_time >= task_execution_timeout_ && root_group->HasExpressions(required_props)) {
+        stop.store(true);
+        break;
+      }
+
+      auto task = task_pool->Pop();
+      // Other threads are still running the tasks the remaining ones wait for
+      if (task == nullptr) {
+        std::this_thread::yield();
+        continue;
+      }
+      try {
+        task->Execute();
+      } catch (...) {
+        common::SpinLatch::ScopedSpinLatch guard(&exception_latch);
+        if (exception == nullptr) exception = std::current_exception();
+        stop.store(true);
+      }
+      task_pool->Finish(task);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads_ - 1);
+  for (uint32_t i = 1; i < num_threads_; i++) threads.emplace_back(worker);
+  worker();
+  for (auto &thread : threads) thread.join();
+
+  if (!stop.load()) return;
+  task_pool->Clear();
+  if (exception != nullptr) std::rethrow_exception(exception);
+  throw OPTIMIZER_EXCEPTION("Optimizer task execution timed out");
+}
+
 }  // namespace terrier::optimizer
@@ -41,6 +41,16 @@ void OptimizerTask::ConstructValidRules(GroupExpression *group_expr, const std::
 
 void OptimizerTask::PushTask(OptimizerTask *task) { context_->GetOptimizerContext()->PushTask(task); }
 
+void OptimizerTask::PushDependentTask(OptimizerTask *task) {
+  context_->GetOptimizerContext()->PushDependentTask(task);
+}
+
+void OptimizerTask::PushSuspendedTask(OptimizerTask *task) {
+  context_->GetOptimizerContext()->PushSuspendedTask(task);
+}
+
+void OptimizerTask::ResumeTask(OptimizerTask *task) { context_->GetOptimizerContext()->ResumeTask(task); }
+
 Memo &OptimizerTask::GetMemo() const { return context_->GetOptimizerContext()->GetMemo(); }
 
 RuleSet &OptimizerTask::GetRuleSet() const { return context_->GetOptimizerContext()->GetRuleSet(); }
@@ -50,12 +60,29 @@ RuleSet &OptimizerTask::GetRuleSet() const { return context_->GetOptimizerContex
 //===--------------------------------------------------------------------===//
 void OptimizeGroup::Execute() {
   OPTIMIZER_LOG_TRACE("OptimizeGroup::Execute() group {0}", group_->GetID());
+  if (finish_) {
+    // Everything the optimization pushed has run, so its result is final
+    for (auto *waiter : group_->FinishOptimizing(context_->GetRequiredProperties())) ResumeTask(waiter);
+    return;
+  }
+
   if (group_->GetCostLB() > context_->GetCostUpperBound() ||                    // Cost LB > Cost UB
       group_->GetBestExpression(context_->GetRequiredProperties()) != nullptr)  // Has optimized given the context
     return;
 
+  // Another task may still be costing the group for the same properties, or adding its expressions. Having found no
+  // best expression yet, try again once it is done rather than let the caller give up on the group.
+  auto retry = new OptimizeGroup(group_, context_);
+  bool explore;
+  if (!group_->StartOptimizing(context_->GetRequiredProperties(), retry, &explore)) {
+    PushSuspendedTask(retry);
+    return;
+  }
+  delete retry;
+  PushDependentTask(new OptimizeGroup(this));
+
   // Push explore task first for logical expressions if the group has not been explored
-  if (!group_->HasExplored()) {
+  if (explore) {
     for (auto &logical_expr : group_->GetLogicalExpressions()) PushTask(new OptimizeExpression(logical_expr, context_));
   }
 
@@ -63,10 +90,6 @@ void OptimizeGroup::Execute() {
   for (auto &physical_expr : group_->GetPhysicalExpressions()) {
     PushTask(new OptimizeExpressionCostWithEnforcedProperty(physical_expr, context_));
   }
-
-  // Since there is no cycle in the tree, it is safe to set the flag even before
-  // all expressions are explored
-  group_->SetExplorationFlag();
 }
 
 //===--------------------------------------------------------------------===//
@@ -86,7 +109,7 @@ void OptimizeExpression::Execute() {
                       static_cast<int>(group_expr_->Op().GetType()), valid_rules.size());
   // Apply rule
   for (auto &r : valid_rules) {
-    PushTask(new ApplyRule(group_expr_, r.GetRule(), context_));
+    PushDependentTask(new ApplyRule(group_expr_, r.GetRule(), context_));
     int child_group_idx = 0;
     for (auto &child_pattern : r.GetRule()->GetMatchPattern()->Children()) {
       // If child_pattern has any more children (i.e non-leaf), then we will explore the
@@ -131,7 +154,7 @@ void ExploreExpression::Execute() {
 
   // Apply rule
   for (auto &r : valid_rules) {
-    PushTask(new ApplyRule(group_expr_, r.GetRule(), context_, true));
+    PushDependentTask(new ApplyRule(group_expr_, r.GetRule(), context_, true));
     int child_group_idx = 0;
     for (auto &child_pattern : r.GetRule()->GetMatchPattern()->Children()) {
       // Only need to explore non-leaf children before applying rule to the
@@ -194,6 +217,15 @@ void ApplyRule::Execute() {
 // DeriveStats
 //===--------------------------------------------------------------------===//
 void DeriveStats::Execute() {
+  // The size of a group is estimated from its first logical expression, so that it does not depend on which of its
+  // expressions tasks happen to derive stats for first
+  auto group_gexpr = GetMemo().GetGroupByID(gexpr_->GetGroupID())->GetLogicalExpressions()[0];
+  if (group_gexpr != gexpr_ && !group_gexpr->HasDerivedStats()) {
+    PushDependentTask(new DeriveStats(this));
+    PushTask(new DeriveStats(group_gexpr, ExprSet{}, context_));
+    return;
+  }
+
   // First do a top-down pass to get stats for required columns, then do a
   // bottom-up pass to calculate the stats
   ChildStatsDeriver deriver;
@@ -219,7 +251,7 @@ void DeriveStats::Execute() {
       if (!derive_children) {
         derive_children = true;
         // Derive stats for root later
-        PushTask(new DeriveStats(this));
+        PushDependentTask(new DeriveStats(this));
       }
       PushTask(new DeriveStats(child_group_gexpr, child_required_stats, context_));
     }
@@ -291,7 +323,7 @@ void OptimizeExpressionCostWithEnforcedProperty::Execute() {
         if (cur_total_cost_ > context_->GetCostUpperBound()) break;
       } else if (prev_child_idx_ != cur_child_idx_) {  // We haven't optimized child group
         prev_child_idx_ = cur_child_idx_;
-        PushTask(new OptimizeExpressionCostWithEnforcedProperty(this));
+        PushDependentTask(new OptimizeExpressionCostWithEnforcedProperty(this));
 
         auto cost_high = context_->GetCostUpperBound() - cur_total_cost_;
         auto ctx = new OptimizationContext(context_->GetOptimizerContext(), i_prop->Copy(), cost_high);
@@ -428,7 +460,7 @@ void BottomUpRewrite::Execute() {
   auto cur_group_expr = cur_group->GetLogicalExpression();
 
   if (!has_optimized_child_) {
-    PushTask(new BottomUpRewrite(group_id_, context_, rule_set_name_, true));
+    PushDependentTask(new BottomUpRewrite(group_id_, context_, rule_set_name_, true));
 
     size_t size = cur_group_expr->GetChildrenGroupsSize();
     for (size_t child_group_idx = 0; child_group_idx < size; child_group_idx++) {
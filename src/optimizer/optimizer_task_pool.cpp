@@ -0,0 +1,200 @@
+#include "optimizer/optimizer_task_pool.h"
+
+#include <utility>
+#include <vector>
+
+namespace terrier::optimizer {
+
+namespace {
+// Ids tell pools apart in the thread-local worker state, even when a pool is allocated where an old one used to be
+std::atomic<uint64_t> next_pool_id{1};
+}  // namespace
+
+ConcurrentOptimizerTaskPool::ConcurrentOptimizerTaskPool(const uint32_t num_threads)
+    : id_(next_pool_id.fetch_add(1)), queues_(num_threads) {
+  TERRIER_ASSERT(num_threads > 0, "Task pool needs at least one thread");
+  root_.executed_ = true;
+}
+
+ConcurrentOptimizerTaskPool::WorkerState &ConcurrentOptimizerTaskPool::LocalState() {
+  thread_local WorkerState state;
+  return state;
+}
+
+ConcurrentOptimizerTaskPool::WorkerState &ConcurrentOptimizerTaskPool::Worker() {
+  WorkerState &state = LocalState();
+  if (state.pool_id_ != id_) {
+    state.pool_id_ = id_;
+    state.queue_idx_ = num_workers_.fetch_add(1) % static_cast<uint32_t>(queues_.size());
+    state.current_ = nullptr;
+    state.pushes_.clear();
+  }
+  return state;
+}
+
+OptimizerTask *ConcurrentOptimizerTaskPool::Pop() {
+  WorkerState &worker = Worker();
+  TERRIER_ASSERT(worker.current_ == nullptr, "The last popped task has not been finished");
+  const auto num_queues = static_cast<uint32_t>(queues_.size());
+  for (uint32_t i = 0; i < num_queues; i++) {
+    TaskQueue &queue = queues_[(worker.queue_idx_ + i) % num_queues];
+    common::SpinLatch::ScopedSpinLatch guard(&queue.latch_);
+    if (queue.nodes_.empty()) continue;
+    // Own work comes off the back like off a stack, stolen work off the front
+    if (i == 0) {
+      worker.current_ = queue.nodes_.back();
+      queue.nodes_.pop_back();
+    } else {
+      worker.current_ = queue.nodes_.front();
+      queue.nodes_.pop_front();
+    }
+    return worker.current_->task_;
+  }
+  return nullptr;
+}
+
+void ConcurrentOptimizerTaskPool::Finish(OptimizerTask *const task) {
+  WorkerState &worker = Worker();
+  Node *const node = worker.current_;
+  TERRIER_ASSERT(node != nullptr && node->task_ == task, "Only the last popped task can be finished");
+  worker.current_ = nullptr;
+  delete task;
+  node->task_ = nullptr;
+  node->executed_ = true;
+
+  // Hold the node open while scheduling, so that the tasks it pushed cannot finish it before all of them are counted
+  node->num_pending_.store(1);
+  Schedule(node, worker.pushes_, worker.queue_idx_);
+  worker.pushes_.clear();
+  Release(node, worker.queue_idx_);
+}
+
+void ConcurrentOptimizerTaskPool::Push(OptimizerTask *const task, const PushKind kind) {
+  WorkerState &worker = LocalState();
+  if (worker.pool_id_ == id_ && worker.current_ != nullptr) {
+    worker.pushes_.emplace_back(task, kind);
+    return;
+  }
+  common::SpinLatch::ScopedSpinLatch guard(&root_latch_);
+  root_pushes_.emplace_back(task, kind);
+  has_root_pushes_.store(true);
+}
+
+void ConcurrentOptimizerTaskPool::Resume(OptimizerTask *const task) {
+  Node *node;
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&suspended_latch_);
+    auto it = suspended_.find(task);
+    if (it == suspended_.end()) {
+      // Schedule() enqueues it right away instead
+      resumed_.insert(task);
+      return;
+    }
+    node = it->second;
+    suspended_.erase(it);
+  }
+  Release(node, Worker().queue_idx_);
+}
+
+bool ConcurrentOptimizerTaskPool::Empty() {
+  if (has_root_pushes_.load()) {
+    common::SpinLatch::ScopedSpinLatch guard(&root_latch_);
+    Schedule(&root_, root_pushes_, Worker().queue_idx_);
+    root_pushes_.clear();
+    has_root_pushes_.store(false);
+  }
+  return root_.num_pending_.load() == 0;
+}
+
+void ConcurrentOptimizerTaskPool::Schedule(Node *const parent,
+                                           const std::vector<std::pair<OptimizerTask *, PushKind>> &pushes,
+                                           const uint32_t queue_idx) {
+  // Every dependent task waits for the other ones pushed after it, and the parent waits for the rest
+  std::vector<Node *> nodes;
+  std::vector<Node *> suspended;
+  nodes.reserve(pushes.size());
+  Node *head = nullptr;
+  uint32_t num_children = 0;
+  for (const auto &push : pushes) {
+    Node *node;
+    if (push.second == PushKind::DEPENDENT) {
+      head = new Node(push.first, parent);
+      num_children++;
+      node = head;
+    } else if (head != nullptr) {
+      node = new Node(push.first, head);
+      head->num_pending_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      node = new Node(push.first, parent);
+      num_children++;
+    }
+    (push.second == PushKind::SUSPENDED ? suspended : nodes).push_back(node);
+  }
+  parent->num_pending_.fetch_add(num_children);
+
+  // Suspended tasks can only be resumed once everything that waits for them counts them
+  for (Node *const node : suspended) {
+    common::SpinLatch::ScopedSpinLatch guard(&suspended_latch_);
+    if (resumed_.erase(node->task_) != 0) {
+      nodes.push_back(node);
+    } else {
+      node->num_pending_.store(1, std::memory_order_relaxed);
+      suspended_.emplace(node->task_, node);
+    }
+  }
+
+  // Enqueue in push order, so that the last pushed task is popped first, as from the stack
+  TaskQueue &queue = queues_[queue_idx];
+  common::SpinLatch::ScopedSpinLatch guard(&queue.latch_);
+  for (Node *const node : nodes) {
+    if (node->num_pending_.load(std::memory_order_relaxed) == 0) queue.nodes_.push_back(node);
+  }
+}
+
+void ConcurrentOptimizerTaskPool::Release(Node *node, const uint32_t queue_idx) {
+  while (node->num_pending_.fetch_sub(1) == 1) {
+    // A dependent task whose wait is over
+    if (!node->executed_) {
+      Enqueue(node, queue_idx);
+      return;
+    }
+    if (node == &root_) return;
+    Node *const parent = node->parent_;
+    delete node;
+    node = parent;
+  }
+}
+
+void ConcurrentOptimizerTaskPool::Enqueue(Node *const node, const uint32_t queue_idx) {
+  TaskQueue &queue = queues_[queue_idx];
+  common::SpinLatch::ScopedSpinLatch guard(&queue.latch_);
+  queue.nodes_.push_back(node);
+}
+
+void ConcurrentOptimizerTaskPool::Unwind(Node *node) {
+  while (node != &root_) {
+    delete node->task_;
+    Node *const parent = node->parent_;
+    delete node;
+    node = parent;
+    if (node->num_pending_.fetch_sub(1) != 1) break;
+  }
+}
+
+void ConcurrentOptimizerTaskPool::Clear() {
+  // Every waiting task waits, directly or not, for some runnable or suspended one. Unwinding each of those as if it
+  // had finished, together with every task that was only waiting for it, thus gets rid of all tasks.
+  for (TaskQueue &queue : queues_) {
+    for (Node *const node : queue.nodes_) Unwind(node);
+    queue.nodes_.clear();
+  }
+  for (const auto &suspended : suspended_) Unwind(suspended.second);
+  suspended_.clear();
+  resumed_.clear();
+  for (const auto &push : root_pushes_) delete push.first;
+  root_pushes_.clear();
+  has_root_pushes_.store(false);
+  root_.num_pending_.store(0);
+}
+
+}  // namespace terrier::optimizer
@@ -418,22 +418,44 @@ bool InnerHashJoin::operator==(const BaseOperatorNodeContents &r) {
 //===--------------------------------------------------------------------===//
 BaseOperatorNodeContents *LeftHashJoin::Copy() const { return new LeftHashJoin(*this); }
 
-Operator LeftHashJoin::Make(common::ManagedPointer<parser::AbstractExpression> join_predicate) {
+Operator LeftHashJoin::Make(std::vector<AnnotatedExpression> &&join_predicates,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys) {
   auto join = std::make_unique<LeftHashJoin>();
-  join->join_predicate_ = join_predicate;
+  join->join_predicates_ = std::move(join_predicates);
+  join->left_keys_ = std::move(left_keys);
+  join->right_keys_ = std::move(right_keys);
   return Operator(std::move(join));
 }
 
 common::hash_t LeftHashJoin::Hash() const {
   common::hash_t hash = BaseOperatorNodeContents::Hash();
-  hash = common::HashUtil::CombineHashes(hash, join_predicate_->Hash());
+  for (auto &expr : left_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &expr : right_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr)
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    else
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+  }
   return hash;
 }
 
 bool LeftHashJoin::operator==(const BaseOperatorNodeContents &r) {
   if (r.GetType() != OpType::LEFTHASHJOIN) return false;
-  const LeftHashJoin &node = *static_cast<const LeftHashJoin *>(&r);
-  return (*join_predicate_ == *(node.join_predicate_));
+  const LeftHashJoin &node = *dynamic_cast<const LeftHashJoin *>(&r);
+  if (left_keys_.size() != node.left_keys_.size() || right_keys_.size() != node.right_keys_.size() ||
+      join_predicates_.size() != node.join_predicates_.size())
+    return false;
+  if (join_predicates_ != node.join_predicates_) return false;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (*(left_keys_[i]) != *(node.left_keys_[i])) return false;
+  }
+  for (size_t i = 0; i < right_keys_.size(); i++) {
+    if (*(right_keys_[i]) != *(node.right_keys_[i])) return false;
+  }
+  return true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -441,22 +463,44 @@ bool LeftHashJoin::operator==(const BaseOperatorNodeContents &r) {
 //===--------------------------------------------------------------------===//
 BaseOperatorNodeContents *RightHashJoin::Copy() const { return new RightHashJoin(*this); }
 
-Operator RightHashJoin::Make(common::ManagedPointer<parser::AbstractExpression> join_predicate) {
+Operator RightHashJoin::Make(std::vector<AnnotatedExpression> &&join_predicates,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys) {
   auto join = std::make_unique<RightHashJoin>();
-  join->join_predicate_ = join_predicate;
+  join->join_predicates_ = std::move(join_predicates);
+  join->left_keys_ = std::move(left_keys);
+  join->right_keys_ = std::move(right_keys);
   return Operator(std::move(join));
 }
 
 common::hash_t RightHashJoin::Hash() const {
   common::hash_t hash = BaseOperatorNodeContents::Hash();
-  hash = common::HashUtil::CombineHashes(hash, join_predicate_->Hash());
+  for (auto &expr : left_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &expr : right_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr)
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    else
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+  }
   return hash;
 }
 
 bool RightHashJoin::operator==(const BaseOperatorNodeContents &r) {
   if (r.GetType() != OpType::RIGHTHASHJOIN) return false;
-  const RightHashJoin &node = *static_cast<const RightHashJoin *>(&r);
-  return (*join_predicate_ == *(node.join_predicate_));
+  const RightHashJoin &node = *dynamic_cast<const RightHashJoin *>(&r);
+  if (left_keys_.size() != node.left_keys_.size() || right_keys_.size() != node.right_keys_.size() ||
+      join_predicates_.size() != node.join_predicates_.size())
+    return false;
+  if (join_predicates_ != node.join_predicates_) return false;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (*(left_keys_[i]) != *(node.left_keys_[i])) return false;
+  }
+  for (size_t i = 0; i < right_keys_.size(); i++) {
+    if (*(right_keys_[i]) != *(node.right_keys_[i])) return false;
+  }
+  return true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -464,22 +508,89 @@ bool RightHashJoin::operator==(const BaseOperatorNodeContents &r) {
 //===--------------------------------------------------------------------===//
 BaseOperatorNodeContents *OuterHashJoin::Copy() const { return new OuterHashJoin(*this); }
 
-Operator OuterHashJoin::Make(common::ManagedPointer<parser::AbstractExpression> join_predicate) {
+Operator OuterHashJoin::Make(std::vector<AnnotatedExpression> &&join_predicates,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys) {
   auto join = std::make_unique<OuterHashJoin>();
-  join->join_predicate_ = join_predicate;
+  join->join_predicates_ = std::move(join_predicates);
+  join->left_keys_ = std::move(left_keys);
+  join->right_keys_ = std::move(right_keys);
   return Operator(std::move(join));
 }
 
 common::hash_t OuterHashJoin::Hash() const {
   common::hash_t hash = BaseOperatorNodeContents::Hash();
-  hash = common::HashUtil::CombineHashes(hash, join_predicate_->Hash());
+  for (auto &expr : left_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &expr : right_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr)
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    else
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+  }
   return hash;
 }
 
 bool OuterHashJoin::operator==(const BaseOperatorNodeContents &r) {
   if (r.GetType() != OpType::OUTERHASHJOIN) return false;
-  const OuterHashJoin &node = *static_cast<const OuterHashJoin *>(&r);
-  return (*join_predicate_ == *(node.join_predicate_));
+  const OuterHashJoin &node = *dynamic_cast<const OuterHashJoin *>(&r);
+  if (left_keys_.size() != node.left_keys_.size() || right_keys_.size() != node.right_keys_.size() ||
+      join_predicates_.size() != node.join_predicates_.size())
+    return false;
+  if (join_predicates_ != node.join_predicates_) return false;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (*(left_keys_[i]) != *(node.left_keys_[i])) return false;
+  }
+  for (size_t i = 0; i < right_keys_.size(); i++) {
+    if (*(right_keys_[i]) != *(node.right_keys_[i])) return false;
+  }
+  return true;
+}
+
+//===--------------------------------------------------------------------===//
+// InnerMergeJoin
+//===--------------------------------------------------------------------===//
+BaseOperatorNodeContents *InnerMergeJoin::Copy() const { return new InnerMergeJoin(*this); }
+
+Operator InnerMergeJoin::Make(std::vector<AnnotatedExpression> &&join_predicates,
+                              std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                              std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys) {
+  auto join = std::make_unique<InnerMergeJoin>();
+  join->join_predicates_ = std::move(join_predicates);
+  join->left_keys_ = std::move(left_keys);
+  join->right_keys_ = std::move(right_keys);
+  return Operator(std::move(join));
+}
+
+common::hash_t InnerMergeJoin::Hash() const {
+  common::hash_t hash = BaseOperatorNodeContents::Hash();
+  for (auto &expr : left_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &expr : right_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr)
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    else
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+  }
+  return hash;
+}
+
+bool InnerMergeJoin::operator==(const BaseOperatorNodeContents &r) {
+  if (r.GetType() != OpType::INNERMERGEJOIN) return false;
+  const InnerMergeJoin &node = *dynamic_cast<const InnerMergeJoin *>(&r);
+  if (left_keys_.size() != node.left_keys_.size() || right_keys_.size() != node.right_keys_.size() ||
+      join_predicates_.size() != node.join_predicates_.size())
+    return false;
+  if (join_predicates_ != node.join_predicates_) return false;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (*(left_keys_[i]) != *(node.left_keys_[i])) return false;
+  }
+  for (size_t i = 0; i < right_keys_.size(); i++) {
+    if (*(right_keys_[i]) != *(node.right_keys_[i])) return false;
+  }
+  return true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -1274,6 +1385,8 @@ const char *OperatorNodeContents<RightHashJoin>::name = "RightHashJoin";
 template <>
 const char *OperatorNodeContents<OuterHashJoin>::name = "OuterHashJoin";
 template <>
+const char *OperatorNodeContents<InnerMergeJoin>::name = "InnerMergeJoin";
+template <>
 const char *OperatorNodeContents<Insert>::name = "Insert";
 template <>
 const char *OperatorNodeContents<InsertSelect>::name = "InsertSelect";
@@ -1350,6 +1463,8 @@ OpType OperatorNodeContents<RightHashJoin>::type = OpType::RIGHTHASHJOIN;
 template <>
 OpType OperatorNodeContents<OuterHashJoin>::type = OpType::OUTERHASHJOIN;
 template <>
+OpType OperatorNodeContents<InnerMergeJoin>::type = OpType::INNERMERGEJOIN;
+template <>
 OpType OperatorNodeContents<Insert>::type = OpType::INSERT;
 template <>
 OpType OperatorNodeContents<InsertSelect>::type = OpType::INSERTSELECT;
@@ -1,5 +1,7 @@
 #include "optimizer/plan_generator.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -14,6 +16,7 @@
 #include "optimizer/property_set.h"
 #include "optimizer/util.h"
 #include "parser/expression/abstract_expression.h"
+#include "parser/expression/column_value_expression.h"
 #include "parser/expression/constant_value_expression.h"
 #include "parser/expression_util.h"
 #include "planner/plannodes/aggregate_plan_node.h"
@@ -38,6 +41,7 @@
 #include "planner/plannodes/index_scan_plan_node.h"
 #include "planner/plannodes/insert_plan_node.h"
 #include "planner/plannodes/limit_plan_node.h"
+#include "planner/plannodes/merge_join_plan_node.h"
 #include "planner/plannodes/nested_loop_join_plan_node.h"
 #include "planner/plannodes/order_by_plan_node.h"
 #include "planner/plannodes/projection_plan_node.h"
@@ -56,12 +60,13 @@ std::unique_ptr<planner::AbstractPlanNode> PlanGenerator::ConvertOpNode(
     PropertySet *required_props, const std::vector<common::ManagedPointer<parser::AbstractExpression>> &required_cols,
     const std::vector<common::ManagedPointer<parser::AbstractExpression>> &output_cols,
     std::vector<std::unique_ptr<planner::AbstractPlanNode>> &&children_plans,
-    std::vector<ExprMap> &&children_expr_map) {
+    std::vector<ExprMap> &&children_expr_map, std::vector<int> children_num_rows) {
   required_props_ = required_props;
   required_cols_ = required_cols;
   output_cols_ = output_cols;
   children_plans_ = std::move(children_plans);
   children_expr_map_ = children_expr_map;
+  children_num_rows_ = std::move(children_num_rows);
   accessor_ = accessor;
   txn_ = txn;
 
@@ -216,10 +221,26 @@ void PlanGenerator::Visit(const IndexScan *op) {
   // An IndexScan (for now at least) will output all columns of its table
   std::vector<catalog::col_oid_t> column_ids = GenerateColumnsForScan(predicate);
 
+  // If the index holds every column the scan reads, the values can be read out of the keys and the tuples never need
+  // to be fetched. Updates and deletes still need the tuples themselves.
+  // Only key columns that are plain column references hold the column's value.
+  std::unordered_set<catalog::col_oid_t> key_col_oids;
+  for (const auto &key_col : accessor_->GetIndexSchema(op->GetIndexOID()).GetColumns()) {
+    const auto key_expr = key_col.StoredExpression();
+    if (key_expr->GetExpressionType() == parser::ExpressionType::COLUMN_VALUE) {
+      key_col_oids.emplace(key_expr.CastManagedPointerTo<const parser::ColumnValueExpression>()->GetColumnOid());
+    }
+  }
+  const bool index_only =
+      !op->GetIsForUpdate() && std::all_of(column_ids.cbegin(), column_ids.cend(), [&](const catalog::col_oid_t oid) {
+        return key_col_oids.count(oid) > 0;
+      });
+
   auto builder = planner::IndexScanPlanNode::Builder();
   builder.SetOutputSchema(std::move(output_schema));
   builder.SetScanPredicate(common::ManagedPointer(predicate));
   builder.SetIsForUpdateFlag(op->GetIsForUpdate());
+  builder.SetIndexOnly(index_only);
   builder.SetDatabaseOid(op->GetDatabaseOID());
   builder.SetNamespaceOid(op->GetNamespaceOID());
   builder.SetIndexOid(op->GetIndexOID());
@@ -313,12 +334,58 @@ void PlanGenerator::Visit(const QueryDerivedScan *op) {
 // Limit + Sort
 ///////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+/**
+ * Rebuilds an unfiltered ascending index scan so that it stops after the given number of tuples.
+ * @param scan the index scan to limit
+ * @param limit number of tuples the scan needs to produce
+ * @return the limited scan, or nullptr if the scan cannot stop early
+ */
+std::unique_ptr<planner::AbstractPlanNode> LimitIndexScan(const planner::IndexScanPlanNode &scan, const size_t limit) {
+  // A predicate is evaluated on the tuples the scan returns, so a limit on the scan could drop qualifying tuples
+  if (scan.GetScanPredicate() != nullptr || limit == 0 || limit > std::numeric_limits<uint32_t>::max()) return nullptr;
+  const auto type = scan.GetScanType();
+  if (type != planner::IndexScanType::AscendingClosed && type != planner::IndexScanType::AscendingOpenHigh &&
+      type != planner::IndexScanType::AscendingOpenLow && type != planner::IndexScanType::AscendingOpenBoth) {
+    return nullptr;
+  }
+  if (scan.ScanLimit() != 0 && scan.ScanLimit() <= limit) return nullptr;
+
+  auto column_oids = scan.GetColumnOids();
+  auto builder = planner::IndexScanPlanNode::Builder();
+  builder.SetOutputSchema(scan.GetOutputSchema()->Copy());
+  builder.SetScanPredicate(scan.GetScanPredicate());
+  builder.SetIsForUpdateFlag(scan.IsForUpdate());
+  builder.SetDatabaseOid(scan.GetDatabaseOid());
+  builder.SetNamespaceOid(scan.GetNamespaceOid());
+  builder.SetIndexOid(scan.GetIndexOid());
+  builder.SetTableOid(scan.GetTableOid());
+  builder.SetColumnOids(std::move(column_oids));
+  builder.SetScanType(type);
+  for (const auto &col : scan.GetLoIndexColumns()) builder.AddLoIndexColumn(col.first, col.second);
+  for (const auto &col : scan.GetHiIndexColumns()) builder.AddHiIndexColumn(col.first, col.second);
+  builder.SetScanLimit(static_cast<uint32_t>(limit));
+  builder.SetIndexOnly(scan.IsIndexOnly());
+  return builder.Build();
+}
+
+}  // namespace
+
 void PlanGenerator::Visit(const Limit *op) {
   // Generate order by + limit plan when there's internal sort order
   // Limit and sort have the same output schema as the child plan!
   TERRIER_ASSERT(children_plans_.size() == 1, "Limit needs 1 child plan");
   output_plan_ = std::move(children_plans_[0]);
 
+  // Without a sort, the limit only ever looks at the first limit + offset tuples of its child. An index scan can stop
+  // there instead of walking the rest of its range.
+  if (op->GetSortExpressions().empty() && output_plan_->GetPlanNodeType() == planner::PlanNodeType::INDEXSCAN) {
+    auto limited_scan = LimitIndexScan(*static_cast<const planner::IndexScanPlanNode *>(output_plan_.get()),
+                                       op->GetLimit() + op->GetOffset());
+    if (limited_scan != nullptr) output_plan_ = std::move(limited_scan);
+  }
+
   if (!op->GetSortExpressions().empty()) {
     // Build order by clause
     TERRIER_ASSERT(children_expr_map_.size() == 1, "Limit needs 1 child expr map");
@@ -504,9 +571,28 @@ void PlanGenerator::Visit(UNUSED_ATTRIBUTE const OuterNLJoin *op) { TERRIER_ASSE
 ///////////////////////////////////////////////////////////////////////////////
 
 void PlanGenerator::Visit(const InnerHashJoin *op) {
+  BuildHashJoinPlan(op->GetJoinPredicates(), op->GetLeftKeys(), op->GetRightKeys(), planner::LogicalJoinType::INNER);
+}
+
+void PlanGenerator::Visit(const LeftHashJoin *op) {
+  BuildHashJoinPlan(op->GetJoinPredicates(), op->GetLeftKeys(), op->GetRightKeys(), planner::LogicalJoinType::LEFT);
+}
+
+void PlanGenerator::Visit(const RightHashJoin *op) {
+  BuildHashJoinPlan(op->GetJoinPredicates(), op->GetLeftKeys(), op->GetRightKeys(), planner::LogicalJoinType::RIGHT);
+}
+
+void PlanGenerator::Visit(const OuterHashJoin *op) {
+  BuildHashJoinPlan(op->GetJoinPredicates(), op->GetLeftKeys(), op->GetRightKeys(), planner::LogicalJoinType::OUTER);
+}
+
+void PlanGenerator::BuildHashJoinPlan(const std::vector<AnnotatedExpression> &join_predicates,
+                                      const std::vector<common::ManagedPointer<parser::AbstractExpression>> &left_keys,
+                                      const std::vector<common::ManagedPointer<parser::AbstractExpression>> &right_keys,
+                                      const planner::LogicalJoinType join_type) {
   auto proj_schema = GenerateProjectionForJoin();
 
-  auto comb_pred = parser::ExpressionUtil::JoinAnnotatedExprs(op->GetJoinPredicates());
+  auto comb_pred = parser::ExpressionUtil::JoinAnnotatedExprs(join_predicates);
   auto eval_pred =
       parser::ExpressionUtil::EvaluateExpression(children_expr_map_, common::ManagedPointer(comb_pred.get()));
   auto join_predicate =
@@ -516,13 +602,13 @@ void PlanGenerator::Visit(const InnerHashJoin *op) {
   auto builder = planner::HashJoinPlanNode::Builder();
   builder.SetOutputSchema(std::move(proj_schema));
 
-  for (auto &expr : op->GetLeftKeys()) {
+  for (auto &expr : left_keys) {
     auto left_key = parser::ExpressionUtil::EvaluateExpression(children_expr_map_, expr).release();
     RegisterPointerCleanup<parser::AbstractExpression>(left_key, true, true);
     builder.AddLeftHashKey(common::ManagedPointer(left_key));
   }
 
-  for (auto &expr : op->GetRightKeys()) {
+  for (auto &expr : right_keys) {
     auto right_key = parser::ExpressionUtil::EvaluateExpression(children_expr_map_, expr).release();
     RegisterPointerCleanup<parser::AbstractExpression>(right_key, true, true);
     builder.AddRightHashKey(common::ManagedPointer(right_key));
@@ -531,20 +617,49 @@ void PlanGenerator::Visit(const InnerHashJoin *op) {
   builder.AddChild(std::move(children_plans_[0]));
   builder.AddChild(std::move(children_plans_[1]));
   builder.SetJoinPredicate(common::ManagedPointer(join_predicate));
-  builder.SetJoinType(planner::LogicalJoinType::INNER);
+  builder.SetJoinType(join_type);
+
+  // A build side (the left child) far larger than the cache is radix-partitioned, so every partition's table stays
+  // cache-resident while it is built and probed
+  const int build_rows = children_num_rows_.empty() ? -1 : children_num_rows_[0];
+  builder.SetPartitionedBuild(build_rows >= K_PARTITIONED_BUILD_MIN_ROWS);
   output_plan_ = builder.Build();
 }
 
-void PlanGenerator::Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) {
-  TERRIER_ASSERT(0, "LeftHashJoin not implemented");
-}
+///////////////////////////////////////////////////////////////////////////////
+// A mergejoin B (when both are already sorted on the join keys)
+///////////////////////////////////////////////////////////////////////////////
 
-void PlanGenerator::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) {
-  TERRIER_ASSERT(0, "RightHashJoin not implemented");
-}
+void PlanGenerator::Visit(const InnerMergeJoin *op) {
+  auto proj_schema = GenerateProjectionForJoin();
+
+  auto comb_pred = parser::ExpressionUtil::JoinAnnotatedExprs(op->GetJoinPredicates());
+  auto eval_pred =
+      parser::ExpressionUtil::EvaluateExpression(children_expr_map_, common::ManagedPointer(comb_pred.get()));
+  auto join_predicate =
+      parser::ExpressionUtil::ConvertExprCVNodes(common::ManagedPointer(eval_pred.get()), children_expr_map_).release();
+  RegisterPointerCleanup<parser::AbstractExpression>(join_predicate, true, true);
 
-void PlanGenerator::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {
-  TERRIER_ASSERT(0, "OuterHashJoin not implemented");
+  auto builder = planner::MergeJoinPlanNode::Builder();
+  builder.SetOutputSchema(std::move(proj_schema));
+
+  for (auto &expr : op->GetLeftKeys()) {
+    auto left_key = parser::ExpressionUtil::EvaluateExpression(children_expr_map_, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(left_key, true, true);
+    builder.AddLeftMergeKey(common::ManagedPointer(left_key));
+  }
+
+  for (auto &expr : op->GetRightKeys()) {
+    auto right_key = parser::ExpressionUtil::EvaluateExpression(children_expr_map_, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(right_key, true, true);
+    builder.AddRightMergeKey(common::ManagedPointer(right_key));
+  }
+
+  builder.AddChild(std::move(children_plans_[0]));
+  builder.AddChild(std::move(children_plans_[1]));
+  builder.SetJoinPredicate(common::ManagedPointer(join_predicate));
+  builder.SetJoinType(planner::LogicalJoinType::INNER);
+  output_plan_ = builder.Build();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -626,7 +741,7 @@ void PlanGenerator::Visit(const HashGroupBy *op) {
 }
 
 void PlanGenerator::Visit(const SortGroupBy *op) {
-  // Don't think this is ever visited since rule_impls.cpp does not create SortGroupBy
+  // The child is sorted on the group by columns, so that groups are aggregated one after the other
   auto having_predicates = parser::ExpressionUtil::JoinAnnotatedExprs(op->GetHaving());
   BuildAggregatePlan(planner::AggregateStrategyType::SORTED, &op->GetColumns(),
                      common::ManagedPointer(having_predicates.get()));
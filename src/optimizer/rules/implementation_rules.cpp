@@ -22,6 +22,45 @@
 
 namespace terrier::optimizer {
 
+namespace {
+// Whether the index holds every tuple it should, i.e., it is neither still catching up with the writes that ran
+// alongside its build nor left without some of them for good, so that scans may not miss tuples
+bool IndexIsUsable(catalog::CatalogAccessor *const accessor, const catalog::index_oid_t index) {
+  const auto index_ptr = accessor->GetIndex(index);
+  return index_ptr == nullptr || (!index_ptr->IsBuilding() && index_ptr->IsValid());
+}
+
+// Implements a logical join as a hash or merge join on the equi-join keys of its predicates. Joins without any
+// equi-join key can neither be hashed nor merged, and are left to the other implementations.
+template <typename LogicalJoin, typename EquiJoin>
+void TransformToEquiJoin(common::ManagedPointer<OperatorNode> input,
+                         std::vector<std::unique_ptr<OperatorNode>> *transformed, OptimizationContext *context) {
+  const auto join = input->GetOp().template As<LogicalJoin>();
+
+  auto children = input->GetChildren();
+  TERRIER_ASSERT(children.size() == 2, "Join should have two child");
+  auto left_group_id = children[0]->GetOp().As<LeafOperator>()->GetOriginGroup();
+  auto right_group_id = children[1]->GetOp().As<LeafOperator>()->GetOriginGroup();
+  auto &left_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(left_group_id)->GetTableAliases();
+  auto &right_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(right_group_id)->GetTableAliases();
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys;
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys;
+
+  std::vector<AnnotatedExpression> join_preds = join->GetJoinPredicates();
+  OptimizerUtil::ExtractEquiJoinKeys(join_preds, &left_keys, &right_keys, left_group_alias, right_group_alias);
+
+  TERRIER_ASSERT(right_keys.size() == left_keys.size(), "# left/right keys should equal");
+  std::vector<std::unique_ptr<OperatorNode>> child;
+  child.emplace_back(children[0]->Copy());
+  child.emplace_back(children[1]->Copy());
+  if (!left_keys.empty()) {
+    auto result = std::make_unique<OperatorNode>(
+        EquiJoin::Make(std::move(join_preds), std::move(left_keys), std::move(right_keys)), std::move(child));
+    transformed->emplace_back(std::move(result));
+  }
+}
+}  // namespace
+
 ///////////////////////////////////////////////////////////////////////////////
 /// LogicalGetToPhysicalTableFreeScan
 ///////////////////////////////////////////////////////////////////////////////
@@ -123,6 +162,7 @@ void LogicalGetToPhysicalIndexScan::Transform(common::ManagedPointer<OperatorNod
     if (IndexUtil::CheckSortProperty(sort_prop)) {
       auto indexes = accessor->GetIndexOids(get->GetTableOid());
       for (auto index : indexes) {
+        if (!IndexIsUsable(accessor, index)) continue;
         if (IndexUtil::SatisfiesSortWithIndex(accessor, sort_prop, get->GetTableOid(), index)) {
           std::vector<AnnotatedExpression> preds = get->GetPredicates();
           auto op = std::make_unique<OperatorNode>(
@@ -140,6 +180,7 @@ void LogicalGetToPhysicalIndexScan::Transform(common::ManagedPointer<OperatorNod
     // Find match index for the predicates
     auto indexes = accessor->GetIndexOids(get->GetTableOid());
     for (auto &index : indexes) {
+      if (!IndexIsUsable(accessor, index)) continue;
       planner::IndexScanType scan_type;
       std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> bounds;
       std::vector<AnnotatedExpression> preds = get->GetPredicates();
@@ -397,6 +438,42 @@ void LogicalGroupByToPhysicalHashGroupBy::Transform(common::ManagedPointer<Opera
   transformed->emplace_back(std::move(result));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalGroupByToPhysicalSortGroupBy
+///////////////////////////////////////////////////////////////////////////////
+LogicalGroupByToPhysicalSortGroupBy::LogicalGroupByToPhysicalSortGroupBy() {
+  type_ = RuleType::AGGREGATE_TO_SORT_AGGREGATE;
+  match_pattern_ = new Pattern(OpType::LOGICALAGGREGATEANDGROUPBY);
+
+  auto child = new Pattern(OpType::LEAF);
+  match_pattern_->AddChild(child);
+}
+
+bool LogicalGroupByToPhysicalSortGroupBy::Check(common::ManagedPointer<OperatorNode> plan,
+                                                OptimizationContext *context) const {
+  (void)context;
+  // Groups can only be told apart one after the other when there is something to sort them on
+  const auto agg_op = plan->GetOp().As<LogicalAggregateAndGroupBy>();
+  return !agg_op->GetColumns().empty();
+}
+
+void LogicalGroupByToPhysicalSortGroupBy::Transform(common::ManagedPointer<OperatorNode> input,
+                                                    std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                    UNUSED_ATTRIBUTE OptimizationContext *context) const {
+  const auto agg_op = input->GetOp().As<LogicalAggregateAndGroupBy>();
+  TERRIER_ASSERT(input->GetChildren().size() == 1, "LogicalAggregateAndGroupBy should have 1 child");
+
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> cols = agg_op->GetColumns();
+  std::vector<AnnotatedExpression> having = agg_op->GetHaving();
+
+  std::vector<std::unique_ptr<OperatorNode>> c;
+  auto child = input->GetChildren()[0]->Copy();
+  c.emplace_back(std::move(child));
+
+  auto result = std::make_unique<OperatorNode>(SortGroupBy::Make(std::move(cols), std::move(having)), std::move(c));
+  transformed->emplace_back(std::move(result));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// LogicalAggregateToPhysicalAggregate
 ///////////////////////////////////////////////////////////////////////////////
@@ -496,31 +573,104 @@ bool LogicalInnerJoinToPhysicalInnerHashJoin::Check(common::ManagedPointer<Opera
 
 void LogicalInnerJoinToPhysicalInnerHashJoin::Transform(common::ManagedPointer<OperatorNode> input,
                                                         std::vector<std::unique_ptr<OperatorNode>> *transformed,
-                                                        UNUSED_ATTRIBUTE OptimizationContext *context) const {
-  // first build an expression representing hash join
-  const auto inner_join = input->GetOp().As<LogicalInnerJoin>();
+                                                        OptimizationContext *context) const {
+  TransformToEquiJoin<LogicalInnerJoin, InnerHashJoin>(input, transformed, context);
+}
 
-  auto children = input->GetChildren();
-  TERRIER_ASSERT(children.size() == 2, "Inner Join should have two child");
-  auto left_group_id = children[0]->GetOp().As<LeafOperator>()->GetOriginGroup();
-  auto right_group_id = children[1]->GetOp().As<LeafOperator>()->GetOriginGroup();
-  auto &left_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(left_group_id)->GetTableAliases();
-  auto &right_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(right_group_id)->GetTableAliases();
-  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys;
-  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys;
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalInnerJoinToPhysicalInnerMergeJoin
+///////////////////////////////////////////////////////////////////////////////
+LogicalInnerJoinToPhysicalInnerMergeJoin::LogicalInnerJoinToPhysicalInnerMergeJoin() {
+  type_ = RuleType::INNER_JOIN_TO_MERGE_JOIN;
 
-  std::vector<AnnotatedExpression> join_preds = inner_join->GetJoinPredicates();
-  OptimizerUtil::ExtractEquiJoinKeys(join_preds, &left_keys, &right_keys, left_group_alias, right_group_alias);
+  match_pattern_ = new Pattern(OpType::LOGICALINNERJOIN);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
 
-  TERRIER_ASSERT(right_keys.size() == left_keys.size(), "# left/right keys should equal");
-  std::vector<std::unique_ptr<OperatorNode>> child;
-  child.emplace_back(children[0]->Copy());
-  child.emplace_back(children[1]->Copy());
-  if (!left_keys.empty()) {
-    auto result = std::make_unique<OperatorNode>(
-        InnerHashJoin::Make(std::move(join_preds), std::move(left_keys), std::move(right_keys)), std::move(child));
-    transformed->emplace_back(std::move(result));
-  }
+bool LogicalInnerJoinToPhysicalInnerMergeJoin::Check(common::ManagedPointer<OperatorNode> plan,
+                                                     OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalInnerJoinToPhysicalInnerMergeJoin::Transform(common::ManagedPointer<OperatorNode> input,
+                                                         std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                         OptimizationContext *context) const {
+  TransformToEquiJoin<LogicalInnerJoin, InnerMergeJoin>(input, transformed, context);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalLeftJoinToPhysicalLeftHashJoin
+///////////////////////////////////////////////////////////////////////////////
+LogicalLeftJoinToPhysicalLeftHashJoin::LogicalLeftJoinToPhysicalLeftHashJoin() {
+  type_ = RuleType::LEFT_JOIN_TO_HASH_JOIN;
+
+  match_pattern_ = new Pattern(OpType::LOGICALLEFTJOIN);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
+
+bool LogicalLeftJoinToPhysicalLeftHashJoin::Check(common::ManagedPointer<OperatorNode> plan,
+                                                  OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalLeftJoinToPhysicalLeftHashJoin::Transform(common::ManagedPointer<OperatorNode> input,
+                                                      std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                      OptimizationContext *context) const {
+  TransformToEquiJoin<LogicalLeftJoin, LeftHashJoin>(input, transformed, context);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalRightJoinToPhysicalRightHashJoin
+///////////////////////////////////////////////////////////////////////////////
+LogicalRightJoinToPhysicalRightHashJoin::LogicalRightJoinToPhysicalRightHashJoin() {
+  type_ = RuleType::RIGHT_JOIN_TO_HASH_JOIN;
+
+  match_pattern_ = new Pattern(OpType::LOGICALRIGHTJOIN);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
+
+bool LogicalRightJoinToPhysicalRightHashJoin::Check(common::ManagedPointer<OperatorNode> plan,
+                                                    OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalRightJoinToPhysicalRightHashJoin::Transform(common::ManagedPointer<OperatorNode> input,
+                                                        std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                        OptimizationContext *context) const {
+  TransformToEquiJoin<LogicalRightJoin, RightHashJoin>(input, transformed, context);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalOuterJoinToPhysicalOuterHashJoin
+///////////////////////////////////////////////////////////////////////////////
+LogicalOuterJoinToPhysicalOuterHashJoin::LogicalOuterJoinToPhysicalOuterHashJoin() {
+  type_ = RuleType::OUTER_JOIN_TO_HASH_JOIN;
+
+  match_pattern_ = new Pattern(OpType::LOGICALOUTERJOIN);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
+
+bool LogicalOuterJoinToPhysicalOuterHashJoin::Check(common::ManagedPointer<OperatorNode> plan,
+                                                    OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalOuterJoinToPhysicalOuterHashJoin::Transform(common::ManagedPointer<OperatorNode> input,
+                                                        std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                        OptimizationContext *context) const {
+  TransformToEquiJoin<LogicalOuterJoin, OuterHashJoin>(input, transformed, context);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -694,6 +844,9 @@ void LogicalCreateIndexToPhysicalCreateIndex::Transform(common::ManagedPointer<O
     case parser::IndexType::HASH:
       idx_type = storage::index::IndexType::HASHMAP;
       break;
+    case parser::IndexType::ART:
+      idx_type = storage::index::IndexType::ART;
+      break;
     default:
       TERRIER_ASSERT(false, "Unsupported index type encountered");
       break;
@@ -25,9 +25,18 @@ std::vector<ExprSet> ChildStatsDeriver::DeriveInputStats(GroupExpression *gexpr,
 // TODO(boweic): support stats derivation for derivedGet
 void ChildStatsDeriver::Visit(UNUSED_ATTRIBUTE const LogicalQueryDerivedGet *op) {}
 
-void ChildStatsDeriver::Visit(const LogicalInnerJoin *op) {
+void ChildStatsDeriver::Visit(const LogicalInnerJoin *op) { PassDownJoinCols(op->GetJoinPredicates()); }
+void ChildStatsDeriver::Visit(const LogicalLeftJoin *op) { PassDownJoinCols(op->GetJoinPredicates()); }
+void ChildStatsDeriver::Visit(const LogicalRightJoin *op) { PassDownJoinCols(op->GetJoinPredicates()); }
+void ChildStatsDeriver::Visit(const LogicalOuterJoin *op) { PassDownJoinCols(op->GetJoinPredicates()); }
+void ChildStatsDeriver::Visit(UNUSED_ATTRIBUTE const LogicalSemiJoin *op) {}
+
+// TODO(boweic): support stats of aggregation
+void ChildStatsDeriver::Visit(UNUSED_ATTRIBUTE const LogicalAggregateAndGroupBy *op) { PassDownRequiredCols(); }
+
+void ChildStatsDeriver::PassDownJoinCols(const std::vector<AnnotatedExpression> &join_predicates) {
   PassDownRequiredCols();
-  for (auto &annotated_expr : op->GetJoinPredicates()) {
+  for (auto &annotated_expr : join_predicates) {
     ExprSet expr_set;
     parser::ExpressionUtil::GetTupleValueExprs(&expr_set, annotated_expr.GetExpr());
     for (auto &col : expr_set) {
@@ -36,14 +45,6 @@ void ChildStatsDeriver::Visit(const LogicalInnerJoin *op) {
   }
 }
 
-void ChildStatsDeriver::Visit(UNUSED_ATTRIBUTE const LogicalLeftJoin *op) {}
-void ChildStatsDeriver::Visit(UNUSED_ATTRIBUTE const LogicalRightJoin *op) {}
-void ChildStatsDeriver::Visit(UNUSED_ATTRIBUTE const LogicalOuterJoin *op) {}
-void ChildStatsDeriver::Visit(UNUSED_ATTRIBUTE const LogicalSemiJoin *op) {}
-
-// TODO(boweic): support stats of aggregation
-void ChildStatsDeriver::Visit(UNUSED_ATTRIBUTE const LogicalAggregateAndGroupBy *op) { PassDownRequiredCols(); }
-
 void ChildStatsDeriver::PassDownRequiredCols() {
   for (auto &col : required_cols_) {
     // For now we only consider stats of single column
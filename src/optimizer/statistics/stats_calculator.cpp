@@ -95,7 +95,16 @@ void StatsCalculator::Visit(UNUSED_ATTRIBUTE const LogicalQueryDerivedGet *op) {
   }
 }
 
-void StatsCalculator::Visit(const LogicalInnerJoin *op) {
+void StatsCalculator::Visit(const LogicalInnerJoin *op) { CalculateJoinStats(op->GetJoinPredicates(), false, false); }
+
+void StatsCalculator::Visit(const LogicalLeftJoin *op) { CalculateJoinStats(op->GetJoinPredicates(), true, false); }
+
+void StatsCalculator::Visit(const LogicalRightJoin *op) { CalculateJoinStats(op->GetJoinPredicates(), false, true); }
+
+void StatsCalculator::Visit(const LogicalOuterJoin *op) { CalculateJoinStats(op->GetJoinPredicates(), true, true); }
+
+void StatsCalculator::CalculateJoinStats(const std::vector<AnnotatedExpression> &join_predicates,
+                                         const bool preserve_left, const bool preserve_right) {
   // Check if there's join condition
   TERRIER_ASSERT(gexpr_->GetChildrenGroupsSize() == 2, "Join must have two children");
   auto left_child_group = context_->GetMemo().GetGroupByID(gexpr_->GetChildGroupId(0));
@@ -105,7 +114,7 @@ void StatsCalculator::Visit(const LogicalInnerJoin *op) {
   // Calculate output num rows first
   if (root_group->GetNumRows() == -1) {
     size_t curr_rows = left_child_group->GetNumRows() * right_child_group->GetNumRows();
-    for (auto &annotated_expr : op->GetJoinPredicates()) {
+    for (auto &annotated_expr : join_predicates) {
       // See if there are join conditions
       if (annotated_expr.GetExpr()->GetExpressionType() == parser::ExpressionType::COMPARE_EQUAL &&
           annotated_expr.GetExpr()->GetChild(0)->GetExpressionType() == parser::ExpressionType::COLUMN_VALUE &&
@@ -120,6 +129,9 @@ void StatsCalculator::Visit(const LogicalInnerJoin *op) {
         }
       }
     }
+    // Outer joins output every row of their preserved sides at least once
+    if (preserve_left) curr_rows = std::max(curr_rows, static_cast<size_t>(left_child_group->GetNumRows()));
+    if (preserve_right) curr_rows = std::max(curr_rows, static_cast<size_t>(right_child_group->GetNumRows()));
     root_group->SetNumRows(static_cast<int>(curr_rows));
   }
 
@@ -9,6 +9,7 @@ namespace terrier::optimizer {
 common::ManagedPointer<TableStats> StatsStorage::GetTableStats(catalog::db_oid_t database_id,
                                                                catalog::table_oid_t table_id) {
   StatsStorageKey stats_storage_key = std::make_pair(database_id, table_id);
+  common::SharedLatch::ScopedSharedLatch guard(&latch_);
   auto table_it = table_stats_storage_.find(stats_storage_key);
 
   if (table_it != table_stats_storage_.end()) {
@@ -20,6 +21,7 @@ common::ManagedPointer<TableStats> StatsStorage::GetTableStats(catalog::db_oid_t
 bool StatsStorage::InsertTableStats(catalog::db_oid_t database_id, catalog::table_oid_t table_id,
                                     TableStats table_stats) {
   StatsStorageKey stats_storage_key = std::make_pair(database_id, table_id);
+  common::SharedLatch::ScopedExclusiveLatch guard(&latch_);
   auto table_it = table_stats_storage_.find(stats_storage_key);
 
   if (table_it != table_stats_storage_.end()) {
@@ -33,6 +35,7 @@ bool StatsStorage::InsertTableStats(catalog::db_oid_t database_id, catalog::tabl
 
 bool StatsStorage::DeleteTableStats(catalog::db_oid_t database_id, catalog::table_oid_t table_id) {
   StatsStorageKey stats_storage_key = std::make_pair(database_id, table_id);
+  common::SharedLatch::ScopedExclusiveLatch guard(&latch_);
   auto table_it = table_stats_storage_.find(stats_storage_key);
 
   if (table_it != table_stats_storage_.end()) {
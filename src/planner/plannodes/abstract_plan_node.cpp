@@ -26,6 +26,7 @@
 #include "planner/plannodes/index_scan_plan_node.h"
 #include "planner/plannodes/insert_plan_node.h"
 #include "planner/plannodes/limit_plan_node.h"
+#include "planner/plannodes/merge_join_plan_node.h"
 #include "planner/plannodes/nested_loop_join_plan_node.h"
 #include "planner/plannodes/order_by_plan_node.h"
 #include "planner/plannodes/plan_visitor.h"
@@ -185,6 +186,11 @@ JSONDeserializeNodeIntermediate DeserializePlanNode(const nlohmann::json &json)
       break;
     }
 
+    case PlanNodeType::MERGEJOIN: {
+      plan_node = std::make_unique<MergeJoinPlanNode>();
+      break;
+    }
+
     case PlanNodeType::NESTLOOP: {
       plan_node = std::make_unique<NestedLoopJoinPlanNode>();
       break;
@@ -19,6 +19,9 @@ common::hash_t HashJoinPlanNode::Hash() const {
     hash = common::HashUtil::CombineHashes(hash, right_hash_key->Hash());
   }
 
+  // Partitioned build
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(partitioned_build_));
+
   return hash;
 }
 
@@ -39,6 +42,9 @@ bool HashJoinPlanNode::operator==(const AbstractPlanNode &rhs) const {
     if (*right_hash_keys_[i] != *other.right_hash_keys_[i]) return false;
   }
 
+  // Partitioned build
+  if (partitioned_build_ != other.partitioned_build_) return false;
+
   return true;
 }
 
@@ -46,6 +52,7 @@ nlohmann::json HashJoinPlanNode::ToJson() const {
   nlohmann::json j = AbstractJoinPlanNode::ToJson();
   j["left_hash_keys"] = left_hash_keys_;
   j["right_hash_keys"] = right_hash_keys_;
+  j["partitioned_build"] = partitioned_build_;
   return j;
 }
 
@@ -78,6 +85,8 @@ std::vector<std::unique_ptr<parser::AbstractExpression>> HashJoinPlanNode::FromJ
     }
   }
 
+  partitioned_build_ = j.at("partitioned_build").get<bool>();
+
   return exprs;
 }
 
@@ -14,6 +14,8 @@ common::hash_t IndexScanPlanNode::Hash() const {
 
   hash = common::HashUtil::CombineHashInRange(hash, column_oids_.begin(), column_oids_.end());
 
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(index_only_));
+
   return hash;
 }
 
@@ -24,6 +26,8 @@ bool IndexScanPlanNode::operator==(const AbstractPlanNode &rhs) const {
 
   if (column_oids_ != other.column_oids_) return false;
 
+  if (index_only_ != other.index_only_) return false;
+
   // Index Oid
   return (index_oid_ == other.index_oid_);
 }
@@ -32,6 +36,7 @@ nlohmann::json IndexScanPlanNode::ToJson() const {
   nlohmann::json j = AbstractScanPlanNode::ToJson();
   j["index_oid"] = index_oid_;
   j["column_oids"] = column_oids_;
+  j["index_only"] = index_only_;
   return j;
 }
 
@@ -41,6 +46,7 @@ std::vector<std::unique_ptr<parser::AbstractExpression>> IndexScanPlanNode::From
   exprs.insert(exprs.end(), std::make_move_iterator(e1.begin()), std::make_move_iterator(e1.end()));
   index_oid_ = j.at("index_oid").get<catalog::index_oid_t>();
   column_oids_ = j.at("column_oids").get<std::vector<catalog::col_oid_t>>();
+  index_only_ = j.at("index_only").get<bool>();
   return exprs;
 }
 
@@ -5,7 +5,7 @@ namespace terrier::storage {
 void AccessObserver::ObserveGCInvocation() {
   gc_epoch_++;
   for (auto it = last_touched_.begin(), end = last_touched_.end(); it != end;) {
-    if (it->second + COLD_DATA_EPOCH_THRESHOLD < gc_epoch_) {
+    if (it->second + cold_epoch_threshold_ < gc_epoch_) {
       compactor_->PutInQueue(it->first);
       it = last_touched_.erase(it);
     } else {
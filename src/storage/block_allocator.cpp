@@ -0,0 +1,149 @@
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+
+#include "storage/storage_defs.h"
+
+// Older kernel headers do not spell out the huge page sizes
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+namespace terrier::storage {
+
+namespace {
+// Size of the chunks mapped for regular and 2MB pages. Chunks of 1GB pages are a single page.
+constexpr uint64_t K_CHUNK_SIZE = 32 * (1UL << 20);
+constexpr uint64_t K_HUGE_1GB = 1UL << 30;
+// Bits of the node masks passed to the kernel. Nodes beyond that are treated as unknown.
+constexpr uint64_t K_MAX_NODES = 64;
+}  // namespace
+
+BlockAllocator::~BlockAllocator() {
+  for (const auto &chunk : chunks_) munmap(reinterpret_cast<void *>(chunk.first), chunk.second.size_);
+}
+
+RawBlock *BlockAllocator::NewMapped() {
+  const uint32_t node = LocalNode();
+  auto &free_list = FreeList(node);
+  if (free_list.empty() && !MapChunk(node)) return nullptr;
+  RawBlock *const result = free_list.back();
+  free_list.pop_back();
+  return new (result) RawBlock;
+}
+
+void BlockAllocator::DeleteMapped(RawBlock *const block) {
+  const auto it = std::prev(chunks_.upper_bound(reinterpret_cast<uintptr_t>(block)));
+  TERRIER_ASSERT(reinterpret_cast<uintptr_t>(block) < it->first + it->second.size_,
+                 "Block was not allocated by this allocator.");
+  block->~RawBlock();
+  FreeList(it->second.node_).push_back(block);
+}
+
+uint64_t BlockAllocator::Reserve(const uint64_t num_blocks) {
+  if (!Mapped()) return 0;
+  const uint32_t num_nodes = numa_aware_ ? NumNumaNodes() : 1;
+  // Round up so that every node gets its share
+  const uint64_t per_node = (num_blocks + num_nodes - 1) / num_nodes;
+  for (uint32_t node = 0; node < num_nodes; node++) {
+    while (FreeList(node).size() < per_node)
+      if (!MapChunk(node)) break;
+  }
+  return NumFreeBlocks();
+}
+
+uint64_t BlockAllocator::NumFreeBlocks() const {
+  uint64_t result = 0;
+  for (const auto &free_list : free_blocks_) result += free_list.size();
+  return result;
+}
+
+bool BlockAllocator::MapChunk(const uint32_t node) {
+  const uint64_t chunk_size = page_size_ == BlockPageSize::HUGE_1GB ? K_HUGE_1GB : K_CHUNK_SIZE;
+  void *chunk = MAP_FAILED;
+  if (page_size_ != BlockPageSize::DEFAULT) {
+    // Huge page mappings are aligned to the page size, and thus to the size of a block
+    const int huge_flag = page_size_ == BlockPageSize::HUGE_1GB ? MAP_HUGE_1GB : MAP_HUGE_2MB;
+    chunk = mmap(nullptr, chunk_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | huge_flag,
+                 -1, 0);
+  }
+  if (chunk == MAP_FAILED) {
+    // No (more) huge pages are reserved with the kernel. Map regular pages with enough slack to align the chunk to a
+    // block, trim the slack and ask for transparent huge pages instead.
+    const uint64_t block_size = common::Constants::BLOCK_SIZE;
+    const uint64_t padded_size = chunk_size + block_size;
+    void *const padded = mmap(nullptr, padded_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (padded == MAP_FAILED) return false;
+    const auto padded_start = reinterpret_cast<uintptr_t>(padded);
+    const uintptr_t start = (padded_start + block_size - 1) & ~(block_size - 1);
+    if (start != padded_start) munmap(padded, start - padded_start);
+    const uint64_t tail = padded_start + padded_size - (start + chunk_size);
+    if (tail != 0) munmap(reinterpret_cast<void *>(start + chunk_size), tail);
+    chunk = reinterpret_cast<void *>(start);
+    if (page_size_ != BlockPageSize::DEFAULT) madvise(chunk, chunk_size, MADV_HUGEPAGE);
+  }
+
+  if (numa_aware_ && node < K_MAX_NODES) {
+    // Preferred rather than strict binding, so that a full node spills over instead of failing the insert. The kernel
+    // ignores the last bit of the mask it is told about.
+    const uint64_t node_mask = 1UL << node;
+    syscall(SYS_mbind, chunk, chunk_size, MPOL_PREFERRED, &node_mask, K_MAX_NODES + 1, 0);
+  }
+
+  // Fault in the whole chunk now, rather than on the first write into every page of a new block
+  const auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  auto *const bytes = reinterpret_cast<volatile byte *>(chunk);
+  for (uint64_t offset = 0; offset < chunk_size; offset += page_size) bytes[offset] = byte{0};
+
+  chunks_.emplace(reinterpret_cast<uintptr_t>(chunk), Chunk{chunk_size, node});
+  // Push in reverse so that blocks are handed out in address order
+  auto &free_list = FreeList(node);
+  for (uint64_t offset = chunk_size; offset > 0; offset -= common::Constants::BLOCK_SIZE)
+    free_list.push_back(reinterpret_cast<RawBlock *>(reinterpret_cast<byte *>(chunk) + offset -
+                                                     common::Constants::BLOCK_SIZE));
+  return true;
+}
+
+uint32_t BlockAllocator::LocalNode() const {
+  if (!numa_aware_) return 0;
+  return static_cast<uint32_t>(std::max(CurrentNumaNode(), 0));
+}
+
+std::vector<RawBlock *> &BlockAllocator::FreeList(const uint32_t node) {
+  if (node >= free_blocks_.size()) free_blocks_.resize(node + 1);
+  return free_blocks_[node];
+}
+
+int32_t BlockAllocator::NumaNode(const RawBlock *const block) {
+  int node = -1;
+  if (syscall(SYS_get_mempolicy, &node, nullptr, 0, block, MPOL_F_NODE | MPOL_F_ADDR) != 0) return -1;
+  return node;
+}
+
+int32_t BlockAllocator::CurrentNumaNode() {
+  unsigned cpu, node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return -1;
+  return static_cast<int32_t>(node);
+}
+
+uint32_t BlockAllocator::NumNumaNodes() {
+  uint64_t node_mask = 0;
+  if (syscall(SYS_get_mempolicy, nullptr, &node_mask, K_MAX_NODES, nullptr, MPOL_F_MEMS_ALLOWED) != 0 ||
+      node_mask == 0)
+    return 1;
+  // Nodes are numbered from 0, so the highest allowed node bounds the count
+  return static_cast<uint32_t>(K_MAX_NODES - static_cast<uint64_t>(__builtin_clzll(node_mask)));
+}
+
+}  // namespace terrier::storage
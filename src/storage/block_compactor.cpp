@@ -6,16 +6,44 @@
 #include <utility>
 #include <vector>
 
+#include "common/thread_context.h"
+#include "metrics/metrics_store.h"
 #include "storage/index/bwtree_index.h"
 #include "storage/index/index_defs.h"
 #include "storage/sql_table.h"
+#include "storage/varlen_arena.h"
 #include "transaction/transaction_util.h"
 
 namespace terrier::storage {
-void BlockCompactor::ProcessCompactionQueue(transaction::DeferredActionManager *deferred_action_manager,
-                                            transaction::TransactionManager *txn_manager) {
-  std::queue<RawBlock *> to_process = std::move(compaction_queue_);
-  while (!to_process.empty()) {
+uint32_t BlockCompactor::ProcessCompactionQueue(transaction::DeferredActionManager *deferred_action_manager,
+                                                transaction::TransactionManager *txn_manager,
+                                                const uint64_t max_blocks) {
+  const bool gc_metrics_enabled =
+      common::thread_context.metrics_store_ != nullptr &&
+      common::thread_context.metrics_store_->ComponentToRecord(metrics::MetricsComponent::GARBAGECOLLECTION);
+  if (gc_metrics_enabled) {
+    // start the operating unit resource tracker
+    common::thread_context.resource_tracker_.Start();
+  }
+
+  std::queue<RawBlock *> to_process;
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&queue_latch_);
+    if (compaction_queue_.size() <= max_blocks) {
+      to_process = std::move(compaction_queue_);
+      compaction_queue_ = std::queue<RawBlock *>();
+    } else {
+      for (uint64_t i = 0; i < max_blocks; i++) {
+        to_process.push(compaction_queue_.front());
+        compaction_queue_.pop();
+      }
+    }
+  }
+
+  const auto num_processed = static_cast<uint32_t>(to_process.size());
+  uint32_t num_frozen = 0;
+  uint64_t num_bytes_reclaimed = 0;
+  for (; !to_process.empty(); to_process.pop()) {
     RawBlock *block = to_process.front();
     BlockAccessController &controller = block->controller_;
     switch (controller.GetBlockState()->load()) {
@@ -44,17 +72,23 @@ void BlockCompactor::ProcessCompactionQueue(transaction::DeferredActionManager *
         break;
       }
       case BlockState::COOLING: {
-        if (!CheckForVersionsAndGaps(block->data_table_->accessor_, block)) continue;
+        if (!CheckForVersionsAndGaps(block->data_table_->accessor_, block)) {
+          // Versions of the compaction transaction may not have been pruned yet, so try again next time. If a writer
+          // heated the block back up instead, drop it. It will be observed again once it cools down.
+          if (controller.GetBlockState()->load() == BlockState::COOLING) PutInQueue(block);
+          break;
+        }
         // This is used to clean up any dangling pointers using a deferred action in GC.
         // We need this piece of memory to live on the heap, so its life time extends to
         // beyond this function call.
-        auto *loose_ptrs = new std::vector<const byte *>;
-        GatherVarlens(loose_ptrs, block, block->data_table_);
+        auto *loose_varlens = new std::vector<VarlenEntry>;
+        num_bytes_reclaimed += GatherVarlens(loose_varlens, block, block->data_table_);
         controller.GetBlockState()->store(BlockState::FROZEN);
+        num_frozen++;
         // When the old variable length values are no longer visible by running transactions, delete them.
         deferred_action_manager->RegisterDeferredAction([=]() {
-          for (auto *loose_ptr : *loose_ptrs) delete[] loose_ptr;
-          delete loose_ptrs;
+          for (const auto &loose_varlen : *loose_varlens) VarlenArena::Deallocate(loose_varlen);
+          delete loose_varlens;
         });
         break;
       }
@@ -65,8 +99,17 @@ void BlockCompactor::ProcessCompactionQueue(transaction::DeferredActionManager *
       default:
         throw std::runtime_error("unexpected control flow");
     }
-    to_process.pop();
   }
+
+  if (gc_metrics_enabled) {
+    // Stop the resource tracker for this operating unit
+    common::thread_context.resource_tracker_.Stop();
+    auto &resource_metrics = common::thread_context.resource_tracker_.GetMetrics();
+    common::thread_context.metrics_store_->RecordCompactionData(num_processed, num_frozen, num_bytes_reclaimed,
+                                                                resource_metrics);
+  }
+
+  return num_frozen;
 }
 
 bool BlockCompactor::EliminateGaps(CompactionGroup *cg) {
@@ -129,6 +172,8 @@ bool BlockCompactor::EliminateGaps(CompactionGroup *cg) {
       // when the next empty slot is logically after the next filled slot (which implies we are processing
       // an empty slot that would be empty in a compact block)
       if (taker == giver && filled_slot.GetOffset() < empty_slot.GetOffset()) break;
+      // Leave the block hot if we are not allowed to fill the gap
+      if (!move_tuples_) return false;
       // A failed move implies conflict
       if (!MoveTuple(cg, filled_slot, empty_slot)) return false;
     }
@@ -237,40 +282,203 @@ bool BlockCompactor::CheckForVersionsAndGaps(const TupleAccessStrategy &accessor
   return ret;
 }
 
-void BlockCompactor::GatherVarlens(std::vector<const byte *> *loose_ptrs, RawBlock *block, DataTable *table) {
+uint64_t BlockCompactor::GatherVarlens(std::vector<VarlenEntry> *loose_varlens, RawBlock *block, DataTable *table) {
   const TupleAccessStrategy &accessor = table->accessor_;
   const BlockLayout &layout = accessor.GetBlockLayout();
   ArrowBlockMetadata &metadata = accessor.GetArrowBlockMetadata(block);
+  uint64_t loose_bytes = 0;
 
   for (col_id_t col_id : layout.AllColumns()) {
     common::RawConcurrentBitmap *column_bitmap = accessor.ColumnNullBitmap(block, col_id);
+    ArrowColumnInfo &col_info = metadata.GetColumnInfo(layout, col_id);
     if (!layout.IsVarlen(col_id)) {
-      metadata.NullCount(col_id) = 0;
-      // Only need to count null for non-varlens
-      for (uint32_t i = 0; i < metadata.NumRecords(); i++)
-        if (!column_bitmap->Test(i)) metadata.NullCount(col_id)++;
+      const byte *values = accessor.ColumnStart(block, col_id);
+      switch (layout.AttrSize(col_id)) {
+        case sizeof(int8_t):
+          EncodeFixedLength(&metadata, col_id, column_bitmap, &col_info, reinterpret_cast<const int8_t *>(values));
+          break;
+        case sizeof(int16_t):
+          EncodeFixedLength(&metadata, col_id, column_bitmap, &col_info, reinterpret_cast<const int16_t *>(values));
+          break;
+        case sizeof(int32_t):
+          EncodeFixedLength(&metadata, col_id, column_bitmap, &col_info, reinterpret_cast<const int32_t *>(values));
+          break;
+        case sizeof(int64_t):
+          EncodeFixedLength(&metadata, col_id, column_bitmap, &col_info, reinterpret_cast<const int64_t *>(values));
+          break;
+        default:
+          // Not an integer, so only need to count nulls. The zone map stays as wide as the writers left it.
+          col_info = ArrowColumnInfo();
+          col_info.Type() = ArrowColumnType::FIXED_LENGTH;
+          metadata.NullCount(col_id) = 0;
+          for (uint32_t i = 0; i < metadata.NumRecords(); i++)
+            if (!column_bitmap->Test(i)) metadata.NullCount(col_id)++;
+          continue;
+      }
+      // Nobody can write to the block while it is freezing, so narrow the zone map down to the live values, whose
+      // range the encoding pass has already computed
+      ColumnZoneMap &zone_map = metadata.GetZoneMap(layout, col_id);
+      if (metadata.NullCount(col_id) == metadata.NumRecords())
+        zone_map.Reset();
+      else
+        zone_map.Set(col_info.EncodedColumn().Min(), col_info.EncodedColumn().Max());
       continue;
     }
 
     // Otherwise, the column is varlen, need to first check what to do for it
-    ArrowColumnInfo &col_info = metadata.GetColumnInfo(layout, col_id);
     auto *values = reinterpret_cast<VarlenEntry *>(accessor.ColumnStart(block, col_id));
+    if (col_info.Type() == ArrowColumnType::FIXED_LENGTH)
+      col_info.Type() = ChooseVarlenType(metadata, column_bitmap, values);
     switch (col_info.Type()) {
       case ArrowColumnType::GATHERED_VARLEN:
-        CopyToArrowVarlen(loose_ptrs, &metadata, col_id, column_bitmap, &col_info, values);
+        loose_bytes += CopyToArrowVarlen(loose_varlens, &metadata, col_id, column_bitmap, &col_info, values);
         break;
       case ArrowColumnType::DICTIONARY_COMPRESSED:
-        BuildDictionary(loose_ptrs, &metadata, col_id, column_bitmap, &col_info, values);
+        loose_bytes += BuildDictionary(loose_varlens, &metadata, col_id, column_bitmap, &col_info, values);
         break;
       default:
         throw std::runtime_error("unexpected control flow");
     }
   }
+  return loose_bytes;
+}
+
+ArrowColumnType BlockCompactor::ChooseVarlenType(const ArrowBlockMetadata &metadata,
+                                                 common::RawConcurrentBitmap *column_bitmap,
+                                                 const VarlenEntry *values) {
+  // Both layouts keep one 64-bit word per value (an offset or a code), but a dictionary only stores every distinct
+  // word once, along with its offset
+  VarlenEntryMap<uint32_t> distinct;
+  uint64_t total_size = 0, distinct_size = 0;
+  for (uint32_t i = 0; i < metadata.NumRecords(); i++) {
+    if (!column_bitmap->Test(i)) continue;
+    total_size += values[i].Size();
+    if (distinct.emplace(values[i], 0).second) distinct_size += values[i].Size();
+  }
+  return distinct_size + sizeof(uint64_t) * distinct.size() < total_size
+             ? ArrowColumnType::DICTIONARY_COMPRESSED
+             : ArrowColumnType::GATHERED_VARLEN;
+}
+
+namespace {
+// Number of bits needed to store every integer in [0, range]
+uint8_t BitsFor(const uint64_t range) { return range == 0 ? 0 : static_cast<uint8_t>(64 - __builtin_clzll(range)); }
+
+// Number of bytes taken up by the given number of packed integers, including the padding word
+uint64_t PackedSize(const uint32_t num_values, const uint8_t bit_width) {
+  return ((static_cast<uint64_t>(num_values) * bit_width + 63) / 64 + 1) * sizeof(uint64_t);
 }
+}  // namespace
 
-void BlockCompactor::CopyToArrowVarlen(std::vector<const byte *> *loose_ptrs, ArrowBlockMetadata *metadata,
-                                       col_id_t col_id, common::RawConcurrentBitmap *column_bitmap,
-                                       ArrowColumnInfo *col, VarlenEntry *values) {
+template <typename T>
+void BlockCompactor::EncodeFixedLength(ArrowBlockMetadata *metadata, col_id_t col_id,
+                                       common::RawConcurrentBitmap *column_bitmap, ArrowColumnInfo *col,
+                                       const T *values) {
+  const uint32_t num_records = metadata->NumRecords();
+  ArrowColumnInfo new_col_info;
+  new_col_info.Type() = ArrowColumnType::FIXED_LENGTH;
+
+  metadata->NullCount(col_id) = 0;
+  uint32_t first_non_null = num_records;
+  for (uint32_t i = 0; i < num_records; i++) {
+    if (!column_bitmap->Test(i))
+      metadata->NullCount(col_id)++;
+    else if (first_non_null == num_records)
+      first_non_null = i;
+  }
+  if (first_non_null == num_records) {
+    *col = std::move(new_col_info);
+    return;
+  }
+
+  // Nulls are encoded as the value before them, which neither starts a new run nor widens any range. Leading nulls
+  // take on the first value.
+  int64_t prev = values[first_non_null];
+  const auto encoded_value = [&](const uint32_t i) {
+    if (column_bitmap->Test(i)) prev = values[i];
+    return prev;
+  };
+
+  // Gather the statistics for all encodings in one pass
+  int64_t min = prev, max = prev, min_delta = 0, max_delta = 0;
+  uint32_t num_runs = 1;
+  bool deltas_fit = true;
+  for (uint32_t i = 1; i < num_records; i++) {
+    const int64_t last = prev, value = encoded_value(i);
+    min = std::min(min, value);
+    max = std::max(max, value);
+    if (value != last) num_runs++;
+    int64_t delta;
+    deltas_fit &= !__builtin_sub_overflow(value, last, &delta);
+    min_delta = i == 1 ? delta : std::min(min_delta, delta);
+    max_delta = i == 1 ? delta : std::max(max_delta, delta);
+  }
+  const uint8_t for_bits = BitsFor(static_cast<uint64_t>(max) - static_cast<uint64_t>(min));
+  const uint8_t delta_bits = BitsFor(static_cast<uint64_t>(max_delta) - static_cast<uint64_t>(min_delta));
+  const uint32_t num_anchors = (num_records - 1) / ArrowEncodedColumn::K_DELTA_ANCHOR_INTERVAL + 1;
+
+  // Pick the smallest encoding, preferring the ones that are cheaper to evaluate predicates on when sizes are equal.
+  // The plain values stay in the block, so an encoding is only worth its memory if it is a fraction of their size.
+  uint64_t best_size = static_cast<uint64_t>(num_records) * sizeof(T) / ArrowEncodedColumn::K_MAX_SIZE_DIVISOR + 1;
+  const uint64_t rle_size = num_runs * (sizeof(int64_t) + sizeof(uint32_t));
+  const uint64_t for_size = PackedSize(num_records, for_bits);
+  const uint64_t delta_size = PackedSize(num_records, delta_bits) + num_anchors * sizeof(int64_t);
+  if (rle_size < best_size) {
+    best_size = rle_size;
+    new_col_info.Type() = ArrowColumnType::RUN_LENGTH_ENCODED;
+  }
+  if (for_size < best_size) {
+    best_size = for_size;
+    new_col_info.Type() = ArrowColumnType::FRAME_OF_REFERENCE;
+  }
+  if (deltas_fit && delta_size < best_size) new_col_info.Type() = ArrowColumnType::DELTA_ENCODED;
+
+  ArrowEncodedColumn &encoded = new_col_info.EncodedColumn();
+  encoded.Min() = min;
+  encoded.Max() = max;
+  prev = values[first_non_null];
+  switch (new_col_info.Type()) {
+    case ArrowColumnType::RUN_LENGTH_ENCODED: {
+      encoded.AllocateRuns(num_runs, true);
+      uint32_t run = 0;
+      encoded.RunValues()[0] = prev;
+      for (uint32_t i = 1; i < num_records; i++) {
+        const int64_t last = prev, value = encoded_value(i);
+        if (value == last) continue;
+        encoded.RunEnds()[run++] = i;
+        encoded.RunValues()[run] = value;
+      }
+      encoded.RunEnds()[run] = num_records;
+      TERRIER_ASSERT(run + 1 == num_runs, "should have seen the same number of runs as during the first pass");
+      break;
+    }
+    case ArrowColumnType::FRAME_OF_REFERENCE:
+      encoded.AllocatePacked(num_records, for_bits);
+      for (uint32_t i = 0; i < num_records; i++)
+        encoded.Pack(i, static_cast<uint64_t>(encoded_value(i)) - static_cast<uint64_t>(min));
+      break;
+    case ArrowColumnType::DELTA_ENCODED:
+      encoded.Reference() = min_delta;
+      encoded.AllocateRuns(num_anchors, false);
+      encoded.AllocatePacked(num_records, delta_bits);
+      for (uint32_t i = 0; i < num_records; i++) {
+        const int64_t last = prev, value = encoded_value(i);
+        if (i % ArrowEncodedColumn::K_DELTA_ANCHOR_INTERVAL == 0)
+          encoded.RunValues()[i / ArrowEncodedColumn::K_DELTA_ANCHOR_INTERVAL] = value;
+        if (i > 0) encoded.Pack(i, static_cast<uint64_t>(value - last) - static_cast<uint64_t>(min_delta));
+      }
+      break;
+    default:
+      // Plain values are smallest
+      break;
+  }
+  *col = std::move(new_col_info);
+}
+
+uint64_t BlockCompactor::CopyToArrowVarlen(std::vector<VarlenEntry> *loose_varlens, ArrowBlockMetadata *metadata,
+                                           col_id_t col_id, common::RawConcurrentBitmap *column_bitmap,
+                                           ArrowColumnInfo *col, VarlenEntry *values) {
+  uint64_t loose_bytes = 0;
   uint32_t varlen_size = 0;
   // Read through every tuple and update null count and total varlen size
   metadata->NullCount(col_id) = 0;
@@ -295,7 +503,10 @@ void BlockCompactor::CopyToArrowVarlen(std::vector<const byte *> *loose_ptrs, Ar
     std::memcpy(new_col.Values() + acc, entry.Content(), entry.Size());
 
     // Need to GC
-    if (entry.NeedReclaim()) loose_ptrs->push_back(entry.Content());
+    if (entry.NeedReclaim()) {
+      loose_varlens->push_back(entry);
+      loose_bytes += entry.Size();
+    }
 
     // Because this change does not change the logical content of the database, and reads of aligned qwords on
     // modern architectures are atomic anyways, this is still safe for possible concurrent readers. The deferred
@@ -307,11 +518,13 @@ void BlockCompactor::CopyToArrowVarlen(std::vector<const byte *> *loose_ptrs, Ar
   }
   new_col.Offsets()[metadata->NumRecords()] = new_col.ValuesLength();
   col->VarlenColumn() = std::move(new_col);
+  return loose_bytes;
 }
 
-void BlockCompactor::BuildDictionary(std::vector<const byte *> *loose_ptrs, ArrowBlockMetadata *metadata,
-                                     col_id_t col_id, common::RawConcurrentBitmap *column_bitmap, ArrowColumnInfo *col,
-                                     VarlenEntry *values) {
+uint64_t BlockCompactor::BuildDictionary(std::vector<VarlenEntry> *loose_varlens, ArrowBlockMetadata *metadata,
+                                         col_id_t col_id, common::RawConcurrentBitmap *column_bitmap,
+                                         ArrowColumnInfo *col, VarlenEntry *values) {
+  uint64_t loose_bytes = 0;
   VarlenEntryMap<uint32_t> dictionary;
   // Read through every tuple and update null count and build the dictionary
   uint32_t varlen_size = 0;
@@ -354,7 +567,10 @@ void BlockCompactor::BuildDictionary(std::vector<const byte *> *loose_ptrs, Arro
     // Only do a gather operation if the column is varlen
     VarlenEntry &entry = values[i];
     // Need to GC
-    if (entry.NeedReclaim()) loose_ptrs->push_back(entry.Content());
+    if (entry.NeedReclaim()) {
+      loose_varlens->push_back(entry);
+      loose_bytes += entry.Size();
+    }
     uint64_t dictionary_code = new_col_info.Indices()[i] = dictionary[entry];
 
     byte *dictionary_word = new_col.Values() + new_col.Offsets()[dictionary_code];
@@ -365,6 +581,7 @@ void BlockCompactor::BuildDictionary(std::vector<const byte *> *loose_ptrs, Arro
       entry = VarlenEntry::Create(dictionary_word, entry.Size(), false);
   }
   *col = std::move(new_col_info);
+  return loose_bytes;
 }
 
 }  // namespace terrier::storage
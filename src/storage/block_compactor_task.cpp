@@ -0,0 +1,30 @@
+#include "storage/block_compactor_task.h"
+
+#include <thread>  // NOLINT
+
+namespace terrier::storage {
+
+void BlockCompactorTask::RunTask() {
+  run_task_ = true;
+  while (run_task_) {
+    {
+      std::unique_lock<std::mutex> lock(run_lock_);
+      run_cv_.wait_for(lock, compaction_interval_, [&] { return !run_task_; });
+    }
+    // Blocks left in the queue at shutdown are simply not frozen, which is always safe
+    if (run_task_) compactor_->ProcessCompactionQueue(deferred_action_manager_, txn_manager_, compaction_batch_size_);
+  }
+}
+
+void BlockCompactorTask::Terminate() {
+  // If the task hasn't run yet, yield the thread until it's started
+  while (!run_task_) std::this_thread::yield();
+  TERRIER_ASSERT(run_task_, "Cant terminate a task that isnt running");
+  {
+    std::lock_guard<std::mutex> lock(run_lock_);
+    run_task_ = false;
+  }
+  run_cv_.notify_one();
+}
+
+}  // namespace terrier::storage
@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <cstring>
 #include <list>
 
 #include "common/allocator.h"
+#include "common/constants.h"
 #include "storage/block_access_controller.h"
 #include "storage/data_table.h"
 #include "storage/storage_util.h"
@@ -28,7 +31,7 @@ DataTable::~DataTable() {
   common::SpinLatch::ScopedSpinLatch guard(&blocks_latch_);
   for (RawBlock *block : blocks_) {
     StorageUtil::DeallocateVarlens(block, accessor_);
-    for (col_id_t i : accessor_.GetBlockLayout().Varlens())
+    for (col_id_t i : accessor_.GetBlockLayout().AllColumns())
       accessor_.GetArrowBlockMetadata(block).GetColumnInfo(accessor_.GetBlockLayout(), i).Deallocate();
     block_store_->Release(block);
   }
@@ -42,21 +45,164 @@ bool DataTable::Select(const common::ManagedPointer<transaction::TransactionCont
 
 void DataTable::Scan(const common::ManagedPointer<transaction::TransactionContext> txn, SlotIterator *const start_pos,
                      ProjectedColumns *const out_buffer) const {
-  // TODO(Tianyu): So far this is not that much better than tuple-at-a-time access,
-  // but can be improved if block is read-only, or if we implement version synopsis, to just use std::memcpy when it's
-  // safe
+  const SlotIterator end_pos = end();
+  const uint32_t num_slots_in_block = accessor_.GetBlockLayout().NumSlots();
   uint32_t filled = 0;
-  while (filled < out_buffer->MaxTuples() && *start_pos != end()) {
+  // Work a block at a time, so that runs of slots without versions can be copied column by column
+  while (filled < out_buffer->MaxTuples() && *start_pos != end_pos) {
+    RawBlock *const block = (*start_pos)->GetBlock();
+    const uint32_t offset = (*start_pos)->GetOffset();
+    const uint32_t block_end = end_pos->GetBlock() == block ? end_pos->GetOffset() : num_slots_in_block;
+    const uint32_t num_slots = std::min(block_end - offset, out_buffer->MaxTuples() - filled);
+    filled = ScanBlock(txn, block, offset, num_slots, out_buffer, filled);
+    // Point at the last slot scanned, so that the increment takes care of moving on to the next block
+    start_pos->current_slot_ = {block, offset + num_slots - 1};
+    ++(*start_pos);
+  }
+  out_buffer->SetNumTuples(filled);
+}
+
+bool DataTable::TryViewFrozen(SlotIterator *const start_pos, const ProjectedColumns &projection,
+                              FrozenColumnsView *const view) const {
+  TERRIER_ASSERT(view->Block() == nullptr, "The view should have been released.");
+  const SlotIterator end_pos = end();
+  if (*start_pos == end_pos) return false;
+  RawBlock *const block = (*start_pos)->GetBlock();
+  const uint32_t offset = (*start_pos)->GetOffset();
+  // The view shares the block's null bitmaps, so it has to start on a byte boundary of them
+  if (offset % BYTE_SIZE != 0 || !block->controller_.TryAcquireInPlaceRead()) return false;
+
+  // Compaction leaves no gaps in a frozen block, so every slot up to the number of records holds a tuple
+  const BlockLayout &layout = accessor_.GetBlockLayout();
+  ArrowBlockMetadata &metadata = accessor_.GetArrowBlockMetadata(block);
+  const uint32_t block_end = end_pos->GetBlock() == block ? end_pos->GetOffset() : layout.NumSlots();
+  const uint32_t records_end = std::min(block_end, metadata.NumRecords());
+  const uint32_t num_tuples = offset < records_end ? std::min(records_end - offset, projection.MaxTuples()) : 0;
+  // Skip straight to the next block once the records run out, as the rest of the slots are empty
+  const uint32_t next_offset = offset + num_tuples >= records_end ? block_end : offset + num_tuples;
+  start_pos->current_slot_ = {block, next_offset - 1};
+  ++(*start_pos);
+  if (num_tuples == 0) {
+    block->controller_.ReleaseInPlaceRead();
+    return true;
+  }
+
+  const uint16_t num_cols = projection.NumColumns();
+  view->column_starts_.resize(num_cols);
+  view->column_null_bitmaps_.resize(num_cols);
+  view->dictionary_codes_.resize(num_cols);
+  view->dictionaries_.resize(num_cols);
+  view->encoded_columns_.resize(num_cols);
+  for (uint16_t i = 0; i < num_cols; i++) {
+    const col_id_t col_id = projection.ColumnIds()[i];
+    TERRIER_ASSERT(col_id != VERSION_POINTER_COLUMN_ID, "Projection should not read the version pointer column.");
+    view->column_starts_[i] = accessor_.ColumnStart(block, col_id) + layout.AttrSize(col_id) * offset;
+    // Nobody writes to a frozen block, so the concurrent bitmap can be read as a plain one with the same layout
+    view->column_null_bitmaps_[i] = reinterpret_cast<const common::RawBitmap *>(
+        reinterpret_cast<const uint8_t *>(accessor_.ColumnNullBitmap(block, col_id)) + offset / BYTE_SIZE);
+    view->dictionary_codes_[i] = nullptr;
+    view->dictionaries_[i] = nullptr;
+    view->encoded_columns_[i] = nullptr;
+    ArrowColumnInfo &col_info = metadata.GetColumnInfo(layout, col_id);
+    if (!layout.IsVarlen(col_id)) {
+      if (col_info.IsEncoded()) view->encoded_columns_[i] = &col_info;
+      continue;
+    }
+    if (col_info.Type() == ArrowColumnType::DICTIONARY_COMPRESSED) {
+      view->dictionary_codes_[i] = col_info.Indices() + offset;
+      view->dictionaries_[i] = &col_info.VarlenColumn();
+    }
+  }
+  view->block_ = block;
+  view->offset_ = offset;
+  view->num_tuples_ = num_tuples;
+  return true;
+}
+
+bool DataTable::TrySkipBlock(SlotIterator *const start_pos, const ProjectedColumns &projection,
+                             const std::vector<ZoneRange> &ranges) const {
+  const SlotIterator end_pos = end();
+  if (*start_pos == end_pos) return false;
+  RawBlock *const block = (*start_pos)->GetBlock();
+  const BlockLayout &layout = accessor_.GetBlockLayout();
+  const ArrowBlockMetadata &metadata = accessor_.GetArrowBlockMetadata(block);
+  for (const auto &range : ranges) {
+    const col_id_t col_id = projection.ColumnIds()[range.projection_list_index_];
+    TERRIER_ASSERT(!layout.IsVarlen(col_id), "Zone maps are not maintained for varlen columns.");
+    if (metadata.GetZoneMap(layout, col_id).MayContain(range.lo_, range.hi_, range.is_unsigned_)) continue;
+    const uint32_t block_end = end_pos->GetBlock() == block ? end_pos->GetOffset() : layout.NumSlots();
+    start_pos->current_slot_ = {block, block_end - 1};
+    ++(*start_pos);
+    return true;
+  }
+  return false;
+}
+
+uint32_t DataTable::ScanBlock(const common::ManagedPointer<transaction::TransactionContext> txn, RawBlock *const block,
+                              const uint32_t offset, const uint32_t num_slots, ProjectedColumns *const out_buffer,
+                              uint32_t filled) const {
+  // Frozen blocks hold no versions, and writers have to wait for in-place readers to leave before they can thaw the
+  // block, so there is no need to look at version pointers at all
+  const bool in_place = block->controller_.TryAcquireInPlaceRead();
+  const auto materialize = [&](const TupleSlot slot) {
     ProjectedColumns::RowView row = out_buffer->InterpretAsRow(filled);
-    const TupleSlot slot = **start_pos;
     // Only fill the buffer with valid, visible tuples
     if (SelectIntoBuffer(txn, slot, &row)) {
       out_buffer->TupleSlots()[filled] = slot;
       filled++;
     }
-    ++(*start_pos);
+  };
+
+  const uint32_t end = offset + num_slots;
+  uint32_t current = offset;
+  while (current < end) {
+    // Find the longest run of visible tuples without versions, which every transaction sees as they are in the block
+    const uint32_t run_start = current;
+    for (; current < end; current++) {
+      const TupleSlot slot(block, current);
+      if (!in_place && AtomicallyReadVersionPtr(slot, accessor_) != nullptr) break;
+      if (!Visible(slot, accessor_)) break;
+    }
+
+    if (current > run_start) {
+      const uint32_t run_length = current - run_start;
+      CopyColumnSegments(block, run_start, run_length, out_buffer, filled);
+      // Writers install a version before they modify a tuple in place, so the copy is consistent unless a version
+      // showed up in the meantime. Same as in SelectIntoBuffer, this relies on aborted versions not being unlinked
+      // while we can still be reading.
+      bool unchanged = true;
+      for (uint32_t i = run_start; !in_place && unchanged && i < current; i++)
+        unchanged = AtomicallyReadVersionPtr({block, i}, accessor_) == nullptr;
+      if (unchanged) {
+        filled += run_length;
+      } else {
+        for (uint32_t i = run_start; i < current; i++) materialize({block, i});
+      }
+    }
+
+    // The slot that ended the run either has versions to replay or is not visible, which Select sorts out
+    if (current < end) materialize({block, current++});
   }
-  out_buffer->SetNumTuples(filled);
+
+  if (in_place) block->controller_.ReleaseInPlaceRead();
+  return filled;
+}
+
+void DataTable::CopyColumnSegments(RawBlock *const block, const uint32_t offset, const uint32_t num_slots,
+                                   ProjectedColumns *const out_buffer, const uint32_t out_offset) const {
+  const BlockLayout &layout = accessor_.GetBlockLayout();
+  for (uint16_t i = 0; i < out_buffer->NumColumns(); i++) {
+    const col_id_t col_id = out_buffer->ColumnIds()[i];
+    TERRIER_ASSERT(col_id != VERSION_POINTER_COLUMN_ID, "Output buffer should not read the version pointer column.");
+    const uint16_t attr_size = layout.AttrSize(col_id);
+    // Values are copied regardless of their null bit, which is harmless because null values are never read
+    std::memcpy(out_buffer->ColumnStart(i) + attr_size * out_offset,
+                accessor_.ColumnStart(block, col_id) + attr_size * offset, attr_size * num_slots);
+    const common::RawConcurrentBitmap *const nulls = accessor_.ColumnNullBitmap(block, col_id);
+    common::RawBitmap *const out_nulls = out_buffer->ColumnNullBitmap(i);
+    for (uint32_t j = 0; j < num_slots; j++) out_nulls->Set(out_offset + j, nulls->Test(offset + j));
+  }
+  for (uint32_t j = 0; j < num_slots; j++) out_buffer->TupleSlots()[out_offset + j] = {block, offset + j};
 }
 
 DataTable::SlotIterator &DataTable::SlotIterator::operator++() {
@@ -430,4 +576,21 @@ bool DataTable::IsVisible(const transaction::TransactionContext &txn, const Tupl
   return visible;
 }
 
+uint32_t DataTable::FilterVisible(const transaction::TransactionContext &txn, const TupleSlot *const slots,
+                                  const uint32_t num_slots, uint32_t *const visible) const {
+  for (uint32_t idx = 0; idx < num_slots && idx < common::Constants::K_PREFETCH_DISTANCE; idx++) {
+    __builtin_prefetch(accessor_.AccessWithoutNullCheck(slots[idx], VERSION_POINTER_COLUMN_ID));
+  }
+
+  uint32_t num_visible = 0;
+  for (uint32_t idx = 0, prefetch_idx = common::Constants::K_PREFETCH_DISTANCE; idx < num_slots;
+       idx++, prefetch_idx++) {
+    if (prefetch_idx < num_slots) {
+      __builtin_prefetch(accessor_.AccessWithoutNullCheck(slots[prefetch_idx], VERSION_POINTER_COLUMN_ID));
+    }
+    if (IsVisible(txn, slots[idx])) visible[num_visible++] = idx;
+  }
+  return num_visible;
+}
+
 }  // namespace terrier::storage
@@ -28,7 +28,6 @@ std::pair<uint32_t, uint32_t> GarbageCollector::PerformGarbageCollection() {
   STORAGE_LOG_TRACE("GarbageCollector::PerformGarbageCollection(): last_unlinked_: {}",
                     static_cast<uint64_t>(last_unlinked_));
   ProcessDeferredActions(oldest_txn);
-  ProcessIndexes();
   return std::make_pair(txns_deallocated, txns_unlinked);
 }
 
@@ -212,7 +211,7 @@ void GarbageCollector::ReclaimBufferIfVarlen(transaction::TransactionContext *co
         // Okay to include version vector, as it is never varlen
         if (layout.IsVarlen(col_id)) {
           auto *varlen = reinterpret_cast<VarlenEntry *>(accessor.AccessWithNullCheck(undo_record->Slot(), col_id));
-          if (varlen != nullptr && varlen->NeedReclaim()) txn->loose_ptrs_.push_back(varlen->Content());
+          if (varlen != nullptr && varlen->NeedReclaim()) txn->loose_varlens_.push_back(*varlen);
         }
       }
       break;
@@ -222,7 +221,7 @@ void GarbageCollector::ReclaimBufferIfVarlen(transaction::TransactionContext *co
         col_id_t col_id = undo_record->Delta()->ColumnIds()[i];
         if (layout.IsVarlen(col_id)) {
           auto *varlen = reinterpret_cast<VarlenEntry *>(undo_record->Delta()->AccessWithNullCheck(i));
-          if (varlen != nullptr && varlen->NeedReclaim()) txn->loose_ptrs_.push_back(varlen->Content());
+          if (varlen != nullptr && varlen->NeedReclaim()) txn->loose_varlens_.push_back(*varlen);
         }
       }
       break;
@@ -231,23 +230,4 @@ void GarbageCollector::ReclaimBufferIfVarlen(transaction::TransactionContext *co
   }
 }
 
-void GarbageCollector::RegisterIndexForGC(const common::ManagedPointer<index::Index> index) {
-  TERRIER_ASSERT(index != nullptr, "Index cannot be nullptr.");
-  common::SharedLatch::ScopedExclusiveLatch guard(&indexes_latch_);
-  TERRIER_ASSERT(indexes_.count(index) == 0, "Trying to register an index that has already been registered.");
-  indexes_.insert(index);
-}
-
-void GarbageCollector::UnregisterIndexForGC(const common::ManagedPointer<index::Index> index) {
-  TERRIER_ASSERT(index != nullptr, "Index cannot be nullptr.");
-  common::SharedLatch::ScopedExclusiveLatch guard(&indexes_latch_);
-  TERRIER_ASSERT(indexes_.count(index) == 1, "Trying to unregister an index that has not been registered.");
-  indexes_.erase(index);
-}
-
-void GarbageCollector::ProcessIndexes() {
-  common::SharedLatch::ScopedSharedLatch guard(&indexes_latch_);
-  for (const auto &index : indexes_) index->PerformGarbageCollection();
-}
-
 }  // namespace terrier::storage
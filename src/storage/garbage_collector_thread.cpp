@@ -13,6 +13,10 @@ GarbageCollectorThread::GarbageCollectorThread(common::ManagedPointer<GarbageCol
       gc_thread_(std::thread([this] {
         if (metrics_manager_ != DISABLED) metrics_manager_->RegisterThread();
         GCThreadLoop();
+      })),
+      index_gc_thread_(std::thread([this] {
+        if (metrics_manager_ != DISABLED) metrics_manager_->RegisterThread();
+        IndexGCThreadLoop();
       })) {}
 
 }  // namespace terrier::storage
@@ -0,0 +1,259 @@
+#include "storage/index/art_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "storage/index/compact_ints_key.h"
+#include "storage/index/generic_key.h"
+
+namespace terrier::storage::index {
+
+/**
+ * Scans the tree forward from the low key. Each batch is a separate scan of the tree that resumes right after the last
+ * entry handed out, so the cursor holds no references into the tree between batches.
+ */
+template <typename KeyType>
+class ArtIndex<KeyType>::AscendingCursor final : public Cursor {
+ public:
+  AscendingCursor(const transaction::TransactionContext &txn, const uint32_t limit, ArtIndex *const index,
+                  const ScanType scan_type, const uint32_t num_attrs, ProjectedRow *const low_key,
+                  ProjectedRow *const high_key)
+      : Cursor(txn, limit),
+        index_(index),
+        num_attrs_(num_attrs),
+        high_key_exists_(scan_type == ScanType::Closed || scan_type == ScanType::OpenLow) {
+    TERRIER_ASSERT(scan_type == ScanType::Closed || scan_type == ScanType::OpenLow || scan_type == ScanType::OpenHigh ||
+                       scan_type == ScanType::OpenBoth,
+                   "Invalid scan_type passed into ArtIndex::Scan");
+    const bool low_key_exists = (scan_type == ScanType::Closed || scan_type == ScanType::OpenHigh);
+
+    // Build search keys
+    KeyType index_low_key;
+    if (low_key_exists) index_low_key.SetFromProjectedRow(*low_key, index_->metadata_, num_attrs_);
+    if (high_key_exists_) index_high_key_.SetFromProjectedRow(*high_key, index_->metadata_, num_attrs_);
+
+    if (low_key_exists) {
+      next_ = Tree::EncodeBound(index_low_key, false);
+    } else {
+      next_.fill(0);
+    }
+  }
+
+ protected:
+  uint32_t NextCandidates(TupleSlot *const slots, const uint32_t max_slots) final {
+    if (exhausted_) return 0;
+    Visitor visitor(this, slots, max_slots);
+    index_->art_->ScanAscending(next_, &visitor);
+    // A short batch means the scan ran off the end of the tree or the range
+    if (visitor.num_slots_ < max_slots || !Tree::Successor(&next_)) exhausted_ = true;
+    return visitor.num_slots_;
+  }
+
+  void CopyCandidateKey(const uint32_t candidate_idx, ProjectedRow *const key) const final {
+    keys_[candidate_idx].CopyToProjectedRow(key, index_->metadata_);
+  }
+
+ private:
+  using Tree = AdaptiveRadixTree<KeyType, TupleSlot>;
+
+  // Fills a batch from the tree and remembers the last entry in it
+  struct Visitor {
+    Visitor(AscendingCursor *const cursor, TupleSlot *const slots, const uint32_t max_slots)
+        : cursor_(cursor), slots_(slots), max_slots_(max_slots) {}
+
+    void Reset() {
+      num_slots_ = 0;
+      cursor_->keys_.clear();
+    }
+
+    bool Visit(const KeyType &key, const TupleSlot slot) {
+      if (cursor_->high_key_exists_ &&
+          !key.PartialLessThan(cursor_->index_high_key_, &cursor_->index_->metadata_, cursor_->num_attrs_)) {
+        return false;
+      }
+      if (cursor_->KeepsKeys()) cursor_->keys_.push_back(key);
+      slots_[num_slots_++] = slot;
+      if (num_slots_ < max_slots_) return true;
+      cursor_->next_ = Tree::Encode(key, slot);
+      return false;
+    }
+
+    AscendingCursor *const cursor_;
+    TupleSlot *const slots_;
+    const uint32_t max_slots_;
+    uint32_t num_slots_ = 0;
+  };
+
+  ArtIndex *const index_;
+  const uint32_t num_attrs_;
+  const bool high_key_exists_;
+  KeyType index_high_key_;
+  // Encoding of the first entry the next batch may return
+  typename Tree::EntryBytes next_;
+  bool exhausted_ = false;
+  // Keys of the last batch of candidates, if asked to keep them
+  std::vector<KeyType> keys_;
+};
+
+/**
+ * Scans the tree backward from the high key, a batch at a time like AscendingCursor.
+ */
+template <typename KeyType>
+class ArtIndex<KeyType>::DescendingCursor final : public Cursor {
+ public:
+  DescendingCursor(const transaction::TransactionContext &txn, const uint32_t limit, ArtIndex *const index,
+                   const ProjectedRow &low_key, const ProjectedRow &high_key)
+      : Cursor(txn, limit), index_(index) {
+    const auto num_attrs = index_->metadata_.GetSchema().GetColumns().size();
+
+    // Build search keys
+    KeyType index_high_key;
+    index_low_key_.SetFromProjectedRow(low_key, index_->metadata_, num_attrs);
+    index_high_key.SetFromProjectedRow(high_key, index_->metadata_, num_attrs);
+
+    next_ = Tree::EncodeBound(index_high_key, true);
+  }
+
+ protected:
+  uint32_t NextCandidates(TupleSlot *const slots, const uint32_t max_slots) final {
+    if (exhausted_) return 0;
+    Visitor visitor(this, slots, max_slots);
+    index_->art_->ScanDescending(next_, &visitor);
+    // A short batch means the scan ran off the start of the tree or the range
+    if (visitor.num_slots_ < max_slots || !Tree::Predecessor(&next_)) exhausted_ = true;
+    return visitor.num_slots_;
+  }
+
+  void CopyCandidateKey(const uint32_t candidate_idx, ProjectedRow *const key) const final {
+    keys_[candidate_idx].CopyToProjectedRow(key, index_->metadata_);
+  }
+
+ private:
+  using Tree = AdaptiveRadixTree<KeyType, TupleSlot>;
+
+  // Fills a batch from the tree and remembers the last entry in it
+  struct Visitor {
+    Visitor(DescendingCursor *const cursor, TupleSlot *const slots, const uint32_t max_slots)
+        : cursor_(cursor), slots_(slots), max_slots_(max_slots) {}
+
+    void Reset() {
+      num_slots_ = 0;
+      cursor_->keys_.clear();
+    }
+
+    bool Visit(const KeyType &key, const TupleSlot slot) {
+      if (std::less<KeyType>()(key, cursor_->index_low_key_)) return false;
+      if (cursor_->KeepsKeys()) cursor_->keys_.push_back(key);
+      slots_[num_slots_++] = slot;
+      if (num_slots_ < max_slots_) return true;
+      cursor_->next_ = Tree::Encode(key, slot);
+      return false;
+    }
+
+    DescendingCursor *const cursor_;
+    TupleSlot *const slots_;
+    const uint32_t max_slots_;
+    uint32_t num_slots_ = 0;
+  };
+
+  ArtIndex *const index_;
+  KeyType index_low_key_;
+  // Encoding of the first entry the next batch may return
+  typename Tree::EntryBytes next_;
+  bool exhausted_ = false;
+  // Keys of the last batch of candidates, if asked to keep them
+  std::vector<KeyType> keys_;
+};
+
+template <typename KeyType>
+void ArtIndex<KeyType>::ScanKeyBatch(const transaction::TransactionContext &txn, const ProjectedRow *const *const keys,
+                                     const uint32_t num_keys, std::vector<TupleSlot> *const value_list,
+                                     std::vector<uint32_t> *const key_offsets) {
+  const auto num_attrs = metadata_.GetSchema().GetColumns().size();
+  std::vector<KeyType> index_keys(num_keys);
+  for (uint32_t key_idx = 0; key_idx < num_keys; key_idx++) {
+    index_keys[key_idx].SetFromProjectedRow(*keys[key_idx], metadata_, num_attrs);
+  }
+
+  // Probe in key order, so that consecutive lookups walk down mostly the same nodes while they are still cached
+  const auto compare = [&](const uint32_t lhs, const uint32_t rhs) {
+    return std::memcmp(index_keys[lhs].KeyData(), index_keys[rhs].KeyData(), sizeof(KeyType));
+  };
+  std::vector<uint32_t> order(num_keys);
+  for (uint32_t key_idx = 0; key_idx < num_keys; key_idx++) order[key_idx] = key_idx;
+  std::sort(order.begin(), order.end(),
+            [&](const uint32_t lhs, const uint32_t rhs) { return compare(lhs, rhs) < 0; });
+
+  std::vector<TupleSlot> candidates;
+  std::vector<CandidateRange> ranges(num_keys);
+  for (uint32_t i = 0; i < num_keys; i++) {
+    const uint32_t key_idx = order[i];
+    if (i > 0 && compare(key_idx, order[i - 1]) == 0) {
+      ranges[key_idx] = ranges[order[i - 1]];
+      continue;
+    }
+    const auto begin = static_cast<uint32_t>(candidates.size());
+    art_->GetValue(index_keys[key_idx], &candidates);
+    ranges[key_idx] = {begin, static_cast<uint32_t>(candidates.size())};
+  }
+
+  GatherKeyBatch(txn, candidates, ranges, value_list, key_offsets);
+}
+
+template <typename KeyType>
+std::unique_ptr<Index::Cursor> ArtIndex<KeyType>::OpenScanAscending(const transaction::TransactionContext &txn,
+                                                                    const ScanType scan_type, const uint32_t num_attrs,
+                                                                    ProjectedRow *const low_key,
+                                                                    ProjectedRow *const high_key,
+                                                                    const uint32_t limit) {
+  return std::make_unique<AscendingCursor>(txn, limit, this, scan_type, num_attrs, low_key, high_key);
+}
+
+template <typename KeyType>
+std::unique_ptr<Index::Cursor> ArtIndex<KeyType>::OpenScanDescending(const transaction::TransactionContext &txn,
+                                                                     const ProjectedRow &low_key,
+                                                                     const ProjectedRow &high_key,
+                                                                     const uint32_t limit) {
+  return std::make_unique<DescendingCursor>(txn, limit, this, low_key, high_key);
+}
+
+template <typename KeyType>
+void ArtIndex<KeyType>::ScanAscending(const transaction::TransactionContext &txn, const ScanType scan_type,
+                                      const uint32_t num_attrs, ProjectedRow *const low_key,
+                                      ProjectedRow *const high_key, const uint32_t limit,
+                                      std::vector<TupleSlot> *const value_list) {
+  TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  AscendingCursor cursor(txn, limit, this, scan_type, num_attrs, low_key, high_key);
+  DrainCursor(&cursor, value_list);
+}
+
+template <typename KeyType>
+void ArtIndex<KeyType>::ScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                                       const ProjectedRow &high_key, std::vector<TupleSlot> *const value_list) {
+  TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  DescendingCursor cursor(txn, 0, this, low_key, high_key);
+  DrainCursor(&cursor, value_list);
+}
+
+template <typename KeyType>
+void ArtIndex<KeyType>::ScanLimitDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                                            const ProjectedRow &high_key, std::vector<TupleSlot> *const value_list,
+                                            const uint32_t limit) {
+  TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  TERRIER_ASSERT(limit > 0, "Limit must be greater than 0.");
+  DescendingCursor cursor(txn, limit, this, low_key, high_key);
+  DrainCursor(&cursor, value_list);
+}
+
+template class ArtIndex<CompactIntsKey<8>>;
+template class ArtIndex<CompactIntsKey<16>>;
+template class ArtIndex<CompactIntsKey<24>>;
+template class ArtIndex<CompactIntsKey<32>>;
+
+template class ArtIndex<GenericKey<64>>;
+template class ArtIndex<GenericKey<128>>;
+template class ArtIndex<GenericKey<256>>;
+
+}  // namespace terrier::storage::index
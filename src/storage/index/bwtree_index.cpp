@@ -1,9 +1,405 @@
 #include "storage/index/bwtree_index.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_scheduler_init.h>
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ips4o/ips4o.hpp"
 #include "storage/index/compact_ints_key.h"
 #include "storage/index/generic_key.h"
+#include "storage/sql_table.h"
+#include "transaction/transaction_util.h"
 
 namespace terrier::storage::index {
 
+namespace {
+
+// Runs shorter than this are not worth sorting on a separate thread
+constexpr size_t K_MIN_SORT_RUN_SIZE = 1u << 14u;
+
+/**
+ * Sorts the entries by splitting them into one run per thread, sorting each run with ips4o in parallel, and then
+ * merging neighbouring runs pairwise until a single run is left.
+ */
+template <typename T, typename Compare>
+void ParallelSort(std::vector<T> *const entries, const Compare &cmp) {
+  const auto num_threads = static_cast<size_t>(tbb::task_scheduler_init::default_num_threads());
+  const size_t num_runs = std::max<size_t>(1, std::min(num_threads, entries->size() / K_MIN_SORT_RUN_SIZE));
+
+  std::vector<size_t> run_bounds(num_runs + 1);
+  for (size_t i = 0; i <= num_runs; i++) {
+    run_bounds[i] = entries->size() * i / num_runs;
+  }
+
+  const auto begin = entries->begin();
+  tbb::parallel_for(size_t{0}, num_runs, [&](const size_t run) {
+    ips4o::sort(begin + run_bounds[run], begin + run_bounds[run + 1], cmp);
+  });
+
+  for (size_t width = 1; width < num_runs; width *= 2) {
+    const size_t num_merges = (num_runs + 2 * width - 1) / (2 * width);
+    tbb::parallel_for(size_t{0}, num_merges, [&](const size_t merge) {
+      const size_t lo = merge * 2 * width;
+      const size_t mid = std::min(lo + width, num_runs);
+      const size_t hi = std::min(lo + 2 * width, num_runs);
+      std::inplace_merge(begin + run_bounds[lo], begin + run_bounds[mid], begin + run_bounds[hi], cmp);
+    });
+  }
+}
+
+}  // namespace
+
+/**
+ * Walks the leaves forward from the low key. The BwTree iterator caches a copy of its current leaf, so it stays valid
+ * between batches without holding the epoch.
+ */
+template <typename KeyType>
+class BwTreeIndex<KeyType>::AscendingCursor final : public Cursor {
+ public:
+  AscendingCursor(const transaction::TransactionContext &txn, const uint32_t limit, BwTreeIndex *const index,
+                  const ScanType scan_type, const uint32_t num_attrs, ProjectedRow *const low_key,
+                  ProjectedRow *const high_key)
+      : Cursor(txn, limit),
+        index_(index),
+        num_attrs_(num_attrs),
+        high_key_exists_(scan_type == ScanType::Closed || scan_type == ScanType::OpenLow) {
+    TERRIER_ASSERT(scan_type == ScanType::Closed || scan_type == ScanType::OpenLow || scan_type == ScanType::OpenHigh ||
+                       scan_type == ScanType::OpenBoth,
+                   "Invalid scan_type passed into BwTreeIndex::Scan");
+    const bool low_key_exists = (scan_type == ScanType::Closed || scan_type == ScanType::OpenHigh);
+
+    // Build search keys
+    KeyType index_low_key;
+    if (low_key_exists) index_low_key.SetFromProjectedRow(*low_key, index_->metadata_, num_attrs_);
+    if (high_key_exists_) index_high_key_.SetFromProjectedRow(*high_key, index_->metadata_, num_attrs_);
+
+    // Perform lookup in BwTree
+    scan_itr_ = low_key_exists ? index_->bwtree_->Begin(index_low_key) : index_->bwtree_->Begin();
+  }
+
+ protected:
+  uint32_t NextCandidates(TupleSlot *const slots, const uint32_t max_slots) final {
+    uint32_t num_slots = 0;
+    keys_.clear();
+    while (num_slots < max_slots && !scan_itr_.IsEnd() &&
+           (!high_key_exists_ || scan_itr_->first.PartialLessThan(index_high_key_, &index_->metadata_, num_attrs_))) {
+      if (KeepsKeys()) keys_.push_back(scan_itr_->first);
+      slots[num_slots++] = scan_itr_->second;
+      scan_itr_++;
+    }
+    return num_slots;
+  }
+
+  void CopyCandidateKey(const uint32_t candidate_idx, ProjectedRow *const key) const final {
+    keys_[candidate_idx].CopyToProjectedRow(key, index_->metadata_);
+  }
+
+ private:
+  BwTreeIndex *const index_;
+  const uint32_t num_attrs_;
+  const bool high_key_exists_;
+  KeyType index_high_key_;
+  typename third_party::bwtree::BwTree<KeyType, TupleSlot>::ForwardIterator scan_itr_;
+  // Keys of the last batch of candidates, if asked to keep them
+  std::vector<KeyType> keys_;
+};
+
+/**
+ * Walks the leaves backward from the high key.
+ */
+template <typename KeyType>
+class BwTreeIndex<KeyType>::DescendingCursor final : public Cursor {
+ public:
+  DescendingCursor(const transaction::TransactionContext &txn, const uint32_t limit, BwTreeIndex *const index,
+                   const ProjectedRow &low_key, const ProjectedRow &high_key)
+      : Cursor(txn, limit), index_(index) {
+    const auto num_attrs = index_->metadata_.GetSchema().GetColumns().size();
+
+    // Build search keys
+    KeyType index_high_key;
+    index_low_key_.SetFromProjectedRow(low_key, index_->metadata_, num_attrs);
+    index_high_key.SetFromProjectedRow(high_key, index_->metadata_, num_attrs);
+
+    // Perform lookup in BwTree
+    scan_itr_ = index_->bwtree_->Begin(index_high_key);
+    // Back up one element if we didn't match the high key
+    // This currently uses the BwTree's decrement operator on the iterator, which is not guaranteed to be
+    // constant time. In some cases it may be faster to do an ascending scan and then reverse the result vector. It
+    // depends on the visibility selectivity and final result set size. We can change the implementation in the future
+    // if it proves to be a problem.
+    if (scan_itr_.IsEnd() || index_->bwtree_->KeyCmpGreater(scan_itr_->first, index_high_key)) scan_itr_--;
+  }
+
+ protected:
+  uint32_t NextCandidates(TupleSlot *const slots, const uint32_t max_slots) final {
+    uint32_t num_slots = 0;
+    keys_.clear();
+    while (num_slots < max_slots && !scan_itr_.IsREnd() &&
+           index_->bwtree_->KeyCmpGreaterEqual(scan_itr_->first, index_low_key_)) {
+      if (KeepsKeys()) keys_.push_back(scan_itr_->first);
+      slots[num_slots++] = scan_itr_->second;
+      scan_itr_--;
+    }
+    return num_slots;
+  }
+
+  void CopyCandidateKey(const uint32_t candidate_idx, ProjectedRow *const key) const final {
+    keys_[candidate_idx].CopyToProjectedRow(key, index_->metadata_);
+  }
+
+ private:
+  BwTreeIndex *const index_;
+  KeyType index_low_key_;
+  typename third_party::bwtree::BwTree<KeyType, TupleSlot>::ForwardIterator scan_itr_;
+  // Keys of the last batch of candidates, if asked to keep them
+  std::vector<KeyType> keys_;
+};
+
+template <typename KeyType>
+void BwTreeIndex<KeyType>::ScanKeyBatch(const transaction::TransactionContext &txn,
+                                        const ProjectedRow *const *const keys, const uint32_t num_keys,
+                                        std::vector<TupleSlot> *const value_list,
+                                        std::vector<uint32_t> *const key_offsets) {
+  const auto num_attrs = metadata_.GetSchema().GetColumns().size();
+  std::vector<KeyType> index_keys(num_keys);
+  for (uint32_t key_idx = 0; key_idx < num_keys; key_idx++) {
+    index_keys[key_idx].SetFromProjectedRow(*keys[key_idx], metadata_, num_attrs);
+  }
+
+  // Probe in key order, so that keys on the same leaf are found on the leaf the iterator already holds
+  std::vector<uint32_t> order(num_keys);
+  for (uint32_t key_idx = 0; key_idx < num_keys; key_idx++) order[key_idx] = key_idx;
+  std::sort(order.begin(), order.end(), [&](const uint32_t lhs, const uint32_t rhs) {
+    return bwtree_->KeyCmpLess(index_keys[lhs], index_keys[rhs]);
+  });
+
+  std::vector<TupleSlot> candidates;
+  std::vector<CandidateRange> ranges(num_keys);
+  typename third_party::bwtree::BwTree<KeyType, TupleSlot>::ForwardIterator itr;
+  for (uint32_t i = 0; i < num_keys; i++) {
+    const uint32_t key_idx = order[i];
+    const KeyType &index_key = index_keys[key_idx];
+    if (i > 0 && bwtree_->KeyCmpEqual(index_key, index_keys[order[i - 1]])) {
+      ranges[key_idx] = ranges[order[i - 1]];
+      continue;
+    }
+    itr.Seek(bwtree_.get(), index_key);
+    const auto begin = static_cast<uint32_t>(candidates.size());
+    for (; !itr.IsEnd() && bwtree_->KeyCmpEqual(itr->first, index_key); itr++) candidates.emplace_back(itr->second);
+    ranges[key_idx] = {begin, static_cast<uint32_t>(candidates.size())};
+  }
+
+  GatherKeyBatch(txn, candidates, ranges, value_list, key_offsets);
+}
+
+template <typename KeyType>
+std::unique_ptr<Index::Cursor> BwTreeIndex<KeyType>::OpenScanAscending(const transaction::TransactionContext &txn,
+                                                                       const ScanType scan_type,
+                                                                       const uint32_t num_attrs,
+                                                                       ProjectedRow *const low_key,
+                                                                       ProjectedRow *const high_key,
+                                                                       const uint32_t limit) {
+  return std::make_unique<AscendingCursor>(txn, limit, this, scan_type, num_attrs, low_key, high_key);
+}
+
+template <typename KeyType>
+std::unique_ptr<Index::Cursor> BwTreeIndex<KeyType>::OpenScanDescending(const transaction::TransactionContext &txn,
+                                                                        const ProjectedRow &low_key,
+                                                                        const ProjectedRow &high_key,
+                                                                        const uint32_t limit) {
+  return std::make_unique<DescendingCursor>(txn, limit, this, low_key, high_key);
+}
+
+template <typename KeyType>
+void BwTreeIndex<KeyType>::ScanAscending(const transaction::TransactionContext &txn, const ScanType scan_type,
+                                         const uint32_t num_attrs, ProjectedRow *const low_key,
+                                         ProjectedRow *const high_key, const uint32_t limit,
+                                         std::vector<TupleSlot> *const value_list) {
+  TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  AscendingCursor cursor(txn, limit, this, scan_type, num_attrs, low_key, high_key);
+  DrainCursor(&cursor, value_list);
+}
+
+template <typename KeyType>
+void BwTreeIndex<KeyType>::ScanDescending(const transaction::TransactionContext &txn, const ProjectedRow &low_key,
+                                          const ProjectedRow &high_key, std::vector<TupleSlot> *const value_list) {
+  TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  DescendingCursor cursor(txn, 0, this, low_key, high_key);
+  DrainCursor(&cursor, value_list);
+}
+
+template <typename KeyType>
+void BwTreeIndex<KeyType>::ScanLimitDescending(const transaction::TransactionContext &txn,
+                                               const ProjectedRow &low_key, const ProjectedRow &high_key,
+                                               std::vector<TupleSlot> *const value_list, const uint32_t limit) {
+  TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  TERRIER_ASSERT(limit > 0, "Limit must be greater than 0.");
+  DescendingCursor cursor(txn, limit, this, low_key, high_key);
+  DrainCursor(&cursor, value_list);
+}
+
+template <typename KeyType>
+bool BwTreeIndex<KeyType>::BulkLoad(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                    const common::ManagedPointer<SqlTable> table,
+                                    const common::ManagedPointer<transaction::TransactionManager> txn_manager) {
+  using Entry = std::pair<KeyType, TupleSlot>;
+  const auto num_attrs = metadata_.GetSchema().GetColumns().size();
+
+  // 0. Record the tuples written from now on, and, as we scan, those written since our snapshot, so that their
+  // entries can be fixed once the transactions that cannot see the index are done
+  const bool catch_up = txn_manager != DISABLED;
+  if (catch_up) {
+    building_ = true;
+    table->WatchWrites(&written_);
+    txn->RegisterAbortAction([=]() { table->UnwatchWrites(&written_); });
+    txn->RegisterCommitAction([=](transaction::DeferredActionManager *deferred_action_manager) {
+      // Deferred actions run once every txn that was running when they were registered is done
+      deferred_action_manager->RegisterDeferredAction([=]() { CatchUp(txn_manager, table); });
+    });
+  }
+  const auto blocks = table->GetBlocks();
+
+  tbb::task_scheduler_init sched;
+
+  // 1. Scan the table in parallel, a range of blocks at a time, and extract keys into thread-local buffers
+  tbb::enumerable_thread_specific<std::vector<Entry>> thread_entries;
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, blocks.size()), [&](const tbb::blocked_range<size_t> &range) {
+    auto &entries = thread_entries.local();
+    ScanTableKeys(
+        txn, table, blocks.cbegin() + range.begin(), blocks.cbegin() + range.end(),
+        [&](const ProjectedRow &key, const TupleSlot slot) {
+          entries.emplace_back();
+          entries.back().first.SetFromProjectedRow(key, metadata_, num_attrs);
+          entries.back().second = slot;
+        },
+        catch_up ? &written_ : nullptr);
+  });
+
+  // 2. Gather all thread-local buffers into one array
+  std::vector<std::vector<Entry> *> buffers;
+  size_t num_entries = 0;
+  for (auto &entries : thread_entries) {
+    buffers.push_back(&entries);
+    num_entries += entries.size();
+  }
+  std::vector<Entry> all_entries(num_entries);
+  std::vector<size_t> offsets(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); i++) {
+    offsets[i + 1] = offsets[i] + buffers[i]->size();
+  }
+  tbb::parallel_for(size_t{0}, buffers.size(), [&](const size_t i) {
+    std::move(buffers[i]->begin(), buffers[i]->end(), all_entries.begin() + offsets[i]);
+    std::vector<Entry>().swap(*buffers[i]);
+  });
+
+  // 3. Sort by key
+  const std::less<KeyType> key_less;
+  ParallelSort(&all_entries, [&](const Entry &l, const Entry &r) { return key_less(l.first, r.first); });
+
+  // 4. A unique index cannot be built over a table that already holds duplicate keys
+  if (metadata_.GetSchema().Unique()) {
+    const std::equal_to<KeyType> key_eq;
+    const auto duplicate = std::adjacent_find(all_entries.cbegin(), all_entries.cend(),
+                                              [&](const Entry &l, const Entry &r) { return key_eq(l.first, r.first); });
+    if (duplicate != all_entries.cend()) return false;
+  }
+
+  // 5. Build the tree bottom-up. The index is private to txn, so no abort actions are needed.
+  bwtree_->BulkLoad(all_entries.data(), all_entries.data() + all_entries.size());
+  return true;
+}
+
+template <typename KeyType>
+void BwTreeIndex<KeyType>::CatchUp(const common::ManagedPointer<transaction::TransactionManager> txn_manager,
+                                   const common::ManagedPointer<SqlTable> table) {
+  // Every txn that wrote without maintaining the index is done, and the ones running now maintain it themselves. The
+  // set no longer changes once it stops watching, so it is read without its latch from here on.
+  table->UnwatchWrites(&written_);
+  const auto &written = written_.slots_;
+  if (written.empty()) {
+    building_ = false;
+    return;
+  }
+
+  // Begin before walking the tree, so that every tuple visible to txn that was inserted since already has its entry
+  auto *const txn = txn_manager->BeginTransaction();
+  const auto num_attrs = metadata_.GetSchema().GetColumns().size();
+
+  // 1. Find the entries of the written tuples in one pass over the leaves
+  std::unordered_map<TupleSlot, std::vector<KeyType>> entries;
+  for (auto itr = bwtree_->Begin(); !itr.IsEnd(); itr++) {
+    if (written.count(itr->second) > 0) entries[itr->second].push_back(itr->first);
+  }
+
+  // 2. Find the current key of every written tuple that txn sees and is not indexed under it, and collect its other
+  // entries
+  const std::equal_to<KeyType> key_eq;
+  TableKeyReader reader(*this, table);
+  std::vector<std::pair<KeyType, TupleSlot>> missing;
+  std::unordered_map<TupleSlot, std::vector<KeyType>> stale;
+  for (const auto slot : written) {
+    const bool visible = reader.Read(common::ManagedPointer(txn), slot);
+    // The tuple was inserted after txn began, by a txn that indexed it
+    if (!visible && slot.GetBlock()->data_table_->HasConflict(*txn, slot)) continue;
+
+    KeyType key;
+    if (visible) key.SetFromProjectedRow(reader.Key(), metadata_, num_attrs);
+    bool indexed = false;
+    for (const auto &entry_key : entries[slot]) {
+      if (visible && key_eq(entry_key, key)) {
+        indexed = true;
+      } else {
+        stale[slot].push_back(entry_key);
+      }
+    }
+    if (!visible || indexed) continue;
+    missing.emplace_back(key, slot);
+  }
+
+  // 3. Index the missing tuples. A unique index cannot refuse a duplicate key that has committed already, and leaving
+  // the tuple out would make lookups miss it, so the index becomes invalid instead.
+  if (metadata_.GetSchema().Unique()) {
+    for (const auto &entry : missing) {
+      const KeyType &key = entry.first;
+      // Entries about to be removed, because their tuples have moved on to other keys, are no duplicates
+      auto predicate = [&, txn](const TupleSlot other) -> bool {
+        const auto other_stale = stale.find(other);
+        if (other_stale != stale.end() &&
+            std::any_of(other_stale->second.cbegin(), other_stale->second.cend(),
+                        [&](const KeyType &stale_key) { return key_eq(stale_key, key); })) {
+          return false;
+        }
+        const auto *const data_table = other.GetBlock()->data_table_;
+        return data_table->HasConflict(*txn, other) || data_table->IsVisible(*txn, other);
+      };
+      bool predicate_satisfied = false;
+      if (!bwtree_->ConditionalInsert(key, entry.second, predicate, &predicate_satisfied)) valid_ = false;
+    }
+  } else {
+    for (const auto &entry : missing) bwtree_->Insert(entry.first, entry.second, false);
+  }
+
+  // 4. As in Delete, the stale entries are removed once no txn can see the versions they were made for. Lookups would
+  // find those tuples under both keys until then, so the index keeps building.
+  txn->RegisterCommitAction([=, stale{std::move(stale)}](transaction::DeferredActionManager *deferred_action_manager) {
+    deferred_action_manager->RegisterDeferredAction([=]() {
+      // A txn that deleted the tuple since may have removed its entry already
+      for (const auto &[slot, keys] : stale) {
+        for (const auto &key : keys) bwtree_->Delete(key, slot);
+      }
+      building_ = false;
+    });
+  });
+  txn_manager->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
 template class BwTreeIndex<CompactIntsKey<8>>;
 template class BwTreeIndex<CompactIntsKey<16>>;
 template class BwTreeIndex<CompactIntsKey<24>>;
@@ -0,0 +1,163 @@
+#include "storage/index/index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "common/allocator.h"
+#include "storage/sql_table.h"
+
+namespace terrier::storage::index {
+
+namespace {
+
+// Number of values the materializing scans pull out of a cursor at a time
+constexpr uint32_t K_DRAIN_BATCH_SIZE = 256;
+
+}  // namespace
+
+uint32_t Index::Cursor::Next(TupleSlot *const slots, const uint32_t max_slots) {
+  while (limit_ == 0 || num_returned_ < limit_) {
+    // Never fetch more candidates than the limit could still admit, so a small limit stops the scan early
+    const uint32_t batch_size = limit_ == 0 ? max_slots : std::min(max_slots, limit_ - num_returned_);
+    const uint32_t num_candidates = NextCandidates(slots, batch_size);
+    if (num_candidates == 0) break;
+    if (visible_.size() < num_candidates) visible_.resize(num_candidates);
+    const uint32_t num_visible = FilterVisible(txn_, slots, num_candidates, visible_.data());
+    // visible_ is ascending, so compacting in place never overwrites a slot that is still needed
+    for (uint32_t idx = 0; idx < num_visible; idx++) slots[idx] = slots[visible_[idx]];
+    if (num_visible > 0) {
+      num_returned_ += num_visible;
+      return num_visible;
+    }
+  }
+  return 0;
+}
+
+void Index::DrainCursor(Cursor *const cursor, std::vector<TupleSlot> *const value_list) {
+  uint32_t num_slots;
+  do {
+    const auto size = value_list->size();
+    value_list->resize(size + K_DRAIN_BATCH_SIZE);
+    num_slots = cursor->Next(value_list->data() + size, K_DRAIN_BATCH_SIZE);
+    value_list->resize(size + num_slots);
+  } while (num_slots > 0);
+}
+
+void Index::GatherKeyBatch(const transaction::TransactionContext &txn, const std::vector<TupleSlot> &candidates,
+                           const std::vector<CandidateRange> &ranges, std::vector<TupleSlot> *const value_list,
+                           std::vector<uint32_t> *const key_offsets) {
+  TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  // Check the whole batch in one pass over the table
+  std::vector<uint32_t> visible(candidates.size());
+  const uint32_t num_visible =
+      FilterVisible(txn, candidates.data(), static_cast<uint32_t>(candidates.size()), visible.data());
+  std::vector<bool> is_visible(candidates.size(), false);
+  for (uint32_t idx = 0; idx < num_visible; idx++) is_visible[visible[idx]] = true;
+
+  value_list->reserve(num_visible);
+  key_offsets->resize(ranges.size() + 1);
+  for (uint32_t key_idx = 0; key_idx < ranges.size(); key_idx++) {
+    (*key_offsets)[key_idx] = static_cast<uint32_t>(value_list->size());
+    for (uint32_t idx = ranges[key_idx].first; idx < ranges[key_idx].second; idx++) {
+      if (is_visible[idx]) value_list->emplace_back(candidates[idx]);
+    }
+  }
+  key_offsets->back() = static_cast<uint32_t>(value_list->size());
+}
+
+void Index::ScanKeyBatch(const transaction::TransactionContext &txn, const ProjectedRow *const *const keys,
+                         const uint32_t num_keys, std::vector<TupleSlot> *const value_list,
+                         std::vector<uint32_t> *const key_offsets) {
+  TERRIER_ASSERT(value_list->empty(), "Result set should begin empty.");
+  key_offsets->resize(num_keys + 1);
+  std::vector<TupleSlot> key_values;
+  for (uint32_t key_idx = 0; key_idx < num_keys; key_idx++) {
+    (*key_offsets)[key_idx] = static_cast<uint32_t>(value_list->size());
+    key_values.clear();
+    ScanKey(txn, *keys[key_idx], &key_values);
+    value_list->insert(value_list->end(), key_values.cbegin(), key_values.cend());
+  }
+  (*key_offsets)[num_keys] = static_cast<uint32_t>(value_list->size());
+}
+
+Index::TableKeyReader::TableKeyReader(const Index &index, const common::ManagedPointer<SqlTable> table)
+    : index_(index), table_(table) {
+  const auto &key_schema = index_.metadata_.GetSchema();
+  TERRIER_ASSERT(key_schema.GetColumns().size() == key_schema.GetIndexedColOids().size(),
+                 "Only support index keys that are a single column oid");
+
+  // A column may appear in more than one key attribute, but a projection must not repeat it
+  std::vector<catalog::col_oid_t> table_oids(key_schema.GetIndexedColOids());
+  std::sort(table_oids.begin(), table_oids.end());
+  table_oids.erase(std::unique(table_oids.begin(), table_oids.end()), table_oids.end());
+
+  const auto table_pr_init = table_->InitializerForProjectedRow(table_oids);
+  pr_map_ = table_->ProjectionMapForOids(table_oids);
+  table_buffer_ = common::AllocationUtil::AllocateAligned(table_pr_init.ProjectedRowSize());
+  index_buffer_ = common::AllocationUtil::AllocateAligned(index_.GetProjectedRowInitializer().ProjectedRowSize());
+  table_pr_ = table_pr_init.InitializeRow(table_buffer_);
+  index_pr_ = index_.GetProjectedRowInitializer().InitializeRow(index_buffer_);
+}
+
+bool Index::TableKeyReader::Read(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                 const TupleSlot slot) {
+  if (!table_->Select(txn, slot, table_pr_)) return false;
+
+  // Copy in each value from the table PR into the index PR
+  const auto &key_schema = index_.metadata_.GetSchema();
+  const auto &indexed_attributes = key_schema.GetIndexedColOids();
+  for (uint32_t col_idx = 0; col_idx < indexed_attributes.size(); col_idx++) {
+    const auto &col = key_schema.GetColumn(col_idx);
+    const auto key_offset = index_.GetKeyOidToOffsetMap().at(col.Oid());
+    const auto table_offset = pr_map_[indexed_attributes[col_idx]];
+    if (table_pr_->IsNull(table_offset)) {
+      index_pr_->SetNull(key_offset);
+    } else {
+      std::memcpy(index_pr_->AccessForceNotNull(key_offset), table_pr_->AccessWithNullCheck(table_offset),
+                  AttrSizeBytes(col.AttrSize()));
+    }
+  }
+  return true;
+}
+
+void Index::ScanTableKeys(const common::ManagedPointer<transaction::TransactionContext> txn,
+                          const common::ManagedPointer<SqlTable> table,
+                          const std::vector<RawBlock *>::const_iterator blocks_begin,
+                          const std::vector<RawBlock *>::const_iterator blocks_end,
+                          const std::function<void(const ProjectedRow &, TupleSlot)> &key_fn,
+                          TableWriteSet *const written) const {
+  TableKeyReader reader(*this, table);
+  std::vector<TupleSlot> written_slots;
+  for (auto block_it = blocks_begin; block_it != blocks_end; ++block_it) {
+    RawBlock *const block = *block_it;
+    // Slots past the insert head were never handed out, so they can hold nothing visible to us
+    const uint32_t insert_head = block->GetInsertHead();
+    for (uint32_t offset = 0; offset < insert_head; offset++) {
+      const TupleSlot slot(block, offset);
+      // A version newer than our snapshot, committed or not, may change the tuple's key after we read it
+      if (written != nullptr && block->data_table_->HasConflict(*txn, slot)) written_slots.push_back(slot);
+      if (reader.Read(txn, slot)) key_fn(reader.Key(), slot);
+    }
+  }
+
+  if (!written_slots.empty()) {
+    common::SpinLatch::ScopedSpinLatch guard(&written->latch_);
+    written->slots_.insert(written_slots.cbegin(), written_slots.cend());
+  }
+}
+
+bool Index::BulkLoad(const common::ManagedPointer<transaction::TransactionContext> txn,
+                     const common::ManagedPointer<SqlTable> table,
+                     UNUSED_ATTRIBUTE const common::ManagedPointer<transaction::TransactionManager> txn_manager) {
+  const auto blocks = table->GetBlocks();
+  const bool unique = metadata_.GetSchema().Unique();
+  bool result = true;
+  ScanTableKeys(txn, table, blocks.cbegin(), blocks.cend(), [&](const ProjectedRow &key, const TupleSlot slot) {
+    if (!result) return;
+    result = unique ? InsertUnique(txn, key, slot) : Insert(txn, key, slot);
+  });
+  return result;
+}
+
+}  // namespace terrier::storage::index
@@ -0,0 +1,60 @@
+#include "storage/index_garbage_collector.h"
+
+#include <tbb/parallel_for.h>
+
+#include <utility>
+#include <vector>
+
+#include "common/thread_context.h"
+#include "metrics/metrics_store.h"
+
+namespace terrier::storage {
+
+void IndexGarbageCollector::RegisterIndex(const common::ManagedPointer<index::Index> index,
+                                          const catalog::index_oid_t index_oid) {
+  TERRIER_ASSERT(index != nullptr, "Index cannot be nullptr.");
+  common::SharedLatch::ScopedExclusiveLatch guard(&indexes_latch_);
+  TERRIER_ASSERT(indexes_.count(index) == 0, "Trying to register an index that has already been registered.");
+  indexes_.emplace(index, index_oid);
+}
+
+void IndexGarbageCollector::UnregisterIndex(const common::ManagedPointer<index::Index> index) {
+  TERRIER_ASSERT(index != nullptr, "Index cannot be nullptr.");
+  common::SharedLatch::ScopedExclusiveLatch guard(&indexes_latch_);
+  TERRIER_ASSERT(indexes_.count(index) == 1, "Trying to unregister an index that has not been registered.");
+  indexes_.erase(index);
+}
+
+uint32_t IndexGarbageCollector::PerformGarbageCollection() {
+  std::lock_guard<std::mutex> collection_guard(collection_latch_);
+  // Held for the whole pass so that no index can be unregistered and freed while it is being collected
+  common::SharedLatch::ScopedSharedLatch guard(&indexes_latch_);
+
+  const bool gc_metrics_enabled =
+      common::thread_context.metrics_store_ != nullptr &&
+      common::thread_context.metrics_store_->ComponentToRecord(metrics::MetricsComponent::GARBAGECOLLECTION);
+  if (gc_metrics_enabled) {
+    // start the operating unit resource tracker
+    common::thread_context.resource_tracker_.Start();
+  }
+
+  std::vector<std::pair<common::ManagedPointer<index::Index>, catalog::index_oid_t>> indexes(indexes_.cbegin(),
+                                                                                             indexes_.cend());
+  // Indexes share no reclamation state, so each one is collected by whichever worker picks it up
+  tbb::parallel_for(size_t{0}, indexes.size(), [&](const size_t i) { indexes[i].first->PerformGarbageCollection(); });
+
+  if (gc_metrics_enabled) {
+    // Stop the resource tracker for this operating unit
+    common::thread_context.resource_tracker_.Stop();
+    auto &resource_metrics = common::thread_context.resource_tracker_.GetMetrics();
+    for (const auto &index : indexes) {
+      const uint64_t num_retained = index.first->NumRetainedGarbageNodes();
+      common::thread_context.metrics_store_->RecordIndexGCData(indexes.size(), index.second, num_retained,
+                                                               resource_metrics);
+    }
+  }
+
+  return static_cast<uint32_t>(indexes.size());
+}
+
+}  // namespace terrier::storage
@@ -1,5 +1,6 @@
 #include "storage/sql_table.h"
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <string>
@@ -87,6 +88,21 @@ ProjectionMap SqlTable::ProjectionMapForOids(const std::vector<catalog::col_oid_
   return projection_map;
 }
 
+void SqlTable::WatchWrites(TableWriteSet *const writes) {
+  common::SpinLatch::ScopedSpinLatch guard(&watchers_latch_);
+  watchers_.push_back(writes);
+  // Writers check the count after installing their version, so one that misses the new set wrote before this
+  num_watchers_.fetch_add(1);
+}
+
+void SqlTable::UnwatchWrites(TableWriteSet *const writes) {
+  common::SpinLatch::ScopedSpinLatch guard(&watchers_latch_);
+  const auto it = std::find(watchers_.begin(), watchers_.end(), writes);
+  TERRIER_ASSERT(it != watchers_.end(), "The set does not watch this table.");
+  watchers_.erase(it);
+  num_watchers_.fetch_sub(1);
+}
+
 catalog::col_oid_t SqlTable::OidForColId(const col_id_t col_id) const {
   const auto oid_to_id = std::find_if(table_.column_map_.cbegin(), table_.column_map_.cend(),
                                       [&](const auto &oid_to_id) -> bool { return oid_to_id.second == col_id; });
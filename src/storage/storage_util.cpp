@@ -7,6 +7,7 @@
 #include "storage/projected_columns.h"
 #include "storage/tuple_access_strategy.h"
 #include "storage/undo_record.h"
+#include "storage/varlen_arena.h"
 namespace terrier::storage {
 
 template <class RowType>
@@ -24,10 +25,29 @@ template void StorageUtil::CopyWithNullCheck<ProjectedColumns::RowView>(const by
 
 void StorageUtil::CopyWithNullCheck(const byte *const from, const TupleAccessStrategy &accessor, const TupleSlot to,
                                     const col_id_t col_id) {
-  if (from == nullptr)
+  if (from == nullptr) {
     accessor.SetNull(to, col_id);
-  else
-    std::memcpy(accessor.AccessForceNotNull(to, col_id), from, accessor.GetBlockLayout().AttrSize(col_id));
+    return;
+  }
+  const BlockLayout &layout = accessor.GetBlockLayout();
+  // Widen the zone map before the value lands in the block, so that scans pruning on it never miss the value
+  if (!layout.IsVarlen(col_id)) {
+    ColumnZoneMap &zone_map = accessor.GetArrowBlockMetadata(to.GetBlock()).GetZoneMap(layout, col_id);
+    switch (layout.AttrSize(col_id)) {
+      case sizeof(int8_t):
+        zone_map.Widen(*reinterpret_cast<const int8_t *>(from));
+        break;
+      case sizeof(int16_t):
+        zone_map.Widen(*reinterpret_cast<const int16_t *>(from));
+        break;
+      case sizeof(int32_t):
+        zone_map.Widen(*reinterpret_cast<const int32_t *>(from));
+        break;
+      default:
+        zone_map.Widen(*reinterpret_cast<const int64_t *>(from));
+    }
+  }
+  std::memcpy(accessor.AccessForceNotNull(to, col_id), from, layout.AttrSize(col_id));
 }
 
 template <class RowType>
@@ -200,7 +220,7 @@ void StorageUtil::DeallocateVarlens(RawBlock *block, const TupleAccessStrategy &
       if (!accessor.Allocated(slot)) continue;
       auto *entry = reinterpret_cast<VarlenEntry *>(accessor.AccessWithNullCheck(slot, col));
       // If entry is null here, the varlen entry is a null SQL value.
-      if (entry != nullptr && entry->NeedReclaim()) delete[] entry->Content();
+      if (entry != nullptr && entry->NeedReclaim()) VarlenArena::Deallocate(*entry);
     }
   }
 }
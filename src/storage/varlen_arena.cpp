@@ -0,0 +1,39 @@
+#include "storage/varlen_arena.h"
+
+#include <cstring>
+#include <new>
+
+#include "common/allocator.h"
+
+namespace terrier::storage {
+
+VarlenEntry VarlenArena::Copy(const byte *const content, const uint32_t size) {
+  if (size <= VarlenEntry::InlineThreshold()) return VarlenEntry::CreateInline(content, size);
+  if (size > MAX_ARENA_VALUE_SIZE) {
+    byte *const copy = common::AllocationUtil::AllocateAligned(size);
+    std::memcpy(copy, content, size);
+    return VarlenEntry::Create(copy, size, true);
+  }
+
+  // Keep content 8-byte aligned, like individually allocated content is, for values that are read as arrays
+  const uint32_t aligned_size = (size + 7) & ~7U;
+  if (offset_ + aligned_size > CHUNK_SIZE) {
+    if (chunk_ != nullptr) Release(chunk_);
+    chunk_ = new (::operator new(CHUNK_SIZE, std::align_val_t(CHUNK_SIZE))) Chunk{{1}};
+    offset_ = sizeof(Chunk);
+    num_chunks_++;
+  }
+  byte *const copy = reinterpret_cast<byte *>(chunk_) + offset_;
+  offset_ += aligned_size;
+  chunk_->num_references_.fetch_add(1, std::memory_order_relaxed);
+  std::memcpy(copy, content, size);
+  return VarlenEntry::CreateInArena(copy, size);
+}
+
+void VarlenArena::Release(Chunk *const chunk) {
+  if (chunk->num_references_.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+  chunk->~Chunk();
+  ::operator delete(chunk, std::align_val_t(CHUNK_SIZE));
+}
+
+}  // namespace terrier::storage
@@ -297,7 +297,7 @@ void TrafficCop::ExecuteStatement(const common::ManagedPointer<network::Connecti
     auto cost_model = std::make_unique<optimizer::TrivialCostModel>();
     auto physical_plan = trafficcop::TrafficCopUtil::Optimize(
         connection_ctx->Transaction(), connection_ctx->Accessor(), parse_result, connection_ctx->GetDatabaseOid(),
-        stats_storage_, std::move(cost_model), optimizer_timeout_);
+        stats_storage_, std::move(cost_model), optimizer_timeout_, optimizer_num_threads_);
 
     // This logic relies on ordering of values in the enum's definition and is documented there as well.
     if (query_type <= network::QueryType::QUERY_DELETE) {
@@ -332,6 +332,7 @@ void TrafficCop::CodegenAndRunPhysicalPlan(const common::ManagedPointer<network:
   auto exec_ctx = std::make_unique<execution::exec::ExecutionContext>(
       connection_ctx->GetDatabaseOid(), connection_ctx->Transaction(), writer, physical_plan->GetOutputSchema().Get(),
       connection_ctx->Accessor());
+  exec_ctx->SetReadOnly(query_type == network::QueryType::QUERY_SELECT);
 
   auto exec_query = execution::ExecutableQuery(common::ManagedPointer(physical_plan), common::ManagedPointer(exec_ctx));
 
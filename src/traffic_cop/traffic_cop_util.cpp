@@ -22,12 +22,13 @@ std::unique_ptr<planner::AbstractPlanNode> TrafficCopUtil::Optimize(
     const common::ManagedPointer<catalog::CatalogAccessor> accessor,
     const common::ManagedPointer<parser::ParseResult> query, const catalog::db_oid_t db_oid,
     common::ManagedPointer<optimizer::StatsStorage> stats_storage,
-    std::unique_ptr<optimizer::AbstractCostModel> cost_model, const uint64_t optimizer_timeout) {
+    std::unique_ptr<optimizer::AbstractCostModel> cost_model, const uint64_t optimizer_timeout,
+    const uint32_t optimizer_num_threads) {
   // Optimizer transforms annotated ParseResult to logical expressions (ephemeral Optimizer structure)
   optimizer::QueryToOperatorTransformer transformer(accessor, db_oid);
   auto logical_exprs = transformer.ConvertToOpExpression(query->GetStatement(0), query);
 
-  optimizer::Optimizer optimizer(std::move(cost_model), optimizer_timeout);
+  optimizer::Optimizer optimizer(std::move(cost_model), optimizer_timeout, optimizer_num_threads);
   optimizer::PropertySet property_set;
   std::vector<common::ManagedPointer<parser::AbstractExpression>> output;
 
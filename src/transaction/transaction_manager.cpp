@@ -226,7 +226,7 @@ void TransactionManager::GCLastUpdateOnAbort(TransactionContext *const txn) {
       auto *varlen = reinterpret_cast<storage::VarlenEntry *>(redo->Delta()->AccessWithNullCheck(i));
       if (varlen != nullptr) {
         TERRIER_ASSERT(varlen->NeedReclaim() || varlen->IsInlined(), "Fresh updates cannot be compacted or compressed");
-        if (varlen->NeedReclaim()) txn->loose_ptrs_.push_back(varlen->Content());
+        if (varlen->NeedReclaim()) txn->loose_varlens_.push_back(*varlen);
       }
     }
   }
@@ -286,7 +286,7 @@ void TransactionManager::DeallocateColumnUpdateIfVarlen(TransactionContext *txn,
     auto *varlen = reinterpret_cast<storage::VarlenEntry *>(accessor.AccessWithNullCheck(undo->Slot(), col_id));
     if (varlen != nullptr) {
       TERRIER_ASSERT(varlen->NeedReclaim() || varlen->IsInlined(), "Fresh updates cannot be compacted or compressed");
-      if (varlen->NeedReclaim()) txn->loose_ptrs_.push_back(varlen->Content());
+      if (varlen->NeedReclaim()) txn->loose_varlens_.push_back(*varlen);
     }
   }
 }
@@ -299,7 +299,7 @@ void TransactionManager::DeallocateInsertedTupleIfVarlen(TransactionContext *txn
     if (layout.IsVarlen(col_id)) {
       auto *varlen = reinterpret_cast<storage::VarlenEntry *>(accessor.AccessWithNullCheck(undo->Slot(), col_id));
       if (varlen != nullptr) {
-        if (varlen->NeedReclaim()) txn->loose_ptrs_.push_back(varlen->Content());
+        if (varlen->NeedReclaim()) txn->loose_varlens_.push_back(*varlen);
       }
     }
   }
@@ -68,6 +68,45 @@ TEST(ObjectPoolTests, ResetLimitTest) {
   }
 }
 
+// Objects cached by a thread stay reachable for other threads once the pool runs up against its size limit, even after
+// the caching thread is gone
+// NOLINTNEXTLINE
+TEST(ObjectPoolTests, CrossThreadReuseTest) {
+  const uint64_t size_limit = 10;
+  common::ObjectPool<uint32_t> tested(size_limit, size_limit);
+  std::unordered_set<uint32_t *> used_ptrs;
+  std::thread caching_thread([&] {
+    for (uint32_t i = 0; i < size_limit; ++i) used_ptrs.insert(tested.Get());
+    for (auto &it : used_ptrs) tested.Release(it);
+  });
+  caching_thread.join();
+
+  std::vector<uint32_t *> ptrs;
+  for (uint32_t i = 0; i < size_limit; ++i) {
+    uint32_t *ptr = tested.Get();
+    EXPECT_FALSE(used_ptrs.find(ptr) == used_ptrs.end());
+    ptrs.emplace_back(ptr);
+  }
+  EXPECT_THROW(tested.Get(), common::NoMoreObjectException);
+
+  // Spilling from a full magazine and refilling from the shared free list hands out every object exactly once
+  for (auto &it : ptrs) tested.Release(it);
+  EXPECT_TRUE(tested.SetSizeLimit(3 * common::ObjectPool<uint32_t>::MAGAZINE_SIZE));
+  tested.SetReuseLimit(3 * common::ObjectPool<uint32_t>::MAGAZINE_SIZE);
+  ptrs.clear();
+  for (uint32_t i = 0; i < 3 * common::ObjectPool<uint32_t>::MAGAZINE_SIZE; ++i) ptrs.emplace_back(tested.Get());
+  for (auto &it : ptrs) tested.Release(it);
+  std::unordered_set<uint32_t *> distinct;
+  const std::unordered_set<uint32_t *> released(ptrs.begin(), ptrs.end());
+  for (uint32_t i = 0; i < 3 * common::ObjectPool<uint32_t>::MAGAZINE_SIZE; ++i) {
+    uint32_t *ptr = tested.Get();
+    EXPECT_FALSE(released.find(ptr) == released.end());
+    EXPECT_TRUE(distinct.insert(ptr).second);
+  }
+  EXPECT_THROW(tested.Get(), common::NoMoreObjectException);
+  for (auto &it : distinct) tested.Release(it);
+}
+
 class ObjectPoolTestType {
  public:
   ObjectPoolTestType *Use(uint32_t thread_id) {
@@ -320,4 +320,51 @@ TEST_F(BytecodeGeneratorTest, FunctionTest) {
   EXPECT_EQ(20, s.b_);
 }
 
+// NOLINTNEXTLINE
+TEST_F(BytecodeGeneratorTest, SuperinstructionTest) {
+  auto src = R"(
+    struct S {
+      a: int64
+      b: int32
+    }
+    fun test(s: *S, n: int32) -> int64 {
+      var sum: int64 = 0
+      for (var i: int32 = 0; i < n; i = i + 1) {
+        if (s.b != i) {
+          sum = sum + s.a
+        }
+      }
+      return sum
+    })";
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(src);
+  ASSERT_TRUE(module != nullptr);
+
+  // The loop and if conditions should fuse with their jumps, and the field
+  // loads with their address computations.
+  bool has_fused_jump = false, has_fused_deref = false;
+  const auto *func_info = module->GetFuncInfoByName("test");
+  ASSERT_TRUE(func_info != nullptr);
+  for (auto iter = module->GetBytecodeModule()->BytecodeForFunction(*func_info); !iter.Done(); iter.Advance()) {
+    has_fused_jump |= iter.CurrentBytecode() == Bytecode::LessThanJumpIfFalse_int32_t;
+    has_fused_deref |= iter.CurrentBytecode() == Bytecode::LeaDeref4;
+    EXPECT_NE(Bytecode::JumpIfFalse, iter.CurrentBytecode());
+  }
+  EXPECT_TRUE(has_fused_jump);
+  EXPECT_TRUE(has_fused_deref);
+
+  struct S {
+    int64_t a_;
+    int32_t b_;
+  };
+
+  std::function<int64_t(S *, int32_t)> f;
+  EXPECT_TRUE(module->GetFunction("test", ExecutionMode::Interpret, &f)) << "Function 'test' not found in module";
+
+  S s{3, 4};
+  EXPECT_EQ(0, f(&s, 0));
+  EXPECT_EQ(12, f(&s, 4));
+  EXPECT_EQ(27, f(&s, 10));
+}
+
 }  // namespace terrier::execution::vm::test
@@ -102,4 +102,28 @@ TEST_F(BytecodesTest, OperandTypesTest) {
   EXPECT_EQ(OperandType::Local, Bytecodes::GetNthOperandType(Bytecode::Add_int32_t, 2));
 }
 
+// NOLINTNEXTLINE
+TEST_F(BytecodesTest, SuperinstructionTest) {
+  // Fused conditional jumps are jumps whose jump offset is the last operand
+  EXPECT_TRUE(Bytecodes::IsJump(Bytecode::LessThanJumpIfFalse_int32_t));
+  EXPECT_TRUE(Bytecodes::IsFusedConditionalJump(Bytecode::GreaterThanJumpIfFalse_int8_t));
+  EXPECT_TRUE(Bytecodes::IsFusedConditionalJump(Bytecode::NotEqualJumpIfFalse_uint64_t));
+  EXPECT_TRUE(Bytecodes::IsFusedConditionalJump(Bytecode::ForceBoolTruthJumpIfFalse));
+  EXPECT_TRUE(Bytecodes::IsFusedConditionalJump(Bytecode::PCIHasNextFilteredJumpIfFalse));
+  EXPECT_FALSE(Bytecodes::IsFusedConditionalJump(Bytecode::JumpIfFalse));
+  EXPECT_FALSE(Bytecodes::IsFusedConditionalJump(Bytecode::LessThan_int32_t));
+  EXPECT_FALSE(Bytecodes::IsTerminal(Bytecode::LessThanJumpIfFalse_int32_t));
+
+  EXPECT_EQ(0u, Bytecodes::GetJumpOffsetOperandIndex(Bytecode::Jump));
+  EXPECT_EQ(1u, Bytecodes::GetJumpOffsetOperandIndex(Bytecode::JumpIfFalse));
+  EXPECT_EQ(3u, Bytecodes::GetJumpOffsetOperandIndex(Bytecode::LessThanJumpIfFalse_int32_t));
+  EXPECT_EQ(2u, Bytecodes::GetJumpOffsetOperandIndex(Bytecode::PCIHasNextJumpIfFalse));
+  EXPECT_EQ(OperandType::JumpOffset, Bytecodes::GetNthOperandType(Bytecode::EqualJumpIfFalse_int64_t, 3));
+
+  // Lea+Deref keeps the Lea operands in place and appends the Deref destination
+  EXPECT_EQ(4u, Bytecodes::NumOperands(Bytecode::LeaDeref4));
+  EXPECT_EQ(Bytecodes::GetNthOperandOffset(Bytecode::Lea, 2), Bytecodes::GetNthOperandOffset(Bytecode::LeaDeref4, 2));
+  EXPECT_EQ(OperandType::Local, Bytecodes::GetNthOperandType(Bytecode::LeaDeref4, 3));
+}
+
 }  // namespace terrier::execution::vm::test
@@ -29,6 +29,7 @@
 #include "planner/plannodes/index_scan_plan_node.h"
 #include "planner/plannodes/insert_plan_node.h"
 #include "planner/plannodes/limit_plan_node.h"
+#include "planner/plannodes/merge_join_plan_node.h"
 #include "planner/plannodes/nested_loop_join_plan_node.h"
 #include "planner/plannodes/order_by_plan_node.h"
 #include "planner/plannodes/output_schema.h"
@@ -1227,6 +1228,97 @@ TEST_F(CompilerTest, StaticAggregateHavingTest) {
   multi_checker.CheckCorrectness();
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, SortedAggregateTest) {
+  // SELECT col1 / 10, SUM(col1) FROM test_1 WHERE col1 BETWEEN 0 AND 999 GROUP BY col1 / 10;
+  // The index scan outputs the rows sorted on col1, so that the aggregation streams one group after the other.
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto index_oid = accessor->GetIndexOid(NSOid(), "index_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  std::unique_ptr<planner::AbstractPlanNode> index_scan;
+  OutputSchemaHelper index_scan_out{0, &expr_maker};
+  {
+    // OIDs
+    auto cola_oid = table_schema.GetColumn("colA").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    index_scan_out.AddOutput("col1", col1);
+    auto schema = index_scan_out.MakeSchema();
+    planner::IndexScanPlanNode::Builder builder;
+    index_scan = builder.SetTableOid(table_oid)
+                     .SetColumnOids({cola_oid})
+                     .SetIndexOid(index_oid)
+                     .AddLoIndexColumn(catalog::indexkeycol_oid_t(1), expr_maker.Constant(0))
+                     .AddHiIndexColumn(catalog::indexkeycol_oid_t(1), expr_maker.Constant(999))
+                     .SetNamespaceOid(NSOid())
+                     .SetOutputSchema(std::move(schema))
+                     .SetScanType(planner::IndexScanType::AscendingClosed)
+                     .SetScanLimit(0)
+                     .SetScanPredicate(nullptr)
+                     .Build();
+  }
+  // Make the aggregate
+  std::unique_ptr<planner::AbstractPlanNode> agg;
+  OutputSchemaHelper agg_out{0, &expr_maker};
+  {
+    // Read previous output
+    auto col1 = index_scan_out.GetOutput("col1");
+    // Add group by term
+    agg_out.AddGroupByTerm("col1_div_10", expr_maker.OpDiv(col1, expr_maker.Constant(10)));
+    // Add aggregates
+    auto sum_col1 = expr_maker.AggSum(col1);
+    agg_out.AddAggTerm("sum_col1", sum_col1);
+    // Make the output expressions
+    agg_out.AddOutput("col1_div_10", agg_out.GetGroupByTermForOutput("col1_div_10"));
+    agg_out.AddOutput("sum_col1", agg_out.GetAggTermForOutput("sum_col1"));
+    auto schema = agg_out.MakeSchema();
+    // Build
+    planner::AggregatePlanNode::Builder builder;
+    agg = builder.SetOutputSchema(std::move(schema))
+              .AddGroupByTerm(agg_out.GetGroupByTerm("col1_div_10"))
+              .AddAggregateTerm(agg_out.GetAggTerm("sum_col1"))
+              .AddChild(std::move(index_scan))
+              .SetAggregateStrategyType(planner::AggregateStrategyType::SORTED)
+              .SetHavingClausePredicate(nullptr)
+              .Build();
+  }
+  // Make the checker
+  // The groups are output in order, and group i sums 10 * i to 10 * i + 9
+  uint32_t num_output_rows{0};
+  uint32_t num_expected_rows{100};
+  RowChecker row_checker = [&num_output_rows, num_expected_rows](const std::vector<sql::Val *> &vals) {
+    // Read cols
+    auto group = static_cast<sql::Integer *>(vals[0]);
+    auto sum = static_cast<sql::Integer *>(vals[1]);
+    ASSERT_FALSE(group->is_null_ || sum->is_null_);
+    ASSERT_EQ(group->val_, static_cast<int64_t>(num_output_rows));
+    ASSERT_EQ(sum->val_, static_cast<int64_t>(100 * num_output_rows + 45));
+    num_output_rows++;
+    ASSERT_LE(num_output_rows, num_expected_rows);
+  };
+  CorrectnessFn correcteness_fn = [&num_output_rows, num_expected_rows]() {
+    ASSERT_EQ(num_output_rows, num_expected_rows);
+  };
+  GenericChecker checker(row_checker, correcteness_fn);
+
+  // Compile and Run
+  OutputStore store{&checker, agg->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(agg->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), agg->GetOutputSchema().Get());
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(agg), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  checker.CheckCorrectness();
+
+  // The aggregation does not break the pipeline
+  auto pipeline = executable.GetPipelineOperatingUnits();
+  EXPECT_EQ(pipeline->units_.size(), 1);
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, SimpleHashJoinTest) {
   // SELECT t1.col1, t2.col1, t2.col2, t1.col1 + t2.col2 FROM t1 INNER JOIN t2 ON t1.col1=t2.col1
@@ -1372,6 +1464,234 @@ TEST_F(CompilerTest, SimpleHashJoinTest) {
   EXPECT_TRUE(CheckFeatureVectorEquality(feature_vec1, exp_vec1));
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, OuterAndAntiHashJoinTest) {
+  // SELECT t1.col1, t2.col1 FROM t1 {LEFT | RIGHT | FULL OUTER} JOIN t2 ON t1.col1=t2.col1
+  // WHERE t1.col1 < 100 AND t2.col1 >= 50
+  // and
+  // SELECT t1.col1 FROM t1 WHERE t1.col1 < 100
+  // AND NOT EXISTS (SELECT * FROM t2 WHERE t2.col1 >= 50 AND t1.col1=t2.col1)
+  // Rows 50 to 99 match. Rows 0 to 49 of t1 and rows 100 to 999 of t2 do not.
+  auto accessor = MakeAccessor();
+  auto table_oid1 = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_oid2 = accessor->GetTableOid(NSOid(), "test_2");
+  auto table_schema1 = accessor->GetSchema(table_oid1);
+  auto table_schema2 = accessor->GetSchema(table_oid2);
+
+  for (const auto join_type : {planner::LogicalJoinType::LEFT, planner::LogicalJoinType::RIGHT,
+                               planner::LogicalJoinType::OUTER, planner::LogicalJoinType::ANTI}) {
+    ExpressionMaker expr_maker;
+    std::unique_ptr<planner::AbstractPlanNode> seq_scan1;
+    OutputSchemaHelper seq_scan_out1{0, &expr_maker};
+    {
+      auto cola_oid = table_schema1.GetColumn("colA").Oid();
+      auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+      seq_scan_out1.AddOutput("col1", col1);
+      auto schema = seq_scan_out1.MakeSchema();
+      auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(100));
+      planner::SeqScanPlanNode::Builder builder;
+      seq_scan1 = builder.SetOutputSchema(std::move(schema))
+                      .SetColumnOids({cola_oid})
+                      .SetScanPredicate(predicate)
+                      .SetIsForUpdateFlag(false)
+                      .SetNamespaceOid(NSOid())
+                      .SetTableOid(table_oid1)
+                      .Build();
+    }
+    std::unique_ptr<planner::AbstractPlanNode> seq_scan2;
+    OutputSchemaHelper seq_scan_out2{1, &expr_maker};
+    {
+      auto col1_oid = table_schema2.GetColumn("col1").Oid();
+      auto col1 = expr_maker.CVE(col1_oid, type::TypeId::SMALLINT);
+      seq_scan_out2.AddOutput("col1", col1);
+      auto schema = seq_scan_out2.MakeSchema();
+      auto predicate = expr_maker.ComparisonGe(col1, expr_maker.Constant(50));
+      planner::SeqScanPlanNode::Builder builder;
+      seq_scan2 = builder.SetOutputSchema(std::move(schema))
+                      .SetColumnOids({col1_oid})
+                      .SetScanPredicate(predicate)
+                      .SetIsForUpdateFlag(false)
+                      .SetNamespaceOid(NSOid())
+                      .SetTableOid(table_oid2)
+                      .Build();
+    }
+    // Anti joins only output the columns of the left side
+    const bool anti = join_type == planner::LogicalJoinType::ANTI;
+    std::unique_ptr<planner::AbstractPlanNode> hash_join;
+    OutputSchemaHelper hash_join_out{0, &expr_maker};
+    {
+      auto t1_col1 = seq_scan_out1.GetOutput("col1");
+      auto t2_col1 = seq_scan_out2.GetOutput("col1");
+      hash_join_out.AddOutput("t1.col1", t1_col1);
+      if (!anti) hash_join_out.AddOutput("t2.col1", t2_col1);
+      auto schema = hash_join_out.MakeSchema();
+      auto predicate = expr_maker.ComparisonEq(t1_col1, t2_col1);
+      planner::HashJoinPlanNode::Builder builder;
+      hash_join = builder.AddChild(std::move(seq_scan1))
+                      .AddChild(std::move(seq_scan2))
+                      .SetOutputSchema(std::move(schema))
+                      .AddLeftHashKey(t1_col1)
+                      .AddRightHashKey(t2_col1)
+                      .SetJoinType(join_type)
+                      .SetJoinPredicate(predicate)
+                      .Build();
+    }
+
+    // Matched rows, rows of t1 without a match, and rows of t2 without a match
+    uint32_t num_matched{0}, num_left_only{0}, num_right_only{0};
+    RowChecker row_checker = [&](const std::vector<sql::Val *> &vals) {
+      auto t1_col1 = static_cast<sql::Integer *>(vals[0]);
+      if (anti) {
+        ASSERT_FALSE(t1_col1->is_null_);
+        ASSERT_LT(t1_col1->val_, 50);
+        num_left_only++;
+        return;
+      }
+      auto t2_col1 = static_cast<sql::Integer *>(vals[1]);
+      ASSERT_FALSE(t1_col1->is_null_ && t2_col1->is_null_);
+      if (t2_col1->is_null_) {
+        ASSERT_LT(t1_col1->val_, 50);
+        num_left_only++;
+      } else if (t1_col1->is_null_) {
+        ASSERT_GE(t2_col1->val_, 100);
+        num_right_only++;
+      } else {
+        ASSERT_EQ(t1_col1->val_, t2_col1->val_);
+        num_matched++;
+      }
+    };
+    const bool keeps_left = join_type != planner::LogicalJoinType::RIGHT;
+    const bool keeps_right =
+        join_type == planner::LogicalJoinType::RIGHT || join_type == planner::LogicalJoinType::OUTER;
+    CorrectnessFn correctness_fn = [&]() {
+      ASSERT_EQ(num_matched, anti ? 0u : 50u);
+      ASSERT_EQ(num_left_only, keeps_left ? 50u : 0u);
+      ASSERT_EQ(num_right_only, keeps_right ? 900u : 0u);
+    };
+
+    GenericChecker checker(row_checker, correctness_fn);
+    OutputStore store{&checker, hash_join->GetOutputSchema().Get()};
+    exec::OutputPrinter printer(hash_join->GetOutputSchema().Get());
+    MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+    auto exec_ctx = MakeExecCtx(std::move(callback), hash_join->GetOutputSchema().Get());
+
+    auto executable = ExecutableQuery(common::ManagedPointer(hash_join), common::ManagedPointer(exec_ctx));
+    executable.Run(common::ManagedPointer(exec_ctx), MODE);
+    checker.CheckCorrectness();
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, SimpleMergeJoinTest) {
+  // SELECT t1.col1, t2.col1, t2.col2, t1.col1 + t2.col2 FROM t1 AS t1 INNER JOIN t1 AS t2 ON t1.col1=t2.col1
+  // WHERE t1.col1 BETWEEN 0 AND 999 AND t2.col1 BETWEEN 495 AND 505
+  // Both index scans output their rows sorted on the join key.
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto index_oid = accessor->GetIndexOid(NSOid(), "index_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  auto cola_oid = table_schema.GetColumn("colA").Oid();
+  auto colb_oid = table_schema.GetColumn("colB").Oid();
+
+  // Make an index scan of t1 with the given bounds
+  auto make_index_scan = [&](OutputSchemaHelper *out, int32_t lo, int32_t hi) {
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    out->AddOutput("col1", col1);
+    out->AddOutput("col2", col2);
+    auto schema = out->MakeSchema();
+    planner::IndexScanPlanNode::Builder builder;
+    return builder.SetTableOid(table_oid)
+        .SetColumnOids({cola_oid, colb_oid})
+        .SetIndexOid(index_oid)
+        .AddLoIndexColumn(catalog::indexkeycol_oid_t(1), expr_maker.Constant(lo))
+        .AddHiIndexColumn(catalog::indexkeycol_oid_t(1), expr_maker.Constant(hi))
+        .SetNamespaceOid(NSOid())
+        .SetOutputSchema(std::move(schema))
+        .SetScanType(planner::IndexScanType::AscendingClosed)
+        .SetScanLimit(0)
+        .SetScanPredicate(nullptr)
+        .Build();
+  };
+  OutputSchemaHelper index_scan_out1{0, &expr_maker};
+  std::unique_ptr<planner::AbstractPlanNode> index_scan1 = make_index_scan(&index_scan_out1, 0, 999);
+  OutputSchemaHelper index_scan_out2{1, &expr_maker};
+  std::unique_ptr<planner::AbstractPlanNode> index_scan2 = make_index_scan(&index_scan_out2, 495, 505);
+
+  // Make merge join
+  std::unique_ptr<planner::AbstractPlanNode> merge_join;
+  OutputSchemaHelper merge_join_out{0, &expr_maker};
+  {
+    // t1.col1
+    auto t1_col1 = index_scan_out1.GetOutput("col1");
+    // t2.col1 and t2.col2
+    auto t2_col1 = index_scan_out2.GetOutput("col1");
+    auto t2_col2 = index_scan_out2.GetOutput("col2");
+    // t1.col1 + t2.col2
+    auto sum = expr_maker.OpSum(t1_col1, t2_col2);
+    // Output Schema
+    merge_join_out.AddOutput("t1.col1", t1_col1);
+    merge_join_out.AddOutput("t2.col1", t2_col1);
+    merge_join_out.AddOutput("t2.col2", t2_col2);
+    merge_join_out.AddOutput("sum", sum);
+    auto schema = merge_join_out.MakeSchema();
+    // Predicate
+    auto predicate = expr_maker.ComparisonEq(t1_col1, t2_col1);
+    // Build
+    planner::MergeJoinPlanNode::Builder builder;
+    merge_join = builder.AddChild(std::move(index_scan1))
+                     .AddChild(std::move(index_scan2))
+                     .SetOutputSchema(std::move(schema))
+                     .AddLeftMergeKey(t1_col1)
+                     .AddRightMergeKey(t2_col1)
+                     .SetJoinType(planner::LogicalJoinType::INNER)
+                     .SetJoinPredicate(predicate)
+                     .Build();
+  }
+  // Compile and Run
+  // The joined cols should be equal, and output in order
+  // The 4th column is the sum of the 1nd and 3rd columns
+  uint32_t num_output_rows{0};
+  uint32_t num_expected_rows{11};
+  RowChecker row_checker = [&num_output_rows, num_expected_rows](const std::vector<sql::Val *> &vals) {
+    // Read cols
+    auto col1 = static_cast<sql::Integer *>(vals[0]);
+    auto col2 = static_cast<sql::Integer *>(vals[1]);
+    auto col3 = static_cast<sql::Integer *>(vals[2]);
+    auto col4 = static_cast<sql::Integer *>(vals[3]);
+    ASSERT_FALSE(col1->is_null_ || col2->is_null_);
+    // Check join cols
+    ASSERT_EQ(col1->val_, static_cast<int64_t>(495 + num_output_rows));
+    ASSERT_EQ(col1->val_, col2->val_);
+    // Check that col4 = col1 + col3
+    ASSERT_EQ(col4->val_, col1->val_ + col3->val_);
+    // Check the number of output row
+    num_output_rows++;
+    ASSERT_LE(num_output_rows, num_expected_rows);
+  };
+  CorrectnessFn correcteness_fn = [&num_output_rows, num_expected_rows]() {
+    ASSERT_EQ(num_output_rows, num_expected_rows);
+  };
+
+  GenericChecker checker(row_checker, correcteness_fn);
+
+  OutputStore store{&checker, merge_join->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(merge_join->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), merge_join->GetOutputSchema().Get());
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(merge_join), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  checker.CheckCorrectness();
+
+  // Pipeline Units
+  auto pipeline = executable.GetPipelineOperatingUnits();
+  EXPECT_EQ(pipeline->units_.size(), 2);
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, MultiWayHashJoinTest) {
   // SELECT t1.col1, t2.col1, t3.col1, t1.col1 + t2.col1 + t3.col1
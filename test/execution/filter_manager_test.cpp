@@ -1,5 +1,6 @@
 #include "execution/sql/filter_manager.h"
 
+#include <array>
 #include <chrono>  // NOLINT
 #include <limits>
 #include <memory>
@@ -52,12 +53,17 @@ uint32_t VectorizedLt500(ProjectedColumnsIterator *pci) {
   return pci->FilterColByVal<std::less>(Col::A, type::TypeId ::INTEGER, param);
 }
 
+uint32_t VectorizedLt9000(ProjectedColumnsIterator *pci) {
+  ProjectedColumnsIterator::FilterVal param{.i_ = 9000};
+  return pci->FilterColByVal<std::less>(Col::A, type::TypeId ::INTEGER, param);
+}
+
 // NOLINTNEXTLINE
 TEST_F(FilterManagerTest, DISABLED_SimpleFilterManagerTest) {
   FilterManager filter(bandit::Policy::Kind::FixedAction);
   filter.StartNewClause();
-  filter.InsertClauseFlavor(TaaTLt500);
-  filter.InsertClauseFlavor(VectorizedLt500);
+  filter.InsertClauseFlavor(TaaTLt500, 0);
+  filter.InsertClauseFlavor(VectorizedLt500, 1);
   filter.Finalize();
   auto table_oid = exec_ctx_->GetAccessor()->GetTableOid(NSOid(), "test_1");
   std::array<uint32_t, 1> col_oids{1};
@@ -80,8 +86,8 @@ TEST_F(FilterManagerTest, DISABLED_SimpleFilterManagerTest) {
 TEST_F(FilterManagerTest, DISABLED_AdaptiveFilterManagerTest) {
   FilterManager filter(bandit::Policy::Kind::EpsilonGreedy);
   filter.StartNewClause();
-  filter.InsertClauseFlavor(HobbledTaaTLt500);
-  filter.InsertClauseFlavor(VectorizedLt500);
+  filter.InsertClauseFlavor(HobbledTaaTLt500, 0);
+  filter.InsertClauseFlavor(VectorizedLt500, 1);
   filter.Finalize();
   auto table_oid = exec_ctx_->GetAccessor()->GetTableOid(NSOid(), "test_1");
   std::array<uint32_t, 1> col_oids{1};
@@ -103,4 +109,59 @@ TEST_F(FilterManagerTest, DISABLED_AdaptiveFilterManagerTest) {
   EXPECT_EQ(1u, filter.GetOptimalFlavorForClause(0));
 }
 
+// NOLINTNEXTLINE
+TEST_F(FilterManagerTest, ClauseReorderingTest) {
+  //
+  // WHERE colA < 9000 AND colA < 500
+  //
+  // The second clause is far more selective, so it should be moved first. A
+  // second execution of the same plan should start with the learned order,
+  // even though it was compiled anew, and so its flavors live at different
+  // addresses. A different plan at the same addresses should not.
+  //
+
+  FilterManager::StatsCache cache;
+  auto table_oid = exec_ctx_->GetAccessor()->GetTableOid(NSOid(), "test_1");
+  std::array<uint32_t, 1> col_oids{1};
+
+  // The same functions at other addresses, as if compiled again
+  const FilterManager::MatchFn recompiled_lt9000 = [](ProjectedColumnsIterator *pci) { return VectorizedLt9000(pci); };
+  const FilterManager::MatchFn recompiled_lt500 = [](ProjectedColumnsIterator *pci) { return VectorizedLt500(pci); };
+
+  for (uint32_t run = 0; run < 3; run++) {
+    FilterManager filter(bandit::Policy::Kind::FixedAction, &cache);
+    filter.StartNewClause();
+    filter.InsertClauseFlavor(run == 1 ? recompiled_lt9000 : VectorizedLt9000, run == 2 ? 2 : 0);
+    filter.StartNewClause();
+    filter.InsertClauseFlavor(run == 1 ? recompiled_lt500 : VectorizedLt500, run == 2 ? 3 : 1);
+    filter.Finalize();
+
+    // The first and the third run start in the given order, the second in the learned one
+    std::vector<uint32_t> expected_start = run == 1 ? std::vector<uint32_t>{1, 0} : std::vector<uint32_t>{0, 1};
+    EXPECT_EQ(expected_start, filter.GetClauseOrder());
+
+    uint32_t count = 0;
+    TableVectorIterator tvi(exec_ctx_.get(), !table_oid, col_oids.data(), static_cast<uint32_t>(col_oids.size()));
+    for (tvi.Init(); tvi.Advance();) {
+      auto *pci = tvi.GetProjectedColumnsIterator();
+
+      // Run the filters
+      filter.RunFilters(pci);
+
+      // Check
+      pci->ForEach([pci, &count]() {
+        auto cola = *pci->Get<int32_t, false>(Col::A, nullptr);
+        EXPECT_LT(cola, 500);
+        count++;
+      });
+    }
+
+    EXPECT_EQ(500u, count);
+    EXPECT_EQ((std::vector<uint32_t>{1, 0}), filter.GetClauseOrder());
+    EXPECT_LT(filter.GetClauseStats(1).selectivity_, filter.GetClauseStats(0).selectivity_);
+  }
+
+  EXPECT_EQ(2u, cache.NumPlans());
+}
+
 }  // namespace terrier::execution::sql::test
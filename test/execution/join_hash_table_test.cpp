@@ -39,6 +39,18 @@ class JoinHashTableTest : public TplTest {
 
   BloomFilter *BloomFilterFor(JoinHashTable *join_hash_table) { return &join_hash_table->bloom_filter_; }
 
+  void PartitionEntries(JoinHashTable *join_hash_table, uint32_t radix_bits) {
+    join_hash_table->PartitionEntries(radix_bits);
+  }
+
+  uint64_t PartitionBegin(JoinHashTable *join_hash_table, uint64_t part) {
+    return join_hash_table->partition_offsets_[part];
+  }
+
+  const HashTableEntry *PartitionedEntryAt(JoinHashTable *join_hash_table, uint64_t idx) {
+    return join_hash_table->PartitionedEntryAt(idx);
+  }
+
  private:
   MemoryPool memory_;
 };
@@ -164,6 +176,113 @@ TEST_F(JoinHashTableTest, UniqueKeyConciseTableTest) { BuildAndProbeTest<true>(4
 // NOLINTNEXTLINE
 TEST_F(JoinHashTableTest, DuplicateKeyLookupConciseTableTest) { BuildAndProbeTest<true>(400, 5); }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableTest, RadixPartitionTest) {
+  // Partition on more bits than a single pass handles, so that both passes run
+  const uint32_t num_tuples = 100000;
+  const uint32_t radix_bits = 12;
+
+  JoinHashTable join_hash_table(Memory(), sizeof(Tuple), false, true);
+  PopulateJoinHashTable(&join_hash_table, num_tuples, 2);
+  PartitionEntries(&join_hash_table, radix_bits);
+  EXPECT_EQ(uint64_t{1} << radix_bits, join_hash_table.NumPartitions());
+
+  // Every entry lands in the partition of its top hash bits exactly once
+  std::vector<uint32_t> counts(num_tuples, 0);
+  for (uint64_t part = 0; part < join_hash_table.NumPartitions(); part++) {
+    const uint64_t end = PartitionBegin(&join_hash_table, part + 1);
+    for (uint64_t idx = PartitionBegin(&join_hash_table, part); idx < end; idx++) {
+      const HashTableEntry *entry = PartitionedEntryAt(&join_hash_table, idx);
+      EXPECT_EQ(part, entry->hash_ >> (64 - radix_bits));
+      counts[reinterpret_cast<const Tuple *>(entry->payload_)->a_]++;
+    }
+  }
+  EXPECT_EQ(2u * num_tuples, PartitionBegin(&join_hash_table, join_hash_table.NumPartitions()));
+  for (uint32_t i = 0; i < num_tuples; i++) {
+    EXPECT_EQ(2u, counts[i]) << "Key [" << i << "] was not partitioned exactly twice";
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableTest, PartitionedJoinTest) {
+  const uint32_t num_build_tuples = 200000;
+  const uint32_t num_probe_tuples = num_build_tuples + 1000;
+
+  // Build side: every key twice
+  JoinHashTable build_table(Memory(), sizeof(Tuple), false, true);
+  PopulateJoinHashTable(&build_table, num_build_tuples, 2);
+  build_table.Build();
+
+  // Single lookups find both copies in the key's partition
+  for (uint32_t i = 0; i < num_build_tuples; i += 97) {
+    auto hash_val = util::Hasher::Hash(reinterpret_cast<const uint8_t *>(&i), sizeof(i));
+    Tuple probe_tuple = {i, 0, 0, 0};
+    uint32_t count = 0;
+    for (auto iter = build_table.Lookup<false>(hash_val);
+         iter.HasNext(TupleKeyEq, nullptr, reinterpret_cast<void *>(&probe_tuple));) {
+      EXPECT_EQ(i, reinterpret_cast<const Tuple *>(iter.NextMatch()->payload_)->a_);
+      count++;
+    }
+    EXPECT_EQ(2u, count);
+  }
+
+  // Probe side: every key once, plus keys that don't match
+  JoinHashTable probe_table(Memory(), sizeof(Tuple));
+  PopulateJoinHashTable(&probe_table, num_probe_tuples, 1);
+
+  uint64_t num_matches = 0;
+  for (JoinHashTablePartitionIterator iter(build_table, &probe_table); iter.HasNext(TupleKeyEq, nullptr);) {
+    auto *probe_tuple = reinterpret_cast<const Tuple *>(iter.GetProbeRow());
+    auto *build_tuple = reinterpret_cast<const Tuple *>(iter.GetBuildRow());
+    EXPECT_EQ(probe_tuple->a_, build_tuple->a_);
+    EXPECT_LT(probe_tuple->a_, num_build_tuples);
+    num_matches++;
+  }
+  EXPECT_EQ(2u * num_build_tuples, num_matches);
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableTest, EntryIteratorTest) {
+  const uint32_t num_tuples = 100000;
+
+  // Outer joins mark every build tuple as unmatched, clear the mark of the tuples a probe matches, and then scan for
+  // the tuples still marked. Every kind of table must hand the scan the same entries its probes see.
+  auto check = [this](JoinHashTable *join_hash_table) {
+    PopulateJoinHashTable(join_hash_table, num_tuples, 1);
+    for (JoinHashTableEntryIterator iter(*join_hash_table); iter.HasNext();) {
+      reinterpret_cast<Tuple *>(const_cast<byte *>(iter.GetRow()))->b_ = 1;
+    }
+    join_hash_table->Build();
+
+    // Probe with the even keys
+    for (uint32_t i = 0; i < num_tuples; i += 2) {
+      auto hash_val = util::Hasher::Hash(reinterpret_cast<const uint8_t *>(&i), sizeof(i));
+      Tuple probe_tuple = {i, 0, 0, 0};
+      for (auto iter = join_hash_table->Lookup<false>(hash_val);
+           iter.HasNext(TupleKeyEq, nullptr, reinterpret_cast<void *>(&probe_tuple));) {
+        reinterpret_cast<Tuple *>(const_cast<byte *>(iter.NextMatch()->payload_))->b_ = 0;
+      }
+    }
+
+    // Only the odd keys are left unmatched, and every entry is seen exactly once
+    std::vector<uint32_t> counts(num_tuples, 0);
+    for (JoinHashTableEntryIterator iter(*join_hash_table); iter.HasNext();) {
+      auto *tuple = reinterpret_cast<const Tuple *>(iter.GetRow());
+      counts[tuple->a_]++;
+      EXPECT_EQ(tuple->a_ % 2, tuple->b_);
+    }
+    for (uint32_t i = 0; i < num_tuples; i++) {
+      EXPECT_EQ(1u, counts[i]) << "Key [" << i << "] was not seen exactly once";
+    }
+  };
+
+  JoinHashTable generic_table(Memory(), sizeof(Tuple));
+  check(&generic_table);
+
+  JoinHashTable partitioned_table(Memory(), sizeof(Tuple), false, true);
+  check(&partitioned_table);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashTableTest, ParallelBuildTest) {
   const uint32_t num_tuples = 100000;
@@ -187,6 +306,13 @@ TEST_F(JoinHashTableTest, ParallelBuildTest) {
 
   JoinHashTable main_jht(&memory, sizeof(Tuple), false);
   main_jht.MergeParallel(&container, 0);
+
+  // The entries taken over from the thread-local tables are all iterated over
+  uint64_t num_entries = 0;
+  for (JoinHashTableEntryIterator iter(main_jht); iter.HasNext();) {
+    num_entries++;
+  }
+  EXPECT_EQ(4u * num_tuples, num_entries);
 }
 
 // NOLINTNEXTLINE
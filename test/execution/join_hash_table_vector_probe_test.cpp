@@ -9,6 +9,7 @@
 #include "execution/sql/join_hash_table.h"
 #include "execution/sql/join_hash_table_vector_probe.h"
 #include "execution/sql/projected_columns_iterator.h"
+#include "execution/sql/value.h"
 #include "execution/util/hash.h"
 #include "storage/projected_columns.h"
 #include "transaction/transaction_defs.h"
@@ -177,6 +178,72 @@ TEST_F(JoinHashTableVectorProbeTest, SimpleGenericLookupTest) {
   EXPECT_EQ(num_probe, count);
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableVectorProbeTest, ColumnWiseLookupTest) {
+  // Build rows as laid out by generated code: the key is a SQL value
+  struct BuildRow {
+    Integer key_;
+    Integer val_;
+  };
+
+  constexpr const uint32_t num_build = 1000;
+  constexpr const uint32_t num_probe = num_build * 10;
+
+  // Insert every key, and key 7 twice, hashing them like @hash() does
+  JoinHashTable jht(Memory(), sizeof(BuildRow));
+  auto insert = [&](int64_t key) {
+    auto hash = util::Hasher::CombineHashes(1, util::Hasher::Hash<util::HashMethod::Crc>(key));
+    auto *row = reinterpret_cast<BuildRow *>(jht.AllocInputTuple(hash));
+    row->key_ = Integer(key);
+    row->val_ = Integer(key * 10);
+  };
+  for (uint32_t i = 0; i < num_build; i++) {
+    insert(i);
+  }
+  insert(7);
+  jht.Build();
+
+  // Half of the probe keys have a match
+  auto probe_keys = std::vector<uint32_t>(num_probe);
+  std::generate(probe_keys.begin(), probe_keys.end(), Range(0, 2 * num_build - 1));
+
+  auto *projected_columns = GetProjectedColumns();
+  ProjectedColumnsIterator pci(projected_columns);
+
+  JoinHashTableVectorProbe lookup(jht);
+  lookup.AddKey(0, type::TypeId::INTEGER, /*build_offset*/ 0);
+
+  uint32_t count = 0, expected = 0;
+  for (uint32_t i = 0; i < num_probe; i += projected_columns->MaxTuples()) {
+    uint32_t size = std::min(projected_columns->MaxTuples(), num_probe - i);
+
+    // Setup Projected Column. The first probe tuple of every batch is NULL.
+    projected_columns->SetNumTuples(size);
+    std::memcpy(projected_columns->ColumnStart(0), &probe_keys[i], size * sizeof(uint32_t));
+    for (uint32_t j = 0; j < size; j++) {
+      projected_columns->ColumnNullBitmap(0)->Set(j, j != 0);
+    }
+    pci.SetProjectedColumn(projected_columns);
+    for (uint32_t j = 1; j < size; j++) {
+      expected += probe_keys[i + j] < num_build ? (probe_keys[i + j] == 7 ? 2 : 1) : 0;
+    }
+
+    // Lookup and iterate all
+    lookup.Prepare(&pci);
+    while (lookup.HasNextMatch(&pci)) {
+      count++;
+      const auto *row = reinterpret_cast<const BuildRow *>(lookup.GetMatchRow());
+      bool null = false;
+      auto probe_key = *pci.Get<uint32_t, true>(0, &null);
+      EXPECT_FALSE(null);
+      EXPECT_EQ(row->key_.val_, probe_key);
+      EXPECT_EQ(row->val_.val_, probe_key * 10);
+    }
+  }
+
+  EXPECT_EQ(expected, count);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashTableVectorProbeTest, DISABLED_PerfLookupTest) {
   auto bench = [this](bool concise) {
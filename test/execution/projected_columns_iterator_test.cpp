@@ -1,7 +1,9 @@
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <random>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -9,6 +11,10 @@
 
 #include "catalog/catalog.h"
 #include "execution/sql/projected_columns_iterator.h"
+#include "storage/block_compactor.h"
+#include "storage/garbage_collector.h"
+#include "transaction/deferred_action_manager.h"
+#include "transaction/transaction_manager.h"
 
 namespace terrier::execution::sql::test {
 
@@ -63,6 +69,53 @@ std::pair<std::unique_ptr<uint32_t[]>, uint32_t> CreateRandomNullBitmap(uint32_t
   return {std::move(input), num_nulls};
 }
 
+storage::VarlenEntry MakeVarlen(const std::string &word) {
+  const auto *content = reinterpret_cast<const byte *>(word.data());
+  const auto size = static_cast<uint32_t>(word.size());
+  return size <= storage::VarlenEntry::InlineThreshold() ? storage::VarlenEntry::CreateInline(content, size)
+                                                         : storage::VarlenEntry::Create(content, size, false);
+}
+
+// Filter a frozen VARCHAR column by comparing it with the probe, and check the
+// selected tuples against a tuple-at-a-time comparison of the strings
+template <template <typename> typename Op>
+void CheckFrozenFilter(ProjectedColumnsIterator *iter, const storage::FrozenColumnsView &view, uint16_t col_idx,
+                       const std::string &probe) {
+  const auto *values = reinterpret_cast<const storage::VarlenEntry *>(view.ColumnStart(col_idx));
+  std::vector<uint32_t> expected;
+  for (uint32_t i = 0; i < view.NumTuples(); i++) {
+    if (Op<std::string_view>()(values[i].StringView(), probe)) expected.push_back(i);
+  }
+
+  iter->SetFrozenColumns(&view);
+  ProjectedColumnsIterator::FilterVal val{.str_ = MakeVarlen(probe)};
+  EXPECT_EQ(expected.size(), iter->FilterColByVal<Op>(col_idx, type::TypeId::VARCHAR, val));
+  if (expected.empty()) return;
+  std::vector<uint32_t> selected;
+  iter->ForEach([&] { selected.push_back(iter->CurrentSlot().GetOffset() - view.Offset()); });
+  EXPECT_EQ(expected, selected);
+}
+
+// Filter a frozen BIGINT column by comparing it with the probe, and check the
+// selected tuples against a tuple-at-a-time comparison of the plain values
+template <template <typename> typename Op>
+void CheckFrozenIntFilter(ProjectedColumnsIterator *iter, const storage::FrozenColumnsView &view, uint16_t col_idx,
+                          int64_t probe) {
+  const auto *values = reinterpret_cast<const int64_t *>(view.ColumnStart(col_idx));
+  std::vector<uint32_t> expected;
+  for (uint32_t i = 0; i < view.NumTuples(); i++) {
+    if (Op<int64_t>()(values[i], probe)) expected.push_back(i);
+  }
+
+  iter->SetFrozenColumns(&view);
+  ProjectedColumnsIterator::FilterVal val{.bi_ = probe};
+  EXPECT_EQ(expected.size(), iter->FilterColByVal<Op>(col_idx, type::TypeId::BIGINT, val));
+  if (expected.empty()) return;
+  std::vector<uint32_t> selected;
+  iter->ForEach([&] { selected.push_back(iter->CurrentSlot().GetOffset() - view.Offset()); });
+  EXPECT_EQ(expected, selected);
+}
+
 }  // namespace
 
 class ProjectedColumnsIteratorTest : public SqlBasedTest {
@@ -452,4 +505,337 @@ TEST_F(ProjectedColumnsIteratorTest, MultipleVectorizedFilterTest) {
   EXPECT_LE(count, 10u);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ProjectedColumnsIteratorTest, NullVectorizedFilterTest) {
+  //
+  // IS NOT NULL and IS NULL on col_b must split the tuples in two
+  //
+
+  const auto &col_data = ColumnData(ColId::col_b);
+  {
+    ProjectedColumnsIterator iter(GetProjectedColumn());
+    SetSize(common::Constants::K_DEFAULT_VECTOR_SIZE);
+    EXPECT_EQ(col_data.num_tuples_ - col_data.num_nulls_, iter.FilterColIsNotNull(GetColOffset(ColId::col_b)));
+    for (; iter.HasNextFiltered(); iter.AdvanceFiltered()) {
+      bool null = false;
+      iter.Get<int32_t, true>(GetColOffset(ColId::col_b), &null);
+      EXPECT_FALSE(null);
+    }
+  }
+
+  {
+    ProjectedColumnsIterator iter(GetProjectedColumn());
+    SetSize(common::Constants::K_DEFAULT_VECTOR_SIZE);
+    EXPECT_EQ(col_data.num_nulls_, iter.FilterColIsNull(GetColOffset(ColId::col_b)));
+  }
+}
+
+// NOLINTNEXTLINE
+TEST_F(ProjectedColumnsIteratorTest, BetweenAndInVectorizedFilterTest) {
+  //
+  // Apply two filters in order:
+  //  - col_c BETWEEN 100 AND 500
+  //  - col_a IN (1, 200, 300, 4000)
+  //
+  // The result is checked against a tuple-at-a-time evaluation.
+  //
+
+  ProjectedColumnsIterator iter(GetProjectedColumn());
+  SetSize(common::Constants::K_DEFAULT_VECTOR_SIZE);
+
+  // Compute expected result
+  uint32_t expected = 0;
+  for (; iter.HasNext(); iter.Advance()) {
+    auto col_a_val = *iter.Get<int16_t, false>(GetColOffset(ColId::col_a), nullptr);
+    auto col_c_val = *iter.Get<int32_t, false>(GetColOffset(ColId::col_c), nullptr);
+    bool in_list = col_a_val == 1 || col_a_val == 200 || col_a_val == 300;
+    expected += static_cast<uint32_t>(col_c_val >= 100 && col_c_val <= 500 && in_list);
+  }
+
+  // Filter
+  iter.FilterColBetween(GetColOffset(ColId::col_c), type::TypeId::INTEGER,
+                        ProjectedColumnsIterator::FilterVal{.i_ = 100}, ProjectedColumnsIterator::FilterVal{.i_ = 500});
+  ProjectedColumnsIterator::FilterVal vals[] = {{.si_ = 1}, {.si_ = 200}, {.si_ = 300}, {.si_ = 4000}};
+  iter.FilterColIn(GetColOffset(ColId::col_a), type::TypeId::SMALLINT, vals, 4);
+
+  // Check
+  uint32_t count = 0;
+  for (; iter.HasNextFiltered(); iter.AdvanceFiltered()) {
+    auto col_c_val = *iter.Get<int32_t, false>(GetColOffset(ColId::col_c), nullptr);
+    EXPECT_GE(col_c_val, 100);
+    EXPECT_LE(col_c_val, 500);
+    count++;
+  }
+
+  EXPECT_EQ(expected, count);
+}
+
+// NOLINTNEXTLINE
+TEST_F(ProjectedColumnsIteratorTest, ColumnAndArithmeticVectorizedFilterTest) {
+  //
+  // Apply two filters in order:
+  //  - col_c * 2 < 1000
+  //  - col_b IS NOT NULL
+  //  - col_b > col_c
+  //
+  // The result is checked against a tuple-at-a-time evaluation.
+  //
+
+  ProjectedColumnsIterator iter(GetProjectedColumn());
+  SetSize(common::Constants::K_DEFAULT_VECTOR_SIZE);
+
+  // Compute expected result
+  uint32_t expected = 0;
+  for (; iter.HasNext(); iter.Advance()) {
+    bool null = false;
+    auto col_b_val = *iter.Get<int32_t, true>(GetColOffset(ColId::col_b), &null);
+    auto col_c_val = *iter.Get<int32_t, false>(GetColOffset(ColId::col_c), nullptr);
+    expected += static_cast<uint32_t>(col_c_val * 2 < 1000 && !null && col_b_val > col_c_val);
+  }
+
+  // Filter
+  iter.FilterColArithByVal<std::less>(GetColOffset(ColId::col_c), type::TypeId::INTEGER,
+                                      ProjectedColumnsIterator::ArithmeticOp::Multiply,
+                                      ProjectedColumnsIterator::FilterVal{.bi_ = 2},
+                                      ProjectedColumnsIterator::FilterVal{.bi_ = 1000});
+  iter.FilterColIsNotNull(GetColOffset(ColId::col_b));
+  iter.FilterColByCol<std::greater>(GetColOffset(ColId::col_b), type::TypeId::INTEGER, GetColOffset(ColId::col_c),
+                                    type::TypeId::INTEGER);
+
+  // Check
+  uint32_t count = 0;
+  for (; iter.HasNextFiltered(); iter.AdvanceFiltered()) {
+    auto col_b_val = *iter.Get<int32_t, false>(GetColOffset(ColId::col_b), nullptr);
+    auto col_c_val = *iter.Get<int32_t, false>(GetColOffset(ColId::col_c), nullptr);
+    EXPECT_LT(col_c_val, 500);
+    EXPECT_GT(col_b_val, col_c_val);
+    count++;
+  }
+
+  EXPECT_EQ(expected, count);
+}
+
+// NOLINTNEXTLINE
+TEST_F(ProjectedColumnsIteratorTest, FrozenDictionaryFilterTest) {
+  //
+  // Freeze a block with a dictionary compressed column and iterate over it in
+  // place. Filters on the column are evaluated on the dictionary codes, and
+  // are checked against comparing the strings themselves, including with
+  // values that are not in the dictionary.
+  //
+
+  const std::vector<std::string> words = {"apple", "banana", "cherry", "grapefruit from the south", "kiwi"};
+  const storage::BlockLayout layout({8, 8, storage::VARLEN_COLUMN});
+  storage::BlockStore block_store{1, 1};
+  storage::RecordBufferSegmentPool buffer_pool{10000, 10000};
+  storage::DataTable table(common::ManagedPointer<storage::BlockStore>(&block_store), layout,
+                           storage::layout_version_t(0));
+  storage::TupleAccessStrategy accessor(layout);
+  storage::RawBlock *block = table.GetBlocks()[0];
+  const storage::col_id_t int_col = layout.IsVarlen(storage::col_id_t(1)) ? storage::col_id_t(2) : storage::col_id_t(1);
+  const storage::col_id_t varlen_col = layout.Varlens()[0];
+
+  // Fill the block without versions, then compact and freeze it
+  const uint32_t num_tuples = layout.NumSlots();
+  std::mt19937 generator;
+  std::uniform_int_distribution<uint32_t> word_dist(0, static_cast<uint32_t>(words.size() - 1));
+  std::vector<std::string> reference;
+  for (uint32_t i = 0; i < num_tuples; i++) {
+    storage::TupleSlot slot;
+    ASSERT_TRUE(accessor.Allocate(block, &slot));
+    *reinterpret_cast<storage::UndoRecord **>(accessor.AccessForceNotNull(slot, storage::VERSION_POINTER_COLUMN_ID)) =
+        nullptr;
+    *reinterpret_cast<int64_t *>(accessor.AccessForceNotNull(slot, int_col)) = i;
+    // Long words point into the list of words, which outlives the block
+    const std::string &word = words[word_dist(generator)];
+    reference.push_back(word);
+    *reinterpret_cast<storage::VarlenEntry *>(accessor.AccessForceNotNull(slot, varlen_col)) = MakeVarlen(word);
+  }
+  auto &arrow_metadata = accessor.GetArrowBlockMetadata(block);
+  arrow_metadata.GetColumnInfo(layout, int_col).Type() = storage::ArrowColumnType::FIXED_LENGTH;
+  arrow_metadata.GetColumnInfo(layout, varlen_col).Type() = storage::ArrowColumnType::DICTIONARY_COMPRESSED;
+
+  transaction::TimestampManager timestamp_manager;
+  transaction::DeferredActionManager deferred_action_manager{common::ManagedPointer(&timestamp_manager)};
+  transaction::TransactionManager txn_manager{common::ManagedPointer(&timestamp_manager),
+                                              common::ManagedPointer(&deferred_action_manager),
+                                              common::ManagedPointer(&buffer_pool), true, DISABLED};
+  storage::GarbageCollector gc{common::ManagedPointer(&timestamp_manager),
+                               common::ManagedPointer(&deferred_action_manager), common::ManagedPointer(&txn_manager),
+                               DISABLED};
+  storage::BlockCompactor compactor;
+  compactor.PutInQueue(block);
+  compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager);  // compaction pass
+  gc.PerformGarbageCollection();
+  compactor.PutInQueue(block);
+  compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager);  // gathering pass
+  ASSERT_EQ(storage::BlockState::FROZEN, block->controller_.GetBlockState()->load());
+
+  // Read the whole block in place, a vector at a time
+  storage::ProjectedColumnsInitializer pc_init(layout, {int_col, varlen_col}, common::Constants::K_DEFAULT_VECTOR_SIZE);
+  auto *pc_buffer = common::AllocationUtil::AllocateAligned(pc_init.ProjectedColumnsSize());
+  storage::ProjectedColumns *projected_columns = pc_init.Initialize(pc_buffer);
+  const uint16_t int_idx = projected_columns->ColumnIds()[0] == int_col ? 0 : 1;
+  const uint16_t varlen_idx = 1 - int_idx;
+  storage::FrozenColumnsView view;
+  ProjectedColumnsIterator iter;
+  uint32_t count = 0;
+  for (auto it = table.begin(); it != table.end(); view.Release()) {
+    ASSERT_TRUE(table.TryViewFrozen(&it, *projected_columns, &view));
+    EXPECT_EQ(std::min(num_tuples - count, common::Constants::K_DEFAULT_VECTOR_SIZE), view.NumTuples());
+    EXPECT_EQ(nullptr, view.DictionaryCodes(int_idx));
+    EXPECT_NE(nullptr, view.DictionaryCodes(varlen_idx));
+
+    iter.SetFrozenColumns(&view);
+    EXPECT_EQ(view.NumTuples(), iter.NumSelected());
+    for (; iter.HasNext(); iter.Advance(), count++) {
+      EXPECT_EQ(storage::TupleSlot(block, count), iter.CurrentSlot());
+      auto int_val = *iter.Get<int64_t, false>(int_idx, nullptr);
+      auto varlen_val = *iter.Get<storage::VarlenEntry, false>(varlen_idx, nullptr);
+      EXPECT_EQ(count, int_val);
+      EXPECT_EQ(reference[count], varlen_val.StringView());
+    }
+
+    // Filter by every word in the dictionary, and by words in between
+    std::vector<std::string> probes = words;
+    probes.insert(probes.end(), {"aardvark", "blueberry", "zucchini and more zucchini"});
+    for (const auto &probe : probes) {
+      CheckFrozenFilter<std::equal_to>(&iter, view, varlen_idx, probe);
+      CheckFrozenFilter<std::not_equal_to>(&iter, view, varlen_idx, probe);
+      CheckFrozenFilter<std::less>(&iter, view, varlen_idx, probe);
+      CheckFrozenFilter<std::less_equal>(&iter, view, varlen_idx, probe);
+      CheckFrozenFilter<std::greater>(&iter, view, varlen_idx, probe);
+      CheckFrozenFilter<std::greater_equal>(&iter, view, varlen_idx, probe);
+    }
+
+    // Combine a range filter on the codes with an IN list that holds a missing word
+    uint32_t expected = 0;
+    for (uint32_t i = view.Offset(); i < view.Offset() + view.NumTuples(); i++) {
+      const auto &word = reference[i];
+      expected += static_cast<uint32_t>(word >= "blueberry" && word <= "kiwi" && (word == "cherry" || word == "kiwi"));
+    }
+    iter.SetFrozenColumns(&view);
+    iter.FilterColBetween(varlen_idx, type::TypeId::VARCHAR, {.str_ = MakeVarlen("blueberry")},
+                          {.str_ = MakeVarlen("kiwi")});
+    ProjectedColumnsIterator::FilterVal vals[] = {{.str_ = MakeVarlen("cherry")}, {.str_ = MakeVarlen("fig")},
+                                                  {.str_ = MakeVarlen("kiwi")}};
+    EXPECT_EQ(expected, iter.FilterColIn(varlen_idx, type::TypeId::VARCHAR, vals, 3));
+  }
+  EXPECT_EQ(num_tuples, count);
+
+  // Writers can only thaw the block once the views let go of it
+  block->controller_.WaitUntilHot();
+  delete[] pc_buffer;
+  gc.PerformGarbageCollection();
+  gc.PerformGarbageCollection();
+}
+
+// NOLINTNEXTLINE
+TEST_F(ProjectedColumnsIteratorTest, FrozenEncodedFilterTest) {
+  //
+  // Freeze a block whose integer columns get run-length, frame-of-reference
+  // and delta encoded, and iterate over it in place. Filters on the columns
+  // are evaluated on the encodings, and are checked against comparing the
+  // plain values, including with values outside of each block.
+  //
+
+  const storage::BlockLayout layout({8, 8, 8, 8});
+  const std::vector<storage::col_id_t> col_ids = {storage::col_id_t(1), storage::col_id_t(2), storage::col_id_t(3)};
+  storage::BlockStore block_store{1, 1};
+  storage::RecordBufferSegmentPool buffer_pool{10000, 10000};
+  storage::DataTable table(common::ManagedPointer<storage::BlockStore>(&block_store), layout,
+                           storage::layout_version_t(0));
+  storage::TupleAccessStrategy accessor(layout);
+  storage::RawBlock *block = table.GetBlocks()[0];
+
+  // Fill the block without versions, then compact and freeze it
+  const uint32_t num_tuples = layout.NumSlots();
+  for (uint32_t i = 0; i < num_tuples; i++) {
+    storage::TupleSlot slot;
+    ASSERT_TRUE(accessor.Allocate(block, &slot));
+    *reinterpret_cast<storage::UndoRecord **>(accessor.AccessForceNotNull(slot, storage::VERSION_POINTER_COLUMN_ID)) =
+        nullptr;
+    const auto n = static_cast<int64_t>(i);
+    *reinterpret_cast<int64_t *>(accessor.AccessForceNotNull(slot, col_ids[0])) = n / 100;
+    *reinterpret_cast<int64_t *>(accessor.AccessForceNotNull(slot, col_ids[1])) = (n * 7919) % 1000 - 500;
+    *reinterpret_cast<int64_t *>(accessor.AccessForceNotNull(slot, col_ids[2])) = 1000000 + 3 * n + n % 2;
+  }
+
+  transaction::TimestampManager timestamp_manager;
+  transaction::DeferredActionManager deferred_action_manager{common::ManagedPointer(&timestamp_manager)};
+  transaction::TransactionManager txn_manager{common::ManagedPointer(&timestamp_manager),
+                                              common::ManagedPointer(&deferred_action_manager),
+                                              common::ManagedPointer(&buffer_pool), true, DISABLED};
+  storage::GarbageCollector gc{common::ManagedPointer(&timestamp_manager),
+                               common::ManagedPointer(&deferred_action_manager), common::ManagedPointer(&txn_manager),
+                               DISABLED};
+  storage::BlockCompactor compactor;
+  compactor.PutInQueue(block);
+  compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager);  // compaction pass
+  gc.PerformGarbageCollection();
+  compactor.PutInQueue(block);
+  compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager);  // gathering pass
+  ASSERT_EQ(storage::BlockState::FROZEN, block->controller_.GetBlockState()->load());
+
+  // Read the whole block in place, a vector at a time
+  storage::ProjectedColumnsInitializer pc_init(layout, col_ids, common::Constants::K_DEFAULT_VECTOR_SIZE);
+  auto *pc_buffer = common::AllocationUtil::AllocateAligned(pc_init.ProjectedColumnsSize());
+  storage::ProjectedColumns *projected_columns = pc_init.Initialize(pc_buffer);
+  std::vector<uint16_t> col_idxs;
+  for (storage::col_id_t col_id : col_ids) {
+    const auto *col_idx = std::find(projected_columns->ColumnIds(),
+                                    projected_columns->ColumnIds() + projected_columns->NumColumns(), col_id);
+    col_idxs.push_back(static_cast<uint16_t>(col_idx - projected_columns->ColumnIds()));
+  }
+  const std::vector<storage::ArrowColumnType> encodings = {storage::ArrowColumnType::RUN_LENGTH_ENCODED,
+                                                           storage::ArrowColumnType::FRAME_OF_REFERENCE,
+                                                           storage::ArrowColumnType::DELTA_ENCODED};
+  storage::FrozenColumnsView view;
+  ProjectedColumnsIterator iter;
+  uint32_t count = 0;
+  for (auto it = table.begin(); it != table.end(); view.Release()) {
+    ASSERT_TRUE(table.TryViewFrozen(&it, *projected_columns, &view));
+    count += view.NumTuples();
+    for (uint32_t c = 0; c < col_idxs.size(); c++) {
+      const uint16_t col_idx = col_idxs[c];
+      ASSERT_NE(nullptr, view.EncodedColumn(col_idx));
+      EXPECT_EQ(encodings[c], view.EncodedColumn(col_idx)->Type());
+
+      // Probe below, at and above the smallest and largest value of the view, and in the middle
+      const auto *values = reinterpret_cast<const int64_t *>(view.ColumnStart(col_idx));
+      const auto [min, max] = std::minmax_element(values, values + view.NumTuples());
+      const int64_t probes[] = {*min - 1, *min, *min + 1, (*min + *max) / 2, *max - 1, *max, *max + 1};
+      for (const int64_t probe : probes) {
+        CheckFrozenIntFilter<std::equal_to>(&iter, view, col_idx, probe);
+        CheckFrozenIntFilter<std::not_equal_to>(&iter, view, col_idx, probe);
+        CheckFrozenIntFilter<std::less>(&iter, view, col_idx, probe);
+        CheckFrozenIntFilter<std::less_equal>(&iter, view, col_idx, probe);
+        CheckFrozenIntFilter<std::greater>(&iter, view, col_idx, probe);
+        CheckFrozenIntFilter<std::greater_equal>(&iter, view, col_idx, probe);
+      }
+    }
+
+    // Chain range filters on all encodings, so that later ones run on a selection vector
+    const auto *runs = reinterpret_cast<const int64_t *>(view.ColumnStart(col_idxs[0]));
+    const auto *offsets = reinterpret_cast<const int64_t *>(view.ColumnStart(col_idxs[1]));
+    const auto *deltas = reinterpret_cast<const int64_t *>(view.ColumnStart(col_idxs[2]));
+    const int64_t delta_lo = deltas[0] + 100, delta_hi = deltas[0] + 3000;
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < view.NumTuples(); i++) {
+      expected += static_cast<uint32_t>(offsets[i] >= -100 && offsets[i] <= 250 && deltas[i] >= delta_lo &&
+                                        deltas[i] <= delta_hi && runs[i] != runs[0] + 5);
+    }
+    iter.SetFrozenColumns(&view);
+    iter.FilterColBetween(col_idxs[1], type::TypeId::BIGINT, {.bi_ = -100}, {.bi_ = 250});
+    iter.FilterColBetween(col_idxs[2], type::TypeId::BIGINT, {.bi_ = delta_lo}, {.bi_ = delta_hi});
+    EXPECT_EQ(expected,
+              iter.FilterColByVal<std::not_equal_to>(col_idxs[0], type::TypeId::BIGINT, {.bi_ = runs[0] + 5}));
+  }
+  EXPECT_EQ(num_tuples, count);
+
+  delete[] pc_buffer;
+  gc.PerformGarbageCollection();
+  gc.PerformGarbageCollection();
+}
+
 }  // namespace terrier::execution::sql::test
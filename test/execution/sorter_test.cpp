@@ -157,6 +157,38 @@ TEST_F(SorterTest, TopKTest) {
   TestAllIntegral(TestTopKRandomTupleSize, num_iters, max_elems, &generator_);
 }
 
+// NOLINTNEXTLINE
+TEST_F(SorterTest, SkipRowsTest) {
+  const auto cmp_fn = [](const void *a, const void *b) -> int32_t {
+    const auto val_a = *reinterpret_cast<const uint32_t *>(a);
+    const auto val_b = *reinterpret_cast<const uint32_t *>(b);
+    return val_a < val_b ? -1 : (val_a == val_b ? 0 : 1);
+  };
+  const uint32_t num_elems = 100;
+  MemoryPool memory(nullptr);
+  sql::Sorter sorter(&memory, cmp_fn, sizeof(uint32_t));
+  for (uint32_t i = 0; i < num_elems; i++) {
+    *reinterpret_cast<uint32_t *>(sorter.AllocInputTuple()) = i;
+  }
+
+  // Rows are iterated in insertion order until sorted, starting from the skipped ones
+  for (uint64_t num_skipped : {0, 1, 50, 99}) {
+    sql::SorterIterator iter(&sorter);
+    iter.SkipRows(num_skipped);
+    for (auto i = static_cast<uint32_t>(num_skipped); i < num_elems; i++) {
+      ASSERT_TRUE(iter.HasNext());
+      EXPECT_EQ(i, *iter.GetRowAs<uint32_t>());
+      iter.Next();
+    }
+    EXPECT_FALSE(iter.HasNext());
+  }
+
+  // Skipping past the end stops at the end
+  sql::SorterIterator iter(&sorter);
+  iter.SkipRows(num_elems + 1);
+  EXPECT_FALSE(iter.HasNext());
+}
+
 template <uint32_t N>
 struct TestTuple {
   uint32_t key_;
@@ -1,5 +1,8 @@
 #include <sys/mman.h>
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
 #include <random>
 #include <utility>
 #include <vector>
@@ -480,6 +483,103 @@ TEST_F(VectorUtilTest, VectorVectorFilterTest) {
 #undef CHECK
 }
 
+// NOLINTNEXTLINE
+TEST_F(VectorUtilTest, NonIntegerFilterTest) {
+  //
+  // Test: filters on types without SIMD kernels must match the scalar versions.
+  //       Unsigned values above the signed range must compare as unsigned.
+  //
+
+  const uint32_t num_elems = common::Constants::K_DEFAULT_VECTOR_SIZE;
+  alignas(common::Constants::CACHELINE_SIZE) uint32_t out[common::Constants::K_DEFAULT_VECTOR_SIZE] = {0};
+
+  std::vector<double> reals(num_elems);
+  std::vector<uint32_t> dates(num_elems);
+  std::mt19937 gen;
+  std::uniform_real_distribution<double> real_dist(-100.0, 100.0);
+  for (uint32_t i = 0; i < num_elems; i++) {
+    reals[i] = real_dist(gen);
+    dates[i] = (i % 2 == 0) ? i : std::numeric_limits<uint32_t>::max() - i;
+  }
+
+  auto expected = static_cast<uint32_t>(std::count_if(reals.begin(), reals.end(), [](double v) { return v < 12.5; }));
+  EXPECT_EQ(expected, VectorUtil::FilterLt(reals.data(), num_elems, 12.5, out, nullptr));
+  for (uint32_t i = 0; i < expected; i++) {
+    EXPECT_LT(reals[out[i]], 12.5);
+  }
+
+  // Half the dates are above INT32_MAX
+  EXPECT_EQ(num_elems / 2, VectorUtil::FilterGt(dates.data(), num_elems, uint32_t(num_elems), out, nullptr));
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorUtilTest, BetweenAndInFilterTest) {
+  //
+  // Test: a1 contains sequential numbers in the range [0, 1000). BETWEEN and IN
+  //       must select the expected positions, with and without a selection
+  //       vector.
+  //
+
+  const uint32_t num_elems = 1000;
+  std::vector<int32_t> arr(num_elems);
+  std::iota(arr.begin(), arr.end(), 0);
+
+  alignas(common::Constants::CACHELINE_SIZE) uint32_t out[common::Constants::K_DEFAULT_VECTOR_SIZE] = {0};
+  alignas(common::Constants::CACHELINE_SIZE) uint32_t sel[common::Constants::K_DEFAULT_VECTOR_SIZE] = {0};
+
+  // BETWEEN 100 AND 199
+  auto found = VectorUtil::FilterVectorBetween(arr.data(), num_elems, 100, 199, out, nullptr);
+  EXPECT_EQ(100u, found);
+  for (uint32_t i = 0; i < found; i++) {
+    EXPECT_EQ(100 + i, out[i]);
+  }
+
+  // Even positions only, then BETWEEN 100 AND 199
+  auto sel_size = VectorUtil::FilterVectorByPredicate(num_elems, [&](uint32_t i) { return arr[i] % 2 == 0; }, sel,
+                                                      nullptr);
+  EXPECT_EQ(num_elems / 2, sel_size);
+  found = VectorUtil::FilterVectorBetween(arr.data(), sel_size, 100, 199, out, sel);
+  EXPECT_EQ(50u, found);
+
+  // IN (5, 10, 999, 5000), with the output aliasing the selection vector
+  const int32_t vals[] = {5, 10, 999, 5000};
+  found = VectorUtil::FilterVectorIn(arr.data(), num_elems, vals, 4, out, nullptr);
+  EXPECT_EQ(3u, found);
+  EXPECT_EQ(5u, out[0]);
+  EXPECT_EQ(10u, out[1]);
+  EXPECT_EQ(999u, out[2]);
+  found = VectorUtil::FilterVectorIn(arr.data(), sel_size, vals, 4, sel, sel);
+  EXPECT_EQ(1u, found);
+  EXPECT_EQ(10u, sel[0]);
+}
+
+// NOLINTNEXTLINE
+TEST_F(VectorUtilTest, ArithmeticByValTest) {
+  //
+  // Test: results are written at the position of their input and widened to the
+  //       result type.
+  //
+
+  const uint32_t num_elems = 100;
+  std::vector<int16_t> arr(num_elems);
+  std::iota(arr.begin(), arr.end(), 0);
+  std::vector<int64_t> res(num_elems, -1);
+
+  VectorUtil::ArithmeticVectorByVal<int16_t, int64_t, std::multiplies>(arr.data(), num_elems, 100000, res.data(),
+                                                                      nullptr);
+  for (uint32_t i = 0; i < num_elems; i++) {
+    EXPECT_EQ(static_cast<int64_t>(i) * 100000, res[i]);
+  }
+
+  std::fill(res.begin(), res.end(), -1);
+  const uint32_t sel[] = {3, 50, 99};
+  VectorUtil::ArithmeticVectorByVal<int16_t, int64_t, std::plus>(arr.data(), 3, 1, res.data(), sel);
+  EXPECT_EQ(4, res[3]);
+  EXPECT_EQ(51, res[50]);
+  EXPECT_EQ(100, res[99]);
+  EXPECT_EQ(-1, res[0]);
+}
+
 // NOLINTNEXTLINE
 TEST_F(VectorUtilTest, GatherTest) {
   auto array = AllocateArray<uint32_t>(800000);
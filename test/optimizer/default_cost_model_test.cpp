@@ -58,7 +58,6 @@ class DefaultCostModelTests : public TerrierTest {
     table_stats_obj_2_ = TableStats(
         catalog::db_oid_t(1), catalog::table_oid_t(2), 10, true,
         {column_stats_obj_6_, column_stats_obj_7_, column_stats_obj_8_, column_stats_obj_9_, column_stats_obj_10_});
-    stats_storage_ = StatsStorage();
     stats_storage_.InsertTableStats(catalog::db_oid_t(1), catalog::table_oid_t(1), std::move(table_stats_obj_1_));
     stats_storage_.InsertTableStats(catalog::db_oid_t(1), catalog::table_oid_t(2), std::move(table_stats_obj_2_));
     default_cost_model_ = DefaultCostModel();
@@ -272,12 +271,26 @@ TEST_F(DefaultCostModelTests, LeftHashJoinTest) {
   parser::AbstractExpression *expr_b_1 =
       new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
   auto x_1 = common::ManagedPointer<parser::AbstractExpression>(expr_b_1);
-  Operator left_hash_join = LeftHashJoin::Make(x_1);
-  OperatorNode operator_expression = OperatorNode(left_hash_join, {});
+  Operator left_hash_join = LeftHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator seq_scan_1 = SeqScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(1), catalog::table_oid_t(1),
+                                      std::vector<AnnotatedExpression>(), "table", false);
+  Operator seq_scan_2 = SeqScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(1), catalog::table_oid_t(2),
+                                      std::vector<AnnotatedExpression>(), "table", false);
+  std::vector<std::unique_ptr<OperatorNode>> children = {};
+  children.push_back(std::make_unique<OperatorNode>(OperatorNode(seq_scan_1, {})));
+  children.push_back(std::make_unique<OperatorNode>(OperatorNode(seq_scan_2, {})));
+  OperatorNode operator_expression = OperatorNode(left_hash_join, std::move(children));
   GroupExpression *grexp =
       optimizer_context.MakeGroupExpression(common::ManagedPointer<OperatorNode>(&operator_expression));
+  // Costs the same as an inner hash join: one pass over each input
+  optimizer_context.GetMemo()
+      .GetGroupByID(grexp->GetChildGroupId(0))
+      ->SetNumRows((stats_storage_.GetTableStats(catalog::db_oid_t(1), catalog::table_oid_t(1)))->GetNumRows());
+  optimizer_context.GetMemo()
+      .GetGroupByID(grexp->GetChildGroupId(1))
+      ->SetNumRows((stats_storage_.GetTableStats(catalog::db_oid_t(1), catalog::table_oid_t(2)))->GetNumRows());
   auto cost = default_cost_model_.CalculateCost(optimizer_context.GetTxn(), &optimizer_context.GetMemo(), grexp);
-  ASSERT_FLOAT_EQ(cost, 0.f);
+  ASSERT_FLOAT_EQ(cost, 0.15);
   delete grexp;
   delete expr_b_1;
 }
@@ -290,12 +303,26 @@ TEST_F(DefaultCostModelTests, RightHashJoinTest) {
   parser::AbstractExpression *expr_b_1 =
       new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
   auto x_1 = common::ManagedPointer<parser::AbstractExpression>(expr_b_1);
-  Operator right_hash_join = RightHashJoin::Make(x_1);
-  OperatorNode operator_expression = OperatorNode(right_hash_join, {});
+  Operator right_hash_join = RightHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator seq_scan_1 = SeqScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(1), catalog::table_oid_t(1),
+                                      std::vector<AnnotatedExpression>(), "table", false);
+  Operator seq_scan_2 = SeqScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(1), catalog::table_oid_t(2),
+                                      std::vector<AnnotatedExpression>(), "table", false);
+  std::vector<std::unique_ptr<OperatorNode>> children = {};
+  children.push_back(std::make_unique<OperatorNode>(OperatorNode(seq_scan_1, {})));
+  children.push_back(std::make_unique<OperatorNode>(OperatorNode(seq_scan_2, {})));
+  OperatorNode operator_expression = OperatorNode(right_hash_join, std::move(children));
   GroupExpression *grexp =
       optimizer_context.MakeGroupExpression(common::ManagedPointer<OperatorNode>(&operator_expression));
+  // Costs the same as an inner hash join: one pass over each input
+  optimizer_context.GetMemo()
+      .GetGroupByID(grexp->GetChildGroupId(0))
+      ->SetNumRows((stats_storage_.GetTableStats(catalog::db_oid_t(1), catalog::table_oid_t(1)))->GetNumRows());
+  optimizer_context.GetMemo()
+      .GetGroupByID(grexp->GetChildGroupId(1))
+      ->SetNumRows((stats_storage_.GetTableStats(catalog::db_oid_t(1), catalog::table_oid_t(2)))->GetNumRows());
   auto cost = default_cost_model_.CalculateCost(optimizer_context.GetTxn(), &optimizer_context.GetMemo(), grexp);
-  ASSERT_FLOAT_EQ(cost, 0.f);
+  ASSERT_FLOAT_EQ(cost, 0.15);
   delete grexp;
   delete expr_b_1;
 }
@@ -308,12 +335,58 @@ TEST_F(DefaultCostModelTests, OuterHashJoinTest) {
   parser::AbstractExpression *expr_b_1 =
       new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
   auto x_1 = common::ManagedPointer<parser::AbstractExpression>(expr_b_1);
-  Operator outer_hash_join = OuterHashJoin::Make(x_1);
-  OperatorNode operator_expression = OperatorNode(outer_hash_join, {});
+  Operator outer_hash_join = OuterHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator seq_scan_1 = SeqScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(1), catalog::table_oid_t(1),
+                                      std::vector<AnnotatedExpression>(), "table", false);
+  Operator seq_scan_2 = SeqScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(1), catalog::table_oid_t(2),
+                                      std::vector<AnnotatedExpression>(), "table", false);
+  std::vector<std::unique_ptr<OperatorNode>> children = {};
+  children.push_back(std::make_unique<OperatorNode>(OperatorNode(seq_scan_1, {})));
+  children.push_back(std::make_unique<OperatorNode>(OperatorNode(seq_scan_2, {})));
+  OperatorNode operator_expression = OperatorNode(outer_hash_join, std::move(children));
   GroupExpression *grexp =
       optimizer_context.MakeGroupExpression(common::ManagedPointer<OperatorNode>(&operator_expression));
+  // Costs the same as an inner hash join: one pass over each input
+  optimizer_context.GetMemo()
+      .GetGroupByID(grexp->GetChildGroupId(0))
+      ->SetNumRows((stats_storage_.GetTableStats(catalog::db_oid_t(1), catalog::table_oid_t(1)))->GetNumRows());
+  optimizer_context.GetMemo()
+      .GetGroupByID(grexp->GetChildGroupId(1))
+      ->SetNumRows((stats_storage_.GetTableStats(catalog::db_oid_t(1), catalog::table_oid_t(2)))->GetNumRows());
   auto cost = default_cost_model_.CalculateCost(optimizer_context.GetTxn(), &optimizer_context.GetMemo(), grexp);
-  ASSERT_FLOAT_EQ(cost, 0.f);
+  ASSERT_FLOAT_EQ(cost, 0.15);
+  delete grexp;
+  delete expr_b_1;
+}
+
+// NOLINTNEXTLINE
+TEST_F(DefaultCostModelTests, InnerMergeJoinTest) {
+  OptimizerContext optimizer_context =
+      OptimizerContext(common::ManagedPointer<AbstractCostModel>(&default_cost_model_));
+  optimizer_context.SetStatsStorage(&stats_storage_);
+  parser::AbstractExpression *expr_b_1 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  auto x_1 = common::ManagedPointer<parser::AbstractExpression>(expr_b_1);
+  Operator inner_merge_join = InnerMergeJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator seq_scan_1 = SeqScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(1), catalog::table_oid_t(1),
+                                      std::vector<AnnotatedExpression>(), "table", false);
+  Operator seq_scan_2 = SeqScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(1), catalog::table_oid_t(2),
+                                      std::vector<AnnotatedExpression>(), "table", false);
+  std::vector<std::unique_ptr<OperatorNode>> children = {};
+  children.push_back(std::make_unique<OperatorNode>(OperatorNode(seq_scan_1, {})));
+  children.push_back(std::make_unique<OperatorNode>(OperatorNode(seq_scan_2, {})));
+  OperatorNode operator_expression = OperatorNode(inner_merge_join, std::move(children));
+  GroupExpression *grexp =
+      optimizer_context.MakeGroupExpression(common::ManagedPointer<OperatorNode>(&operator_expression));
+  // Half the cost of a hash join over the same inputs: rows are compared, not hashed
+  optimizer_context.GetMemo()
+      .GetGroupByID(grexp->GetChildGroupId(0))
+      ->SetNumRows((stats_storage_.GetTableStats(catalog::db_oid_t(1), catalog::table_oid_t(1)))->GetNumRows());
+  optimizer_context.GetMemo()
+      .GetGroupByID(grexp->GetChildGroupId(1))
+      ->SetNumRows((stats_storage_.GetTableStats(catalog::db_oid_t(1), catalog::table_oid_t(2)))->GetNumRows());
+  auto cost = default_cost_model_.CalculateCost(optimizer_context.GetTxn(), &optimizer_context.GetMemo(), grexp);
+  ASSERT_FLOAT_EQ(cost, 0.075);
   delete grexp;
   delete expr_b_1;
 }
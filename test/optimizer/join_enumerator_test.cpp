@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "optimizer/cost_model/default_cost_model.h"
+#include "optimizer/join_enumerator.h"
+
+#include "test_util/test_harness.h"
+
+namespace terrier::optimizer {
+
+struct JoinEnumeratorTest : public TerrierTest {
+  // Checks that the plan with the given index is a valid join tree, and counts how many times it applies each predicate
+  static void CheckTree(const JoinEnumerator &enumerator, uint32_t idx, std::vector<uint32_t> *applied,
+                        bool allow_cross_products) {
+    const auto &plan = enumerator.GetPlan(idx);
+    if (plan.left_ == JoinEnumerator::NO_PLAN) {
+      EXPECT_EQ(JoinEnumerator::NO_PLAN, plan.right_);
+      EXPECT_EQ(uint64_t{1} << idx, plan.relations_);
+      return;
+    }
+    const auto &left = enumerator.GetPlan(plan.left_);
+    const auto &right = enumerator.GetPlan(plan.right_);
+    EXPECT_EQ(uint64_t{0}, left.relations_ & right.relations_);
+    EXPECT_EQ(plan.relations_, left.relations_ | right.relations_);
+    if (!allow_cross_products) {
+      EXPECT_FALSE(plan.predicates_.empty());
+    }
+    for (const uint32_t predicate : plan.predicates_) (*applied)[predicate]++;
+    CheckTree(enumerator, plan.left_, applied, allow_cross_products);
+    CheckTree(enumerator, plan.right_, applied, allow_cross_products);
+  }
+
+  // Cost of the cheapest join tree without cross products over a connected graph of non-equi-join predicates between
+  // two relations, found by costing every way to split every set of relations. Equi-joins are left out, as their
+  // estimates depend on the shape of the tree, so that plans that cost the same may lead to different costs later on.
+  static double CheapestCost(const std::vector<double> &num_rows, const std::vector<uint64_t> &predicates) {
+    const auto num_relations = static_cast<uint32_t>(num_rows.size());
+    std::unordered_map<uint64_t, std::pair<double, double>> best;  // cost and number of rows
+    for (uint32_t i = 0; i < num_relations; i++) best[uint64_t{1} << i] = {0, num_rows[i]};
+    for (uint64_t set = 1; set < (uint64_t{1} << num_relations); set++) {
+      for (uint64_t left = (set - 1) & set; left != 0; left = (left - 1) & set) {
+        const uint64_t right = set & ~left;
+        if (best.count(left) == 0 || best.count(right) == 0) continue;
+        const auto &left_best = best[left];
+        const auto &right_best = best[right];
+        const bool connected = std::any_of(predicates.begin(), predicates.end(), [&](const uint64_t predicate) {
+          return (predicate & left) != 0 && (predicate & right) != 0;
+        });
+        if (!connected) continue;
+        const double cost =
+            left_best.first + right_best.first + DefaultCostModel::HashJoinCost(left_best.second, right_best.second);
+        if (best.count(set) == 0 || cost < best[set].first) best[set] = {cost, left_best.second * right_best.second};
+      }
+    }
+    return best.at((uint64_t{1} << num_relations) - 1).first;
+  }
+};
+
+// Exhaustive enumeration finds the cheapest plan without cross products for random connected join graphs
+// NOLINTNEXTLINE
+TEST_F(JoinEnumeratorTest, CheapestPlanTest) {
+  std::default_random_engine generator;
+  std::uniform_int_distribution<uint32_t> num_relations_dist(2, 8);
+  std::uniform_int_distribution<uint32_t> rows_dist(1, 1000);
+  for (uint32_t round = 0; round < 50; round++) {
+    const uint32_t num_relations = num_relations_dist(generator);
+    JoinEnumerator enumerator;
+    std::vector<double> num_rows;
+    for (uint32_t i = 0; i < num_relations; i++) {
+      num_rows.push_back(rows_dist(generator));
+      EXPECT_EQ(i, enumerator.AddRelation(num_rows.back()));
+    }
+    // A random spanning tree keeps the graph connected, and some more edges add cycles
+    std::vector<uint64_t> predicates;
+    for (uint32_t i = 1; i < num_relations; i++) {
+      const uint32_t other = std::uniform_int_distribution<uint32_t>(0, i - 1)(generator);
+      predicates.push_back((uint64_t{1} << i) | (uint64_t{1} << other));
+    }
+    for (uint32_t i = 0; i < num_relations / 2; i++) {
+      std::uniform_int_distribution<uint32_t> relation_dist(0, num_relations - 1);
+      const uint32_t first = relation_dist(generator);
+      const uint32_t second = relation_dist(generator);
+      if (first != second) predicates.push_back((uint64_t{1} << first) | (uint64_t{1} << second));
+    }
+    for (const uint64_t predicate : predicates) enumerator.AddPredicate(predicate, false);
+
+    const uint32_t root = enumerator.Enumerate();
+    EXPECT_TRUE(enumerator.IsExhaustive());
+    EXPECT_EQ((uint64_t{1} << num_relations) - 1, enumerator.GetPlan(root).relations_);
+    std::vector<uint32_t> applied(predicates.size(), 0);
+    CheckTree(enumerator, root, &applied, false);
+    for (const uint32_t count : applied) EXPECT_EQ(1U, count);
+
+    const double cheapest = CheapestCost(num_rows, predicates);
+    EXPECT_LE(std::abs(enumerator.GetPlan(root).cost_ - cheapest), 1e-9 * cheapest);
+  }
+}
+
+// Connected components are planned separately and then joined by cross products, and predicates over several or no
+// relations are applied once all of their relations are joined
+// NOLINTNEXTLINE
+TEST_F(JoinEnumeratorTest, DisconnectedGraphTest) {
+  JoinEnumerator enumerator;
+  for (uint32_t i = 0; i < 5; i++) enumerator.AddRelation(100 * (i + 1));
+  enumerator.AddPredicate(0b00011, true);
+  enumerator.AddPredicate(0b01100, true);
+  enumerator.AddPredicate(0b00111, false);
+  enumerator.AddPredicate(0, false);
+
+  const uint32_t root = enumerator.Enumerate();
+  const auto &plan = enumerator.GetPlan(root);
+  EXPECT_EQ(uint64_t{0b11111}, plan.relations_);
+  EXPECT_EQ(std::vector<uint32_t>({3}), plan.predicates_);
+  std::vector<uint32_t> applied(4, 0);
+  CheckTree(enumerator, root, &applied, true);
+  EXPECT_EQ(std::vector<uint32_t>({1, 1, 1, 1}), applied);
+
+  // An equi-join divides the size of the cross product by the size of its larger input, and the predicate over three
+  // relations is applied by the first join that holds all of them
+  for (uint32_t idx = 0; idx < 9; idx++) {
+    const auto &join = enumerator.GetPlan(idx);
+    if (join.relations_ == 0b00011) {
+      EXPECT_DOUBLE_EQ(100.0 * 200 / 200, join.num_rows_);
+    }
+    if (std::find(join.predicates_.begin(), join.predicates_.end(), 2) == join.predicates_.end()) continue;
+    EXPECT_EQ(uint64_t{0b00111}, join.relations_ & 0b00111);
+    EXPECT_NE(uint64_t{0b00111}, enumerator.GetPlan(join.left_).relations_ & 0b00111);
+    EXPECT_NE(uint64_t{0b00111}, enumerator.GetPlan(join.right_).relations_ & 0b00111);
+  }
+}
+
+// Above the threshold, relations are joined greedily, still without cross products where the graph allows it
+// NOLINTNEXTLINE
+TEST_F(JoinEnumeratorTest, GreedyTest) {
+  const uint32_t num_relations = 20;
+  JoinEnumerator enumerator(10);
+  for (uint32_t i = 0; i < num_relations; i++) enumerator.AddRelation(1000 + 10 * i);
+  // A chain, which greedy joining can follow without any cross product
+  for (uint32_t i = 1; i < num_relations; i++) enumerator.AddPredicate((uint64_t{3} << (i - 1)), true);
+
+  const uint32_t root = enumerator.Enumerate();
+  EXPECT_FALSE(enumerator.IsExhaustive());
+  EXPECT_EQ((uint64_t{1} << num_relations) - 1, enumerator.GetPlan(root).relations_);
+  std::vector<uint32_t> applied(num_relations - 1, 0);
+  CheckTree(enumerator, root, &applied, false);
+  for (const uint32_t count : applied) EXPECT_EQ(1U, count);
+}
+
+}  // namespace terrier::optimizer
@@ -1,5 +1,9 @@
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <stack>
+#include <string>
+#include <thread>  // NOLINT
 #include <utility>
 #include <vector>
 
@@ -20,6 +24,100 @@ struct OptimizerContextTest : public TerrierTest {
   void TearDown() override { TerrierTest::TearDown(); }
 };
 
+// Task that records that it ran, and then pushes a dependent task followed by the given number of independent ones,
+// like OptimizeExpressionCostWithEnforcedProperty pushes itself followed by the OptimizeGroup tasks it waits for
+class PushingTask : public OptimizerTask {
+ public:
+  PushingTask(ConcurrentOptimizerTaskPool *pool, std::string name, uint32_t depth, uint32_t fan_out,
+              std::vector<std::string> *order)
+      : OptimizerTask(nullptr, OptimizerTaskType::OPTIMIZE_GROUP),
+        pool_(pool),
+        name_(std::move(name)),
+        depth_(depth),
+        fan_out_(fan_out),
+        order_(order) {}
+
+  void Execute() override {
+    if (order_ != nullptr) order_->push_back(name_);
+    num_executed_++;
+    if (depth_ == 0) return;
+    // The continuation checks that everything pushed after it has finished before it runs
+    auto num_children_executed = std::make_shared<std::atomic<uint32_t>>(0);
+    pool_->PushDependent(new CheckingTask(num_children_executed, fan_out_, name_ + "c", order_));
+    for (uint32_t i = 0; i < fan_out_; i++) {
+      pool_->Push(
+          new PushingTask(pool_, name_ + std::to_string(i), depth_ - 1, fan_out_, order_, num_children_executed));
+    }
+  }
+
+  ~PushingTask() override {
+    if (parent_num_executed_ != nullptr) (*parent_num_executed_)++;
+  }
+
+  static std::atomic<uint32_t> num_executed_;
+
+ private:
+  class CheckingTask : public OptimizerTask {
+   public:
+    CheckingTask(std::shared_ptr<std::atomic<uint32_t>> num_children_executed, uint32_t num_children,
+                 std::string name, std::vector<std::string> *order)
+        : OptimizerTask(nullptr, OptimizerTaskType::OPTIMIZE_GROUP),
+          num_children_executed_(std::move(num_children_executed)),
+          num_children_(num_children),
+          name_(std::move(name)),
+          order_(order) {}
+
+    void Execute() override {
+      EXPECT_EQ(num_children_, num_children_executed_->load());
+      if (order_ != nullptr) order_->push_back(name_);
+    }
+
+   private:
+    std::shared_ptr<std::atomic<uint32_t>> num_children_executed_;
+    uint32_t num_children_;
+    std::string name_;
+    std::vector<std::string> *order_;
+  };
+
+  PushingTask(ConcurrentOptimizerTaskPool *pool, std::string name, uint32_t depth, uint32_t fan_out,
+              std::vector<std::string> *order, std::shared_ptr<std::atomic<uint32_t>> parent_num_executed)
+      : PushingTask(pool, std::move(name), depth, fan_out, order) {
+    parent_num_executed_ = std::move(parent_num_executed);
+  }
+
+  ConcurrentOptimizerTaskPool *pool_;
+  std::string name_;
+  uint32_t depth_;
+  uint32_t fan_out_;
+  std::vector<std::string> *order_;
+  // Counts this task as finished once the pool deletes it, which happens right after it has run
+  std::shared_ptr<std::atomic<uint32_t>> parent_num_executed_;
+};
+
+std::atomic<uint32_t> PushingTask::num_executed_{0};
+
+// Task that runs the given function
+class FunctionTask : public OptimizerTask {
+ public:
+  explicit FunctionTask(std::function<void()> function)
+      : OptimizerTask(nullptr, OptimizerTaskType::OPTIMIZE_GROUP), function_(std::move(function)) {}
+
+  void Execute() override { function_(); }
+
+ private:
+  std::function<void()> function_;
+};
+
+// Runs the tasks of the pool on the calling thread until none is runnable
+static void RunRunnableTasks(ConcurrentOptimizerTaskPool *task_pool) {
+  while (!task_pool->Empty()) {
+    auto *task = task_pool->Pop();
+    if (task == nullptr) return;
+    task->Execute();
+    task_pool->Finish(task);
+  }
+}
+
 // NOLINTNEXTLINE
 TEST_F(OptimizerContextTest, PatternTest) {
   // Creates a Pattern and makes sure everything is set correctly
@@ -109,6 +207,123 @@ TEST_F(OptimizerContextTest, OptimizerContextTaskStackNullptrTest) {
   context.SetTaskPool(nullptr);
 }
 
+// On a single thread, the concurrent pool runs tasks in the same order as the stack
+// NOLINTNEXTLINE
+TEST_F(OptimizerContextTest, ConcurrentTaskPoolOrderTest) {
+  ConcurrentOptimizerTaskPool task_pool(1);
+  std::vector<std::string> order;
+  task_pool.Push(new PushingTask(&task_pool, "r", 2, 2, &order));
+  EXPECT_FALSE(task_pool.Empty());
+  while (!task_pool.Empty()) {
+    auto *task = task_pool.Pop();
+    ASSERT_NE(task, nullptr);
+    task->Execute();
+    task_pool.Finish(task);
+  }
+  EXPECT_EQ(order, (std::vector<std::string>{"r", "r1", "r11", "r10", "r1c", "r0", "r01", "r00", "r0c", "rc"}));
+}
+
+// Several threads run all tasks, and never a dependent one before the tasks it waits for
+// NOLINTNEXTLINE
+TEST_F(OptimizerContextTest, ConcurrentTaskPoolTest) {
+  const uint32_t num_threads = 4;
+  const uint32_t depth = 6;
+  const uint32_t fan_out = 4;
+  ConcurrentOptimizerTaskPool task_pool(num_threads);
+  PushingTask::num_executed_ = 0;
+  task_pool.Push(new PushingTask(&task_pool, "r", depth, fan_out, nullptr));
+
+  auto worker = [&] {
+    while (!task_pool.Empty()) {
+      auto *task = task_pool.Pop();
+      if (task == nullptr) {
+        std::this_thread::yield();
+        continue;
+      }
+      task->Execute();
+      task_pool.Finish(task);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < num_threads; i++) threads.emplace_back(worker);
+  for (auto &thread : threads) thread.join();
+
+  uint32_t expected = 0;
+  for (uint32_t i = 0, level = 1; i <= depth; i++, level *= fan_out) expected += level;
+  EXPECT_EQ(expected, PushingTask::num_executed_.load());
+}
+
+// Tasks that never ran are deleted together with the pool
+// NOLINTNEXTLINE
+TEST_F(OptimizerContextTest, ConcurrentTaskPoolRemainTest) {
+  ConcurrentOptimizerTaskPool task_pool(2);
+  task_pool.Push(new PushingTask(&task_pool, "r", 3, 3, nullptr));
+  EXPECT_FALSE(task_pool.Empty());
+  auto *task = task_pool.Pop();
+  task->Execute();
+  task_pool.Finish(task);
+  task = task_pool.Pop();
+  task->Execute();
+  task_pool.Finish(task);
+
+  // Shouldn't leak memory!
+  EXPECT_FALSE(task_pool.Empty());
+}
+
+// A suspended task only runs once resumed, and the tasks pushed before it wait for it like for any other
+// NOLINTNEXTLINE
+TEST_F(OptimizerContextTest, ConcurrentTaskPoolSuspendTest) {
+  ConcurrentOptimizerTaskPool task_pool(1);
+  std::vector<std::string> order;
+  OptimizerTask *suspended = nullptr;
+  task_pool.Push(new FunctionTask([&] {
+    order.emplace_back("r");
+    task_pool.PushDependent(new FunctionTask([&] { order.emplace_back("rc"); }));
+    suspended = new FunctionTask([&] { order.emplace_back("s"); });
+    task_pool.PushSuspended(suspended);
+    task_pool.Push(new FunctionTask([&] { order.emplace_back("r0"); }));
+  }));
+  RunRunnableTasks(&task_pool);
+  EXPECT_EQ(order, (std::vector<std::string>{"r", "r0"}));
+  EXPECT_FALSE(task_pool.Empty());
+
+  task_pool.Resume(suspended);
+  RunRunnableTasks(&task_pool);
+  EXPECT_EQ(order, (std::vector<std::string>{"r", "r0", "s", "rc"}));
+  EXPECT_TRUE(task_pool.Empty());
+}
+
+// A task resumed before the task that pushed it has finished runs right away
+// NOLINTNEXTLINE
+TEST_F(OptimizerContextTest, ConcurrentTaskPoolResumeEarlyTest) {
+  ConcurrentOptimizerTaskPool task_pool(1);
+  std::vector<std::string> order;
+  task_pool.Push(new FunctionTask([&] {
+    order.emplace_back("r");
+    task_pool.PushDependent(new FunctionTask([&] { order.emplace_back("rc"); }));
+    auto *suspended = new FunctionTask([&] { order.emplace_back("s"); });
+    task_pool.PushSuspended(suspended);
+    task_pool.Resume(suspended);
+  }));
+  RunRunnableTasks(&task_pool);
+  EXPECT_EQ(order, (std::vector<std::string>{"r", "s", "rc"}));
+  EXPECT_TRUE(task_pool.Empty());
+}
+
+// Suspended tasks that were never resumed are deleted together with the pool, as are the tasks waiting for them
+// NOLINTNEXTLINE
+TEST_F(OptimizerContextTest, ConcurrentTaskPoolSuspendRemainTest) {
+  ConcurrentOptimizerTaskPool task_pool(2);
+  task_pool.Push(new FunctionTask([&] {
+    task_pool.PushDependent(new FunctionTask([] {}));
+    task_pool.PushSuspended(new FunctionTask([] {}));
+  }));
+  RunRunnableTasks(&task_pool);
+
+  // Shouldn't leak memory!
+  EXPECT_FALSE(task_pool.Empty());
+}
+
 // NOLINTNEXTLINE
 TEST_F(OptimizerContextTest, RecordOperatorNodeIntoGroupDuplicateSingleLayer) {
   auto context = OptimizerContext(nullptr);
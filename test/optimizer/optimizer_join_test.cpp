@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "binder/bind_node_visitor.h"
+#include "optimizer/cost_model/default_cost_model.h"
+#include "optimizer/optimizer.h"
+#include "optimizer/property_set.h"
+#include "optimizer/query_to_operator_transformer.h"
+#include "optimizer/statistics/stats_storage.h"
+#include "parser/postgresparser.h"
+#include "planner/plannodes/abstract_plan_node.h"
+#include "test_util/test_harness.h"
+#include "test_util/tpcc/tpcc_plan_test.h"
+
+namespace terrier::optimizer {
+
+class OptimizerJoinTest : public TpccPlanTest {
+ protected:
+  // Adds stats for the table, with the given number of rows and as many distinct values in every column
+  void AddTableStats(catalog::table_oid_t tbl_oid, size_t num_rows) {
+    std::vector<ColumnStats> column_stats;
+    for (const auto &column : accessor_->GetSchema(tbl_oid).GetColumns()) {
+      column_stats.emplace_back(db_, tbl_oid, column.Oid(), num_rows, num_rows, 0.0, std::vector<double>{},
+                                std::vector<double>{}, std::vector<double>{}, true);
+    }
+    stats_storage_->InsertTableStats(db_, tbl_oid, TableStats(db_, tbl_oid, num_rows, true, column_stats));
+  }
+
+  // Checks that every group of the best plan has an estimated size and a non-negative cost, and collects its joins
+  void CheckBestPlan(Memo *memo, group_id_t group_id, PropertySet *props, std::vector<GroupExpression *> *joins) {
+    Group *group = memo->GetGroupByID(group_id);
+    GroupExpression *gexpr = group->GetBestExpression(props);
+    ASSERT_NE(gexpr, nullptr);
+    EXPECT_GE(group->GetNumRows(), 0);
+    EXPECT_GE(gexpr->GetCost(props), 0.0);
+    if (gexpr->GetChildrenGroupsSize() == 2) joins->push_back(gexpr);
+    auto input_props = gexpr->GetInputProperties(props);
+    for (size_t idx = 0; idx < gexpr->GetChildrenGroupsSize(); idx++) {
+      CheckBestPlan(memo, gexpr->GetChildGroupId(static_cast<int>(idx)), input_props[idx], joins);
+    }
+  }
+
+  /**
+   * Optimizes a SELECT with the DefaultCostModel, checks its best plan before the memo is reset, and returns it
+   * @param query SELECT to optimize
+   * @param num_threads number of threads to search the plan space with
+   * @param cost set to the cost of the best plan
+   * @param join_input_sizes set to the number of tables in each input of every join of the best plan, from the top down
+   * @returns the best plan
+   */
+  std::unique_ptr<planner::AbstractPlanNode> OptimizeJoin(const std::string &query, uint32_t num_threads,
+                                                          double *cost,
+                                                          std::vector<std::vector<size_t>> *join_input_sizes) {
+    auto stmt_list = parser::PostgresParser::BuildParseTree(query);
+
+    // Bind + Transform
+    auto accessor = catalog_->GetAccessor(common::ManagedPointer(txn_), db_);
+    binder::BindNodeVisitor binder{common::ManagedPointer(accessor), db_};
+    binder.BindNameToNode(common::ManagedPointer(stmt_list.get()));
+    QueryToOperatorTransformer transformer{common::ManagedPointer(accessor), db_};
+    auto op_tree =
+        transformer.ConvertToOpExpression(stmt_list->GetStatement(0), common::ManagedPointer(stmt_list.get()));
+
+    auto cost_model = std::make_unique<DefaultCostModel>();
+    cost_model->SetStatsStorage(stats_storage_.Get());
+    Optimizer optimizer(std::move(cost_model), task_execution_timeout_, num_threads);
+    OptimizerContext *context = optimizer.context_.get();
+    context->SetTxn(txn_);
+    context->SetCatalogAccessor(accessor_);
+    context->SetStatsStorage(stats_storage_.Get());
+    GroupExpression *gexpr = nullptr;
+    context->RecordOperatorNodeIntoGroup(common::ManagedPointer(op_tree), &gexpr);
+    const group_id_t root_id = gexpr->GetGroupID();
+    PropertySet props;
+    optimizer.OptimizeLoop(root_id, &props);
+
+    Memo *memo = &context->GetMemo();
+    std::vector<GroupExpression *> joins;
+    CheckBestPlan(memo, root_id, &props, &joins);
+    *cost = memo->GetGroupByID(root_id)->GetBestExpression(&props)->GetCost(&props);
+    for (GroupExpression *join : joins) {
+      EXPECT_NE(join->Op().GetType(), OpType::INNERNLJOIN);
+      join_input_sizes->push_back({memo->GetGroupByID(join->GetChildGroupId(0))->GetTableAliases().size(),
+                                   memo->GetGroupByID(join->GetChildGroupId(1))->GetTableAliases().size()});
+    }
+
+    auto sel_stmt = stmt_list->GetStatement(0).CastManagedPointerTo<parser::SelectStatement>();
+    return optimizer.ChooseBestPlan(txn_, accessor_, root_id, &props, sel_stmt->GetSelectColumns());
+  }
+
+  // Counts the nodes of the given type in the plan
+  static uint32_t CountNodes(const planner::AbstractPlanNode *plan, planner::PlanNodeType type) {
+    uint32_t count = plan->GetPlanNodeType() == type ? 1 : 0;
+    for (const auto child : plan->GetChildren()) count += CountNodes(child.Get(), type);
+    return count;
+  }
+};
+
+// The join enumerator avoids the cross product the FROM clause starts with, and the groups of the joins it adds are
+// sized, so that the costs of the joins above them are valid
+// NOLINTNEXTLINE
+TEST_F(OptimizerJoinTest, JoinOrderTest) {
+  BeginTransaction();
+  AddTableStats(tbl_customer_, 30000);
+  AddTableStats(tbl_warehouse_, 1000);
+  AddTableStats(tbl_district_, 10);
+  AddTableStats(tbl_order_, 300000);
+
+  std::string query =
+      "SELECT C.C_ID FROM CUSTOMER AS C, WAREHOUSE AS W, \"ORDER\" AS O, DISTRICT AS D "
+      "WHERE C.C_D_ID = D.D_ID AND D.D_W_ID = W.W_ID AND O.O_C_ID = C.C_ID";
+  double cost;
+  std::vector<std::vector<size_t>> join_input_sizes;
+  auto plan = OptimizeJoin(query, 1, &cost, &join_input_sizes);
+  EXPECT_GE(cost, 0.0);
+
+  // Three joins, each with a predicate, where the top one joins a single table to the other three
+  ASSERT_EQ(join_input_sizes.size(), 3);
+  EXPECT_EQ(join_input_sizes[0][0] + join_input_sizes[0][1], 4);
+  EXPECT_EQ(std::min(join_input_sizes[0][0], join_input_sizes[0][1]), 1);
+  EXPECT_EQ(CountNodes(plan.get(), planner::PlanNodeType::NESTLOOP), 0);
+  EndTransaction(true);
+}
+
+// Searching the plan space on several threads finds the plan a single thread does
+// NOLINTNEXTLINE
+TEST_F(OptimizerJoinTest, ParallelSearchTest) {
+  BeginTransaction();
+  AddTableStats(tbl_customer_, 30000);
+  AddTableStats(tbl_warehouse_, 1000);
+  AddTableStats(tbl_district_, 10);
+  AddTableStats(tbl_order_, 300000);
+
+  std::string query =
+      "SELECT C.C_ID FROM CUSTOMER AS C, WAREHOUSE AS W, \"ORDER\" AS O, DISTRICT AS D "
+      "WHERE C.C_D_ID = D.D_ID AND D.D_W_ID = W.W_ID AND O.O_C_ID = C.C_ID";
+  double serial_cost;
+  std::vector<std::vector<size_t>> serial_join_input_sizes;
+  auto serial_plan = OptimizeJoin(query, 1, &serial_cost, &serial_join_input_sizes);
+  // A join costs the same with its inputs swapped, so either may be chosen
+  for (auto &sizes : serial_join_input_sizes) std::sort(sizes.begin(), sizes.end());
+
+  // Tasks interleave differently on every run
+  for (uint32_t run = 0; run < 10; run++) {
+    double cost;
+    std::vector<std::vector<size_t>> join_input_sizes;
+    auto plan = OptimizeJoin(query, 4, &cost, &join_input_sizes);
+    EXPECT_DOUBLE_EQ(cost, serial_cost);
+    for (auto &sizes : join_input_sizes) std::sort(sizes.begin(), sizes.end());
+    EXPECT_EQ(join_input_sizes, serial_join_input_sizes);
+    for (const auto type : {planner::PlanNodeType::SEQSCAN, planner::PlanNodeType::INDEXSCAN,
+                            planner::PlanNodeType::HASHJOIN, planner::PlanNodeType::MERGEJOIN,
+                            planner::PlanNodeType::NESTLOOP, planner::PlanNodeType::ORDERBY}) {
+      EXPECT_EQ(CountNodes(plan.get(), type), CountNodes(serial_plan.get(), type));
+    }
+  }
+  EndTransaction(true);
+}
+
+}  // namespace terrier::optimizer
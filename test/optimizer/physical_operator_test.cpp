@@ -596,20 +596,50 @@ TEST(OperatorTests, LeftHashJoinTest) {
   auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
   auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
 
-  Operator left_hash_join_1 = LeftHashJoin::Make(x_1);
-  Operator left_hash_join_2 = LeftHashJoin::Make(x_2);
-  Operator left_hash_join_3 = LeftHashJoin::Make(x_3);
+  auto annotated_expr_0 =
+      AnnotatedExpression(common::ManagedPointer<parser::AbstractExpression>(), std::unordered_set<std::string>());
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator left_hash_join_1 = LeftHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator left_hash_join_2 = LeftHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator left_hash_join_3 = LeftHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_0}, {x_1}, {x_1});
+  Operator left_hash_join_4 = LeftHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_1});
+  Operator left_hash_join_5 = LeftHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_2}, {x_2}, {x_1});
+  Operator left_hash_join_6 = LeftHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_2});
+  Operator left_hash_join_7 = LeftHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_3}, {x_1}, {x_1});
+  Operator left_hash_join_8 = LeftHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_3}, {x_1});
+  Operator left_hash_join_9 = LeftHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_3});
 
   EXPECT_EQ(left_hash_join_1.GetType(), OpType::LEFTHASHJOIN);
   EXPECT_EQ(left_hash_join_3.GetType(), OpType::LEFTHASHJOIN);
   EXPECT_EQ(left_hash_join_1.GetName(), "LeftHashJoin");
-  EXPECT_EQ(*(left_hash_join_1.As<LeftHashJoin>()->GetJoinPredicate()), *x_1);
-  EXPECT_EQ(*(left_hash_join_2.As<LeftHashJoin>()->GetJoinPredicate()), *x_2);
-  EXPECT_EQ(*(left_hash_join_3.As<LeftHashJoin>()->GetJoinPredicate()), *x_3);
+  EXPECT_EQ(left_hash_join_1.As<LeftHashJoin>()->GetJoinPredicates(), std::vector<AnnotatedExpression>());
+  EXPECT_EQ(left_hash_join_3.As<LeftHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_0});
+  EXPECT_EQ(left_hash_join_4.As<LeftHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_1});
+  EXPECT_EQ(left_hash_join_1.As<LeftHashJoin>()->GetLeftKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_1});
+  EXPECT_EQ(left_hash_join_9.As<LeftHashJoin>()->GetRightKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_3});
   EXPECT_TRUE(left_hash_join_1 == left_hash_join_2);
   EXPECT_FALSE(left_hash_join_1 == left_hash_join_3);
+  EXPECT_FALSE(left_hash_join_4 == left_hash_join_3);
+  EXPECT_TRUE(left_hash_join_4 == left_hash_join_5);
+  EXPECT_TRUE(left_hash_join_4 == left_hash_join_6);
+  EXPECT_FALSE(left_hash_join_4 == left_hash_join_7);
+  EXPECT_FALSE(left_hash_join_4 == left_hash_join_8);
+  EXPECT_FALSE(left_hash_join_4 == left_hash_join_9);
   EXPECT_EQ(left_hash_join_1.Hash(), left_hash_join_2.Hash());
   EXPECT_NE(left_hash_join_1.Hash(), left_hash_join_3.Hash());
+  EXPECT_NE(left_hash_join_4.Hash(), left_hash_join_3.Hash());
+  EXPECT_EQ(left_hash_join_4.Hash(), left_hash_join_5.Hash());
+  EXPECT_EQ(left_hash_join_4.Hash(), left_hash_join_6.Hash());
+  EXPECT_NE(left_hash_join_4.Hash(), left_hash_join_7.Hash());
+  EXPECT_NE(left_hash_join_4.Hash(), left_hash_join_8.Hash());
+  EXPECT_NE(left_hash_join_4.Hash(), left_hash_join_9.Hash());
 
   delete expr_b_1;
   delete expr_b_2;
@@ -632,20 +662,50 @@ TEST(OperatorTests, RightHashJoinTest) {
   auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
   auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
 
-  Operator right_hash_join_1 = RightHashJoin::Make(x_1);
-  Operator right_hash_join_2 = RightHashJoin::Make(x_2);
-  Operator right_hash_join_3 = RightHashJoin::Make(x_3);
+  auto annotated_expr_0 =
+      AnnotatedExpression(common::ManagedPointer<parser::AbstractExpression>(), std::unordered_set<std::string>());
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator right_hash_join_1 = RightHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator right_hash_join_2 = RightHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator right_hash_join_3 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_0}, {x_1}, {x_1});
+  Operator right_hash_join_4 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_1});
+  Operator right_hash_join_5 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_2}, {x_2}, {x_1});
+  Operator right_hash_join_6 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_2});
+  Operator right_hash_join_7 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_3}, {x_1}, {x_1});
+  Operator right_hash_join_8 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_3}, {x_1});
+  Operator right_hash_join_9 = RightHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_3});
 
   EXPECT_EQ(right_hash_join_1.GetType(), OpType::RIGHTHASHJOIN);
   EXPECT_EQ(right_hash_join_3.GetType(), OpType::RIGHTHASHJOIN);
   EXPECT_EQ(right_hash_join_1.GetName(), "RightHashJoin");
-  EXPECT_EQ(*(right_hash_join_1.As<RightHashJoin>()->GetJoinPredicate()), *x_1);
-  EXPECT_EQ(*(right_hash_join_2.As<RightHashJoin>()->GetJoinPredicate()), *x_2);
-  EXPECT_EQ(*(right_hash_join_3.As<RightHashJoin>()->GetJoinPredicate()), *x_3);
+  EXPECT_EQ(right_hash_join_1.As<RightHashJoin>()->GetJoinPredicates(), std::vector<AnnotatedExpression>());
+  EXPECT_EQ(right_hash_join_3.As<RightHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_0});
+  EXPECT_EQ(right_hash_join_4.As<RightHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_1});
+  EXPECT_EQ(right_hash_join_1.As<RightHashJoin>()->GetLeftKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_1});
+  EXPECT_EQ(right_hash_join_9.As<RightHashJoin>()->GetRightKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_3});
   EXPECT_TRUE(right_hash_join_1 == right_hash_join_2);
   EXPECT_FALSE(right_hash_join_1 == right_hash_join_3);
+  EXPECT_FALSE(right_hash_join_4 == right_hash_join_3);
+  EXPECT_TRUE(right_hash_join_4 == right_hash_join_5);
+  EXPECT_TRUE(right_hash_join_4 == right_hash_join_6);
+  EXPECT_FALSE(right_hash_join_4 == right_hash_join_7);
+  EXPECT_FALSE(right_hash_join_4 == right_hash_join_8);
+  EXPECT_FALSE(right_hash_join_4 == right_hash_join_9);
   EXPECT_EQ(right_hash_join_1.Hash(), right_hash_join_2.Hash());
   EXPECT_NE(right_hash_join_1.Hash(), right_hash_join_3.Hash());
+  EXPECT_NE(right_hash_join_4.Hash(), right_hash_join_3.Hash());
+  EXPECT_EQ(right_hash_join_4.Hash(), right_hash_join_5.Hash());
+  EXPECT_EQ(right_hash_join_4.Hash(), right_hash_join_6.Hash());
+  EXPECT_NE(right_hash_join_4.Hash(), right_hash_join_7.Hash());
+  EXPECT_NE(right_hash_join_4.Hash(), right_hash_join_8.Hash());
+  EXPECT_NE(right_hash_join_4.Hash(), right_hash_join_9.Hash());
 
   delete expr_b_1;
   delete expr_b_2;
@@ -668,20 +728,116 @@ TEST(OperatorTests, OuterHashJoinTest) {
   auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
   auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
 
-  Operator outer_hash_join_1 = OuterHashJoin::Make(x_1);
-  Operator outer_hash_join_2 = OuterHashJoin::Make(x_2);
-  Operator outer_hash_join_3 = OuterHashJoin::Make(x_3);
+  auto annotated_expr_0 =
+      AnnotatedExpression(common::ManagedPointer<parser::AbstractExpression>(), std::unordered_set<std::string>());
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator outer_hash_join_1 = OuterHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator outer_hash_join_2 = OuterHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator outer_hash_join_3 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_0}, {x_1}, {x_1});
+  Operator outer_hash_join_4 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_1});
+  Operator outer_hash_join_5 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_2}, {x_2}, {x_1});
+  Operator outer_hash_join_6 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_2});
+  Operator outer_hash_join_7 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_3}, {x_1}, {x_1});
+  Operator outer_hash_join_8 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_3}, {x_1});
+  Operator outer_hash_join_9 = OuterHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_3});
 
   EXPECT_EQ(outer_hash_join_1.GetType(), OpType::OUTERHASHJOIN);
   EXPECT_EQ(outer_hash_join_3.GetType(), OpType::OUTERHASHJOIN);
   EXPECT_EQ(outer_hash_join_1.GetName(), "OuterHashJoin");
-  EXPECT_EQ(*(outer_hash_join_1.As<OuterHashJoin>()->GetJoinPredicate()), *x_1);
-  EXPECT_EQ(*(outer_hash_join_2.As<OuterHashJoin>()->GetJoinPredicate()), *x_2);
-  EXPECT_EQ(*(outer_hash_join_3.As<OuterHashJoin>()->GetJoinPredicate()), *x_3);
+  EXPECT_EQ(outer_hash_join_1.As<OuterHashJoin>()->GetJoinPredicates(), std::vector<AnnotatedExpression>());
+  EXPECT_EQ(outer_hash_join_3.As<OuterHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_0});
+  EXPECT_EQ(outer_hash_join_4.As<OuterHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_1});
+  EXPECT_EQ(outer_hash_join_1.As<OuterHashJoin>()->GetLeftKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_1});
+  EXPECT_EQ(outer_hash_join_9.As<OuterHashJoin>()->GetRightKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_3});
   EXPECT_TRUE(outer_hash_join_1 == outer_hash_join_2);
   EXPECT_FALSE(outer_hash_join_1 == outer_hash_join_3);
+  EXPECT_FALSE(outer_hash_join_4 == outer_hash_join_3);
+  EXPECT_TRUE(outer_hash_join_4 == outer_hash_join_5);
+  EXPECT_TRUE(outer_hash_join_4 == outer_hash_join_6);
+  EXPECT_FALSE(outer_hash_join_4 == outer_hash_join_7);
+  EXPECT_FALSE(outer_hash_join_4 == outer_hash_join_8);
+  EXPECT_FALSE(outer_hash_join_4 == outer_hash_join_9);
   EXPECT_EQ(outer_hash_join_1.Hash(), outer_hash_join_2.Hash());
   EXPECT_NE(outer_hash_join_1.Hash(), outer_hash_join_3.Hash());
+  EXPECT_NE(outer_hash_join_4.Hash(), outer_hash_join_3.Hash());
+  EXPECT_EQ(outer_hash_join_4.Hash(), outer_hash_join_5.Hash());
+  EXPECT_EQ(outer_hash_join_4.Hash(), outer_hash_join_6.Hash());
+  EXPECT_NE(outer_hash_join_4.Hash(), outer_hash_join_7.Hash());
+  EXPECT_NE(outer_hash_join_4.Hash(), outer_hash_join_8.Hash());
+  EXPECT_NE(outer_hash_join_4.Hash(), outer_hash_join_9.Hash());
+
+  delete expr_b_1;
+  delete expr_b_2;
+  delete expr_b_3;
+}
+
+// NOLINTNEXTLINE
+TEST(OperatorTests, InnerMergeJoinTest) {
+  //===--------------------------------------------------------------------===//
+  // InnerMergeJoin
+  //===--------------------------------------------------------------------===//
+  parser::AbstractExpression *expr_b_1 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  parser::AbstractExpression *expr_b_2 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  parser::AbstractExpression *expr_b_3 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(false));
+
+  auto x_1 = common::ManagedPointer<parser::AbstractExpression>(expr_b_1);
+  auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
+  auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
+
+  auto annotated_expr_0 =
+      AnnotatedExpression(common::ManagedPointer<parser::AbstractExpression>(), std::unordered_set<std::string>());
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator inner_merge_join_1 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator inner_merge_join_2 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator inner_merge_join_3 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_0}, {x_1}, {x_1});
+  Operator inner_merge_join_4 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_1});
+  Operator inner_merge_join_5 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_2}, {x_2}, {x_1});
+  Operator inner_merge_join_6 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_2});
+  Operator inner_merge_join_7 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_3}, {x_1}, {x_1});
+  Operator inner_merge_join_8 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_3}, {x_1});
+  Operator inner_merge_join_9 = InnerMergeJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_3});
+
+  EXPECT_EQ(inner_merge_join_1.GetType(), OpType::INNERMERGEJOIN);
+  EXPECT_EQ(inner_merge_join_3.GetType(), OpType::INNERMERGEJOIN);
+  EXPECT_EQ(inner_merge_join_1.GetName(), "InnerMergeJoin");
+  EXPECT_EQ(inner_merge_join_1.As<InnerMergeJoin>()->GetJoinPredicates(), std::vector<AnnotatedExpression>());
+  EXPECT_EQ(inner_merge_join_3.As<InnerMergeJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_0});
+  EXPECT_EQ(inner_merge_join_4.As<InnerMergeJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_1});
+  EXPECT_EQ(inner_merge_join_1.As<InnerMergeJoin>()->GetLeftKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_1});
+  EXPECT_EQ(inner_merge_join_9.As<InnerMergeJoin>()->GetRightKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_3});
+  EXPECT_TRUE(inner_merge_join_1 == inner_merge_join_2);
+  EXPECT_FALSE(inner_merge_join_1 == inner_merge_join_3);
+  EXPECT_FALSE(inner_merge_join_4 == inner_merge_join_3);
+  EXPECT_TRUE(inner_merge_join_4 == inner_merge_join_5);
+  EXPECT_TRUE(inner_merge_join_4 == inner_merge_join_6);
+  EXPECT_FALSE(inner_merge_join_4 == inner_merge_join_7);
+  EXPECT_FALSE(inner_merge_join_4 == inner_merge_join_8);
+  EXPECT_FALSE(inner_merge_join_4 == inner_merge_join_9);
+  EXPECT_EQ(inner_merge_join_1.Hash(), inner_merge_join_2.Hash());
+  EXPECT_NE(inner_merge_join_1.Hash(), inner_merge_join_3.Hash());
+  EXPECT_NE(inner_merge_join_4.Hash(), inner_merge_join_3.Hash());
+  EXPECT_EQ(inner_merge_join_4.Hash(), inner_merge_join_5.Hash());
+  EXPECT_EQ(inner_merge_join_4.Hash(), inner_merge_join_6.Hash());
+  EXPECT_NE(inner_merge_join_4.Hash(), inner_merge_join_7.Hash());
+  EXPECT_NE(inner_merge_join_4.Hash(), inner_merge_join_8.Hash());
+  EXPECT_NE(inner_merge_join_4.Hash(), inner_merge_join_9.Hash());
 
   delete expr_b_1;
   delete expr_b_2;
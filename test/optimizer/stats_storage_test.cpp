@@ -30,7 +30,6 @@ class StatsStorageTests : public TerrierTest {
     table_stats_obj_ = TableStats(
         catalog::db_oid_t(1), catalog::table_oid_t(1), 5, true,
         {column_stats_obj_1_, column_stats_obj_2_, column_stats_obj_3_, column_stats_obj_4_, column_stats_obj_5_});
-    stats_storage_ = StatsStorage();
   }
 };
 
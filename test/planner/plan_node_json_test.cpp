@@ -32,6 +32,7 @@
 #include "planner/plannodes/index_scan_plan_node.h"
 #include "planner/plannodes/insert_plan_node.h"
 #include "planner/plannodes/limit_plan_node.h"
+#include "planner/plannodes/merge_join_plan_node.h"
 #include "planner/plannodes/nested_loop_join_plan_node.h"
 #include "planner/plannodes/order_by_plan_node.h"
 #include "planner/plannodes/output_schema.h"
@@ -642,6 +643,34 @@ TEST(PlanNodeJsonTest, HashJoinPlanNodeJoinTest) {
   EXPECT_EQ(plan_node->Hash(), deserialized_plan->Hash());
 }
 
+// NOLINTNEXTLINE
+TEST(PlanNodeJsonTest, MergeJoinPlanNodeJsonTest) {
+  // Construct MergeJoinPlanNode
+  auto left_merge_key = std::make_unique<parser::ColumnValueExpression>("table1", "col1");
+  auto right_merge_key = std::make_unique<parser::ColumnValueExpression>("table2", "col2");
+  auto join_pred = PlanNodeJsonTest::BuildDummyPredicate();
+  MergeJoinPlanNode::Builder builder;
+  auto plan_node =
+      builder.SetOutputSchema(PlanNodeJsonTest::BuildDummyOutputSchema())
+          .SetJoinType(LogicalJoinType::INNER)
+          .SetJoinPredicate(common::ManagedPointer(join_pred))
+          .AddLeftMergeKey(common::ManagedPointer(left_merge_key).CastManagedPointerTo<parser::AbstractExpression>())
+          .AddRightMergeKey(common::ManagedPointer(right_merge_key).CastManagedPointerTo<parser::AbstractExpression>())
+          .Build();
+
+  // Serialize to Json
+  auto json = plan_node->ToJson();
+  EXPECT_FALSE(json.is_null());
+
+  // Deserialize plan node
+  auto deserialized = DeserializePlanNode(json);
+  auto deserialized_plan = common::ManagedPointer(deserialized.result_).CastManagedPointerTo<MergeJoinPlanNode>();
+  EXPECT_TRUE(deserialized_plan != nullptr);
+  EXPECT_EQ(PlanNodeType::MERGEJOIN, deserialized_plan->GetPlanNodeType());
+  EXPECT_EQ(*plan_node, *deserialized_plan);
+  EXPECT_EQ(plan_node->Hash(), deserialized_plan->Hash());
+}
+
 // NOLINTNEXTLINE
 TEST(PlanNodeJsonTest, IndexScanPlanNodeJsonTest) {
   // Construct IndexScanPlanNode
@@ -0,0 +1,1206 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "main/db_main.h"
+#include "parser/expression/column_value_expression.h"
+#include "portable_endian/portable_endian.h"
+#include "storage/garbage_collector_thread.h"
+#include "storage/index/compact_ints_key.h"
+#include "storage/index/index_builder.h"
+#include "storage/index_garbage_collector.h"
+#include "storage/projected_row.h"
+#include "storage/sql_table.h"
+#include "test_util/catalog_test_util.h"
+#include "test_util/data_table_test_util.h"
+#include "test_util/random_test_util.h"
+#include "test_util/storage_test_util.h"
+#include "test_util/test_harness.h"
+#include "transaction/transaction_context.h"
+#include "transaction/transaction_manager.h"
+#include "type/type_id.h"
+#include "type/type_util.h"
+
+namespace terrier::storage::index {
+
+class ArtIndexTests : public TerrierTest {
+ private:
+  catalog::Schema table_schema_;
+  catalog::IndexSchema unique_schema_;
+  catalog::IndexSchema default_schema_;
+
+ public:
+  std::default_random_engine generator_;
+  const uint32_t num_threads_ = 4;
+
+  std::unique_ptr<DBMain> db_main_;
+  common::ManagedPointer<transaction::TransactionManager> txn_manager_;
+
+  // SqlTable
+  storage::SqlTable *sql_table_;
+  storage::ProjectedRowInitializer tuple_initializer_ =
+      storage::ProjectedRowInitializer::Create(std::vector<uint16_t>{1}, std::vector<uint16_t>{1});
+
+  // ArtIndex
+  Index *default_index_, *unique_index_;
+
+  byte *key_buffer_1_, *key_buffer_2_;
+
+  common::WorkerPool thread_pool_{num_threads_, {}};
+
+ protected:
+  void SetUp() override {
+    thread_pool_.Startup();
+    db_main_ = terrier::DBMain::Builder().SetUseGC(true).SetUseGCThread(true).SetRecordBufferSegmentSize(1e6).Build();
+    txn_manager_ = db_main_->GetTransactionLayer()->GetTransactionManager();
+
+    auto col = catalog::Schema::Column(
+        "attribute", type::TypeId::INTEGER, false,
+        parser::ConstantValueExpression(type::TransientValueFactory::GetNull(type::TypeId::INTEGER)));
+    StorageTestUtil::ForceOid(&(col), catalog::col_oid_t(1));
+    table_schema_ = catalog::Schema({col});
+    sql_table_ = new storage::SqlTable(db_main_->GetStorageLayer()->GetBlockStore(), table_schema_);
+    tuple_initializer_ = sql_table_->InitializerForProjectedRow({catalog::col_oid_t(1)});
+
+    std::vector<catalog::IndexSchema::Column> keycols;
+    keycols.emplace_back("", type::TypeId::INTEGER, false,
+                         parser::ColumnValueExpression(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID,
+                                                       catalog::col_oid_t(1)));
+    StorageTestUtil::ForceOid(&(keycols[0]), catalog::indexkeycol_oid_t(1));
+    unique_schema_ = catalog::IndexSchema(keycols, storage::index::IndexType::ART, true, true, false, true);
+    default_schema_ = catalog::IndexSchema(keycols, storage::index::IndexType::ART, false, false, false, true);
+
+    unique_index_ = (IndexBuilder().SetKeySchema(unique_schema_)).Build();
+    default_index_ = (IndexBuilder().SetKeySchema(default_schema_)).Build();
+
+    db_main_->GetStorageLayer()->GetGarbageCollector()->RegisterIndexForGC(
+        common::ManagedPointer<Index>(unique_index_));
+    db_main_->GetStorageLayer()->GetGarbageCollector()->RegisterIndexForGC(
+        common::ManagedPointer<Index>(default_index_));
+
+    key_buffer_1_ =
+        common::AllocationUtil::AllocateAligned(default_index_->GetProjectedRowInitializer().ProjectedRowSize());
+    key_buffer_2_ =
+        common::AllocationUtil::AllocateAligned(default_index_->GetProjectedRowInitializer().ProjectedRowSize());
+  }
+  void TearDown() override {
+    thread_pool_.Shutdown();
+    db_main_->GetStorageLayer()->GetGarbageCollector()->UnregisterIndexForGC(
+        common::ManagedPointer<Index>(unique_index_));
+    db_main_->GetStorageLayer()->GetGarbageCollector()->UnregisterIndexForGC(
+        common::ManagedPointer<Index>(default_index_));
+
+    db_main_->GetTransactionLayer()->GetDeferredActionManager()->RegisterDeferredAction([=]() {
+      delete sql_table_;
+      delete default_index_;
+      delete unique_index_;
+    });
+
+    delete[] key_buffer_1_;
+    delete[] key_buffer_2_;
+  }
+};
+
+/**
+ * This test creates multiple worker threads that all try to insert [0,num_inserts) as tuples in the table and into the
+ * primary key index. At completion of the workload, only num_inserts_ txns should have committed with visible versions
+ * in the index and table.
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, UniqueInsert) {
+  const uint32_t num_inserts = 100000;  // number of tuples/primary keys for each worker to attempt to insert
+  auto workload = [&](uint32_t worker_id) {
+    auto *const key_buffer =
+        common::AllocationUtil::AllocateAligned(unique_index_->GetProjectedRowInitializer().ProjectedRowSize());
+    auto *const insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer);
+
+    // some threads count up, others count down. This is to mix whether threads abort for write-write conflict or
+    // previously committed versions
+    if (worker_id % 2 == 0) {
+      for (uint32_t i = 0; i < num_inserts; i++) {
+        auto *const insert_txn = txn_manager_->BeginTransaction();
+        auto *const insert_redo =
+            insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+        auto *const insert_tuple = insert_redo->Delta();
+        *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+        const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+        *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+        if (unique_index_->InsertUnique(common::ManagedPointer(insert_txn), *insert_key, tuple_slot)) {
+          txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+        } else {
+          txn_manager_->Abort(insert_txn);
+        }
+      }
+
+    } else {
+      for (uint32_t i = num_inserts - 1; i < num_inserts; i--) {
+        auto *const insert_txn = txn_manager_->BeginTransaction();
+        auto *const insert_redo =
+            insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+        auto *const insert_tuple = insert_redo->Delta();
+        *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+        const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+        *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+        if (unique_index_->InsertUnique(common::ManagedPointer(insert_txn), *insert_key, tuple_slot)) {
+          txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+        } else {
+          txn_manager_->Abort(insert_txn);
+        }
+      }
+    }
+    delete[] key_buffer;
+  };
+
+  // run the workload
+  for (uint32_t i = 0; i < num_threads_; i++) {
+    thread_pool_.SubmitTask([i, &workload] { workload(i); });
+  }
+  thread_pool_.WaitUntilAllFinished();
+
+  // scan the results
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+
+  // scan[0,num_inserts_) should hit num_inserts_ keys (no duplicates)
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 0;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = num_inserts - 1;
+  unique_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 0, &results);
+  EXPECT_EQ(results.size(), num_inserts);
+
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * This test creates multiple worker threads that all try to insert [0,num_inserts) as tuples in the table and into the
+ * primary key index. At completion of the workload, all num_inserts_ txns * num_threads_ should have committed with
+ * visible versions in the index and table.
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, DefaultInsert) {
+  const uint32_t num_inserts = 100000;  // number of tuples/primary keys for each worker to attempt to insert
+  auto workload = [&](uint32_t worker_id) {
+    auto *const key_buffer =
+        common::AllocationUtil::AllocateAligned(default_index_->GetProjectedRowInitializer().ProjectedRowSize());
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer);
+
+    // some threads count up, others count down. Threads shouldn't abort each other
+    if (worker_id % 2 == 0) {
+      for (uint32_t i = 0; i < num_inserts; i++) {
+        auto *const insert_txn = txn_manager_->BeginTransaction();
+        auto *const insert_redo =
+            insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+        auto *const insert_tuple = insert_redo->Delta();
+        *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+        const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+        *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+        EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+        txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+      }
+    } else {
+      for (uint32_t i = num_inserts - 1; i < num_inserts; i--) {
+        auto *const insert_txn = txn_manager_->BeginTransaction();
+        auto *const insert_redo =
+            insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+        auto *const insert_tuple = insert_redo->Delta();
+        *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+        const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+        *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+        EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+        txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+      }
+    }
+
+    delete[] key_buffer;
+  };
+
+  // run the workload
+  for (uint32_t i = 0; i < num_threads_; i++) {
+    thread_pool_.SubmitTask([i, &workload] { workload(i); });
+  }
+  thread_pool_.WaitUntilAllFinished();
+
+  // scan the results
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+
+  // scan[0,num_inserts_) should hit num_inserts_ * num_threads_ keys
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 0;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = num_inserts - 1;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 0, &results);
+  EXPECT_EQ(results.size(), num_inserts * num_threads_);
+
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Tests basic scan behavior using various windows to scan over (some out of of bounds of keyspace, some matching
+ * exactly, etc.)
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, ScanAscending) {
+  // populate index with [0..20] even keys
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 20; i += 2) {
+    auto *const insert_redo =
+        insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+
+  // scan[8,12] should hit keys 8, 10, 12
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 8;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 12;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 0, &results);
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_EQ(reference.at(8), results[0]);
+  EXPECT_EQ(reference.at(10), results[1]);
+  EXPECT_EQ(reference.at(12), results[2]);
+  results.clear();
+
+  // scan[7,13] should hit keys 8, 10, 12
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 7;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 13;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 0, &results);
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_EQ(reference.at(8), results[0]);
+  EXPECT_EQ(reference.at(10), results[1]);
+  EXPECT_EQ(reference.at(12), results[2]);
+  results.clear();
+
+  // scan[-1,5] should hit keys 0, 2, 4
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = -1;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 5;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 0, &results);
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_EQ(reference.at(0), results[0]);
+  EXPECT_EQ(reference.at(2), results[1]);
+  EXPECT_EQ(reference.at(4), results[2]);
+  results.clear();
+
+  // scan[15,21] should hit keys 16, 18, 20
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 15;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 21;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 0, &results);
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_EQ(reference.at(16), results[0]);
+  EXPECT_EQ(reference.at(18), results[1]);
+  EXPECT_EQ(reference.at(20), results[2]);
+  results.clear();
+
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Tests basic scan behavior using various windows to scan over (some out of of bounds of keyspace, some matching
+ * exactly, etc.)
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, ScanDescending) {
+  // populate index with [0..20] even keys
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 20; i += 2) {
+    auto *const insert_redo =
+        insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+
+  // scan[8,12] should hit keys 12, 10, 8
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 8;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 12;
+  default_index_->ScanDescending(*scan_txn, *low_key_pr, *high_key_pr, &results);
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_EQ(reference.at(12), results[0]);
+  EXPECT_EQ(reference.at(10), results[1]);
+  EXPECT_EQ(reference.at(8), results[2]);
+  results.clear();
+
+  // scan[7,13] should hit keys 12, 10, 8
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 7;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 13;
+  default_index_->ScanDescending(*scan_txn, *low_key_pr, *high_key_pr, &results);
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_EQ(reference.at(12), results[0]);
+  EXPECT_EQ(reference.at(10), results[1]);
+  EXPECT_EQ(reference.at(8), results[2]);
+  results.clear();
+
+  // scan[-1,5] should hit keys 4, 2, 0
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = -1;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 5;
+  default_index_->ScanDescending(*scan_txn, *low_key_pr, *high_key_pr, &results);
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_EQ(reference.at(4), results[0]);
+  EXPECT_EQ(reference.at(2), results[1]);
+  EXPECT_EQ(reference.at(0), results[2]);
+  results.clear();
+
+  // scan[15,21] should hit keys 20, 18, 16
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 15;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 21;
+  default_index_->ScanDescending(*scan_txn, *low_key_pr, *high_key_pr, &results);
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_EQ(reference.at(20), results[0]);
+  EXPECT_EQ(reference.at(18), results[1]);
+  EXPECT_EQ(reference.at(16), results[2]);
+  results.clear();
+
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Tests basic scan behavior using various windows to scan over (some out of of bounds of keyspace, some matching
+ * exactly, etc.)
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, ScanLimitAscending) {
+  // populate index with [0..20] even keys
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 20; i += 2) {
+    auto *const insert_redo =
+        insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+
+  // scan_limit[8,12] should hit keys 8, 10
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 8;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 12;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 2, &results);
+  EXPECT_EQ(results.size(), 2);
+  EXPECT_EQ(reference.at(8), results[0]);
+  EXPECT_EQ(reference.at(10), results[1]);
+  results.clear();
+
+  // scan_limit[7,13] should hit keys 8, 10
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 7;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 13;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 2, &results);
+  EXPECT_EQ(results.size(), 2);
+  EXPECT_EQ(reference.at(8), results[0]);
+  EXPECT_EQ(reference.at(10), results[1]);
+  results.clear();
+
+  // scan_limit[-1,5] should hit keys 0, 2
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = -1;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 5;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 2, &results);
+  EXPECT_EQ(results.size(), 2);
+  EXPECT_EQ(reference.at(0), results[0]);
+  EXPECT_EQ(reference.at(2), results[1]);
+  results.clear();
+
+  // scan_limit[15,21] should hit keys 16, 18
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 15;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 21;
+  default_index_->ScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr, high_key_pr, 2, &results);
+  EXPECT_EQ(results.size(), 2);
+  EXPECT_EQ(reference.at(16), results[0]);
+  EXPECT_EQ(reference.at(18), results[1]);
+  results.clear();
+
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Tests basic scan behavior using various windows to scan over (some out of of bounds of keyspace, some matching
+ * exactly, etc.)
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, ScanLimitDescending) {
+  // populate index with [0..20] even keys
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 20; i += 2) {
+    auto *const insert_redo =
+        insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+
+  // scan_limit[8,12] should hit keys 12, 10
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 8;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 12;
+  default_index_->ScanLimitDescending(*scan_txn, *low_key_pr, *high_key_pr, &results, 2);
+  EXPECT_EQ(results.size(), 2);
+  EXPECT_EQ(reference.at(12), results[0]);
+  EXPECT_EQ(reference.at(10), results[1]);
+  results.clear();
+
+  // scan_limit[7,13] should hit keys 12, 10
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 7;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 13;
+  default_index_->ScanLimitDescending(*scan_txn, *low_key_pr, *high_key_pr, &results, 2);
+  EXPECT_EQ(results.size(), 2);
+  EXPECT_EQ(reference.at(12), results[0]);
+  EXPECT_EQ(reference.at(10), results[1]);
+  results.clear();
+
+  // scan_limit[-1,5] should hit keys 4, 2
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = -1;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 5;
+  default_index_->ScanLimitDescending(*scan_txn, *low_key_pr, *high_key_pr, &results, 2);
+  EXPECT_EQ(results.size(), 2);
+  EXPECT_EQ(reference.at(4), results[0]);
+  EXPECT_EQ(reference.at(2), results[1]);
+  results.clear();
+
+  // scan_limit[15,21] should hit keys 20, 18
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 15;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 21;
+  default_index_->ScanLimitDescending(*scan_txn, *low_key_pr, *high_key_pr, &results, 2);
+  EXPECT_EQ(results.size(), 2);
+  EXPECT_EQ(reference.at(20), results[0]);
+  EXPECT_EQ(reference.at(18), results[1]);
+  results.clear();
+
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Tests that cursors hand out visible values in scan order a batch at a time, skip invisible values without ending the
+ * scan early, and stop at their limit
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, ScanCursor) {
+  // populate index with [0..20] even keys
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 20; i += 2) {
+    auto *const insert_redo =
+        insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  // a concurrent txn inserts the odd keys [1..19], which must not be visible to scan_txn
+  auto *const uncommitted_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 1; i < 20; i += 2) {
+    auto *const insert_redo =
+        uncommitted_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(uncommitted_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(uncommitted_txn), *insert_key, tuple_slot));
+  }
+
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  storage::TupleSlot batch[3];
+
+  // cursor[3,15] in batches of 3 should hit keys 4, 6, 8 then 10, 12, 14
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 3;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 15;
+  auto cursor = default_index_->OpenScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr,
+                                                  high_key_pr, 0);
+  // the cursor no longer depends on the keys once it is open
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 0;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 0;
+  std::vector<storage::TupleSlot> results;
+  for (uint32_t num_slots; (num_slots = cursor->Next(batch, 3)) > 0;) {
+    EXPECT_LE(num_slots, 3);
+    results.insert(results.end(), batch, batch + num_slots);
+  }
+  EXPECT_EQ(results, std::vector<storage::TupleSlot>({reference.at(4), reference.at(6), reference.at(8),
+                                                      reference.at(10), reference.at(12), reference.at(14)}));
+  EXPECT_EQ(cursor->Next(batch, 3), 0);
+
+  // cursor[begin,end] with limit 4 should hit keys 0, 2 then 4, 6
+  cursor = default_index_->OpenScanAscending(*scan_txn, storage::index::ScanType::OpenBoth, 1, low_key_pr, high_key_pr,
+                                             4);
+  EXPECT_EQ(cursor->Next(batch, 2), 2);
+  EXPECT_EQ(reference.at(0), batch[0]);
+  EXPECT_EQ(reference.at(2), batch[1]);
+  EXPECT_EQ(cursor->Next(batch, 3), 2);
+  EXPECT_EQ(reference.at(4), batch[0]);
+  EXPECT_EQ(reference.at(6), batch[1]);
+  EXPECT_EQ(cursor->Next(batch, 3), 0);
+
+  // descending cursor[5,21] with limit 4 should hit keys 20, 18, 16 then 14
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 5;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 21;
+  cursor = default_index_->OpenScanDescending(*scan_txn, *low_key_pr, *high_key_pr, 4);
+  EXPECT_EQ(cursor->Next(batch, 3), 3);
+  EXPECT_EQ(reference.at(20), batch[0]);
+  EXPECT_EQ(reference.at(18), batch[1]);
+  EXPECT_EQ(reference.at(16), batch[2]);
+  EXPECT_EQ(cursor->Next(batch, 3), 1);
+  EXPECT_EQ(reference.at(14), batch[0]);
+  EXPECT_EQ(cursor->Next(batch, 3), 0);
+
+  // key cursor on an uncommitted key should hit nothing
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 7;
+  cursor = default_index_->OpenScanKey(*scan_txn, *low_key_pr);
+  EXPECT_EQ(cursor->Next(batch, 3), 0);
+  cursor.reset();
+
+  txn_manager_->Abort(uncommitted_txn);
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+// Verifies that a cursor asked to keep keys hands back the key of each visible value it returns
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, ScanCursorKeys) {
+  // populate index with [0..20] keys, where only the even keys are committed
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  auto *const uncommitted_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 20; i++) {
+    auto *const txn = i % 2 == 0 ? insert_txn : uncommitted_txn;
+    auto *const insert_redo =
+        txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  storage::TupleSlot batch[4];
+
+  // cursor[3,15] sees candidates 3..15, of which only the even keys are visible, and each key must line up with its
+  // value after the invisible candidates are dropped
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 3;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 15;
+  auto cursor = default_index_->OpenScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr,
+                                                  high_key_pr, 0);
+  cursor->KeepKeys();
+  // the key buffers are free to reuse once the cursor is open
+  auto *const key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  std::vector<int32_t> keys;
+  for (uint32_t num_slots; (num_slots = cursor->Next(batch, 4)) > 0;) {
+    for (uint32_t idx = 0; idx < num_slots; idx++) {
+      cursor->CopyKey(idx, key_pr);
+      const auto key = *reinterpret_cast<const int32_t *>(key_pr->AccessWithNullCheck(0));
+      EXPECT_EQ(reference.at(key), batch[idx]);
+      keys.emplace_back(key);
+    }
+  }
+  EXPECT_EQ(keys, std::vector<int32_t>({4, 6, 8, 10, 12, 14}));
+
+  // descending cursor[0,9] should hand back keys 8, 6, 4, 2, 0
+  auto *const descending_high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 0;
+  *reinterpret_cast<int32_t *>(descending_high_key_pr->AccessForceNotNull(0)) = 9;
+  cursor = default_index_->OpenScanDescending(*scan_txn, *low_key_pr, *descending_high_key_pr, 0);
+  cursor->KeepKeys();
+  keys.clear();
+  for (uint32_t num_slots; (num_slots = cursor->Next(batch, 4)) > 0;) {
+    for (uint32_t idx = 0; idx < num_slots; idx++) {
+      cursor->CopyKey(idx, key_pr);
+      keys.emplace_back(*reinterpret_cast<const int32_t *>(key_pr->AccessWithNullCheck(0)));
+    }
+  }
+  EXPECT_EQ(keys, std::vector<int32_t>({8, 6, 4, 2, 0}));
+  cursor.reset();
+
+  txn_manager_->Abort(uncommitted_txn);
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+// Verifies that primary key insert fails on write-write conflict
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, UniqueKey1) {
+  auto *txn0 = txn_manager_->BeginTransaction();
+
+  // txn 0 inserts into table
+  auto *insert_redo =
+      txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+  auto *insert_tuple = insert_redo->Delta();
+  *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
+  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+
+  // txn 0 inserts into index
+  auto *insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15721;
+  EXPECT_TRUE(unique_index_->InsertUnique(common::ManagedPointer(txn0), *insert_key, tuple_slot));
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const scan_key_pr = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+
+  // txn 0 scans index and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  unique_index_->ScanKey(*txn0, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  auto *txn1 = txn_manager_->BeginTransaction();
+
+  // txn 1 scans index and gets no visible result
+  unique_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  // txn 1 inserts into table
+  insert_redo = txn1->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+  insert_tuple = insert_redo->Delta();
+  *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
+  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn1), insert_redo);
+
+  // txn 1 inserts into index and fails due to write-write conflict with txn 0
+  insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15721;
+  EXPECT_FALSE(unique_index_->InsertUnique(common::ManagedPointer(txn1), *insert_key, new_tuple_slot));
+
+  txn_manager_->Abort(txn1);
+
+  txn_manager_->Commit(txn0, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *txn2 = txn_manager_->BeginTransaction();
+
+  // txn 2 scans index and gets a visible, correct result
+  unique_index_->ScanKey(*txn2, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  txn_manager_->Commit(txn2, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+//    Txn #0 | Txn #1 | Txn #2 |
+//    --------------------------
+//    BEGIN  |        |        |
+//    W(X)   |        |        |
+//    R(X)   |        |        |
+//           | BEGIN  |        |
+//           | R(X)   |        |
+//    COMMIT |        |        |
+//           | R(X)   |        |
+//           | COMMIT |        |
+//           |        | BEGIN  |
+//           |        | R(X)   |
+//           |        | COMMIT |
+//
+// Txn #0 should only read Txn #0's version of X
+// Txn #1 should only read the previous version of X because its start time is before #0's commit
+// Txn #2 should only read Txn #0's version of X
+//
+// This test confirms that we are not susceptible to the DIRTY READS and UNREPEATABLE READS anomalies
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, CommitInsert1) {
+  auto *txn0 = txn_manager_->BeginTransaction();
+
+  // txn 0 inserts into table
+  auto *insert_redo =
+      txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+  auto *insert_tuple = insert_redo->Delta();
+  *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
+  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+
+  // txn 0 inserts into index
+  auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15721;
+  EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(txn0), *insert_key, tuple_slot));
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const scan_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+
+  // txn 0 scans index and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn0, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  auto *txn1 = txn_manager_->BeginTransaction();
+
+  // txn 1 scans index and gets no visible result
+  default_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  txn_manager_->Commit(txn0, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // txn 1 scans index and gets no visible result
+  default_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  txn_manager_->Commit(txn1, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *txn2 = txn_manager_->BeginTransaction();
+
+  // txn 2 scans index and gets a visible, correct result
+  default_index_->ScanKey(*txn2, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  txn_manager_->Commit(txn2, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+//    Txn #0 | Txn #1 | Txn #2 |
+//    --------------------------
+//    BEGIN  |        |        |
+//    W(X)   |        |        |
+//    R(X)   |        |        |
+//           | BEGIN  |        |
+//           | R(X)   |        |
+//    ABORT  |        |        |
+//           | R(X)   |        |
+//           | COMMIT |        |
+//           |        | BEGIN  |
+//           |        | R(X)   |
+//           |        | COMMIT |
+//
+// Txn #0 should only read Txn #0's version of X
+// Txn #1 should only read the previous version of X because Txn #0's is uncommitted
+// Txn #2 should only read the previous version of X because Txn #0 aborted
+//
+// This test confirms that we are not susceptible to the DIRTY READS and UNREPEATABLE READS anomalies
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, AbortInsert1) {
+  auto *txn0 = txn_manager_->BeginTransaction();
+
+  // txn 0 inserts into table
+  auto *insert_redo =
+      txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+  auto *insert_tuple = insert_redo->Delta();
+  *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
+  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+
+  // txn 0 inserts into index
+  auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15721;
+  EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(txn0), *insert_key, tuple_slot));
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const scan_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+
+  // txn 0 scans index and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn0, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  auto *txn1 = txn_manager_->BeginTransaction();
+
+  // txn 1 scans index and gets no visible result
+  default_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  txn_manager_->Abort(txn0);
+
+  // txn 1 scans index and gets no visible result
+  default_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  txn_manager_->Commit(txn1, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *txn2 = txn_manager_->BeginTransaction();
+
+  // txn 2 scans index and gets no visible result
+  default_index_->ScanKey(*txn2, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  txn_manager_->Commit(txn2, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+//    Txn #0 | Txn #1 | Txn #2 |
+//    --------------------------
+//    BEGIN  |        |        |
+//    W(X)   |        |        |
+//    R(X)   |        |        |
+//           | BEGIN  |        |
+//           | R(X)   |        |
+//    COMMIT |        |        |
+//           | R(X)   |        |
+//           | COMMIT |        |
+//           |        | BEGIN  |
+//           |        | R(X)   |
+//           |        | COMMIT |
+//
+// Txn #0 should only read Txn #0's version of X
+// Txn #1 should only read the previous version of X because its start time is before #0's commit
+// Txn #2 should only read Txn #0's version of X
+//
+// This test confirms that we are not susceptible to the DIRTY READS and UNREPEATABLE READS anomalies
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, CommitDelete1) {
+  auto *insert_txn = txn_manager_->BeginTransaction();
+
+  // insert_txn inserts into table
+  auto *insert_redo =
+      insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+  auto *insert_tuple = insert_redo->Delta();
+  *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
+  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+  // insert_txn inserts into index
+  auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15721;
+  EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const scan_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+
+  auto *txn0 = txn_manager_->BeginTransaction();
+
+  // txn 0 scans index for 15721 and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn0, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+
+  // txn 0 deletes in the table and index
+  txn0->StageDelete(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, results[0]);
+  EXPECT_TRUE(sql_table_->Delete(common::ManagedPointer(txn0), results[0]));
+  default_index_->Delete(common::ManagedPointer(txn0), *insert_key, results[0]);
+  results.clear();
+
+  // txn 0 scans index for 15721 and gets no visible result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn0, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  auto *txn1 = txn_manager_->BeginTransaction();
+
+  // txn 1 scans index for 15721 and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  txn_manager_->Commit(txn0, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // txn 1 scans index for 15721 and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  txn_manager_->Commit(txn1, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *txn2 = txn_manager_->BeginTransaction();
+
+  // txn 2 scans index for 15721 and gets no visible result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn2, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  txn_manager_->Commit(txn2, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+//    Txn #0 | Txn #1 | Txn #2 |
+//    --------------------------
+//    BEGIN  |        |        |
+//    W(X)   |        |        |
+//    R(X)   |        |        |
+//           | BEGIN  |        |
+//           | R(X)   |        |
+//    ABORT  |        |        |
+//           | R(X)   |        |
+//           | COMMIT |        |
+//           |        | BEGIN  |
+//           |        | R(X)   |
+//           |        | COMMIT |
+//
+// Txn #0 should only read Txn #0's version of X
+// Txn #1 should only read the previous version of X because Txn #0's is uncommitted
+// Txn #2 should only read the previous version of X because Txn #0 aborted
+//
+// This test confirms that we are not susceptible to the DIRTY READS and UNREPEATABLE READS anomalies
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, AbortDelete1) {
+  auto *insert_txn = txn_manager_->BeginTransaction();
+
+  // insert_txn inserts into table
+  auto *insert_redo =
+      insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+  auto *insert_tuple = insert_redo->Delta();
+  *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
+  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+  // insert_txn inserts into index
+  auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15721;
+  EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  std::vector<storage::TupleSlot> results;
+
+  auto *const scan_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+
+  auto *txn0 = txn_manager_->BeginTransaction();
+
+  // txn 0 scans index for 15721 and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn0, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+
+  // txn 0 deletes in the table and index
+  txn0->StageDelete(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, results[0]);
+  EXPECT_TRUE(sql_table_->Delete(common::ManagedPointer(txn0), results[0]));
+  default_index_->Delete(common::ManagedPointer(txn0), *insert_key, results[0]);
+  results.clear();
+
+  // txn 0 scans index for 15721 and gets no visible result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn0, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 0);
+  results.clear();
+
+  auto *txn1 = txn_manager_->BeginTransaction();
+
+  // txn 1 scans index for 15721 and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  txn_manager_->Abort(txn0);
+
+  // txn 1 scans index for 15721 and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn1, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  txn_manager_->Commit(txn1, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *txn2 = txn_manager_->BeginTransaction();
+
+  // txn 2 scans index for 15721 and gets a visible, correct result
+  *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = 15721;
+  default_index_->ScanKey(*txn2, *scan_key_pr, &results);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_EQ(tuple_slot, results[0]);
+  results.clear();
+
+  txn_manager_->Commit(txn2, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Bulk loads an index over a table that already holds committed tuples (each key twice), an aborted tuple and a tuple
+ * from a still running txn. Only the committed tuples should be indexed, and the unique index should refuse to build.
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, BulkLoad) {
+  const int32_t num_keys = 100000;
+
+  auto insert_tuple = [&](transaction::TransactionContext *const txn, const int32_t key) {
+    auto *const insert_redo =
+        txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = key;
+    return sql_table_->Insert(common::ManagedPointer(txn), insert_redo);
+  };
+
+  std::map<int32_t, std::vector<storage::TupleSlot>> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i < 2 * num_keys; i++) {
+    const int32_t key = i % num_keys;
+    reference[key].emplace_back(insert_tuple(insert_txn, key));
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const aborted_txn = txn_manager_->BeginTransaction();
+  insert_tuple(aborted_txn, num_keys);
+  txn_manager_->Abort(aborted_txn);
+
+  auto *const concurrent_txn = txn_manager_->BeginTransaction();
+  auto *const build_txn = txn_manager_->BeginTransaction();
+  insert_tuple(concurrent_txn, num_keys + 1);
+  txn_manager_->Commit(concurrent_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  EXPECT_TRUE(
+      default_index_->BulkLoad(common::ManagedPointer(build_txn), common::ManagedPointer(sql_table_), DISABLED));
+  EXPECT_FALSE(
+      unique_index_->BulkLoad(common::ManagedPointer(build_txn), common::ManagedPointer(sql_table_), DISABLED));
+
+  const auto by_location = [](const TupleSlot &l, const TupleSlot &r) {
+    return l.GetBlock() < r.GetBlock() || (l.GetBlock() == r.GetBlock() && l.GetOffset() < r.GetOffset());
+  };
+  std::vector<storage::TupleSlot> results;
+  auto *const scan_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  for (int32_t key = 0; key < num_keys; key++) {
+    *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = key;
+    default_index_->ScanKey(*build_txn, *scan_key_pr, &results);
+    auto &expected = reference[key];
+    std::sort(results.begin(), results.end(), by_location);
+    std::sort(expected.begin(), expected.end(), by_location);
+    EXPECT_EQ(results, expected);
+    results.clear();
+  }
+
+  // Neither the aborted tuple nor the one committed after the building txn started was indexed
+  for (int32_t key = num_keys; key <= num_keys + 1; key++) {
+    *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = key;
+    default_index_->ScanKey(*build_txn, *scan_key_pr, &results);
+    EXPECT_TRUE(results.empty());
+  }
+
+  txn_manager_->Commit(build_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Workers fill both indexes while another thread keeps running index garbage collection passes over them. Once the
+ * workers are done, a few more passes must reclaim every node the indexes retired.
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtIndexTests, IndexGarbageCollection) {
+  const uint32_t num_inserts = 10000;  // number of keys each worker inserts into each index
+  // Keep the system's index GC out of the way so that only the passes below advance the epochs
+  db_main_->GetGarbageCollectorThread()->PauseGC();
+  storage::IndexGarbageCollector index_gc;
+  index_gc.RegisterIndex(common::ManagedPointer<Index>(unique_index_), catalog::index_oid_t(1));
+  index_gc.RegisterIndex(common::ManagedPointer<Index>(default_index_), catalog::index_oid_t(2));
+
+  std::atomic<uint32_t> num_finished{0};
+  const uint32_t num_workers = num_threads_ - 1;
+  auto workload = [&](uint32_t worker_id) {
+    if (worker_id == num_workers) {
+      while (num_finished.load() < num_workers) EXPECT_EQ(index_gc.PerformGarbageCollection(), 2);
+      return;
+    }
+    auto *const key_buffer =
+        common::AllocationUtil::AllocateAligned(default_index_->GetProjectedRowInitializer().ProjectedRowSize());
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer);
+    auto *const insert_txn = txn_manager_->BeginTransaction();
+    for (uint32_t i = 0; i < num_inserts; i++) {
+      auto *const insert_redo =
+          insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+      const int32_t key = static_cast<int32_t>(i * num_workers + worker_id);
+      *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = key;
+      const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+      *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = key;
+      EXPECT_TRUE(unique_index_->InsertUnique(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+      EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+    }
+    txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    delete[] key_buffer;
+    num_finished++;
+  };
+
+  for (uint32_t i = 0; i <= num_workers; i++) {
+    thread_pool_.SubmitTask([i, &workload] { workload(i); });
+  }
+  thread_pool_.WaitUntilAllFinished();
+
+  for (uint8_t i = 0; i < transaction::MIN_GC_INVOCATIONS; i++) EXPECT_EQ(index_gc.PerformGarbageCollection(), 2);
+  EXPECT_EQ(unique_index_->NumRetainedGarbageNodes(), 0);
+  EXPECT_EQ(default_index_->NumRetainedGarbageNodes(), 0);
+
+  index_gc.UnregisterIndex(common::ManagedPointer<Index>(unique_index_));
+  index_gc.UnregisterIndex(common::ManagedPointer<Index>(default_index_));
+  EXPECT_EQ(index_gc.PerformGarbageCollection(), 0);
+  db_main_->GetGarbageCollectorThread()->ResumeGC();
+}
+
+}  // namespace terrier::storage::index
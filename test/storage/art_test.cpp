@@ -0,0 +1,214 @@
+#include "storage/index/art.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "portable_endian/portable_endian.h"
+#include "test_util/multithread_test_util.h"
+#include "test_util/test_harness.h"
+
+namespace terrier::storage::index {
+
+/**
+ * Big-endian integer key, the simplest binary-comparable key the tree accepts
+ */
+class ArtTestKey {
+ public:
+  explicit ArtTestKey(const uint64_t value) {
+    const uint64_t big_endian = htobe64(value);
+    std::memcpy(key_data_, &big_endian, sizeof(uint64_t));
+  }
+
+  const byte *KeyData() const { return key_data_; }
+
+  uint64_t Value() const {
+    uint64_t big_endian;
+    std::memcpy(&big_endian, key_data_, sizeof(uint64_t));
+    return be64toh(big_endian);
+  }
+
+ private:
+  byte key_data_[sizeof(uint64_t)];
+};
+
+using ArtTestTree = AdaptiveRadixTree<ArtTestKey, uint64_t>;
+using ArtTestEntry = std::pair<uint64_t, uint64_t>;
+
+/**
+ * Collects up to limit entries in scan order
+ */
+class ArtTestVisitor {
+ public:
+  explicit ArtTestVisitor(const size_t limit) : limit_(limit) {}
+
+  void Reset() { entries_.clear(); }
+
+  bool Visit(const ArtTestKey &key, const uint64_t value) {
+    entries_.emplace_back(key.Value(), value);
+    return entries_.size() < limit_;
+  }
+
+  const std::vector<ArtTestEntry> &Entries() const { return entries_; }
+
+ private:
+  const size_t limit_;
+  std::vector<ArtTestEntry> entries_;
+};
+
+struct ArtTests : public TerrierTest {
+  const uint32_t num_threads_ = MultiThreadTestUtil::HardwareConcurrency();
+};
+
+/**
+ * Applies random inserts and deletes over small, medium and full-width key spaces, and checks point lookups and scans in
+ * both directions against a std::set.
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtTests, RandomOperations) {
+  std::default_random_engine generator;
+  const std::vector<uint64_t> key_spaces{64, 5000, std::numeric_limits<uint64_t>::max()};
+  for (const auto key_space : key_spaces) {
+    ArtTestTree tree;
+    std::set<ArtTestEntry> reference;
+    std::uniform_int_distribution<uint64_t> key_dist(0, key_space - 1);
+    std::uniform_int_distribution<uint64_t> value_dist(0, 15);
+
+    for (uint32_t i = 0; i < 100000; i++) {
+      const uint64_t key = key_dist(generator);
+      const uint64_t value = value_dist(generator);
+      if (i % 3 != 0) {
+        EXPECT_EQ(tree.Insert(ArtTestKey(key), value), reference.emplace(key, value).second);
+      } else {
+        // Mostly delete entries that exist, so that nodes shrink and merge
+        const auto it = reference.lower_bound({key, 0});
+        const auto entry = it == reference.end() ? ArtTestEntry{key, value} : *it;
+        EXPECT_EQ(tree.Delete(ArtTestKey(entry.first), entry.second), reference.erase(entry) == 1);
+      }
+
+      if (i % 1000 != 0) continue;
+      const uint64_t start = key_dist(generator);
+
+      std::vector<uint64_t> values;
+      tree.GetValue(ArtTestKey(start), &values);
+      std::vector<uint64_t> expected_values;
+      for (auto it = reference.lower_bound({start, 0}); it != reference.end() && it->first == start; ++it) {
+        expected_values.emplace_back(it->second);
+      }
+      EXPECT_EQ(values, expected_values);
+
+      ArtTestVisitor ascending(100);
+      tree.ScanAscending(ArtTestTree::EncodeBound(ArtTestKey(start), false), &ascending);
+      std::vector<ArtTestEntry> expected;
+      for (auto it = reference.lower_bound({start, 0}); it != reference.end() && expected.size() < 100; ++it) {
+        expected.emplace_back(*it);
+      }
+      EXPECT_EQ(ascending.Entries(), expected);
+
+      ArtTestVisitor descending(100);
+      tree.ScanDescending(ArtTestTree::EncodeBound(ArtTestKey(start), true), &descending);
+      expected.clear();
+      for (auto it = std::make_reverse_iterator(reference.upper_bound({start, std::numeric_limits<uint64_t>::max()}));
+           it != reference.rend() && expected.size() < 100; ++it) {
+        expected.emplace_back(*it);
+      }
+      EXPECT_EQ(descending.Entries(), expected);
+
+      tree.PerformGarbageCollection();
+    }
+
+    ArtTestVisitor all(reference.size() + 1);
+    tree.ScanAscending(ArtTestTree::EncodeBound(ArtTestKey(0), false), &all);
+    EXPECT_EQ(all.Entries(), std::vector<ArtTestEntry>(reference.begin(), reference.end()));
+  }
+}
+
+/**
+ * Checks that Successor and Predecessor step over every entry of a key, and stop at the ends of the key space.
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtTests, EntryOrder) {
+  auto entry = ArtTestTree::Encode(ArtTestKey(7), std::numeric_limits<uint64_t>::max());
+  EXPECT_TRUE(ArtTestTree::Successor(&entry));
+  EXPECT_EQ(entry, ArtTestTree::EncodeBound(ArtTestKey(8), false));
+  EXPECT_TRUE(ArtTestTree::Predecessor(&entry));
+  EXPECT_EQ(entry, ArtTestTree::EncodeBound(ArtTestKey(7), true));
+
+  auto last = ArtTestTree::EncodeBound(ArtTestKey(std::numeric_limits<uint64_t>::max()), true);
+  EXPECT_FALSE(ArtTestTree::Successor(&last));
+  auto first = ArtTestTree::EncodeBound(ArtTestKey(0), false);
+  EXPECT_FALSE(ArtTestTree::Predecessor(&first));
+}
+
+/**
+ * Checks that nodes replaced by growing and shrinking are retained until two epochs have passed, and that the tree
+ * reports them until then.
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtTests, RetainedGarbage) {
+  ArtTestTree tree;
+  EXPECT_EQ(tree.NumRetainedGarbageNodes(), 0);
+  for (uint64_t key = 0; key < 1000; key++) EXPECT_TRUE(tree.Insert(ArtTestKey(key), key));
+  for (uint64_t key = 0; key < 1000; key += 2) EXPECT_TRUE(tree.Delete(ArtTestKey(key), key));
+  EXPECT_GT(tree.NumRetainedGarbageNodes(), 0);
+
+  tree.PerformGarbageCollection();
+  tree.PerformGarbageCollection();
+  EXPECT_EQ(tree.NumRetainedGarbageNodes(), 0);
+}
+
+/**
+ * Threads insert and delete their own values under a small set of shared keys, so that they keep growing, shrinking and
+ * merging the same nodes, while another thread scans and collects garbage. Scans must always come back sorted, and the
+ * tree must end up holding exactly the values that were not deleted.
+ */
+// NOLINTNEXTLINE
+TEST_F(ArtTests, ConcurrentMixed) {
+  const uint32_t num_writers = std::max(num_threads_, 2u) - 1;
+  const uint64_t num_keys = 256;
+  const uint64_t num_ops = 100000;
+  ArtTestTree tree;
+  std::atomic<uint32_t> num_finished{0};
+
+  auto workload = [&](const uint32_t id) {
+    if (id == num_writers) {
+      // Scanner
+      std::default_random_engine generator(id);
+      while (num_finished.load() < num_writers) {
+        ArtTestVisitor visitor(1000);
+        tree.ScanAscending(ArtTestTree::EncodeBound(ArtTestKey(generator() % num_keys), false), &visitor);
+        EXPECT_TRUE(std::is_sorted(visitor.Entries().begin(), visitor.Entries().end()));
+        tree.PerformGarbageCollection();
+      }
+      return;
+    }
+    for (uint64_t i = 0; i < num_ops; i++) {
+      const uint64_t key = (i * 7919) % num_keys;
+      const uint64_t value = id * num_ops + i;
+      EXPECT_TRUE(tree.Insert(ArtTestKey(key), value));
+      if (i % 2 == 1) {
+        EXPECT_TRUE(tree.Delete(ArtTestKey(key), value));
+      }
+    }
+    num_finished++;
+  };
+
+  common::WorkerPool thread_pool(num_writers + 1, {});
+  thread_pool.Startup();
+  MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool, num_writers + 1, workload);
+
+  ArtTestVisitor all(num_writers * num_ops);
+  tree.ScanAscending(ArtTestTree::EncodeBound(ArtTestKey(0), false), &all);
+  EXPECT_EQ(all.Entries().size(), num_writers * num_ops / 2);
+  for (const auto &entry : all.Entries()) {
+    EXPECT_EQ(entry.second % 2, 0);
+    EXPECT_EQ(entry.first, ((entry.second % num_ops) * 7919) % num_keys);
+  }
+}
+
+}  // namespace terrier::storage::index
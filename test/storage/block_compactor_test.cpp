@@ -1,5 +1,7 @@
 #include "storage/block_compactor.h"
 
+#include <algorithm>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 
@@ -256,10 +258,9 @@ TEST_F(BlockCompactorTest, GatherTest) {
 
     gc.PerformGarbageCollection();
     gc.PerformGarbageCollection();  // Second call to deallocate.
-    // Deallocate all the leftover gathered varlens
+    // Deallocate all the leftover gathered varlens and encoded columns
     // No need to gather the ones still in the block because they are presumably all gathered
-    for (storage::col_id_t col_id : layout.AllColumns())
-      if (layout.IsVarlen(col_id)) arrow_metadata.GetColumnInfo(layout, col_id).Deallocate();
+    for (storage::col_id_t col_id : layout.AllColumns()) arrow_metadata.GetColumnInfo(layout, col_id).Deallocate();
     block_store_.Release(block);
   }
 }
@@ -379,12 +380,283 @@ TEST_F(BlockCompactorTest, DictionaryCompressionTest) {
 
     gc.PerformGarbageCollection();
     gc.PerformGarbageCollection();  // Second call to deallocate.
-    // Deallocate all the leftover gathered varlens
+    // Deallocate all the leftover gathered varlens and encoded columns
     // No need to gather the ones still in the block because they are presumably all gathered
-    for (storage::col_id_t col_id : layout.AllColumns())
-      if (layout.IsVarlen(col_id)) arrow_metadata.GetColumnInfo(layout, col_id).Deallocate();
+    for (storage::col_id_t col_id : layout.AllColumns()) arrow_metadata.GetColumnInfo(layout, col_id).Deallocate();
     block_store_.Release(block);
   }
 }
 
+// This tests that a compactor which may not move tuples leaves blocks with gaps hot, freezes blocks whose tuples are
+// already contiguous after a GC run, and takes no more blocks off the queue per invocation than it is asked to.
+// NOLINTNEXTLINE
+TEST_F(BlockCompactorTest, NoMoveTest) {
+  uint32_t repeat = 10;
+  for (uint32_t iteration = 0; iteration < repeat; iteration++) {
+    storage::BlockLayout layout = StorageTestUtil::RandomLayoutNoVarlen(100, &generator_);
+    if (layout.NumSlots() < 2) continue;
+    storage::TupleAccessStrategy accessor(layout);
+    // Technically, the blocks above are not "in" the table, but since we don't sequential scan that does not matter
+    storage::DataTable table(common::ManagedPointer<storage::BlockStore>(&block_store_), layout,
+                             storage::layout_version_t(0));
+    storage::RawBlock *gapped_block = block_store_.Get();
+    accessor.InitializeRawBlock(&table, gapped_block, storage::layout_version_t(0));
+    storage::RawBlock *full_block = block_store_.Get();
+    accessor.InitializeRawBlock(&table, full_block, storage::layout_version_t(0));
+
+    // Enable GC to cleanup transactions started by the block compactor
+    transaction::TimestampManager timestamp_manager;
+    transaction::DeferredActionManager deferred_action_manager{common::ManagedPointer(&timestamp_manager)};
+    transaction::TransactionManager txn_manager{common::ManagedPointer(&timestamp_manager),
+                                                common::ManagedPointer(&deferred_action_manager),
+                                                common::ManagedPointer(&buffer_pool_), true, DISABLED};
+    storage::GarbageCollector gc{common::ManagedPointer(&timestamp_manager),
+                                 common::ManagedPointer(&deferred_action_manager), common::ManagedPointer(&txn_manager),
+                                 DISABLED};
+
+    for (storage::RawBlock *block : {gapped_block, full_block}) {
+      auto tuples = StorageTestUtil::PopulateBlockRandomly(&table, block, 0, &generator_);
+      for (auto &entry : tuples) delete[] reinterpret_cast<byte *>(entry.second);
+    }
+    // Filling the gap would take moving the last tuple into it
+    accessor.Deallocate(storage::TupleSlot(gapped_block, 0));
+
+    storage::BlockCompactor compactor(false);
+    compactor.PutInQueue(gapped_block);
+    compactor.PutInQueue(full_block);
+    EXPECT_EQ(compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager, 1), 0);
+    EXPECT_EQ(gapped_block->controller_.GetBlockState()->load(), storage::BlockState::HOT);
+    EXPECT_TRUE(accessor.Allocated(storage::TupleSlot(gapped_block, layout.NumSlots() - 1)));
+    EXPECT_EQ(full_block->controller_.GetBlockState()->load(), storage::BlockState::HOT);
+
+    EXPECT_EQ(compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager, 1), 0);
+    EXPECT_EQ(full_block->controller_.GetBlockState()->load(), storage::BlockState::COOLING);
+
+    // The compaction transaction wrote nothing, so it is up to the GC to put the block back into the queue
+    gc.PerformGarbageCollection();
+    gc.PerformGarbageCollection();
+    EXPECT_EQ(compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager, 1), 1);
+    EXPECT_EQ(full_block->controller_.GetBlockState()->load(), storage::BlockState::FROZEN);
+    EXPECT_EQ(accessor.GetArrowBlockMetadata(full_block).NumRecords(), layout.NumSlots());
+
+    gc.PerformGarbageCollection();
+    gc.PerformGarbageCollection();
+    for (storage::col_id_t col_id : layout.AllColumns())
+      accessor.GetArrowBlockMetadata(full_block).GetColumnInfo(layout, col_id).Deallocate();
+    block_store_.Release(gapped_block);
+    block_store_.Release(full_block);
+  }
+}
+
+// Decode a value of a lightweight encoded column the slow way
+int64_t DecodeValue(const storage::ArrowColumnInfo &col_info, const uint32_t offset) {
+  const storage::ArrowEncodedColumn &encoded = col_info.EncodedColumn();
+  switch (col_info.Type()) {
+    case storage::ArrowColumnType::RUN_LENGTH_ENCODED: {
+      const uint32_t *run_ends = encoded.RunEnds();
+      return encoded.RunValues()[std::upper_bound(run_ends, run_ends + encoded.NumRuns(), offset) - run_ends];
+    }
+    case storage::ArrowColumnType::FRAME_OF_REFERENCE:
+      return encoded.Min() + static_cast<int64_t>(encoded.Unpack(offset));
+    case storage::ArrowColumnType::DELTA_ENCODED: {
+      const uint32_t anchor = offset / storage::ArrowEncodedColumn::K_DELTA_ANCHOR_INTERVAL;
+      int64_t value = encoded.RunValues()[anchor];
+      for (uint32_t i = anchor * storage::ArrowEncodedColumn::K_DELTA_ANCHOR_INTERVAL + 1; i <= offset; i++)
+        value += encoded.Reference() + static_cast<int64_t>(encoded.Unpack(i));
+      return value;
+    }
+    default:
+      throw std::runtime_error("column is not encoded");
+  }
+}
+
+// This tests that freezing a block picks the smallest lightweight encoding for each integer column, that the encoded
+// columns decode to the values in the block, and that the memory they add to the block stays bounded.
+// The encodings are kept next to the plain values, so they are only worth it if much smaller than them.
+// NOLINTNEXTLINE
+TEST_F(BlockCompactorTest, EncodingTest) {
+  const storage::BlockLayout layout({8, 8, 8, 8, 8, 8});
+  const storage::col_id_t run_col(1), offset_col(2), delta_col(3), random_col(4), wide_col(5);
+  storage::TupleAccessStrategy accessor(layout);
+  storage::DataTable table(common::ManagedPointer<storage::BlockStore>(&block_store_), layout,
+                           storage::layout_version_t(0));
+  storage::RawBlock *block = table.GetBlocks()[0];
+
+  // Few long runs, a small range with some nulls, a large range with small deltas, random values, and a range that
+  // frame-of-reference would pack into fewer bits than the plain values, but not into few enough
+  const uint32_t num_tuples = layout.NumSlots();
+  std::uniform_int_distribution<int64_t> random_dist(std::numeric_limits<int64_t>::min(),
+                                                     std::numeric_limits<int64_t>::max());
+  uint32_t num_nulls = 0;
+  std::vector<std::vector<int64_t>> reference(layout.NumColumns());
+  for (uint32_t i = 0; i < num_tuples; i++) {
+    storage::TupleSlot slot;
+    ASSERT_TRUE(accessor.Allocate(block, &slot));
+    *reinterpret_cast<storage::UndoRecord **>(accessor.AccessForceNotNull(slot, storage::VERSION_POINTER_COLUMN_ID)) =
+        nullptr;
+    const auto n = static_cast<int64_t>(i);
+    const int64_t values[] = {n / 100, (n * 7919) % 1000 - 500, 1000000000000 + 3 * n + n % 2, random_dist(generator_),
+                              (n * 2654435761) % (int64_t(1) << 40)};
+    for (storage::col_id_t col_id : layout.AllColumns()) {
+      *reinterpret_cast<int64_t *>(accessor.AccessForceNotNull(slot, col_id)) = values[!col_id - 1];
+      reference[!col_id].push_back(values[!col_id - 1]);
+    }
+    if (i % 10 == 3) {
+      // Nulls are encoded as the value before them
+      accessor.SetNull(slot, offset_col);
+      reference[!offset_col].back() = reference[!offset_col][i - 1];
+      num_nulls++;
+    }
+  }
+
+  transaction::TimestampManager timestamp_manager;
+  transaction::DeferredActionManager deferred_action_manager{common::ManagedPointer(&timestamp_manager)};
+  transaction::TransactionManager txn_manager{common::ManagedPointer(&timestamp_manager),
+                                              common::ManagedPointer(&deferred_action_manager),
+                                              common::ManagedPointer(&buffer_pool_), true, DISABLED};
+  storage::GarbageCollector gc{common::ManagedPointer(&timestamp_manager),
+                               common::ManagedPointer(&deferred_action_manager), common::ManagedPointer(&txn_manager),
+                               DISABLED};
+  storage::BlockCompactor compactor;
+  compactor.PutInQueue(block);
+  compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager);  // compaction pass
+  gc.PerformGarbageCollection();
+  compactor.PutInQueue(block);
+  compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager);  // gathering pass
+  ASSERT_EQ(storage::BlockState::FROZEN, block->controller_.GetBlockState()->load());
+
+  auto &arrow_metadata = accessor.GetArrowBlockMetadata(block);
+  EXPECT_EQ(storage::ArrowColumnType::RUN_LENGTH_ENCODED, arrow_metadata.GetColumnInfo(layout, run_col).Type());
+  EXPECT_EQ(storage::ArrowColumnType::FRAME_OF_REFERENCE, arrow_metadata.GetColumnInfo(layout, offset_col).Type());
+  EXPECT_EQ(storage::ArrowColumnType::DELTA_ENCODED, arrow_metadata.GetColumnInfo(layout, delta_col).Type());
+  EXPECT_EQ(storage::ArrowColumnType::FIXED_LENGTH, arrow_metadata.GetColumnInfo(layout, random_col).Type());
+  EXPECT_EQ(storage::ArrowColumnType::FIXED_LENGTH, arrow_metadata.GetColumnInfo(layout, wide_col).Type());
+  EXPECT_EQ(num_nulls, arrow_metadata.NullCount(offset_col));
+  EXPECT_EQ((num_tuples - 1) / 100 + 1, arrow_metadata.GetColumnInfo(layout, run_col).EncodedColumn().NumRuns());
+  EXPECT_EQ(10, arrow_metadata.GetColumnInfo(layout, offset_col).EncodedColumn().BitWidth());
+
+  for (storage::col_id_t col_id : {run_col, offset_col, delta_col}) {
+    const storage::ArrowColumnInfo &col_info = arrow_metadata.GetColumnInfo(layout, col_id);
+    const auto &values = reference[!col_id];
+    EXPECT_EQ(*std::min_element(values.begin(), values.end()), col_info.EncodedColumn().Min());
+    EXPECT_EQ(*std::max_element(values.begin(), values.end()), col_info.EncodedColumn().Max());
+    for (uint32_t i = 0; i < num_tuples; i++) EXPECT_EQ(values[i], DecodeValue(col_info, i));
+  }
+
+  // Every encoding takes up at most a quarter of the plain values it accelerates scans of, so that the encodings add
+  // at most a quarter to the memory of the integer columns of a frozen block
+  const uint64_t plain_size = static_cast<uint64_t>(num_tuples) * sizeof(int64_t);
+  uint64_t encoded_size = 0;
+  for (storage::col_id_t col_id : layout.AllColumns()) {
+    const storage::ArrowColumnInfo &col_info = arrow_metadata.GetColumnInfo(layout, col_id);
+    if (!col_info.IsEncoded()) {
+      EXPECT_EQ(0, col_info.EncodedColumn().Size());
+      continue;
+    }
+    EXPECT_LE(col_info.EncodedColumn().Size() * storage::ArrowEncodedColumn::K_MAX_SIZE_DIVISOR, plain_size);
+    encoded_size += col_info.EncodedColumn().Size();
+  }
+  // Here, with 12 bytes per run of 100 values, 10 bits per value, and 1 bit per value plus an 8-byte anchor every 128
+  // values, they add about 4% to the five integer columns
+  EXPECT_LE(encoded_size * 20, plain_size * 5);
+
+  gc.PerformGarbageCollection();
+  gc.PerformGarbageCollection();
+}
+
+// This test fills a block through the storage layer, so that the writes maintain its zone maps, deletes the tuple
+// holding the largest value and freezes the block. It checks that the zone maps cover every value written while the
+// block is hot, narrow down to the live values once it is frozen, and let scans skip the block.
+// NOLINTNEXTLINE
+TEST_F(BlockCompactorTest, ZoneMapTest) {
+  const storage::BlockLayout layout({8, 8, 4});
+  const storage::col_id_t big_col(1), int_col(2);
+  storage::TupleAccessStrategy accessor(layout);
+  storage::DataTable table(common::ManagedPointer<storage::BlockStore>(&block_store_), layout,
+                           storage::layout_version_t(0));
+  storage::RawBlock *block = table.GetBlocks()[0];
+
+  transaction::TimestampManager timestamp_manager;
+  transaction::DeferredActionManager deferred_action_manager{common::ManagedPointer(&timestamp_manager)};
+  transaction::TransactionManager txn_manager{common::ManagedPointer(&timestamp_manager),
+                                              common::ManagedPointer(&deferred_action_manager),
+                                              common::ManagedPointer(&buffer_pool_), true, DISABLED};
+  storage::GarbageCollector gc{common::ManagedPointer(&timestamp_manager),
+                               common::ManagedPointer(&deferred_action_manager), common::ManagedPointer(&txn_manager),
+                               DISABLED};
+
+  auto tuples = StorageTestUtil::PopulateBlockRandomly(&table, block, percent_empty_, &generator_);
+  // Range of the non-null values of a column, leaving out the given slot
+  const auto value_range = [&](const storage::col_id_t col_id, const storage::TupleSlot excluded) {
+    int64_t min = std::numeric_limits<int64_t>::max(), max = std::numeric_limits<int64_t>::min();
+    for (const auto &entry : tuples) {
+      const storage::ProjectedRow *row = entry.second;
+      const uint16_t idx = static_cast<uint16_t>(
+          std::find(row->ColumnIds(), row->ColumnIds() + row->NumColumns(), col_id) - row->ColumnIds());
+      const byte *value = row->AccessWithNullCheck(idx);
+      if (entry.first == excluded || value == nullptr) continue;
+      const int64_t v = layout.AttrSize(col_id) == sizeof(int64_t) ? *reinterpret_cast<const int64_t *>(value)
+                                                                     : *reinterpret_cast<const int32_t *>(value);
+      min = std::min(min, v);
+      max = std::max(max, v);
+    }
+    return std::make_pair(min, max);
+  };
+
+  auto &arrow_metadata = accessor.GetArrowBlockMetadata(block);
+  const storage::TupleSlot no_slot(nullptr, 0);
+  for (storage::col_id_t col_id : {big_col, int_col}) {
+    const auto range = value_range(col_id, no_slot);
+    EXPECT_EQ(range.first, arrow_metadata.GetZoneMap(layout, col_id).Min());
+    EXPECT_EQ(range.second, arrow_metadata.GetZoneMap(layout, col_id).Max());
+  }
+
+  // Deleting a tuple leaves the zone maps of the hot block as they are
+  const auto full_range = value_range(big_col, no_slot);
+  storage::TupleSlot max_slot;
+  for (const auto &entry : tuples) {
+    const byte *value = entry.second->AccessWithNullCheck(0);
+    if (value != nullptr && *reinterpret_cast<const int64_t *>(value) == full_range.second) max_slot = entry.first;
+  }
+  auto *txn = txn_manager.BeginTransaction();
+  EXPECT_TRUE(table.Delete(common::ManagedPointer(txn), max_slot));
+  txn_manager.Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  EXPECT_EQ(full_range.second, arrow_metadata.GetZoneMap(layout, big_col).Max());
+  gc.PerformGarbageCollection();
+  gc.PerformGarbageCollection();
+
+  storage::BlockCompactor compactor;
+  compactor.PutInQueue(block);
+  compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager);  // compaction pass
+  gc.PerformGarbageCollection();
+  compactor.PutInQueue(block);
+  compactor.ProcessCompactionQueue(&deferred_action_manager, &txn_manager);  // gathering pass
+  ASSERT_EQ(storage::BlockState::FROZEN, block->controller_.GetBlockState()->load());
+
+  // Once frozen, the zone maps hold the exact range of the live values
+  const auto live_range = value_range(big_col, max_slot);
+  EXPECT_EQ(live_range.first, arrow_metadata.GetZoneMap(layout, big_col).Min());
+  EXPECT_EQ(live_range.second, arrow_metadata.GetZoneMap(layout, big_col).Max());
+  EXPECT_FALSE(arrow_metadata.GetZoneMap(layout, big_col).MayContain(full_range.second, full_range.second, false));
+
+  // Scans skip the block when no live value falls in the range they are looking for
+  storage::ProjectedColumnsInitializer initializer(layout, {big_col, int_col},
+                                                  common::Constants::K_DEFAULT_VECTOR_SIZE);
+  byte *buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedColumnsSize());
+  storage::ProjectedColumns *columns = initializer.Initialize(buffer);
+  const auto big_idx = static_cast<uint16_t>(columns->ColumnIds()[0] == big_col ? 0 : 1);
+  auto it = table.begin();
+  EXPECT_FALSE(table.TrySkipBlock(&it, *columns, {{big_idx, live_range.second, full_range.second, false}}));
+  EXPECT_TRUE(it == table.begin());
+  // Random values are negative as well, so they cannot be ordered as unsigned ones
+  EXPECT_FALSE(table.TrySkipBlock(&it, *columns, {{big_idx, full_range.second, full_range.second, true}}));
+  EXPECT_TRUE(table.TrySkipBlock(&it, *columns, {{big_idx, full_range.second, full_range.second, false}}));
+  EXPECT_TRUE(it == table.end());
+  delete[] buffer;
+
+  for (auto &entry : tuples) delete[] reinterpret_cast<byte *>(entry.second);
+  gc.PerformGarbageCollection();
+  gc.PerformGarbageCollection();
+}
+
 }  // namespace terrier
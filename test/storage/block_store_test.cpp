@@ -0,0 +1,83 @@
+#include <thread>  // NOLINT
+#include <unordered_set>
+#include <vector>
+
+#include "storage/storage_defs.h"
+#include "test_util/multithread_test_util.h"
+#include "test_util/test_harness.h"
+
+namespace terrier {
+
+struct BlockStoreTests : public TerrierTest {
+  // Gets the given number of blocks and checks that they are aligned, writable and distinct
+  static std::vector<storage::RawBlock *> GetBlocks(storage::BlockStore *const store, const uint32_t num_blocks) {
+    std::vector<storage::RawBlock *> blocks;
+    std::unordered_set<storage::RawBlock *> distinct;
+    for (uint32_t i = 0; i < num_blocks; i++) {
+      storage::RawBlock *const block = store->Get();
+      EXPECT_EQ(0, reinterpret_cast<uintptr_t>(block) % common::Constants::BLOCK_SIZE);
+      // Blocks have to be writable all the way through
+      block->content_[sizeof(block->content_) - 1] = byte{0};
+      EXPECT_TRUE(distinct.insert(block).second);
+      blocks.push_back(block);
+    }
+    return blocks;
+  }
+};
+
+// Blocks carved out of mapped chunks behave like heap-allocated ones, and released blocks are handed out again
+// NOLINTNEXTLINE
+TEST_F(BlockStoreTests, MappedBlocks) {
+  for (const auto page_size : {storage::BlockPageSize::DEFAULT, storage::BlockPageSize::HUGE_2MB}) {
+    storage::BlockStore store(100, 100, page_size, true, 0);
+    auto blocks = GetBlocks(&store, 50);
+    std::unordered_set<storage::RawBlock *> released(blocks.begin(), blocks.end());
+    for (auto *const block : blocks) store.Release(block);
+
+    // Nothing new should have to be mapped while the released blocks are around
+    for (auto *const block : GetBlocks(&store, 50)) {
+      EXPECT_TRUE(released.count(block) != 0);
+      store.Release(block);
+    }
+  }
+}
+
+// A reserve is mapped up front, and handed out without going past it
+// NOLINTNEXTLINE
+TEST_F(BlockStoreTests, Prefault) {
+  const uint64_t reserve = 40;
+  storage::BlockStore store(100, 100, storage::BlockPageSize::HUGE_2MB, false, reserve);
+  EXPECT_GE(store.Reserve(reserve), reserve);
+
+  // The heap-allocating store has nothing to reserve
+  storage::BlockStore heap_store(100, 100);
+  EXPECT_EQ(0, heap_store.Reserve(reserve));
+
+  for (auto *const block : GetBlocks(&store, reserve)) store.Release(block);
+}
+
+// Concurrent inserting threads get distinct blocks, and every block is placed on some NUMA node
+// NOLINTNEXTLINE
+TEST_F(BlockStoreTests, NumaPlacement) {
+  const uint32_t num_threads = MultiThreadTestUtil::HardwareConcurrency();
+  const uint32_t blocks_per_thread = 8;
+  storage::BlockStore store(num_threads * blocks_per_thread, 0, storage::BlockPageSize::DEFAULT, true, 0);
+  std::vector<std::vector<storage::RawBlock *>> thread_blocks(num_threads);
+  common::WorkerPool thread_pool(num_threads, {});
+  thread_pool.Startup();
+  MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool, num_threads, [&](uint32_t id) {
+    for (uint32_t i = 0; i < blocks_per_thread; i++) thread_blocks[id].push_back(store.Get());
+  });
+
+  std::vector<storage::RawBlock *> all_blocks;
+  for (const auto &blocks : thread_blocks) all_blocks.insert(all_blocks.end(), blocks.begin(), blocks.end());
+  EXPECT_EQ(num_threads * blocks_per_thread,
+            std::unordered_set<storage::RawBlock *>(all_blocks.begin(), all_blocks.end()).size());
+
+  uint64_t num_grouped = 0;
+  for (const auto &node_blocks : storage::BlockStore::GroupByNumaNode(all_blocks)) num_grouped += node_blocks.size();
+  EXPECT_EQ(all_blocks.size(), num_grouped);
+  for (auto *const block : all_blocks) store.Release(block);
+}
+
+}  // namespace terrier
@@ -1,9 +1,16 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>  // NOLINT
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
 #include <random>
+#include <thread>  // NOLINT
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "main/db_main.h"
@@ -532,6 +539,228 @@ TEST_F(BwTreeIndexTests, ScanLimitDescending) {
   txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
 }
 
+/**
+ * Tests that cursors hand out visible values in scan order a batch at a time, skip invisible values without ending the
+ * scan early, and stop at their limit
+ */
+// NOLINTNEXTLINE
+TEST_F(BwTreeIndexTests, ScanCursor) {
+  // populate index with [0..20] even keys
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 20; i += 2) {
+    auto *const insert_redo =
+        insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+
+  // a concurrent txn inserts the odd keys [1..19], which must not be visible to scan_txn
+  auto *const uncommitted_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 1; i < 20; i += 2) {
+    auto *const insert_redo =
+        uncommitted_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(uncommitted_txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(uncommitted_txn), *insert_key, tuple_slot));
+  }
+
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  storage::TupleSlot batch[3];
+
+  // cursor[3,15] in batches of 3 should hit keys 4, 6, 8 then 10, 12, 14
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 3;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 15;
+  auto cursor = default_index_->OpenScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr,
+                                                  high_key_pr, 0);
+  // the cursor no longer depends on the keys once it is open
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 0;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 0;
+  std::vector<storage::TupleSlot> results;
+  for (uint32_t num_slots; (num_slots = cursor->Next(batch, 3)) > 0;) {
+    EXPECT_LE(num_slots, 3);
+    results.insert(results.end(), batch, batch + num_slots);
+  }
+  EXPECT_EQ(results, std::vector<storage::TupleSlot>({reference.at(4), reference.at(6), reference.at(8),
+                                                      reference.at(10), reference.at(12), reference.at(14)}));
+  EXPECT_EQ(cursor->Next(batch, 3), 0);
+
+  // cursor[begin,end] with limit 4 should hit keys 0, 2 then 4, 6
+  cursor = default_index_->OpenScanAscending(*scan_txn, storage::index::ScanType::OpenBoth, 1, low_key_pr, high_key_pr,
+                                             4);
+  EXPECT_EQ(cursor->Next(batch, 2), 2);
+  EXPECT_EQ(reference.at(0), batch[0]);
+  EXPECT_EQ(reference.at(2), batch[1]);
+  EXPECT_EQ(cursor->Next(batch, 3), 2);
+  EXPECT_EQ(reference.at(4), batch[0]);
+  EXPECT_EQ(reference.at(6), batch[1]);
+  EXPECT_EQ(cursor->Next(batch, 3), 0);
+
+  // descending cursor[5,21] with limit 4 should hit keys 20, 18, 16 then 14
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 5;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 21;
+  cursor = default_index_->OpenScanDescending(*scan_txn, *low_key_pr, *high_key_pr, 4);
+  EXPECT_EQ(cursor->Next(batch, 3), 3);
+  EXPECT_EQ(reference.at(20), batch[0]);
+  EXPECT_EQ(reference.at(18), batch[1]);
+  EXPECT_EQ(reference.at(16), batch[2]);
+  EXPECT_EQ(cursor->Next(batch, 3), 1);
+  EXPECT_EQ(reference.at(14), batch[0]);
+  EXPECT_EQ(cursor->Next(batch, 3), 0);
+
+  // key cursor on an uncommitted key should hit nothing
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 7;
+  cursor = default_index_->OpenScanKey(*scan_txn, *low_key_pr);
+  EXPECT_EQ(cursor->Next(batch, 3), 0);
+  cursor.reset();
+
+  txn_manager_->Abort(uncommitted_txn);
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+// Verifies that a cursor asked to keep keys hands back the key of each visible value it returns
+// NOLINTNEXTLINE
+TEST_F(BwTreeIndexTests, ScanCursorKeys) {
+  // populate index with [0..20] keys, where only the even keys are committed
+  std::map<int32_t, storage::TupleSlot> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  auto *const uncommitted_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i <= 20; i++) {
+    auto *const txn = i % 2 == 0 ? insert_txn : uncommitted_txn;
+    auto *const insert_redo =
+        txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    auto *const insert_tuple = insert_redo->Delta();
+    *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn), insert_redo);
+
+    auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+    *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+    EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(txn), *insert_key, tuple_slot));
+    reference[i] = tuple_slot;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  auto *const low_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  auto *const high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  storage::TupleSlot batch[4];
+
+  // cursor[3,15] sees candidates 3..15, of which only the even keys are visible, and each key must line up with its
+  // value after the invisible candidates are dropped
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 3;
+  *reinterpret_cast<int32_t *>(high_key_pr->AccessForceNotNull(0)) = 15;
+  auto cursor = default_index_->OpenScanAscending(*scan_txn, storage::index::ScanType::Closed, 1, low_key_pr,
+                                                  high_key_pr, 0);
+  cursor->KeepKeys();
+  // the key buffers are free to reuse once the cursor is open
+  auto *const key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  std::vector<int32_t> keys;
+  for (uint32_t num_slots; (num_slots = cursor->Next(batch, 4)) > 0;) {
+    for (uint32_t idx = 0; idx < num_slots; idx++) {
+      cursor->CopyKey(idx, key_pr);
+      const auto key = *reinterpret_cast<const int32_t *>(key_pr->AccessWithNullCheck(0));
+      EXPECT_EQ(reference.at(key), batch[idx]);
+      keys.emplace_back(key);
+    }
+  }
+  EXPECT_EQ(keys, std::vector<int32_t>({4, 6, 8, 10, 12, 14}));
+
+  // descending cursor[0,9] should hand back keys 8, 6, 4, 2, 0
+  auto *const descending_high_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_2_);
+  *reinterpret_cast<int32_t *>(low_key_pr->AccessForceNotNull(0)) = 0;
+  *reinterpret_cast<int32_t *>(descending_high_key_pr->AccessForceNotNull(0)) = 9;
+  cursor = default_index_->OpenScanDescending(*scan_txn, *low_key_pr, *descending_high_key_pr, 0);
+  cursor->KeepKeys();
+  keys.clear();
+  for (uint32_t num_slots; (num_slots = cursor->Next(batch, 4)) > 0;) {
+    for (uint32_t idx = 0; idx < num_slots; idx++) {
+      cursor->CopyKey(idx, key_pr);
+      keys.emplace_back(*reinterpret_cast<const int32_t *>(key_pr->AccessWithNullCheck(0)));
+    }
+  }
+  EXPECT_EQ(keys, std::vector<int32_t>({8, 6, 4, 2, 0}));
+  cursor.reset();
+
+  txn_manager_->Abort(uncommitted_txn);
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Tests that a batch lookup returns the same visible values as looking up each key on its own, for keys in random
+ * order that repeat, miss, or only have uncommitted values
+ */
+// NOLINTNEXTLINE
+TEST_F(BwTreeIndexTests, ScanKeyBatch) {
+  // even keys in [0, 2000) get two committed values each, odd keys get one uncommitted value
+  const int32_t num_keys = 2000;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  auto *const uncommitted_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i < num_keys; i++) {
+    auto *const txn = i % 2 == 0 ? insert_txn : uncommitted_txn;
+    for (uint32_t copy = 0; copy < (i % 2 == 0 ? 2u : 1u); copy++) {
+      auto *const insert_redo =
+          txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+      auto *const insert_tuple = insert_redo->Delta();
+      *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+      const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn), insert_redo);
+
+      auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+      *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+      EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(txn), *insert_key, tuple_slot));
+    }
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  const uint32_t batch_size = 500;
+  const auto key_size = default_index_->GetProjectedRowInitializer().ProjectedRowSize();
+  std::vector<byte> key_buffers(batch_size * key_size);
+  std::vector<const ProjectedRow *> keys;
+  std::uniform_int_distribution<int32_t> key_dist(-10, num_keys + 10);
+  for (uint32_t i = 0; i < batch_size; i++) {
+    auto *const key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffers.data() + i * key_size);
+    *reinterpret_cast<int32_t *>(key->AccessForceNotNull(0)) = key_dist(generator_);
+    keys.emplace_back(key);
+  }
+
+  const auto slot_less = [](const storage::TupleSlot &lhs, const storage::TupleSlot &rhs) {
+    return std::make_pair(lhs.GetBlock(), lhs.GetOffset()) < std::make_pair(rhs.GetBlock(), rhs.GetOffset());
+  };
+  std::vector<storage::TupleSlot> values;
+  std::vector<uint32_t> offsets;
+  default_index_->ScanKeyBatch(*scan_txn, keys.data(), batch_size, &values, &offsets);
+  ASSERT_EQ(offsets.size(), batch_size + 1);
+  EXPECT_EQ(offsets.front(), 0);
+  EXPECT_EQ(offsets.back(), values.size());
+  for (uint32_t i = 0; i < batch_size; i++) {
+    std::vector<storage::TupleSlot> expected;
+    default_index_->ScanKey(*scan_txn, *keys[i], &expected);
+    std::vector<storage::TupleSlot> actual(values.begin() + offsets[i], values.begin() + offsets[i + 1]);
+    std::sort(expected.begin(), expected.end(), slot_less);
+    std::sort(actual.begin(), actual.end(), slot_less);
+    EXPECT_EQ(actual, expected);
+    const auto key = *reinterpret_cast<const int32_t *>(keys[i]->AccessWithNullCheck(0));
+    EXPECT_EQ(actual.size(), key >= 0 && key < num_keys && key % 2 == 0 ? 2 : 0);
+  }
+
+  txn_manager_->Abort(uncommitted_txn);
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
 // Verifies that primary key insert fails on write-write conflict
 // NOLINTNEXTLINE
 TEST_F(BwTreeIndexTests, UniqueKey1) {
@@ -1929,4 +2158,233 @@ TEST_F(BwTreeIndexTests, AbortDelete2) {
   txn_manager_->Commit(txn2, transaction::TransactionUtil::EmptyCallback, nullptr);
 }
 
+/**
+ * Bulk loads an index over a table that already holds committed tuples (each key twice), an aborted tuple and a tuple
+ * from a still running txn. Only the committed tuples should be indexed, and the unique index should refuse to build.
+ */
+// NOLINTNEXTLINE
+TEST_F(BwTreeIndexTests, BulkLoad) {
+  const int32_t num_keys = 100000;
+
+  auto insert_tuple = [&](transaction::TransactionContext *const txn, const int32_t key) {
+    auto *const insert_redo =
+        txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = key;
+    return sql_table_->Insert(common::ManagedPointer(txn), insert_redo);
+  };
+
+  std::map<int32_t, std::vector<storage::TupleSlot>> reference;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i < 2 * num_keys; i++) {
+    const int32_t key = i % num_keys;
+    reference[key].emplace_back(insert_tuple(insert_txn, key));
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const aborted_txn = txn_manager_->BeginTransaction();
+  insert_tuple(aborted_txn, num_keys);
+  txn_manager_->Abort(aborted_txn);
+
+  auto *const concurrent_txn = txn_manager_->BeginTransaction();
+  auto *const build_txn = txn_manager_->BeginTransaction();
+  insert_tuple(concurrent_txn, num_keys + 1);
+  txn_manager_->Commit(concurrent_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  EXPECT_TRUE(
+      default_index_->BulkLoad(common::ManagedPointer(build_txn), common::ManagedPointer(sql_table_), DISABLED));
+  EXPECT_FALSE(
+      unique_index_->BulkLoad(common::ManagedPointer(build_txn), common::ManagedPointer(sql_table_), DISABLED));
+
+  const auto by_location = [](const TupleSlot &l, const TupleSlot &r) {
+    return l.GetBlock() < r.GetBlock() || (l.GetBlock() == r.GetBlock() && l.GetOffset() < r.GetOffset());
+  };
+  std::vector<storage::TupleSlot> results;
+  auto *const scan_key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  for (int32_t key = 0; key < num_keys; key++) {
+    *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = key;
+    default_index_->ScanKey(*build_txn, *scan_key_pr, &results);
+    auto &expected = reference[key];
+    std::sort(results.begin(), results.end(), by_location);
+    std::sort(expected.begin(), expected.end(), by_location);
+    EXPECT_EQ(results, expected);
+    results.clear();
+  }
+
+  // Neither the aborted tuple nor the one committed after the building txn started was indexed
+  for (int32_t key = num_keys; key <= num_keys + 1; key++) {
+    *reinterpret_cast<int32_t *>(scan_key_pr->AccessForceNotNull(0)) = key;
+    default_index_->ScanKey(*build_txn, *scan_key_pr, &results);
+    EXPECT_TRUE(results.empty());
+  }
+
+  txn_manager_->Commit(build_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Bulk loads both indexes while other txns write to the table without maintaining them: a writer thread runs alongside
+ * the scans, and one txn keeps writing after the building txn commits, reusing a key it moved a tuple away from. A txn
+ * that can see the indexes then deletes one of their tuples. Once the indexes stop building, each should be valid and
+ * hold exactly the visible tuples, under their current keys.
+ */
+// NOLINTNEXTLINE
+TEST_F(BwTreeIndexTests, BulkLoadCatchUp) {
+  const int32_t num_keys = 100000;
+
+  auto insert_tuple = [&](transaction::TransactionContext *const txn, const int32_t key) {
+    auto *const insert_redo =
+        txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = key;
+    return sql_table_->Insert(common::ManagedPointer(txn), insert_redo);
+  };
+  // Changes the indexed column in place, as only a txn that cannot see the index would
+  auto update_tuple = [&](transaction::TransactionContext *const txn, const storage::TupleSlot slot,
+                          const int32_t key) {
+    auto *const update_redo =
+        txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    *reinterpret_cast<int32_t *>(update_redo->Delta()->AccessForceNotNull(0)) = key;
+    update_redo->SetTupleSlot(slot);
+    EXPECT_TRUE(sql_table_->Update(common::ManagedPointer(txn), update_redo));
+  };
+  auto delete_tuple = [&](transaction::TransactionContext *const txn, const storage::TupleSlot slot) {
+    txn->StageDelete(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, slot);
+    EXPECT_TRUE(sql_table_->Delete(common::ManagedPointer(txn), slot));
+  };
+
+  // Key of every visible tuple
+  std::unordered_map<storage::TupleSlot, int32_t> reference;
+  std::vector<storage::TupleSlot> loaded;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t key = 0; key < num_keys; key++) {
+    loaded.emplace_back(insert_tuple(insert_txn, key));
+    reference[loaded.back()] = key;
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // Each writer txn moves a tuple to a new key, deletes another one and inserts a new one. Every fourth one aborts.
+  auto *const build_txn = txn_manager_->BeginTransaction();
+  std::atomic<bool> built = false;
+  std::thread writer([&] {
+    for (int32_t i = 0; i < num_keys / 4 && !built; i++) {
+      auto *const txn = txn_manager_->BeginTransaction();
+      const auto moved = loaded[2 * i];
+      const auto deleted = loaded[2 * i + 1];
+      update_tuple(txn, moved, num_keys + i);
+      delete_tuple(txn, deleted);
+      const auto inserted = insert_tuple(txn, 2 * num_keys + i);
+      if (i % 4 == 3) {
+        txn_manager_->Abort(txn);
+        continue;
+      }
+      txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+      reference[moved] = num_keys + i;
+      reference.erase(deleted);
+      reference[inserted] = 2 * num_keys + i;
+    }
+  });
+  EXPECT_TRUE(default_index_->BulkLoad(common::ManagedPointer(build_txn), common::ManagedPointer(sql_table_),
+                                       txn_manager_));
+  EXPECT_TRUE(unique_index_->BulkLoad(common::ManagedPointer(build_txn), common::ManagedPointer(sql_table_),
+                                      txn_manager_));
+  built = true;
+  writer.join();
+
+  // A txn that began before the building txn committed writes after it did
+  auto *const late_txn = txn_manager_->BeginTransaction();
+  txn_manager_->Commit(build_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  EXPECT_TRUE(default_index_->IsBuilding());
+  const auto late_slot = insert_tuple(late_txn, 3 * num_keys);
+  update_tuple(late_txn, loaded[num_keys - 1], 3 * num_keys + 1);
+  const auto reused_slot = insert_tuple(late_txn, num_keys - 1);
+  delete_tuple(late_txn, loaded[num_keys - 2]);
+  txn_manager_->Commit(late_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  reference[loaded[num_keys - 1]] = 3 * num_keys + 1;
+  reference[reused_slot] = num_keys - 1;
+  reference.erase(loaded[num_keys - 2]);
+
+  // A txn that can see the indexes deletes the tuple they have no entry for yet
+  auto *const delete_txn = txn_manager_->BeginTransaction();
+  delete_tuple(delete_txn, late_slot);
+  auto *const key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(key_pr->AccessForceNotNull(0)) = 3 * num_keys;
+  default_index_->Delete(common::ManagedPointer(delete_txn), *key_pr, late_slot);
+  unique_index_->Delete(common::ManagedPointer(delete_txn), *key_pr, late_slot);
+  txn_manager_->Commit(delete_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // The GC thread runs the catch-up once the writers are done
+  while (default_index_->IsBuilding() || unique_index_->IsBuilding()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  std::vector<storage::TupleSlot> results;
+  for (auto *const index : {default_index_, unique_index_}) {
+    // The key left behind by the moved tuple is no duplicate
+    EXPECT_TRUE(index->IsValid());
+
+    // Every visible tuple is found under its current key...
+    for (const auto &entry : reference) {
+      *reinterpret_cast<int32_t *>(key_pr->AccessForceNotNull(0)) = entry.second;
+      index->ScanKey(*scan_txn, *key_pr, &results);
+      EXPECT_EQ(results, std::vector<storage::TupleSlot>{entry.first});
+      results.clear();
+    }
+
+    // ...and under no other key
+    index->ScanAscending(*scan_txn, storage::index::ScanType::OpenBoth, 1, nullptr, nullptr, 0, &results);
+    EXPECT_EQ(results.size(), reference.size());
+    EXPECT_EQ(std::unordered_set<storage::TupleSlot>(results.cbegin(), results.cend()).size(), reference.size());
+    results.clear();
+  }
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
+/**
+ * Bulk loads both indexes while a txn that cannot see them inserts a duplicate of a key already in the table. Once the
+ * indexes stop building, the unique index cannot hold both committed tuples, so it should be invalid rather than miss
+ * one of them, while the other index should hold both.
+ */
+// NOLINTNEXTLINE
+TEST_F(BwTreeIndexTests, BulkLoadCatchUpDuplicate) {
+  const int32_t num_keys = 1000;
+
+  auto insert_tuple = [&](transaction::TransactionContext *const txn, const int32_t key) {
+    auto *const insert_redo =
+        txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+    *reinterpret_cast<int32_t *>(insert_redo->Delta()->AccessForceNotNull(0)) = key;
+    return sql_table_->Insert(common::ManagedPointer(txn), insert_redo);
+  };
+
+  std::vector<storage::TupleSlot> loaded;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  for (int32_t key = 0; key < num_keys; key++) loaded.emplace_back(insert_tuple(insert_txn, key));
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const build_txn = txn_manager_->BeginTransaction();
+  auto *const writer_txn = txn_manager_->BeginTransaction();
+  EXPECT_TRUE(default_index_->BulkLoad(common::ManagedPointer(build_txn), common::ManagedPointer(sql_table_),
+                                       txn_manager_));
+  EXPECT_TRUE(unique_index_->BulkLoad(common::ManagedPointer(build_txn), common::ManagedPointer(sql_table_),
+                                      txn_manager_));
+  const auto duplicate_slot = insert_tuple(writer_txn, 0);
+  txn_manager_->Commit(build_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  txn_manager_->Commit(writer_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  EXPECT_TRUE(unique_index_->IsBuilding());
+
+  // The GC thread runs the catch-up once the writer is done
+  while (default_index_->IsBuilding() || unique_index_->IsBuilding()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(default_index_->IsValid());
+  EXPECT_FALSE(unique_index_->IsValid());
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  auto *const key_pr = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+  *reinterpret_cast<int32_t *>(key_pr->AccessForceNotNull(0)) = 0;
+  std::vector<storage::TupleSlot> results;
+  default_index_->ScanKey(*scan_txn, *key_pr, &results);
+  EXPECT_EQ(std::unordered_set<storage::TupleSlot>(results.cbegin(), results.cend()),
+            (std::unordered_set<storage::TupleSlot>{loaded[0], duplicate_slot}));
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
 }  // namespace terrier::storage::index
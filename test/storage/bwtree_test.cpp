@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <random>
+#include <utility>
 #include <vector>
 #include "bwtree/bloom_filter.h"
 #include "bwtree/sorted_small_set.h"
@@ -218,6 +219,62 @@ TEST_F(BwTreeTests, ReverseIterator) {
   delete tree;
 }
 
+/**
+ * Bulk loads even keys (and a run of duplicates spanning several leaves), then concurrently inserts odd keys on top of
+ * the bottom-up built structure so that its nodes get split and consolidated like any other.
+ */
+// NOLINTNEXTLINE
+TEST_F(BwTreeTests, BulkLoad) {
+  const int64_t key_num = 1024 * 1024;
+  const int64_t dup_key = key_num / 2;
+  const int64_t dup_num = 1000;
+
+  common::WorkerPool thread_pool(num_threads_, {});
+  thread_pool.Startup();
+  auto *const tree = BwTreeTestUtil::GetEmptyTree();
+
+  std::vector<std::pair<int64_t, int64_t>> items;
+  for (int64_t i = 0; i < key_num; i += 2) {
+    items.emplace_back(i, i);
+    if (i == dup_key) {
+      for (int64_t j = 1; j < dup_num; j++) items.emplace_back(i, -j);
+    }
+  }
+  tree->BulkLoad(items.data(), items.data() + items.size());
+
+  // Every bulk loaded item must be reachable through point lookups
+  for (int64_t i = 0; i < key_num; i += 2) {
+    EXPECT_EQ(tree->GetValue(i).size(), i == dup_key ? dup_num : 1);
+  }
+
+  // Concurrently insert the odd keys, which splits the bulk loaded nodes
+  auto workload = [&](uint32_t id) {
+    const uint32_t gcid = id + 1;
+    tree->AssignGCID(gcid);
+    for (int64_t i = 2 * id + 1; i < key_num; i += 2 * num_threads_) {
+      EXPECT_TRUE(tree->Insert(i, i));
+    }
+    tree->UnregisterThread(gcid);
+  };
+
+  tree->UpdateThreadLocal(num_threads_ + 1);
+  MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool, num_threads_, workload);
+  tree->UpdateThreadLocal(1);
+
+  // A full scan must see every key in order
+  int64_t expected = 0;
+  for (auto it = tree->Begin(); !it.IsEnd(); it++) {
+    if (it->first == dup_key && it->second != dup_key) continue;
+    EXPECT_EQ(it->first, expected);
+    EXPECT_EQ(it->second, expected);
+    expected++;
+  }
+  EXPECT_EQ(expected, key_num);
+  EXPECT_EQ(tree->GetValue(dup_key).size(), dup_num);
+
+  delete tree;
+}
+
 /**
  * Adapted from https://github.com/wangziqi2013/BwTree/blob/master/test/random_pattern_test.cpp
  */
@@ -476,6 +533,27 @@ TEST_F(BwTreeTests, Interleaved) {
   delete tree;
 }
 
+/**
+ * Checks that delta chains replaced by consolidation are retained until their epoch is cleared, and that the tree
+ * reports them until then.
+ */
+// NOLINTNEXTLINE
+TEST_F(BwTreeTests, RetainedGarbage) {
+  // Without a background GC thread, so that only the calls below clear epochs
+  auto *const tree = new third_party::bwtree::BwTree<int64_t, int64_t>{false};
+  EXPECT_EQ(tree->GetRetainedGarbageNodeCount(), 0);
+  for (int64_t key = 0; key < 10000; key++) EXPECT_TRUE(tree->Insert(key, key));
+  for (int64_t key = 0; key < 10000; key += 2) EXPECT_TRUE(tree->Delete(key, key));
+  EXPECT_GT(tree->GetRetainedGarbageNodeCount(), 0);
+
+  // The first pass closes the epoch the garbage was added to, the second one frees it
+  tree->PerformGarbageCollection();
+  tree->PerformGarbageCollection();
+  EXPECT_EQ(tree->GetRetainedGarbageNodeCount(), 0);
+
+  delete tree;
+}
+
 /**
  * Adapted from https://github.com/wangziqi2013/BwTree/blob/master/test/misc_test.cpp
  *
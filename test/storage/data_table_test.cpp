@@ -1,6 +1,7 @@
 #include "storage/data_table.h"
 
 #include <cstring>
+#include <random>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -234,6 +235,64 @@ TEST_F(DataTableTests, SimpleSequentialScan) {
   }
 }
 
+// Inserts tuples spanning two blocks, and truncates the version chains of a random half of them as the GC would, so
+// that scans have to mix copying runs of version-free tuples with materializing the others. Some tuples are updated
+// after the scanning transaction started, and the first block is frozen so it is read in place. Scanning with a buffer
+// smaller than the table must return exactly the visible versions, in slot order.
+// NOLINTNEXTLINE
+TEST_F(DataTableTests, BlockAtATimeScan) {
+  const uint32_t num_iterations = 5;
+  const uint16_t max_columns = 20;
+  for (uint32_t iteration = 0; iteration < num_iterations; ++iteration) {
+    RandomDataTableTestObject tested(&block_store_, max_columns, null_ratio_(generator_), &generator_);
+    const uint32_t num_slots = tested.Layout().NumSlots();
+    const uint32_t num_inserts = num_slots + num_slots / 2;
+    // bypass the test object to be more efficient with buffers
+    auto *txn = new transaction::TransactionContext(transaction::timestamp_t(0), transaction::timestamp_t(0),
+                                                    common::ManagedPointer(&buffer_pool_), DISABLED);
+    for (uint32_t i = 0; i < num_inserts; ++i) tested.InsertRandomTuple(txn, &generator_, &buffer_pool_);
+
+    // The first block is left without any versions so that it can be frozen
+    storage::RawBlock *const frozen_block = tested.InsertedTuples()[0].GetBlock();
+    storage::TupleAccessStrategy accessor(tested.Layout());
+    std::bernoulli_distribution truncate(0.5);
+    for (const auto &slot : tested.InsertedTuples()) {
+      if (slot.GetBlock() != frozen_block && !truncate(generator_)) continue;
+      auto *const version_ptr = accessor.AccessWithoutNullCheck(slot, storage::VERSION_POINTER_COLUMN_ID);
+      *reinterpret_cast<storage::UndoRecord **>(version_ptr) = nullptr;
+    }
+    std::uniform_int_distribution<uint32_t> second_block(num_slots, num_inserts - 1);
+    for (uint32_t i = 0; i < 100; ++i) {
+      tested.RandomlyUpdateTuple(transaction::timestamp_t(2), tested.InsertedTuples()[second_block(generator_)],
+                                 &generator_, &buffer_pool_);
+    }
+    frozen_block->controller_.GetBlockState()->store(storage::BlockState::FROZEN);
+
+    std::vector<storage::col_id_t> all_cols = StorageTestUtil::ProjectionListAllColumns(tested.Layout());
+    storage::ProjectedColumnsInitializer initializer(tested.Layout(), all_cols, num_slots / 3 + 1);
+    auto *buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedColumnsSize());
+    storage::ProjectedColumns *columns = initializer.Initialize(buffer);
+    uint32_t num_scanned = 0;
+    auto it = tested.GetTable().begin();
+    while (it != tested.GetTable().end()) {
+      tested.Scan(&it, transaction::timestamp_t(1), columns, &buffer_pool_);
+      for (uint32_t i = 0; i < columns->NumTuples(); i++, num_scanned++) {
+        ASSERT_LT(num_scanned, num_inserts);
+        EXPECT_EQ(columns->TupleSlots()[i], tested.InsertedTuples()[num_scanned]);
+        storage::ProjectedColumns::RowView stored = columns->InterpretAsRow(i);
+        const storage::ProjectedRow *ref =
+            tested.GetReferenceVersionedTuple(columns->TupleSlots()[i], transaction::timestamp_t(1));
+        EXPECT_TRUE(StorageTestUtil::ProjectionListEqualShallow(tested.Layout(), &stored, ref));
+      }
+    }
+    EXPECT_EQ(num_inserts, num_scanned);
+    // Would never return if the scan left an in-place reader behind
+    frozen_block->controller_.WaitUntilHot();
+    delete[] buffer;
+    delete txn;
+  }
+}
+
 // Generates a random table layout and coin flip bias for an attribute being null, inserts 1 random tuple into an empty
 // DataTable. Then, randomly updates the tuple num_updates times. Finally, Selects at each timestamp to verify that the
 // delta chain produces the correct tuple. Repeats for num_iterations.
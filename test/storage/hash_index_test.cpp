@@ -1,8 +1,10 @@
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "main/db_main.h"
@@ -234,6 +236,68 @@ TEST_F(HashIndexTests, DefaultInsert) {
   txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
 }
 
+/**
+ * Tests that a batch lookup returns the same visible values as looking up each key on its own, for keys in random
+ * order that repeat, miss, or only have uncommitted values
+ */
+// NOLINTNEXTLINE
+TEST_F(HashIndexTests, ScanKeyBatch) {
+  // even keys in [0, 2000) get two committed values each, odd keys get one uncommitted value
+  const int32_t num_keys = 2000;
+  auto *const insert_txn = txn_manager_->BeginTransaction();
+  auto *const uncommitted_txn = txn_manager_->BeginTransaction();
+  for (int32_t i = 0; i < num_keys; i++) {
+    auto *const txn = i % 2 == 0 ? insert_txn : uncommitted_txn;
+    for (uint32_t copy = 0; copy < (i % 2 == 0 ? 2u : 1u); copy++) {
+      auto *const insert_redo =
+          txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
+      auto *const insert_tuple = insert_redo->Delta();
+      *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
+      const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn), insert_redo);
+
+      auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
+      *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
+      EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(txn), *insert_key, tuple_slot));
+    }
+  }
+  txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  auto *const scan_txn = txn_manager_->BeginTransaction();
+  const uint32_t batch_size = 500;
+  const auto key_size = default_index_->GetProjectedRowInitializer().ProjectedRowSize();
+  std::vector<byte> key_buffers(batch_size * key_size);
+  std::vector<const ProjectedRow *> keys;
+  std::uniform_int_distribution<int32_t> key_dist(-10, num_keys + 10);
+  for (uint32_t i = 0; i < batch_size; i++) {
+    auto *const key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffers.data() + i * key_size);
+    *reinterpret_cast<int32_t *>(key->AccessForceNotNull(0)) = key_dist(generator_);
+    keys.emplace_back(key);
+  }
+
+  const auto slot_less = [](const storage::TupleSlot &lhs, const storage::TupleSlot &rhs) {
+    return std::make_pair(lhs.GetBlock(), lhs.GetOffset()) < std::make_pair(rhs.GetBlock(), rhs.GetOffset());
+  };
+  std::vector<storage::TupleSlot> values;
+  std::vector<uint32_t> offsets;
+  default_index_->ScanKeyBatch(*scan_txn, keys.data(), batch_size, &values, &offsets);
+  ASSERT_EQ(offsets.size(), batch_size + 1);
+  EXPECT_EQ(offsets.front(), 0);
+  EXPECT_EQ(offsets.back(), values.size());
+  for (uint32_t i = 0; i < batch_size; i++) {
+    std::vector<storage::TupleSlot> expected;
+    default_index_->ScanKey(*scan_txn, *keys[i], &expected);
+    std::vector<storage::TupleSlot> actual(values.begin() + offsets[i], values.begin() + offsets[i + 1]);
+    std::sort(expected.begin(), expected.end(), slot_less);
+    std::sort(actual.begin(), actual.end(), slot_less);
+    EXPECT_EQ(actual, expected);
+    const auto key = *reinterpret_cast<const int32_t *>(keys[i]->AccessWithNullCheck(0));
+    EXPECT_EQ(actual.size(), key >= 0 && key < num_keys && key % 2 == 0 ? 2 : 0);
+  }
+
+  txn_manager_->Abort(uncommitted_txn);
+  txn_manager_->Commit(scan_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
 // Verifies that primary key insert fails on write-write conflict
 // NOLINTNEXTLINE
 TEST_F(HashIndexTests, UniqueKey1) {
@@ -4,6 +4,7 @@
 #include <limits>
 #include <map>
 #include <random>
+#include <string>
 #include <vector>
 
 #include "catalog/index_schema.h"
@@ -1216,6 +1217,161 @@ TEST_F(IndexKeyTests, GenericKeyNonInlineVarlenComparisons) {
   delete[] pr_buffer;
 }
 
+/**
+ * Builds GenericKeys over random tuples with NULLs, negative numbers, signed zeros and strings that are prefixes of
+ * each other or contain zero bytes, and checks that comparing the normalized bytes agrees with comparing the tuples
+ * attribute by attribute. Also checks that keys decode back to the same tuples, and that partial comparisons only
+ * look at the leading attributes.
+ */
+// NOLINTNEXTLINE
+TEST_F(IndexKeyTests, GenericKeyNormalizedComparisons) {
+  const std::vector<type::TypeId> types{type::TypeId::SMALLINT, type::TypeId::VARCHAR, type::TypeId::DECIMAL,
+                                        type::TypeId::BIGINT};
+  std::vector<catalog::IndexSchema::Column> key_cols;
+  for (uint32_t i = 0; i < types.size(); i++) {
+    if (types[i] == type::TypeId::VARCHAR) {
+      key_cols.emplace_back("", types[i], 24, true,
+                            parser::ConstantValueExpression(type::TransientValueFactory::GetNull(types[i])));
+    } else {
+      key_cols.emplace_back("", types[i], true,
+                            parser::ConstantValueExpression(type::TransientValueFactory::GetNull(types[i])));
+    }
+    StorageTestUtil::ForceOid(&(key_cols.back()), catalog::indexkeycol_oid_t(i));
+  }
+  const IndexMetadata metadata(
+      catalog::IndexSchema(key_cols, storage::index::IndexType::BWTREE, false, false, false, true));
+  const auto &initializer = metadata.GetProjectedRowInitializer();
+  const auto &oid_to_offset = metadata.GetKeyOidToOffsetMap();
+  EXPECT_LE(metadata.NormalizedKeySize(), 64);
+
+  // Small domains, so that ties on the leading attributes are common
+  struct Tuple {
+    bool is_null_[4];
+    int16_t smallint_;
+    std::string varchar_;
+    double decimal_;
+    int64_t bigint_;
+  };
+  const std::vector<double> decimals{-2.5, -0.0, 0.0, 0.25, 1e300};
+  const std::vector<std::string> strings{
+      "", "a", std::string("a\0", 2), "ab", "abcdefghijklmnopq", "abcdefghijklmnopr", "b"};
+  std::uniform_int_distribution<uint32_t> null_dist(0, 5);
+  std::vector<Tuple> tuples(500);
+  for (auto &tuple : tuples) {
+    for (auto &is_null : tuple.is_null_) is_null = null_dist(generator_) == 0;
+    tuple.smallint_ = static_cast<int16_t>(std::uniform_int_distribution<int32_t>(-2, 2)(generator_));
+    tuple.varchar_ = *RandomTestUtil::UniformRandomElement(strings, &generator_);
+    tuple.decimal_ = *RandomTestUtil::UniformRandomElement(decimals, &generator_);
+    tuple.bigint_ = std::uniform_int_distribution<int64_t>(std::numeric_limits<int64_t>::min(),
+                                                           std::numeric_limits<int64_t>::max())(generator_);
+    if (std::uniform_int_distribution<uint32_t>(0, 1)(generator_) == 0) tuple.bigint_ %= 3;
+  }
+
+  // -1, 0 or 1 for the first num_attrs attributes, NULLs first
+  const auto compare = [](const Tuple &lhs, const Tuple &rhs, const uint32_t num_attrs) -> int {
+    for (uint32_t i = 0; i < num_attrs; i++) {
+      if (lhs.is_null_[i] || rhs.is_null_[i]) {
+        if (lhs.is_null_[i] != rhs.is_null_[i]) return lhs.is_null_[i] ? -1 : 1;
+        continue;
+      }
+      int result = 0;
+      switch (i) {
+        case 0:
+          result = (lhs.smallint_ > rhs.smallint_) - (lhs.smallint_ < rhs.smallint_);
+          break;
+        case 1:
+          result = lhs.varchar_.compare(rhs.varchar_);
+          break;
+        case 2:
+          result = (lhs.decimal_ > rhs.decimal_) - (lhs.decimal_ < rhs.decimal_);
+          break;
+        default:
+          result = (lhs.bigint_ > rhs.bigint_) - (lhs.bigint_ < rhs.bigint_);
+          break;
+      }
+      if (result != 0) return result < 0 ? -1 : 1;
+    }
+    return 0;
+  };
+
+  auto *const pr_buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  auto *const pr = initializer.InitializeRow(pr_buffer);
+  const auto to_key = [&](const Tuple &tuple, const uint32_t num_attrs) -> GenericKey<64> {
+    for (uint32_t i = 0; i < 4; i++) {
+      const auto offset = oid_to_offset.at(catalog::indexkeycol_oid_t(i));
+      if (tuple.is_null_[i]) {
+        pr->SetNull(offset);
+        continue;
+      }
+      byte *const attr = pr->AccessForceNotNull(offset);
+      switch (i) {
+        case 0:
+          *reinterpret_cast<int16_t *>(attr) = tuple.smallint_;
+          break;
+        case 1: {
+          const auto *const content = reinterpret_cast<const byte *>(tuple.varchar_.data());
+          const auto size = static_cast<uint32_t>(tuple.varchar_.size());
+          *reinterpret_cast<VarlenEntry *>(attr) = size <= VarlenEntry::InlineThreshold()
+                                                       ? VarlenEntry::CreateInline(content, size)
+                                                       : VarlenEntry::Create(content, size, false);
+          break;
+        }
+        case 2:
+          *reinterpret_cast<double *>(attr) = tuple.decimal_;
+          break;
+        default:
+          *reinterpret_cast<int64_t *>(attr) = tuple.bigint_;
+          break;
+      }
+    }
+    GenericKey<64> key;
+    key.SetFromProjectedRow(*pr, metadata, num_attrs);
+    return key;
+  };
+
+  std::vector<GenericKey<64>> keys;
+  keys.reserve(tuples.size());
+  for (const auto &tuple : tuples) keys.emplace_back(to_key(tuple, 4));
+
+  const auto generic_eq64 = std::equal_to<GenericKey<64>>();  // NOLINT transparent functors can't figure out template
+  const auto generic_lt64 = std::less<GenericKey<64>>();      // NOLINT transparent functors can't figure out template
+  const auto generic_hash64 = std::hash<GenericKey<64>>();    // NOLINT transparent functors can't figure out template
+  for (uint32_t i = 0; i < tuples.size(); i++) {
+    for (uint32_t j = 0; j < tuples.size(); j++) {
+      const int expected = compare(tuples[i], tuples[j], 4);
+      EXPECT_EQ(generic_lt64(keys[i], keys[j]), expected < 0);
+      EXPECT_EQ(generic_eq64(keys[i], keys[j]), expected == 0);
+      if (expected == 0) {
+        EXPECT_EQ(generic_hash64(keys[i]), generic_hash64(keys[j]));
+      }
+    }
+
+    // Partial comparisons against a bound built from a prefix of another tuple
+    const auto &bound_tuple = tuples[(i * 7919) % tuples.size()];
+    for (uint32_t num_attrs = 1; num_attrs <= 4; num_attrs++) {
+      const auto bound = to_key(bound_tuple, num_attrs);
+      EXPECT_EQ(keys[i].PartialLessThan(bound, &metadata, num_attrs), compare(tuples[i], bound_tuple, num_attrs) <= 0);
+    }
+
+    // Decoding and encoding again gives the same key
+    auto *const decoded_buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+    auto *const decoded = initializer.InitializeRow(decoded_buffer);
+    keys[i].CopyToProjectedRow(decoded, metadata);
+    const byte *const varchar_attr = decoded->AccessWithNullCheck(oid_to_offset.at(catalog::indexkeycol_oid_t(1)));
+    EXPECT_EQ(varchar_attr == nullptr, tuples[i].is_null_[1]);
+    if (varchar_attr != nullptr) {
+      const auto varlen = *reinterpret_cast<const VarlenEntry *>(varchar_attr);
+      EXPECT_EQ(std::string(reinterpret_cast<const char *>(varlen.Content()), varlen.Size()), tuples[i].varchar_);
+    }
+    GenericKey<64> reencoded;
+    reencoded.SetFromProjectedRow(*decoded, metadata, 4);
+    EXPECT_TRUE(generic_eq64(keys[i], reencoded));
+    delete[] decoded_buffer;
+  }
+
+  delete[] pr_buffer;
+}
+
 // NOLINTNEXTLINE
 TEST_F(IndexKeyTests, CompactIntsKeyBuilderTest) {
   const uint32_t num_iters = 100;
@@ -1255,6 +1411,31 @@ TEST_F(IndexKeyTests, GenericKeyBuilderTest) {
   }
 }
 
+// NOLINTNEXTLINE
+TEST_F(IndexKeyTests, GenericKeyArtBuilderTest) {
+  const uint32_t num_iters = 100;
+
+  const std::vector<type::TypeId> generic_key_types{
+      type::TypeId::BOOLEAN, type::TypeId::TINYINT,  type::TypeId::SMALLINT,  type::TypeId::INTEGER,
+      type::TypeId::BIGINT,  type::TypeId::DECIMAL,  type::TypeId::TIMESTAMP, type::TypeId::DATE,
+      type::TypeId::VARCHAR, type::TypeId::VARBINARY};
+
+  for (uint32_t i = 0; i < num_iters; i++) {
+    auto key_schema = StorageTestUtil::RandomGenericKeySchema(10, generic_key_types, &generator_);
+
+    key_schema.SetType(storage::index::IndexType::ART);
+
+    IndexBuilder builder;
+    builder.SetKeySchema(key_schema);
+    auto *index = builder.Build();
+    EXPECT_EQ(index->Type(), storage::index::IndexType::ART);
+    EXPECT_EQ(index->KeyKind(), storage::index::IndexKeyKind::GENERICKEY);
+    BasicOps(index);
+
+    delete index;
+  }
+}
+
 // NOLINTNEXTLINE
 TEST_F(IndexKeyTests, HashKeyBuilderTest) {
   const uint32_t num_iters = 100;
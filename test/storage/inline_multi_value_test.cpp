@@ -0,0 +1,53 @@
+#include "storage/index/inline_multi_value.h"
+
+#include <random>
+#include <set>
+#include <utility>
+
+#include "test_util/test_harness.h"
+
+namespace terrier::storage::index {
+
+struct InlineMultiValueTests : public TerrierTest {
+  using MultiValue = InlineMultiValue<int64_t, 3>;
+
+  static std::set<int64_t> Values(const MultiValue &value) { return {value.begin(), value.end()}; }
+};
+
+/**
+ * Randomly inserts and erases values so that the set keeps spilling to the heap and moving back inline, and checks it
+ * against a std::set, including copies and moves taken along the way.
+ */
+// NOLINTNEXTLINE
+TEST_F(InlineMultiValueTests, RandomOperations) {
+  std::default_random_engine generator;
+  std::uniform_int_distribution<int64_t> value_dist(0, 15);
+  MultiValue value(0);
+  std::set<int64_t> reference{0};
+
+  for (uint32_t i = 0; i < 10000; i++) {
+    const int64_t v = value_dist(generator);
+    if (i % 2 == 0) {
+      EXPECT_EQ(value.Insert(v), reference.insert(v).second);
+    } else {
+      EXPECT_EQ(value.Erase(v), reference.erase(v) == 1);
+    }
+    EXPECT_EQ(value.Size(), reference.size());
+    EXPECT_EQ(Values(value), reference);
+
+    if (i % 100 == 0) {
+      MultiValue copy(value);
+      EXPECT_EQ(Values(copy), reference);
+      MultiValue moved(std::move(copy));
+      EXPECT_EQ(Values(moved), reference);
+      EXPECT_EQ(copy.Size(), 0);  // NOLINT: checking the moved-from state on purpose
+      MultiValue assigned(-1);
+      assigned = moved;
+      EXPECT_EQ(Values(assigned), reference);
+      assigned = MultiValue(-1);
+      EXPECT_EQ(Values(assigned), std::set<int64_t>{-1});
+    }
+  }
+}
+
+}  // namespace terrier::storage::index
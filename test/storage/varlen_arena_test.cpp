@@ -0,0 +1,80 @@
+#include <cstring>
+#include <vector>
+
+#include "storage/storage_defs.h"
+#include "storage/varlen_arena.h"
+#include "test_util/test_harness.h"
+
+namespace terrier {
+
+struct VarlenArenaTests : public TerrierTest {
+  // Checks that the given entry holds a copy of the given content, and not the content itself
+  static void CheckCopy(const storage::VarlenEntry &entry, const std::vector<byte> &content) {
+    EXPECT_EQ(content.size(), entry.Size());
+    EXPECT_NE(content.data(), entry.Content());
+    EXPECT_EQ(0, std::memcmp(content.data(), entry.Content(), content.size()));
+  }
+};
+
+// Small values are inlined, medium ones packed into the arena and large ones allocated by themselves
+// NOLINTNEXTLINE
+TEST_F(VarlenArenaTests, CopyPaths) {
+  storage::VarlenArena arena;
+  const std::vector<byte> inline_value(storage::VarlenEntry::InlineThreshold(), byte{1});
+  const std::vector<byte> arena_value(storage::VarlenArena::MAX_ARENA_VALUE_SIZE, byte{2});
+  const std::vector<byte> large_value(storage::VarlenArena::MAX_ARENA_VALUE_SIZE + 1, byte{3});
+
+  const storage::VarlenEntry inline_entry = arena.Copy(inline_value.data(), inline_value.size());
+  EXPECT_TRUE(inline_entry.IsInlined());
+  EXPECT_FALSE(inline_entry.NeedReclaim());
+  CheckCopy(inline_entry, inline_value);
+  EXPECT_EQ(0, arena.NumChunks());
+
+  const storage::VarlenEntry arena_entry = arena.Copy(arena_value.data(), arena_value.size());
+  EXPECT_FALSE(arena_entry.IsInlined());
+  EXPECT_TRUE(arena_entry.NeedReclaim());
+  EXPECT_TRUE(arena_entry.IsInArena());
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(arena_entry.Content()) % 8);
+  CheckCopy(arena_entry, arena_value);
+  EXPECT_EQ(1, arena.NumChunks());
+
+  const storage::VarlenEntry large_entry = arena.Copy(large_value.data(), large_value.size());
+  EXPECT_TRUE(large_entry.NeedReclaim());
+  EXPECT_FALSE(large_entry.IsInArena());
+  CheckCopy(large_entry, large_value);
+  EXPECT_EQ(1, arena.NumChunks());
+
+  storage::VarlenArena::Deallocate(arena_entry);
+  storage::VarlenArena::Deallocate(large_entry);
+}
+
+// Values share chunks, and stay valid until deallocated regardless of the order the arena and values go away in
+// NOLINTNEXTLINE
+TEST_F(VarlenArenaTests, ChunkLifetime) {
+  const uint32_t value_size = 100;
+  const uint32_t num_values = 2 * storage::VarlenArena::CHUNK_SIZE / value_size;
+  std::vector<storage::VarlenEntry> entries;
+  {
+    storage::VarlenArena arena;
+    for (uint32_t i = 0; i < num_values; i++) {
+      const std::vector<byte> value(value_size, static_cast<byte>(i));
+      entries.push_back(arena.Copy(value.data(), value_size));
+    }
+    // Values are packed, with only the chunk header and alignment padding in between
+    EXPECT_EQ(3, arena.NumChunks());
+
+    // Deallocating values from a chunk the arena is still allocating from does not free the chunk under it
+    storage::VarlenArena::Deallocate(entries.back());
+    entries.pop_back();
+    const std::vector<byte> value(value_size, byte{0});
+    storage::VarlenArena::Deallocate(arena.Copy(value.data(), value_size));
+  }
+
+  // The arena is gone, and the values keep their chunks alive on their own until the last of them is deallocated
+  for (uint32_t i = 0; i < entries.size(); i++) {
+    CheckCopy(entries[i], std::vector<byte>(value_size, static_cast<byte>(i)));
+    storage::VarlenArena::Deallocate(entries[i]);
+  }
+}
+
+}  // namespace terrier
@@ -102,6 +102,8 @@ void Workload::Execute(int8_t worker_id, uint64_t execution_us_per_worker, uint6
                                                common::ManagedPointer<catalog::CatalogAccessor>(accessor)};
     auto params = GetQueryParams(query_name);
     exec_ctx.SetParams(std::move(params));
+    // TPC-H queries only read, so they can read frozen blocks in place
+    exec_ctx.SetReadOnly(true);
     query.Run(common::ManagedPointer<execution::exec::ExecutionContext>(&exec_ctx), mode);
     // Only execute up to query_num number of queries for this thread in round-robin
     counter = counter == query_num - 1 ? 0 : counter + 1;
@@ -6530,6 +6530,122 @@ class BwTree : public BwTreeBase {
     return ret;
   }
 
+  /*
+   * BulkLoad() - Build the tree bottom-up from a sorted array of key-value
+   *              pairs
+   *
+   * Leaf nodes are packed with consecutive items, after which every level of
+   * inner nodes is built from the low keys of the level below it until a
+   * single root remains. Compared with calling Insert() once per item this
+   * skips traversal, delta chain consolidation and node splits entirely.
+   *
+   * Nodes are only filled to 3/4 of the split threshold, so that inserts
+   * following the bulk load do not immediately split every node. Items with
+   * equal keys are never separated across two leaf nodes, which is the same
+   * invariant GetSplitSibling() maintains.
+   *
+   * NOTE: The tree must be empty, and the caller must guarantee that no
+   * other thread accesses the tree until this function returns
+   *
+   * NOTE 2: Items must be sorted by key
+   */
+  void BulkLoad(const KeyValuePair *begin_p, const KeyValuePair *end_p) {
+    TERRIER_ASSERT(std::is_sorted(begin_p, end_p, key_value_pair_cmp_obj), "Items must be sorted by key.");
+    TERRIER_ASSERT(GetNode(first_leaf_id)->GetItemCount() == 0, "Bulk load requires an empty tree.");
+
+    if (begin_p == end_p) {
+      return;
+    }
+
+    const auto leaf_fill = static_cast<size_t>(std::max(1, GetLeafNodeSizeUpperThreshold() * 3 / 4));
+    const auto inner_fill = static_cast<size_t>(std::max(2, GetInnerNodeSizeUpperThreshold() * 3 / 4));
+
+    // Cut the input into leaf sized runs. A run is extended past the fill
+    // factor to keep equal keys together, and the last run absorbs a tail
+    // that would otherwise be small enough to be merged right away
+    std::vector<const KeyValuePair *> leaf_starts;
+    for (const KeyValuePair *run_p = begin_p; run_p != end_p;) {
+      leaf_starts.push_back(run_p);
+      const KeyValuePair *cut_p = static_cast<size_t>(end_p - run_p) > leaf_fill ? run_p + leaf_fill : end_p;
+      while (cut_p != end_p && KeyCmpEqual(cut_p->first, (cut_p - 1)->first)) {
+        cut_p++;
+      }
+      if (end_p - cut_p <= GetLeafNodeSizeLowerThreshold()) {
+        cut_p = end_p;
+      }
+      run_p = cut_p;
+    }
+    leaf_starts.push_back(end_p);
+
+    // Free the initial root and empty leaf. The leftmost leaf then reuses
+    // FIRST_LEAF_NODE_ID since iterators always start from there
+    FreeNodeByNodeID(root_id.load());
+
+    // This holds the (low key, NodeID) pair of every node on the level that
+    // was built last, which is also the separator list for its parents
+    std::vector<KeyNodeIDPair> level;
+    level.reserve(leaf_starts.size() - 1);
+    for (size_t i = 0; i + 1 < leaf_starts.size(); i++) {
+      level.emplace_back(leaf_starts[i]->first, i == 0 ? first_leaf_id : GetNextNodeID());
+    }
+
+    for (size_t i = 0; i < level.size(); i++) {
+      const auto size = static_cast<int>(leaf_starts[i + 1] - leaf_starts[i]);
+      // The leftmost leaf has -Inf as low key, and the rightmost +Inf as high key
+      const KeyNodeIDPair low_key =
+          i == 0 ? std::make_pair(KeyType{}, INVALID_NODE_ID) : std::make_pair(level[i].first, ~INVALID_NODE_ID);
+      const KeyNodeIDPair high_key = i + 1 == level.size() ? std::make_pair(KeyType{}, INVALID_NODE_ID) : level[i + 1];
+
+      auto *leaf_node_p = reinterpret_cast<LeafNode *>(
+          ElasticNode<KeyValuePair>::Get(size, NodeType::LeafType, 0, size, low_key, high_key));
+      leaf_node_p->PushBack(leaf_starts[i], leaf_starts[i + 1]);
+
+      InstallNewNode(level[i].second, leaf_node_p);
+    }
+
+    // There must be at least one inner node as the root, even with one leaf
+    do {
+      // The first separator of the leftmost inner node is never looked at
+      level.front().first = KeyType{};
+
+      // Group separators into inner node sized runs in the same way as leaves
+      std::vector<size_t> inner_starts;
+      for (size_t run = 0; run != level.size();) {
+        inner_starts.push_back(run);
+        size_t cut = level.size() - run > inner_fill ? run + inner_fill : level.size();
+        if (level.size() - cut <= static_cast<size_t>(GetInnerNodeSizeLowerThreshold())) {
+          cut = level.size();
+        }
+        run = cut;
+      }
+      inner_starts.push_back(level.size());
+
+      std::vector<KeyNodeIDPair> parent_level;
+      parent_level.reserve(inner_starts.size() - 1);
+      for (size_t i = 0; i + 1 < inner_starts.size(); i++) {
+        parent_level.emplace_back(level[inner_starts[i]].first, GetNextNodeID());
+      }
+
+      for (size_t i = 0; i < parent_level.size(); i++) {
+        const auto size = static_cast<int>(inner_starts[i + 1] - inner_starts[i]);
+        // Inner nodes use their first separator as the low key
+        const KeyNodeIDPair &low_key = level[inner_starts[i]];
+        const KeyNodeIDPair high_key =
+            i + 1 == parent_level.size() ? std::make_pair(KeyType{}, INVALID_NODE_ID) : parent_level[i + 1];
+
+        auto *inner_node_p = reinterpret_cast<InnerNode *>(
+            ElasticNode<KeyNodeIDPair>::Get(size, NodeType::InnerType, 0, size, low_key, high_key));
+        inner_node_p->PushBack(level.data() + inner_starts[i], level.data() + inner_starts[i + 1]);
+
+        InstallNewNode(parent_level[i].second, inner_node_p);
+      }
+
+      level = std::move(parent_level);
+    } while (level.size() > 1);
+
+    root_id.store(level.front().second);
+  }
+
   /*
    * Insert() - Insert a key-value pair
    *
@@ -6860,6 +6976,14 @@ class BwTree : public BwTreeBase {
     epoch_manager.PerformGarbageCollection();
   }
 
+  /*
+   * GetRetainedGarbageNodeCount() - Returns the number of nodes that have been
+   *                                 unlinked but not yet reclaimed
+   *
+   * The value might be stale, and is only meant for reporting
+   */
+  uint64_t GetRetainedGarbageNodeCount() const { return epoch_manager.GetRetainedCount(); }
+
  public:
   // Key comparator
   const KeyComparator key_cmp_obj;
@@ -6975,6 +7099,11 @@ class BwTree : public BwTreeBase {
     // Therefore, strict ordering is required
     std::atomic<bool> exited_flag;
 
+    // Number of garbage nodes that have been added but not yet freed
+    // This is only read by external threads for reporting, so relaxed
+    // ordering is enough
+    std::atomic<uint64_t> retained_count;
+
     // If GC is done with external thread then this should be set
     // to nullptr
     // Otherwise it points to a thread created by EpochManager internally
@@ -7024,6 +7153,8 @@ class BwTree : public BwTreeBase {
 
       // This is used to notify the cleaner thread that it has ended
       exited_flag.store(false);
+
+      retained_count.store(0);
     }
 
     /*
@@ -7181,6 +7312,8 @@ class BwTree : public BwTreeBase {
 
         INDEX_LOG_TRACE("Add garbage node CAS failed. Retry");
       }  // while 1
+
+      retained_count.fetch_add(1, std::memory_order_relaxed);
     }
 
     /*
@@ -7250,6 +7383,12 @@ class BwTree : public BwTreeBase {
       CreateNewEpoch();
     }
 
+    /*
+     * GetRetainedCount() - Returns the number of garbage nodes that are
+     *                      waiting for their epoch to be cleared
+     */
+    inline uint64_t GetRetainedCount() const { return retained_count.load(std::memory_order_relaxed); }
+
 #else  // #ifdef USE_OLD_EPOCH
 
     /*
@@ -7280,6 +7419,12 @@ class BwTree : public BwTreeBase {
       return;
     }
 
+    /*
+     * GetRetainedCount() - Garbage is kept in thread-local lists that
+     *                      only their owners may read, so it is not counted
+     */
+    inline uint64_t GetRetainedCount() const { return 0; }
+
 #endif  // #ifdef USE_OLD_EPOCH
 
     /*
@@ -7535,6 +7680,8 @@ class BwTree : public BwTreeBase {
           // This invalidates any further reference to its
           // members (so we saved next pointer above)
           delete garbage_node_p;
+
+          retained_count.fetch_sub(1, std::memory_order_relaxed);
         }  // for
 
         // First need to save this in order to delete current node
@@ -8186,6 +8333,40 @@ class BwTree : public BwTreeBase {
       return temp;
     }
 
+    /*
+     * Seek() - Moves the iterator to the first item whose key >= the given key
+     *
+     * If the key falls within the key range of the cached leaf page, the
+     * iterator is moved by a binary search on that page without traversing
+     * the tree again. Sorted batches of lookups use this to share the work
+     * of loading a page between all keys that fall on it.
+     *
+     * NOTE: The cached page is a snapshot taken when it was loaded, so this
+     * sees the same items that iterating over the page would see
+     */
+    void Seek(BwTree *p_tree_p, const KeyType &key) {
+      if (ic_p != nullptr) {
+        LeafNode *leaf_node_p = ic_p->GetLeafNode();
+        const KeyNodeIDPair &low_key_pair = leaf_node_p->GetLowKeyPair();
+        const KeyNodeIDPair &high_key_pair = leaf_node_p->GetHighKeyPair();
+
+        // An invalid node ID marks the -Inf low key and the +Inf high key
+        if ((low_key_pair.second == INVALID_NODE_ID || p_tree_p->KeyCmpGreaterEqual(key, low_key_pair.first)) &&
+            (high_key_pair.second == INVALID_NODE_ID || p_tree_p->KeyCmpLess(key, high_key_pair.first))) {
+          kv_p = std::lower_bound(leaf_node_p->Begin(), leaf_node_p->End(), std::make_pair(key, ValueType{}),
+                                  p_tree_p->key_value_pair_cmp_obj);
+
+          // Items >= key only live on the following pages
+          if (kv_p == leaf_node_p->End() && high_key_pair.second != INVALID_NODE_ID) {
+            LowerBound(p_tree_p, &high_key_pair.first);
+          }
+          return;
+        }
+      }
+
+      LowerBound(p_tree_p, &key);
+    }
+
     /*
      * LowerBound() - Load leaf page whose key >= start_key
      *
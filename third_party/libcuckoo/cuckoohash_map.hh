@@ -478,6 +478,27 @@ class cuckoohash_map {
     }
   }
 
+  /**
+   * Prefetches the buckets and locks that a lookup of @p key would touch, so
+   * that a batch of lookups can overlap their cache misses. This is only a
+   * hint: it takes no locks, and the table may be resized before the lookup.
+   *
+   * @tparam K type of the key. This can be any type comparable with @c key_type
+   * @param key the key that will be searched for
+   */
+  template <typename K>
+  void prefetch(const K &key) const {
+    const hash_value hv = hashed_key(key);
+    const size_type hp = hashpower();
+    const size_type i1 = index_hash(hp, hv.hash);
+    const size_type i2 = alt_index(hp, hv.partial, i1);
+    locks_t &locks = get_current_locks();
+    __builtin_prefetch(&locks[lock_ind(i1)], 1);
+    __builtin_prefetch(&locks[lock_ind(i2)], 1);
+    __builtin_prefetch(&buckets_[i1]);
+    __builtin_prefetch(&buckets_[i2]);
+  }
+
   /**
    * Searches the table for @p key, and invokes @p fn on the value. @p fn is
    * allow to modify the contents of the value if found.